@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <string.h>
+#include <concord/discord.h>
+#include "automod.h"
+#include "normalize.h"
+#include "batch.h"
+#include "../io/log.h"
+#include "../metrics/metrics.h"
+#include "../rest/scheduler.h"
+#include "../store/infractions.h"
+#include "../utils/snowflake.h"
+#include "../utils/utils.h"
+
+uint32_t automod_delete_verdicts = 0;
+
+void automod_context_init(automod_ctx_t *context, const struct discord_message *message)
+{
+    context->message = message;
+    context->normalized = false;
+}
+
+const normalized_text_t *automod_context_text(automod_ctx_t *context)
+{
+    if (!context->normalized)
+    {
+        const char *content = context->message->content == NULL ? "" : context->message->content;
+        normalize_text(content, strlen(content), &context->text);
+        context->normalized = true;
+    }
+
+    return &context->text;
+}
+
+void automod_context_destroy(automod_ctx_t *context)
+{
+    if (context->normalized)
+        normalized_text_free(&context->text);
+
+    context->normalized = false;
+}
+
+/*
+ * Deletes the message and, with an infraction store, records the deletion
+ * against its author. The message ID doubles as the infraction ID, so a
+ * message is never recorded twice.
+ */
+static void automod_enforce(struct discord *client, const struct discord_message *message, uint32_t matched)
+{
+    /* The checks are listed in the order of their flags, so the lowest flag names the check. */
+    const char *check = automod_check_name((uint16_t) __builtin_ctz(matched));
+
+    log_info("automod: deleting message %lu by %lu in channel %lu (%s)", message->id, message->author->id,
+             message->channel_id, check);
+    rest_delete_message(client, message->channel_id, message->id, REST_PRIORITY_MODERATION);
+
+    if (infraction_store == NULL || message->guild_id == 0)
+        return;
+
+    const struct discord_user *self = discord_get_self(client);
+    char reason[64];
+    snowflake_parts_t parts;
+
+    snowflake_decode(message->id, &parts);
+
+    infraction_t infraction = {
+        .id = message->id,
+        .guild_id = message->guild_id,
+        .user_id = message->author->id,
+        .moderator_id = self != NULL ? self->id : 0,
+        .created_at_ms = parts.timestamp_ms,
+        .type = INFRACTION_TYPE_MESSAGE_DELETE,
+        .reason = reason,
+        .reason_length = (size_t) snprintf(reason, sizeof reason, "automod: %s", check),
+    };
+
+    if (!infraction_store_append(infraction_store, &infraction))
+        log_error("automod: failed to record the deletion of message %lu", message->id);
+}
+
+void automod_on_message(struct discord *client, automod_ctx_t *context)
+{
+    if (context->message->author->bot)
+        return;
+
+    uint64_t started_at = get_monotonic_time_ns();
+    const normalized_text_t *text = automod_context_text(context);
+    uint32_t attachments = context->message->attachments == NULL ? 0 : (uint32_t) context->message->attachments->size;
+    uint16_t first_check;
+    uint32_t verdict = automod_check_text(text, attachments, &first_check);
+
+    if (verdict != 0)
+    {
+        log_debug("automod: message %lu: verdict 0x%x, marks stripped: %zu, ignorables stripped: %zu",
+                  context->message->id, verdict, text->marks_stripped, text->ignorables_stripped);
+
+        if ((verdict & automod_delete_verdicts) != 0)
+            automod_enforce(client, context->message, verdict & automod_delete_verdicts);
+    }
+
+    metrics_record_handler(METRICS_HANDLER_AUTOMOD, started_at);
+}
@@ -0,0 +1,28 @@
+#ifndef SUDOBOT_AUTOMOD_AUTOMOD_H
+#define SUDOBOT_AUTOMOD_AUTOMOD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <concord/discord.h>
+#include "normalize.h"
+
+/*
+ * Per-message state shared by every rule engine. The normalized text is
+ * computed on first use and reused by all later rules for the same message.
+ */
+typedef struct automod_context
+{
+    const struct discord_message *message;
+    normalized_text_t text;
+    bool normalized;
+} automod_ctx_t;
+
+/* Verdict flags that get the message deleted; 0 only reports verdicts. */
+extern uint32_t automod_delete_verdicts;
+
+void automod_context_init(automod_ctx_t *context, const struct discord_message *message);
+const normalized_text_t *automod_context_text(automod_ctx_t *context);
+void automod_context_destroy(automod_ctx_t *context);
+void automod_on_message(struct discord *client, automod_ctx_t *context);
+
+#endif /* SUDOBOT_AUTOMOD_AUTOMOD_H */
@@ -0,0 +1,195 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "batch.h"
+#include "normalize.h"
+#include "../utils/snowflake.h"
+#include "../utils/utils.h"
+
+#define AUTOMOD_BATCH_CLOCK_INTERVAL 16
+#define AUTOMOD_NO_CHECK 0xFFFF
+
+static _Atomic uint64_t batch_budget_ns = AUTOMOD_BATCH_DEFAULT_BUDGET_US * 1000ULL;
+/* Moving average of the per-message cost, in nanoseconds. */
+static _Atomic uint64_t batch_message_cost_ns = 0;
+
+static uint32_t automod_check_invalid_utf8(const normalized_text_t *text, uint32_t attachment_count)
+{
+    (void) attachment_count;
+    return text->valid_utf8 ? 0 : AUTOMOD_VERDICT_INVALID_UTF8;
+}
+
+static uint32_t automod_check_mark_flood(const normalized_text_t *text, uint32_t attachment_count)
+{
+    (void) attachment_count;
+    return text->marks_stripped > 0 ? AUTOMOD_VERDICT_MARK_FLOOD : 0;
+}
+
+static uint32_t automod_check_ignorables(const normalized_text_t *text, uint32_t attachment_count)
+{
+    (void) attachment_count;
+    return text->ignorables_stripped > 0 ? AUTOMOD_VERDICT_IGNORABLES : 0;
+}
+
+/* Non-ASCII folded text whose skeleton is plain ASCII was spelled with lookalikes. */
+static uint32_t automod_check_confusables(const normalized_text_t *text, uint32_t attachment_count)
+{
+    (void) attachment_count;
+    bool folded_ascii = true;
+
+    if (text->is_ascii)
+        return 0;
+
+    for (size_t i = 0; i < text->folded_length && folded_ascii; i++)
+        folded_ascii = (unsigned char) text->folded[i] < 0x80;
+
+    if (folded_ascii)
+        return 0;
+
+    for (size_t i = 0; i < text->skeleton_length; i++)
+    {
+        if ((unsigned char) text->skeleton[i] >= 0x80)
+            return 0;
+    }
+
+    return text->skeleton_length > 0 ? AUTOMOD_VERDICT_CONFUSABLES : 0;
+}
+
+static uint32_t automod_check_attachment_flood(const normalized_text_t *text, uint32_t attachment_count)
+{
+    (void) text;
+    return attachment_count > AUTOMOD_ATTACHMENT_FLOOD_LIMIT ? AUTOMOD_VERDICT_ATTACHMENT_FLOOD : 0;
+}
+
+/* Counted on the folded text, so fullwidth and other lookalike spellings of a mention count too. */
+static uint32_t automod_check_mention_flood(const normalized_text_t *text, uint32_t attachment_count)
+{
+    mention_t mentions[AUTOMOD_MENTION_FLOOD_LIMIT * 4];
+    size_t pings = 0;
+    size_t count = mentions_extract(text->folded, text->folded_length, mentions,
+                                    sizeof (mentions) / sizeof (mentions[0]), NULL);
+
+    (void) attachment_count;
+
+    for (size_t i = 0; i < count && pings < AUTOMOD_MENTION_FLOOD_LIMIT; i++)
+        pings += mentions[i].type == MENTION_USER || mentions[i].type == MENTION_ROLE;
+
+    return pings >= AUTOMOD_MENTION_FLOOD_LIMIT ? AUTOMOD_VERDICT_MENTION_FLOOD : 0;
+}
+
+static const automod_check_t automod_checks[] = {
+    { "invalid_utf8", &automod_check_invalid_utf8 },
+    { "mark_flood", &automod_check_mark_flood },
+    { "ignorables", &automod_check_ignorables },
+    { "confusables", &automod_check_confusables },
+    { "attachment_flood", &automod_check_attachment_flood },
+    { "mention_flood", &automod_check_mention_flood },
+};
+
+/* Name of the check at index, as reported in first_check. */
+const char *automod_check_name(uint16_t index)
+{
+    return index < sizeof (automod_checks) / sizeof (automod_checks[0]) ? automod_checks[index].name : "none";
+}
+
+/**
+ * @brief Runs every native check over already-normalized text.
+ */
+uint32_t automod_check_text(const normalized_text_t *text, uint32_t attachment_count, uint16_t *first_check)
+{
+    uint32_t flags = 0;
+
+    *first_check = AUTOMOD_NO_CHECK;
+
+    for (size_t i = 0; i < sizeof (automod_checks) / sizeof (automod_checks[0]); i++)
+    {
+        uint32_t matched = automod_checks[i].run(text, attachment_count);
+
+        if (matched != 0 && flags == 0)
+            *first_check = (uint16_t) i;
+
+        flags |= matched;
+    }
+
+    return flags;
+}
+
+/**
+ * @brief Runs every check over the batch and fills one verdict per message.
+ * Messages left over once the latency budget is spent are marked
+ * AUTOMOD_VERDICT_SKIPPED so the caller can resubmit them.
+ * @return The number of messages checked.
+ */
+size_t automod_batch_run(const automod_batch_t *batch, automod_verdict_t *verdicts)
+{
+    uint64_t budget = atomic_load_explicit(&batch_budget_ns, memory_order_relaxed);
+    uint64_t started_at = get_monotonic_time_ns();
+    size_t checked = 0;
+
+    for (; checked < batch->count; checked++)
+    {
+        if (checked != 0 && checked % AUTOMOD_BATCH_CLOCK_INTERVAL == 0 &&
+            get_monotonic_time_ns() - started_at > budget)
+            break;
+
+        automod_verdict_t *verdict = &verdicts[checked];
+        uint32_t offset = batch->content_offsets[checked];
+        uint32_t end = batch->content_offsets[checked + 1];
+
+        verdict->flags = 0;
+        verdict->first_check = AUTOMOD_NO_CHECK;
+        verdict->reserved = 0;
+
+        if ((batch->flags != NULL && (batch->flags[checked] & AUTOMOD_BATCH_AUTHOR_BOT)) || end < offset)
+            continue;
+
+        normalized_text_t text;
+        uint32_t attachments = batch->attachment_counts == NULL ? 0 : batch->attachment_counts[checked];
+
+        normalize_text(batch->content + offset, end - offset, &text);
+        verdict->flags = automod_check_text(&text, attachments, &verdict->first_check);
+        normalized_text_free(&text);
+    }
+
+    for (size_t i = checked; i < batch->count; i++)
+    {
+        verdicts[i].flags = AUTOMOD_VERDICT_SKIPPED;
+        verdicts[i].first_check = AUTOMOD_NO_CHECK;
+        verdicts[i].reserved = 0;
+    }
+
+    if (checked > 0)
+    {
+        uint64_t cost = (get_monotonic_time_ns() - started_at) / checked;
+        uint64_t average = atomic_load_explicit(&batch_message_cost_ns, memory_order_relaxed);
+
+        average = average == 0 ? cost : (average * 7 + cost) / 8;
+        atomic_store_explicit(&batch_message_cost_ns, average, memory_order_relaxed);
+    }
+
+    return checked;
+}
+
+void automod_batch_set_budget_us(uint64_t budget_us)
+{
+    atomic_store_explicit(&batch_budget_ns, budget_us * 1000ULL, memory_order_relaxed);
+}
+
+/**
+ * @brief Suggests how many messages fit in one batch under the current
+ * latency budget, based on the observed per-message cost.
+ */
+size_t automod_batch_size_hint()
+{
+    uint64_t cost = atomic_load_explicit(&batch_message_cost_ns, memory_order_relaxed);
+    uint64_t budget = atomic_load_explicit(&batch_budget_ns, memory_order_relaxed);
+
+    if (cost == 0)
+        return AUTOMOD_BATCH_MIN_SIZE;
+
+    size_t size = (size_t) (budget / cost);
+
+    if (size < AUTOMOD_BATCH_MIN_SIZE)
+        return AUTOMOD_BATCH_MIN_SIZE;
+
+    return size > AUTOMOD_BATCH_MAX_SIZE ? AUTOMOD_BATCH_MAX_SIZE : size;
+}
@@ -0,0 +1,67 @@
+#ifndef SUDOBOT_AUTOMOD_BATCH_H
+#define SUDOBOT_AUTOMOD_BATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "normalize.h"
+
+#define AUTOMOD_BATCH_DEFAULT_BUDGET_US 2000
+#define AUTOMOD_BATCH_MIN_SIZE 16
+#define AUTOMOD_BATCH_MAX_SIZE 4096
+#define AUTOMOD_ATTACHMENT_FLOOD_LIMIT 5
+#define AUTOMOD_MENTION_FLOOD_LIMIT 10
+
+/*
+ * Columnar batch of messages. Message i's content is
+ * content[content_offsets[i] .. content_offsets[i + 1]), so content_offsets
+ * has count + 1 entries.
+ */
+typedef struct automod_batch
+{
+    size_t count;
+    const uint64_t *guild_ids;
+    const uint64_t *channel_ids;
+    const uint64_t *author_ids;
+    const uint32_t *content_offsets;
+    const char *content;
+    const uint32_t *attachment_counts;
+    /* Optional; bit 0 marks a bot author. */
+    const uint8_t *flags;
+} automod_batch_t;
+
+#define AUTOMOD_BATCH_AUTHOR_BOT 1
+
+enum automod_verdict_flags
+{
+    AUTOMOD_VERDICT_INVALID_UTF8 = 1 << 0,
+    AUTOMOD_VERDICT_MARK_FLOOD = 1 << 1,
+    AUTOMOD_VERDICT_IGNORABLES = 1 << 2,
+    AUTOMOD_VERDICT_CONFUSABLES = 1 << 3,
+    AUTOMOD_VERDICT_ATTACHMENT_FLOOD = 1 << 4,
+    AUTOMOD_VERDICT_MENTION_FLOOD = 1 << 5,
+    /* Not checked: the batch ran out of its latency budget first. */
+    AUTOMOD_VERDICT_SKIPPED = 1u << 31,
+};
+
+typedef struct automod_verdict
+{
+    uint32_t flags;
+    /* Index into the check table of the first check that matched, or 0xFFFF. */
+    uint16_t first_check;
+    uint16_t reserved;
+} automod_verdict_t;
+
+typedef struct automod_check
+{
+    const char *name;
+    uint32_t (*run)(const normalized_text_t *text, uint32_t attachment_count);
+} automod_check_t;
+
+size_t automod_batch_run(const automod_batch_t *batch, automod_verdict_t *verdicts);
+uint32_t automod_check_text(const normalized_text_t *text, uint32_t attachment_count, uint16_t *first_check);
+const char *automod_check_name(uint16_t index);
+void automod_batch_set_budget_us(uint64_t budget_us);
+size_t automod_batch_size_hint();
+
+#endif /* SUDOBOT_AUTOMOD_BATCH_H */
@@ -0,0 +1,270 @@
+#include <stdint.h>
+#include <string.h>
+#include "normalize.h"
+#include "unicode_tables.h"
+#include "../utils/xmalloc.h"
+
+#define REPLACEMENT_CHARACTER 0xFFFD
+
+struct normalize_buffer
+{
+    char *data;
+    size_t length;
+    size_t capacity;
+};
+
+/*
+ * ASCII bytes that change under folding or skeleton mapping. Plain ASCII
+ * text without any of these is returned as-is, without copying.
+ */
+static const bool ascii_mapped[128] = {
+    ['A' ... 'Z'] = true,
+    ['0'] = true,
+    ['1'] = true,
+    ['|'] = true,
+};
+
+static void normalize_buffer_init(struct normalize_buffer *buffer, size_t capacity)
+{
+    buffer->data = xmalloc(capacity + 1);
+    buffer->length = 0;
+    buffer->capacity = capacity;
+}
+
+static inline void normalize_buffer_append(struct normalize_buffer *buffer, const char *data, size_t length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        buffer->capacity = (buffer->capacity * 2) + length;
+        buffer->data = xrealloc(buffer->data, buffer->capacity + 1);
+    }
+
+    memcpy(buffer->data + buffer->length, data, length);
+    buffer->length += length;
+}
+
+static inline void normalize_buffer_append_codepoint(struct normalize_buffer *buffer, uint32_t codepoint)
+{
+    char encoded[4];
+    size_t length;
+
+    if (codepoint < 0x80)
+    {
+        encoded[0] = (char) codepoint;
+        length = 1;
+    }
+    else if (codepoint < 0x800)
+    {
+        encoded[0] = (char) (0xC0 | (codepoint >> 6));
+        encoded[1] = (char) (0x80 | (codepoint & 0x3F));
+        length = 2;
+    }
+    else if (codepoint < 0x10000)
+    {
+        encoded[0] = (char) (0xE0 | (codepoint >> 12));
+        encoded[1] = (char) (0x80 | ((codepoint >> 6) & 0x3F));
+        encoded[2] = (char) (0x80 | (codepoint & 0x3F));
+        length = 3;
+    }
+    else
+    {
+        encoded[0] = (char) (0xF0 | (codepoint >> 18));
+        encoded[1] = (char) (0x80 | ((codepoint >> 12) & 0x3F));
+        encoded[2] = (char) (0x80 | ((codepoint >> 6) & 0x3F));
+        encoded[3] = (char) (0x80 | (codepoint & 0x3F));
+        length = 4;
+    }
+
+    normalize_buffer_append(buffer, encoded, length);
+}
+
+static char *normalize_buffer_finish(struct normalize_buffer *buffer, size_t *length)
+{
+    buffer->data[buffer->length] = 0;
+    *length = buffer->length;
+    return buffer->data;
+}
+
+/*
+ * Decodes one code point, rejecting overlong forms, surrogates and values
+ * above U+10FFFF. Invalid sequences decode to U+FFFD and consume one byte.
+ */
+static uint32_t utf8_decode(const unsigned char *input, size_t length, size_t *consumed, bool *valid)
+{
+    unsigned char b0 = input[0];
+    unsigned char lower = 0x80, upper = 0xBF;
+    size_t needed;
+    uint32_t codepoint;
+
+    if (b0 < 0x80)
+    {
+        *consumed = 1;
+        return b0;
+    }
+    else if (b0 >= 0xC2 && b0 <= 0xDF)
+    {
+        needed = 1;
+        codepoint = b0 & 0x1F;
+    }
+    else if (b0 >= 0xE0 && b0 <= 0xEF)
+    {
+        needed = 2;
+        codepoint = b0 & 0x0F;
+
+        if (b0 == 0xE0)
+            lower = 0xA0;
+        else if (b0 == 0xED)
+            upper = 0x9F;
+    }
+    else if (b0 >= 0xF0 && b0 <= 0xF4)
+    {
+        needed = 3;
+        codepoint = b0 & 0x07;
+
+        if (b0 == 0xF0)
+            lower = 0x90;
+        else if (b0 == 0xF4)
+            upper = 0x8F;
+    }
+    else
+        goto utf8_decode_invalid;
+
+    if (needed >= length)
+        goto utf8_decode_invalid;
+
+    for (size_t i = 1; i <= needed; i++)
+    {
+        unsigned char b = input[i];
+
+        if (b < lower || b > upper)
+            goto utf8_decode_invalid;
+
+        lower = 0x80;
+        upper = 0xBF;
+        codepoint = (codepoint << 6) | (b & 0x3F);
+    }
+
+    *consumed = needed + 1;
+    return codepoint;
+
+utf8_decode_invalid:
+    *valid = false;
+    *consumed = 1;
+    return REPLACEMENT_CHARACTER;
+}
+
+static bool normalize_ascii_fast_path(const char *input, size_t length, normalized_text_t *text)
+{
+    const unsigned char *bytes = (const unsigned char *) input;
+    size_t i = 0;
+    uint64_t high_bits = 0;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, bytes + i, sizeof word);
+        high_bits |= word;
+    }
+
+    for (; i < length; i++)
+        high_bits |= bytes[i];
+
+    if ((high_bits & 0x8080808080808080ULL) != 0)
+        return false;
+
+    text->is_ascii = true;
+
+    for (i = 0; i < length; i++)
+    {
+        if (ascii_mapped[bytes[i]])
+            return false;
+    }
+
+    text->folded = input;
+    text->folded_length = length;
+    text->skeleton = input;
+    text->skeleton_length = length;
+    return true;
+}
+
+/**
+ * @brief Normalizes the given text for rule matching.
+ *
+ * Plain ASCII text that is already folded is referenced in place; anything
+ * else is decoded once and mapped through the generated two-stage tables
+ * into the folded and skeleton buffers in a single pass.
+ */
+void normalize_text(const char *input, size_t length, normalized_text_t *text)
+{
+    struct normalize_buffer folded, skeleton;
+    size_t mark_run = 0;
+
+    memset(text, 0, sizeof (*text));
+    text->valid_utf8 = true;
+
+    if (normalize_ascii_fast_path(input, length, text))
+        return;
+
+    normalize_buffer_init(&folded, length);
+    normalize_buffer_init(&skeleton, length);
+
+    for (size_t i = 0; i < length;)
+    {
+        size_t consumed;
+        uint32_t codepoint = utf8_decode((const unsigned char *) input + i, length - i, &consumed, &text->valid_utf8);
+        const struct unicode_props *props = unicode_lookup(codepoint);
+
+        if (props->flags & UNICODE_PROP_IGNORABLE)
+        {
+            text->ignorables_stripped++;
+            i += consumed;
+            continue;
+        }
+
+        if (props->flags & UNICODE_PROP_MARK)
+        {
+            if (++mark_run > NORMALIZE_MARK_RUN_LIMIT)
+            {
+                text->marks_stripped++;
+                i += consumed;
+                continue;
+            }
+        }
+        else
+            mark_run = 0;
+
+        if (props->fold_offset != UNICODE_NO_MAPPING)
+            normalize_buffer_append(&folded, unicode_mapping_data + props->fold_offset, props->fold_length);
+        else if (codepoint == REPLACEMENT_CHARACTER)
+            normalize_buffer_append_codepoint(&folded, codepoint);
+        else
+            normalize_buffer_append(&folded, input + i, consumed);
+
+        if (props->flags & UNICODE_PROP_MARK)
+        {
+            i += consumed;
+            continue;
+        }
+
+        if (props->skeleton_offset != UNICODE_NO_MAPPING)
+            normalize_buffer_append(&skeleton, unicode_mapping_data + props->skeleton_offset, props->skeleton_length);
+        else if (codepoint == REPLACEMENT_CHARACTER)
+            normalize_buffer_append_codepoint(&skeleton, codepoint);
+        else
+            normalize_buffer_append(&skeleton, input + i, consumed);
+
+        i += consumed;
+    }
+
+    text->storage[0] = normalize_buffer_finish(&folded, &text->folded_length);
+    text->storage[1] = normalize_buffer_finish(&skeleton, &text->skeleton_length);
+    text->folded = text->storage[0];
+    text->skeleton = text->storage[1];
+}
+
+void normalized_text_free(normalized_text_t *text)
+{
+    free(text->storage[0]);
+    free(text->storage[1]);
+    memset(text, 0, sizeof (*text));
+}
@@ -0,0 +1,28 @@
+#ifndef SUDOBOT_AUTOMOD_NORMALIZE_H
+#define SUDOBOT_AUTOMOD_NORMALIZE_H
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+/* Combining marks kept on a single base character before the rest are dropped. */
+#define NORMALIZE_MARK_RUN_LIMIT 2
+
+typedef struct normalized_text
+{
+    /* NFKC case-folded text, with ignorables and mark floods removed. */
+    const char *folded;
+    size_t folded_length;
+    /* UTS #39 confusable skeleton of the folded text, without any marks. */
+    const char *skeleton;
+    size_t skeleton_length;
+    bool is_ascii;
+    bool valid_utf8;
+    size_t marks_stripped;
+    size_t ignorables_stripped;
+    char *storage[2];
+} normalized_text_t;
+
+void normalize_text(const char *input, size_t length, normalized_text_t *text);
+void normalized_text_free(normalized_text_t *text);
+
+#endif /* SUDOBOT_AUTOMOD_NORMALIZE_H */
@@ -0,0 +1,8970 @@
+/* Generated by lib/scripts/gen_unicode_tables.py from Unicode 14.0.0. Do not edit. */
+
+#include "unicode_tables.h"
+
+const uint16_t unicode_stage1[UNICODE_STAGE1_SIZE] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 35, 35, 36, 37, 35, 35, 35, 35, 35, 35, 38, 39,
+    40, 41, 42, 35, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+    55, 56, 57, 58, 59, 60, 61, 35, 62, 63, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 64, 65, 35, 35, 66, 67, 68, 69, 35, 70, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 80, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+    35, 35, 35, 107, 35, 108, 109, 35, 110, 111, 112, 113, 35, 35, 35, 114,
+    35, 35, 35, 35, 115, 116, 35, 35, 35, 117, 118, 35, 35, 119, 120, 121,
+    122, 123, 124, 125, 126, 127, 128, 35, 129, 130, 35, 131, 132, 133, 134, 35,
+    135, 136, 137, 138, 139, 140, 35, 35, 141, 142, 143, 144, 35, 145, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 146, 147, 35, 35, 35, 35, 35, 148, 35, 149, 150,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 151, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 152, 35,
+    35, 35, 153, 154, 155, 35, 35, 35, 156, 157, 158, 159, 160, 161, 162, 163,
+    35, 35, 35, 35, 164, 165, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    166, 35, 167, 35, 35, 168, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 169, 170, 35, 35, 35, 35, 35, 35, 35, 35, 35, 171, 172, 35, 35,
+    35, 35, 173, 174, 175, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 176, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    177, 178, 179, 180, 181, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+};
+
+const uint16_t unicode_stage2[][UNICODE_BLOCK_SIZE] = {
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29, 0, 0, 0, 0, 0, 0, 0, 30, 0, 3, 0, 0, 31, 0, 32,
+        0, 0, 33, 34, 35, 36, 0, 0, 37, 38, 17, 0, 39, 40, 41, 0,
+        42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+        58, 59, 60, 61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72,
+        73, 73, 73, 73, 73, 73, 0, 74, 75, 75, 75, 75, 76, 76, 76, 76,
+        0, 77, 1, 1, 1, 1, 1, 0, 0, 78, 78, 78, 78, 79, 0, 79,
+    },
+    {
+        80, 73, 81, 73, 82, 73, 83, 74, 84, 74, 85, 74, 86, 74, 87, 88,
+        89, 0, 90, 75, 91, 75, 92, 75, 93, 75, 94, 75, 95, 96, 97, 96,
+        98, 96, 99, 96, 100, 101, 102, 0, 103, 76, 104, 76, 105, 76, 106, 76,
+        107, 76, 108, 108, 109, 110, 111, 112, 0, 113, 2, 114, 2, 115, 2, 116,
+        116, 117, 0, 118, 77, 119, 77, 120, 77, 121, 122, 0, 123, 1, 124, 1,
+        125, 1, 126, 0, 127, 128, 129, 128, 130, 128, 131, 132, 133, 132, 134, 132,
+        135, 132, 136, 137, 138, 137, 139, 0, 140, 78, 141, 78, 142, 78, 143, 78,
+        144, 78, 145, 78, 146, 147, 148, 79, 149, 150, 151, 152, 151, 153, 151, 21,
+    },
+    {
+        0, 154, 155, 0, 156, 0, 157, 158, 0, 159, 160, 161, 0, 0, 162, 163,
+        164, 165, 0, 166, 167, 0, 168, 169, 170, 0, 0, 0, 171, 172, 0, 173,
+        174, 1, 175, 0, 176, 0, 177, 178, 0, 179, 0, 0, 180, 0, 181, 182,
+        78, 183, 184, 185, 0, 186, 0, 187, 188, 0, 0, 0, 189, 0, 0, 0,
+        0, 0, 0, 0, 190, 190, 190, 191, 191, 191, 192, 192, 192, 193, 73, 194,
+        76, 195, 1, 196, 78, 197, 78, 198, 78, 199, 78, 200, 78, 0, 201, 73,
+        202, 73, 203, 204, 205, 0, 206, 96, 207, 112, 208, 1, 209, 1, 210, 211,
+        110, 212, 212, 212, 213, 96, 214, 215, 216, 77, 217, 73, 218, 204, 219, 220,
+    },
+    {
+        221, 73, 222, 73, 223, 75, 224, 75, 225, 76, 226, 76, 227, 1, 228, 1,
+        229, 128, 230, 128, 231, 78, 232, 78, 233, 132, 234, 137, 235, 0, 236, 101,
+        237, 0, 238, 0, 239, 0, 240, 73, 241, 75, 242, 1, 243, 1, 244, 1,
+        245, 1, 246, 79, 0, 0, 0, 0, 0, 0, 247, 248, 0, 249, 250, 0,
+        0, 251, 0, 252, 253, 254, 255, 0, 256, 0, 257, 0, 258, 0, 259, 0,
+        0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 96, 96, 0, 0, 0, 0, 0, 0, 76, 76, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 260, 0, 0, 101, 0, 0, 2,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        10, 261, 12, 20, 262, 263, 264, 25, 27, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 265, 266, 267, 268, 269, 270, 0, 0,
+        167, 14, 21, 26, 271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+        288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+        304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+        320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+        272, 273, 336, 291, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 31,
+        348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+        364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+        380, 0, 381, 0, 382, 0, 383, 0, 0, 0, 384, 0, 0, 0, 385, 386,
+    },
+    {
+        0, 0, 0, 0, 35, 387, 388, 389, 390, 391, 392, 0, 393, 0, 394, 395,
+        76, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 36, 407, 408, 409,
+        410, 411, 0, 412, 413, 414, 415, 416, 417, 418, 419, 420, 73, 75, 421, 76,
+        78, 73, 260, 79, 0, 75, 0, 0, 0, 76, 112, 0, 0, 422, 0, 1,
+        0, 423, 412, 0, 137, 78, 0, 424, 0, 147, 76, 78, 1, 78, 147, 425,
+        397, 403, 414, 394, 420, 415, 410, 0, 426, 0, 427, 0, 428, 0, 429, 0,
+        430, 0, 431, 0, 432, 0, 433, 0, 434, 0, 435, 0, 436, 0, 437, 0,
+        405, 411, 412, 0, 403, 400, 0, 438, 0, 412, 439, 0, 0, 440, 441, 442,
+    },
+    {
+        443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458,
+        459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474,
+        475, 476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490,
+        73, 0, 260, 128, 0, 75, 0, 0, 0, 491, 112, 0, 492, 101, 1, 0,
+        423, 74, 137, 79, 0, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        75, 75, 0, 128, 0, 132, 76, 76, 110, 0, 0, 0, 112, 491, 79, 0,
+        493, 0, 494, 0, 495, 0, 496, 0, 497, 0, 498, 0, 499, 0, 500, 0,
+        501, 0, 502, 0, 503, 0, 504, 505, 506, 0, 507, 0, 508, 0, 509, 0,
+    },
+    {
+        510, 0, 0, 511, 512, 513, 514, 515, 516, 517, 518, 0, 519, 0, 520, 0,
+        521, 128, 522, 0, 523, 0, 524, 0, 525, 0, 526, 0, 527, 0, 528, 0,
+        529, 0, 530, 0, 531, 0, 532, 0, 533, 0, 534, 0, 535, 0, 536, 0,
+        537, 0, 538, 0, 539, 0, 540, 0, 541, 0, 542, 101, 543, 0, 544, 0,
+        545, 546, 547, 548, 0, 549, 0, 550, 0, 551, 0, 552, 0, 553, 0, 2,
+        554, 73, 555, 73, 556, 0, 557, 75, 558, 0, 559, 560, 561, 547, 562, 563,
+        564, 0, 565, 491, 566, 491, 567, 1, 568, 0, 569, 570, 571, 572, 573, 79,
+        574, 79, 575, 79, 576, 577, 578, 0, 579, 580, 581, 0, 582, 0, 583, 0,
+    },
+    {
+        584, 88, 585, 0, 586, 0, 587, 0, 588, 0, 589, 0, 590, 0, 591, 0,
+        592, 0, 593, 0, 594, 0, 595, 0, 596, 0, 597, 598, 599, 147, 600, 0,
+        601, 0, 602, 0, 603, 0, 604, 0, 605, 0, 606, 0, 607, 0, 608, 0,
+        0, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+        624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+        640, 641, 642, 643, 644, 645, 646, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 598, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 78, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 1, 0, 647, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662,
+        663, 664, 665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678,
+        679, 680, 681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 0, 693,
+        0, 694, 695, 0, 696, 697, 0, 698, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 0, 31, 0, 0, 0,
+        0, 0, 710, 710, 711, 710, 712, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 713, 714, 715, 716, 717,
+        718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        734, 0, 0, 0, 0, 735, 736, 737, 738, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        739, 0, 740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 741, 0, 0, 742, 743, 744, 745, 746, 747, 748, 0, 0, 749,
+        750, 751, 752, 753, 754, 0, 0, 755, 756, 0, 757, 758, 759, 760, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+        778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798,
+        799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 801, 802, 803, 804,
+        805, 806, 807, 808, 0, 0, 0, 0, 0, 0, 0, 0, 0, 809, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 810, 811, 812, 813, 0, 814, 815, 816, 817, 818,
+        819, 820, 821, 822, 0, 823, 824, 825, 0, 826, 827, 828, 829, 830, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 831, 832, 833, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 834, 835, 836, 837, 838, 839, 840, 841,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 842, 843, 844, 845, 846, 847,
+        848, 849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863,
+        864, 865, 0, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878,
+        879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894,
+    },
+    {
+        895, 896, 897, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 899, 0, 0, 0, 0, 0, 0,
+        0, 900, 0, 0, 901, 0, 0, 0, 0, 0, 902, 898, 903, 0, 898, 898,
+        898, 904, 905, 906, 907, 908, 909, 910, 911, 898, 898, 898, 898, 912, 898, 898,
+        0, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+        0, 0, 928, 929, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 930, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 931, 0, 898, 898,
+        898, 932, 933, 934, 935, 0, 0, 898, 898, 0, 0, 898, 898, 936, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 898, 0, 0, 0, 0, 937, 938, 0, 939,
+        0, 0, 940, 941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 942, 0,
+    },
+    {
+        0, 943, 944, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 945, 0, 0, 946, 0, 0, 0, 0, 0, 947, 0, 898, 898,
+        898, 948, 949, 0, 0, 0, 0, 950, 951, 0, 0, 952, 953, 954, 0, 0,
+        0, 955, 0, 0, 0, 0, 0, 0, 0, 956, 957, 958, 0, 0, 959, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        960, 961, 0, 0, 0, 962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 963, 964, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 965, 0, 898, 898,
+        898, 966, 967, 968, 969, 970, 0, 971, 972, 898, 0, 898, 898, 973, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 974, 975, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 976, 977, 978, 979, 980, 981,
+    },
+    {
+        0, 982, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 983, 0, 898, 984,
+        898, 985, 986, 987, 988, 0, 0, 898, 898, 0, 0, 898, 898, 989, 0, 0,
+        0, 0, 0, 0, 0, 990, 991, 898, 0, 0, 0, 0, 992, 993, 0, 0,
+        0, 0, 994, 995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 996, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 898,
+        998, 898, 898, 0, 0, 0, 898, 898, 898, 0, 898, 898, 898, 999, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 898, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1000, 898, 898, 898, 1001, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1002, 0, 1003, 1004,
+        1005, 898, 898, 898, 898, 0, 1006, 1007, 1008, 0, 1009, 1010, 1011, 1012, 0, 0,
+        0, 0, 0, 0, 0, 1013, 1014, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1015, 1016, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1017, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1018, 0, 898, 1019,
+        898, 898, 898, 898, 898, 0, 1020, 898, 898, 0, 898, 898, 1021, 1022, 0, 0,
+        0, 0, 0, 0, 0, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1023, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1025, 1026, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1027, 1028, 0, 898, 898,
+        898, 1029, 1030, 1031, 1032, 0, 898, 898, 898, 0, 898, 898, 898, 1033, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 898, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1034, 1035, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 1036, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1037, 0, 0, 0, 0, 898,
+        898, 898, 1038, 1039, 1040, 0, 1041, 0, 898, 898, 898, 898, 898, 898, 898, 898,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1042, 0, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1059, 0, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1070, 1071, 1072, 1073, 1074, 1075, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1076, 1077, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1079, 1080, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1081, 0, 1082, 0, 1083, 0, 0, 0, 0, 898, 898,
+        0, 0, 0, 1084, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1085, 0, 0,
+        0, 0, 1086, 0, 0, 0, 0, 1087, 0, 0, 0, 0, 1088, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1089, 0, 0, 0, 0, 0, 0,
+        0, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 898,
+    },
+    {
+        1104, 1105, 1106, 1107, 1108, 0, 1109, 1110, 0, 0, 0, 0, 0, 1111, 1112, 1113,
+        1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 0, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
+        1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+        1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1158, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1159, 0, 0, 0, 0, 898, 898, 1160, 1161, 1162,
+        1163, 898, 1164, 1165, 1166, 1167, 1168, 1169, 898, 1170, 1171, 898, 898, 1172, 1173, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 898, 898, 1174, 1175, 0, 0, 0, 0, 1176, 1177,
+        1178, 0, 898, 898, 898, 0, 0, 898, 898, 898, 898, 898, 898, 898, 0, 0,
+        0, 1179, 1180, 1181, 1182, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 1183, 898, 898, 1184, 1185, 898, 898, 898, 898, 898, 898, 1186, 0, 898,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 898, 898, 1187, 0, 0,
+        1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+        1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+        1220, 1221, 1222, 1223, 1224, 1225, 0, 1226, 0, 0, 0, 0, 0, 1227, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31,
+        31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1229, 1230, 1231,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1232, 1233, 1234, 1235, 1236, 1237, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1238, 1239, 1240, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1241, 1242, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1243, 1244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1245, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 31, 31, 898, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 898, 898,
+        898, 898, 898, 898, 898, 898, 1254, 898, 898, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
+        1262, 1263, 1264, 1265, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1266, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 31, 31, 31, 31,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 1267, 1268, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1269, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1270, 1271, 1272, 898, 898, 898, 898, 1273, 1274, 898, 898, 898, 0, 0, 0, 0,
+        898, 898, 1275, 898, 898, 898, 898, 898, 898, 1276, 1277, 1278, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1279, 1280, 898, 898, 1281, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 898, 1282, 898, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 0,
+        1290, 898, 1291, 898, 898, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 898, 898, 898,
+        898, 898, 898, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 0, 0, 1310,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+        1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1342, 1343, 1344, 1345, 898, 0, 1346, 0, 1347, 0, 1348, 0, 1349, 0, 1350, 0,
+        0, 0, 1351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1352, 898, 1353, 1354, 1355, 1356, 1357, 898, 1358, 898, 898, 898,
+        898, 898, 1359, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1360, 1361, 1362, 1363, 1364,
+        1365, 1366, 1367, 1368, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1369, 1370, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 898, 1371, 1372, 1373, 1374, 898, 898, 1375, 1376, 898, 1377, 1378, 1379, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1380, 898, 1381, 1382, 898, 898, 898, 1383, 898, 1384,
+        1385, 1386, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 898, 898, 898, 898, 898, 898, 898, 898, 1387, 1388, 1389, 1390,
+        1391, 1392, 1393, 1394, 898, 898, 1395, 1396, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        461, 463, 473, 476, 477, 477, 485, 494, 1397, 0, 0, 0, 0, 0, 0, 0,
+        1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1228, 1410, 1411, 1412,
+        1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428,
+        1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 0, 0, 1440, 1441, 1442,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1443, 1444, 1445, 0, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
+        1458, 898, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 0, 0, 0, 0, 1466, 0, 0,
+        0, 0, 0, 0, 1467, 0, 0, 898, 1468, 1469, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        73, 0, 0, 0, 74, 88, 0, 75, 0, 0, 110, 112, 0, 492, 0, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 423, 0, 0, 137, 78, 0, 0, 0,
+        422, 147, 151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 48, 4, 0,
+        6, 7, 162, 9, 10, 11, 12, 13, 14, 15, 16, 0, 17, 238, 18, 20,
+        22, 23, 25, 3, 1470, 1471, 1472, 4, 6, 7, 163, 164, 1473, 9, 0, 13,
+        15, 122, 17, 157, 1474, 1475, 18, 22, 23, 1476, 171, 24, 1477, 397, 398, 399,
+        415, 416, 11, 20, 23, 24, 397, 398, 411, 415, 416, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 472, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1478, 5, 1479, 58, 1473,
+        8, 1480, 1481, 1482, 169, 168, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 172, 1491,
+        1492, 173, 1493, 1494, 179, 1495, 253, 183, 1496, 184, 254, 28, 1497, 1498, 187, 403,
+        1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+        1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530,
+        1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546,
+        1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+    },
+    {
+        1563, 73, 1564, 260, 1565, 260, 1566, 260, 1567, 74, 1568, 88, 1569, 88, 1570, 88,
+        1571, 88, 1572, 88, 1573, 75, 1574, 75, 1575, 75, 1576, 75, 1577, 75, 1578, 1579,
+        1580, 96, 1581, 101, 1582, 101, 1583, 101, 1584, 101, 1585, 101, 1586, 76, 1587, 76,
+        1588, 112, 1589, 112, 1590, 112, 1591, 2, 1592, 2, 1593, 2, 1594, 2, 1595, 492,
+        1596, 492, 1597, 492, 1598, 77, 1599, 77, 1600, 77, 1601, 77, 1602, 1, 1603, 1,
+        1604, 1, 1605, 1, 1606, 423, 1607, 423, 1608, 128, 1609, 128, 1610, 128, 1611, 128,
+        1612, 132, 1613, 132, 1614, 132, 1615, 132, 1616, 132, 1617, 137, 1618, 137, 1619, 137,
+        1620, 137, 1621, 78, 1622, 78, 1623, 78, 1624, 78, 1625, 78, 1626, 422, 1627, 422,
+    },
+    {
+        1628, 147, 1629, 147, 1630, 147, 1631, 147, 1632, 147, 1633, 424, 1634, 424, 1635, 79,
+        1636, 151, 1637, 151, 1638, 151, 101, 137, 147, 79, 1639, 1612, 0, 0, 72, 0,
+        1640, 73, 1641, 73, 1642, 73, 1643, 73, 1644, 73, 1645, 73, 1646, 73, 1647, 73,
+        1648, 73, 1649, 73, 1650, 73, 1651, 73, 1652, 75, 1653, 75, 1654, 75, 1655, 75,
+        1656, 75, 1657, 75, 1658, 75, 1659, 75, 1660, 76, 1661, 76, 1662, 1, 1663, 1,
+        1664, 1, 1665, 1, 1666, 1, 1667, 1, 1668, 1, 1669, 1, 1670, 1, 1671, 1,
+        1672, 1, 1673, 1, 1674, 78, 1675, 78, 1676, 78, 1677, 78, 1678, 78, 1679, 78,
+        1680, 78, 1681, 79, 1682, 79, 1683, 79, 1684, 79, 1685, 0, 1686, 0, 1687, 0,
+    },
+    {
+        73, 73, 73, 73, 73, 73, 73, 73, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+        75, 75, 75, 75, 75, 75, 0, 0, 1696, 1697, 1698, 1699, 1700, 1701, 0, 0,
+        421, 421, 421, 421, 421, 421, 421, 421, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709,
+        76, 76, 76, 76, 76, 76, 76, 76, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
+        1, 1, 1, 1, 1, 1, 0, 0, 1718, 1719, 1720, 1721, 1722, 1723, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 1724, 0, 1725, 0, 1726, 0, 1727,
+        147, 147, 147, 147, 147, 147, 147, 147, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735,
+        73, 388, 75, 390, 421, 391, 76, 392, 1, 393, 78, 394, 147, 395, 0, 0,
+    },
+    {
+        1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+        1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751,
+        1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759,
+        73, 73, 1760, 1761, 1762, 0, 73, 1763, 1764, 1765, 1766, 388, 1761, 1767, 404, 1767,
+        1768, 1769, 1770, 1771, 1772, 0, 421, 1773, 1774, 390, 1775, 391, 1771, 1776, 1777, 1778,
+        76, 76, 76, 1779, 0, 0, 76, 76, 1780, 1781, 1782, 392, 0, 1783, 1784, 1785,
+        78, 78, 78, 1786, 423, 423, 78, 78, 1787, 1788, 1789, 394, 1790, 1791, 387, 1792,
+        0, 0, 1793, 1794, 1795, 0, 147, 1796, 1797, 393, 1798, 395, 1794, 35, 1799, 0,
+    },
+    {
+        29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 31, 31, 31, 31, 31,
+        0, 1800, 0, 0, 0, 0, 0, 1801, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1802, 1803, 1804, 0, 0, 0, 31, 31, 31, 31, 31, 29,
+        0, 0, 0, 1805, 1806, 0, 1807, 1808, 0, 0, 0, 0, 1809, 0, 1810, 0,
+        0, 0, 0, 0, 0, 0, 0, 1811, 1812, 1813, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1814, 0, 0, 0, 0, 0, 0, 0, 29,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        1815, 11, 0, 0, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 16,
+    },
+    {
+        1815, 38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 0,
+        3, 7, 17, 26, 163, 10, 13, 14, 15, 16, 18, 21, 22, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1827, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+        1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859,
+        1860, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1861, 1862, 5, 1863, 0, 1864, 1865, 164, 0, 1866, 9, 10, 10, 10, 10, 102,
+        11, 11, 14, 14, 0, 16, 1867, 0, 0, 18, 19, 20, 20, 20, 0, 0,
+        1868, 1869, 1870, 0, 28, 0, 418, 0, 28, 0, 13, 47, 4, 5, 0, 7,
+        7, 8, 1871, 15, 17, 1872, 1873, 1874, 1875, 11, 0, 1876, 410, 398, 398, 410,
+        1877, 0, 0, 0, 0, 6, 6, 7, 11, 12, 0, 0, 0, 0, 0, 0,
+        1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+        11, 1894, 1895, 1896, 24, 1897, 1898, 1899, 1900, 26, 1901, 1902, 14, 5, 6, 15,
+        11, 1894, 1895, 1896, 24, 1897, 1898, 1899, 1900, 26, 1901, 1902, 14, 5, 6, 15,
+    },
+    {
+        0, 0, 0, 1903, 0, 0, 0, 0, 0, 1904, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1905, 1906, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1907, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1908, 1909, 1910,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 1911, 0, 0, 0, 0, 1912, 0, 0, 1913, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1914, 0, 1915, 0, 0, 0, 0, 0, 1916, 1917, 0, 1918,
+        1919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1920, 0, 0, 1921, 0, 0, 1922, 0, 1923, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1924, 0, 1925, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1926, 1927, 1928,
+        1929, 1930, 0, 0, 1931, 1932, 0, 0, 1933, 1934, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        1935, 1936, 0, 0, 1937, 1938, 0, 0, 1939, 1940, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1941, 1942, 1943, 1944,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1945, 1946, 1947, 1948, 0, 0, 0, 0, 0, 0, 1949, 1950, 1951, 1952, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1953, 1954, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 1955, 1956, 1957, 1958, 1959, 1960, 1961,
+        1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    },
+    {
+        1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+        1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
+        2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+        2026, 2027, 2028, 2029, 2030, 2031, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 1815, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2032, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2033, 2034, 2035, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2036, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052,
+        2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068,
+        2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2085, 0, 2086, 2087, 2088, 0, 0, 2089, 0, 2090, 0, 2091, 0, 1471, 1489, 1470,
+        1478, 0, 2092, 0, 0, 2093, 0, 0, 0, 0, 0, 0, 12, 24, 2094, 2095,
+    },
+    {
+        2096, 0, 2097, 0, 2098, 0, 2099, 0, 2100, 0, 2101, 0, 2102, 0, 2103, 0,
+        2104, 0, 2105, 0, 2106, 0, 2107, 0, 2108, 0, 2109, 0, 2110, 0, 2111, 0,
+        2112, 0, 2113, 0, 2114, 0, 2115, 0, 2116, 0, 2117, 0, 2118, 0, 2119, 0,
+        2120, 0, 2121, 0, 2122, 0, 2123, 0, 2124, 0, 2125, 0, 2126, 0, 2127, 0,
+        2128, 0, 2129, 0, 2130, 0, 2131, 0, 2132, 0, 2133, 0, 2134, 0, 2135, 0,
+        2136, 0, 2137, 0, 2138, 0, 2139, 0, 2140, 0, 2141, 0, 2142, 0, 2143, 0,
+        2144, 0, 2145, 0, 0, 0, 0, 0, 0, 0, 0, 2146, 0, 2147, 0, 2148,
+        2149, 2150, 2151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2152,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2153,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169,
+        2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2186,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203,
+        2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219,
+        2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235,
+        2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251,
+        2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267,
+        2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283,
+        2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+        2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315,
+    },
+    {
+        2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331,
+        2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347,
+        2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363,
+        2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379,
+        2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+        2396, 2397, 2398, 2399, 2400, 2401, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2402, 2403, 2404, 2405, 898, 898,
+        0, 0, 0, 0, 0, 0, 2406, 0, 2211, 2407, 2408, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2409, 0, 2410, 0,
+        2411, 0, 2412, 0, 2413, 0, 2414, 0, 2415, 0, 2416, 0, 2417, 0, 2418, 0,
+        2419, 0, 2420, 0, 0, 2421, 0, 2422, 0, 2423, 0, 0, 0, 0, 0, 0,
+        2424, 2424, 0, 2425, 2425, 0, 2426, 2426, 0, 2427, 2427, 0, 2428, 2428, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2429, 0, 0, 0, 0, 2430, 2431, 2432, 2433, 0, 2434, 2435,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2436, 0, 2437, 0,
+        2438, 0, 2439, 0, 2440, 0, 2441, 0, 2442, 0, 2443, 0, 2444, 0, 2445, 0,
+        2446, 0, 2447, 0, 0, 2448, 0, 2449, 0, 2450, 0, 0, 0, 0, 0, 0,
+        2451, 2451, 0, 2452, 2452, 0, 2453, 2453, 0, 2454, 2454, 0, 2455, 2455, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2456, 0, 0, 2457, 2458, 2459, 2460, 0, 0, 0, 2461, 2462,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477,
+        2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493,
+        2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509,
+        2510, 2511, 2512, 2513, 31, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524,
+        2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540,
+    },
+    {
+        2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 0,
+        0, 0, 2188, 2194, 2556, 2557, 2558, 2559, 2560, 2561, 2192, 2562, 2563, 2564, 2565, 2196,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+        2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 0,
+        2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612,
+        2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628,
+        2629, 2630, 2631, 2632, 2633, 2634, 2254, 2635, 0, 0, 0, 0, 0, 0, 0, 0,
+        2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651,
+        2463, 2466, 2469, 2471, 2479, 2480, 2483, 2485, 2486, 2488, 2489, 2490, 2491, 2492, 2652, 2653,
+        2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 0,
+    },
+    {
+        2188, 2194, 2556, 2557, 2669, 2670, 2671, 2199, 2672, 2211, 2261, 2273, 2272, 2262, 2354, 2219,
+        2259, 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2225, 2683, 2684, 2685, 2686,
+        2687, 2688, 2689, 2690, 2558, 2559, 2560, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699,
+        2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715,
+        2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731,
+        2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747,
+        2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763,
+        2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779,
+    },
+    {
+        2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795,
+        2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811,
+        2812, 2813, 2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827,
+        2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843,
+        2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859,
+        2860, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875,
+        2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891,
+        2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907,
+    },
+    {
+        2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923,
+        2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939,
+        2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2908, 2949, 2950, 2951, 2952, 2953, 2954,
+        2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2962, 2964, 2965, 2966, 2967, 2968, 2967,
+        2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2938, 2983,
+        2984, 2985, 2986, 2987, 2914, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998,
+        2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
+        3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3031, 0, 3032, 0, 3033, 0, 3034, 0, 3035, 0, 1397, 0, 3036, 0, 3037, 0,
+        3038, 0, 3039, 0, 3040, 0, 3041, 0, 3042, 0, 3043, 0, 3044, 0, 3045, 0,
+        3046, 0, 3047, 0, 3048, 0, 3049, 0, 3050, 0, 3051, 0, 3052, 0, 0, 3053,
+        3054, 3055, 3056, 0, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 0, 0,
+    },
+    {
+        3067, 0, 3068, 0, 3069, 0, 3070, 0, 3071, 0, 3072, 0, 3073, 0, 3074, 0,
+        3075, 0, 3076, 0, 3077, 0, 3078, 0, 3079, 0, 3080, 0, 485, 487, 3081, 3082,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3083, 3084, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 3085, 0, 3086, 0, 3087, 0, 3088, 0, 3089, 0, 3090, 0, 3091, 0,
+        0, 0, 3092, 0, 3093, 0, 3094, 0, 3095, 0, 3096, 0, 3097, 0, 3098, 0,
+        3099, 0, 3100, 0, 3101, 0, 3102, 0, 3103, 0, 3104, 0, 3105, 0, 3106, 0,
+        3107, 0, 3108, 0, 3109, 0, 3110, 0, 3111, 0, 3112, 0, 3113, 0, 3114, 0,
+        3115, 0, 3116, 0, 3117, 0, 3118, 0, 3119, 0, 3120, 0, 3121, 0, 3122, 0,
+        3122, 0, 0, 0, 0, 0, 0, 0, 0, 3123, 0, 3124, 0, 3125, 3126, 0,
+    },
+    {
+        3127, 0, 3128, 0, 3129, 0, 3130, 0, 0, 0, 0, 3131, 0, 1482, 0, 0,
+        3132, 0, 3133, 0, 0, 0, 3134, 0, 3135, 0, 3136, 0, 3137, 0, 3138, 0,
+        3139, 0, 3140, 0, 3141, 0, 3142, 0, 3143, 0, 261, 1473, 1481, 3144, 1483, 0,
+        3145, 3146, 1485, 3147, 3148, 0, 3149, 0, 3150, 0, 3151, 0, 3152, 0, 3153, 0,
+        3154, 0, 3155, 0, 3156, 1494, 3157, 3158, 0, 3159, 0, 0, 0, 0, 0, 0,
+        3160, 0, 0, 0, 0, 0, 3161, 0, 3162, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 5, 8, 19, 3163, 0, 0, 102, 126, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 3164, 0, 0, 0, 3165, 0, 0, 0, 0, 3166, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 898, 898, 3167, 3168, 898, 0, 0, 0, 0, 3169, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+        898, 898, 898, 898, 3170, 3171, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187,
+        3188, 3189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3190,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207,
+        3208, 3209, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3210, 3211, 3212, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3213, 898, 898, 3214, 3215, 3216, 3217, 898, 898, 3218, 3219, 898, 898,
+        898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 3220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 3221, 3222, 3223, 3224, 3225, 3226, 898,
+        898, 3227, 3228, 898, 898, 3229, 3230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3231, 0, 0, 0, 0, 0, 0, 0, 0, 3232, 898, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 3233, 898, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3234, 0, 3235, 3236, 3237, 0, 0, 3238, 3239, 0, 0, 0, 0, 0, 3240, 3241,
+        0, 3242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 3243, 3244, 898, 898,
+        0, 0, 0, 0, 0, 898, 3245, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3087, 3246, 2086, 3247,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 3248, 0, 0, 0, 0, 0, 0,
+        3249, 3250, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+    },
+    {
+        3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280,
+        3281, 3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
+        3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312,
+        3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324, 3325, 3326, 3327, 3328,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 898, 898, 3329, 898, 898, 3330, 898, 898, 0, 898, 3331, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3332, 3333, 2346, 3334, 3335, 3336, 3337, 2400, 2400, 3338, 2354, 3339, 3340, 3341, 3342, 3343,
+        3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359,
+        3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 3375,
+        3376, 3377, 3378, 3379, 2312, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390,
+        2385, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405,
+        3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413, 3414, 3415, 3416, 3417, 3348, 3418, 3419, 3420,
+        3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436,
+        3437, 2348, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451,
+    },
+    {
+        3452, 2225, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 2206, 3461, 3462, 3463, 3464, 3465,
+        3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481,
+        3482, 3436, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3420, 3491, 3492, 3493, 3494, 3495,
+        3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3348,
+        3511, 3512, 3513, 3514, 2399, 3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 3523, 3524, 3525,
+        3526, 2670, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3422, 3536, 3537, 3538, 3539,
+        3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 2353, 3549, 3550, 3551, 3552, 3553, 3554,
+        3555, 3556, 3557, 3558, 3559, 3560, 3561, 2304, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569,
+    },
+    {
+        3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 2331, 3578, 2334, 3579, 3580, 3581, 0, 0,
+        3582, 0, 3583, 0, 0, 3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 2311, 0,
+        3593, 0, 3594, 0, 0, 3595, 3596, 0, 0, 0, 3597, 3598, 3599, 3600, 3601, 3602,
+        3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 2232, 3615, 3616, 3617,
+        3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 2675, 3630, 3631, 3632,
+        3633, 2679, 3634, 3635, 3636, 3637, 3638, 3472, 3639, 3640, 3641, 3642, 3643, 3644, 3644, 3645,
+        3646, 3647, 3648, 3649, 3650, 3651, 3652, 3595, 3653, 3654, 3655, 3656, 3657, 3658, 0, 0,
+        3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3609, 3667, 3668, 3669, 3582, 3670, 3671, 3672,
+    },
+    {
+        3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3617, 3682, 3618, 3683, 3684, 3685, 3686,
+        3687, 3583, 3369, 3688, 3689, 2265, 3437, 3520, 3690, 3691, 3625, 3692, 3626, 3693, 3694, 3695,
+        3585, 3696, 3697, 3698, 3699, 3700, 3586, 3701, 3702, 3703, 3704, 3705, 3706, 3638, 3707, 3708,
+        3472, 3709, 3642, 3710, 3711, 3712, 3713, 3714, 3647, 3715, 3594, 3716, 3648, 3418, 3717, 3649,
+        3718, 3651, 3719, 3720, 3721, 3722, 3723, 3653, 3591, 3724, 3654, 3725, 3655, 3726, 2400, 3727,
+        3728, 3729, 3730, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3738, 3739, 3740, 3741, 3742, 3743, 3743, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3744, 3745, 3746, 3747, 3748, 0, 0, 0, 0, 0, 3749, 3750, 3751,
+        3752, 1872, 1875, 3753, 3754, 3755, 3756, 3757, 3758, 1822, 3759, 3760, 3761, 3762, 3763, 3764,
+        3765, 3766, 3767, 3768, 3769, 3770, 3771, 0, 3772, 3773, 3774, 3775, 3776, 0, 3777, 0,
+        3778, 3779, 0, 3780, 3781, 0, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791,
+        3792, 3792, 3793, 3793, 3793, 3793, 3794, 3794, 3794, 3794, 3795, 3795, 3795, 3795, 3796, 3796,
+        3796, 3796, 3797, 3797, 3797, 3797, 3798, 3798, 3798, 3798, 3799, 3799, 3799, 3799, 3800, 3800,
+        3800, 3800, 3801, 3801, 3801, 3801, 3802, 3802, 3802, 3802, 3803, 3803, 3803, 3803, 3804, 3804,
+    },
+    {
+        3804, 3804, 3805, 3805, 3806, 3806, 3807, 3807, 3808, 3808, 3809, 3809, 3810, 3810, 3811, 3811,
+        3811, 3811, 3812, 3812, 3812, 3812, 3813, 3813, 3813, 3813, 3814, 3814, 3814, 3814, 3815, 3815,
+        3816, 3816, 3816, 3816, 3817, 3817, 3818, 3818, 3818, 3818, 3819, 3819, 3819, 3819, 3820, 3820,
+        3821, 3821, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3822, 3822, 3822, 3822, 3823, 3823, 3824, 3824, 3825, 3825, 737, 3826, 3826,
+        3827, 3827, 3828, 3828, 3829, 3829, 3829, 3829, 3830, 3830, 3831, 3831, 3832, 3832, 3833, 3833,
+        3834, 3834, 3835, 3835, 3836, 3836, 3837, 3837, 3837, 3838, 3838, 3838, 3839, 3839, 3839, 3839,
+    },
+    {
+        3840, 3841, 3842, 3838, 3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854,
+        3855, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870,
+        3871, 3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886,
+        3887, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902,
+        3903, 3904, 3905, 3906, 3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918,
+        3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934,
+        3935, 3936, 3937, 3938, 3939, 3940, 3842, 3941, 3838, 3843, 3942, 3943, 3847, 3944, 3848, 3849,
+        3945, 3946, 3853, 3947, 3854, 3855, 3948, 3949, 3857, 3950, 3858, 3859, 3888, 3889, 3892, 3893,
+    },
+    {
+        3894, 3898, 3899, 3900, 3901, 3905, 3906, 3907, 3951, 3911, 3952, 3953, 3917, 3954, 3918, 3919,
+        3932, 3955, 3956, 3927, 3957, 3928, 3929, 3840, 3841, 3958, 3842, 3959, 3844, 3845, 3846, 3847,
+        3960, 3850, 3851, 3852, 3853, 3961, 3857, 3860, 3861, 3862, 3863, 3864, 3866, 3867, 3868, 3869,
+        3870, 3871, 3962, 3872, 3873, 3874, 3875, 3876, 3877, 3879, 3880, 3881, 3882, 3883, 3884, 3885,
+        3886, 3887, 3890, 3891, 3895, 3896, 3897, 3898, 3899, 3902, 3903, 3904, 3905, 3963, 3908, 3909,
+        3910, 3911, 3914, 3915, 3916, 3917, 3964, 3920, 3921, 3965, 3924, 3925, 3926, 3927, 3966, 3842,
+        3959, 3847, 3960, 3853, 3961, 3857, 3967, 3870, 3968, 3969, 3970, 3898, 3899, 3905, 3917, 3964,
+        3927, 3966, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984,
+    },
+    {
+        3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3969, 3997, 3998, 3999,
+        4000, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988,
+        3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3969, 3997, 3998, 3999, 4000, 3994, 3995, 3996,
+        3969, 3968, 3970, 3878, 3867, 3868, 3869, 3994, 3995, 3996, 3878, 3879, 4001, 4001, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4002, 4003, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 4009, 4010, 4011, 4012, 4013, 4014, 4015,
+        4015, 4016, 4017, 4017, 4018, 4018, 4019, 4020, 4020, 4021, 4022, 4022, 4023, 4023, 4024, 4025,
+        4025, 4026, 4026, 4027, 4028, 4029, 4030, 4030, 4031, 4032, 4033, 4034, 4035, 4035, 4036, 4037,
+    },
+    {
+        4038, 4039, 4040, 4041, 4041, 4042, 4042, 4043, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050,
+        0, 0, 4051, 4052, 4053, 4054, 4055, 4056, 4056, 4057, 4058, 4059, 4060, 4060, 4061, 4062,
+        4063, 4064, 4065, 4066, 4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078,
+        4079, 4080, 4081, 4082, 4036, 4038, 4083, 4084, 4085, 4086, 4087, 4088, 4087, 4085, 4089, 4090,
+        4091, 4092, 4093, 4088, 4029, 4019, 4094, 4095, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 0, 0, 0,
+    },
+    {
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        4109, 4110, 4111, 4112, 385, 4113, 4114, 4115, 4116, 1804, 0, 0, 0, 0, 0, 0,
+        4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132,
+        1803, 4133, 4134, 4135, 4135, 1825, 1826, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 1953,
+        1954, 4144, 4145, 4146, 4147, 0, 0, 4148, 4149, 1810, 1810, 1810, 1810, 4135, 4135, 4135,
+        4109, 4110, 1802, 0, 385, 4112, 4114, 4113, 4133, 1825, 1826, 4136, 4137, 4138, 4139, 4150,
+        4151, 4152, 1822, 4153, 4154, 4155, 1824, 0, 4156, 4157, 4158, 4159, 0, 0, 0, 0,
+        4160, 4161, 4162, 0, 4163, 0, 4164, 4165, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173,
+    },
+    {
+        4174, 4175, 4175, 4176, 4176, 4177, 4177, 4178, 4178, 4179, 4179, 4179, 4179, 4180, 4180, 4181,
+        4181, 4181, 4181, 4182, 4182, 4183, 4183, 4183, 4183, 4184, 4184, 4184, 4184, 4185, 4185, 4185,
+        4185, 4186, 4186, 4186, 4186, 4187, 4187, 4187, 4187, 4188, 4188, 4189, 4189, 4190, 4190, 4191,
+        4191, 4192, 4192, 4192, 4192, 4193, 4193, 4193, 4193, 4194, 4194, 4194, 4194, 4195, 4195, 4195,
+        4195, 4196, 4196, 4196, 4196, 4197, 4197, 4197, 4197, 4198, 4198, 4198, 4198, 4199, 4199, 4199,
+        4199, 4200, 4200, 4200, 4200, 4201, 4201, 4201, 4201, 4202, 4202, 4202, 4202, 4203, 4203, 4203,
+        4203, 4204, 4204, 4204, 4204, 4205, 4205, 4205, 4205, 4206, 4206, 4206, 4206, 4207, 4207, 3830,
+        3830, 4208, 4208, 4208, 4208, 4209, 4209, 4210, 4210, 4211, 4211, 4212, 4212, 0, 0, 31,
+    },
+    {
+        0, 4113, 4213, 4150, 4157, 4158, 4151, 4214, 1825, 1826, 4152, 1822, 4109, 4153, 1802, 4215,
+        1815, 38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 4112, 385, 4154, 1824, 4155, 4114,
+        4159, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 4148, 4156, 4149, 4216, 4135,
+        1792, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+        18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 4136, 4217, 4137, 4218, 4219,
+        4220, 4111, 4144, 4145, 4110, 4221, 2778, 4222, 4223, 4224, 4225, 4226, 4227, 4228, 4229, 4230,
+        4231, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
+    },
+    {
+        2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762,
+        2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 4232, 4233, 4234,
+        31, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477,
+        2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 0,
+        0, 0, 2493, 2494, 2495, 2496, 2497, 2498, 0, 0, 2499, 2500, 2501, 2502, 2503, 2504,
+        0, 0, 2505, 2506, 2507, 2508, 2509, 2510, 0, 0, 2511, 2512, 2513, 0, 0, 0,
+        4235, 4236, 4237, 32, 4238, 4239, 4240, 0, 4241, 4242, 4243, 4244, 4245, 4246, 4247, 0,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4248, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4250, 4251, 4252, 4253, 4254, 0, 0, 0, 0, 0,
+    },
+    {
+        4255, 4256, 4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270,
+        4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285, 4286,
+        4287, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4295, 4296, 4297, 4298, 4299, 4300, 4301, 4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309, 4310,
+        4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4326,
+        4327, 4328, 4329, 4330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4331, 4332, 4333, 4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 0, 4342, 4343, 4344, 4345,
+    },
+    {
+        4346, 4347, 4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4356, 0, 4357, 4358, 4359, 4360,
+        4361, 4362, 4363, 0, 4364, 4365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 4366, 4367, 48, 4368, 154, 0, 4369, 4370, 4371, 4372, 159, 160, 4373, 4374, 4375,
+        4376, 4377, 4378, 166, 4379, 102, 4380, 4381, 4382, 4383, 4384, 3144, 4385, 4386, 4387, 4388,
+        4389, 4390, 65, 4391, 4392, 19, 4393, 4394, 2088, 4395, 177, 4396, 4397, 4398, 4399, 181,
+        4400, 0, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 4410, 4411, 4412, 0, 4413, 4414, 0, 0, 0, 0, 0, 4415, 4416, 4417, 4418,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4419, 4420, 4421, 0, 0, 0, 0, 4422,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4423, 4424, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4425, 4426, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439, 4440,
+        4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456,
+        4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472,
+        4473, 4474, 4475, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4476, 4477, 4478, 4479, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4480, 4481, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4482, 4483, 4484, 4485, 4486, 4487, 4488, 4489, 4490, 4491,
+        4492, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 4493, 4494, 4495, 4496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        898, 4497, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4498, 4499, 4500, 4501, 4502, 4503, 4504, 4505,
+        4506, 4507, 4508, 4509, 4510, 4511, 4512, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4513, 0, 0, 4514, 4515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4516,
+    },
+    {
+        4517, 4518, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4519, 0, 4520, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4521, 0, 0, 0, 0,
+        898, 898, 898, 4522, 4523, 4524, 4525, 898, 898, 4526, 4527, 0, 0, 0, 0, 0,
+        0, 0, 4528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4529, 4530, 4531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4532, 4533, 4534, 4535, 4536, 898, 4537, 4538, 4539,
+        4540, 4541, 4542, 4543, 4544, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4545, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4546, 4547, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 898, 898, 898, 4548, 4549, 4550, 4551, 4552, 4553, 4554, 4555, 4556, 898,
+        898, 0, 0, 0, 0, 0, 0, 0, 0, 4557, 4558, 4559, 4560, 0, 898, 4561,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 898, 898, 4562,
+        4563, 4564, 898, 898, 4565, 898, 4566, 4567, 0, 0, 0, 0, 0, 0, 4568, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4569,
+        898, 898, 898, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4578, 4579, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4580, 4581, 0, 898, 898,
+        4582, 898, 898, 898, 898, 0, 0, 898, 898, 0, 0, 898, 898, 898, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 898, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 898, 898, 0, 0, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 0, 0, 0,
+        4590, 4591, 4592, 4593, 4594, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 898, 898, 898, 4595, 4596, 4597, 4598, 4599, 4600, 4601, 4602,
+        898, 898, 4603, 4604, 4605, 898, 4606, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4607, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        898, 898, 898, 4608, 4609, 4610, 4611, 4612, 4613, 898, 4614, 898, 898, 898, 898, 4615,
+        4616, 898, 4617, 4618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898,
+        898, 898, 4619, 4620, 4621, 4622, 0, 0, 898, 898, 898, 898, 4623, 4624, 898, 4625,
+        4626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4627, 4628, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        898, 898, 898, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 898, 898, 4637, 898, 4638,
+        4639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4640, 898, 4641, 898, 898,
+        4642, 4643, 4644, 4645, 4646, 4647, 898, 4648, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4649, 4650, 4651,
+        898, 898, 4652, 4653, 4654, 4655, 898, 4656, 4657, 4658, 4659, 4660, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 898, 898, 4661,
+        4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 898, 4670, 4671, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687,
+        4688, 4689, 4690, 4691, 4692, 4693, 4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        898, 898, 898, 898, 898, 898, 0, 898, 898, 0, 0, 4704, 4705, 898, 4706, 0,
+        898, 0, 898, 4707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 898, 898, 898, 4708, 4709, 4710, 4711, 0, 0, 4712, 4713, 898, 898, 898, 898,
+        4714, 0, 0, 0, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4725, 4726, 4727, 4728, 4729, 4730, 898, 0, 4731, 4732, 4733, 4734, 0,
+        0, 0, 0, 0, 0, 0, 0, 4735, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4736, 4737, 4738, 4739, 4740, 4741, 898, 898, 4742, 4743, 4744, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4745, 4746, 4747, 4748, 4749, 4750,
+        4751, 4752, 4753, 4754, 4755, 4756, 4757, 898, 4758, 4759, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898,
+        4760, 4761, 4762, 4763, 4764, 4765, 4766, 0, 4767, 4768, 4769, 4770, 4771, 4772, 898, 4773,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4774, 4775, 4776, 4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787,
+        4788, 4789, 4790, 4791, 4792, 4793, 4794, 4795, 0, 898, 4796, 4797, 4798, 4799, 4800, 4801,
+        4802, 898, 4803, 4804, 898, 4805, 4806, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4807, 4808, 4809, 4810, 4811, 4812, 0, 0, 0, 4813, 0, 4814, 4815, 0, 4816,
+        4817, 4818, 4819, 4820, 4821, 4822, 0, 4823, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 898, 898, 898, 898, 898, 0,
+        4824, 4825, 0, 898, 898, 4826, 898, 4827, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4828, 4829, 898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4830, 4831, 4832, 4833, 4834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4835, 4836, 4837, 4838, 4839, 4840, 4841, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857,
+        4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4874,
+        0, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+        898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+        898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+    },
+    {
+        898, 898, 898, 898, 898, 898, 898, 898, 0, 0, 0, 0, 0, 0, 0, 4875,
+        4876, 4877, 4878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4879, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        898, 898, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4880, 4881, 0,
+        31, 31, 31, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4882, 4883, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897,
+        4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913,
+        4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 0, 0,
+        4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943,
+        4944, 4945, 4946, 4947, 4948, 4949, 4950, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4951, 4952,
+        4953, 4954, 4955, 4956, 4957, 898, 898, 4958, 4959, 4960, 0, 0, 0, 898, 898, 898,
+        898, 898, 898, 31, 31, 31, 31, 31, 31, 31, 31, 4961, 4962, 4963, 4964, 4965,
+    },
+    {
+        4966, 4967, 4968, 0, 0, 4969, 4970, 4971, 4972, 4973, 4974, 4975, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4976, 4977, 4978, 4979, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4980, 4981, 4982, 4983, 4984,
+        4985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4986, 4987, 4988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4,
+        5, 6, 7, 8, 9, 0, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    },
+    {
+        27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 0, 5, 6,
+        0, 0, 9, 0, 0, 12, 13, 0, 0, 16, 17, 18, 19, 0, 21, 22,
+        23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 0, 8, 0, 10, 11, 12,
+        13, 14, 15, 16, 0, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    },
+    {
+        25, 26, 27, 28, 3, 4, 0, 6, 7, 8, 9, 0, 0, 12, 13, 14,
+        15, 16, 17, 18, 19, 0, 21, 22, 23, 24, 25, 26, 27, 0, 3, 4,
+        5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 0, 6, 7, 8, 9, 0,
+        11, 12, 13, 14, 15, 0, 17, 0, 0, 0, 21, 22, 23, 24, 25, 26,
+        27, 0, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    },
+    {
+        23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4,
+        5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    },
+    {
+        21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10,
+        11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+        27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+        23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+        13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    },
+    {
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 3, 4, 5, 6, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 4989, 4990, 0, 0, 396, 397, 398, 399, 400, 401, 402, 403,
+        404, 405, 406, 36, 407, 408, 409, 410, 411, 403, 412, 413, 414, 415, 416, 417,
+        418, 4991, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 36, 407, 408,
+        409, 410, 411, 412, 412, 413, 414, 415, 416, 417, 418, 4992, 400, 403, 405, 415,
+        411, 410, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 36, 407, 408,
+        409, 410, 411, 403, 412, 413, 414, 415, 416, 417, 418, 4991, 396, 397, 398, 399,
+    },
+    {
+        400, 401, 402, 403, 404, 405, 406, 36, 407, 408, 409, 410, 411, 412, 412, 413,
+        414, 415, 416, 417, 418, 4992, 400, 403, 405, 415, 411, 410, 396, 397, 398, 399,
+        400, 401, 402, 403, 404, 405, 406, 36, 407, 408, 409, 410, 411, 403, 412, 413,
+        414, 415, 416, 417, 418, 4991, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+        406, 36, 407, 408, 409, 410, 411, 412, 412, 413, 414, 415, 416, 417, 418, 4992,
+        400, 403, 405, 415, 411, 410, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405,
+        406, 36, 407, 408, 409, 410, 411, 403, 412, 413, 414, 415, 416, 417, 418, 4991,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 36, 407, 408, 409, 410,
+    },
+    {
+        411, 412, 412, 413, 414, 415, 416, 417, 418, 4992, 400, 403, 405, 415, 411, 410,
+        396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 36, 407, 408, 409, 410,
+        411, 403, 412, 413, 414, 415, 416, 417, 418, 4991, 396, 397, 398, 399, 400, 401,
+        402, 403, 404, 405, 406, 36, 407, 408, 409, 410, 411, 412, 412, 413, 414, 415,
+        416, 417, 418, 4992, 400, 403, 405, 415, 411, 410, 428, 428, 0, 0, 1815, 38,
+        33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 1815, 38, 33, 34, 1816, 1817, 1818, 1819,
+        1820, 1821, 1815, 38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 1815, 38, 33, 34,
+        1816, 1817, 1818, 1819, 1820, 1821, 1815, 38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821,
+    },
+    {
+        4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008,
+        5009, 5010, 5011, 5012, 5013, 5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 5024,
+        5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040,
+        5041, 5042, 5043, 5044, 5045, 5046, 5047, 0, 0, 0, 0, 5048, 5049, 5050, 5051, 5052,
+        5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068,
+        5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084,
+        5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 0, 0, 0,
+        0, 0, 0, 0, 0, 5098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 5099, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5100, 5101, 5102, 5103, 5104,
+        0, 5105, 5106, 5107, 5108, 5109, 5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5119,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5120, 5121, 5122, 5123, 5124, 5125, 5126, 0, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134,
+        5135, 5136, 5137, 5138, 5139, 5140, 5141, 5142, 5143, 0, 0, 5144, 5145, 5146, 5147, 5148,
+        5149, 5150, 0, 5151, 5152, 0, 5153, 5154, 5155, 5156, 5157, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5158, 5159, 5160, 5161, 5162, 5163, 5164, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5165, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5166, 5167, 5168, 5169,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5170, 5171, 5172, 5173, 5174, 5175, 5176, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5177, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5185, 5186, 5187, 5188, 5189, 5190, 5191, 5192,
+        5193, 5194, 5195, 5196, 5197, 5198, 5199, 5200, 5201, 5202, 5203, 5204, 5205, 5206, 5207, 5208,
+        5209, 5210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 5211, 5212, 5213, 5214, 5215, 5216, 5217, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        4180, 4181, 4185, 4188, 0, 4207, 4191, 4186, 4196, 4208, 4202, 4203, 4204, 4205, 4192, 4198,
+        4200, 4194, 4201, 4190, 4193, 4183, 4184, 4187, 4189, 4195, 4197, 4199, 5218, 3815, 5219, 5220,
+        0, 4181, 4185, 0, 4206, 0, 0, 4186, 0, 4208, 4202, 4203, 4204, 4205, 4192, 4198,
+        4200, 4194, 4201, 0, 4193, 4183, 4184, 4187, 0, 4195, 0, 4199, 0, 0, 0, 0,
+        0, 0, 4185, 0, 0, 0, 0, 4186, 0, 4208, 0, 4203, 0, 4205, 4192, 4198,
+        0, 4194, 4201, 0, 4193, 0, 0, 4187, 0, 4195, 0, 4199, 0, 3815, 0, 5220,
+        0, 4181, 4185, 0, 4206, 0, 0, 4186, 4196, 4208, 4202, 0, 4204, 4205, 4192, 4198,
+        4200, 4194, 4201, 0, 4193, 4183, 4184, 4187, 0, 4195, 4197, 4199, 5218, 0, 5219, 0,
+    },
+    {
+        4180, 4181, 4185, 4188, 4206, 4207, 4191, 4186, 4196, 4208, 0, 4203, 4204, 4205, 4192, 4198,
+        4200, 4194, 4201, 4190, 4193, 4183, 4184, 4187, 4189, 4195, 4197, 4199, 0, 0, 0, 0,
+        0, 4181, 4185, 4188, 0, 4207, 4191, 4186, 4196, 4208, 0, 4203, 4204, 4205, 4192, 4198,
+        4200, 4194, 4201, 4190, 4193, 4183, 4184, 4187, 4189, 4195, 4197, 4199, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 5229, 5230, 5231, 0, 0, 0, 0, 0,
+        2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021,
+        2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 5232, 5, 20, 2974, 5233, 0,
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+        19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 5234, 2962, 5235, 72, 5236, 5237,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5238, 5239, 5240, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5242, 5243, 2742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2251, 5244, 5245, 5246, 2194, 5247, 5248, 2564, 5249, 5250, 5251, 3510, 5252, 5253, 5254, 5255,
+        5256, 5257, 2287, 5258, 5259, 5260, 5261, 5262, 5263, 2188, 2556, 5264, 2691, 2559, 2692, 5265,
+        2343, 5266, 5267, 5268, 5269, 5270, 2674, 2261, 5271, 5272, 5273, 5274, 0, 0, 0, 0,
+        5275, 5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283, 0, 0, 0, 0, 0, 0, 0,
+        5284, 5285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1815, 38, 33, 34, 1816, 1817, 1818, 1819, 1820, 1821, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        5286, 5287, 5288, 5289, 5290, 3603, 5291, 5292, 5293, 5294, 3604, 5295, 5296, 5297, 3605, 5298,
+        5299, 5300, 5301, 5302, 5303, 5254, 5304, 5305, 5306, 5307, 5308, 3660, 5309, 2204, 5310, 5311,
+        5312, 5313, 5272, 5314, 5315, 3665, 3606, 3607, 3666, 5316, 5317, 3424, 5318, 3608, 5319, 5320,
+        5321, 5322, 5322, 5322, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330, 5331, 5332, 5333, 5334,
+        5335, 5336, 5337, 5338, 5339, 5340, 5340, 3668, 5341, 5342, 5343, 5344, 3610, 5345, 5346, 5347,
+        3570, 5348, 5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5247, 5360, 5361,
+        5362, 5363, 5364, 5365, 5366, 5367, 5368, 5369, 5370, 5371, 5372, 5372, 5373, 5374, 5375, 3420,
+        5376, 5377, 5378, 5379, 5380, 2230, 5381, 5382, 2232, 5383, 5384, 5385, 5386, 5387, 5388, 5389,
+    },
+    {
+        5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398, 5399, 5400, 5401, 5402, 5403, 3368, 5404,
+        2242, 5405, 5405, 5406, 5407, 5407, 5408, 5409, 5410, 5411, 5412, 5413, 5414, 5415, 5416, 5417,
+        5418, 5419, 5420, 3615, 5421, 5422, 5423, 5424, 3680, 5424, 5425, 3617, 5426, 5427, 5428, 5429,
+        3618, 3341, 5430, 5431, 5432, 5433, 5434, 5435, 5436, 5437, 5438, 5439, 5440, 5441, 5442, 5443,
+        5444, 5445, 5446, 5447, 5448, 5449, 5450, 5451, 3619, 5452, 5453, 5454, 5455, 5456, 5457, 3621,
+        5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 3369, 3688, 5466, 5467, 5468, 5469, 5470, 5471,
+        5472, 5473, 3622, 5474, 5475, 5476, 5477, 3730, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485,
+        5486, 5487, 5488, 5489, 5490, 3437, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500,
+    },
+    {
+        5501, 3623, 3520, 5502, 5503, 5504, 5505, 5506, 5507, 5508, 5509, 3691, 5510, 5511, 5512, 5513,
+        5514, 5515, 5516, 5517, 3692, 5518, 5519, 5520, 5521, 5522, 5523, 5524, 5525, 5526, 5527, 5528,
+        5529, 3694, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537, 5538, 5539, 5540, 5540, 5541, 5542,
+        3696, 5543, 5544, 5545, 5546, 5547, 5548, 5549, 3423, 5550, 5551, 5552, 5553, 5554, 5555, 5556,
+        3702, 5557, 5558, 5559, 5560, 5561, 5562, 5562, 3703, 3732, 5563, 5564, 5565, 5566, 5567, 3386,
+        3705, 5568, 5569, 3633, 5570, 5571, 3590, 5572, 5573, 3636, 5574, 5575, 5576, 5577, 5577, 5578,
+        5579, 5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590, 5591, 5592, 5593, 5594,
+        5595, 5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603, 5604, 3642, 5605, 5606, 5607, 5608, 5609,
+    },
+    {
+        5610, 5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5406, 5621, 5622, 5623, 5624,
+        5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 3440, 5633, 5634, 5635, 5636, 5637, 5638, 3645,
+        5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5653, 5654,
+        5655, 5656, 5657, 5658, 3381, 5659, 5660, 5661, 5662, 5663, 5664, 3712, 5665, 5666, 5667, 5668,
+        5669, 5670, 5671, 5672, 2332, 5673, 5674, 5675, 5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683,
+        3717, 3718, 2339, 5684, 5685, 5686, 5687, 5688, 5689, 5690, 5691, 5692, 5693, 5694, 5695, 3719,
+        5696, 5697, 5698, 5699, 5700, 5701, 5702, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5710, 5711,
+        5712, 5713, 5714, 5715, 5716, 5717, 5718, 5719, 5720, 5721, 5722, 5723, 5724, 5725, 3725, 3725,
+    },
+    {
+        5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734, 5735, 3726, 5736, 5737, 5738, 5739, 5740,
+        5741, 5742, 5743, 5744, 5745, 2387, 5746, 2391, 5747, 5748, 5749, 5750, 2396, 5751, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+        31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    },
+};
+
+const struct unicode_props unicode_props[] = {
+    { 0, 0, 0, 65535, 65535 },
+    { 0, 0, 1, 65535, 0 },
+    { 0, 0, 1, 65535, 1 },
+    { 0, 1, 1, 2, 2 },
+    { 0, 1, 1, 3, 3 },
+    { 0, 1, 1, 4, 4 },
+    { 0, 1, 1, 5, 5 },
+    { 0, 1, 1, 6, 6 },
+    { 0, 1, 1, 7, 7 },
+    { 0, 1, 1, 8, 8 },
+    { 0, 1, 1, 9, 9 },
+    { 0, 1, 1, 10, 10 },
+    { 0, 1, 1, 11, 11 },
+    { 0, 1, 1, 12, 12 },
+    { 0, 1, 1, 1, 1 },
+    { 0, 1, 1, 13, 13 },
+    { 0, 1, 1, 14, 14 },
+    { 0, 1, 1, 0, 0 },
+    { 0, 1, 1, 15, 15 },
+    { 0, 1, 1, 16, 16 },
+    { 0, 1, 1, 17, 17 },
+    { 0, 1, 1, 18, 18 },
+    { 0, 1, 1, 19, 19 },
+    { 0, 1, 1, 20, 20 },
+    { 0, 1, 1, 21, 21 },
+    { 0, 1, 1, 22, 22 },
+    { 0, 1, 1, 23, 23 },
+    { 0, 1, 1, 24, 24 },
+    { 0, 1, 1, 25, 25 },
+    { 0, 1, 1, 26, 26 },
+    { 0, 3, 1, 27, 26 },
+    { 2, 0, 0, 30, 30 },
+    { 0, 3, 1, 30, 26 },
+    { 0, 1, 1, 33, 33 },
+    { 0, 1, 1, 34, 34 },
+    { 0, 3, 1, 35, 26 },
+    { 0, 2, 2, 38, 38 },
+    { 0, 3, 1, 40, 26 },
+    { 0, 1, 1, 43, 1 },
+    { 0, 5, 5, 44, 49 },
+    { 0, 5, 5, 54, 59 },
+    { 0, 5, 5, 64, 64 },
+    { 0, 2, 1, 69, 2 },
+    { 0, 2, 1, 71, 2 },
+    { 0, 2, 1, 73, 2 },
+    { 0, 2, 1, 75, 2 },
+    { 0, 2, 1, 77, 2 },
+    { 0, 2, 1, 79, 2 },
+    { 0, 2, 2, 81, 81 },
+    { 0, 2, 1, 83, 4 },
+    { 0, 2, 1, 85, 6 },
+    { 0, 2, 1, 87, 6 },
+    { 0, 2, 1, 89, 6 },
+    { 0, 2, 1, 91, 6 },
+    { 0, 2, 1, 93, 10 },
+    { 0, 2, 1, 95, 10 },
+    { 0, 2, 1, 97, 10 },
+    { 0, 2, 1, 99, 10 },
+    { 0, 2, 2, 101, 101 },
+    { 0, 2, 1, 103, 14 },
+    { 0, 2, 1, 105, 0 },
+    { 0, 2, 1, 107, 0 },
+    { 0, 2, 1, 109, 0 },
+    { 0, 2, 1, 111, 0 },
+    { 0, 2, 1, 113, 0 },
+    { 0, 2, 2, 115, 115 },
+    { 0, 2, 1, 117, 20 },
+    { 0, 2, 1, 119, 20 },
+    { 0, 2, 1, 121, 20 },
+    { 0, 2, 1, 123, 20 },
+    { 0, 2, 1, 125, 24 },
+    { 0, 2, 2, 127, 127 },
+    { 0, 2, 2, 129, 129 },
+    { 0, 0, 1, 65535, 2 },
+    { 0, 0, 1, 65535, 4 },
+    { 0, 0, 1, 65535, 6 },
+    { 0, 0, 1, 65535, 10 },
+    { 0, 0, 1, 65535, 14 },
+    { 0, 0, 1, 65535, 20 },
+    { 0, 0, 1, 65535, 24 },
+    { 0, 2, 1, 131, 2 },
+    { 0, 2, 1, 133, 2 },
+    { 0, 2, 1, 135, 2 },
+    { 0, 2, 1, 137, 4 },
+    { 0, 2, 1, 139, 4 },
+    { 0, 2, 1, 141, 4 },
+    { 0, 2, 1, 143, 4 },
+    { 0, 2, 1, 145, 5 },
+    { 0, 0, 1, 65535, 5 },
+    { 0, 2, 2, 147, 147 },
+    { 0, 2, 1, 149, 6 },
+    { 0, 2, 1, 151, 6 },
+    { 0, 2, 1, 153, 6 },
+    { 0, 2, 1, 155, 6 },
+    { 0, 2, 1, 157, 6 },
+    { 0, 2, 1, 159, 8 },
+    { 0, 0, 1, 65535, 8 },
+    { 0, 2, 1, 161, 8 },
+    { 0, 2, 1, 163, 8 },
+    { 0, 2, 1, 165, 8 },
+    { 0, 2, 1, 167, 9 },
+    { 0, 0, 1, 65535, 9 },
+    { 0, 2, 2, 169, 169 },
+    { 0, 2, 1, 171, 10 },
+    { 0, 2, 1, 173, 10 },
+    { 0, 2, 1, 175, 10 },
+    { 0, 2, 1, 177, 10 },
+    { 0, 3, 1, 179, 10 },
+    { 0, 2, 2, 182, 182 },
+    { 0, 2, 1, 184, 11 },
+    { 0, 0, 1, 65535, 11 },
+    { 0, 2, 1, 186, 12 },
+    { 0, 0, 1, 65535, 12 },
+    { 0, 2, 1, 188, 1 },
+    { 0, 2, 1, 190, 1 },
+    { 0, 2, 1, 192, 1 },
+    { 0, 3, 3, 194, 194 },
+    { 0, 2, 2, 197, 197 },
+    { 0, 2, 1, 199, 14 },
+    { 0, 2, 1, 201, 14 },
+    { 0, 2, 1, 203, 14 },
+    { 0, 3, 3, 205, 205 },
+    { 0, 2, 2, 208, 208 },
+    { 0, 2, 1, 210, 0 },
+    { 0, 2, 1, 212, 0 },
+    { 0, 2, 1, 214, 0 },
+    { 0, 2, 2, 216, 216 },
+    { 0, 2, 1, 218, 17 },
+    { 0, 0, 1, 65535, 17 },
+    { 0, 2, 1, 220, 17 },
+    { 0, 2, 1, 222, 17 },
+    { 0, 2, 1, 224, 18 },
+    { 0, 0, 1, 65535, 18 },
+    { 0, 2, 1, 226, 18 },
+    { 0, 2, 1, 228, 18 },
+    { 0, 2, 1, 230, 18 },
+    { 0, 2, 1, 232, 19 },
+    { 0, 0, 1, 65535, 19 },
+    { 0, 2, 1, 234, 19 },
+    { 0, 2, 2, 236, 236 },
+    { 0, 2, 1, 238, 20 },
+    { 0, 2, 1, 240, 20 },
+    { 0, 2, 1, 242, 20 },
+    { 0, 2, 1, 244, 20 },
+    { 0, 2, 1, 246, 20 },
+    { 0, 2, 1, 248, 20 },
+    { 0, 2, 1, 250, 22 },
+    { 0, 0, 1, 65535, 22 },
+    { 0, 2, 1, 252, 24 },
+    { 0, 2, 1, 254, 24 },
+    { 0, 2, 1, 256, 25 },
+    { 0, 0, 1, 65535, 25 },
+    { 0, 2, 1, 258, 25 },
+    { 0, 2, 1, 260, 25 },
+    { 0, 2, 2, 262, 262 },
+    { 0, 2, 2, 264, 264 },
+    { 0, 2, 2, 266, 266 },
+    { 0, 2, 2, 268, 268 },
+    { 0, 2, 2, 270, 270 },
+    { 0, 2, 2, 272, 272 },
+    { 0, 2, 2, 274, 274 },
+    { 0, 2, 2, 276, 276 },
+    { 0, 2, 2, 278, 278 },
+    { 0, 2, 2, 280, 280 },
+    { 0, 2, 2, 282, 282 },
+    { 0, 2, 2, 284, 284 },
+    { 0, 2, 2, 286, 286 },
+    { 0, 2, 2, 288, 288 },
+    { 0, 2, 1, 290, 10 },
+    { 0, 2, 2, 292, 292 },
+    { 0, 2, 2, 294, 294 },
+    { 0, 2, 2, 296, 296 },
+    { 0, 2, 2, 298, 298 },
+    { 0, 2, 2, 300, 300 },
+    { 0, 2, 1, 302, 0 },
+    { 0, 2, 2, 304, 304 },
+    { 0, 2, 2, 306, 306 },
+    { 0, 2, 1, 308, 17 },
+    { 0, 2, 2, 310, 310 },
+    { 0, 2, 2, 312, 312 },
+    { 0, 2, 2, 314, 314 },
+    { 0, 2, 2, 316, 316 },
+    { 0, 2, 1, 318, 20 },
+    { 0, 2, 2, 320, 320 },
+    { 0, 2, 2, 322, 322 },
+    { 0, 2, 2, 324, 324 },
+    { 0, 2, 2, 326, 326 },
+    { 0, 2, 2, 328, 328 },
+    { 0, 2, 2, 330, 330 },
+    { 0, 2, 2, 332, 332 },
+    { 0, 3, 2, 334, 337 },
+    { 0, 2, 2, 339, 339 },
+    { 0, 2, 2, 341, 341 },
+    { 0, 2, 1, 343, 2 },
+    { 0, 2, 1, 345, 10 },
+    { 0, 2, 1, 347, 0 },
+    { 0, 2, 1, 349, 20 },
+    { 0, 2, 1, 351, 20 },
+    { 0, 2, 1, 353, 20 },
+    { 0, 2, 1, 355, 20 },
+    { 0, 2, 1, 357, 20 },
+    { 0, 2, 1, 359, 2 },
+    { 0, 2, 1, 361, 2 },
+    { 0, 2, 2, 363, 81 },
+    { 0, 0, 2, 65535, 81 },
+    { 0, 2, 2, 365, 365 },
+    { 0, 2, 1, 367, 8 },
+    { 0, 2, 1, 369, 12 },
+    { 0, 2, 1, 371, 0 },
+    { 0, 2, 1, 373, 0 },
+    { 0, 2, 2, 375, 328 },
+    { 0, 0, 2, 65535, 328 },
+    { 0, 2, 2, 337, 337 },
+    { 0, 2, 1, 377, 8 },
+    { 0, 2, 2, 379, 379 },
+    { 0, 2, 2, 381, 381 },
+    { 0, 2, 1, 383, 14 },
+    { 0, 2, 1, 385, 2 },
+    { 0, 2, 2, 387, 81 },
+    { 0, 2, 2, 389, 115 },
+    { 0, 0, 2, 65535, 115 },
+    { 0, 2, 1, 391, 2 },
+    { 0, 2, 1, 393, 2 },
+    { 0, 2, 1, 395, 6 },
+    { 0, 2, 1, 397, 6 },
+    { 0, 2, 1, 399, 10 },
+    { 0, 2, 1, 401, 10 },
+    { 0, 2, 1, 403, 0 },
+    { 0, 2, 1, 405, 0 },
+    { 0, 2, 1, 407, 17 },
+    { 0, 2, 1, 409, 17 },
+    { 0, 2, 1, 411, 20 },
+    { 0, 2, 1, 413, 20 },
+    { 0, 2, 1, 415, 18 },
+    { 0, 2, 1, 417, 19 },
+    { 0, 2, 2, 419, 419 },
+    { 0, 2, 1, 421, 9 },
+    { 0, 2, 2, 423, 423 },
+    { 0, 2, 2, 425, 425 },
+    { 0, 2, 2, 427, 427 },
+    { 0, 2, 1, 429, 2 },
+    { 0, 2, 1, 431, 6 },
+    { 0, 2, 1, 433, 0 },
+    { 0, 2, 1, 435, 0 },
+    { 0, 2, 1, 437, 0 },
+    { 0, 2, 1, 439, 0 },
+    { 0, 2, 1, 441, 24 },
+    { 0, 3, 3, 443, 443 },
+    { 0, 2, 2, 446, 446 },
+    { 0, 2, 2, 448, 448 },
+    { 0, 3, 3, 450, 450 },
+    { 0, 2, 2, 453, 453 },
+    { 0, 2, 2, 455, 455 },
+    { 0, 2, 2, 457, 457 },
+    { 0, 2, 2, 459, 459 },
+    { 0, 2, 2, 461, 461 },
+    { 0, 2, 2, 463, 463 },
+    { 0, 2, 2, 465, 465 },
+    { 0, 2, 2, 467, 467 },
+    { 0, 2, 2, 469, 469 },
+    { 0, 0, 1, 65535, 3 },
+    { 0, 2, 2, 471, 471 },
+    { 0, 2, 2, 473, 473 },
+    { 0, 2, 2, 475, 475 },
+    { 0, 2, 2, 477, 477 },
+    { 0, 3, 1, 479, 26 },
+    { 0, 3, 1, 482, 26 },
+    { 0, 3, 1, 485, 26 },
+    { 0, 3, 1, 488, 26 },
+    { 0, 3, 1, 491, 26 },
+    { 0, 3, 1, 494, 26 },
+    { 0, 2, 2, 497, 497 },
+    { 1, 2, 0, 499, 30 },
+    { 1, 2, 0, 501, 30 },
+    { 1, 2, 0, 503, 30 },
+    { 1, 2, 0, 505, 30 },
+    { 1, 2, 0, 507, 30 },
+    { 1, 2, 0, 509, 30 },
+    { 1, 2, 0, 511, 30 },
+    { 1, 2, 0, 513, 30 },
+    { 1, 2, 0, 515, 30 },
+    { 1, 2, 0, 517, 30 },
+    { 1, 2, 0, 519, 30 },
+    { 1, 2, 0, 521, 30 },
+    { 1, 2, 0, 523, 30 },
+    { 1, 2, 0, 525, 30 },
+    { 1, 2, 0, 527, 30 },
+    { 1, 2, 0, 529, 30 },
+    { 1, 2, 0, 531, 30 },
+    { 1, 2, 0, 533, 30 },
+    { 1, 2, 0, 535, 30 },
+    { 1, 2, 0, 537, 30 },
+    { 1, 2, 0, 539, 30 },
+    { 1, 2, 0, 541, 30 },
+    { 1, 2, 0, 543, 30 },
+    { 1, 2, 0, 545, 30 },
+    { 1, 2, 0, 547, 30 },
+    { 1, 2, 0, 549, 30 },
+    { 1, 2, 0, 551, 30 },
+    { 1, 2, 0, 553, 30 },
+    { 1, 2, 0, 555, 30 },
+    { 1, 2, 0, 557, 30 },
+    { 1, 2, 0, 559, 30 },
+    { 1, 2, 0, 561, 30 },
+    { 1, 2, 0, 563, 30 },
+    { 1, 2, 0, 565, 30 },
+    { 1, 2, 0, 567, 30 },
+    { 1, 2, 0, 569, 30 },
+    { 1, 2, 0, 571, 30 },
+    { 1, 2, 0, 573, 30 },
+    { 1, 2, 0, 575, 30 },
+    { 1, 2, 0, 577, 30 },
+    { 1, 2, 0, 579, 30 },
+    { 1, 2, 0, 581, 30 },
+    { 1, 2, 0, 583, 30 },
+    { 1, 2, 0, 585, 30 },
+    { 1, 2, 0, 587, 30 },
+    { 1, 2, 0, 589, 30 },
+    { 1, 2, 0, 591, 30 },
+    { 1, 2, 0, 593, 30 },
+    { 1, 2, 0, 595, 30 },
+    { 1, 2, 0, 597, 30 },
+    { 1, 2, 0, 599, 30 },
+    { 1, 2, 0, 601, 30 },
+    { 1, 2, 0, 603, 30 },
+    { 1, 2, 0, 605, 30 },
+    { 1, 2, 0, 607, 30 },
+    { 1, 2, 0, 609, 30 },
+    { 1, 2, 0, 611, 30 },
+    { 1, 2, 0, 613, 30 },
+    { 1, 2, 0, 615, 30 },
+    { 1, 2, 0, 617, 30 },
+    { 1, 2, 0, 619, 30 },
+    { 1, 2, 0, 621, 30 },
+    { 1, 2, 0, 623, 30 },
+    { 1, 2, 0, 625, 30 },
+    { 1, 2, 0, 627, 30 },
+    { 1, 4, 0, 629, 30 },
+    { 1, 2, 0, 633, 30 },
+    { 1, 2, 0, 635, 30 },
+    { 1, 2, 0, 637, 30 },
+    { 1, 2, 0, 639, 30 },
+    { 1, 2, 0, 641, 30 },
+    { 1, 2, 0, 643, 30 },
+    { 1, 2, 0, 645, 30 },
+    { 1, 2, 0, 647, 30 },
+    { 1, 2, 0, 649, 30 },
+    { 1, 2, 0, 651, 30 },
+    { 1, 2, 0, 653, 30 },
+    { 1, 2, 0, 655, 30 },
+    { 1, 2, 0, 657, 30 },
+    { 1, 2, 0, 659, 30 },
+    { 1, 2, 0, 661, 30 },
+    { 1, 2, 0, 663, 30 },
+    { 1, 2, 0, 665, 30 },
+    { 1, 2, 0, 667, 30 },
+    { 1, 2, 0, 669, 30 },
+    { 1, 2, 0, 671, 30 },
+    { 1, 2, 0, 673, 30 },
+    { 1, 2, 0, 675, 30 },
+    { 1, 2, 0, 677, 30 },
+    { 1, 2, 0, 679, 30 },
+    { 1, 2, 0, 681, 30 },
+    { 1, 2, 0, 683, 30 },
+    { 1, 2, 0, 685, 30 },
+    { 1, 2, 0, 687, 30 },
+    { 1, 2, 0, 689, 30 },
+    { 1, 2, 0, 691, 30 },
+    { 1, 2, 0, 693, 30 },
+    { 1, 2, 0, 695, 30 },
+    { 1, 2, 0, 697, 30 },
+    { 1, 2, 0, 699, 30 },
+    { 1, 2, 0, 701, 30 },
+    { 1, 2, 0, 703, 30 },
+    { 1, 2, 0, 705, 30 },
+    { 1, 2, 0, 707, 30 },
+    { 1, 2, 0, 709, 30 },
+    { 1, 2, 0, 711, 30 },
+    { 1, 2, 0, 713, 30 },
+    { 1, 2, 0, 715, 30 },
+    { 0, 2, 2, 717, 717 },
+    { 0, 2, 2, 719, 719 },
+    { 0, 2, 2, 721, 721 },
+    { 0, 2, 2, 723, 723 },
+    { 0, 3, 2, 725, 728 },
+    { 0, 1, 1, 730, 730 },
+    { 0, 2, 2, 731, 731 },
+    { 0, 5, 1, 733, 26 },
+    { 0, 2, 1, 738, 2 },
+    { 0, 2, 2, 740, 740 },
+    { 0, 2, 1, 742, 6 },
+    { 0, 2, 2, 744, 746 },
+    { 0, 2, 1, 748, 10 },
+    { 0, 2, 1, 750, 0 },
+    { 0, 2, 1, 752, 20 },
+    { 0, 2, 1, 754, 22 },
+    { 0, 2, 1, 756, 2 },
+    { 0, 2, 1, 758, 3 },
+    { 0, 2, 1, 760, 24 },
+    { 0, 2, 2, 762, 762 },
+    { 0, 2, 1, 764, 6 },
+    { 0, 2, 2, 766, 766 },
+    { 0, 2, 2, 746, 746 },
+    { 0, 2, 2, 768, 768 },
+    { 0, 2, 1, 633, 10 },
+    { 0, 2, 1, 770, 12 },
+    { 0, 2, 2, 772, 772 },
+    { 0, 2, 1, 774, 21 },
+    { 0, 2, 2, 776, 776 },
+    { 0, 2, 1, 778, 0 },
+    { 0, 2, 2, 780, 780 },
+    { 0, 2, 1, 782, 15 },
+    { 0, 2, 2, 784, 784 },
+    { 0, 2, 1, 786, 19 },
+    { 0, 2, 1, 788, 20 },
+    { 0, 2, 2, 790, 790 },
+    { 0, 2, 1, 792, 23 },
+    { 0, 2, 2, 794, 794 },
+    { 0, 2, 1, 796, 22 },
+    { 0, 2, 1, 798, 10 },
+    { 0, 2, 1, 800, 20 },
+    { 0, 0, 2, 65535, 746 },
+    { 0, 0, 1, 65535, 21 },
+    { 0, 0, 1, 65535, 15 },
+    { 0, 0, 1, 65535, 23 },
+    { 0, 2, 2, 802, 802 },
+    { 0, 2, 2, 804, 804 },
+    { 0, 2, 2, 806, 806 },
+    { 0, 2, 2, 808, 808 },
+    { 0, 2, 2, 810, 810 },
+    { 0, 2, 2, 812, 812 },
+    { 0, 2, 2, 814, 814 },
+    { 0, 2, 2, 816, 816 },
+    { 0, 2, 2, 818, 818 },
+    { 0, 2, 2, 820, 820 },
+    { 0, 2, 2, 822, 822 },
+    { 0, 2, 2, 824, 824 },
+    { 0, 2, 2, 826, 826 },
+    { 0, 2, 2, 828, 828 },
+    { 0, 2, 2, 830, 830 },
+    { 0, 2, 2, 832, 832 },
+    { 0, 2, 2, 834, 834 },
+    { 0, 2, 2, 836, 836 },
+    { 0, 2, 1, 838, 6 },
+    { 0, 2, 1, 840, 6 },
+    { 0, 2, 2, 842, 842 },
+    { 0, 2, 1, 844, 17 },
+    { 0, 2, 2, 846, 846 },
+    { 0, 2, 1, 848, 18 },
+    { 0, 2, 1, 850, 10 },
+    { 0, 2, 1, 852, 10 },
+    { 0, 2, 1, 854, 11 },
+    { 0, 2, 2, 856, 856 },
+    { 0, 2, 2, 858, 858 },
+    { 0, 2, 2, 860, 860 },
+    { 0, 2, 1, 862, 12 },
+    { 0, 2, 2, 864, 866 },
+    { 0, 2, 1, 868, 24 },
+    { 0, 2, 2, 870, 870 },
+    { 0, 2, 1, 872, 2 },
+    { 0, 2, 2, 874, 874 },
+    { 0, 2, 1, 876, 3 },
+    { 0, 2, 1, 878, 17 },
+    { 0, 2, 2, 880, 880 },
+    { 0, 2, 1, 882, 6 },
+    { 0, 2, 2, 884, 884 },
+    { 0, 2, 2, 886, 886 },
+    { 0, 2, 2, 866, 866 },
+    { 0, 2, 2, 888, 866 },
+    { 0, 2, 1, 890, 12 },
+    { 0, 2, 2, 892, 892 },
+    { 0, 2, 1, 894, 13 },
+    { 0, 2, 1, 896, 9 },
+    { 0, 2, 1, 898, 0 },
+    { 0, 2, 2, 900, 900 },
+    { 0, 2, 1, 902, 15 },
+    { 0, 2, 1, 904, 4 },
+    { 0, 2, 1, 906, 19 },
+    { 0, 2, 1, 908, 24 },
+    { 0, 2, 2, 910, 910 },
+    { 0, 2, 1, 912, 23 },
+    { 0, 2, 2, 914, 914 },
+    { 0, 2, 2, 916, 916 },
+    { 0, 2, 2, 918, 918 },
+    { 0, 2, 2, 920, 920 },
+    { 0, 2, 2, 922, 922 },
+    { 0, 2, 2, 924, 924 },
+    { 0, 2, 2, 926, 926 },
+    { 0, 2, 2, 928, 928 },
+    { 0, 2, 2, 930, 930 },
+    { 0, 2, 2, 932, 932 },
+    { 0, 0, 2, 65535, 866 },
+    { 0, 0, 1, 65535, 13 },
+    { 0, 2, 2, 934, 934 },
+    { 0, 2, 2, 936, 936 },
+    { 0, 2, 2, 938, 938 },
+    { 0, 2, 2, 940, 940 },
+    { 0, 2, 2, 942, 942 },
+    { 0, 2, 2, 944, 944 },
+    { 0, 2, 2, 946, 946 },
+    { 0, 2, 2, 948, 948 },
+    { 0, 2, 2, 950, 950 },
+    { 0, 2, 2, 952, 952 },
+    { 0, 2, 2, 954, 954 },
+    { 0, 2, 2, 956, 954 },
+    { 0, 0, 2, 65535, 954 },
+    { 0, 2, 2, 958, 958 },
+    { 0, 2, 2, 960, 960 },
+    { 0, 2, 2, 962, 962 },
+    { 0, 2, 2, 964, 964 },
+    { 0, 2, 2, 966, 966 },
+    { 1, 2, 0, 968, 30 },
+    { 1, 2, 0, 970, 30 },
+    { 1, 2, 0, 972, 30 },
+    { 1, 2, 0, 974, 30 },
+    { 1, 2, 0, 976, 30 },
+    { 1, 2, 0, 978, 30 },
+    { 1, 2, 0, 980, 30 },
+    { 0, 2, 2, 982, 982 },
+    { 0, 2, 2, 984, 984 },
+    { 0, 2, 2, 986, 986 },
+    { 0, 2, 1, 988, 17 },
+    { 0, 2, 2, 990, 990 },
+    { 0, 2, 2, 992, 992 },
+    { 0, 2, 2, 994, 994 },
+    { 0, 2, 2, 996, 996 },
+    { 0, 2, 2, 998, 998 },
+    { 0, 2, 2, 1000, 1000 },
+    { 0, 2, 2, 1002, 1002 },
+    { 0, 2, 2, 1004, 1004 },
+    { 0, 2, 2, 1006, 1006 },
+    { 0, 2, 2, 1008, 1008 },
+    { 0, 2, 2, 1010, 1010 },
+    { 0, 2, 2, 1012, 1012 },
+    { 0, 2, 2, 1014, 1014 },
+    { 0, 2, 2, 1016, 1016 },
+    { 0, 2, 2, 1018, 1018 },
+    { 0, 2, 2, 1020, 1020 },
+    { 0, 2, 2, 1022, 1022 },
+    { 0, 2, 2, 1024, 1024 },
+    { 0, 2, 2, 1026, 1026 },
+    { 0, 2, 2, 1028, 1028 },
+    { 0, 2, 1, 1030, 9 },
+    { 0, 2, 2, 1032, 1032 },
+    { 0, 2, 2, 1034, 1034 },
+    { 0, 2, 1, 1036, 1 },
+    { 0, 2, 2, 1038, 884 },
+    { 0, 0, 2, 65535, 884 },
+    { 0, 2, 2, 1040, 1040 },
+    { 0, 2, 2, 1042, 1042 },
+    { 0, 2, 2, 1044, 1044 },
+    { 0, 2, 2, 1046, 1046 },
+    { 0, 2, 2, 1048, 1048 },
+    { 0, 2, 2, 1050, 1050 },
+    { 0, 2, 1, 1052, 2 },
+    { 0, 2, 1, 1054, 2 },
+    { 0, 2, 2, 1056, 1056 },
+    { 0, 2, 1, 1058, 6 },
+    { 0, 2, 2, 1060, 1060 },
+    { 0, 2, 2, 1062, 1060 },
+    { 0, 0, 2, 65535, 1060 },
+    { 0, 2, 2, 1064, 884 },
+    { 0, 2, 2, 1066, 886 },
+    { 0, 0, 2, 65535, 886 },
+    { 0, 2, 2, 1068, 1068 },
+    { 0, 2, 2, 1070, 866 },
+    { 0, 2, 2, 1072, 866 },
+    { 0, 2, 1, 1074, 0 },
+    { 0, 2, 2, 1076, 1076 },
+    { 0, 2, 2, 1078, 1076 },
+    { 0, 0, 2, 65535, 1076 },
+    { 0, 2, 2, 1080, 928 },
+    { 0, 0, 2, 65535, 928 },
+    { 0, 2, 1, 1082, 24 },
+    { 0, 2, 1, 1084, 24 },
+    { 0, 2, 1, 1086, 24 },
+    { 0, 2, 2, 1088, 916 },
+    { 0, 0, 2, 65535, 916 },
+    { 0, 2, 2, 1090, 1090 },
+    { 0, 2, 2, 1092, 924 },
+    { 0, 0, 2, 65535, 924 },
+    { 0, 2, 2, 1094, 1094 },
+    { 0, 2, 2, 1096, 1096 },
+    { 0, 2, 2, 1098, 1098 },
+    { 0, 2, 1, 1100, 5 },
+    { 0, 2, 2, 1102, 1102 },
+    { 0, 2, 2, 1104, 1104 },
+    { 0, 2, 2, 1106, 1106 },
+    { 0, 2, 2, 1108, 1108 },
+    { 0, 2, 2, 1110, 1110 },
+    { 0, 2, 2, 1112, 1112 },
+    { 0, 2, 2, 1114, 1114 },
+    { 0, 2, 2, 1116, 1116 },
+    { 0, 2, 2, 1118, 1118 },
+    { 0, 2, 2, 1120, 1120 },
+    { 0, 2, 2, 1122, 1122 },
+    { 0, 2, 2, 1124, 1124 },
+    { 0, 2, 1, 1126, 16 },
+    { 0, 0, 1, 65535, 16 },
+    { 0, 2, 1, 1128, 22 },
+    { 0, 2, 2, 1130, 1130 },
+    { 0, 2, 2, 1132, 1132 },
+    { 0, 2, 2, 1134, 1134 },
+    { 0, 2, 2, 1136, 1136 },
+    { 0, 2, 2, 1138, 1138 },
+    { 0, 2, 2, 1140, 1140 },
+    { 0, 2, 2, 1142, 1142 },
+    { 0, 2, 2, 1144, 1144 },
+    { 0, 2, 2, 1146, 1146 },
+    { 0, 2, 2, 1148, 1148 },
+    { 0, 2, 2, 1150, 1150 },
+    { 0, 2, 2, 1152, 1152 },
+    { 0, 2, 2, 1154, 1154 },
+    { 0, 2, 2, 1156, 1156 },
+    { 0, 2, 1, 1158, 16 },
+    { 0, 2, 2, 1160, 1160 },
+    { 0, 2, 2, 1162, 1162 },
+    { 0, 2, 2, 1164, 1164 },
+    { 0, 2, 2, 1166, 1166 },
+    { 0, 2, 2, 1168, 1168 },
+    { 0, 2, 2, 1170, 1170 },
+    { 0, 2, 2, 1172, 1172 },
+    { 0, 2, 2, 1174, 1174 },
+    { 0, 2, 2, 1176, 1176 },
+    { 0, 2, 2, 1178, 1178 },
+    { 0, 2, 2, 1180, 1180 },
+    { 0, 2, 2, 1182, 1182 },
+    { 0, 2, 2, 1184, 1184 },
+    { 0, 2, 2, 1186, 1186 },
+    { 0, 2, 2, 1188, 1188 },
+    { 0, 2, 2, 1190, 1190 },
+    { 0, 2, 2, 1192, 1192 },
+    { 0, 2, 1, 1194, 14 },
+    { 0, 2, 2, 1196, 1196 },
+    { 0, 2, 2, 1198, 1198 },
+    { 0, 2, 2, 1200, 1200 },
+    { 0, 2, 2, 1202, 1202 },
+    { 0, 2, 1, 1204, 20 },
+    { 0, 2, 2, 1206, 1206 },
+    { 0, 2, 2, 1208, 1208 },
+    { 0, 2, 2, 1210, 1210 },
+    { 0, 2, 2, 1212, 1212 },
+    { 0, 2, 2, 1214, 1214 },
+    { 0, 2, 2, 1216, 1216 },
+    { 0, 2, 2, 1218, 1218 },
+    { 0, 2, 1, 1220, 0 },
+    { 0, 2, 2, 1222, 1222 },
+    { 0, 4, 4, 1224, 1224 },
+    { 1, 2, 0, 1228, 30 },
+    { 1, 2, 0, 1230, 30 },
+    { 1, 2, 0, 1232, 30 },
+    { 1, 2, 0, 1234, 30 },
+    { 1, 2, 0, 1236, 30 },
+    { 1, 2, 0, 1238, 30 },
+    { 1, 2, 0, 1240, 30 },
+    { 1, 2, 0, 1242, 30 },
+    { 1, 2, 0, 1244, 30 },
+    { 1, 2, 0, 1246, 30 },
+    { 1, 2, 0, 1248, 30 },
+    { 1, 2, 0, 1250, 30 },
+    { 1, 2, 0, 1252, 30 },
+    { 1, 2, 0, 1254, 30 },
+    { 1, 2, 0, 1256, 30 },
+    { 1, 2, 0, 1258, 30 },
+    { 1, 2, 0, 1260, 30 },
+    { 1, 2, 0, 1262, 30 },
+    { 1, 2, 0, 1264, 30 },
+    { 1, 2, 0, 1266, 30 },
+    { 1, 2, 0, 1268, 30 },
+    { 1, 2, 0, 1270, 30 },
+    { 1, 2, 0, 1272, 30 },
+    { 1, 2, 0, 1274, 30 },
+    { 1, 2, 0, 1276, 30 },
+    { 1, 2, 0, 1278, 30 },
+    { 1, 2, 0, 1280, 30 },
+    { 1, 2, 0, 1282, 30 },
+    { 1, 2, 0, 1284, 30 },
+    { 1, 2, 0, 1286, 30 },
+    { 1, 2, 0, 1288, 30 },
+    { 1, 2, 0, 1290, 30 },
+    { 1, 2, 0, 1292, 30 },
+    { 1, 2, 0, 1294, 30 },
+    { 1, 2, 0, 1296, 30 },
+    { 1, 2, 0, 1298, 30 },
+    { 1, 2, 0, 1300, 30 },
+    { 1, 2, 0, 1302, 30 },
+    { 1, 2, 0, 1304, 30 },
+    { 1, 2, 0, 1306, 30 },
+    { 1, 2, 0, 1308, 30 },
+    { 1, 2, 0, 1310, 30 },
+    { 1, 2, 0, 1312, 30 },
+    { 1, 2, 0, 1314, 30 },
+    { 1, 2, 0, 1316, 30 },
+    { 1, 2, 0, 1318, 30 },
+    { 1, 2, 0, 1320, 30 },
+    { 1, 2, 0, 1322, 30 },
+    { 1, 2, 0, 1324, 30 },
+    { 1, 2, 0, 1326, 30 },
+    { 1, 2, 0, 1328, 30 },
+    { 1, 2, 0, 1330, 30 },
+    { 1, 2, 0, 1332, 30 },
+    { 1, 2, 0, 1334, 30 },
+    { 1, 2, 0, 1336, 30 },
+    { 1, 2, 0, 1338, 30 },
+    { 1, 2, 0, 1340, 30 },
+    { 1, 2, 0, 1342, 30 },
+    { 1, 2, 0, 1344, 30 },
+    { 1, 2, 0, 1346, 30 },
+    { 1, 2, 0, 1348, 30 },
+    { 1, 2, 0, 1350, 30 },
+    { 0, 0, 2, 65535, 1352 },
+    { 0, 0, 2, 65535, 1354 },
+    { 0, 0, 2, 65535, 1356 },
+    { 1, 2, 0, 1358, 30 },
+    { 1, 2, 0, 1360, 30 },
+    { 1, 2, 0, 1362, 30 },
+    { 1, 2, 0, 1364, 30 },
+    { 1, 2, 0, 1366, 30 },
+    { 1, 2, 0, 1368, 30 },
+    { 1, 2, 0, 1370, 30 },
+    { 1, 2, 0, 1372, 30 },
+    { 1, 2, 0, 1374, 30 },
+    { 1, 2, 0, 1376, 30 },
+    { 1, 2, 0, 1378, 30 },
+    { 1, 2, 0, 1380, 30 },
+    { 1, 2, 0, 1382, 30 },
+    { 1, 2, 0, 1384, 30 },
+    { 1, 2, 0, 1386, 30 },
+    { 1, 2, 0, 1388, 30 },
+    { 1, 2, 0, 1390, 30 },
+    { 1, 2, 0, 1392, 30 },
+    { 1, 2, 0, 1394, 30 },
+    { 1, 2, 0, 1396, 30 },
+    { 1, 2, 0, 1398, 30 },
+    { 1, 2, 0, 1400, 30 },
+    { 0, 4, 4, 1402, 1402 },
+    { 0, 4, 4, 1406, 1406 },
+    { 0, 4, 4, 1410, 1410 },
+    { 0, 4, 4, 1414, 1414 },
+    { 0, 0, 2, 65535, 1418 },
+    { 0, 0, 2, 65535, 1420 },
+    { 0, 0, 2, 65535, 1422 },
+    { 1, 2, 0, 1424, 30 },
+    { 1, 2, 0, 1426, 30 },
+    { 1, 2, 0, 1428, 30 },
+    { 1, 2, 0, 1430, 30 },
+    { 1, 2, 0, 1432, 30 },
+    { 1, 2, 0, 1434, 30 },
+    { 1, 2, 0, 1436, 30 },
+    { 1, 2, 0, 1438, 30 },
+    { 1, 2, 0, 1440, 30 },
+    { 1, 2, 0, 1442, 30 },
+    { 1, 2, 0, 1444, 30 },
+    { 1, 2, 0, 1446, 30 },
+    { 1, 2, 0, 1448, 30 },
+    { 1, 2, 0, 1450, 30 },
+    { 1, 2, 0, 1452, 30 },
+    { 1, 2, 0, 1454, 30 },
+    { 1, 2, 0, 1456, 30 },
+    { 1, 2, 0, 1458, 30 },
+    { 1, 2, 0, 1460, 30 },
+    { 1, 2, 0, 1462, 30 },
+    { 1, 2, 0, 1464, 30 },
+    { 1, 2, 0, 1466, 30 },
+    { 1, 2, 0, 1468, 30 },
+    { 1, 2, 0, 1470, 30 },
+    { 1, 2, 0, 1472, 30 },
+    { 1, 2, 0, 1474, 30 },
+    { 1, 2, 0, 1476, 30 },
+    { 1, 2, 0, 1478, 30 },
+    { 1, 2, 0, 1480, 30 },
+    { 1, 2, 0, 1482, 30 },
+    { 1, 2, 0, 1484, 30 },
+    { 1, 2, 0, 1486, 30 },
+    { 1, 2, 0, 1488, 30 },
+    { 1, 2, 0, 1490, 30 },
+    { 1, 2, 0, 1492, 30 },
+    { 1, 2, 0, 1494, 30 },
+    { 1, 2, 0, 1496, 30 },
+    { 1, 2, 0, 1498, 30 },
+    { 1, 2, 0, 1500, 30 },
+    { 1, 2, 0, 1502, 30 },
+    { 1, 2, 0, 1504, 30 },
+    { 1, 2, 0, 1506, 30 },
+    { 1, 2, 0, 1508, 30 },
+    { 1, 2, 0, 1510, 30 },
+    { 1, 2, 0, 1512, 30 },
+    { 1, 2, 0, 1514, 30 },
+    { 1, 2, 0, 1516, 30 },
+    { 1, 2, 0, 1518, 30 },
+    { 1, 2, 0, 1520, 30 },
+    { 1, 2, 0, 1522, 30 },
+    { 1, 2, 0, 1524, 30 },
+    { 1, 2, 0, 1526, 30 },
+    { 1, 2, 0, 1528, 30 },
+    { 1, 2, 0, 1530, 30 },
+    { 1, 2, 0, 1532, 30 },
+    { 1, 2, 0, 1534, 30 },
+    { 1, 2, 0, 1536, 30 },
+    { 1, 2, 0, 1538, 30 },
+    { 1, 2, 0, 1540, 30 },
+    { 1, 2, 0, 1542, 30 },
+    { 1, 2, 0, 1544, 30 },
+    { 1, 2, 0, 1546, 30 },
+    { 1, 2, 0, 1548, 30 },
+    { 1, 2, 0, 1550, 30 },
+    { 1, 2, 0, 1552, 30 },
+    { 1, 2, 0, 1554, 30 },
+    { 1, 2, 0, 1556, 30 },
+    { 1, 2, 0, 1558, 30 },
+    { 1, 3, 0, 1560, 30 },
+    { 1, 3, 0, 1563, 30 },
+    { 1, 3, 0, 1566, 30 },
+    { 1, 3, 0, 1569, 30 },
+    { 1, 3, 0, 1572, 30 },
+    { 1, 3, 0, 1575, 30 },
+    { 1, 3, 0, 1578, 30 },
+    { 1, 3, 0, 1581, 30 },
+    { 1, 3, 0, 1584, 30 },
+    { 1, 3, 0, 1587, 30 },
+    { 1, 3, 0, 1590, 30 },
+    { 1, 3, 0, 1593, 30 },
+    { 1, 3, 0, 1596, 30 },
+    { 1, 3, 0, 1599, 30 },
+    { 1, 3, 0, 1602, 30 },
+    { 1, 3, 0, 1605, 30 },
+    { 1, 3, 0, 1608, 30 },
+    { 1, 3, 0, 1611, 30 },
+    { 1, 3, 0, 1614, 30 },
+    { 1, 3, 0, 1617, 30 },
+    { 1, 3, 0, 1620, 30 },
+    { 1, 3, 0, 1623, 30 },
+    { 1, 3, 0, 1626, 30 },
+    { 1, 3, 0, 1629, 30 },
+    { 1, 3, 0, 1632, 30 },
+    { 1, 3, 0, 1635, 30 },
+    { 1, 3, 0, 1638, 30 },
+    { 1, 3, 0, 1641, 30 },
+    { 1, 3, 0, 1644, 30 },
+    { 1, 3, 0, 1647, 30 },
+    { 1, 3, 0, 1650, 30 },
+    { 1, 3, 0, 1653, 30 },
+    { 1, 3, 0, 1656, 30 },
+    { 1, 3, 0, 1659, 30 },
+    { 1, 3, 0, 1662, 30 },
+    { 1, 3, 0, 1665, 30 },
+    { 1, 3, 0, 1668, 30 },
+    { 1, 3, 0, 1671, 30 },
+    { 1, 3, 0, 1674, 30 },
+    { 1, 3, 0, 1677, 30 },
+    { 1, 3, 0, 1680, 30 },
+    { 1, 3, 0, 1683, 30 },
+    { 1, 3, 0, 1686, 30 },
+    { 1, 3, 0, 1689, 30 },
+    { 1, 3, 0, 1692, 30 },
+    { 1, 3, 0, 1695, 30 },
+    { 1, 3, 0, 1698, 30 },
+    { 1, 3, 0, 1701, 30 },
+    { 1, 3, 0, 1704, 30 },
+    { 1, 3, 0, 1707, 30 },
+    { 1, 3, 0, 1710, 30 },
+    { 1, 3, 0, 1713, 30 },
+    { 1, 3, 0, 1716, 30 },
+    { 1, 3, 0, 1719, 30 },
+    { 1, 3, 0, 1722, 30 },
+    { 1, 3, 0, 1725, 30 },
+    { 1, 3, 0, 1728, 30 },
+    { 1, 3, 0, 1731, 30 },
+    { 1, 3, 0, 1734, 30 },
+    { 1, 3, 0, 1737, 30 },
+    { 1, 3, 0, 1740, 30 },
+    { 1, 3, 0, 1743, 30 },
+    { 1, 3, 0, 1746, 30 },
+    { 1, 3, 0, 1749, 30 },
+    { 1, 3, 0, 1752, 30 },
+    { 1, 3, 0, 1755, 30 },
+    { 1, 3, 0, 1758, 30 },
+    { 1, 3, 0, 1761, 30 },
+    { 1, 3, 0, 1764, 30 },
+    { 1, 3, 0, 1767, 30 },
+    { 1, 3, 0, 1770, 30 },
+    { 1, 3, 0, 1773, 30 },
+    { 1, 3, 0, 1776, 30 },
+    { 1, 3, 0, 1779, 30 },
+    { 1, 3, 0, 1782, 30 },
+    { 1, 3, 0, 1785, 30 },
+    { 1, 3, 0, 1788, 30 },
+    { 1, 3, 0, 1791, 30 },
+    { 1, 3, 0, 1794, 30 },
+    { 1, 3, 0, 1797, 30 },
+    { 1, 3, 0, 1800, 30 },
+    { 1, 3, 0, 1803, 30 },
+    { 1, 3, 0, 1806, 30 },
+    { 1, 3, 0, 1809, 30 },
+    { 1, 3, 0, 1812, 30 },
+    { 1, 3, 0, 1815, 30 },
+    { 1, 3, 0, 1818, 30 },
+    { 1, 3, 0, 1821, 30 },
+    { 0, 0, 0, 65535, 30 },
+    { 0, 0, 3, 65535, 1824 },
+    { 0, 0, 3, 65535, 1827 },
+    { 0, 0, 3, 65535, 1830 },
+    { 1, 3, 0, 1833, 30 },
+    { 1, 3, 0, 1836, 30 },
+    { 1, 3, 0, 1839, 30 },
+    { 1, 3, 0, 1842, 30 },
+    { 1, 3, 0, 1845, 30 },
+    { 1, 3, 0, 1848, 30 },
+    { 1, 3, 0, 1851, 30 },
+    { 1, 3, 0, 1854, 30 },
+    { 1, 3, 0, 1857, 30 },
+    { 1, 3, 0, 1860, 30 },
+    { 1, 3, 0, 1863, 30 },
+    { 1, 3, 0, 1866, 30 },
+    { 1, 3, 0, 1869, 30 },
+    { 1, 3, 0, 1872, 30 },
+    { 1, 3, 0, 1875, 30 },
+    { 1, 3, 0, 1878, 30 },
+    { 1, 3, 0, 1881, 30 },
+    { 1, 3, 0, 1884, 30 },
+    { 0, 6, 3, 1887, 1893 },
+    { 0, 6, 3, 1896, 1902 },
+    { 0, 6, 3, 1905, 1911 },
+    { 0, 6, 3, 1914, 1920 },
+    { 0, 6, 3, 1923, 1929 },
+    { 0, 6, 3, 1932, 1938 },
+    { 0, 6, 3, 1941, 1947 },
+    { 0, 6, 3, 1950, 1956 },
+    { 1, 3, 0, 1959, 30 },
+    { 1, 3, 0, 1962, 30 },
+    { 1, 3, 0, 1965, 30 },
+    { 1, 3, 0, 1968, 30 },
+    { 1, 3, 0, 1971, 30 },
+    { 1, 3, 0, 1974, 30 },
+    { 1, 3, 0, 1977, 30 },
+    { 1, 3, 0, 1980, 30 },
+    { 1, 3, 0, 1983, 30 },
+    { 0, 6, 3, 1986, 1992 },
+    { 0, 6, 3, 1995, 2001 },
+    { 0, 6, 3, 2004, 2010 },
+    { 1, 3, 0, 2013, 30 },
+    { 1, 3, 0, 2016, 30 },
+    { 1, 3, 0, 2019, 30 },
+    { 1, 3, 0, 2022, 30 },
+    { 1, 3, 0, 2025, 30 },
+    { 0, 6, 3, 2028, 2034 },
+    { 0, 6, 3, 2037, 2043 },
+    { 1, 3, 0, 2046, 30 },
+    { 1, 3, 0, 2049, 30 },
+    { 1, 3, 0, 2052, 30 },
+    { 1, 3, 0, 2055, 30 },
+    { 1, 3, 0, 2058, 30 },
+    { 1, 3, 0, 2061, 30 },
+    { 1, 3, 0, 2064, 30 },
+    { 1, 3, 0, 2067, 30 },
+    { 1, 3, 0, 2070, 30 },
+    { 0, 6, 3, 2073, 2079 },
+    { 0, 6, 3, 2082, 2088 },
+    { 0, 6, 3, 2091, 2097 },
+    { 0, 6, 3, 2100, 2106 },
+    { 1, 3, 0, 2109, 30 },
+    { 1, 3, 0, 2112, 30 },
+    { 1, 3, 0, 2115, 30 },
+    { 1, 3, 0, 2118, 30 },
+    { 1, 3, 0, 2121, 30 },
+    { 1, 3, 0, 2124, 30 },
+    { 1, 3, 0, 2127, 30 },
+    { 1, 3, 0, 2130, 30 },
+    { 1, 3, 0, 2133, 30 },
+    { 1, 3, 0, 2136, 30 },
+    { 1, 3, 0, 2139, 30 },
+    { 1, 3, 0, 2142, 30 },
+    { 1, 3, 0, 2145, 30 },
+    { 1, 3, 0, 2148, 30 },
+    { 1, 3, 0, 2151, 30 },
+    { 1, 3, 0, 2154, 30 },
+    { 1, 3, 0, 2157, 30 },
+    { 1, 3, 0, 2160, 30 },
+    { 1, 3, 0, 2163, 30 },
+    { 1, 3, 0, 2166, 30 },
+    { 1, 3, 0, 2169, 30 },
+    { 1, 3, 0, 2172, 30 },
+    { 1, 3, 0, 2175, 30 },
+    { 1, 3, 0, 2178, 30 },
+    { 1, 3, 0, 2181, 30 },
+    { 1, 3, 0, 2184, 30 },
+    { 1, 3, 0, 2187, 30 },
+    { 1, 3, 0, 2190, 30 },
+    { 1, 3, 0, 2193, 30 },
+    { 1, 3, 0, 2196, 30 },
+    { 1, 3, 0, 2199, 30 },
+    { 1, 3, 0, 2202, 30 },
+    { 0, 6, 3, 2205, 2211 },
+    { 0, 6, 3, 2214, 2220 },
+    { 1, 3, 0, 2223, 30 },
+    { 1, 3, 0, 2226, 30 },
+    { 1, 3, 0, 2229, 30 },
+    { 0, 0, 3, 65535, 2232 },
+    { 1, 3, 0, 2235, 30 },
+    { 1, 3, 0, 2238, 30 },
+    { 1, 3, 0, 2241, 30 },
+    { 1, 3, 0, 2244, 30 },
+    { 1, 3, 0, 2247, 30 },
+    { 1, 3, 0, 2250, 30 },
+    { 1, 3, 0, 2253, 30 },
+    { 1, 3, 0, 2256, 30 },
+    { 1, 3, 0, 2259, 30 },
+    { 1, 3, 0, 2262, 30 },
+    { 1, 3, 0, 2265, 30 },
+    { 1, 3, 0, 2268, 30 },
+    { 1, 3, 0, 2271, 30 },
+    { 1, 3, 0, 2274, 30 },
+    { 1, 3, 0, 2277, 30 },
+    { 1, 3, 0, 2280, 30 },
+    { 1, 3, 0, 2283, 30 },
+    { 1, 3, 0, 2286, 30 },
+    { 1, 3, 0, 2289, 30 },
+    { 1, 3, 0, 2292, 30 },
+    { 1, 3, 0, 2295, 30 },
+    { 1, 3, 0, 2298, 30 },
+    { 1, 3, 0, 2301, 30 },
+    { 1, 3, 0, 2304, 30 },
+    { 1, 3, 0, 2307, 30 },
+    { 1, 3, 0, 2310, 30 },
+    { 1, 3, 0, 2313, 30 },
+    { 1, 3, 0, 2316, 30 },
+    { 1, 3, 0, 2319, 30 },
+    { 1, 3, 0, 2322, 30 },
+    { 1, 3, 0, 2325, 30 },
+    { 1, 3, 0, 2328, 30 },
+    { 1, 3, 0, 2331, 30 },
+    { 1, 3, 0, 2334, 30 },
+    { 1, 3, 0, 2337, 30 },
+    { 1, 3, 0, 2340, 30 },
+    { 1, 3, 0, 2343, 30 },
+    { 1, 3, 0, 2346, 30 },
+    { 1, 3, 0, 2349, 30 },
+    { 1, 3, 0, 2352, 30 },
+    { 1, 3, 0, 2355, 30 },
+    { 1, 3, 0, 2358, 30 },
+    { 1, 3, 0, 2361, 30 },
+    { 1, 3, 0, 2364, 30 },
+    { 1, 3, 0, 2367, 30 },
+    { 0, 6, 3, 2370, 2376 },
+    { 1, 3, 0, 2379, 30 },
+    { 1, 3, 0, 2382, 30 },
+    { 1, 3, 0, 2385, 30 },
+    { 1, 3, 0, 2388, 30 },
+    { 1, 3, 0, 2391, 30 },
+    { 1, 3, 0, 2394, 30 },
+    { 1, 3, 0, 2397, 30 },
+    { 1, 3, 0, 2400, 30 },
+    { 1, 3, 0, 2403, 30 },
+    { 1, 3, 0, 2406, 30 },
+    { 1, 3, 0, 2409, 30 },
+    { 1, 3, 0, 2412, 30 },
+    { 1, 3, 0, 2415, 30 },
+    { 1, 3, 0, 2418, 30 },
+    { 1, 3, 0, 2421, 30 },
+    { 1, 3, 0, 2424, 30 },
+    { 0, 6, 3, 2427, 2433 },
+    { 1, 3, 0, 2436, 30 },
+    { 1, 3, 0, 2439, 30 },
+    { 1, 3, 0, 2442, 30 },
+    { 1, 3, 0, 2445, 30 },
+    { 1, 3, 0, 2448, 30 },
+    { 1, 3, 0, 2451, 30 },
+    { 1, 3, 0, 2454, 30 },
+    { 1, 3, 0, 2457, 30 },
+    { 1, 3, 0, 2460, 30 },
+    { 1, 3, 0, 2463, 30 },
+    { 1, 3, 0, 2466, 30 },
+    { 1, 3, 0, 2469, 30 },
+    { 1, 3, 0, 2472, 30 },
+    { 1, 3, 0, 2475, 30 },
+    { 1, 3, 0, 2478, 30 },
+    { 0, 6, 6, 2481, 2481 },
+    { 0, 6, 6, 2487, 2487 },
+    { 0, 3, 3, 2493, 2493 },
+    { 1, 3, 0, 2496, 30 },
+    { 1, 3, 0, 2499, 30 },
+    { 1, 3, 0, 2502, 30 },
+    { 1, 3, 0, 2505, 30 },
+    { 1, 3, 0, 2508, 30 },
+    { 0, 6, 3, 2511, 2517 },
+    { 0, 6, 3, 2520, 2526 },
+    { 0, 6, 3, 2529, 2535 },
+    { 0, 6, 3, 2538, 2544 },
+    { 0, 6, 3, 2547, 2553 },
+    { 0, 6, 3, 2556, 2562 },
+    { 1, 3, 0, 2565, 30 },
+    { 1, 3, 0, 2568, 30 },
+    { 1, 6, 0, 2571, 30 },
+    { 1, 3, 0, 2577, 30 },
+    { 1, 6, 0, 2580, 30 },
+    { 1, 6, 0, 2586, 30 },
+    { 1, 9, 0, 2592, 30 },
+    { 1, 6, 0, 2601, 30 },
+    { 1, 9, 0, 2607, 30 },
+    { 1, 3, 0, 2616, 30 },
+    { 1, 3, 0, 2619, 30 },
+    { 1, 3, 0, 2622, 30 },
+    { 1, 3, 0, 2625, 30 },
+    { 1, 3, 0, 2628, 30 },
+    { 1, 3, 0, 2631, 30 },
+    { 1, 6, 0, 2634, 30 },
+    { 1, 3, 0, 2640, 30 },
+    { 1, 3, 0, 2643, 30 },
+    { 1, 3, 0, 2646, 30 },
+    { 1, 3, 0, 2649, 30 },
+    { 1, 3, 0, 2652, 30 },
+    { 1, 3, 0, 2655, 30 },
+    { 1, 3, 0, 2658, 30 },
+    { 1, 3, 0, 2661, 30 },
+    { 1, 3, 0, 2664, 30 },
+    { 1, 3, 0, 2667, 30 },
+    { 1, 3, 0, 2670, 30 },
+    { 1, 6, 0, 2673, 30 },
+    { 1, 3, 0, 2679, 30 },
+    { 1, 3, 0, 2682, 30 },
+    { 1, 3, 0, 2685, 30 },
+    { 1, 3, 0, 2688, 30 },
+    { 1, 3, 0, 2691, 30 },
+    { 1, 3, 0, 2694, 30 },
+    { 1, 3, 0, 2697, 30 },
+    { 1, 3, 0, 2700, 30 },
+    { 1, 6, 0, 2703, 30 },
+    { 1, 3, 0, 2709, 30 },
+    { 1, 3, 0, 2712, 30 },
+    { 1, 3, 0, 2715, 30 },
+    { 1, 3, 0, 2718, 30 },
+    { 1, 6, 0, 2721, 30 },
+    { 1, 3, 0, 2727, 30 },
+    { 1, 3, 0, 2730, 30 },
+    { 1, 3, 0, 2733, 30 },
+    { 1, 3, 0, 2736, 30 },
+    { 1, 6, 0, 2739, 30 },
+    { 1, 3, 0, 2745, 30 },
+    { 1, 3, 0, 2748, 30 },
+    { 1, 3, 0, 2751, 30 },
+    { 1, 3, 0, 2754, 30 },
+    { 1, 6, 0, 2757, 30 },
+    { 1, 3, 0, 2763, 30 },
+    { 1, 3, 0, 2766, 30 },
+    { 1, 3, 0, 2769, 30 },
+    { 1, 3, 0, 2772, 30 },
+    { 1, 3, 0, 2775, 30 },
+    { 1, 3, 0, 2778, 30 },
+    { 1, 3, 0, 2781, 30 },
+    { 1, 3, 0, 2784, 30 },
+    { 1, 3, 0, 2787, 30 },
+    { 1, 3, 0, 2790, 30 },
+    { 1, 3, 0, 2793, 30 },
+    { 1, 3, 0, 2796, 30 },
+    { 1, 6, 0, 2799, 30 },
+    { 1, 3, 0, 2805, 30 },
+    { 1, 3, 0, 2808, 30 },
+    { 1, 3, 0, 2811, 30 },
+    { 1, 3, 0, 2814, 30 },
+    { 0, 0, 3, 65535, 2817 },
+    { 1, 3, 0, 2820, 30 },
+    { 1, 3, 0, 2823, 30 },
+    { 1, 3, 0, 2826, 30 },
+    { 1, 3, 0, 2829, 30 },
+    { 1, 3, 0, 2832, 30 },
+    { 1, 3, 0, 2835, 30 },
+    { 1, 3, 0, 2838, 30 },
+    { 1, 3, 0, 2841, 30 },
+    { 1, 3, 0, 2844, 30 },
+    { 1, 3, 0, 2847, 30 },
+    { 1, 3, 0, 2850, 30 },
+    { 1, 3, 0, 2853, 30 },
+    { 1, 3, 0, 2856, 30 },
+    { 1, 3, 0, 2859, 30 },
+    { 1, 3, 0, 2862, 30 },
+    { 1, 3, 0, 2865, 30 },
+    { 1, 3, 0, 2868, 30 },
+    { 1, 3, 0, 2871, 30 },
+    { 1, 3, 0, 2874, 30 },
+    { 1, 3, 0, 2877, 30 },
+    { 1, 3, 0, 2880, 30 },
+    { 1, 3, 0, 2883, 30 },
+    { 1, 3, 0, 2886, 30 },
+    { 1, 3, 0, 2889, 30 },
+    { 1, 3, 0, 2892, 30 },
+    { 1, 3, 0, 2895, 30 },
+    { 1, 3, 0, 2898, 30 },
+    { 1, 3, 0, 2901, 30 },
+    { 0, 3, 3, 2904, 2904 },
+    { 0, 3, 3, 2907, 2907 },
+    { 0, 3, 3, 2910, 2910 },
+    { 0, 3, 3, 2913, 2913 },
+    { 0, 3, 3, 2916, 2916 },
+    { 0, 3, 3, 2919, 2919 },
+    { 0, 3, 3, 2922, 2922 },
+    { 0, 3, 3, 2925, 2925 },
+    { 0, 3, 3, 2928, 2928 },
+    { 0, 3, 3, 2931, 2931 },
+    { 0, 3, 3, 2934, 2934 },
+    { 0, 3, 3, 2937, 2937 },
+    { 0, 3, 3, 2940, 2940 },
+    { 0, 3, 3, 2943, 2943 },
+    { 0, 3, 3, 2946, 2946 },
+    { 0, 3, 3, 2949, 2949 },
+    { 0, 3, 3, 2952, 2952 },
+    { 0, 3, 3, 2955, 2955 },
+    { 0, 3, 3, 2958, 2958 },
+    { 0, 3, 3, 2961, 2961 },
+    { 0, 3, 3, 2964, 2964 },
+    { 0, 3, 3, 2967, 2967 },
+    { 0, 3, 3, 2970, 2970 },
+    { 0, 3, 3, 2973, 2973 },
+    { 0, 3, 3, 2976, 2976 },
+    { 0, 3, 3, 2979, 2979 },
+    { 0, 3, 3, 2982, 2982 },
+    { 0, 3, 3, 2985, 2985 },
+    { 0, 3, 3, 2988, 2988 },
+    { 0, 3, 3, 2991, 2991 },
+    { 0, 3, 3, 2994, 2994 },
+    { 0, 3, 3, 2997, 2997 },
+    { 0, 3, 3, 3000, 3000 },
+    { 0, 3, 3, 3003, 3003 },
+    { 0, 3, 3, 3006, 3006 },
+    { 0, 3, 3, 3009, 3009 },
+    { 0, 3, 3, 3012, 3012 },
+    { 0, 3, 3, 3015, 3015 },
+    { 0, 3, 3, 3018, 3018 },
+    { 0, 3, 3, 3021, 3021 },
+    { 0, 3, 3, 3024, 3024 },
+    { 1, 3, 0, 3027, 30 },
+    { 1, 3, 0, 3030, 30 },
+    { 1, 3, 0, 3033, 30 },
+    { 0, 3, 3, 3036, 3036 },
+    { 0, 3, 3, 3039, 3039 },
+    { 0, 3, 3, 3042, 3042 },
+    { 0, 3, 3, 3045, 3045 },
+    { 0, 3, 3, 3048, 3048 },
+    { 0, 3, 3, 3051, 3051 },
+    { 1, 3, 0, 3054, 30 },
+    { 1, 3, 0, 3057, 30 },
+    { 1, 3, 0, 3060, 30 },
+    { 1, 3, 0, 3063, 30 },
+    { 1, 3, 0, 3066, 30 },
+    { 1, 3, 0, 3069, 30 },
+    { 1, 3, 0, 3072, 30 },
+    { 1, 3, 0, 3075, 30 },
+    { 1, 3, 0, 3078, 30 },
+    { 1, 3, 0, 3081, 30 },
+    { 1, 3, 0, 3084, 30 },
+    { 1, 3, 0, 3087, 30 },
+    { 1, 3, 0, 3090, 30 },
+    { 1, 3, 0, 3093, 30 },
+    { 1, 3, 0, 3096, 30 },
+    { 1, 3, 0, 3099, 30 },
+    { 1, 3, 0, 3102, 30 },
+    { 1, 3, 0, 3105, 30 },
+    { 1, 3, 0, 3108, 30 },
+    { 1, 3, 0, 3111, 30 },
+    { 1, 3, 0, 3114, 30 },
+    { 1, 3, 0, 3117, 30 },
+    { 1, 3, 0, 3120, 30 },
+    { 1, 3, 0, 3123, 30 },
+    { 1, 3, 0, 3126, 30 },
+    { 1, 3, 0, 3129, 30 },
+    { 1, 3, 0, 3132, 30 },
+    { 1, 3, 0, 3135, 30 },
+    { 1, 3, 0, 3138, 30 },
+    { 1, 3, 0, 3141, 30 },
+    { 1, 3, 0, 3144, 30 },
+    { 1, 3, 0, 3147, 30 },
+    { 1, 3, 0, 3150, 30 },
+    { 1, 3, 0, 3153, 30 },
+    { 1, 3, 0, 3156, 30 },
+    { 1, 3, 0, 3159, 30 },
+    { 1, 3, 0, 3162, 30 },
+    { 1, 3, 0, 3165, 30 },
+    { 1, 3, 0, 3168, 30 },
+    { 1, 3, 0, 3171, 30 },
+    { 1, 3, 0, 3174, 30 },
+    { 1, 3, 0, 3177, 30 },
+    { 1, 3, 0, 3180, 30 },
+    { 1, 3, 0, 3183, 30 },
+    { 1, 3, 0, 3186, 30 },
+    { 1, 3, 0, 3189, 30 },
+    { 1, 3, 0, 3192, 30 },
+    { 1, 3, 0, 3195, 30 },
+    { 1, 3, 0, 3198, 30 },
+    { 1, 3, 0, 3201, 30 },
+    { 1, 3, 0, 3204, 30 },
+    { 1, 3, 0, 3207, 30 },
+    { 1, 3, 0, 3210, 30 },
+    { 1, 3, 0, 3213, 30 },
+    { 1, 3, 0, 3216, 30 },
+    { 1, 3, 0, 3219, 30 },
+    { 1, 3, 0, 3222, 30 },
+    { 1, 3, 0, 3225, 30 },
+    { 1, 3, 0, 3228, 30 },
+    { 1, 3, 0, 3231, 30 },
+    { 1, 3, 0, 3234, 30 },
+    { 1, 3, 0, 3237, 30 },
+    { 1, 3, 0, 3240, 30 },
+    { 1, 3, 0, 3243, 30 },
+    { 1, 3, 0, 3246, 30 },
+    { 1, 3, 0, 3249, 30 },
+    { 1, 3, 0, 3252, 30 },
+    { 1, 3, 0, 3255, 30 },
+    { 1, 3, 0, 3258, 30 },
+    { 1, 3, 0, 3261, 30 },
+    { 1, 3, 0, 3264, 30 },
+    { 1, 3, 0, 3267, 30 },
+    { 1, 3, 0, 3270, 30 },
+    { 1, 3, 0, 3273, 30 },
+    { 1, 3, 0, 3276, 30 },
+    { 1, 3, 0, 3279, 30 },
+    { 1, 3, 0, 3282, 30 },
+    { 1, 3, 0, 3285, 30 },
+    { 1, 3, 0, 3288, 30 },
+    { 1, 3, 0, 3291, 30 },
+    { 1, 3, 0, 3294, 30 },
+    { 1, 3, 0, 3297, 30 },
+    { 1, 3, 0, 3300, 30 },
+    { 1, 3, 0, 3303, 30 },
+    { 1, 3, 0, 3306, 30 },
+    { 1, 3, 0, 3309, 30 },
+    { 1, 3, 0, 3312, 30 },
+    { 1, 3, 0, 3315, 30 },
+    { 1, 3, 0, 3318, 30 },
+    { 1, 3, 0, 3321, 30 },
+    { 1, 3, 0, 3324, 30 },
+    { 1, 3, 0, 3327, 30 },
+    { 1, 3, 0, 3330, 30 },
+    { 1, 3, 0, 3333, 30 },
+    { 1, 3, 0, 3336, 30 },
+    { 1, 3, 0, 3339, 30 },
+    { 1, 3, 0, 3342, 30 },
+    { 1, 3, 0, 3345, 30 },
+    { 1, 3, 0, 3348, 30 },
+    { 1, 3, 0, 3351, 30 },
+    { 1, 3, 0, 3354, 30 },
+    { 1, 3, 0, 3357, 30 },
+    { 1, 3, 0, 3360, 30 },
+    { 1, 3, 0, 3363, 30 },
+    { 1, 3, 0, 3366, 30 },
+    { 1, 3, 0, 3369, 30 },
+    { 1, 3, 0, 3372, 30 },
+    { 1, 3, 0, 3375, 30 },
+    { 0, 0, 3, 65535, 3378 },
+    { 0, 0, 3, 65535, 3381 },
+    { 0, 0, 3, 65535, 3384 },
+    { 0, 0, 3, 65535, 3387 },
+    { 0, 0, 3, 65535, 3390 },
+    { 0, 0, 3, 65535, 3393 },
+    { 1, 3, 0, 3396, 30 },
+    { 1, 3, 0, 3399, 30 },
+    { 1, 3, 0, 3402, 30 },
+    { 1, 3, 0, 3405, 30 },
+    { 1, 3, 0, 3408, 30 },
+    { 1, 3, 0, 3411, 30 },
+    { 1, 3, 0, 3414, 30 },
+    { 1, 3, 0, 3417, 30 },
+    { 1, 3, 0, 3420, 30 },
+    { 1, 3, 0, 3423, 30 },
+    { 1, 3, 0, 3426, 30 },
+    { 1, 3, 0, 3429, 30 },
+    { 1, 3, 0, 3432, 30 },
+    { 1, 3, 0, 3435, 30 },
+    { 1, 3, 0, 3438, 30 },
+    { 1, 3, 0, 3441, 30 },
+    { 1, 3, 0, 3444, 30 },
+    { 1, 3, 0, 3447, 30 },
+    { 1, 3, 0, 3450, 30 },
+    { 1, 3, 0, 3453, 30 },
+    { 1, 3, 0, 3456, 30 },
+    { 1, 3, 0, 3459, 30 },
+    { 1, 3, 0, 3462, 30 },
+    { 1, 3, 0, 3465, 30 },
+    { 1, 3, 0, 3468, 30 },
+    { 1, 3, 0, 3471, 30 },
+    { 1, 3, 0, 3474, 30 },
+    { 1, 3, 0, 3477, 30 },
+    { 1, 3, 0, 3480, 30 },
+    { 1, 3, 0, 3483, 30 },
+    { 1, 3, 0, 3486, 30 },
+    { 1, 3, 0, 3489, 30 },
+    { 1, 3, 0, 3492, 30 },
+    { 1, 3, 0, 3495, 30 },
+    { 1, 3, 0, 3498, 30 },
+    { 1, 3, 0, 3501, 30 },
+    { 1, 3, 0, 3504, 30 },
+    { 1, 3, 0, 3507, 30 },
+    { 1, 3, 0, 3510, 30 },
+    { 1, 3, 0, 3513, 30 },
+    { 1, 3, 0, 3516, 30 },
+    { 1, 3, 0, 3519, 30 },
+    { 1, 3, 0, 3522, 30 },
+    { 1, 3, 0, 3525, 30 },
+    { 1, 3, 0, 3528, 30 },
+    { 0, 3, 3, 3531, 3531 },
+    { 0, 3, 3, 3534, 3534 },
+    { 0, 3, 3, 3537, 3537 },
+    { 0, 3, 3, 3540, 3540 },
+    { 0, 3, 3, 3543, 3543 },
+    { 0, 3, 3, 3546, 3546 },
+    { 0, 3, 3, 3549, 3549 },
+    { 0, 3, 3, 3552, 3552 },
+    { 0, 3, 3, 3555, 3555 },
+    { 0, 3, 3, 3558, 3558 },
+    { 0, 3, 3, 3561, 3561 },
+    { 0, 3, 3, 3564, 3564 },
+    { 0, 3, 3, 3567, 3567 },
+    { 0, 3, 3, 3570, 3570 },
+    { 0, 3, 3, 3573, 3573 },
+    { 0, 3, 3, 3576, 3576 },
+    { 0, 3, 3, 3579, 3579 },
+    { 0, 3, 3, 3582, 3582 },
+    { 0, 3, 3, 3585, 3585 },
+    { 0, 3, 3, 3588, 3588 },
+    { 0, 3, 3, 3591, 3591 },
+    { 0, 3, 3, 3594, 3594 },
+    { 0, 3, 3, 3597, 3597 },
+    { 0, 3, 3, 3600, 3600 },
+    { 0, 3, 3, 3603, 3603 },
+    { 0, 3, 3, 3606, 3606 },
+    { 0, 3, 3, 3609, 3609 },
+    { 0, 3, 3, 3612, 3612 },
+    { 0, 3, 3, 3615, 3615 },
+    { 0, 3, 3, 3618, 3618 },
+    { 0, 3, 3, 3621, 3621 },
+    { 0, 3, 3, 3624, 3624 },
+    { 0, 3, 3, 3627, 3627 },
+    { 0, 3, 3, 3630, 3630 },
+    { 0, 3, 3, 3633, 3633 },
+    { 0, 3, 3, 3636, 3636 },
+    { 0, 3, 3, 3639, 3639 },
+    { 0, 3, 3, 3642, 3642 },
+    { 0, 3, 3, 3645, 3645 },
+    { 0, 3, 3, 3648, 3648 },
+    { 0, 3, 3, 3651, 3651 },
+    { 0, 3, 3, 3654, 3654 },
+    { 0, 3, 3, 3657, 3657 },
+    { 0, 3, 3, 3660, 3660 },
+    { 0, 3, 3, 3663, 3663 },
+    { 0, 3, 3, 3666, 3666 },
+    { 1, 3, 0, 3669, 30 },
+    { 1, 3, 0, 3672, 30 },
+    { 1, 3, 0, 3675, 30 },
+    { 1, 3, 0, 3678, 30 },
+    { 1, 3, 0, 3681, 30 },
+    { 1, 3, 0, 3684, 30 },
+    { 1, 3, 0, 3687, 30 },
+    { 1, 3, 0, 3690, 30 },
+    { 1, 3, 0, 3693, 30 },
+    { 1, 3, 0, 3696, 30 },
+    { 1, 3, 0, 3699, 30 },
+    { 1, 3, 0, 3702, 30 },
+    { 1, 3, 0, 3705, 30 },
+    { 1, 3, 0, 3708, 30 },
+    { 1, 3, 0, 3711, 30 },
+    { 1, 3, 0, 3714, 30 },
+    { 1, 3, 0, 3717, 30 },
+    { 1, 3, 0, 3720, 30 },
+    { 1, 3, 0, 3723, 30 },
+    { 1, 3, 0, 3726, 30 },
+    { 1, 3, 0, 3729, 30 },
+    { 1, 3, 0, 3732, 30 },
+    { 1, 3, 0, 3735, 30 },
+    { 1, 3, 0, 3738, 30 },
+    { 1, 3, 0, 3741, 30 },
+    { 1, 3, 0, 3744, 30 },
+    { 1, 3, 0, 3747, 30 },
+    { 0, 2, 2, 3750, 3750 },
+    { 0, 2, 1, 3752, 2 },
+    { 0, 3, 3, 3754, 3754 },
+    { 0, 2, 2, 3757, 3757 },
+    { 0, 3, 3, 3759, 3759 },
+    { 0, 3, 3, 3762, 3762 },
+    { 0, 3, 3, 3765, 3765 },
+    { 0, 3, 3, 3768, 3768 },
+    { 0, 2, 2, 3771, 3771 },
+    { 0, 2, 2, 3773, 3773 },
+    { 0, 2, 2, 3775, 3775 },
+    { 0, 2, 1, 3777, 8 },
+    { 0, 2, 2, 3779, 3779 },
+    { 0, 2, 1, 3781, 10 },
+    { 0, 3, 3, 3783, 3783 },
+    { 0, 2, 2, 3786, 3786 },
+    { 0, 2, 2, 3788, 3788 },
+    { 0, 3, 3, 3790, 3790 },
+    { 0, 2, 1, 3793, 1 },
+    { 0, 2, 2, 3795, 3795 },
+    { 0, 2, 2, 3797, 3797 },
+    { 0, 2, 2, 3799, 3799 },
+    { 0, 2, 1, 3801, 14 },
+    { 0, 2, 2, 3803, 3803 },
+    { 0, 2, 2, 3805, 3805 },
+    { 0, 2, 2, 3807, 3807 },
+    { 0, 3, 1, 3809, 20 },
+    { 0, 2, 2, 3812, 3812 },
+    { 0, 2, 2, 3814, 3814 },
+    { 1, 3, 0, 3816, 30 },
+    { 1, 3, 0, 3819, 30 },
+    { 1, 3, 0, 3822, 30 },
+    { 1, 3, 0, 3825, 30 },
+    { 1, 3, 0, 3828, 30 },
+    { 1, 3, 0, 3831, 30 },
+    { 1, 3, 0, 3834, 30 },
+    { 1, 3, 0, 3837, 30 },
+    { 1, 3, 0, 3840, 30 },
+    { 1, 3, 0, 3843, 30 },
+    { 1, 3, 0, 3846, 30 },
+    { 1, 3, 0, 3849, 30 },
+    { 1, 3, 0, 3852, 30 },
+    { 1, 3, 0, 3855, 30 },
+    { 1, 3, 0, 3858, 30 },
+    { 1, 3, 0, 3861, 30 },
+    { 1, 3, 0, 3864, 30 },
+    { 1, 3, 0, 3867, 30 },
+    { 1, 3, 0, 3870, 30 },
+    { 1, 3, 0, 3873, 30 },
+    { 1, 3, 0, 3876, 30 },
+    { 1, 3, 0, 3879, 30 },
+    { 1, 3, 0, 3882, 30 },
+    { 1, 3, 0, 3885, 30 },
+    { 1, 3, 0, 3888, 30 },
+    { 1, 3, 0, 3891, 30 },
+    { 1, 3, 0, 3894, 30 },
+    { 1, 3, 0, 3897, 30 },
+    { 1, 3, 0, 3900, 30 },
+    { 1, 3, 0, 3903, 30 },
+    { 1, 3, 0, 3906, 30 },
+    { 1, 3, 0, 3909, 30 },
+    { 1, 3, 0, 3912, 30 },
+    { 1, 3, 0, 3915, 30 },
+    { 1, 3, 0, 3918, 30 },
+    { 1, 3, 0, 3921, 30 },
+    { 1, 3, 0, 3924, 30 },
+    { 1, 3, 0, 3927, 30 },
+    { 1, 3, 0, 3930, 30 },
+    { 1, 3, 0, 3933, 30 },
+    { 1, 3, 0, 3936, 30 },
+    { 1, 3, 0, 3939, 30 },
+    { 1, 3, 0, 3942, 30 },
+    { 1, 3, 0, 3945, 30 },
+    { 1, 3, 0, 3948, 30 },
+    { 1, 3, 0, 3951, 30 },
+    { 1, 3, 0, 3954, 30 },
+    { 1, 3, 0, 3957, 30 },
+    { 1, 3, 0, 3960, 30 },
+    { 1, 3, 0, 3963, 30 },
+    { 1, 3, 0, 3966, 30 },
+    { 1, 3, 0, 3969, 30 },
+    { 1, 3, 0, 3972, 30 },
+    { 1, 3, 0, 3975, 30 },
+    { 1, 3, 0, 3978, 30 },
+    { 1, 3, 0, 3981, 30 },
+    { 1, 3, 0, 3984, 30 },
+    { 1, 3, 0, 3987, 30 },
+    { 1, 3, 0, 3990, 30 },
+    { 1, 3, 0, 3993, 30 },
+    { 1, 3, 0, 3996, 30 },
+    { 1, 3, 0, 3999, 30 },
+    { 1, 3, 0, 4002, 30 },
+    { 1, 3, 0, 4005, 30 },
+    { 0, 3, 1, 4008, 2 },
+    { 0, 3, 1, 4011, 3 },
+    { 0, 3, 1, 4014, 3 },
+    { 0, 3, 1, 4017, 3 },
+    { 0, 3, 1, 4020, 4 },
+    { 0, 3, 1, 4023, 5 },
+    { 0, 3, 1, 4026, 5 },
+    { 0, 3, 1, 4029, 5 },
+    { 0, 3, 1, 4032, 5 },
+    { 0, 3, 1, 4035, 5 },
+    { 0, 3, 1, 4038, 6 },
+    { 0, 3, 1, 4041, 6 },
+    { 0, 3, 1, 4044, 6 },
+    { 0, 3, 1, 4047, 6 },
+    { 0, 3, 1, 4050, 6 },
+    { 0, 3, 1, 4053, 7 },
+    { 0, 0, 1, 65535, 7 },
+    { 0, 3, 1, 4056, 8 },
+    { 0, 3, 1, 4059, 9 },
+    { 0, 3, 1, 4062, 9 },
+    { 0, 3, 1, 4065, 9 },
+    { 0, 3, 1, 4068, 9 },
+    { 0, 3, 1, 4071, 9 },
+    { 0, 3, 1, 4074, 10 },
+    { 0, 3, 1, 4077, 10 },
+    { 0, 3, 1, 4080, 12 },
+    { 0, 3, 1, 4083, 12 },
+    { 0, 3, 1, 4086, 12 },
+    { 0, 3, 1, 4089, 1 },
+    { 0, 3, 1, 4092, 1 },
+    { 0, 3, 1, 4095, 1 },
+    { 0, 3, 1, 4098, 1 },
+    { 0, 3, 1, 4101, 13 },
+    { 0, 3, 1, 4104, 13 },
+    { 0, 3, 1, 4107, 13 },
+    { 0, 3, 1, 4110, 14 },
+    { 0, 3, 1, 4113, 14 },
+    { 0, 3, 1, 4116, 14 },
+    { 0, 3, 1, 4119, 14 },
+    { 0, 3, 1, 4122, 0 },
+    { 0, 3, 1, 4125, 0 },
+    { 0, 3, 1, 4128, 0 },
+    { 0, 3, 1, 4131, 0 },
+    { 0, 3, 1, 4134, 15 },
+    { 0, 3, 1, 4137, 15 },
+    { 0, 3, 1, 4140, 17 },
+    { 0, 3, 1, 4143, 17 },
+    { 0, 3, 1, 4146, 17 },
+    { 0, 3, 1, 4149, 17 },
+    { 0, 3, 1, 4152, 18 },
+    { 0, 3, 1, 4155, 18 },
+    { 0, 3, 1, 4158, 18 },
+    { 0, 3, 1, 4161, 18 },
+    { 0, 3, 1, 4164, 18 },
+    { 0, 3, 1, 4167, 19 },
+    { 0, 3, 1, 4170, 19 },
+    { 0, 3, 1, 4173, 19 },
+    { 0, 3, 1, 4176, 19 },
+    { 0, 3, 1, 4179, 20 },
+    { 0, 3, 1, 4182, 20 },
+    { 0, 3, 1, 4185, 20 },
+    { 0, 3, 1, 4188, 20 },
+    { 0, 3, 1, 4191, 20 },
+    { 0, 3, 1, 4194, 21 },
+    { 0, 3, 1, 4197, 21 },
+    { 0, 3, 1, 4200, 22 },
+    { 0, 3, 1, 4203, 22 },
+    { 0, 3, 1, 4206, 22 },
+    { 0, 3, 1, 4209, 22 },
+    { 0, 3, 1, 4212, 22 },
+    { 0, 3, 1, 4215, 23 },
+    { 0, 3, 1, 4218, 23 },
+    { 0, 3, 1, 4221, 24 },
+    { 0, 3, 1, 4224, 25 },
+    { 0, 3, 1, 4227, 25 },
+    { 0, 3, 1, 4230, 25 },
+    { 0, 3, 3, 4233, 4233 },
+    { 0, 3, 1, 4236, 2 },
+    { 0, 3, 1, 4239, 2 },
+    { 0, 3, 1, 4242, 2 },
+    { 0, 3, 1, 4245, 2 },
+    { 0, 3, 1, 4248, 2 },
+    { 0, 3, 1, 4251, 2 },
+    { 0, 3, 1, 4254, 2 },
+    { 0, 3, 1, 4257, 2 },
+    { 0, 3, 1, 4260, 2 },
+    { 0, 3, 1, 4263, 2 },
+    { 0, 3, 1, 4266, 2 },
+    { 0, 3, 1, 4269, 2 },
+    { 0, 3, 1, 4272, 6 },
+    { 0, 3, 1, 4275, 6 },
+    { 0, 3, 1, 4278, 6 },
+    { 0, 3, 1, 4281, 6 },
+    { 0, 3, 1, 4284, 6 },
+    { 0, 3, 1, 4287, 6 },
+    { 0, 3, 1, 4290, 6 },
+    { 0, 3, 1, 4293, 6 },
+    { 0, 3, 1, 4296, 10 },
+    { 0, 3, 1, 4299, 10 },
+    { 0, 3, 1, 4302, 0 },
+    { 0, 3, 1, 4305, 0 },
+    { 0, 3, 1, 4308, 0 },
+    { 0, 3, 1, 4311, 0 },
+    { 0, 3, 1, 4314, 0 },
+    { 0, 3, 1, 4317, 0 },
+    { 0, 3, 1, 4320, 0 },
+    { 0, 3, 1, 4323, 0 },
+    { 0, 3, 1, 4326, 0 },
+    { 0, 3, 1, 4329, 0 },
+    { 0, 3, 1, 4332, 0 },
+    { 0, 3, 1, 4335, 0 },
+    { 0, 3, 1, 4338, 20 },
+    { 0, 3, 1, 4341, 20 },
+    { 0, 3, 1, 4344, 20 },
+    { 0, 3, 1, 4347, 20 },
+    { 0, 3, 1, 4350, 20 },
+    { 0, 3, 1, 4353, 20 },
+    { 0, 3, 1, 4356, 20 },
+    { 0, 3, 1, 4359, 24 },
+    { 0, 3, 1, 4362, 24 },
+    { 0, 3, 1, 4365, 24 },
+    { 0, 3, 1, 4368, 24 },
+    { 0, 3, 3, 4371, 4371 },
+    { 0, 3, 3, 4374, 4374 },
+    { 0, 3, 3, 4377, 4377 },
+    { 0, 3, 1, 4380, 2 },
+    { 0, 3, 1, 4383, 2 },
+    { 0, 3, 1, 4386, 2 },
+    { 0, 3, 1, 4389, 2 },
+    { 0, 3, 1, 4392, 2 },
+    { 0, 3, 1, 4395, 2 },
+    { 0, 3, 1, 4398, 2 },
+    { 0, 3, 1, 4401, 2 },
+    { 0, 3, 1, 4404, 6 },
+    { 0, 3, 1, 4407, 6 },
+    { 0, 3, 1, 4410, 6 },
+    { 0, 3, 1, 4413, 6 },
+    { 0, 3, 1, 4416, 6 },
+    { 0, 3, 1, 4419, 6 },
+    { 0, 3, 2, 4422, 746 },
+    { 0, 3, 2, 4425, 746 },
+    { 0, 3, 2, 4428, 746 },
+    { 0, 3, 2, 4431, 746 },
+    { 0, 3, 2, 4434, 746 },
+    { 0, 3, 2, 4437, 746 },
+    { 0, 3, 2, 4440, 746 },
+    { 0, 3, 2, 4443, 746 },
+    { 0, 3, 1, 4446, 10 },
+    { 0, 3, 1, 4449, 10 },
+    { 0, 3, 1, 4452, 10 },
+    { 0, 3, 1, 4455, 10 },
+    { 0, 3, 1, 4458, 10 },
+    { 0, 3, 1, 4461, 10 },
+    { 0, 3, 1, 4464, 10 },
+    { 0, 3, 1, 4467, 10 },
+    { 0, 3, 1, 4470, 0 },
+    { 0, 3, 1, 4473, 0 },
+    { 0, 3, 1, 4476, 0 },
+    { 0, 3, 1, 4479, 0 },
+    { 0, 3, 1, 4482, 0 },
+    { 0, 3, 1, 4485, 0 },
+    { 0, 3, 1, 4488, 20 },
+    { 0, 3, 1, 4491, 20 },
+    { 0, 3, 1, 4494, 20 },
+    { 0, 3, 1, 4497, 20 },
+    { 0, 3, 1, 4500, 22 },
+    { 0, 3, 1, 4503, 22 },
+    { 0, 3, 1, 4506, 22 },
+    { 0, 3, 1, 4509, 22 },
+    { 0, 3, 1, 4512, 22 },
+    { 0, 3, 1, 4515, 22 },
+    { 0, 3, 1, 4518, 22 },
+    { 0, 3, 1, 4521, 22 },
+    { 0, 5, 2, 4524, 4529 },
+    { 0, 5, 2, 4531, 4529 },
+    { 0, 5, 2, 4536, 4529 },
+    { 0, 5, 2, 4541, 4529 },
+    { 0, 5, 2, 4546, 4529 },
+    { 0, 5, 2, 4551, 4529 },
+    { 0, 5, 2, 4556, 4529 },
+    { 0, 5, 2, 4561, 4529 },
+    { 0, 5, 3, 4566, 4571 },
+    { 0, 5, 3, 4574, 4571 },
+    { 0, 5, 3, 4579, 4571 },
+    { 0, 5, 3, 4584, 4571 },
+    { 0, 5, 3, 4589, 4571 },
+    { 0, 5, 3, 4594, 4571 },
+    { 0, 5, 3, 4599, 4571 },
+    { 0, 5, 3, 4604, 4571 },
+    { 0, 5, 2, 4609, 4614 },
+    { 0, 5, 2, 4616, 4614 },
+    { 0, 5, 2, 4621, 4614 },
+    { 0, 5, 2, 4626, 4614 },
+    { 0, 5, 2, 4631, 4614 },
+    { 0, 5, 2, 4636, 4614 },
+    { 0, 5, 2, 4641, 4614 },
+    { 0, 5, 2, 4646, 4614 },
+    { 0, 5, 2, 4651, 4529 },
+    { 0, 4, 2, 4656, 4529 },
+    { 0, 4, 2, 4660, 4529 },
+    { 0, 5, 2, 4664, 4529 },
+    { 0, 3, 1, 4669, 2 },
+    { 0, 3, 1, 4672, 2 },
+    { 0, 3, 1, 4675, 2 },
+    { 0, 3, 1, 4678, 26 },
+    { 0, 3, 1, 4681, 26 },
+    { 0, 5, 1, 4684, 26 },
+    { 0, 5, 3, 4689, 4571 },
+    { 0, 4, 3, 4694, 4571 },
+    { 0, 4, 3, 4698, 4571 },
+    { 0, 5, 3, 4702, 4571 },
+    { 0, 3, 1, 4707, 6 },
+    { 0, 3, 2, 4710, 746 },
+    { 0, 5, 1, 4713, 26 },
+    { 0, 5, 1, 4718, 26 },
+    { 0, 5, 1, 4723, 26 },
+    { 0, 2, 1, 4728, 10 },
+    { 0, 3, 1, 4730, 10 },
+    { 0, 3, 1, 4733, 10 },
+    { 0, 3, 1, 4736, 10 },
+    { 0, 5, 1, 4739, 26 },
+    { 0, 5, 1, 4744, 26 },
+    { 0, 5, 1, 4749, 26 },
+    { 0, 2, 1, 4754, 20 },
+    { 0, 3, 1, 4756, 20 },
+    { 0, 3, 1, 4759, 20 },
+    { 0, 3, 1, 4762, 20 },
+    { 0, 3, 1, 4765, 15 },
+    { 0, 5, 1, 4768, 26 },
+    { 0, 1, 1, 4773, 4773 },
+    { 0, 5, 2, 4774, 4614 },
+    { 0, 4, 2, 4779, 4614 },
+    { 0, 4, 2, 4783, 4614 },
+    { 0, 5, 2, 4787, 4614 },
+    { 0, 3, 1, 4792, 0 },
+    { 0, 3, 1, 4795, 22 },
+    { 0, 3, 1, 4798, 26 },
+    { 0, 3, 3, 4801, 4801 },
+    { 0, 3, 1, 4804, 26 },
+    { 0, 1, 1, 4807, 4807 },
+    { 0, 2, 2, 4808, 4808 },
+    { 0, 3, 3, 4810, 4810 },
+    { 0, 6, 6, 4813, 4813 },
+    { 0, 9, 9, 4819, 4819 },
+    { 0, 6, 6, 4828, 4828 },
+    { 0, 9, 9, 4834, 4834 },
+    { 0, 2, 2, 4843, 4843 },
+    { 0, 3, 1, 4845, 26 },
+    { 0, 2, 2, 4848, 4848 },
+    { 0, 2, 2, 4850, 4850 },
+    { 0, 2, 2, 4852, 4852 },
+    { 0, 12, 12, 4854, 4854 },
+    { 0, 1, 1, 4866, 0 },
+    { 0, 1, 1, 4867, 4867 },
+    { 0, 1, 1, 4868, 4868 },
+    { 0, 1, 1, 4869, 4869 },
+    { 0, 1, 1, 4870, 4870 },
+    { 0, 1, 1, 4871, 4871 },
+    { 0, 1, 1, 4872, 4872 },
+    { 0, 1, 1, 4873, 4873 },
+    { 0, 3, 3, 4874, 4874 },
+    { 0, 1, 1, 4877, 4877 },
+    { 0, 1, 1, 4878, 4878 },
+    { 0, 1, 1, 4879, 4879 },
+    { 0, 2, 2, 4880, 4880 },
+    { 1, 3, 0, 4882, 30 },
+    { 1, 3, 0, 4885, 30 },
+    { 1, 3, 0, 4888, 30 },
+    { 1, 3, 0, 4891, 30 },
+    { 1, 3, 0, 4894, 30 },
+    { 1, 3, 0, 4897, 30 },
+    { 1, 3, 0, 4900, 30 },
+    { 1, 3, 0, 4903, 30 },
+    { 1, 3, 0, 4906, 30 },
+    { 1, 3, 0, 4909, 30 },
+    { 1, 3, 0, 4912, 30 },
+    { 1, 3, 0, 4915, 30 },
+    { 1, 3, 0, 4918, 30 },
+    { 1, 3, 0, 4921, 30 },
+    { 1, 3, 0, 4924, 30 },
+    { 1, 3, 0, 4927, 30 },
+    { 1, 3, 0, 4930, 30 },
+    { 1, 3, 0, 4933, 30 },
+    { 1, 3, 0, 4936, 30 },
+    { 1, 3, 0, 4939, 30 },
+    { 1, 3, 0, 4942, 30 },
+    { 1, 3, 0, 4945, 30 },
+    { 1, 3, 0, 4948, 30 },
+    { 1, 3, 0, 4951, 30 },
+    { 1, 3, 0, 4954, 30 },
+    { 1, 3, 0, 4957, 30 },
+    { 1, 3, 0, 4960, 30 },
+    { 1, 3, 0, 4963, 30 },
+    { 1, 3, 0, 4966, 30 },
+    { 1, 3, 0, 4969, 30 },
+    { 1, 3, 0, 4972, 30 },
+    { 1, 3, 0, 4975, 30 },
+    { 1, 3, 0, 4978, 30 },
+    { 0, 3, 3, 4981, 4981 },
+    { 0, 3, 3, 4984, 4984 },
+    { 0, 3, 3, 4987, 4987 },
+    { 0, 3, 3, 4990, 4990 },
+    { 0, 3, 3, 4993, 4993 },
+    { 0, 3, 3, 4996, 4996 },
+    { 0, 2, 2, 4999, 4999 },
+    { 0, 2, 2, 5001, 5001 },
+    { 0, 3, 3, 5003, 5003 },
+    { 0, 2, 2, 5006, 5006 },
+    { 0, 3, 3, 5008, 5008 },
+    { 0, 2, 2, 5011, 5011 },
+    { 0, 2, 2, 5013, 5013 },
+    { 0, 2, 2, 5015, 5015 },
+    { 0, 2, 2, 5017, 5017 },
+    { 0, 3, 3, 5019, 5019 },
+    { 0, 3, 3, 5022, 5022 },
+    { 0, 5, 5, 5025, 5030 },
+    { 0, 5, 5, 5035, 5040 },
+    { 0, 6, 6, 5045, 5051 },
+    { 0, 5, 5, 5057, 5062 },
+    { 0, 5, 5, 5067, 5067 },
+    { 0, 5, 5, 5072, 5077 },
+    { 0, 5, 5, 5082, 5082 },
+    { 0, 5, 5, 5087, 5087 },
+    { 0, 5, 5, 5092, 5092 },
+    { 0, 5, 5, 5097, 5102 },
+    { 0, 5, 5, 5107, 5107 },
+    { 0, 5, 5, 5112, 5117 },
+    { 0, 5, 5, 5122, 5122 },
+    { 0, 5, 5, 5127, 5127 },
+    { 0, 5, 5, 5132, 5132 },
+    { 0, 4, 4, 5137, 5141 },
+    { 0, 2, 2, 5145, 5145 },
+    { 0, 3, 3, 5147, 5147 },
+    { 0, 2, 2, 5150, 5150 },
+    { 0, 2, 2, 5152, 5152 },
+    { 0, 3, 3, 5154, 5154 },
+    { 0, 4, 4, 5157, 5157 },
+    { 0, 2, 2, 5161, 5161 },
+    { 0, 2, 2, 5163, 5163 },
+    { 0, 3, 3, 5165, 5165 },
+    { 0, 3, 3, 5168, 5168 },
+    { 0, 5, 5, 5171, 5176 },
+    { 0, 0, 3, 65535, 5181 },
+    { 0, 0, 3, 65535, 5184 },
+    { 0, 0, 3, 65535, 5187 },
+    { 0, 0, 3, 65535, 5190 },
+    { 0, 0, 3, 65535, 5193 },
+    { 0, 0, 3, 65535, 5196 },
+    { 0, 0, 3, 65535, 5199 },
+    { 0, 0, 3, 65535, 5202 },
+    { 0, 0, 3, 65535, 5205 },
+    { 0, 0, 3, 65535, 5208 },
+    { 0, 0, 3, 65535, 5211 },
+    { 0, 6, 6, 5214, 5214 },
+    { 0, 9, 9, 5220, 5220 },
+    { 0, 6, 6, 5229, 5229 },
+    { 0, 9, 9, 5235, 5235 },
+    { 0, 0, 3, 65535, 5244 },
+    { 0, 0, 3, 65535, 5247 },
+    { 0, 0, 3, 65535, 5250 },
+    { 0, 0, 3, 65535, 5253 },
+    { 0, 0, 1, 65535, 4877 },
+    { 0, 0, 3, 65535, 5256 },
+    { 0, 0, 3, 65535, 5259 },
+    { 0, 0, 1, 65535, 5262 },
+    { 0, 0, 1, 65535, 5263 },
+    { 0, 0, 3, 65535, 5264 },
+    { 0, 0, 3, 65535, 5267 },
+    { 0, 0, 3, 65535, 5270 },
+    { 0, 0, 3, 65535, 5273 },
+    { 0, 0, 3, 65535, 5276 },
+    { 0, 0, 3, 65535, 5279 },
+    { 0, 0, 3, 65535, 5282 },
+    { 0, 0, 3, 65535, 5285 },
+    { 0, 0, 3, 65535, 5288 },
+    { 0, 0, 3, 65535, 5291 },
+    { 0, 0, 3, 65535, 5294 },
+    { 0, 0, 3, 65535, 5297 },
+    { 0, 0, 3, 65535, 5300 },
+    { 0, 0, 3, 65535, 5303 },
+    { 0, 0, 3, 65535, 5306 },
+    { 0, 0, 3, 65535, 5309 },
+    { 0, 0, 3, 65535, 5312 },
+    { 0, 0, 3, 65535, 5315 },
+    { 0, 0, 3, 65535, 5318 },
+    { 0, 0, 3, 65535, 5321 },
+    { 0, 0, 3, 65535, 5324 },
+    { 0, 0, 3, 65535, 5327 },
+    { 0, 0, 3, 65535, 5330 },
+    { 0, 0, 3, 65535, 5333 },
+    { 0, 3, 3, 5336, 5336 },
+    { 0, 3, 3, 5339, 5339 },
+    { 0, 2, 2, 5342, 5344 },
+    { 0, 2, 2, 5346, 5348 },
+    { 0, 2, 2, 5350, 5352 },
+    { 0, 2, 2, 5354, 5356 },
+    { 0, 2, 2, 5358, 5360 },
+    { 0, 2, 2, 5362, 5364 },
+    { 0, 2, 2, 5366, 5368 },
+    { 0, 2, 2, 5370, 5372 },
+    { 0, 2, 2, 5374, 5376 },
+    { 0, 2, 2, 5378, 5380 },
+    { 0, 2, 2, 5382, 5384 },
+    { 0, 3, 3, 5386, 5389 },
+    { 0, 3, 3, 5392, 5392 },
+    { 0, 3, 3, 5395, 5395 },
+    { 0, 3, 3, 5398, 5398 },
+    { 0, 3, 3, 5401, 5401 },
+    { 0, 3, 3, 5404, 5404 },
+    { 0, 3, 3, 5407, 5407 },
+    { 0, 3, 3, 5410, 5410 },
+    { 0, 3, 3, 5413, 5413 },
+    { 0, 4, 4, 5416, 5420 },
+    { 0, 4, 4, 5424, 5428 },
+    { 0, 4, 4, 5432, 5436 },
+    { 0, 4, 4, 5440, 5444 },
+    { 0, 4, 4, 5448, 5452 },
+    { 0, 4, 4, 5456, 5460 },
+    { 0, 4, 4, 5464, 5468 },
+    { 0, 4, 4, 5472, 5476 },
+    { 0, 4, 4, 5480, 5484 },
+    { 0, 4, 4, 5488, 5492 },
+    { 0, 4, 4, 5496, 5500 },
+    { 0, 2, 2, 5504, 5506 },
+    { 0, 2, 2, 5508, 5508 },
+    { 0, 2, 2, 5510, 5510 },
+    { 0, 2, 2, 5512, 5512 },
+    { 0, 2, 2, 5514, 5514 },
+    { 0, 2, 2, 5516, 5516 },
+    { 0, 2, 2, 5518, 5518 },
+    { 0, 2, 2, 5520, 5520 },
+    { 0, 2, 2, 5522, 5522 },
+    { 0, 3, 3, 5524, 5527 },
+    { 0, 3, 3, 5530, 5533 },
+    { 0, 3, 3, 5536, 5539 },
+    { 0, 3, 3, 5542, 5545 },
+    { 0, 3, 3, 5548, 5551 },
+    { 0, 3, 3, 5554, 5557 },
+    { 0, 3, 3, 5560, 5563 },
+    { 0, 3, 3, 5566, 5569 },
+    { 0, 3, 3, 5572, 5575 },
+    { 0, 3, 3, 5578, 5581 },
+    { 0, 3, 3, 5584, 5587 },
+    { 0, 3, 3, 5590, 5590 },
+    { 0, 3, 3, 5593, 5593 },
+    { 0, 3, 3, 5596, 5596 },
+    { 0, 3, 3, 5599, 5599 },
+    { 0, 3, 3, 5602, 5602 },
+    { 0, 3, 3, 5605, 5605 },
+    { 0, 3, 3, 5608, 5608 },
+    { 0, 3, 3, 5611, 5611 },
+    { 0, 3, 3, 5614, 5614 },
+    { 0, 3, 3, 5617, 5617 },
+    { 0, 3, 3, 5620, 5620 },
+    { 0, 3, 3, 5389, 5389 },
+    { 0, 3, 3, 5623, 5623 },
+    { 0, 3, 3, 5626, 5626 },
+    { 0, 3, 3, 5629, 5629 },
+    { 0, 3, 3, 5632, 5632 },
+    { 0, 3, 3, 5635, 5635 },
+    { 0, 3, 3, 5638, 5638 },
+    { 0, 3, 3, 5641, 5641 },
+    { 0, 3, 3, 5644, 5644 },
+    { 0, 3, 3, 5647, 5647 },
+    { 0, 3, 3, 5650, 5650 },
+    { 0, 3, 3, 5653, 5653 },
+    { 0, 3, 3, 5656, 5656 },
+    { 0, 3, 3, 5659, 5659 },
+    { 0, 3, 3, 5662, 5662 },
+    { 0, 12, 12, 5665, 5665 },
+    { 0, 3, 3, 5677, 5677 },
+    { 0, 2, 2, 5680, 5680 },
+    { 0, 3, 3, 5682, 5682 },
+    { 0, 5, 3, 5685, 5690 },
+    { 0, 3, 3, 5693, 5693 },
+    { 0, 3, 3, 5696, 5696 },
+    { 0, 3, 3, 5699, 5699 },
+    { 0, 3, 3, 5702, 5702 },
+    { 0, 3, 3, 5705, 5705 },
+    { 0, 3, 3, 5708, 5708 },
+    { 0, 3, 3, 5711, 5711 },
+    { 0, 3, 3, 5714, 5714 },
+    { 0, 3, 3, 5717, 5717 },
+    { 0, 3, 3, 5720, 5720 },
+    { 0, 3, 3, 5723, 5723 },
+    { 0, 3, 3, 5726, 5726 },
+    { 0, 3, 3, 5729, 5729 },
+    { 0, 3, 3, 5732, 5732 },
+    { 0, 3, 3, 5735, 5735 },
+    { 0, 3, 3, 5738, 5738 },
+    { 0, 3, 3, 5741, 5741 },
+    { 0, 3, 3, 5744, 5744 },
+    { 0, 3, 3, 5747, 5747 },
+    { 0, 3, 3, 5750, 5750 },
+    { 0, 3, 3, 5753, 5753 },
+    { 0, 3, 3, 5756, 5756 },
+    { 0, 3, 3, 5759, 5759 },
+    { 0, 3, 3, 5762, 5762 },
+    { 0, 3, 3, 5765, 5765 },
+    { 0, 3, 3, 5768, 5768 },
+    { 0, 3, 3, 5771, 5771 },
+    { 0, 3, 3, 5774, 5774 },
+    { 0, 3, 3, 5777, 5777 },
+    { 0, 3, 3, 5780, 5780 },
+    { 0, 3, 3, 5783, 5783 },
+    { 0, 3, 3, 5786, 5786 },
+    { 0, 3, 3, 5789, 5789 },
+    { 0, 3, 3, 5792, 5792 },
+    { 0, 3, 3, 5795, 5795 },
+    { 0, 3, 3, 5798, 5798 },
+    { 0, 3, 3, 5801, 5801 },
+    { 0, 3, 3, 5804, 5804 },
+    { 0, 3, 3, 5807, 5807 },
+    { 0, 3, 3, 5810, 5810 },
+    { 0, 3, 3, 5813, 5813 },
+    { 0, 3, 3, 5816, 5816 },
+    { 0, 3, 3, 5819, 5819 },
+    { 0, 3, 3, 5822, 5822 },
+    { 0, 3, 3, 5825, 5825 },
+    { 0, 3, 3, 5828, 5828 },
+    { 0, 3, 3, 5831, 5831 },
+    { 0, 3, 3, 5834, 5834 },
+    { 0, 3, 3, 5837, 5837 },
+    { 0, 2, 2, 5840, 5840 },
+    { 0, 3, 3, 5842, 5842 },
+    { 0, 2, 2, 5845, 5845 },
+    { 0, 3, 3, 5847, 5847 },
+    { 0, 3, 3, 5850, 5850 },
+    { 0, 3, 3, 5853, 5853 },
+    { 0, 3, 3, 5856, 5856 },
+    { 0, 3, 3, 5859, 5859 },
+    { 0, 2, 2, 5862, 5862 },
+    { 0, 2, 2, 5864, 5864 },
+    { 0, 3, 3, 5866, 5866 },
+    { 0, 3, 3, 5869, 5869 },
+    { 0, 3, 3, 5872, 5872 },
+    { 0, 3, 3, 5875, 5875 },
+    { 0, 3, 3, 5878, 5878 },
+    { 0, 3, 3, 5881, 5881 },
+    { 0, 3, 3, 5884, 5884 },
+    { 0, 3, 3, 5887, 5887 },
+    { 0, 3, 3, 5890, 5890 },
+    { 0, 3, 3, 5893, 5893 },
+    { 0, 3, 3, 5896, 5896 },
+    { 0, 3, 3, 5899, 5899 },
+    { 0, 3, 3, 5902, 5902 },
+    { 0, 3, 3, 5905, 5905 },
+    { 0, 3, 3, 5908, 5908 },
+    { 0, 3, 3, 5911, 5911 },
+    { 0, 3, 3, 5914, 5914 },
+    { 0, 3, 3, 5917, 5917 },
+    { 0, 3, 3, 5920, 5920 },
+    { 0, 3, 3, 5923, 5923 },
+    { 0, 3, 3, 5926, 5926 },
+    { 0, 3, 3, 5929, 5929 },
+    { 0, 3, 3, 5932, 5932 },
+    { 0, 3, 3, 5935, 5935 },
+    { 0, 3, 3, 5938, 5938 },
+    { 0, 3, 3, 5941, 5941 },
+    { 0, 3, 3, 5944, 5944 },
+    { 0, 3, 3, 5947, 5947 },
+    { 0, 3, 3, 5950, 5950 },
+    { 0, 3, 3, 5953, 5953 },
+    { 0, 3, 3, 5956, 5956 },
+    { 0, 3, 3, 5959, 5959 },
+    { 0, 3, 3, 5962, 5962 },
+    { 0, 3, 3, 5965, 5965 },
+    { 0, 3, 3, 5968, 5968 },
+    { 0, 3, 3, 5971, 5971 },
+    { 0, 3, 3, 5974, 5974 },
+    { 0, 3, 3, 5977, 5977 },
+    { 0, 3, 3, 5980, 5980 },
+    { 0, 3, 3, 5983, 5983 },
+    { 0, 3, 3, 5986, 5986 },
+    { 0, 3, 3, 5989, 5989 },
+    { 0, 3, 3, 5992, 5992 },
+    { 0, 3, 3, 5995, 5995 },
+    { 0, 3, 3, 5998, 5998 },
+    { 0, 3, 3, 6001, 6001 },
+    { 0, 3, 3, 6004, 6004 },
+    { 0, 3, 3, 6007, 6007 },
+    { 0, 3, 3, 6010, 6010 },
+    { 0, 3, 3, 6013, 6013 },
+    { 0, 3, 3, 6016, 6016 },
+    { 0, 3, 3, 6019, 6019 },
+    { 1, 3, 0, 6022, 30 },
+    { 1, 3, 0, 6025, 30 },
+    { 1, 3, 0, 6028, 30 },
+    { 0, 3, 3, 6031, 6031 },
+    { 0, 3, 3, 6034, 6034 },
+    { 1, 3, 0, 6037, 30 },
+    { 1, 3, 0, 6040, 30 },
+    { 1, 3, 0, 6043, 30 },
+    { 1, 3, 0, 6046, 30 },
+    { 1, 3, 0, 6049, 30 },
+    { 1, 3, 0, 6052, 30 },
+    { 1, 3, 0, 6055, 30 },
+    { 1, 3, 0, 6058, 30 },
+    { 1, 3, 0, 6061, 30 },
+    { 1, 3, 0, 6064, 30 },
+    { 1, 3, 0, 6067, 30 },
+    { 1, 3, 0, 6070, 30 },
+    { 1, 3, 0, 6073, 30 },
+    { 1, 3, 0, 6076, 30 },
+    { 1, 3, 0, 6079, 30 },
+    { 1, 3, 0, 6082, 30 },
+    { 1, 3, 0, 6085, 30 },
+    { 1, 3, 0, 6088, 30 },
+    { 1, 3, 0, 6091, 30 },
+    { 1, 3, 0, 6094, 30 },
+    { 1, 3, 0, 6097, 30 },
+    { 1, 3, 0, 6100, 30 },
+    { 1, 3, 0, 6103, 30 },
+    { 1, 3, 0, 6106, 30 },
+    { 1, 3, 0, 6109, 30 },
+    { 1, 3, 0, 6112, 30 },
+    { 1, 3, 0, 6115, 30 },
+    { 1, 3, 0, 6118, 30 },
+    { 1, 3, 0, 6121, 30 },
+    { 1, 3, 0, 6124, 30 },
+    { 1, 3, 0, 6127, 30 },
+    { 1, 3, 0, 6130, 30 },
+    { 1, 3, 0, 6133, 30 },
+    { 0, 3, 3, 6136, 6136 },
+    { 0, 3, 3, 6139, 6139 },
+    { 0, 3, 3, 6142, 6142 },
+    { 0, 3, 3, 6145, 6145 },
+    { 0, 3, 3, 6148, 6148 },
+    { 0, 3, 3, 6151, 6151 },
+    { 0, 3, 3, 6154, 6154 },
+    { 0, 3, 3, 6157, 6157 },
+    { 0, 3, 3, 6160, 6160 },
+    { 0, 3, 3, 6163, 6163 },
+    { 0, 3, 3, 6166, 6166 },
+    { 0, 3, 3, 6169, 6169 },
+    { 0, 3, 3, 6172, 6172 },
+    { 0, 3, 3, 6175, 6175 },
+    { 0, 3, 3, 6178, 6178 },
+    { 0, 3, 3, 6181, 6181 },
+    { 0, 3, 3, 6184, 6184 },
+    { 0, 3, 3, 6187, 6187 },
+    { 0, 3, 3, 6190, 6190 },
+    { 0, 3, 3, 6193, 6193 },
+    { 0, 3, 3, 6196, 6196 },
+    { 0, 3, 3, 6199, 6199 },
+    { 0, 3, 3, 6202, 6202 },
+    { 0, 3, 3, 6205, 6205 },
+    { 0, 3, 3, 6208, 6208 },
+    { 0, 3, 3, 6211, 6211 },
+    { 0, 3, 3, 6214, 6214 },
+    { 0, 3, 3, 6217, 6217 },
+    { 0, 3, 3, 6220, 6220 },
+    { 0, 3, 3, 6223, 6223 },
+    { 0, 3, 3, 6226, 6226 },
+    { 0, 3, 3, 6229, 6229 },
+    { 0, 3, 3, 6232, 6232 },
+    { 0, 3, 3, 6235, 6235 },
+    { 0, 3, 3, 6238, 6238 },
+    { 0, 3, 3, 6241, 6241 },
+    { 0, 3, 3, 6244, 6244 },
+    { 0, 3, 3, 6247, 6247 },
+    { 0, 3, 3, 6250, 6250 },
+    { 0, 3, 3, 6253, 6253 },
+    { 0, 3, 3, 6256, 6256 },
+    { 0, 3, 3, 6259, 6259 },
+    { 0, 3, 3, 6262, 6262 },
+    { 0, 3, 3, 6265, 6265 },
+    { 0, 3, 3, 6268, 6268 },
+    { 0, 3, 3, 6271, 6271 },
+    { 0, 3, 3, 6274, 6274 },
+    { 0, 3, 3, 6277, 6277 },
+    { 0, 3, 3, 6280, 6280 },
+    { 0, 3, 3, 6283, 6283 },
+    { 0, 3, 3, 6286, 6286 },
+    { 0, 3, 3, 6289, 6289 },
+    { 0, 3, 3, 6292, 6292 },
+    { 0, 3, 3, 6295, 6295 },
+    { 0, 3, 3, 6298, 6298 },
+    { 0, 3, 3, 6301, 6301 },
+    { 0, 3, 3, 6304, 6304 },
+    { 0, 3, 3, 6307, 6307 },
+    { 0, 3, 3, 6310, 6310 },
+    { 0, 3, 3, 6313, 6313 },
+    { 0, 3, 3, 6316, 6316 },
+    { 0, 3, 3, 6319, 6319 },
+    { 0, 3, 3, 6322, 6322 },
+    { 0, 3, 3, 6325, 6325 },
+    { 0, 3, 3, 6328, 6328 },
+    { 0, 3, 3, 6331, 6331 },
+    { 0, 3, 3, 6334, 6334 },
+    { 0, 3, 3, 6337, 6337 },
+    { 0, 3, 3, 6340, 6340 },
+    { 0, 3, 3, 6343, 6343 },
+    { 0, 3, 3, 6346, 6346 },
+    { 0, 3, 3, 6349, 6349 },
+    { 0, 3, 3, 6352, 6352 },
+    { 0, 3, 3, 6355, 6355 },
+    { 0, 3, 3, 6358, 6358 },
+    { 0, 3, 3, 6361, 6361 },
+    { 0, 3, 3, 6364, 6364 },
+    { 0, 3, 3, 6367, 6367 },
+    { 0, 3, 3, 6370, 6370 },
+    { 0, 3, 3, 6373, 6373 },
+    { 0, 3, 3, 6376, 6376 },
+    { 0, 3, 3, 6379, 6379 },
+    { 0, 3, 3, 6382, 6382 },
+    { 0, 3, 3, 6385, 6385 },
+    { 0, 3, 3, 6388, 6388 },
+    { 0, 3, 3, 6391, 6391 },
+    { 0, 3, 3, 6394, 6394 },
+    { 0, 3, 3, 6397, 6397 },
+    { 0, 3, 3, 6400, 6400 },
+    { 0, 3, 3, 6403, 6403 },
+    { 0, 3, 3, 6406, 6406 },
+    { 0, 3, 3, 6409, 6409 },
+    { 0, 3, 3, 6412, 6412 },
+    { 0, 3, 3, 6415, 6415 },
+    { 0, 3, 3, 6418, 6418 },
+    { 0, 3, 3, 6421, 6421 },
+    { 0, 3, 3, 6424, 6424 },
+    { 0, 3, 3, 6427, 6427 },
+    { 0, 3, 3, 6430, 6430 },
+    { 0, 3, 3, 6433, 6433 },
+    { 0, 3, 3, 6436, 6436 },
+    { 0, 3, 3, 6439, 6439 },
+    { 0, 3, 3, 6442, 6442 },
+    { 0, 3, 3, 6445, 6445 },
+    { 0, 3, 3, 6448, 6448 },
+    { 0, 3, 3, 6451, 6451 },
+    { 0, 3, 3, 6454, 6454 },
+    { 0, 3, 3, 6457, 6457 },
+    { 0, 3, 3, 6460, 6460 },
+    { 0, 3, 3, 6463, 6463 },
+    { 0, 3, 3, 6466, 6466 },
+    { 0, 3, 3, 6469, 6469 },
+    { 0, 3, 3, 6472, 6472 },
+    { 0, 3, 3, 6475, 6475 },
+    { 0, 3, 3, 6478, 6478 },
+    { 0, 3, 3, 6481, 6481 },
+    { 0, 3, 3, 6484, 6484 },
+    { 0, 3, 3, 6487, 6487 },
+    { 0, 3, 3, 6490, 6490 },
+    { 0, 3, 3, 6493, 6493 },
+    { 0, 3, 3, 6496, 6496 },
+    { 0, 3, 3, 6499, 6499 },
+    { 0, 3, 3, 6502, 6502 },
+    { 0, 3, 3, 6505, 6505 },
+    { 0, 3, 3, 6508, 6508 },
+    { 0, 3, 3, 6511, 6511 },
+    { 0, 3, 3, 6514, 6514 },
+    { 0, 3, 3, 6517, 6517 },
+    { 0, 3, 3, 6520, 6520 },
+    { 0, 3, 3, 6523, 6523 },
+    { 0, 3, 3, 6526, 6526 },
+    { 0, 3, 3, 6529, 6529 },
+    { 0, 3, 3, 6532, 6532 },
+    { 0, 3, 3, 6535, 6535 },
+    { 0, 3, 3, 6538, 6538 },
+    { 0, 3, 3, 6541, 6541 },
+    { 0, 3, 3, 6544, 6544 },
+    { 0, 3, 3, 6547, 6547 },
+    { 0, 3, 3, 6550, 6550 },
+    { 0, 3, 3, 6553, 6553 },
+    { 0, 3, 3, 6556, 6556 },
+    { 0, 3, 3, 6559, 6559 },
+    { 0, 3, 3, 6562, 6562 },
+    { 0, 3, 3, 6565, 6565 },
+    { 0, 3, 3, 6568, 6568 },
+    { 0, 3, 3, 6571, 6571 },
+    { 0, 3, 3, 6574, 6574 },
+    { 0, 3, 3, 6577, 6577 },
+    { 0, 3, 3, 6580, 6580 },
+    { 0, 3, 3, 6583, 6583 },
+    { 0, 3, 3, 6586, 6586 },
+    { 0, 3, 3, 6589, 6589 },
+    { 0, 3, 3, 6592, 6592 },
+    { 0, 3, 3, 6595, 6595 },
+    { 0, 3, 3, 6598, 6598 },
+    { 0, 3, 3, 6601, 6601 },
+    { 0, 3, 3, 6604, 6604 },
+    { 0, 3, 3, 6607, 6607 },
+    { 0, 3, 3, 6610, 6610 },
+    { 0, 3, 3, 6613, 6613 },
+    { 0, 3, 3, 6616, 6616 },
+    { 0, 3, 3, 6619, 6619 },
+    { 0, 3, 3, 6622, 6622 },
+    { 0, 3, 3, 6625, 6625 },
+    { 0, 3, 3, 6628, 6628 },
+    { 0, 3, 3, 6631, 6631 },
+    { 0, 3, 3, 6634, 6634 },
+    { 0, 3, 3, 6637, 6637 },
+    { 0, 3, 3, 6640, 6640 },
+    { 0, 3, 3, 6643, 6643 },
+    { 0, 3, 3, 6646, 6646 },
+    { 0, 3, 3, 6649, 6649 },
+    { 0, 3, 3, 6652, 6652 },
+    { 0, 3, 3, 6655, 6655 },
+    { 0, 3, 3, 6658, 6658 },
+    { 0, 3, 3, 6661, 6661 },
+    { 0, 3, 3, 6664, 6664 },
+    { 0, 3, 3, 6667, 6667 },
+    { 0, 3, 3, 6670, 6670 },
+    { 0, 3, 3, 6673, 6673 },
+    { 0, 3, 3, 6676, 6676 },
+    { 0, 3, 3, 6679, 6679 },
+    { 0, 3, 3, 6682, 6682 },
+    { 0, 3, 3, 6685, 6685 },
+    { 0, 3, 3, 6688, 6688 },
+    { 0, 3, 3, 6691, 6691 },
+    { 0, 3, 3, 6694, 6694 },
+    { 0, 3, 3, 6697, 6697 },
+    { 0, 3, 3, 6700, 6700 },
+    { 0, 3, 3, 6703, 6703 },
+    { 0, 3, 3, 6706, 6706 },
+    { 0, 3, 3, 6709, 6709 },
+    { 0, 3, 3, 6712, 6712 },
+    { 0, 3, 3, 6715, 6715 },
+    { 0, 3, 3, 6718, 6718 },
+    { 0, 3, 3, 6721, 6721 },
+    { 0, 3, 3, 6724, 6724 },
+    { 0, 3, 3, 6727, 6727 },
+    { 0, 3, 3, 6730, 6730 },
+    { 0, 3, 3, 6733, 6733 },
+    { 0, 3, 3, 6736, 6736 },
+    { 0, 3, 3, 6739, 6739 },
+    { 0, 3, 3, 6742, 6742 },
+    { 0, 3, 3, 6745, 6745 },
+    { 0, 3, 3, 6748, 6748 },
+    { 0, 3, 3, 6751, 6751 },
+    { 0, 3, 3, 6754, 6754 },
+    { 0, 3, 3, 6757, 6757 },
+    { 0, 3, 3, 6760, 6760 },
+    { 0, 3, 3, 6763, 6763 },
+    { 0, 3, 3, 6766, 6766 },
+    { 0, 3, 3, 6769, 6769 },
+    { 0, 3, 3, 6772, 6772 },
+    { 0, 3, 3, 6775, 6775 },
+    { 0, 3, 3, 6778, 6778 },
+    { 0, 3, 3, 6781, 6781 },
+    { 1, 3, 0, 6784, 30 },
+    { 1, 3, 0, 6787, 30 },
+    { 1, 3, 0, 6790, 30 },
+    { 1, 3, 0, 6793, 30 },
+    { 0, 3, 3, 6796, 6796 },
+    { 0, 3, 3, 6799, 6799 },
+    { 0, 3, 3, 6802, 6802 },
+    { 0, 0, 3, 65535, 6805 },
+    { 0, 0, 3, 65535, 6808 },
+    { 0, 0, 3, 65535, 6811 },
+    { 0, 0, 3, 65535, 6814 },
+    { 0, 0, 3, 65535, 6817 },
+    { 0, 0, 3, 65535, 6820 },
+    { 0, 0, 3, 65535, 6823 },
+    { 0, 0, 3, 65535, 6826 },
+    { 0, 0, 3, 65535, 6829 },
+    { 0, 0, 3, 65535, 6832 },
+    { 0, 0, 3, 65535, 6835 },
+    { 0, 0, 3, 65535, 6838 },
+    { 0, 0, 3, 65535, 6841 },
+    { 0, 0, 3, 65535, 6844 },
+    { 0, 0, 3, 65535, 6847 },
+    { 0, 0, 3, 65535, 6850 },
+    { 0, 0, 3, 65535, 6853 },
+    { 0, 0, 3, 65535, 6856 },
+    { 0, 0, 3, 65535, 6859 },
+    { 0, 0, 3, 65535, 6862 },
+    { 0, 0, 3, 65535, 6865 },
+    { 1, 3, 0, 6868, 30 },
+    { 1, 3, 0, 6871, 30 },
+    { 0, 4, 1, 6874, 26 },
+    { 0, 4, 1, 6878, 26 },
+    { 0, 0, 3, 65535, 6882 },
+    { 0, 6, 6, 6885, 6885 },
+    { 0, 0, 3, 65535, 6891 },
+    { 0, 0, 3, 65535, 6894 },
+    { 0, 0, 3, 65535, 6897 },
+    { 0, 0, 3, 65535, 6900 },
+    { 0, 0, 3, 65535, 6903 },
+    { 0, 0, 3, 65535, 6906 },
+    { 0, 0, 3, 65535, 6909 },
+    { 0, 0, 3, 65535, 6912 },
+    { 0, 0, 3, 65535, 6915 },
+    { 0, 0, 3, 65535, 6918 },
+    { 0, 0, 3, 65535, 6921 },
+    { 0, 0, 3, 65535, 6924 },
+    { 0, 0, 3, 65535, 6927 },
+    { 0, 0, 3, 65535, 6930 },
+    { 0, 0, 3, 65535, 6933 },
+    { 0, 0, 3, 65535, 6936 },
+    { 0, 0, 3, 65535, 6939 },
+    { 0, 0, 3, 65535, 6942 },
+    { 0, 0, 3, 65535, 6945 },
+    { 0, 0, 3, 65535, 6948 },
+    { 0, 0, 3, 65535, 6951 },
+    { 0, 0, 3, 65535, 6954 },
+    { 0, 0, 3, 65535, 6957 },
+    { 0, 0, 3, 65535, 6960 },
+    { 0, 0, 3, 65535, 6963 },
+    { 0, 0, 3, 65535, 6966 },
+    { 0, 6, 6, 6969, 6969 },
+    { 0, 3, 3, 6975, 6975 },
+    { 0, 3, 3, 6978, 6978 },
+    { 0, 3, 3, 6981, 6981 },
+    { 0, 3, 3, 6984, 6984 },
+    { 0, 3, 3, 6987, 6987 },
+    { 0, 3, 3, 6990, 6990 },
+    { 0, 3, 3, 6993, 6993 },
+    { 0, 3, 3, 6996, 6996 },
+    { 0, 3, 3, 6999, 6999 },
+    { 0, 3, 3, 7002, 7002 },
+    { 0, 3, 3, 7005, 7005 },
+    { 0, 3, 3, 7008, 7008 },
+    { 0, 3, 3, 7011, 7011 },
+    { 0, 3, 3, 7014, 7014 },
+    { 0, 3, 3, 7017, 7017 },
+    { 0, 3, 3, 7020, 7020 },
+    { 0, 3, 3, 7023, 7023 },
+    { 0, 3, 3, 7026, 7026 },
+    { 0, 3, 3, 7029, 7029 },
+    { 0, 3, 3, 7032, 7032 },
+    { 0, 3, 3, 7035, 7035 },
+    { 0, 3, 3, 7038, 7038 },
+    { 0, 3, 3, 7041, 7041 },
+    { 0, 3, 3, 7044, 7044 },
+    { 0, 3, 3, 7047, 7047 },
+    { 0, 3, 3, 7050, 7050 },
+    { 0, 3, 3, 7053, 7053 },
+    { 0, 3, 3, 7056, 7056 },
+    { 0, 3, 3, 7059, 7059 },
+    { 0, 3, 3, 7062, 7062 },
+    { 0, 3, 3, 7065, 7065 },
+    { 0, 3, 3, 7068, 7068 },
+    { 0, 3, 3, 7071, 7071 },
+    { 0, 3, 3, 7074, 7074 },
+    { 0, 3, 3, 7077, 7077 },
+    { 0, 3, 3, 7080, 7080 },
+    { 0, 3, 3, 7083, 7083 },
+    { 0, 3, 3, 7086, 7086 },
+    { 0, 3, 3, 7089, 7089 },
+    { 0, 3, 3, 7092, 7092 },
+    { 0, 3, 3, 7095, 7095 },
+    { 0, 3, 3, 7098, 7098 },
+    { 0, 3, 3, 7101, 7101 },
+    { 0, 3, 3, 7104, 7104 },
+    { 0, 3, 3, 7107, 7107 },
+    { 0, 3, 3, 7110, 7110 },
+    { 0, 3, 3, 7113, 7113 },
+    { 0, 3, 3, 7116, 7116 },
+    { 0, 3, 3, 7119, 7119 },
+    { 0, 3, 3, 7122, 7122 },
+    { 0, 3, 3, 7125, 7125 },
+    { 0, 3, 3, 7128, 7128 },
+    { 0, 3, 3, 7131, 7131 },
+    { 0, 3, 3, 7134, 7134 },
+    { 0, 3, 3, 7137, 7137 },
+    { 0, 3, 3, 7140, 7140 },
+    { 0, 3, 3, 7143, 7143 },
+    { 0, 3, 3, 7146, 7146 },
+    { 0, 3, 3, 7149, 7149 },
+    { 0, 3, 3, 7152, 7152 },
+    { 0, 3, 3, 7155, 7155 },
+    { 0, 3, 3, 7158, 7158 },
+    { 0, 3, 3, 7161, 7161 },
+    { 0, 3, 3, 7164, 7164 },
+    { 0, 3, 3, 7167, 7167 },
+    { 0, 3, 3, 7170, 7170 },
+    { 0, 3, 3, 7173, 7173 },
+    { 0, 3, 3, 7176, 7176 },
+    { 0, 3, 3, 7179, 7179 },
+    { 0, 3, 3, 7182, 7182 },
+    { 0, 3, 3, 7185, 7185 },
+    { 0, 3, 3, 7188, 7188 },
+    { 0, 3, 3, 7191, 7191 },
+    { 0, 3, 3, 7194, 7194 },
+    { 0, 3, 3, 7197, 7197 },
+    { 0, 3, 3, 7200, 7200 },
+    { 0, 3, 3, 7203, 7203 },
+    { 0, 3, 3, 7206, 7206 },
+    { 0, 3, 3, 7209, 7209 },
+    { 0, 3, 3, 7212, 7212 },
+    { 0, 3, 3, 7215, 7215 },
+    { 0, 3, 3, 7218, 7218 },
+    { 0, 3, 3, 7221, 7221 },
+    { 0, 3, 3, 7224, 7224 },
+    { 0, 3, 3, 7227, 7227 },
+    { 0, 3, 3, 7230, 7230 },
+    { 0, 3, 3, 7233, 7233 },
+    { 0, 3, 3, 7236, 7236 },
+    { 0, 3, 3, 7239, 7239 },
+    { 0, 3, 3, 7242, 7242 },
+    { 0, 3, 3, 7245, 7245 },
+    { 0, 3, 3, 7248, 7248 },
+    { 0, 3, 3, 7251, 7251 },
+    { 0, 3, 3, 7254, 7254 },
+    { 0, 3, 3, 7257, 7257 },
+    { 0, 3, 3, 7260, 7260 },
+    { 0, 3, 3, 7263, 7263 },
+    { 0, 3, 3, 7266, 7266 },
+    { 0, 3, 3, 7269, 7269 },
+    { 0, 3, 3, 7272, 7272 },
+    { 0, 3, 3, 7275, 7275 },
+    { 0, 3, 3, 7278, 7278 },
+    { 0, 3, 3, 7281, 7281 },
+    { 0, 5, 5, 7284, 7284 },
+    { 0, 5, 5, 7289, 7289 },
+    { 0, 5, 5, 7294, 7294 },
+    { 0, 5, 5, 7299, 7299 },
+    { 0, 5, 5, 7304, 7304 },
+    { 0, 5, 5, 7309, 7309 },
+    { 0, 5, 5, 7314, 7314 },
+    { 0, 5, 5, 7319, 7319 },
+    { 0, 5, 5, 7324, 7324 },
+    { 0, 5, 5, 7329, 7329 },
+    { 0, 5, 5, 7334, 7334 },
+    { 0, 5, 5, 7339, 7339 },
+    { 0, 5, 5, 7344, 7344 },
+    { 0, 5, 5, 7349, 7349 },
+    { 0, 5, 5, 7354, 7354 },
+    { 0, 5, 5, 7359, 7359 },
+    { 0, 5, 5, 7364, 7364 },
+    { 0, 5, 5, 7369, 7369 },
+    { 0, 5, 5, 7374, 7374 },
+    { 0, 5, 5, 7379, 7379 },
+    { 0, 5, 5, 7384, 7384 },
+    { 0, 5, 5, 7389, 7389 },
+    { 0, 5, 5, 7394, 7394 },
+    { 0, 5, 5, 7399, 7399 },
+    { 0, 5, 5, 7404, 7404 },
+    { 0, 5, 5, 7409, 7409 },
+    { 0, 5, 5, 7414, 7414 },
+    { 0, 5, 5, 7419, 7419 },
+    { 0, 5, 5, 7424, 7424 },
+    { 0, 8, 8, 7429, 7429 },
+    { 0, 8, 8, 7437, 7437 },
+    { 0, 5, 5, 7445, 7445 },
+    { 0, 5, 5, 7450, 7450 },
+    { 0, 5, 5, 7455, 7455 },
+    { 0, 5, 5, 7460, 7460 },
+    { 0, 5, 5, 7465, 7465 },
+    { 0, 5, 5, 7470, 7470 },
+    { 0, 5, 5, 7475, 7475 },
+    { 0, 5, 5, 7480, 7480 },
+    { 0, 5, 5, 7485, 7485 },
+    { 0, 5, 5, 7490, 7490 },
+    { 0, 5, 5, 7495, 7495 },
+    { 0, 5, 5, 7500, 7500 },
+    { 0, 5, 5, 7505, 7505 },
+    { 0, 5, 5, 7510, 7510 },
+    { 0, 5, 5, 7515, 7515 },
+    { 0, 5, 5, 7520, 7520 },
+    { 0, 5, 5, 7525, 7525 },
+    { 0, 5, 5, 7530, 7530 },
+    { 0, 5, 5, 7535, 7535 },
+    { 0, 5, 5, 7540, 7540 },
+    { 0, 5, 5, 7545, 7545 },
+    { 0, 5, 5, 7550, 7550 },
+    { 0, 5, 5, 7555, 7555 },
+    { 0, 5, 5, 7560, 7560 },
+    { 0, 5, 5, 7565, 7565 },
+    { 0, 5, 5, 7570, 7570 },
+    { 0, 5, 5, 7575, 7575 },
+    { 0, 5, 5, 7580, 7580 },
+    { 0, 5, 5, 7585, 7585 },
+    { 0, 5, 5, 7590, 7590 },
+    { 0, 5, 5, 7595, 7595 },
+    { 0, 5, 5, 7600, 7600 },
+    { 0, 5, 5, 7605, 7605 },
+    { 0, 5, 5, 7610, 7610 },
+    { 0, 5, 5, 7615, 7615 },
+    { 0, 5, 5, 7620, 7620 },
+    { 0, 3, 3, 7625, 7625 },
+    { 0, 3, 3, 7628, 7628 },
+    { 0, 3, 3, 7631, 7631 },
+    { 0, 3, 3, 7634, 7634 },
+    { 0, 2, 2, 7637, 7639 },
+    { 0, 2, 2, 7641, 7641 },
+    { 0, 2, 2, 7643, 7643 },
+    { 0, 2, 2, 7645, 7645 },
+    { 0, 2, 2, 7647, 7647 },
+    { 0, 2, 2, 7649, 7649 },
+    { 0, 2, 2, 7651, 7651 },
+    { 0, 2, 2, 7653, 7653 },
+    { 0, 2, 2, 7655, 7655 },
+    { 0, 2, 2, 7657, 7659 },
+    { 0, 2, 2, 7661, 7663 },
+    { 0, 2, 2, 7665, 7665 },
+    { 0, 2, 2, 7667, 7667 },
+    { 0, 2, 2, 7669, 7669 },
+    { 0, 2, 2, 7671, 7671 },
+    { 0, 3, 3, 7673, 7673 },
+    { 0, 3, 3, 7676, 7676 },
+    { 0, 3, 3, 7679, 7679 },
+    { 0, 3, 3, 7682, 7682 },
+    { 0, 3, 3, 7685, 7685 },
+    { 0, 3, 3, 7688, 7688 },
+    { 0, 3, 3, 7691, 7691 },
+    { 0, 3, 3, 7694, 7694 },
+    { 0, 3, 3, 7697, 7697 },
+    { 0, 3, 3, 7700, 7700 },
+    { 0, 3, 3, 7703, 7703 },
+    { 0, 3, 3, 7706, 7706 },
+    { 0, 3, 3, 7709, 7709 },
+    { 0, 3, 3, 7712, 7712 },
+    { 0, 6, 6, 7715, 7715 },
+    { 0, 6, 6, 7721, 7721 },
+    { 0, 3, 3, 7727, 7727 },
+    { 0, 3, 3, 7730, 7730 },
+    { 0, 3, 3, 7733, 7733 },
+    { 0, 3, 3, 7736, 7736 },
+    { 0, 3, 3, 7739, 7739 },
+    { 0, 3, 3, 7742, 7742 },
+    { 0, 3, 3, 7745, 7745 },
+    { 0, 3, 3, 7748, 7748 },
+    { 0, 3, 3, 7751, 7751 },
+    { 0, 3, 3, 7754, 7754 },
+    { 0, 3, 3, 7757, 7757 },
+    { 0, 3, 3, 7760, 7760 },
+    { 0, 3, 3, 7763, 7763 },
+    { 0, 3, 3, 7766, 7766 },
+    { 0, 3, 3, 7769, 7769 },
+    { 0, 3, 3, 7772, 7772 },
+    { 0, 3, 3, 7775, 7775 },
+    { 0, 3, 3, 7778, 7778 },
+    { 0, 3, 3, 7781, 7781 },
+    { 0, 3, 3, 7784, 7784 },
+    { 0, 3, 3, 7787, 7787 },
+    { 0, 3, 3, 7790, 7790 },
+    { 0, 3, 3, 7793, 7793 },
+    { 0, 3, 3, 7796, 7796 },
+    { 0, 3, 3, 7799, 7799 },
+    { 0, 3, 3, 7802, 7802 },
+    { 0, 3, 3, 7805, 7805 },
+    { 0, 3, 3, 7808, 7808 },
+    { 0, 3, 3, 7811, 7811 },
+    { 0, 3, 3, 7814, 7814 },
+    { 0, 3, 3, 7817, 7817 },
+    { 0, 3, 3, 7820, 7820 },
+    { 0, 3, 3, 7823, 7823 },
+    { 0, 2, 2, 7826, 7826 },
+    { 0, 2, 2, 7828, 7828 },
+    { 0, 2, 2, 7830, 7830 },
+    { 0, 2, 2, 7832, 7832 },
+    { 0, 2, 2, 7834, 7836 },
+    { 0, 2, 2, 7838, 7840 },
+    { 0, 2, 2, 7842, 7842 },
+    { 0, 2, 2, 7844, 7844 },
+    { 0, 2, 2, 7846, 7846 },
+    { 0, 2, 2, 7848, 7848 },
+    { 0, 2, 2, 7850, 7850 },
+    { 0, 2, 2, 7852, 7852 },
+    { 0, 2, 2, 7854, 7854 },
+    { 0, 2, 2, 7856, 7856 },
+    { 0, 2, 2, 7858, 7860 },
+    { 0, 4, 4, 7862, 7866 },
+    { 0, 4, 4, 7870, 7870 },
+    { 0, 4, 4, 7874, 7874 },
+    { 0, 4, 4, 7878, 7878 },
+    { 0, 4, 4, 7882, 7882 },
+    { 0, 4, 4, 7886, 7886 },
+    { 0, 4, 4, 7890, 7890 },
+    { 0, 4, 4, 7894, 7894 },
+    { 0, 4, 4, 7898, 7898 },
+    { 0, 5, 5, 7902, 7907 },
+    { 0, 5, 5, 7912, 7917 },
+    { 0, 5, 5, 7922, 7927 },
+    { 0, 2, 2, 7932, 7932 },
+    { 0, 3, 3, 7934, 7934 },
+    { 0, 2, 2, 7937, 7937 },
+    { 0, 3, 3, 7939, 7939 },
+    { 0, 3, 3, 7942, 7942 },
+    { 0, 3, 3, 7945, 7945 },
+    { 0, 3, 3, 6951, 6951 },
+    { 0, 3, 3, 7948, 7948 },
+    { 0, 3, 3, 7951, 7951 },
+    { 0, 3, 3, 6891, 6891 },
+    { 0, 3, 3, 6894, 6894 },
+    { 0, 3, 3, 6897, 6897 },
+    { 0, 3, 3, 6900, 6900 },
+    { 0, 3, 3, 6903, 6903 },
+    { 0, 3, 3, 6906, 6906 },
+    { 0, 3, 3, 6909, 6909 },
+    { 0, 3, 3, 6912, 6912 },
+    { 0, 3, 3, 6915, 6915 },
+    { 0, 3, 3, 6918, 6918 },
+    { 0, 3, 3, 6921, 6921 },
+    { 0, 3, 3, 6924, 6924 },
+    { 0, 3, 3, 6927, 6927 },
+    { 0, 3, 3, 6930, 6930 },
+    { 0, 3, 3, 6933, 6933 },
+    { 0, 3, 3, 7954, 7954 },
+    { 0, 3, 3, 7957, 7957 },
+    { 0, 3, 3, 7960, 7960 },
+    { 0, 3, 3, 7963, 7963 },
+    { 0, 3, 3, 7966, 7966 },
+    { 0, 3, 3, 6936, 6936 },
+    { 0, 3, 3, 6939, 6939 },
+    { 0, 3, 3, 6942, 6942 },
+    { 0, 3, 3, 6945, 6945 },
+    { 0, 3, 3, 6948, 6948 },
+    { 0, 3, 3, 7969, 7969 },
+    { 0, 3, 3, 7972, 7972 },
+    { 0, 3, 3, 7975, 7975 },
+    { 0, 3, 3, 7978, 7978 },
+    { 0, 3, 3, 7981, 7981 },
+    { 0, 3, 3, 7984, 7984 },
+    { 0, 3, 3, 7987, 7987 },
+    { 0, 3, 3, 7990, 7990 },
+    { 0, 3, 3, 7993, 7993 },
+    { 0, 3, 3, 7996, 7996 },
+    { 0, 3, 3, 7999, 7999 },
+    { 0, 3, 3, 8002, 8002 },
+    { 0, 3, 3, 8005, 8005 },
+    { 0, 3, 3, 6954, 6954 },
+    { 0, 3, 3, 6957, 6957 },
+    { 0, 3, 3, 6960, 6960 },
+    { 0, 3, 3, 6963, 6963 },
+    { 0, 6, 6, 8008, 8008 },
+    { 0, 12, 12, 8014, 8026 },
+    { 0, 12, 12, 8038, 8038 },
+    { 0, 12, 12, 8050, 8062 },
+    { 0, 9, 9, 8074, 8074 },
+    { 0, 12, 12, 8083, 8095 },
+    { 0, 9, 9, 8107, 8107 },
+    { 0, 9, 9, 8116, 8116 },
+    { 0, 15, 15, 8125, 8140 },
+    { 0, 12, 12, 8155, 8155 },
+    { 0, 9, 9, 8167, 8167 },
+    { 0, 9, 9, 8176, 8176 },
+    { 0, 9, 9, 8185, 8185 },
+    { 0, 12, 12, 8194, 8194 },
+    { 0, 12, 12, 8206, 8206 },
+    { 0, 9, 9, 8218, 8227 },
+    { 0, 9, 9, 8236, 8245 },
+    { 0, 6, 6, 8254, 8260 },
+    { 0, 9, 9, 8266, 8275 },
+    { 0, 12, 12, 8284, 8284 },
+    { 0, 12, 12, 8296, 8308 },
+    { 0, 6, 6, 8320, 8320 },
+    { 0, 15, 15, 8326, 8341 },
+    { 0, 18, 18, 8356, 8356 },
+    { 0, 15, 15, 8374, 8374 },
+    { 0, 9, 9, 8389, 8398 },
+    { 0, 15, 15, 8407, 8422 },
+    { 0, 15, 15, 8437, 8452 },
+    { 0, 12, 12, 8467, 8467 },
+    { 0, 9, 9, 8479, 8479 },
+    { 0, 9, 9, 8488, 8488 },
+    { 0, 9, 9, 8497, 8506 },
+    { 0, 12, 12, 8515, 8515 },
+    { 0, 15, 15, 8527, 8527 },
+    { 0, 12, 12, 8542, 8554 },
+    { 0, 9, 9, 8566, 8566 },
+    { 0, 9, 9, 8575, 8575 },
+    { 0, 9, 9, 8584, 8593 },
+    { 0, 6, 6, 8602, 8608 },
+    { 0, 6, 6, 8614, 8620 },
+    { 0, 6, 6, 8626, 8626 },
+    { 0, 6, 6, 8632, 8632 },
+    { 0, 9, 9, 8638, 8638 },
+    { 0, 9, 9, 8647, 8647 },
+    { 0, 15, 15, 8656, 8671 },
+    { 0, 9, 9, 8686, 8695 },
+    { 0, 12, 12, 8704, 8716 },
+    { 0, 15, 15, 8728, 8743 },
+    { 0, 9, 9, 8758, 8767 },
+    { 0, 6, 6, 8776, 8782 },
+    { 0, 6, 6, 8788, 8794 },
+    { 0, 15, 15, 8800, 8815 },
+    { 0, 12, 12, 8830, 8830 },
+    { 0, 15, 15, 8842, 8857 },
+    { 0, 9, 9, 8872, 8872 },
+    { 0, 15, 15, 8881, 8881 },
+    { 0, 6, 6, 8896, 8902 },
+    { 0, 9, 9, 8908, 8917 },
+    { 0, 9, 9, 8926, 8926 },
+    { 0, 9, 9, 8935, 8944 },
+    { 0, 9, 9, 8953, 8962 },
+    { 0, 9, 9, 8971, 8980 },
+    { 0, 12, 12, 8989, 9001 },
+    { 0, 9, 9, 9013, 9022 },
+    { 0, 6, 6, 9031, 9031 },
+    { 0, 9, 9, 9037, 9046 },
+    { 0, 9, 9, 9055, 9055 },
+    { 0, 9, 9, 9064, 9064 },
+    { 0, 12, 12, 9073, 9073 },
+    { 0, 9, 9, 9085, 9085 },
+    { 0, 9, 9, 9094, 9094 },
+    { 0, 9, 9, 9103, 9103 },
+    { 0, 15, 15, 9112, 9112 },
+    { 0, 12, 12, 9127, 9127 },
+    { 0, 6, 6, 9139, 9139 },
+    { 0, 15, 15, 9145, 9160 },
+    { 0, 6, 6, 9175, 9181 },
+    { 0, 12, 12, 9187, 9199 },
+    { 0, 12, 12, 9211, 9211 },
+    { 0, 9, 9, 9223, 9232 },
+    { 0, 9, 9, 9241, 9241 },
+    { 0, 9, 9, 9250, 9250 },
+    { 0, 12, 12, 9259, 9259 },
+    { 0, 6, 6, 9271, 9271 },
+    { 0, 9, 9, 9277, 9286 },
+    { 0, 12, 12, 9295, 9307 },
+    { 0, 6, 6, 9319, 9319 },
+    { 0, 15, 15, 9325, 9340 },
+    { 0, 9, 9, 9355, 9355 },
+    { 0, 4, 4, 9364, 9368 },
+    { 0, 4, 4, 9372, 9376 },
+    { 0, 4, 4, 9380, 9380 },
+    { 0, 4, 4, 9384, 9384 },
+    { 0, 4, 4, 9388, 9388 },
+    { 0, 4, 4, 9392, 9392 },
+    { 0, 4, 4, 9396, 9396 },
+    { 0, 4, 4, 9400, 9400 },
+    { 0, 4, 4, 9404, 9404 },
+    { 0, 4, 4, 9408, 9408 },
+    { 0, 5, 5, 9412, 9417 },
+    { 0, 5, 5, 9422, 9427 },
+    { 0, 5, 5, 9432, 9437 },
+    { 0, 5, 5, 9442, 9447 },
+    { 0, 5, 5, 9452, 9457 },
+    { 0, 5, 5, 9462, 9467 },
+    { 0, 5, 5, 9472, 9477 },
+    { 0, 5, 5, 9482, 9487 },
+    { 0, 5, 5, 9492, 9497 },
+    { 0, 5, 5, 9502, 9507 },
+    { 0, 5, 5, 9512, 9517 },
+    { 0, 5, 5, 9522, 9527 },
+    { 0, 5, 5, 9532, 9532 },
+    { 0, 5, 5, 9537, 9537 },
+    { 0, 5, 5, 9542, 9542 },
+    { 0, 3, 3, 9547, 9547 },
+    { 0, 2, 2, 9550, 9550 },
+    { 0, 2, 2, 9552, 9552 },
+    { 0, 3, 3, 9554, 9554 },
+    { 0, 2, 2, 9557, 9557 },
+    { 0, 2, 2, 9559, 9559 },
+    { 0, 2, 2, 9561, 9561 },
+    { 0, 3, 3, 9563, 9563 },
+    { 0, 3, 3, 9566, 9566 },
+    { 0, 2, 2, 9569, 9569 },
+    { 0, 6, 6, 9571, 9571 },
+    { 0, 6, 6, 9577, 9577 },
+    { 0, 6, 6, 9583, 9583 },
+    { 0, 6, 6, 9589, 9589 },
+    { 0, 12, 12, 9595, 9595 },
+    { 0, 2, 2, 9607, 9607 },
+    { 0, 2, 2, 9609, 9609 },
+    { 0, 3, 3, 9611, 9611 },
+    { 0, 2, 2, 9614, 9614 },
+    { 0, 2, 2, 9616, 9616 },
+    { 0, 2, 2, 9618, 9618 },
+    { 0, 2, 2, 9620, 9620 },
+    { 0, 2, 2, 9622, 9622 },
+    { 0, 3, 3, 9624, 9624 },
+    { 0, 4, 4, 9627, 9627 },
+    { 0, 2, 2, 9631, 9631 },
+    { 0, 2, 2, 9633, 9633 },
+    { 0, 3, 3, 9635, 9635 },
+    { 0, 3, 3, 9638, 9638 },
+    { 0, 2, 2, 9641, 9641 },
+    { 0, 2, 2, 9643, 9643 },
+    { 0, 2, 2, 9645, 9645 },
+    { 0, 3, 3, 9647, 9647 },
+    { 0, 3, 3, 9650, 9650 },
+    { 0, 3, 3, 9653, 9653 },
+    { 0, 3, 3, 9656, 9656 },
+    { 0, 3, 3, 9659, 9659 },
+    { 0, 2, 2, 9662, 9662 },
+    { 0, 2, 2, 9664, 9664 },
+    { 0, 2, 2, 9666, 9666 },
+    { 0, 2, 2, 9668, 9668 },
+    { 0, 2, 2, 9670, 9670 },
+    { 0, 3, 3, 9672, 9672 },
+    { 0, 2, 2, 9675, 9675 },
+    { 0, 2, 2, 9677, 9677 },
+    { 0, 2, 2, 9679, 9679 },
+    { 0, 3, 3, 9681, 9681 },
+    { 0, 3, 3, 9684, 9684 },
+    { 0, 2, 2, 9687, 9687 },
+    { 0, 3, 3, 9689, 9689 },
+    { 0, 3, 3, 9692, 9692 },
+    { 0, 3, 3, 9695, 9695 },
+    { 0, 2, 2, 9698, 9698 },
+    { 0, 3, 3, 9700, 9700 },
+    { 0, 5, 5, 9703, 9703 },
+    { 0, 6, 6, 9708, 9708 },
+    { 0, 3, 3, 9714, 9714 },
+    { 0, 3, 3, 9717, 9717 },
+    { 0, 3, 3, 9720, 9720 },
+    { 0, 3, 3, 9723, 9723 },
+    { 0, 7, 7, 9726, 9726 },
+    { 0, 8, 8, 9733, 9733 },
+    { 0, 2, 2, 9741, 9741 },
+    { 0, 2, 2, 9743, 9743 },
+    { 0, 3, 3, 9745, 9745 },
+    { 0, 2, 2, 9748, 9748 },
+    { 0, 2, 2, 9750, 9750 },
+    { 0, 2, 2, 9752, 9752 },
+    { 0, 3, 3, 9754, 9754 },
+    { 0, 2, 2, 9757, 9757 },
+    { 0, 2, 2, 9759, 9759 },
+    { 0, 2, 2, 9761, 9761 },
+    { 0, 2, 2, 9763, 9763 },
+    { 0, 3, 3, 9765, 9765 },
+    { 0, 2, 2, 9768, 9768 },
+    { 0, 2, 2, 9770, 9770 },
+    { 0, 3, 2, 9772, 9770 },
+    { 0, 3, 2, 9775, 9768 },
+    { 0, 4, 4, 9778, 9778 },
+    { 0, 2, 2, 9782, 9782 },
+    { 0, 2, 2, 9784, 9784 },
+    { 0, 2, 2, 9786, 9786 },
+    { 0, 6, 6, 9788, 9788 },
+    { 0, 3, 3, 9794, 9794 },
+    { 0, 2, 2, 9797, 9797 },
+    { 0, 2, 2, 9799, 9799 },
+    { 0, 2, 2, 9801, 9801 },
+    { 0, 2, 2, 9803, 9803 },
+    { 0, 2, 2, 9805, 9805 },
+    { 0, 2, 2, 9807, 9807 },
+    { 0, 2, 2, 9809, 9809 },
+    { 0, 2, 2, 9811, 9811 },
+    { 0, 2, 2, 9813, 9813 },
+    { 0, 3, 3, 9815, 9815 },
+    { 0, 2, 2, 9818, 9818 },
+    { 0, 3, 3, 9820, 9820 },
+    { 0, 3, 3, 9823, 9823 },
+    { 0, 2, 2, 9826, 9826 },
+    { 0, 4, 4, 9828, 9828 },
+    { 0, 3, 3, 9832, 9832 },
+    { 0, 2, 2, 9835, 9835 },
+    { 0, 2, 2, 9837, 9837 },
+    { 0, 2, 2, 9839, 9839 },
+    { 0, 2, 2, 9841, 9841 },
+    { 0, 5, 5, 9843, 9843 },
+    { 0, 5, 5, 9848, 9848 },
+    { 0, 4, 4, 9853, 9857 },
+    { 0, 4, 4, 9861, 9861 },
+    { 0, 4, 4, 9865, 9865 },
+    { 0, 4, 4, 9869, 9869 },
+    { 0, 4, 4, 9873, 9873 },
+    { 0, 4, 4, 9877, 9877 },
+    { 0, 4, 4, 9881, 9881 },
+    { 0, 4, 4, 9885, 9885 },
+    { 0, 4, 4, 9889, 9889 },
+    { 0, 5, 5, 9893, 9898 },
+    { 0, 5, 5, 9903, 9908 },
+    { 0, 5, 5, 9913, 9918 },
+    { 0, 5, 5, 9923, 9928 },
+    { 0, 5, 5, 9933, 9938 },
+    { 0, 5, 5, 9943, 9948 },
+    { 0, 5, 5, 9953, 9958 },
+    { 0, 5, 5, 9963, 9968 },
+    { 0, 5, 5, 9973, 9978 },
+    { 0, 5, 5, 9983, 9988 },
+    { 0, 5, 5, 9993, 9998 },
+    { 0, 5, 5, 10003, 10008 },
+    { 0, 5, 5, 10013, 10013 },
+    { 0, 5, 5, 10018, 10018 },
+    { 0, 5, 5, 10023, 10023 },
+    { 0, 5, 5, 10028, 10028 },
+    { 0, 5, 5, 10033, 10033 },
+    { 0, 5, 5, 10038, 10038 },
+    { 0, 5, 5, 10043, 10043 },
+    { 0, 5, 5, 10048, 10048 },
+    { 0, 5, 5, 10053, 10058 },
+    { 0, 5, 5, 10063, 10068 },
+    { 0, 3, 3, 10073, 10073 },
+    { 0, 3, 3, 10076, 10076 },
+    { 0, 3, 3, 10079, 10079 },
+    { 0, 3, 3, 10082, 10082 },
+    { 0, 3, 3, 10085, 10085 },
+    { 0, 3, 3, 10088, 10088 },
+    { 0, 3, 3, 10091, 10091 },
+    { 0, 3, 3, 10094, 10094 },
+    { 0, 3, 3, 10097, 10097 },
+    { 0, 3, 3, 10100, 10100 },
+    { 0, 3, 3, 10103, 10103 },
+    { 0, 3, 3, 10106, 10106 },
+    { 0, 3, 3, 10109, 10109 },
+    { 0, 3, 3, 10112, 10112 },
+    { 0, 3, 3, 10115, 10115 },
+    { 0, 3, 3, 10118, 10118 },
+    { 0, 3, 3, 10121, 10121 },
+    { 0, 3, 3, 10124, 10124 },
+    { 0, 3, 3, 10127, 10127 },
+    { 0, 3, 3, 10130, 10130 },
+    { 0, 3, 3, 10133, 10133 },
+    { 0, 3, 3, 10136, 10136 },
+    { 0, 3, 3, 10139, 10139 },
+    { 1, 3, 0, 10142, 30 },
+    { 1, 3, 0, 10145, 30 },
+    { 1, 3, 0, 10148, 30 },
+    { 1, 3, 0, 10151, 30 },
+    { 1, 3, 0, 10154, 30 },
+    { 1, 3, 0, 10157, 30 },
+    { 1, 3, 0, 10160, 30 },
+    { 1, 3, 0, 10163, 30 },
+    { 1, 3, 0, 10166, 30 },
+    { 1, 3, 0, 10169, 30 },
+    { 1, 3, 0, 10172, 30 },
+    { 1, 3, 0, 10175, 30 },
+    { 1, 3, 0, 10178, 30 },
+    { 1, 3, 0, 10181, 30 },
+    { 0, 3, 3, 10184, 10184 },
+    { 0, 3, 3, 10187, 10187 },
+    { 0, 3, 3, 10190, 10190 },
+    { 0, 3, 3, 10193, 10193 },
+    { 0, 3, 3, 10196, 10196 },
+    { 0, 3, 3, 10199, 10199 },
+    { 0, 3, 3, 10202, 10202 },
+    { 0, 3, 3, 10205, 10205 },
+    { 0, 3, 3, 10208, 10208 },
+    { 0, 3, 3, 10211, 10211 },
+    { 0, 3, 3, 10214, 10214 },
+    { 0, 3, 3, 10217, 10217 },
+    { 0, 3, 3, 10220, 10220 },
+    { 0, 3, 3, 10223, 10223 },
+    { 1, 3, 0, 10226, 30 },
+    { 1, 3, 0, 10229, 30 },
+    { 1, 3, 0, 10232, 30 },
+    { 1, 3, 0, 10235, 30 },
+    { 0, 3, 3, 10238, 10238 },
+    { 0, 3, 3, 10241, 10241 },
+    { 0, 3, 3, 10244, 10244 },
+    { 0, 3, 3, 10247, 10247 },
+    { 0, 3, 3, 10250, 10250 },
+    { 0, 3, 3, 10253, 10253 },
+    { 0, 3, 3, 10256, 10256 },
+    { 0, 3, 3, 10259, 10259 },
+    { 0, 3, 3, 10262, 10262 },
+    { 0, 3, 3, 10265, 10265 },
+    { 0, 3, 3, 10268, 10268 },
+    { 0, 3, 3, 10271, 10271 },
+    { 0, 3, 3, 10274, 10274 },
+    { 0, 3, 3, 10277, 10277 },
+    { 0, 3, 3, 10280, 10280 },
+    { 0, 3, 3, 10283, 10283 },
+    { 0, 3, 3, 10286, 10286 },
+    { 0, 3, 3, 10289, 10289 },
+    { 0, 3, 3, 10292, 10292 },
+    { 0, 3, 3, 10295, 10295 },
+    { 0, 3, 3, 10298, 10298 },
+    { 0, 3, 3, 10301, 10301 },
+    { 0, 3, 3, 10304, 10304 },
+    { 0, 3, 3, 10307, 10307 },
+    { 0, 3, 3, 10310, 10310 },
+    { 0, 3, 3, 10313, 10313 },
+    { 0, 3, 3, 10316, 10316 },
+    { 0, 3, 3, 10319, 10319 },
+    { 0, 3, 3, 10322, 10322 },
+    { 0, 3, 3, 10325, 10325 },
+    { 0, 3, 3, 10328, 10328 },
+    { 0, 3, 3, 10331, 10331 },
+    { 0, 3, 3, 10334, 10334 },
+    { 0, 3, 3, 10337, 10337 },
+    { 0, 3, 3, 10340, 10340 },
+    { 0, 3, 3, 10343, 10343 },
+    { 0, 3, 3, 10346, 10346 },
+    { 0, 3, 3, 10349, 10349 },
+    { 0, 3, 3, 10352, 10352 },
+    { 0, 3, 3, 10355, 10355 },
+    { 0, 3, 3, 10358, 10358 },
+    { 0, 3, 3, 10361, 10361 },
+    { 0, 3, 3, 10364, 10364 },
+    { 0, 3, 3, 10367, 10367 },
+    { 0, 3, 3, 10370, 10370 },
+    { 0, 3, 3, 10373, 10373 },
+    { 0, 3, 3, 10376, 10376 },
+    { 0, 3, 3, 10379, 10379 },
+    { 0, 3, 3, 10382, 10382 },
+    { 0, 3, 3, 10385, 10385 },
+    { 0, 3, 3, 10388, 10388 },
+    { 0, 3, 3, 10391, 10391 },
+    { 0, 3, 3, 10394, 10394 },
+    { 0, 3, 3, 10397, 10397 },
+    { 0, 3, 3, 10400, 10400 },
+    { 0, 3, 3, 10403, 10403 },
+    { 0, 3, 3, 10406, 10406 },
+    { 0, 3, 3, 10409, 10409 },
+    { 0, 3, 3, 10412, 10412 },
+    { 0, 2, 2, 10415, 10415 },
+    { 0, 2, 2, 10417, 10417 },
+    { 0, 2, 2, 10419, 10419 },
+    { 0, 3, 3, 10421, 10421 },
+    { 0, 3, 3, 10424, 10424 },
+    { 0, 3, 3, 10427, 10427 },
+    { 0, 3, 3, 10430, 10430 },
+    { 0, 3, 3, 10433, 10433 },
+    { 0, 3, 3, 10436, 10436 },
+    { 0, 3, 3, 10439, 10439 },
+    { 0, 3, 3, 10442, 10442 },
+    { 0, 3, 3, 10445, 10445 },
+    { 0, 3, 3, 10448, 10448 },
+    { 0, 3, 3, 10451, 10451 },
+    { 0, 3, 3, 10454, 10454 },
+    { 0, 3, 3, 10457, 10457 },
+    { 0, 3, 3, 10460, 10460 },
+    { 0, 3, 3, 10463, 10463 },
+    { 0, 3, 3, 10466, 10466 },
+    { 0, 3, 3, 10469, 10469 },
+    { 1, 3, 0, 10472, 30 },
+    { 1, 3, 0, 10475, 30 },
+    { 1, 3, 0, 10478, 30 },
+    { 1, 3, 0, 10481, 30 },
+    { 1, 3, 0, 10484, 30 },
+    { 1, 3, 0, 10487, 30 },
+    { 1, 3, 0, 10490, 30 },
+    { 1, 3, 0, 10493, 30 },
+    { 1, 3, 0, 10496, 30 },
+    { 1, 3, 0, 10499, 30 },
+    { 1, 3, 0, 10502, 30 },
+    { 1, 3, 0, 10505, 30 },
+    { 1, 3, 0, 10508, 30 },
+    { 1, 3, 0, 10511, 30 },
+    { 1, 3, 0, 10514, 30 },
+    { 1, 3, 0, 10517, 30 },
+    { 1, 3, 0, 10520, 30 },
+    { 1, 3, 0, 10523, 30 },
+    { 1, 3, 0, 10526, 30 },
+    { 1, 3, 0, 10529, 30 },
+    { 1, 3, 0, 10532, 30 },
+    { 1, 3, 0, 10535, 30 },
+    { 1, 3, 0, 10538, 30 },
+    { 1, 3, 0, 10541, 30 },
+    { 1, 3, 0, 10544, 30 },
+    { 1, 3, 0, 10547, 30 },
+    { 1, 3, 0, 10550, 30 },
+    { 1, 3, 0, 10553, 30 },
+    { 1, 3, 0, 10556, 30 },
+    { 1, 3, 0, 10559, 30 },
+    { 1, 3, 0, 10562, 30 },
+    { 1, 3, 0, 10565, 30 },
+    { 1, 3, 0, 10568, 30 },
+    { 1, 3, 0, 10571, 30 },
+    { 1, 3, 0, 10574, 30 },
+    { 1, 3, 0, 10577, 30 },
+    { 1, 3, 0, 10580, 30 },
+    { 1, 3, 0, 10583, 30 },
+    { 1, 3, 0, 10586, 30 },
+    { 1, 3, 0, 10589, 30 },
+    { 1, 3, 0, 10592, 30 },
+    { 1, 3, 0, 10595, 30 },
+    { 1, 3, 0, 10598, 30 },
+    { 1, 3, 0, 10601, 30 },
+    { 1, 3, 0, 10604, 30 },
+    { 1, 3, 0, 10607, 30 },
+    { 1, 3, 0, 10610, 30 },
+    { 1, 3, 0, 10613, 30 },
+    { 1, 3, 0, 10616, 30 },
+    { 1, 3, 0, 10619, 30 },
+    { 1, 3, 0, 10622, 30 },
+    { 1, 3, 0, 10625, 30 },
+    { 1, 3, 0, 10628, 30 },
+    { 1, 3, 0, 10631, 30 },
+    { 1, 3, 0, 10634, 30 },
+    { 1, 3, 0, 10637, 30 },
+    { 1, 3, 0, 10640, 30 },
+    { 1, 3, 0, 10643, 30 },
+    { 1, 3, 0, 10646, 30 },
+    { 1, 3, 0, 10649, 30 },
+    { 1, 3, 0, 10652, 30 },
+    { 1, 3, 0, 10655, 30 },
+    { 1, 3, 0, 10658, 30 },
+    { 1, 3, 0, 10661, 30 },
+    { 1, 3, 0, 10664, 30 },
+    { 1, 3, 0, 10667, 30 },
+    { 1, 3, 0, 10670, 30 },
+    { 1, 3, 0, 10673, 30 },
+    { 1, 3, 0, 10676, 30 },
+    { 1, 3, 0, 10679, 30 },
+    { 1, 3, 0, 10682, 30 },
+    { 1, 3, 0, 10685, 30 },
+    { 1, 3, 0, 10688, 30 },
+    { 1, 3, 0, 10691, 30 },
+    { 1, 3, 0, 10694, 30 },
+    { 1, 3, 0, 10697, 30 },
+    { 1, 3, 0, 10700, 30 },
+    { 1, 3, 0, 10703, 30 },
+    { 1, 3, 0, 10706, 30 },
+    { 1, 3, 0, 10709, 30 },
+    { 1, 3, 0, 10712, 30 },
+    { 1, 3, 0, 10715, 30 },
+    { 0, 3, 3, 10718, 10718 },
+    { 0, 3, 3, 10721, 10721 },
+    { 0, 2, 2, 10724, 10724 },
+    { 0, 3, 3, 10726, 10726 },
+    { 0, 3, 3, 10729, 10729 },
+    { 0, 3, 3, 10732, 10732 },
+    { 0, 3, 3, 10735, 10735 },
+    { 0, 3, 3, 10738, 10738 },
+    { 0, 3, 3, 10741, 10741 },
+    { 0, 3, 3, 10744, 10744 },
+    { 0, 3, 3, 10747, 10747 },
+    { 0, 3, 3, 10750, 10750 },
+    { 0, 3, 3, 10753, 10753 },
+    { 0, 3, 3, 10756, 10756 },
+    { 0, 3, 3, 10759, 10759 },
+    { 0, 3, 3, 10762, 10762 },
+    { 0, 3, 3, 10765, 10765 },
+    { 0, 3, 3, 10768, 10768 },
+    { 0, 3, 3, 10771, 10771 },
+    { 0, 3, 3, 10774, 10774 },
+    { 0, 3, 3, 10777, 10777 },
+    { 0, 3, 3, 10780, 10780 },
+    { 0, 3, 3, 10783, 10783 },
+    { 0, 3, 3, 10786, 10786 },
+    { 0, 3, 3, 10789, 10789 },
+    { 0, 3, 3, 10792, 10792 },
+    { 0, 3, 3, 10795, 10795 },
+    { 0, 3, 3, 10798, 10798 },
+    { 0, 3, 3, 10801, 10801 },
+    { 0, 3, 3, 10804, 10804 },
+    { 0, 3, 3, 10807, 10807 },
+    { 0, 3, 3, 10810, 10810 },
+    { 0, 3, 3, 10813, 10813 },
+    { 0, 3, 3, 10816, 10816 },
+    { 0, 3, 3, 10819, 10819 },
+    { 0, 3, 3, 10822, 10822 },
+    { 0, 3, 3, 10825, 10825 },
+    { 0, 3, 3, 10828, 10828 },
+    { 0, 3, 3, 10831, 10831 },
+    { 0, 3, 3, 10834, 10834 },
+    { 0, 3, 3, 10837, 10837 },
+    { 0, 3, 3, 10840, 10840 },
+    { 0, 3, 3, 10843, 10843 },
+    { 0, 3, 3, 10846, 10846 },
+    { 0, 3, 3, 10849, 10849 },
+    { 0, 3, 3, 10852, 10852 },
+    { 0, 3, 3, 10855, 10855 },
+    { 0, 3, 3, 10858, 10858 },
+    { 0, 3, 3, 10861, 10861 },
+    { 0, 3, 3, 10864, 10864 },
+    { 0, 3, 3, 10867, 10867 },
+    { 0, 3, 3, 10870, 10870 },
+    { 0, 3, 3, 10873, 10873 },
+    { 0, 3, 3, 10876, 10876 },
+    { 0, 3, 3, 10879, 10879 },
+    { 0, 3, 3, 10882, 10882 },
+    { 0, 3, 3, 10885, 10885 },
+    { 0, 3, 3, 10888, 10888 },
+    { 0, 3, 3, 10891, 10891 },
+    { 0, 3, 3, 10894, 10894 },
+    { 0, 3, 3, 10897, 10897 },
+    { 0, 3, 3, 10900, 10900 },
+    { 0, 3, 3, 10903, 10903 },
+    { 0, 3, 3, 10906, 10906 },
+    { 0, 3, 3, 10909, 10909 },
+    { 0, 3, 3, 10912, 10912 },
+    { 0, 3, 3, 10915, 10915 },
+    { 0, 3, 3, 10918, 10918 },
+    { 0, 3, 3, 10921, 10921 },
+    { 0, 3, 3, 10924, 10924 },
+    { 0, 3, 3, 10927, 10927 },
+    { 0, 3, 3, 10930, 10930 },
+    { 0, 3, 3, 10933, 10933 },
+    { 0, 3, 3, 10936, 10936 },
+    { 0, 3, 3, 10939, 10939 },
+    { 0, 3, 3, 10942, 10942 },
+    { 0, 3, 3, 10945, 10945 },
+    { 0, 3, 3, 10948, 10948 },
+    { 0, 3, 3, 10951, 10951 },
+    { 0, 3, 3, 10954, 10954 },
+    { 0, 3, 3, 10957, 10957 },
+    { 0, 3, 3, 10960, 10960 },
+    { 0, 3, 3, 10963, 10963 },
+    { 1, 3, 0, 10966, 30 },
+    { 1, 3, 0, 10969, 30 },
+    { 1, 3, 0, 10972, 30 },
+    { 0, 3, 3, 10975, 10975 },
+    { 0, 3, 3, 10978, 10978 },
+    { 0, 3, 3, 10981, 10981 },
+    { 0, 3, 3, 10984, 10984 },
+    { 0, 3, 3, 10987, 10987 },
+    { 0, 3, 3, 10990, 10990 },
+    { 0, 3, 3, 10993, 10993 },
+    { 0, 3, 3, 10996, 10996 },
+    { 0, 3, 3, 10999, 10999 },
+    { 0, 3, 3, 11002, 11002 },
+    { 0, 3, 3, 11005, 11005 },
+    { 0, 3, 3, 11008, 11008 },
+    { 0, 3, 3, 11011, 11011 },
+    { 0, 3, 3, 11014, 11014 },
+    { 0, 3, 3, 11017, 11017 },
+    { 0, 3, 3, 11020, 11020 },
+    { 0, 3, 3, 11023, 11023 },
+    { 0, 3, 3, 11026, 11026 },
+    { 0, 3, 3, 11029, 11029 },
+    { 0, 3, 3, 11032, 11032 },
+    { 0, 3, 3, 11035, 11035 },
+    { 0, 3, 3, 11038, 11038 },
+    { 0, 3, 3, 11041, 11041 },
+    { 0, 3, 3, 11044, 11044 },
+    { 0, 3, 3, 11047, 11047 },
+    { 0, 3, 3, 11050, 11050 },
+    { 0, 3, 3, 11053, 11053 },
+    { 0, 3, 3, 11056, 11056 },
+    { 0, 3, 3, 11059, 11059 },
+    { 0, 3, 3, 11062, 11062 },
+    { 0, 3, 3, 11065, 11065 },
+    { 0, 3, 3, 11068, 11068 },
+    { 0, 3, 3, 11071, 11071 },
+    { 0, 3, 3, 11074, 11074 },
+    { 0, 3, 3, 11077, 11077 },
+    { 0, 3, 3, 11080, 11080 },
+    { 0, 3, 3, 11083, 11083 },
+    { 0, 3, 3, 11086, 11086 },
+    { 0, 3, 3, 11089, 11089 },
+    { 0, 3, 3, 11092, 11092 },
+    { 0, 3, 3, 11095, 11095 },
+    { 0, 3, 3, 11098, 11098 },
+    { 0, 3, 3, 11101, 11101 },
+    { 0, 3, 3, 11104, 11104 },
+    { 0, 3, 3, 11107, 11107 },
+    { 0, 3, 3, 11110, 11110 },
+    { 0, 3, 3, 11113, 11113 },
+    { 0, 3, 3, 11116, 11116 },
+    { 0, 3, 3, 11119, 11119 },
+    { 0, 3, 3, 11122, 11122 },
+    { 0, 3, 3, 11125, 11125 },
+    { 0, 3, 3, 11128, 11128 },
+    { 0, 3, 3, 11131, 11131 },
+    { 0, 3, 3, 11134, 11134 },
+    { 0, 3, 3, 11137, 11137 },
+    { 0, 3, 3, 11140, 11140 },
+    { 0, 3, 3, 11143, 11143 },
+    { 0, 3, 3, 11146, 11146 },
+    { 0, 3, 3, 11149, 11149 },
+    { 0, 3, 3, 11152, 11152 },
+    { 0, 3, 3, 11155, 11155 },
+    { 0, 3, 3, 11158, 11158 },
+    { 0, 3, 3, 11161, 11161 },
+    { 0, 3, 3, 11164, 11164 },
+    { 0, 3, 3, 11167, 11167 },
+    { 0, 3, 3, 11170, 11170 },
+    { 0, 3, 3, 11173, 11173 },
+    { 0, 3, 3, 11176, 11176 },
+    { 0, 3, 3, 11179, 11179 },
+    { 0, 3, 3, 11182, 11182 },
+    { 0, 3, 3, 11185, 11185 },
+    { 0, 3, 3, 11188, 11188 },
+    { 0, 3, 3, 11191, 11191 },
+    { 0, 3, 3, 11194, 11194 },
+    { 0, 3, 3, 11197, 11197 },
+    { 0, 3, 3, 11200, 11200 },
+    { 0, 3, 3, 11203, 11203 },
+    { 0, 3, 3, 11206, 11206 },
+    { 0, 3, 3, 11209, 11209 },
+    { 0, 3, 3, 11212, 11212 },
+    { 0, 3, 3, 11215, 11215 },
+    { 0, 3, 3, 11218, 11218 },
+    { 0, 3, 3, 11221, 11221 },
+    { 0, 3, 3, 11224, 11224 },
+    { 0, 3, 3, 11227, 11227 },
+    { 0, 3, 3, 11230, 11230 },
+    { 0, 3, 3, 11233, 11233 },
+    { 0, 3, 3, 11236, 11236 },
+    { 0, 3, 3, 11239, 11239 },
+    { 0, 3, 3, 11242, 11242 },
+    { 0, 3, 3, 11245, 11245 },
+    { 0, 3, 3, 11248, 11248 },
+    { 0, 3, 3, 11251, 11251 },
+    { 0, 3, 3, 11254, 11254 },
+    { 0, 3, 3, 11257, 11257 },
+    { 0, 3, 3, 11260, 11260 },
+    { 0, 3, 3, 11263, 11263 },
+    { 0, 3, 3, 11266, 11266 },
+    { 0, 3, 3, 11269, 11269 },
+    { 0, 3, 3, 11272, 11272 },
+    { 0, 3, 3, 11275, 11275 },
+    { 0, 3, 3, 11278, 11278 },
+    { 0, 3, 3, 11281, 11281 },
+    { 0, 3, 3, 11284, 11284 },
+    { 0, 3, 3, 11287, 11287 },
+    { 0, 3, 3, 11290, 11290 },
+    { 0, 3, 3, 11293, 11293 },
+    { 0, 3, 3, 11296, 11296 },
+    { 0, 3, 3, 11299, 11299 },
+    { 0, 3, 3, 11302, 11302 },
+    { 0, 3, 3, 11305, 11305 },
+    { 0, 3, 3, 11308, 11308 },
+    { 0, 3, 3, 11311, 11311 },
+    { 0, 3, 3, 11314, 11314 },
+    { 0, 3, 3, 11317, 11317 },
+    { 0, 3, 3, 11320, 11320 },
+    { 0, 3, 3, 11323, 11323 },
+    { 0, 3, 3, 11326, 11326 },
+    { 0, 3, 3, 11329, 11329 },
+    { 0, 3, 3, 11332, 11332 },
+    { 0, 3, 3, 11335, 11335 },
+    { 0, 3, 3, 11338, 11338 },
+    { 0, 3, 3, 11341, 11341 },
+    { 0, 3, 3, 11344, 11344 },
+    { 0, 3, 3, 11347, 11347 },
+    { 0, 3, 3, 11350, 11350 },
+    { 0, 3, 3, 11353, 11353 },
+    { 0, 3, 3, 11356, 11356 },
+    { 0, 3, 3, 11359, 11359 },
+    { 0, 3, 3, 11362, 11362 },
+    { 0, 3, 3, 11365, 11365 },
+    { 0, 3, 3, 11368, 11368 },
+    { 0, 3, 3, 11371, 11371 },
+    { 0, 3, 3, 11374, 11374 },
+    { 0, 3, 3, 11377, 11377 },
+    { 0, 3, 3, 11380, 11380 },
+    { 0, 3, 3, 11383, 11383 },
+    { 0, 3, 3, 11386, 11386 },
+    { 0, 3, 3, 11389, 11389 },
+    { 0, 3, 3, 11392, 11392 },
+    { 0, 3, 3, 11395, 11395 },
+    { 0, 3, 3, 11398, 11398 },
+    { 0, 3, 3, 11401, 11401 },
+    { 0, 3, 3, 11404, 11404 },
+    { 0, 3, 3, 11407, 11407 },
+    { 0, 3, 3, 11410, 11410 },
+    { 0, 3, 3, 11413, 11413 },
+    { 0, 3, 3, 11416, 11416 },
+    { 0, 3, 3, 11419, 11419 },
+    { 0, 3, 3, 11422, 11422 },
+    { 0, 3, 3, 11425, 11425 },
+    { 0, 3, 3, 11428, 11428 },
+    { 0, 3, 3, 11431, 11431 },
+    { 0, 3, 3, 11434, 11434 },
+    { 0, 3, 3, 11437, 11437 },
+    { 0, 3, 3, 11440, 11440 },
+    { 0, 3, 3, 11443, 11443 },
+    { 0, 3, 3, 11446, 11446 },
+    { 0, 3, 3, 11449, 11449 },
+    { 0, 3, 3, 11452, 11452 },
+    { 0, 3, 3, 11455, 11455 },
+    { 0, 3, 3, 11458, 11458 },
+    { 0, 3, 3, 11461, 11461 },
+    { 0, 3, 3, 11464, 11464 },
+    { 0, 3, 3, 11467, 11467 },
+    { 0, 3, 3, 11470, 11470 },
+    { 0, 3, 3, 11473, 11473 },
+    { 0, 3, 3, 11476, 11476 },
+    { 0, 3, 3, 11479, 11479 },
+    { 0, 3, 3, 11482, 11482 },
+    { 0, 3, 3, 11485, 11485 },
+    { 0, 3, 3, 11488, 11488 },
+    { 0, 3, 3, 11491, 11491 },
+    { 0, 3, 3, 11494, 11494 },
+    { 0, 3, 3, 11497, 11497 },
+    { 0, 3, 3, 11500, 11500 },
+    { 0, 3, 3, 11503, 11503 },
+    { 0, 3, 3, 11506, 11506 },
+    { 0, 3, 3, 11509, 11509 },
+    { 0, 3, 3, 11512, 11512 },
+    { 0, 3, 3, 11515, 11515 },
+    { 0, 3, 3, 11518, 11518 },
+    { 0, 3, 3, 11521, 11521 },
+    { 0, 3, 3, 11524, 11524 },
+    { 0, 3, 3, 11527, 11527 },
+    { 0, 3, 3, 11530, 11530 },
+    { 0, 3, 3, 11533, 11533 },
+    { 0, 3, 3, 11536, 11536 },
+    { 0, 3, 3, 11539, 11539 },
+    { 0, 3, 3, 11542, 11542 },
+    { 0, 3, 3, 11545, 11545 },
+    { 0, 3, 3, 11548, 11548 },
+    { 0, 3, 3, 11551, 11551 },
+    { 0, 3, 3, 11554, 11554 },
+    { 0, 3, 3, 11557, 11557 },
+    { 0, 3, 3, 11560, 11560 },
+    { 0, 3, 3, 11563, 11563 },
+    { 0, 3, 3, 11566, 11566 },
+    { 0, 3, 3, 11569, 11569 },
+    { 0, 3, 3, 11572, 11572 },
+    { 0, 3, 3, 11575, 11575 },
+    { 0, 3, 3, 11578, 11578 },
+    { 0, 3, 3, 11581, 11581 },
+    { 0, 3, 3, 11584, 11584 },
+    { 0, 3, 3, 11587, 11587 },
+    { 0, 3, 3, 11590, 11590 },
+    { 0, 3, 3, 11593, 11593 },
+    { 0, 3, 3, 11596, 11596 },
+    { 0, 3, 3, 11599, 11599 },
+    { 0, 3, 3, 11602, 11602 },
+    { 0, 3, 3, 11605, 11605 },
+    { 0, 3, 3, 11608, 11608 },
+    { 0, 3, 3, 11611, 11611 },
+    { 0, 3, 3, 11614, 11614 },
+    { 0, 3, 3, 11617, 11617 },
+    { 0, 3, 3, 11620, 11620 },
+    { 0, 3, 3, 11623, 11623 },
+    { 0, 3, 3, 11626, 11626 },
+    { 0, 3, 3, 11629, 11629 },
+    { 0, 3, 3, 11632, 11632 },
+    { 0, 3, 3, 11635, 11635 },
+    { 0, 3, 3, 11638, 11638 },
+    { 0, 3, 3, 11641, 11641 },
+    { 0, 3, 3, 11644, 11644 },
+    { 0, 3, 3, 11647, 11647 },
+    { 0, 3, 3, 11650, 11650 },
+    { 0, 3, 3, 11653, 11653 },
+    { 0, 3, 3, 11656, 11656 },
+    { 0, 3, 3, 11659, 11659 },
+    { 0, 3, 3, 11662, 11662 },
+    { 0, 3, 3, 11665, 11665 },
+    { 0, 3, 3, 11668, 11668 },
+    { 0, 3, 3, 11671, 11671 },
+    { 0, 3, 3, 11674, 11674 },
+    { 0, 3, 3, 11677, 11677 },
+    { 0, 3, 3, 11680, 11680 },
+    { 0, 3, 3, 11683, 11683 },
+    { 0, 3, 3, 11686, 11686 },
+    { 0, 3, 3, 11689, 11689 },
+    { 0, 3, 3, 11692, 11692 },
+    { 0, 3, 3, 11695, 11695 },
+    { 0, 3, 3, 11698, 11698 },
+    { 0, 3, 3, 11701, 11701 },
+    { 0, 3, 3, 11704, 11704 },
+    { 0, 3, 3, 11707, 11707 },
+    { 0, 3, 3, 11710, 11710 },
+    { 0, 3, 3, 11713, 11713 },
+    { 0, 3, 3, 11716, 11716 },
+    { 0, 3, 3, 11719, 11719 },
+    { 0, 3, 3, 11722, 11722 },
+    { 0, 3, 3, 11725, 11725 },
+    { 0, 3, 3, 11728, 11728 },
+    { 0, 3, 3, 11731, 11731 },
+    { 0, 3, 3, 11734, 11734 },
+    { 0, 3, 3, 11737, 11737 },
+    { 0, 3, 3, 11740, 11740 },
+    { 0, 3, 3, 11743, 11743 },
+    { 0, 3, 3, 11746, 11746 },
+    { 0, 3, 3, 11749, 11749 },
+    { 0, 3, 3, 11752, 11752 },
+    { 0, 3, 3, 11755, 11755 },
+    { 0, 3, 3, 11758, 11758 },
+    { 0, 3, 3, 11761, 11761 },
+    { 0, 3, 3, 11764, 11764 },
+    { 0, 3, 3, 11767, 11767 },
+    { 0, 3, 3, 11770, 11770 },
+    { 0, 3, 3, 11773, 11773 },
+    { 0, 3, 3, 11776, 11776 },
+    { 0, 3, 3, 11779, 11779 },
+    { 0, 3, 3, 11782, 11782 },
+    { 0, 3, 3, 11785, 11785 },
+    { 0, 3, 3, 11788, 11788 },
+    { 0, 3, 3, 11791, 11791 },
+    { 0, 3, 3, 11794, 11794 },
+    { 0, 3, 3, 11797, 11797 },
+    { 0, 3, 3, 11800, 11800 },
+    { 0, 3, 3, 11803, 11803 },
+    { 0, 3, 3, 11806, 11806 },
+    { 0, 3, 3, 11809, 11809 },
+    { 0, 3, 3, 11812, 11812 },
+    { 0, 3, 3, 11815, 11815 },
+    { 0, 3, 3, 11818, 11818 },
+    { 0, 3, 3, 11821, 11821 },
+    { 0, 3, 3, 11824, 11824 },
+    { 0, 3, 3, 11827, 11827 },
+    { 0, 3, 3, 11830, 11830 },
+    { 0, 3, 3, 11833, 11833 },
+    { 0, 3, 3, 11836, 11836 },
+    { 0, 3, 3, 11839, 11839 },
+    { 0, 3, 3, 11842, 11842 },
+    { 0, 3, 3, 11845, 11845 },
+    { 0, 3, 3, 11848, 11848 },
+    { 0, 3, 3, 11851, 11851 },
+    { 0, 3, 3, 11854, 11854 },
+    { 0, 3, 3, 11857, 11857 },
+    { 0, 3, 3, 11860, 11860 },
+    { 0, 3, 3, 11863, 11863 },
+    { 0, 3, 3, 11866, 11866 },
+    { 0, 3, 3, 11869, 11869 },
+    { 0, 3, 3, 11872, 11872 },
+    { 0, 3, 3, 11875, 11875 },
+    { 0, 3, 3, 11878, 11878 },
+    { 0, 3, 3, 11881, 11881 },
+    { 0, 3, 3, 11884, 11884 },
+    { 0, 3, 3, 11887, 11887 },
+    { 0, 3, 3, 11890, 11890 },
+    { 0, 3, 3, 11893, 11893 },
+    { 0, 3, 3, 11896, 11896 },
+    { 0, 3, 3, 11899, 11899 },
+    { 0, 3, 3, 11902, 11902 },
+    { 0, 3, 3, 11905, 11905 },
+    { 0, 3, 3, 11908, 11908 },
+    { 0, 3, 3, 11911, 11911 },
+    { 0, 3, 3, 11914, 11914 },
+    { 0, 3, 3, 11917, 11917 },
+    { 0, 3, 3, 11920, 11920 },
+    { 0, 3, 3, 11923, 11923 },
+    { 0, 3, 3, 11926, 11926 },
+    { 0, 3, 3, 11929, 11929 },
+    { 0, 3, 3, 11932, 11932 },
+    { 0, 3, 3, 11935, 11935 },
+    { 0, 3, 3, 11938, 11938 },
+    { 0, 3, 3, 11941, 11941 },
+    { 0, 3, 3, 11944, 11944 },
+    { 0, 3, 3, 11947, 11947 },
+    { 0, 4, 4, 11950, 11950 },
+    { 0, 3, 3, 11954, 11954 },
+    { 0, 3, 3, 11957, 11957 },
+    { 0, 3, 3, 11960, 11960 },
+    { 0, 3, 3, 11963, 11963 },
+    { 0, 3, 3, 11966, 11966 },
+    { 0, 3, 3, 11969, 11969 },
+    { 0, 3, 3, 11972, 11972 },
+    { 0, 3, 3, 11975, 11975 },
+    { 0, 3, 3, 11978, 11978 },
+    { 0, 3, 3, 11981, 11981 },
+    { 0, 3, 3, 11984, 11984 },
+    { 0, 3, 3, 11987, 11987 },
+    { 0, 3, 3, 11990, 11990 },
+    { 0, 3, 3, 11993, 11993 },
+    { 0, 3, 3, 11996, 11996 },
+    { 0, 3, 3, 11999, 11999 },
+    { 0, 3, 3, 12002, 12002 },
+    { 0, 3, 3, 12005, 12005 },
+    { 0, 3, 3, 12008, 12008 },
+    { 0, 3, 3, 12011, 12011 },
+    { 0, 3, 3, 12014, 12014 },
+    { 0, 3, 3, 12017, 12017 },
+    { 0, 3, 3, 12020, 12020 },
+    { 0, 3, 3, 12023, 12023 },
+    { 0, 3, 3, 12026, 12026 },
+    { 0, 3, 3, 12029, 12029 },
+    { 0, 3, 3, 12032, 12032 },
+    { 0, 3, 3, 12035, 12035 },
+    { 0, 3, 3, 12038, 12038 },
+    { 0, 3, 3, 12041, 12041 },
+    { 0, 3, 3, 12044, 12044 },
+    { 0, 3, 3, 12047, 12047 },
+    { 0, 3, 3, 12050, 12050 },
+    { 0, 3, 3, 12053, 12053 },
+    { 0, 3, 3, 12056, 12056 },
+    { 0, 3, 3, 12059, 12059 },
+    { 0, 3, 3, 12062, 12062 },
+    { 0, 3, 3, 12065, 12065 },
+    { 0, 3, 3, 12068, 12068 },
+    { 0, 3, 3, 12071, 12071 },
+    { 0, 3, 3, 12074, 12074 },
+    { 0, 3, 3, 12077, 12077 },
+    { 0, 3, 3, 12080, 12080 },
+    { 0, 3, 3, 12083, 12083 },
+    { 0, 3, 3, 12086, 12086 },
+    { 0, 3, 3, 12089, 12089 },
+    { 0, 3, 3, 12092, 12092 },
+    { 0, 3, 3, 12095, 12095 },
+    { 0, 3, 3, 12098, 12098 },
+    { 0, 3, 3, 12101, 12101 },
+    { 0, 3, 3, 12104, 12104 },
+    { 0, 3, 3, 12107, 12107 },
+    { 0, 3, 3, 12110, 12110 },
+    { 0, 3, 3, 12113, 12113 },
+    { 0, 3, 3, 12116, 12116 },
+    { 0, 3, 3, 12119, 12119 },
+    { 0, 3, 3, 12122, 12122 },
+    { 0, 3, 3, 12125, 12125 },
+    { 0, 3, 3, 12128, 12128 },
+    { 0, 3, 3, 12131, 12131 },
+    { 0, 3, 3, 12134, 12134 },
+    { 0, 3, 3, 12137, 12137 },
+    { 0, 3, 3, 12140, 12140 },
+    { 0, 3, 3, 12143, 12143 },
+    { 0, 3, 3, 12146, 12146 },
+    { 0, 3, 3, 12149, 12149 },
+    { 0, 3, 3, 12152, 12152 },
+    { 0, 3, 3, 12155, 12155 },
+    { 0, 3, 3, 12158, 12158 },
+    { 0, 4, 4, 12161, 12161 },
+    { 0, 4, 4, 12165, 12165 },
+    { 0, 4, 4, 12169, 12169 },
+    { 0, 3, 3, 12173, 12173 },
+    { 0, 3, 3, 12176, 12176 },
+    { 0, 3, 3, 12179, 12179 },
+    { 0, 4, 4, 12182, 12182 },
+    { 0, 4, 4, 12186, 12186 },
+    { 0, 4, 4, 12190, 12190 },
+    { 0, 3, 3, 12194, 12194 },
+    { 0, 3, 3, 12197, 12197 },
+    { 0, 2, 2, 12200, 12200 },
+    { 0, 2, 2, 12202, 12202 },
+    { 0, 2, 2, 12204, 12204 },
+    { 0, 3, 3, 12206, 12206 },
+    { 0, 3, 3, 12209, 12209 },
+    { 0, 2, 2, 12212, 12212 },
+    { 0, 4, 4, 12214, 12214 },
+    { 0, 4, 4, 12218, 12218 },
+    { 0, 4, 4, 12222, 12222 },
+    { 0, 4, 4, 12226, 12226 },
+    { 0, 4, 4, 12230, 12230 },
+    { 0, 4, 2, 12234, 12238 },
+    { 1, 3, 0, 12240, 30 },
+    { 0, 4, 2, 12243, 12247 },
+    { 0, 2, 2, 12249, 12249 },
+    { 0, 2, 2, 12251, 12251 },
+    { 0, 2, 2, 12253, 12253 },
+    { 0, 2, 2, 12255, 12255 },
+    { 0, 2, 2, 12257, 12257 },
+    { 0, 2, 2, 12259, 12259 },
+    { 0, 2, 2, 12261, 12261 },
+    { 0, 4, 2, 12263, 12267 },
+    { 0, 4, 2, 12269, 12267 },
+    { 0, 6, 2, 12273, 12267 },
+    { 0, 6, 2, 12279, 12267 },
+    { 0, 4, 2, 12285, 5011 },
+    { 0, 4, 2, 12289, 5011 },
+    { 0, 4, 2, 12293, 5011 },
+    { 0, 4, 2, 12297, 5013 },
+    { 0, 4, 2, 12301, 5015 },
+    { 0, 4, 2, 12305, 5017 },
+    { 0, 4, 2, 12309, 12251 },
+    { 0, 4, 2, 12313, 12317 },
+    { 0, 4, 2, 12319, 12323 },
+    { 0, 4, 2, 12325, 12329 },
+    { 0, 4, 2, 12331, 12238 },
+    { 0, 4, 2, 12335, 12339 },
+    { 0, 4, 2, 12341, 12253 },
+    { 0, 4, 2, 12345, 12255 },
+    { 0, 4, 2, 12349, 12353 },
+    { 0, 4, 2, 12355, 12359 },
+    { 0, 4, 2, 12361, 12365 },
+    { 0, 4, 2, 12367, 12371 },
+    { 0, 4, 2, 12373, 12377 },
+    { 0, 4, 2, 12379, 12383 },
+    { 0, 4, 2, 12385, 12389 },
+    { 0, 4, 2, 12391, 12259 },
+    { 0, 4, 2, 12395, 12267 },
+    { 0, 4, 2, 12399, 12261 },
+    { 0, 4, 2, 12403, 12317 },
+    { 0, 4, 2, 12407, 5013 },
+    { 0, 4, 2, 12411, 12253 },
+    { 0, 4, 2, 12415, 12377 },
+    { 0, 4, 4, 12419, 12419 },
+    { 0, 2, 2, 12423, 12423 },
+    { 0, 2, 2, 12425, 12425 },
+    { 0, 2, 2, 12427, 12427 },
+    { 0, 2, 2, 12429, 12429 },
+    { 0, 2, 2, 12431, 12431 },
+    { 0, 2, 2, 12433, 12433 },
+    { 0, 2, 2, 12435, 12435 },
+    { 0, 2, 2, 12437, 12437 },
+    { 0, 2, 2, 12439, 12439 },
+    { 0, 2, 2, 12441, 12441 },
+    { 0, 2, 2, 12443, 12443 },
+    { 0, 2, 2, 12445, 12445 },
+    { 0, 2, 2, 12447, 12447 },
+    { 0, 2, 2, 12449, 12449 },
+    { 0, 2, 2, 12451, 12451 },
+    { 0, 2, 2, 12453, 12453 },
+    { 0, 2, 2, 12455, 12455 },
+    { 0, 2, 2, 12457, 12457 },
+    { 0, 2, 2, 12459, 12459 },
+    { 0, 2, 2, 12461, 12461 },
+    { 0, 2, 2, 12463, 12463 },
+    { 0, 2, 2, 12465, 12465 },
+    { 0, 2, 2, 12467, 12467 },
+    { 0, 2, 2, 12469, 12469 },
+    { 0, 2, 2, 12471, 12471 },
+    { 0, 2, 2, 12473, 1418 },
+    { 0, 2, 2, 1420, 1420 },
+    { 0, 2, 2, 12475, 12475 },
+    { 0, 2, 2, 1422, 1422 },
+    { 0, 2, 2, 12477, 1422 },
+    { 0, 2, 2, 12479, 12479 },
+    { 0, 2, 2, 12481, 12481 },
+    { 0, 2, 2, 12483, 12483 },
+    { 0, 2, 2, 12485, 12485 },
+    { 0, 2, 2, 12487, 12487 },
+    { 0, 2, 2, 12489, 12489 },
+    { 0, 2, 2, 12491, 12491 },
+    { 0, 2, 2, 12493, 12493 },
+    { 0, 2, 2, 12495, 12495 },
+    { 0, 4, 4, 12497, 12501 },
+    { 0, 4, 4, 12505, 12509 },
+    { 0, 4, 4, 12513, 12517 },
+    { 0, 4, 4, 12521, 12525 },
+    { 0, 4, 4, 12529, 12533 },
+    { 0, 4, 4, 12537, 12541 },
+    { 0, 4, 4, 12545, 12549 },
+    { 0, 4, 4, 12553, 12557 },
+    { 0, 2, 2, 12561, 12561 },
+    { 0, 4, 4, 12563, 12567 },
+    { 0, 4, 4, 12571, 12575 },
+    { 0, 4, 4, 12579, 12583 },
+    { 0, 4, 4, 12587, 12591 },
+    { 0, 4, 4, 12595, 12595 },
+    { 0, 4, 4, 12599, 12599 },
+    { 0, 4, 4, 12603, 12603 },
+    { 0, 4, 4, 12607, 12607 },
+    { 0, 4, 4, 12611, 12611 },
+    { 0, 4, 4, 12615, 12615 },
+    { 0, 4, 4, 12619, 12619 },
+    { 0, 4, 4, 12623, 12623 },
+    { 0, 4, 4, 12627, 12627 },
+    { 0, 4, 4, 12631, 12631 },
+    { 0, 4, 4, 12635, 12635 },
+    { 0, 4, 4, 12639, 12639 },
+    { 0, 4, 4, 12643, 12643 },
+    { 0, 4, 4, 12647, 12647 },
+    { 0, 4, 4, 12651, 12651 },
+    { 0, 4, 4, 12655, 12655 },
+    { 0, 4, 4, 12659, 12659 },
+    { 0, 4, 4, 12663, 12663 },
+    { 0, 4, 4, 12667, 12667 },
+    { 0, 4, 4, 12671, 12671 },
+    { 0, 4, 4, 12675, 12675 },
+    { 0, 4, 4, 12679, 12679 },
+    { 0, 4, 4, 12683, 12683 },
+    { 0, 4, 4, 12687, 12687 },
+    { 0, 4, 4, 12691, 12691 },
+    { 0, 4, 4, 12695, 12695 },
+    { 0, 4, 4, 12699, 12699 },
+    { 0, 4, 4, 12703, 12703 },
+    { 0, 4, 4, 12707, 12707 },
+    { 0, 4, 4, 12711, 12711 },
+    { 0, 4, 4, 12715, 12715 },
+    { 0, 4, 4, 12719, 12719 },
+    { 0, 4, 4, 12723, 12723 },
+    { 0, 4, 4, 12727, 12727 },
+    { 0, 4, 4, 12731, 12731 },
+    { 0, 4, 4, 12735, 12735 },
+    { 0, 4, 4, 12739, 12739 },
+    { 0, 4, 4, 12743, 12743 },
+    { 0, 4, 4, 12747, 12747 },
+    { 0, 4, 4, 12751, 12751 },
+    { 0, 4, 4, 12755, 12755 },
+    { 0, 4, 4, 12759, 12759 },
+    { 0, 4, 4, 12763, 12763 },
+    { 0, 4, 4, 12767, 12767 },
+    { 0, 4, 4, 12771, 12771 },
+    { 0, 4, 4, 12775, 12775 },
+    { 0, 4, 4, 12779, 12779 },
+    { 0, 4, 4, 12783, 12783 },
+    { 0, 4, 4, 12787, 12787 },
+    { 0, 4, 4, 12791, 12791 },
+    { 0, 4, 4, 12795, 12795 },
+    { 0, 4, 4, 12799, 12799 },
+    { 0, 4, 4, 12803, 12803 },
+    { 0, 4, 4, 12807, 12807 },
+    { 0, 4, 4, 12811, 12811 },
+    { 0, 4, 4, 12815, 12815 },
+    { 0, 4, 4, 12819, 12819 },
+    { 0, 4, 4, 12823, 12823 },
+    { 0, 4, 4, 12827, 12827 },
+    { 0, 4, 4, 12831, 12831 },
+    { 0, 4, 4, 12835, 12835 },
+    { 0, 4, 4, 12839, 12839 },
+    { 0, 4, 4, 12843, 12843 },
+    { 0, 4, 4, 12847, 12847 },
+    { 0, 4, 4, 12851, 12851 },
+    { 0, 4, 4, 12855, 12855 },
+    { 0, 4, 4, 12859, 12859 },
+    { 0, 4, 4, 12863, 12863 },
+    { 0, 4, 4, 12867, 12867 },
+    { 0, 4, 4, 12871, 12871 },
+    { 0, 4, 4, 12875, 12875 },
+    { 0, 4, 4, 12879, 12879 },
+    { 0, 4, 4, 12883, 12883 },
+    { 0, 4, 4, 12887, 12887 },
+    { 0, 4, 4, 12891, 12891 },
+    { 0, 4, 4, 12895, 12895 },
+    { 0, 4, 4, 12899, 12899 },
+    { 0, 4, 4, 12903, 12903 },
+    { 0, 4, 4, 12907, 12907 },
+    { 0, 4, 4, 12911, 12911 },
+    { 0, 4, 4, 12567, 12567 },
+    { 0, 4, 4, 12575, 12575 },
+    { 0, 4, 4, 12915, 12915 },
+    { 0, 4, 4, 12583, 12583 },
+    { 0, 4, 4, 12557, 12557 },
+    { 0, 4, 4, 12591, 12591 },
+    { 0, 4, 2, 12919, 12923 },
+    { 0, 4, 2, 12925, 12929 },
+    { 0, 4, 2, 12931, 12495 },
+    { 0, 5, 1, 12935, 26 },
+    { 0, 5, 1, 12940, 26 },
+    { 0, 5, 1, 12945, 26 },
+    { 0, 5, 1, 12950, 26 },
+    { 0, 5, 1, 12955, 26 },
+    { 0, 5, 1, 12960, 26 },
+    { 0, 4, 4, 12965, 12969 },
+    { 0, 4, 4, 12973, 12977 },
+    { 0, 4, 4, 12981, 12985 },
+    { 0, 4, 4, 12989, 12989 },
+    { 0, 4, 4, 12993, 12993 },
+    { 0, 4, 4, 12997, 12997 },
+    { 0, 4, 4, 13001, 13001 },
+    { 0, 4, 4, 13005, 13005 },
+    { 0, 4, 4, 13009, 13009 },
+    { 0, 4, 4, 13013, 13013 },
+    { 0, 4, 4, 13017, 13017 },
+    { 0, 4, 4, 13021, 13021 },
+    { 0, 4, 4, 13025, 13025 },
+    { 0, 4, 4, 13029, 13029 },
+    { 0, 4, 4, 13033, 13033 },
+    { 0, 4, 4, 13037, 13037 },
+    { 0, 4, 4, 12969, 12969 },
+    { 0, 4, 4, 12977, 12977 },
+    { 0, 4, 4, 12985, 12985 },
+    { 0, 4, 4, 13041, 12915 },
+    { 0, 4, 4, 13045, 13049 },
+    { 0, 4, 4, 13053, 13053 },
+    { 0, 4, 4, 13057, 13057 },
+    { 0, 4, 4, 13061, 13061 },
+    { 0, 4, 4, 13065, 13065 },
+    { 0, 4, 4, 13069, 13069 },
+    { 0, 4, 2, 13073, 13077 },
+    { 0, 4, 4, 13049, 13049 },
+    { 0, 4, 4, 13079, 13079 },
+    { 0, 4, 4, 13083, 13083 },
+    { 0, 4, 4, 13087, 13087 },
+    { 0, 4, 4, 13091, 13091 },
+    { 0, 6, 2, 13095, 13101 },
+    { 0, 6, 2, 13103, 13101 },
+    { 0, 6, 2, 13109, 13101 },
+    { 0, 4, 4, 13115, 13115 },
+    { 0, 4, 4, 13119, 13119 },
+    { 0, 4, 4, 13123, 13123 },
+    { 0, 4, 4, 13127, 13127 },
+    { 0, 4, 4, 13131, 13131 },
+    { 0, 4, 4, 13135, 13135 },
+    { 0, 4, 4, 13139, 13139 },
+    { 0, 4, 4, 13143, 13143 },
+    { 0, 4, 4, 13147, 13147 },
+    { 0, 4, 4, 13151, 13151 },
+    { 0, 4, 4, 13155, 13155 },
+    { 0, 4, 4, 13159, 13159 },
+    { 0, 4, 4, 13163, 13163 },
+    { 0, 4, 4, 13167, 13167 },
+    { 0, 4, 4, 13171, 13171 },
+    { 0, 4, 4, 13175, 13175 },
+    { 0, 4, 4, 13179, 13179 },
+    { 0, 4, 4, 13183, 13183 },
+    { 0, 4, 4, 13187, 13187 },
+    { 0, 4, 4, 13191, 13191 },
+    { 0, 4, 4, 13195, 13195 },
+    { 0, 4, 4, 13199, 13199 },
+    { 0, 4, 4, 13203, 13203 },
+    { 0, 4, 4, 13207, 13207 },
+    { 0, 4, 4, 13211, 13211 },
+    { 0, 4, 4, 13215, 13215 },
+    { 0, 4, 4, 13219, 13219 },
+    { 0, 4, 2, 13223, 1352 },
+    { 0, 6, 6, 13227, 13227 },
+    { 0, 6, 6, 13233, 13233 },
+    { 0, 6, 6, 13239, 13239 },
+    { 0, 6, 6, 13245, 13245 },
+    { 0, 6, 6, 13251, 13251 },
+    { 0, 6, 6, 13257, 13257 },
+    { 0, 6, 6, 13263, 13263 },
+    { 0, 6, 6, 13269, 13269 },
+    { 0, 6, 6, 13275, 13275 },
+    { 0, 6, 6, 13281, 13281 },
+    { 0, 6, 6, 13287, 13287 },
+    { 0, 6, 6, 13293, 13293 },
+    { 0, 6, 6, 13299, 13299 },
+    { 0, 6, 6, 13305, 13305 },
+    { 0, 6, 6, 13311, 13311 },
+    { 0, 6, 6, 13317, 13317 },
+    { 0, 6, 6, 13323, 13323 },
+    { 0, 6, 6, 13329, 13329 },
+    { 0, 6, 6, 13335, 13335 },
+    { 0, 6, 6, 13341, 13341 },
+    { 0, 6, 6, 13347, 13347 },
+    { 0, 6, 6, 13353, 13353 },
+    { 0, 6, 6, 13359, 13359 },
+    { 0, 6, 6, 13365, 13365 },
+    { 0, 6, 6, 13371, 13371 },
+    { 0, 6, 6, 13377, 13377 },
+    { 0, 6, 6, 13383, 13383 },
+    { 0, 6, 6, 13389, 13389 },
+    { 0, 6, 6, 13395, 13395 },
+    { 0, 6, 6, 13401, 13401 },
+    { 0, 6, 6, 13407, 13407 },
+    { 0, 6, 6, 13413, 13413 },
+    { 0, 6, 6, 13419, 13419 },
+    { 0, 6, 6, 13425, 13425 },
+    { 0, 6, 6, 13431, 13431 },
+    { 0, 6, 6, 13437, 13437 },
+    { 0, 6, 6, 13443, 13443 },
+    { 0, 6, 6, 13449, 13449 },
+    { 0, 6, 6, 13455, 13455 },
+    { 0, 6, 6, 13461, 13461 },
+    { 0, 6, 6, 13467, 13467 },
+    { 0, 6, 6, 13473, 13473 },
+    { 0, 6, 6, 13479, 13479 },
+    { 0, 6, 6, 13485, 13485 },
+    { 0, 6, 6, 13491, 13491 },
+    { 0, 6, 6, 13497, 13497 },
+    { 0, 6, 6, 13503, 13503 },
+    { 0, 6, 6, 13509, 13509 },
+    { 0, 6, 6, 13515, 13515 },
+    { 0, 6, 6, 13521, 13521 },
+    { 0, 6, 6, 13527, 13527 },
+    { 0, 6, 6, 13533, 13533 },
+    { 0, 6, 6, 13539, 13539 },
+    { 0, 6, 6, 13545, 13545 },
+    { 0, 6, 6, 13551, 13551 },
+    { 0, 6, 6, 13557, 13557 },
+    { 0, 6, 6, 13563, 13563 },
+    { 0, 6, 6, 13569, 13569 },
+    { 0, 6, 6, 13575, 13575 },
+    { 0, 6, 6, 13581, 13581 },
+    { 0, 6, 6, 13587, 13587 },
+    { 0, 6, 6, 13593, 13593 },
+    { 0, 6, 6, 13599, 13599 },
+    { 0, 6, 6, 13605, 13605 },
+    { 0, 6, 6, 13611, 13611 },
+    { 0, 6, 6, 13617, 13617 },
+    { 0, 6, 6, 13623, 13623 },
+    { 0, 6, 6, 13629, 13629 },
+    { 0, 6, 6, 13635, 13635 },
+    { 0, 6, 6, 13641, 13641 },
+    { 0, 6, 6, 13647, 13647 },
+    { 0, 6, 6, 13653, 13653 },
+    { 0, 6, 6, 13659, 13659 },
+    { 0, 6, 6, 13665, 13665 },
+    { 0, 6, 6, 13671, 13671 },
+    { 0, 6, 6, 13677, 13677 },
+    { 0, 6, 6, 13683, 13683 },
+    { 0, 6, 6, 13689, 13689 },
+    { 0, 6, 6, 13695, 13695 },
+    { 0, 6, 6, 13701, 13701 },
+    { 0, 6, 6, 13707, 13707 },
+    { 0, 6, 6, 13713, 13713 },
+    { 0, 6, 6, 13719, 13719 },
+    { 0, 6, 6, 13725, 13725 },
+    { 0, 6, 6, 13731, 13731 },
+    { 0, 6, 6, 13737, 13737 },
+    { 0, 6, 6, 13743, 13743 },
+    { 0, 6, 6, 13749, 13749 },
+    { 0, 6, 6, 13755, 13755 },
+    { 0, 6, 6, 13761, 13761 },
+    { 0, 6, 6, 13767, 13767 },
+    { 0, 6, 6, 13773, 13773 },
+    { 0, 6, 6, 13779, 13779 },
+    { 0, 6, 6, 13785, 13785 },
+    { 0, 6, 6, 13791, 13791 },
+    { 0, 6, 6, 13797, 13797 },
+    { 0, 8, 8, 13803, 13803 },
+    { 0, 8, 8, 13811, 13811 },
+    { 0, 8, 8, 13819, 13819 },
+    { 0, 8, 8, 13827, 13827 },
+    { 0, 8, 8, 13835, 13835 },
+    { 0, 8, 8, 13843, 13843 },
+    { 0, 8, 8, 13851, 13851 },
+    { 0, 6, 6, 13859, 13859 },
+    { 0, 33, 33, 13865, 13865 },
+    { 0, 15, 15, 13898, 13898 },
+    { 0, 8, 8, 13913, 13913 },
+    { 0, 1, 1, 13921, 13921 },
+    { 0, 3, 3, 13922, 13922 },
+    { 0, 3, 3, 13925, 13925 },
+    { 0, 1, 1, 13928, 13928 },
+    { 0, 1, 1, 13929, 13929 },
+    { 0, 1, 1, 13930, 13930 },
+    { 0, 3, 3, 13931, 13931 },
+    { 0, 3, 3, 13934, 13934 },
+    { 1, 3, 0, 13937, 30 },
+    { 1, 3, 0, 13940, 30 },
+    { 1, 3, 0, 13943, 30 },
+    { 1, 3, 0, 13946, 30 },
+    { 1, 3, 0, 13949, 30 },
+    { 1, 3, 0, 13952, 30 },
+    { 1, 3, 0, 13955, 30 },
+    { 1, 3, 0, 13958, 30 },
+    { 1, 3, 0, 13961, 30 },
+    { 1, 3, 0, 13964, 30 },
+    { 1, 3, 0, 13967, 30 },
+    { 1, 3, 0, 13970, 30 },
+    { 1, 3, 0, 13973, 30 },
+    { 1, 3, 0, 13976, 30 },
+    { 1, 3, 0, 13979, 30 },
+    { 1, 3, 0, 13982, 30 },
+    { 0, 3, 3, 13985, 13985 },
+    { 0, 3, 3, 13988, 13988 },
+    { 0, 1, 1, 13991, 13991 },
+    { 0, 1, 1, 13992, 13992 },
+    { 0, 1, 1, 13993, 13993 },
+    { 0, 3, 3, 13994, 13994 },
+    { 0, 3, 3, 13997, 13997 },
+    { 0, 3, 3, 14000, 14000 },
+    { 0, 3, 3, 14003, 14003 },
+    { 0, 3, 3, 14006, 14006 },
+    { 0, 3, 3, 14009, 14009 },
+    { 0, 3, 3, 14012, 14012 },
+    { 0, 3, 3, 14015, 14015 },
+    { 0, 3, 3, 14018, 14018 },
+    { 0, 3, 3, 14021, 14021 },
+    { 0, 1, 1, 14024, 14024 },
+    { 0, 1, 1, 14025, 14025 },
+    { 0, 1, 1, 14026, 14026 },
+    { 0, 1, 1, 14027, 14027 },
+    { 0, 1, 1, 14028, 14028 },
+    { 0, 1, 1, 14029, 14029 },
+    { 0, 1, 1, 5262, 5262 },
+    { 0, 1, 1, 5263, 5263 },
+    { 0, 1, 1, 14030, 14030 },
+    { 0, 1, 1, 14031, 14031 },
+    { 0, 1, 1, 14032, 14032 },
+    { 0, 1, 1, 14033, 14033 },
+    { 0, 3, 1, 14034, 26 },
+    { 0, 4, 2, 14037, 13101 },
+    { 0, 3, 1, 14041, 26 },
+    { 0, 3, 1, 14044, 26 },
+    { 0, 3, 1, 14047, 26 },
+    { 0, 4, 2, 14050, 13101 },
+    { 0, 3, 1, 14054, 26 },
+    { 0, 4, 2, 14057, 13101 },
+    { 0, 3, 1, 14061, 26 },
+    { 0, 4, 2, 14064, 13101 },
+    { 0, 3, 1, 14068, 26 },
+    { 0, 4, 2, 14071, 13101 },
+    { 0, 3, 1, 14075, 26 },
+    { 0, 4, 2, 14078, 13101 },
+    { 0, 2, 2, 14082, 14082 },
+    { 0, 2, 2, 14084, 1352 },
+    { 0, 2, 2, 14086, 1352 },
+    { 0, 2, 2, 14088, 1354 },
+    { 0, 2, 2, 14090, 1352 },
+    { 0, 2, 2, 14092, 1356 },
+    { 0, 2, 2, 1352, 1352 },
+    { 0, 2, 2, 14094, 14094 },
+    { 0, 2, 2, 14096, 14096 },
+    { 0, 2, 2, 14098, 14098 },
+    { 0, 2, 2, 14100, 14100 },
+    { 0, 2, 2, 14102, 14102 },
+    { 0, 2, 2, 14104, 14104 },
+    { 0, 2, 2, 14106, 14106 },
+    { 0, 2, 2, 14108, 14108 },
+    { 0, 2, 2, 12923, 12923 },
+    { 0, 2, 2, 12929, 12929 },
+    { 0, 2, 2, 14110, 14110 },
+    { 0, 2, 2, 14112, 14112 },
+    { 0, 2, 2, 14114, 14114 },
+    { 0, 2, 2, 14116, 14116 },
+    { 0, 2, 2, 14118, 14118 },
+    { 0, 2, 2, 14120, 14120 },
+    { 0, 2, 2, 14122, 14122 },
+    { 0, 2, 2, 14124, 14124 },
+    { 0, 2, 2, 14126, 14126 },
+    { 0, 2, 2, 14128, 14128 },
+    { 0, 2, 2, 14130, 14130 },
+    { 0, 2, 2, 14132, 14132 },
+    { 0, 2, 2, 14134, 14134 },
+    { 0, 2, 2, 14136, 14136 },
+    { 0, 2, 2, 14138, 14138 },
+    { 0, 2, 2, 13077, 13077 },
+    { 0, 2, 2, 1354, 1354 },
+    { 0, 2, 2, 1356, 1356 },
+    { 0, 4, 4, 14140, 14144 },
+    { 0, 4, 4, 14148, 14144 },
+    { 0, 4, 4, 14152, 14144 },
+    { 0, 4, 4, 14144, 14144 },
+    { 0, 1, 1, 14156, 14156 },
+    { 0, 1, 1, 14157, 14157 },
+    { 0, 1, 1, 14158, 14158 },
+    { 0, 1, 1, 14159, 14159 },
+    { 0, 1, 1, 14160, 1 },
+    { 0, 1, 1, 14161, 14161 },
+    { 0, 3, 3, 14162, 14162 },
+    { 0, 3, 3, 14165, 14165 },
+    { 0, 3, 3, 14168, 14168 },
+    { 0, 3, 3, 14171, 14171 },
+    { 0, 3, 3, 14174, 14174 },
+    { 0, 3, 3, 14177, 14177 },
+    { 0, 3, 3, 14180, 14180 },
+    { 0, 3, 3, 14183, 14183 },
+    { 0, 3, 3, 14186, 14186 },
+    { 0, 3, 3, 14189, 14189 },
+    { 0, 3, 3, 14192, 14192 },
+    { 0, 3, 3, 14195, 14195 },
+    { 0, 3, 3, 14198, 14198 },
+    { 0, 3, 3, 14201, 14201 },
+    { 0, 3, 0, 6868, 30 },
+    { 0, 3, 0, 6871, 30 },
+    { 0, 2, 2, 14204, 14204 },
+    { 0, 2, 2, 14206, 14206 },
+    { 0, 2, 2, 14208, 14208 },
+    { 0, 2, 2, 14210, 14210 },
+    { 0, 2, 2, 14212, 14212 },
+    { 0, 3, 3, 14214, 14214 },
+    { 0, 3, 3, 14217, 14217 },
+    { 0, 3, 3, 5181, 5181 },
+    { 0, 3, 3, 14220, 14220 },
+    { 0, 3, 3, 5184, 5184 },
+    { 0, 3, 3, 14223, 14223 },
+    { 0, 3, 3, 14226, 14226 },
+    { 0, 3, 3, 14229, 14229 },
+    { 1, 4, 0, 14232, 30 },
+    { 1, 4, 0, 14236, 30 },
+    { 1, 4, 0, 14240, 30 },
+    { 1, 4, 0, 14244, 30 },
+    { 1, 4, 0, 14248, 30 },
+    { 1, 4, 0, 14252, 30 },
+    { 1, 4, 0, 14256, 30 },
+    { 0, 4, 4, 14260, 14260 },
+    { 0, 4, 4, 14264, 14264 },
+    { 0, 4, 4, 14268, 14268 },
+    { 0, 4, 4, 14272, 14272 },
+    { 0, 4, 4, 14276, 14276 },
+    { 0, 4, 4, 14280, 14280 },
+    { 0, 4, 4, 14284, 14284 },
+    { 0, 4, 4, 14288, 14288 },
+    { 0, 4, 4, 14292, 14292 },
+    { 0, 4, 4, 14296, 14296 },
+    { 0, 4, 4, 14300, 14300 },
+    { 0, 4, 4, 14304, 14304 },
+    { 0, 4, 4, 14308, 14308 },
+    { 0, 4, 4, 14312, 14312 },
+    { 0, 4, 4, 14316, 14316 },
+    { 0, 4, 4, 14320, 14320 },
+    { 0, 4, 4, 14324, 14324 },
+    { 0, 4, 4, 14328, 14328 },
+    { 0, 4, 4, 14332, 14332 },
+    { 0, 4, 4, 14336, 14336 },
+    { 0, 4, 4, 14340, 14340 },
+    { 0, 4, 4, 14344, 14344 },
+    { 0, 4, 4, 14348, 14348 },
+    { 0, 4, 4, 14352, 14352 },
+    { 0, 4, 4, 14356, 14356 },
+    { 0, 4, 4, 14360, 14360 },
+    { 0, 4, 4, 14364, 14364 },
+    { 0, 4, 4, 14368, 14368 },
+    { 0, 4, 4, 14372, 14372 },
+    { 0, 4, 4, 14376, 14376 },
+    { 0, 4, 4, 14380, 14380 },
+    { 0, 4, 4, 14384, 14384 },
+    { 0, 4, 4, 14388, 14388 },
+    { 0, 4, 4, 14392, 14392 },
+    { 0, 4, 4, 14396, 14396 },
+    { 0, 4, 4, 14400, 14400 },
+    { 0, 4, 4, 14404, 14404 },
+    { 0, 4, 4, 14408, 14408 },
+    { 0, 4, 4, 14412, 14412 },
+    { 0, 4, 4, 14416, 14416 },
+    { 0, 4, 4, 14420, 14420 },
+    { 0, 4, 4, 14424, 14424 },
+    { 0, 4, 4, 14428, 14428 },
+    { 0, 4, 4, 14432, 14432 },
+    { 0, 4, 4, 14436, 14436 },
+    { 0, 4, 4, 14440, 14440 },
+    { 0, 4, 4, 14444, 14444 },
+    { 0, 4, 4, 14448, 14448 },
+    { 0, 4, 4, 14452, 14452 },
+    { 0, 4, 4, 14456, 14456 },
+    { 0, 4, 4, 14460, 14460 },
+    { 0, 4, 4, 14464, 14464 },
+    { 0, 4, 4, 14468, 14468 },
+    { 0, 4, 4, 14472, 14472 },
+    { 0, 4, 4, 14476, 14476 },
+    { 0, 4, 4, 14480, 14480 },
+    { 0, 4, 4, 14484, 14484 },
+    { 0, 4, 4, 14488, 14488 },
+    { 0, 4, 4, 14492, 14492 },
+    { 0, 4, 4, 14496, 14496 },
+    { 0, 4, 4, 14500, 14500 },
+    { 0, 4, 4, 14504, 14504 },
+    { 0, 4, 4, 14508, 14508 },
+    { 0, 4, 4, 14512, 14512 },
+    { 0, 4, 4, 14516, 14516 },
+    { 0, 4, 4, 14520, 14520 },
+    { 0, 4, 4, 14524, 14524 },
+    { 0, 4, 4, 14528, 14528 },
+    { 0, 4, 4, 14532, 14532 },
+    { 0, 4, 4, 14536, 14536 },
+    { 0, 4, 4, 14540, 14540 },
+    { 0, 4, 4, 14544, 14544 },
+    { 0, 4, 4, 14548, 14548 },
+    { 0, 4, 4, 14552, 14552 },
+    { 0, 4, 4, 14556, 14556 },
+    { 0, 4, 4, 14560, 14560 },
+    { 0, 4, 4, 14564, 14564 },
+    { 0, 4, 4, 14568, 14568 },
+    { 0, 4, 4, 14572, 14572 },
+    { 0, 4, 4, 14576, 14576 },
+    { 0, 4, 4, 14580, 14580 },
+    { 0, 4, 4, 14584, 14584 },
+    { 0, 4, 4, 14588, 14588 },
+    { 0, 4, 4, 14592, 14592 },
+    { 0, 4, 4, 14596, 14596 },
+    { 0, 4, 4, 14600, 14600 },
+    { 0, 4, 4, 14604, 14604 },
+    { 0, 4, 4, 14608, 14608 },
+    { 0, 4, 4, 14612, 14612 },
+    { 0, 4, 4, 14616, 14616 },
+    { 0, 4, 4, 14620, 14620 },
+    { 0, 4, 4, 14624, 14624 },
+    { 0, 4, 4, 14628, 14628 },
+    { 0, 4, 4, 14632, 14632 },
+    { 0, 4, 4, 14636, 14636 },
+    { 0, 4, 4, 14640, 14640 },
+    { 0, 4, 4, 14644, 14644 },
+    { 0, 4, 4, 14648, 14648 },
+    { 0, 4, 4, 14652, 14652 },
+    { 0, 4, 4, 14656, 14656 },
+    { 0, 4, 4, 14660, 14660 },
+    { 0, 4, 4, 14664, 14664 },
+    { 0, 4, 4, 14668, 14668 },
+    { 0, 4, 4, 14672, 14672 },
+    { 0, 4, 4, 14676, 14676 },
+    { 0, 4, 4, 14680, 14680 },
+    { 0, 4, 4, 14684, 14684 },
+    { 0, 4, 4, 14688, 14688 },
+    { 0, 4, 4, 14692, 14692 },
+    { 0, 4, 4, 14696, 14696 },
+    { 0, 4, 4, 14700, 14700 },
+    { 0, 2, 2, 14704, 14704 },
+    { 0, 2, 2, 14706, 14706 },
+    { 0, 2, 1, 14708, 3 },
+    { 0, 2, 2, 14710, 14710 },
+    { 0, 3, 3, 14712, 14712 },
+    { 0, 2, 2, 14715, 14715 },
+    { 0, 2, 2, 14717, 14717 },
+    { 0, 3, 3, 14719, 14719 },
+    { 0, 2, 2, 14722, 14722 },
+    { 0, 2, 2, 14724, 14724 },
+    { 0, 2, 2, 14726, 14726 },
+    { 0, 2, 2, 14728, 14728 },
+    { 0, 2, 1, 14730, 8 },
+    { 0, 2, 2, 14732, 14732 },
+    { 0, 2, 1, 14734, 9 },
+    { 0, 2, 2, 14736, 14736 },
+    { 0, 2, 2, 14738, 14738 },
+    { 0, 2, 2, 14740, 14740 },
+    { 0, 2, 2, 14742, 14742 },
+    { 0, 4, 4, 14744, 14744 },
+    { 0, 3, 3, 14748, 14748 },
+    { 0, 2, 2, 14751, 14751 },
+    { 0, 4, 4, 14753, 14753 },
+    { 0, 2, 2, 14757, 14757 },
+    { 0, 4, 4, 14759, 14759 },
+    { 0, 2, 2, 14763, 14763 },
+    { 0, 2, 2, 14765, 14765 },
+    { 0, 2, 2, 14767, 14767 },
+    { 0, 4, 4, 14769, 14769 },
+    { 0, 2, 2, 14773, 14773 },
+    { 0, 2, 2, 14775, 14775 },
+    { 0, 2, 2, 14777, 14777 },
+    { 0, 3, 3, 14779, 14779 },
+    { 0, 2, 2, 14782, 14782 },
+    { 0, 3, 3, 14784, 14784 },
+    { 0, 2, 1, 14787, 24 },
+    { 0, 2, 2, 14789, 14789 },
+    { 0, 2, 2, 14791, 14791 },
+    { 0, 2, 2, 14793, 14793 },
+    { 0, 2, 2, 14795, 14795 },
+    { 0, 2, 2, 14797, 14797 },
+    { 0, 2, 2, 14799, 14799 },
+    { 0, 4, 4, 14801, 14801 },
+    { 0, 4, 4, 14805, 14805 },
+    { 1, 4, 0, 14809, 30 },
+    { 1, 4, 0, 14813, 30 },
+    { 1, 4, 0, 14817, 30 },
+    { 1, 4, 0, 14821, 30 },
+    { 1, 4, 0, 14825, 30 },
+    { 1, 4, 0, 14829, 30 },
+    { 1, 4, 0, 14833, 30 },
+    { 1, 4, 0, 14837, 30 },
+    { 1, 4, 0, 14841, 30 },
+    { 1, 4, 0, 14845, 30 },
+    { 1, 4, 0, 14849, 30 },
+    { 1, 4, 0, 14853, 30 },
+    { 1, 4, 0, 14857, 30 },
+    { 1, 4, 0, 14861, 30 },
+    { 1, 4, 0, 14865, 30 },
+    { 0, 4, 4, 14869, 14869 },
+    { 0, 4, 4, 14873, 14873 },
+    { 0, 4, 4, 14877, 14877 },
+    { 0, 4, 4, 14881, 14881 },
+    { 0, 4, 4, 14885, 14885 },
+    { 0, 4, 4, 14889, 14889 },
+    { 0, 4, 4, 14893, 14893 },
+    { 0, 4, 4, 14897, 14897 },
+    { 0, 4, 4, 14901, 14901 },
+    { 0, 4, 4, 14905, 14905 },
+    { 0, 4, 4, 14909, 14909 },
+    { 0, 4, 4, 14913, 14913 },
+    { 0, 4, 4, 14917, 14917 },
+    { 0, 4, 4, 14921, 14921 },
+    { 0, 4, 4, 14925, 14925 },
+    { 0, 4, 4, 14929, 14929 },
+    { 0, 4, 4, 14933, 14933 },
+    { 0, 4, 4, 14937, 14937 },
+    { 0, 4, 4, 14941, 14941 },
+    { 0, 4, 4, 14945, 14945 },
+    { 0, 4, 4, 14949, 14949 },
+    { 0, 4, 4, 14953, 14953 },
+    { 0, 4, 4, 14957, 14957 },
+    { 0, 4, 4, 14961, 14961 },
+    { 0, 4, 4, 14965, 14965 },
+    { 0, 4, 4, 14969, 14969 },
+    { 0, 4, 4, 14973, 14973 },
+    { 0, 4, 4, 14977, 14977 },
+    { 0, 4, 4, 14981, 14981 },
+    { 0, 4, 4, 14985, 14985 },
+    { 0, 4, 4, 14989, 14989 },
+    { 0, 4, 4, 14993, 14993 },
+    { 0, 4, 4, 14997, 14997 },
+    { 0, 4, 4, 15001, 15001 },
+    { 0, 4, 4, 15005, 15005 },
+    { 0, 4, 4, 15009, 15009 },
+    { 0, 4, 4, 15013, 15013 },
+    { 0, 4, 4, 15017, 15017 },
+    { 0, 4, 4, 15021, 15021 },
+    { 0, 4, 4, 15025, 15025 },
+    { 0, 4, 4, 15029, 15029 },
+    { 0, 4, 4, 15033, 15033 },
+    { 0, 4, 4, 15037, 15037 },
+    { 0, 4, 4, 15041, 15041 },
+    { 0, 4, 4, 15045, 15045 },
+    { 0, 4, 4, 15049, 15049 },
+    { 0, 4, 4, 15053, 15053 },
+    { 0, 4, 4, 15057, 15057 },
+    { 0, 4, 4, 15061, 15061 },
+    { 0, 4, 4, 15065, 15065 },
+    { 0, 4, 4, 15069, 15069 },
+    { 1, 4, 0, 15073, 30 },
+    { 1, 4, 0, 15077, 30 },
+    { 1, 4, 0, 15081, 30 },
+    { 1, 4, 0, 15085, 30 },
+    { 1, 4, 0, 15089, 30 },
+    { 1, 4, 0, 15093, 30 },
+    { 1, 4, 0, 15097, 30 },
+    { 1, 4, 0, 15101, 30 },
+    { 1, 4, 0, 15105, 30 },
+    { 1, 4, 0, 15109, 30 },
+    { 1, 4, 0, 15113, 30 },
+    { 1, 4, 0, 15117, 30 },
+    { 1, 4, 0, 15121, 30 },
+    { 1, 4, 0, 15125, 30 },
+    { 1, 4, 0, 15129, 30 },
+    { 1, 4, 0, 15133, 30 },
+    { 1, 4, 0, 15137, 30 },
+    { 1, 4, 0, 15141, 30 },
+    { 1, 4, 0, 15145, 30 },
+    { 1, 4, 0, 15149, 30 },
+    { 1, 4, 0, 15153, 30 },
+    { 1, 4, 0, 15157, 30 },
+    { 1, 4, 0, 15161, 30 },
+    { 1, 4, 0, 15165, 30 },
+    { 1, 4, 0, 15169, 30 },
+    { 1, 4, 0, 15173, 30 },
+    { 1, 4, 0, 15177, 30 },
+    { 1, 4, 0, 15181, 30 },
+    { 1, 4, 0, 15185, 30 },
+    { 1, 4, 0, 15189, 30 },
+    { 1, 4, 0, 15193, 30 },
+    { 1, 4, 0, 15197, 30 },
+    { 1, 4, 0, 15201, 30 },
+    { 1, 4, 0, 15205, 30 },
+    { 1, 4, 0, 15209, 30 },
+    { 1, 4, 0, 15213, 30 },
+    { 1, 4, 0, 15217, 30 },
+    { 1, 4, 0, 15221, 30 },
+    { 1, 4, 0, 15225, 30 },
+    { 1, 4, 0, 15229, 30 },
+    { 1, 4, 0, 15233, 30 },
+    { 1, 4, 0, 15237, 30 },
+    { 1, 4, 0, 15241, 30 },
+    { 0, 0, 4, 65535, 15245 },
+    { 0, 0, 4, 65535, 15249 },
+    { 0, 0, 4, 65535, 15253 },
+    { 1, 4, 0, 15257, 30 },
+    { 1, 4, 0, 15261, 30 },
+    { 1, 4, 0, 15265, 30 },
+    { 1, 4, 0, 15269, 30 },
+    { 1, 4, 0, 15273, 30 },
+    { 1, 4, 0, 15277, 30 },
+    { 1, 4, 0, 15281, 30 },
+    { 1, 4, 0, 15285, 30 },
+    { 1, 4, 0, 15289, 30 },
+    { 1, 4, 0, 15293, 30 },
+    { 1, 4, 0, 15297, 30 },
+    { 1, 4, 0, 15301, 30 },
+    { 1, 4, 0, 15305, 30 },
+    { 1, 4, 0, 15309, 30 },
+    { 1, 4, 0, 15313, 30 },
+    { 1, 4, 0, 15317, 30 },
+    { 1, 4, 0, 15321, 30 },
+    { 1, 4, 0, 15325, 30 },
+    { 1, 4, 0, 15329, 30 },
+    { 1, 4, 0, 15333, 30 },
+    { 1, 4, 0, 15337, 30 },
+    { 1, 4, 0, 15341, 30 },
+    { 1, 4, 0, 15345, 30 },
+    { 1, 4, 0, 15349, 30 },
+    { 1, 4, 0, 15353, 30 },
+    { 1, 4, 0, 15357, 30 },
+    { 1, 4, 0, 15361, 30 },
+    { 1, 4, 0, 15365, 30 },
+    { 1, 4, 0, 15369, 30 },
+    { 1, 4, 0, 15373, 30 },
+    { 1, 4, 0, 15377, 30 },
+    { 1, 4, 0, 15381, 30 },
+    { 1, 4, 0, 15385, 30 },
+    { 1, 4, 0, 15389, 30 },
+    { 1, 4, 0, 15393, 30 },
+    { 1, 4, 0, 15397, 30 },
+    { 1, 4, 0, 15401, 30 },
+    { 1, 4, 0, 15405, 30 },
+    { 1, 4, 0, 15409, 30 },
+    { 1, 4, 0, 15413, 30 },
+    { 1, 4, 0, 15417, 30 },
+    { 1, 4, 0, 15421, 30 },
+    { 1, 4, 0, 15425, 30 },
+    { 1, 4, 0, 15429, 30 },
+    { 1, 4, 0, 15433, 30 },
+    { 1, 4, 0, 15437, 30 },
+    { 1, 4, 0, 15441, 30 },
+    { 1, 4, 0, 15445, 30 },
+    { 1, 4, 0, 15449, 30 },
+    { 1, 4, 0, 15453, 30 },
+    { 1, 4, 0, 15457, 30 },
+    { 1, 4, 0, 15461, 30 },
+    { 1, 4, 0, 15465, 30 },
+    { 1, 4, 0, 15469, 30 },
+    { 1, 4, 0, 15473, 30 },
+    { 1, 4, 0, 15477, 30 },
+    { 1, 4, 0, 15481, 30 },
+    { 1, 4, 0, 15485, 30 },
+    { 1, 4, 0, 15489, 30 },
+    { 1, 4, 0, 15493, 30 },
+    { 1, 4, 0, 15497, 30 },
+    { 1, 4, 0, 15501, 30 },
+    { 1, 4, 0, 15505, 30 },
+    { 1, 4, 0, 15509, 30 },
+    { 1, 4, 0, 15513, 30 },
+    { 1, 4, 0, 15517, 30 },
+    { 1, 4, 0, 15521, 30 },
+    { 1, 4, 0, 15525, 30 },
+    { 1, 4, 0, 15529, 30 },
+    { 1, 4, 0, 15533, 30 },
+    { 1, 4, 0, 15537, 30 },
+    { 1, 4, 0, 15541, 30 },
+    { 1, 4, 0, 15545, 30 },
+    { 1, 4, 0, 15549, 30 },
+    { 1, 4, 0, 15553, 30 },
+    { 1, 4, 0, 15557, 30 },
+    { 1, 4, 0, 15561, 30 },
+    { 1, 4, 0, 15565, 30 },
+    { 1, 4, 0, 15569, 30 },
+    { 1, 4, 0, 15573, 30 },
+    { 1, 4, 0, 15577, 30 },
+    { 1, 4, 0, 15581, 30 },
+    { 1, 4, 0, 15585, 30 },
+    { 1, 4, 0, 15589, 30 },
+    { 1, 4, 0, 15593, 30 },
+    { 1, 4, 0, 15597, 30 },
+    { 1, 4, 0, 15601, 30 },
+    { 1, 4, 0, 15605, 30 },
+    { 1, 4, 0, 15609, 30 },
+    { 1, 4, 0, 15613, 30 },
+    { 1, 4, 0, 15617, 30 },
+    { 1, 4, 0, 15621, 30 },
+    { 1, 4, 0, 15625, 30 },
+    { 1, 4, 0, 15629, 30 },
+    { 1, 4, 0, 15633, 30 },
+    { 1, 4, 0, 15637, 30 },
+    { 1, 4, 0, 15641, 30 },
+    { 1, 4, 0, 15645, 30 },
+    { 1, 4, 0, 15649, 30 },
+    { 1, 4, 0, 15653, 30 },
+    { 1, 4, 0, 15657, 30 },
+    { 1, 4, 0, 15661, 30 },
+    { 1, 4, 0, 15665, 30 },
+    { 1, 4, 0, 15669, 30 },
+    { 1, 4, 0, 15673, 30 },
+    { 1, 4, 0, 15677, 30 },
+    { 1, 4, 0, 15681, 30 },
+    { 1, 4, 0, 15685, 30 },
+    { 1, 4, 0, 15689, 30 },
+    { 1, 4, 0, 15693, 30 },
+    { 1, 4, 0, 15697, 30 },
+    { 1, 4, 0, 15701, 30 },
+    { 1, 4, 0, 15705, 30 },
+    { 1, 4, 0, 15709, 30 },
+    { 1, 4, 0, 15713, 30 },
+    { 1, 4, 0, 15717, 30 },
+    { 1, 4, 0, 15721, 30 },
+    { 1, 4, 0, 15725, 30 },
+    { 1, 4, 0, 15729, 30 },
+    { 1, 4, 0, 15733, 30 },
+    { 1, 4, 0, 15737, 30 },
+    { 1, 4, 0, 15741, 30 },
+    { 1, 4, 0, 15745, 30 },
+    { 1, 4, 0, 15749, 30 },
+    { 1, 4, 0, 15753, 30 },
+    { 1, 4, 0, 15757, 30 },
+    { 1, 4, 0, 15761, 30 },
+    { 1, 4, 0, 15765, 30 },
+    { 1, 4, 0, 15769, 30 },
+    { 1, 4, 0, 15773, 30 },
+    { 1, 4, 0, 15777, 30 },
+    { 1, 4, 0, 15781, 30 },
+    { 1, 4, 0, 15785, 30 },
+    { 1, 4, 0, 15789, 30 },
+    { 1, 4, 0, 15793, 30 },
+    { 1, 4, 0, 15797, 30 },
+    { 1, 4, 0, 15801, 30 },
+    { 1, 4, 0, 15805, 30 },
+    { 1, 4, 0, 15809, 30 },
+    { 1, 4, 0, 15813, 30 },
+    { 1, 4, 0, 15817, 30 },
+    { 1, 4, 0, 15821, 30 },
+    { 1, 4, 0, 15825, 30 },
+    { 1, 4, 0, 15829, 30 },
+    { 1, 4, 0, 15833, 30 },
+    { 1, 4, 0, 15837, 30 },
+    { 1, 4, 0, 15841, 30 },
+    { 1, 4, 0, 15845, 30 },
+    { 1, 4, 0, 15849, 30 },
+    { 1, 4, 0, 15853, 30 },
+    { 0, 4, 4, 15857, 15857 },
+    { 0, 4, 4, 15861, 15861 },
+    { 0, 4, 4, 15865, 15865 },
+    { 0, 4, 4, 15869, 15869 },
+    { 0, 4, 4, 15873, 15873 },
+    { 0, 4, 4, 15877, 15877 },
+    { 0, 4, 4, 15881, 15881 },
+    { 0, 4, 4, 15885, 15885 },
+    { 0, 4, 4, 15889, 15889 },
+    { 0, 4, 4, 15893, 15893 },
+    { 0, 4, 4, 15897, 15897 },
+    { 0, 4, 4, 15901, 15901 },
+    { 0, 4, 4, 15905, 15905 },
+    { 0, 4, 4, 15909, 15909 },
+    { 0, 4, 4, 15913, 15913 },
+    { 0, 4, 4, 15917, 15917 },
+    { 0, 4, 4, 15921, 15921 },
+    { 0, 4, 4, 15925, 15925 },
+    { 0, 4, 4, 15929, 15929 },
+    { 0, 4, 4, 15933, 15933 },
+    { 0, 4, 4, 15937, 15937 },
+    { 0, 4, 4, 15941, 15941 },
+    { 0, 4, 4, 15945, 15945 },
+    { 0, 4, 4, 15949, 15949 },
+    { 0, 4, 4, 15953, 15953 },
+    { 0, 4, 4, 15957, 15957 },
+    { 0, 4, 4, 15961, 15961 },
+    { 0, 4, 4, 15965, 15965 },
+    { 0, 4, 4, 15969, 15969 },
+    { 0, 4, 4, 15973, 15973 },
+    { 0, 4, 4, 15977, 15977 },
+    { 0, 4, 4, 15981, 15981 },
+    { 1, 4, 0, 15985, 30 },
+    { 1, 4, 0, 15989, 30 },
+    { 1, 4, 0, 15993, 30 },
+    { 1, 4, 0, 15997, 30 },
+    { 1, 4, 0, 16001, 30 },
+    { 1, 4, 0, 16005, 30 },
+    { 1, 4, 0, 16009, 30 },
+    { 1, 4, 0, 16013, 30 },
+    { 1, 4, 0, 16017, 30 },
+    { 1, 4, 0, 16021, 30 },
+    { 1, 4, 0, 16025, 30 },
+    { 1, 4, 0, 16029, 30 },
+    { 1, 4, 0, 16033, 30 },
+    { 1, 4, 0, 16037, 30 },
+    { 1, 4, 0, 16041, 30 },
+    { 1, 4, 0, 16045, 30 },
+    { 1, 4, 0, 16049, 30 },
+    { 1, 4, 0, 16053, 30 },
+    { 1, 4, 0, 16057, 30 },
+    { 1, 4, 0, 16061, 30 },
+    { 1, 4, 0, 16065, 30 },
+    { 1, 4, 0, 16069, 30 },
+    { 1, 4, 0, 16073, 30 },
+    { 1, 4, 0, 16077, 30 },
+    { 1, 4, 0, 16081, 30 },
+    { 1, 4, 0, 16085, 30 },
+    { 1, 4, 0, 16089, 30 },
+    { 1, 4, 0, 16093, 30 },
+    { 1, 4, 0, 16097, 30 },
+    { 1, 4, 0, 16101, 30 },
+    { 1, 4, 0, 16105, 30 },
+    { 1, 4, 0, 16109, 30 },
+    { 1, 4, 0, 16113, 30 },
+    { 1, 4, 0, 16117, 30 },
+    { 1, 4, 0, 16121, 30 },
+    { 1, 4, 0, 16125, 30 },
+    { 1, 4, 0, 16129, 30 },
+    { 1, 4, 0, 16133, 30 },
+    { 1, 4, 0, 16137, 30 },
+    { 1, 4, 0, 16141, 30 },
+    { 1, 4, 0, 16145, 30 },
+    { 1, 4, 0, 16149, 30 },
+    { 1, 4, 0, 16153, 30 },
+    { 1, 4, 0, 16157, 30 },
+    { 1, 4, 0, 16161, 30 },
+    { 1, 4, 0, 16165, 30 },
+    { 1, 4, 0, 16169, 30 },
+    { 1, 4, 0, 16173, 30 },
+    { 1, 4, 0, 16177, 30 },
+    { 1, 4, 0, 16181, 30 },
+    { 1, 4, 0, 16185, 30 },
+    { 1, 4, 0, 16189, 30 },
+    { 1, 4, 0, 16193, 30 },
+    { 1, 4, 0, 16197, 30 },
+    { 1, 4, 0, 16201, 30 },
+    { 1, 4, 0, 16205, 30 },
+    { 1, 4, 0, 16209, 30 },
+    { 1, 4, 0, 16213, 30 },
+    { 1, 4, 0, 16217, 30 },
+    { 1, 4, 0, 16221, 30 },
+    { 1, 4, 0, 16225, 30 },
+    { 1, 4, 0, 16229, 30 },
+    { 1, 4, 0, 16233, 30 },
+    { 1, 4, 0, 16237, 30 },
+    { 1, 4, 0, 16241, 30 },
+    { 1, 4, 0, 16245, 30 },
+    { 1, 4, 0, 16249, 30 },
+    { 1, 4, 0, 16253, 30 },
+    { 1, 4, 0, 16257, 30 },
+    { 1, 4, 0, 16261, 30 },
+    { 1, 4, 0, 16265, 30 },
+    { 1, 4, 0, 16269, 30 },
+    { 1, 4, 0, 16273, 30 },
+    { 1, 4, 0, 16277, 30 },
+    { 1, 4, 0, 16281, 30 },
+    { 1, 4, 0, 16285, 30 },
+    { 1, 4, 0, 16289, 30 },
+    { 1, 4, 0, 16293, 30 },
+    { 1, 4, 0, 16297, 30 },
+    { 1, 4, 0, 16301, 30 },
+    { 1, 4, 0, 16305, 30 },
+    { 1, 4, 0, 16309, 30 },
+    { 1, 4, 0, 16313, 30 },
+    { 1, 4, 0, 16317, 30 },
+    { 1, 4, 0, 16321, 30 },
+    { 1, 4, 0, 16325, 30 },
+    { 1, 4, 0, 16329, 30 },
+    { 1, 4, 0, 16333, 30 },
+    { 1, 4, 0, 16337, 30 },
+    { 1, 4, 0, 16341, 30 },
+    { 1, 4, 0, 16345, 30 },
+    { 1, 4, 0, 16349, 30 },
+    { 1, 4, 0, 16353, 30 },
+    { 1, 4, 0, 16357, 30 },
+    { 1, 4, 0, 16361, 30 },
+    { 1, 4, 0, 16365, 30 },
+    { 1, 4, 0, 16369, 30 },
+    { 1, 4, 0, 16373, 30 },
+    { 1, 4, 0, 16377, 30 },
+    { 1, 4, 0, 16381, 30 },
+    { 1, 4, 0, 16385, 30 },
+    { 1, 4, 0, 16389, 30 },
+    { 1, 4, 0, 16393, 30 },
+    { 1, 4, 0, 16397, 30 },
+    { 1, 4, 0, 16401, 30 },
+    { 1, 4, 0, 16405, 30 },
+    { 1, 4, 0, 16409, 30 },
+    { 1, 4, 0, 16413, 30 },
+    { 1, 4, 0, 16417, 30 },
+    { 1, 4, 0, 16421, 30 },
+    { 1, 4, 0, 16425, 30 },
+    { 1, 4, 0, 16429, 30 },
+    { 1, 4, 0, 16433, 30 },
+    { 1, 4, 0, 16437, 30 },
+    { 1, 4, 0, 16441, 30 },
+    { 1, 4, 0, 16445, 30 },
+    { 1, 4, 0, 16449, 30 },
+    { 1, 4, 0, 16453, 30 },
+    { 1, 4, 0, 16457, 30 },
+    { 1, 4, 0, 16461, 30 },
+    { 1, 4, 0, 16465, 30 },
+    { 1, 4, 0, 16469, 30 },
+    { 1, 4, 0, 16473, 30 },
+    { 1, 4, 0, 16477, 30 },
+    { 1, 4, 0, 16481, 30 },
+    { 1, 4, 0, 16485, 30 },
+    { 1, 4, 0, 16489, 30 },
+    { 1, 4, 0, 16493, 30 },
+    { 1, 4, 0, 16497, 30 },
+    { 1, 4, 0, 16501, 30 },
+    { 1, 4, 0, 16505, 30 },
+    { 1, 4, 0, 16509, 30 },
+    { 1, 4, 0, 16513, 30 },
+    { 1, 4, 0, 16517, 30 },
+    { 1, 4, 0, 16521, 30 },
+    { 1, 4, 0, 16525, 30 },
+    { 1, 4, 0, 16529, 30 },
+    { 1, 4, 0, 16533, 30 },
+    { 0, 4, 4, 16537, 16537 },
+    { 0, 4, 4, 16541, 16541 },
+    { 0, 4, 4, 16545, 16545 },
+    { 0, 4, 4, 16549, 16549 },
+    { 0, 4, 4, 16553, 16553 },
+    { 0, 4, 4, 16557, 16557 },
+    { 0, 4, 4, 16561, 16561 },
+    { 0, 4, 4, 16565, 16565 },
+    { 0, 4, 4, 16569, 16569 },
+    { 0, 4, 4, 16573, 16573 },
+    { 0, 4, 4, 16577, 16577 },
+    { 0, 4, 4, 16581, 16581 },
+    { 0, 4, 4, 16585, 16585 },
+    { 0, 4, 4, 16589, 16589 },
+    { 0, 4, 4, 16593, 16593 },
+    { 0, 4, 4, 16597, 16597 },
+    { 0, 4, 4, 16601, 16601 },
+    { 0, 4, 4, 16605, 16605 },
+    { 0, 4, 4, 16609, 16609 },
+    { 0, 4, 4, 16613, 16613 },
+    { 0, 4, 4, 16617, 16617 },
+    { 0, 4, 4, 16621, 16621 },
+    { 0, 4, 4, 16625, 16625 },
+    { 0, 4, 4, 16629, 16629 },
+    { 0, 4, 4, 16633, 16633 },
+    { 0, 4, 4, 16637, 16637 },
+    { 0, 4, 4, 16641, 16641 },
+    { 0, 4, 4, 16645, 16645 },
+    { 0, 4, 4, 16649, 16649 },
+    { 0, 4, 4, 16653, 16653 },
+    { 0, 4, 4, 16657, 16657 },
+    { 0, 4, 4, 16661, 16661 },
+    { 1, 4, 0, 16665, 30 },
+    { 1, 4, 0, 16669, 30 },
+    { 1, 4, 0, 16673, 30 },
+    { 1, 4, 0, 16677, 30 },
+    { 1, 4, 0, 16681, 30 },
+    { 1, 4, 0, 16685, 30 },
+    { 1, 4, 0, 16689, 30 },
+    { 1, 4, 0, 16693, 30 },
+    { 1, 4, 0, 16697, 30 },
+    { 1, 4, 0, 16701, 30 },
+    { 1, 4, 0, 16705, 30 },
+    { 1, 4, 0, 16709, 30 },
+    { 1, 4, 0, 16713, 30 },
+    { 1, 4, 0, 16717, 30 },
+    { 1, 4, 0, 16721, 30 },
+    { 1, 4, 0, 16725, 30 },
+    { 1, 4, 0, 16729, 30 },
+    { 1, 4, 0, 16733, 30 },
+    { 1, 4, 0, 16737, 30 },
+    { 1, 4, 0, 16741, 30 },
+    { 1, 4, 0, 16745, 30 },
+    { 1, 4, 0, 16749, 30 },
+    { 1, 4, 0, 16753, 30 },
+    { 1, 4, 0, 16757, 30 },
+    { 1, 4, 0, 16761, 30 },
+    { 1, 4, 0, 16765, 30 },
+    { 1, 4, 0, 16769, 30 },
+    { 1, 4, 0, 16773, 30 },
+    { 1, 4, 0, 16777, 30 },
+    { 1, 4, 0, 16781, 30 },
+    { 1, 4, 0, 16785, 30 },
+    { 1, 4, 0, 16789, 30 },
+    { 1, 4, 0, 16793, 30 },
+    { 1, 4, 0, 16797, 30 },
+    { 1, 4, 0, 16801, 30 },
+    { 1, 4, 0, 16805, 30 },
+    { 1, 4, 0, 16809, 30 },
+    { 1, 4, 0, 16813, 30 },
+    { 1, 4, 0, 16817, 30 },
+    { 1, 4, 0, 16821, 30 },
+    { 1, 4, 0, 16825, 30 },
+    { 1, 4, 0, 16829, 30 },
+    { 1, 4, 0, 16833, 30 },
+    { 1, 4, 0, 16837, 30 },
+    { 1, 4, 0, 16841, 30 },
+    { 1, 4, 0, 16845, 30 },
+    { 1, 4, 0, 16849, 30 },
+    { 1, 4, 0, 16853, 30 },
+    { 1, 4, 0, 16857, 30 },
+    { 1, 4, 0, 16861, 30 },
+    { 1, 4, 0, 16865, 30 },
+    { 1, 4, 0, 16869, 30 },
+    { 1, 4, 0, 16873, 30 },
+    { 1, 4, 0, 16877, 30 },
+    { 1, 4, 0, 16881, 30 },
+    { 1, 4, 0, 16885, 30 },
+    { 1, 4, 0, 16889, 30 },
+    { 1, 4, 0, 16893, 30 },
+    { 1, 4, 0, 16897, 30 },
+    { 1, 4, 0, 16901, 30 },
+    { 1, 4, 0, 16905, 30 },
+    { 1, 4, 0, 16909, 30 },
+    { 1, 4, 0, 16913, 30 },
+    { 1, 4, 0, 16917, 30 },
+    { 1, 4, 0, 16921, 30 },
+    { 1, 4, 0, 16925, 30 },
+    { 1, 4, 0, 16929, 30 },
+    { 1, 4, 0, 16933, 30 },
+    { 1, 4, 0, 16937, 30 },
+    { 1, 4, 0, 16941, 30 },
+    { 1, 4, 0, 16945, 30 },
+    { 1, 4, 0, 16949, 30 },
+    { 1, 4, 0, 16953, 30 },
+    { 1, 4, 0, 16957, 30 },
+    { 1, 4, 0, 16961, 30 },
+    { 1, 4, 0, 16965, 30 },
+    { 1, 4, 0, 16969, 30 },
+    { 0, 8, 4, 16973, 16981 },
+    { 0, 8, 4, 16985, 16993 },
+    { 0, 12, 4, 16997, 16993 },
+    { 0, 12, 4, 17009, 16993 },
+    { 0, 12, 4, 17021, 16993 },
+    { 0, 12, 4, 17033, 16993 },
+    { 0, 12, 4, 17045, 16993 },
+    { 1, 4, 0, 17057, 30 },
+    { 1, 4, 0, 17061, 30 },
+    { 1, 4, 0, 17065, 30 },
+    { 1, 4, 0, 17069, 30 },
+    { 1, 4, 0, 17073, 30 },
+    { 1, 4, 0, 17077, 30 },
+    { 1, 4, 0, 17081, 30 },
+    { 1, 4, 0, 17085, 30 },
+    { 1, 4, 0, 17089, 30 },
+    { 1, 4, 0, 17093, 30 },
+    { 1, 4, 0, 17097, 30 },
+    { 1, 4, 0, 17101, 30 },
+    { 1, 4, 0, 17105, 30 },
+    { 1, 4, 0, 17109, 30 },
+    { 1, 4, 0, 17113, 30 },
+    { 1, 4, 0, 17117, 30 },
+    { 1, 4, 0, 17121, 30 },
+    { 1, 4, 0, 17125, 30 },
+    { 1, 4, 0, 17129, 30 },
+    { 1, 4, 0, 17133, 30 },
+    { 1, 4, 0, 17137, 30 },
+    { 1, 4, 0, 17141, 30 },
+    { 0, 8, 4, 17145, 17153 },
+    { 0, 8, 4, 17157, 17165 },
+    { 0, 12, 4, 17169, 17153 },
+    { 0, 12, 4, 17181, 17165 },
+    { 0, 12, 4, 17193, 17153 },
+    { 0, 12, 4, 17205, 17165 },
+    { 1, 4, 0, 17217, 30 },
+    { 1, 4, 0, 17221, 30 },
+    { 1, 4, 0, 17225, 30 },
+    { 0, 2, 1, 17229, 10 },
+    { 0, 2, 2, 17231, 17231 },
+    { 0, 3, 3, 17233, 17233 },
+    { 0, 3, 3, 17236, 17236 },
+    { 1, 4, 0, 17239, 30 },
+    { 1, 4, 0, 17243, 30 },
+    { 1, 4, 0, 17247, 30 },
+    { 1, 4, 0, 17251, 30 },
+    { 1, 4, 0, 17255, 30 },
+    { 1, 4, 0, 17259, 30 },
+    { 1, 4, 0, 17263, 30 },
+    { 1, 4, 0, 17267, 30 },
+    { 1, 4, 0, 17271, 30 },
+    { 1, 4, 0, 17275, 30 },
+    { 1, 4, 0, 17279, 30 },
+    { 1, 4, 0, 17283, 30 },
+    { 1, 4, 0, 17287, 30 },
+    { 1, 4, 0, 17291, 30 },
+    { 1, 4, 0, 17295, 30 },
+    { 1, 4, 0, 17299, 30 },
+    { 1, 4, 0, 17303, 30 },
+    { 1, 4, 0, 17307, 30 },
+    { 1, 4, 0, 17311, 30 },
+    { 1, 4, 0, 17315, 30 },
+    { 1, 4, 0, 17319, 30 },
+    { 1, 4, 0, 17323, 30 },
+    { 1, 4, 0, 17327, 30 },
+    { 1, 4, 0, 17331, 30 },
+    { 1, 4, 0, 17335, 30 },
+    { 1, 4, 0, 17339, 30 },
+    { 1, 4, 0, 17343, 30 },
+    { 1, 4, 0, 17347, 30 },
+    { 1, 4, 0, 17351, 30 },
+    { 1, 4, 0, 17355, 30 },
+    { 1, 4, 0, 17359, 30 },
+    { 1, 4, 0, 17363, 30 },
+    { 1, 4, 0, 17367, 30 },
+    { 1, 4, 0, 17371, 30 },
+    { 1, 4, 0, 17375, 30 },
+    { 1, 4, 0, 17379, 30 },
+    { 1, 4, 0, 17383, 30 },
+    { 1, 4, 0, 17387, 30 },
+    { 1, 4, 0, 17391, 30 },
+    { 1, 4, 0, 17395, 30 },
+    { 1, 4, 0, 17399, 30 },
+    { 1, 4, 0, 17403, 30 },
+    { 1, 4, 0, 17407, 30 },
+    { 1, 4, 0, 17411, 30 },
+    { 1, 4, 0, 17415, 30 },
+    { 1, 4, 0, 17419, 30 },
+    { 1, 4, 0, 17423, 30 },
+    { 1, 4, 0, 17427, 30 },
+    { 1, 4, 0, 17431, 30 },
+    { 1, 4, 0, 17435, 30 },
+    { 1, 4, 0, 17439, 30 },
+    { 1, 4, 0, 17443, 30 },
+    { 1, 4, 0, 17447, 30 },
+    { 1, 4, 0, 17451, 30 },
+    { 1, 4, 0, 17455, 30 },
+    { 1, 4, 0, 17459, 30 },
+    { 1, 4, 0, 17463, 30 },
+    { 1, 4, 0, 17467, 30 },
+    { 1, 4, 0, 17471, 30 },
+    { 1, 4, 0, 17475, 30 },
+    { 1, 4, 0, 17479, 30 },
+    { 1, 4, 0, 17483, 30 },
+    { 1, 4, 0, 17487, 30 },
+    { 1, 4, 0, 17491, 30 },
+    { 1, 4, 0, 17495, 30 },
+    { 1, 4, 0, 17499, 30 },
+    { 1, 4, 0, 17503, 30 },
+    { 1, 4, 0, 17507, 30 },
+    { 1, 4, 0, 17511, 30 },
+    { 1, 4, 0, 17515, 30 },
+    { 1, 4, 0, 17519, 30 },
+    { 1, 4, 0, 17523, 30 },
+    { 1, 4, 0, 17527, 30 },
+    { 1, 4, 0, 17531, 30 },
+    { 1, 4, 0, 17535, 30 },
+    { 1, 4, 0, 17539, 30 },
+    { 1, 4, 0, 17543, 30 },
+    { 1, 4, 0, 17547, 30 },
+    { 1, 4, 0, 17551, 30 },
+    { 1, 4, 0, 17555, 30 },
+    { 1, 4, 0, 17559, 30 },
+    { 1, 4, 0, 17563, 30 },
+    { 1, 4, 0, 17567, 30 },
+    { 1, 4, 0, 17571, 30 },
+    { 1, 4, 0, 17575, 30 },
+    { 1, 4, 0, 17579, 30 },
+    { 1, 4, 0, 17583, 30 },
+    { 1, 4, 0, 17587, 30 },
+    { 1, 4, 0, 17591, 30 },
+    { 1, 4, 0, 17595, 30 },
+    { 1, 4, 0, 17599, 30 },
+    { 1, 4, 0, 17603, 30 },
+    { 1, 4, 0, 17607, 30 },
+    { 1, 4, 0, 17611, 30 },
+    { 1, 4, 0, 17615, 30 },
+    { 1, 4, 0, 17619, 30 },
+    { 1, 4, 0, 17623, 30 },
+    { 1, 4, 0, 17627, 30 },
+    { 1, 4, 0, 17631, 30 },
+    { 1, 4, 0, 17635, 30 },
+    { 1, 4, 0, 17639, 30 },
+    { 1, 4, 0, 17643, 30 },
+    { 1, 4, 0, 17647, 30 },
+    { 1, 4, 0, 17651, 30 },
+    { 1, 4, 0, 17655, 30 },
+    { 1, 4, 0, 17659, 30 },
+    { 1, 4, 0, 17663, 30 },
+    { 1, 4, 0, 17667, 30 },
+    { 1, 4, 0, 17671, 30 },
+    { 1, 4, 0, 17675, 30 },
+    { 1, 4, 0, 17679, 30 },
+    { 1, 4, 0, 17683, 30 },
+    { 1, 4, 0, 17687, 30 },
+    { 1, 4, 0, 17691, 30 },
+    { 1, 4, 0, 17695, 30 },
+    { 1, 4, 0, 17699, 30 },
+    { 1, 4, 0, 17703, 30 },
+    { 1, 4, 0, 17707, 30 },
+    { 1, 4, 0, 17711, 30 },
+    { 1, 4, 0, 17715, 30 },
+    { 1, 4, 0, 17719, 30 },
+    { 1, 4, 0, 17723, 30 },
+    { 1, 4, 0, 17727, 30 },
+    { 1, 4, 0, 17731, 30 },
+    { 1, 4, 0, 17735, 30 },
+    { 1, 4, 0, 17739, 30 },
+    { 1, 4, 0, 17743, 30 },
+    { 1, 4, 0, 17747, 30 },
+    { 1, 4, 0, 17751, 30 },
+    { 1, 4, 0, 17755, 30 },
+    { 1, 4, 0, 17759, 30 },
+    { 1, 4, 0, 17763, 30 },
+    { 1, 4, 0, 17767, 30 },
+    { 1, 4, 0, 17771, 30 },
+    { 1, 4, 0, 17775, 30 },
+    { 1, 4, 0, 17779, 30 },
+    { 1, 4, 0, 17783, 30 },
+    { 1, 4, 0, 17787, 30 },
+    { 1, 4, 0, 17791, 30 },
+    { 1, 4, 0, 17795, 30 },
+    { 1, 4, 0, 17799, 30 },
+    { 1, 4, 0, 17803, 30 },
+    { 1, 4, 0, 17807, 30 },
+    { 1, 4, 0, 17811, 30 },
+    { 1, 4, 0, 17815, 30 },
+    { 1, 4, 0, 17819, 30 },
+    { 1, 4, 0, 17823, 30 },
+    { 1, 4, 0, 17827, 30 },
+    { 1, 4, 0, 17831, 30 },
+    { 1, 4, 0, 17835, 30 },
+    { 1, 4, 0, 17839, 30 },
+    { 1, 4, 0, 17843, 30 },
+    { 1, 4, 0, 17847, 30 },
+    { 1, 4, 0, 17851, 30 },
+    { 1, 4, 0, 17855, 30 },
+    { 1, 4, 0, 17859, 30 },
+    { 1, 4, 0, 17863, 30 },
+    { 1, 4, 0, 17867, 30 },
+    { 1, 4, 0, 17871, 30 },
+    { 1, 4, 0, 17875, 30 },
+    { 1, 4, 0, 17879, 30 },
+    { 1, 4, 0, 17883, 30 },
+    { 1, 4, 0, 17887, 30 },
+    { 1, 4, 0, 17891, 30 },
+    { 1, 4, 0, 17895, 30 },
+    { 1, 4, 0, 17899, 30 },
+    { 1, 4, 0, 17903, 30 },
+    { 1, 4, 0, 17907, 30 },
+    { 1, 4, 0, 17911, 30 },
+    { 1, 4, 0, 17915, 30 },
+    { 1, 4, 0, 17919, 30 },
+    { 1, 4, 0, 17923, 30 },
+    { 1, 4, 0, 17927, 30 },
+    { 1, 4, 0, 17931, 30 },
+    { 1, 4, 0, 17935, 30 },
+    { 1, 4, 0, 17939, 30 },
+    { 1, 4, 0, 17943, 30 },
+    { 1, 4, 0, 17947, 30 },
+    { 1, 4, 0, 17951, 30 },
+    { 1, 4, 0, 17955, 30 },
+    { 1, 4, 0, 17959, 30 },
+    { 1, 4, 0, 17963, 30 },
+    { 1, 4, 0, 17967, 30 },
+    { 1, 4, 0, 17971, 30 },
+    { 0, 4, 4, 17975, 17975 },
+    { 0, 4, 4, 17979, 17979 },
+    { 0, 4, 4, 17983, 17983 },
+    { 0, 4, 4, 17987, 17987 },
+    { 0, 4, 4, 17991, 17991 },
+    { 0, 4, 4, 17995, 17995 },
+    { 0, 4, 4, 17999, 17999 },
+    { 0, 4, 4, 18003, 18003 },
+    { 0, 4, 4, 18007, 18007 },
+    { 0, 4, 4, 18011, 18011 },
+    { 0, 4, 4, 18015, 18015 },
+    { 0, 4, 4, 18019, 18019 },
+    { 0, 4, 4, 18023, 18023 },
+    { 0, 4, 4, 18027, 18027 },
+    { 0, 4, 4, 18031, 18031 },
+    { 0, 4, 4, 18035, 18035 },
+    { 0, 4, 4, 18039, 18039 },
+    { 0, 4, 4, 18043, 18043 },
+    { 0, 4, 4, 18047, 18047 },
+    { 0, 4, 4, 18051, 18051 },
+    { 0, 4, 4, 18055, 18055 },
+    { 0, 4, 4, 18059, 18059 },
+    { 0, 4, 4, 18063, 18063 },
+    { 0, 4, 4, 18067, 18067 },
+    { 0, 4, 4, 18071, 18071 },
+    { 0, 4, 4, 18075, 18075 },
+    { 0, 4, 4, 18079, 18079 },
+    { 0, 4, 4, 18083, 18083 },
+    { 0, 4, 4, 18087, 18087 },
+    { 0, 4, 4, 18091, 18091 },
+    { 0, 4, 4, 18095, 18095 },
+    { 0, 4, 4, 18099, 18099 },
+    { 0, 4, 4, 18103, 18103 },
+    { 0, 4, 4, 18107, 18107 },
+    { 1, 4, 0, 18111, 30 },
+    { 1, 4, 0, 18115, 30 },
+    { 1, 4, 0, 18119, 30 },
+    { 1, 4, 0, 18123, 30 },
+    { 1, 4, 0, 18127, 30 },
+    { 1, 4, 0, 18131, 30 },
+    { 1, 4, 0, 18135, 30 },
+    { 0, 2, 2, 18139, 18139 },
+    { 0, 2, 2, 18141, 18141 },
+    { 0, 2, 2, 18143, 18143 },
+    { 0, 2, 2, 18145, 18147 },
+    { 0, 2, 2, 18149, 18151 },
+    { 0, 2, 2, 18153, 18155 },
+    { 0, 2, 2, 18157, 18157 },
+    { 0, 2, 2, 18159, 18159 },
+    { 0, 2, 2, 18161, 18161 },
+    { 0, 2, 2, 18163, 18163 },
+    { 0, 2, 2, 18165, 18165 },
+    { 0, 2, 2, 18167, 18167 },
+    { 0, 2, 2, 18169, 18169 },
+    { 0, 2, 2, 18171, 18171 },
+    { 0, 7, 7, 18173, 18173 },
+    { 0, 2, 2, 18180, 18180 },
+    { 0, 2, 2, 18182, 18182 },
+    { 0, 2, 2, 18184, 18184 },
+    { 0, 3, 3, 18186, 18186 },
+    { 0, 2, 2, 18189, 18189 },
+    { 0, 2, 2, 18191, 18191 },
+    { 0, 2, 2, 18193, 18193 },
+    { 0, 2, 2, 18195, 18195 },
+    { 0, 2, 2, 18197, 18197 },
+    { 0, 6, 6, 18199, 18199 },
+    { 0, 6, 6, 18205, 18205 },
+    { 0, 3, 3, 18211, 18211 },
+    { 0, 3, 3, 18214, 18214 },
+    { 0, 3, 3, 18217, 6930 },
+    { 0, 3, 3, 18220, 18220 },
+    { 0, 3, 3, 18223, 18223 },
+    { 0, 3, 3, 18226, 18226 },
+    { 0, 3, 3, 18229, 18229 },
+    { 0, 3, 3, 18232, 18232 },
+    { 0, 3, 3, 18235, 18235 },
+    { 0, 3, 3, 18238, 18238 },
+    { 0, 3, 3, 18241, 18241 },
+    { 0, 3, 3, 18244, 18244 },
+    { 0, 3, 3, 18247, 18247 },
+    { 0, 3, 3, 18250, 18250 },
+    { 0, 3, 3, 18253, 18253 },
+    { 0, 3, 3, 18256, 18256 },
+    { 0, 3, 3, 18259, 18259 },
+    { 0, 3, 3, 18262, 18262 },
+    { 0, 3, 3, 18265, 18265 },
+    { 0, 3, 3, 18268, 18268 },
+    { 0, 3, 3, 18271, 18271 },
+    { 0, 3, 3, 18274, 18274 },
+    { 0, 3, 3, 18277, 18277 },
+    { 0, 3, 3, 18280, 18280 },
+    { 0, 3, 3, 18283, 18283 },
+    { 0, 3, 3, 18286, 18286 },
+    { 0, 3, 3, 18289, 18289 },
+    { 0, 3, 3, 18292, 18292 },
+    { 0, 3, 3, 18295, 18295 },
+    { 0, 3, 3, 18298, 18298 },
+    { 0, 3, 3, 18301, 18301 },
+    { 0, 9, 9, 18304, 18304 },
+    { 0, 9, 9, 18313, 18313 },
+    { 0, 9, 9, 18322, 18322 },
+    { 0, 9, 9, 18331, 18331 },
+    { 0, 9, 9, 18340, 18340 },
+    { 0, 9, 9, 18349, 18349 },
+    { 0, 9, 9, 18358, 18358 },
+    { 0, 9, 9, 18367, 18367 },
+    { 0, 9, 9, 18376, 18376 },
+    { 0, 3, 3, 18385, 18385 },
+    { 0, 3, 3, 18388, 18388 },
+    { 0, 3, 3, 18391, 18391 },
+    { 0, 3, 3, 18394, 18394 },
+    { 0, 3, 3, 18397, 18397 },
+    { 0, 4, 4, 18400, 18400 },
+    { 0, 3, 3, 18404, 18404 },
+    { 0, 3, 3, 18407, 18407 },
+    { 0, 3, 3, 18410, 18410 },
+    { 0, 3, 3, 18413, 18413 },
+    { 0, 3, 3, 18416, 18416 },
+    { 0, 3, 3, 18419, 18419 },
+    { 0, 3, 3, 18422, 18422 },
+    { 0, 4, 4, 18425, 18425 },
+    { 0, 3, 3, 18429, 18429 },
+    { 0, 3, 3, 18432, 18432 },
+    { 0, 3, 3, 18435, 18435 },
+    { 0, 4, 4, 18438, 18438 },
+    { 0, 3, 3, 18442, 18442 },
+    { 0, 3, 3, 18445, 18445 },
+    { 0, 4, 4, 18448, 18448 },
+    { 0, 3, 3, 18452, 18452 },
+    { 0, 3, 3, 18455, 18455 },
+    { 0, 3, 3, 18458, 18458 },
+    { 0, 3, 3, 18461, 18461 },
+    { 0, 4, 4, 18464, 18464 },
+    { 0, 3, 3, 18468, 18468 },
+    { 0, 3, 3, 18471, 18471 },
+    { 0, 3, 3, 18474, 18474 },
+    { 0, 3, 3, 18477, 18477 },
+    { 0, 3, 3, 18480, 18480 },
+    { 0, 3, 3, 18483, 18483 },
+    { 0, 3, 3, 18486, 18486 },
+    { 0, 3, 3, 18489, 18489 },
+    { 0, 3, 3, 18492, 18492 },
+    { 0, 3, 3, 18495, 18495 },
+    { 0, 3, 3, 18498, 18498 },
+    { 0, 3, 3, 18501, 18501 },
+    { 0, 3, 3, 18504, 18504 },
+    { 0, 4, 4, 18507, 18507 },
+    { 0, 3, 3, 18511, 18511 },
+    { 0, 3, 3, 18514, 18514 },
+    { 0, 3, 3, 18517, 18517 },
+    { 0, 4, 4, 18520, 18520 },
+    { 0, 3, 3, 18524, 18524 },
+    { 0, 3, 3, 18527, 18527 },
+    { 0, 3, 3, 18530, 18530 },
+    { 0, 3, 3, 18533, 18533 },
+    { 0, 3, 3, 18536, 18536 },
+    { 0, 3, 3, 18539, 18539 },
+    { 0, 3, 3, 18542, 18542 },
+    { 0, 3, 3, 18545, 18545 },
+    { 0, 3, 3, 18548, 18548 },
+    { 0, 3, 3, 18551, 18551 },
+    { 0, 3, 3, 18554, 18554 },
+    { 0, 3, 3, 18557, 18557 },
+    { 0, 3, 3, 18560, 18560 },
+    { 0, 3, 3, 18563, 18563 },
+    { 0, 3, 3, 18566, 18566 },
+    { 0, 3, 3, 18569, 18569 },
+    { 0, 3, 3, 18572, 18572 },
+    { 0, 3, 3, 18575, 18575 },
+    { 0, 3, 3, 18578, 18578 },
+    { 0, 3, 3, 18581, 18581 },
+    { 0, 3, 3, 18584, 18584 },
+    { 0, 3, 3, 18587, 18587 },
+    { 0, 3, 3, 18590, 18590 },
+    { 0, 3, 3, 18593, 18593 },
+    { 0, 3, 3, 18596, 18596 },
+    { 0, 3, 3, 18599, 18599 },
+    { 0, 3, 3, 18602, 18602 },
+    { 0, 3, 3, 18605, 18605 },
+    { 0, 4, 4, 18608, 18608 },
+    { 0, 3, 3, 18612, 18612 },
+    { 0, 3, 3, 18615, 18615 },
+    { 0, 3, 3, 18618, 18618 },
+    { 0, 3, 3, 18621, 18621 },
+    { 0, 3, 3, 18624, 18624 },
+    { 0, 4, 4, 18627, 18627 },
+    { 0, 4, 4, 18631, 18631 },
+    { 0, 3, 3, 18635, 18635 },
+    { 0, 3, 3, 18638, 18638 },
+    { 0, 3, 3, 18641, 18641 },
+    { 0, 3, 3, 18644, 18644 },
+    { 0, 3, 3, 18647, 18647 },
+    { 0, 3, 3, 18650, 18650 },
+    { 0, 3, 3, 18653, 18653 },
+    { 0, 3, 3, 18656, 18656 },
+    { 0, 3, 3, 18659, 18659 },
+    { 0, 4, 4, 18662, 18662 },
+    { 0, 3, 3, 18666, 18666 },
+    { 0, 3, 3, 18669, 18669 },
+    { 0, 3, 3, 18672, 18672 },
+    { 0, 4, 4, 18675, 18675 },
+    { 0, 3, 3, 18679, 18679 },
+    { 0, 3, 3, 18682, 18682 },
+    { 0, 3, 3, 18685, 18685 },
+    { 0, 3, 3, 18688, 18688 },
+    { 0, 3, 3, 18691, 18691 },
+    { 0, 3, 3, 18694, 18694 },
+    { 0, 3, 3, 18697, 18697 },
+    { 0, 4, 4, 18700, 18700 },
+    { 0, 3, 3, 18704, 18704 },
+    { 0, 4, 4, 18707, 18707 },
+    { 0, 3, 3, 18711, 18711 },
+    { 0, 3, 3, 18714, 18714 },
+    { 0, 3, 3, 18717, 18717 },
+    { 0, 3, 3, 18720, 18720 },
+    { 0, 3, 3, 18723, 18723 },
+    { 0, 3, 3, 18726, 18726 },
+    { 0, 3, 3, 18729, 18729 },
+    { 0, 3, 3, 18732, 18732 },
+    { 0, 3, 3, 18735, 18735 },
+    { 0, 3, 3, 18738, 18738 },
+    { 0, 3, 3, 18741, 18741 },
+    { 0, 4, 4, 18744, 18744 },
+    { 0, 3, 3, 18748, 18748 },
+    { 0, 3, 3, 18751, 18751 },
+    { 0, 3, 3, 18754, 18754 },
+    { 0, 3, 3, 18757, 18757 },
+    { 0, 4, 4, 18760, 18760 },
+    { 0, 4, 4, 18764, 18764 },
+    { 0, 3, 3, 18768, 18768 },
+    { 0, 3, 3, 18771, 18771 },
+    { 0, 3, 3, 18774, 18774 },
+    { 0, 4, 4, 18777, 18777 },
+    { 0, 4, 4, 18781, 18781 },
+    { 0, 3, 3, 18785, 18785 },
+    { 0, 3, 3, 18788, 18788 },
+    { 0, 3, 3, 18791, 18791 },
+    { 0, 3, 3, 18794, 18794 },
+    { 0, 3, 3, 18797, 18797 },
+    { 0, 3, 3, 18800, 18800 },
+    { 0, 3, 3, 18803, 18803 },
+    { 0, 3, 3, 18806, 18806 },
+    { 0, 3, 3, 18809, 18809 },
+    { 0, 3, 3, 18812, 18812 },
+    { 0, 4, 4, 18815, 18815 },
+    { 0, 3, 3, 18819, 18819 },
+    { 0, 3, 3, 18822, 18822 },
+    { 0, 3, 3, 18825, 18825 },
+    { 0, 3, 3, 18828, 18828 },
+    { 0, 3, 3, 18831, 18831 },
+    { 0, 3, 3, 18834, 18834 },
+    { 0, 3, 3, 18837, 18837 },
+    { 0, 3, 3, 18840, 18840 },
+    { 0, 3, 3, 18843, 18843 },
+    { 0, 3, 3, 18846, 18846 },
+    { 0, 3, 3, 18849, 18849 },
+    { 0, 3, 3, 18852, 18852 },
+    { 0, 3, 3, 18855, 18855 },
+    { 0, 3, 3, 18858, 18858 },
+    { 0, 4, 4, 18861, 18861 },
+    { 0, 3, 3, 18865, 18865 },
+    { 0, 3, 3, 18868, 18868 },
+    { 0, 3, 3, 18871, 18871 },
+    { 0, 3, 3, 18874, 18874 },
+    { 0, 3, 3, 18877, 18877 },
+    { 0, 4, 4, 18880, 18880 },
+    { 0, 3, 3, 18884, 18884 },
+    { 0, 3, 3, 18887, 18887 },
+    { 0, 3, 3, 18890, 18890 },
+    { 0, 3, 3, 18893, 18893 },
+    { 0, 3, 3, 18896, 18896 },
+    { 0, 3, 3, 18899, 18899 },
+    { 0, 3, 3, 18902, 18902 },
+    { 0, 3, 3, 18905, 18905 },
+    { 0, 3, 3, 18908, 18908 },
+    { 0, 3, 3, 18911, 18911 },
+    { 0, 4, 4, 18914, 18914 },
+    { 0, 3, 3, 18918, 18918 },
+    { 0, 3, 3, 18921, 18921 },
+    { 0, 3, 3, 18924, 18924 },
+    { 0, 3, 3, 18927, 18927 },
+    { 0, 3, 3, 18930, 18930 },
+    { 0, 3, 3, 18933, 18933 },
+    { 0, 3, 3, 18936, 18936 },
+    { 0, 3, 3, 18939, 18939 },
+    { 0, 3, 3, 18942, 18942 },
+    { 0, 3, 3, 18945, 18945 },
+    { 0, 3, 3, 18948, 18948 },
+    { 0, 3, 3, 18951, 18951 },
+    { 0, 3, 3, 18954, 18954 },
+    { 0, 3, 3, 18957, 18957 },
+    { 0, 3, 3, 18960, 18960 },
+    { 0, 4, 4, 18963, 18963 },
+    { 0, 3, 3, 18967, 18967 },
+    { 0, 3, 3, 18970, 18970 },
+    { 0, 3, 3, 18973, 18973 },
+    { 0, 3, 3, 18976, 18976 },
+    { 0, 4, 4, 18979, 18979 },
+    { 0, 3, 3, 18983, 18983 },
+    { 0, 3, 3, 18986, 18986 },
+    { 0, 3, 3, 18989, 18989 },
+    { 0, 3, 3, 18992, 18992 },
+    { 0, 3, 3, 18995, 18995 },
+    { 0, 3, 3, 18998, 18998 },
+    { 0, 3, 3, 19001, 19001 },
+    { 0, 4, 4, 19004, 19004 },
+    { 0, 3, 3, 19008, 19008 },
+    { 0, 3, 3, 19011, 19011 },
+    { 0, 3, 3, 19014, 19014 },
+    { 0, 4, 4, 19017, 19017 },
+    { 0, 3, 3, 19021, 19021 },
+    { 0, 3, 3, 19024, 19024 },
+    { 0, 3, 3, 19027, 19027 },
+    { 0, 3, 3, 19030, 19030 },
+    { 0, 3, 3, 19033, 19033 },
+    { 0, 4, 4, 19036, 19036 },
+    { 0, 4, 4, 19040, 19040 },
+    { 0, 4, 4, 19044, 19044 },
+    { 0, 3, 3, 19048, 19048 },
+    { 0, 4, 4, 19051, 19051 },
+    { 0, 3, 3, 19055, 19055 },
+    { 0, 3, 3, 19058, 19058 },
+    { 0, 3, 3, 19061, 19061 },
+    { 0, 3, 3, 19064, 19064 },
+    { 0, 3, 3, 19067, 19067 },
+    { 0, 3, 3, 19070, 19070 },
+    { 0, 3, 3, 19073, 19073 },
+    { 0, 3, 3, 19076, 19076 },
+    { 0, 4, 4, 19079, 19079 },
+    { 0, 3, 3, 19083, 19083 },
+    { 0, 3, 3, 19086, 19086 },
+    { 0, 3, 3, 19089, 19089 },
+    { 0, 3, 3, 19092, 19092 },
+    { 0, 3, 3, 19095, 19095 },
+    { 0, 4, 4, 19098, 19098 },
+    { 0, 3, 3, 19102, 19102 },
+    { 0, 3, 3, 19105, 19105 },
+    { 0, 4, 4, 19108, 19108 },
+    { 0, 4, 4, 19112, 19112 },
+    { 0, 3, 3, 19116, 19116 },
+    { 0, 3, 3, 19119, 19119 },
+    { 0, 3, 3, 19122, 19122 },
+    { 0, 3, 3, 19125, 19125 },
+    { 0, 3, 3, 19128, 19128 },
+    { 0, 3, 3, 19131, 19131 },
+    { 0, 3, 3, 19134, 19134 },
+    { 0, 3, 3, 19137, 19137 },
+    { 0, 4, 4, 19140, 19140 },
+    { 0, 3, 3, 19144, 19144 },
+    { 0, 4, 4, 19147, 19147 },
+    { 0, 3, 3, 19151, 19151 },
+    { 0, 4, 4, 19154, 19154 },
+    { 0, 3, 3, 19158, 19158 },
+    { 0, 3, 3, 19161, 19161 },
+    { 0, 4, 4, 19164, 19164 },
+    { 0, 3, 3, 19168, 19168 },
+    { 0, 3, 3, 19171, 19171 },
+    { 0, 4, 4, 19174, 19174 },
+    { 0, 4, 4, 19178, 19178 },
+    { 0, 3, 3, 19182, 19182 },
+    { 0, 3, 3, 19185, 19185 },
+    { 0, 3, 3, 19188, 19188 },
+    { 0, 3, 3, 19191, 19191 },
+    { 0, 3, 3, 19194, 19194 },
+    { 0, 3, 3, 19197, 19197 },
+    { 0, 3, 3, 19200, 19200 },
+    { 0, 3, 3, 19203, 19203 },
+    { 0, 3, 3, 19206, 19206 },
+    { 0, 3, 3, 19209, 19209 },
+    { 0, 3, 3, 19212, 19212 },
+    { 0, 4, 4, 19215, 19215 },
+    { 0, 3, 3, 19219, 19219 },
+    { 0, 4, 4, 19222, 19222 },
+    { 0, 4, 4, 19226, 19226 },
+    { 0, 3, 3, 19230, 19230 },
+    { 0, 4, 4, 19233, 19233 },
+    { 0, 4, 4, 19237, 19237 },
+    { 0, 4, 4, 19241, 19241 },
+    { 0, 3, 3, 19245, 19245 },
+    { 0, 3, 3, 19248, 19248 },
+    { 0, 4, 4, 19251, 19251 },
+    { 0, 4, 4, 19255, 19255 },
+    { 0, 4, 4, 19259, 19259 },
+    { 0, 4, 4, 19263, 19263 },
+    { 0, 3, 3, 19267, 19267 },
+    { 0, 3, 3, 19270, 19270 },
+    { 0, 3, 3, 19273, 19273 },
+    { 0, 3, 3, 19276, 19276 },
+    { 0, 3, 3, 19279, 19279 },
+    { 0, 4, 4, 19282, 19282 },
+    { 0, 3, 3, 19286, 19286 },
+    { 0, 3, 3, 19289, 19289 },
+    { 0, 4, 4, 19292, 19292 },
+    { 0, 4, 4, 19296, 19296 },
+    { 0, 4, 4, 19300, 19300 },
+    { 0, 3, 3, 19304, 19304 },
+    { 0, 3, 3, 19307, 19307 },
+    { 0, 3, 3, 19310, 19310 },
+    { 0, 3, 3, 19313, 19313 },
+    { 0, 4, 4, 19316, 19316 },
+    { 0, 4, 4, 19320, 19320 },
+    { 0, 3, 3, 19324, 19324 },
+    { 0, 3, 3, 19327, 19327 },
+    { 0, 4, 4, 19330, 19330 },
+    { 0, 3, 3, 19334, 19334 },
+    { 0, 3, 3, 19337, 19337 },
+    { 0, 3, 3, 19340, 19340 },
+    { 0, 4, 4, 19343, 19343 },
+    { 0, 3, 3, 19347, 19347 },
+    { 0, 3, 3, 19350, 19350 },
+    { 0, 3, 3, 19353, 19353 },
+    { 0, 3, 3, 19356, 19356 },
+    { 0, 3, 3, 19359, 19359 },
+    { 0, 4, 4, 19362, 19362 },
+    { 0, 3, 3, 19366, 19366 },
+    { 0, 3, 3, 19369, 19369 },
+    { 0, 3, 3, 19372, 19372 },
+    { 0, 3, 3, 19375, 19375 },
+    { 0, 3, 3, 19378, 19378 },
+    { 0, 3, 3, 19381, 19381 },
+    { 0, 4, 4, 19384, 19384 },
+    { 0, 4, 4, 19388, 19388 },
+    { 0, 3, 3, 19392, 19392 },
+    { 0, 4, 4, 19395, 19395 },
+    { 0, 3, 3, 19399, 19399 },
+    { 0, 4, 4, 19402, 19402 },
+    { 0, 3, 3, 19406, 19406 },
+    { 0, 3, 3, 19409, 19409 },
+    { 0, 4, 4, 19412, 19412 },
+    { 0, 4, 4, 19416, 19416 },
+    { 0, 3, 3, 19420, 19420 },
+    { 0, 4, 4, 19423, 19423 },
+    { 0, 3, 3, 19427, 19427 },
+    { 0, 4, 4, 19430, 19430 },
+    { 0, 3, 3, 19434, 19434 },
+    { 0, 3, 3, 19437, 19437 },
+    { 0, 3, 3, 19440, 19440 },
+    { 0, 3, 3, 19443, 19443 },
+    { 0, 3, 3, 19446, 19446 },
+    { 0, 3, 3, 19449, 19449 },
+    { 0, 4, 4, 19452, 19452 },
+    { 0, 4, 4, 19456, 19456 },
+    { 0, 4, 4, 19460, 19460 },
+    { 0, 4, 4, 19464, 19464 },
+    { 0, 3, 3, 19468, 19468 },
+    { 0, 3, 3, 19471, 19471 },
+    { 0, 3, 3, 19474, 19474 },
+    { 0, 3, 3, 19477, 19477 },
+    { 0, 3, 3, 19480, 19480 },
+    { 0, 3, 3, 19483, 19483 },
+    { 0, 3, 3, 19486, 19486 },
+    { 0, 3, 3, 19489, 19489 },
+    { 0, 3, 3, 19492, 19492 },
+    { 0, 3, 3, 19495, 19495 },
+    { 0, 3, 3, 19498, 19498 },
+    { 0, 4, 4, 19501, 19501 },
+    { 0, 3, 3, 19505, 19505 },
+    { 0, 3, 3, 19508, 19508 },
+    { 0, 3, 3, 19511, 19511 },
+    { 0, 3, 3, 19514, 19514 },
+    { 0, 3, 3, 19517, 19517 },
+    { 0, 3, 3, 19520, 19520 },
+    { 0, 3, 3, 19523, 19523 },
+    { 0, 3, 3, 19526, 19526 },
+    { 0, 3, 3, 19529, 19529 },
+    { 0, 3, 3, 19532, 19532 },
+    { 0, 4, 4, 19535, 19535 },
+    { 0, 4, 4, 19539, 19539 },
+    { 0, 4, 4, 19543, 19543 },
+    { 0, 3, 3, 19547, 19547 },
+    { 0, 3, 3, 19550, 19550 },
+    { 0, 3, 3, 19553, 19553 },
+    { 0, 3, 3, 19556, 19556 },
+    { 0, 4, 4, 19559, 19559 },
+    { 0, 3, 3, 19563, 19563 },
+    { 0, 4, 4, 19566, 19566 },
+    { 0, 3, 3, 19570, 19570 },
+    { 0, 3, 3, 19573, 19573 },
+    { 0, 4, 4, 19576, 19576 },
+    { 0, 4, 4, 19580, 19580 },
+    { 0, 3, 3, 19584, 19584 },
+    { 0, 3, 3, 19587, 19587 },
+    { 0, 3, 3, 19590, 19590 },
+    { 0, 3, 3, 19593, 19593 },
+    { 0, 3, 3, 19596, 19596 },
+    { 0, 3, 3, 19599, 19599 },
+    { 0, 3, 3, 19602, 19602 },
+    { 0, 3, 3, 19605, 19605 },
+    { 0, 3, 3, 19608, 19608 },
+    { 0, 3, 3, 19611, 19611 },
+    { 0, 3, 3, 19614, 19614 },
+    { 0, 3, 3, 19617, 19617 },
+    { 0, 3, 3, 19620, 19620 },
+    { 0, 3, 3, 19623, 19623 },
+    { 0, 3, 3, 19626, 19626 },
+    { 0, 3, 3, 19629, 19629 },
+    { 0, 4, 4, 19632, 19632 },
+    { 0, 3, 3, 19636, 19636 },
+    { 0, 3, 3, 19639, 19639 },
+    { 0, 3, 3, 19642, 19642 },
+    { 0, 3, 3, 19645, 19645 },
+    { 0, 3, 3, 19648, 19648 },
+    { 0, 4, 4, 19651, 19651 },
+    { 0, 4, 4, 19655, 19655 },
+    { 0, 3, 3, 19659, 19659 },
+    { 0, 3, 3, 19662, 19662 },
+    { 0, 3, 3, 19665, 19665 },
+    { 0, 4, 4, 19668, 19668 },
+    { 0, 3, 3, 19672, 19672 },
+    { 0, 3, 3, 19675, 19675 },
+    { 0, 3, 3, 19678, 19678 },
+    { 0, 3, 3, 19681, 19681 },
+    { 0, 4, 4, 19684, 19684 },
+    { 0, 4, 4, 19688, 19688 },
+    { 0, 3, 3, 19692, 19692 },
+    { 0, 3, 3, 19695, 19695 },
+    { 0, 3, 3, 19698, 19698 },
+    { 0, 4, 4, 19701, 19701 },
+    { 0, 3, 3, 19705, 19705 },
+    { 0, 4, 4, 19708, 19708 },
+    { 0, 4, 4, 19712, 19712 },
+    { 0, 3, 3, 19716, 19716 },
+    { 0, 3, 3, 19719, 19719 },
+    { 0, 3, 3, 19722, 19722 },
+    { 0, 4, 4, 19725, 19725 },
+    { 0, 3, 3, 19729, 19729 },
+    { 0, 3, 3, 19732, 19732 },
+    { 0, 3, 3, 19735, 19735 },
+    { 0, 3, 3, 19738, 19738 },
+    { 0, 3, 3, 19741, 19741 },
+    { 0, 3, 3, 19744, 19744 },
+    { 0, 3, 3, 19747, 19747 },
+    { 0, 4, 4, 19750, 19750 },
+    { 0, 3, 3, 19754, 19754 },
+    { 0, 3, 3, 19757, 19757 },
+    { 0, 3, 3, 19760, 19760 },
+    { 0, 4, 4, 19763, 19763 },
+    { 0, 3, 3, 19767, 19767 },
+    { 0, 3, 3, 19770, 19770 },
+    { 0, 3, 3, 19773, 19773 },
+    { 0, 3, 3, 19776, 19776 },
+    { 0, 4, 4, 19779, 19779 },
+    { 0, 4, 4, 19783, 19783 },
+    { 0, 3, 3, 19787, 19787 },
+    { 0, 3, 3, 19790, 19790 },
+    { 0, 3, 3, 19793, 19793 },
+    { 0, 4, 4, 19796, 19796 },
+    { 0, 3, 3, 19800, 19800 },
+    { 0, 4, 4, 19803, 19803 },
+    { 0, 3, 3, 19807, 19807 },
+    { 0, 4, 4, 19810, 19810 },
+    { 0, 3, 3, 19814, 19814 },
+    { 0, 3, 3, 19817, 19817 },
+    { 0, 3, 3, 19820, 19820 },
+    { 0, 3, 3, 19823, 19823 },
+    { 0, 3, 3, 19826, 19826 },
+    { 0, 3, 3, 19829, 19829 },
+    { 0, 3, 3, 19832, 19832 },
+    { 0, 4, 4, 19835, 19835 },
+    { 0, 3, 3, 19839, 19839 },
+    { 0, 3, 3, 19842, 19842 },
+    { 0, 3, 3, 19845, 19845 },
+    { 0, 3, 3, 19848, 19848 },
+    { 0, 3, 3, 19851, 19851 },
+    { 0, 4, 4, 19854, 19854 },
+    { 0, 3, 3, 19858, 19858 },
+    { 0, 4, 4, 19861, 19861 },
+    { 0, 4, 4, 19865, 19865 },
+    { 0, 4, 4, 19869, 19869 },
+    { 0, 3, 3, 19873, 19873 },
+    { 0, 3, 3, 19876, 19876 },
+    { 0, 3, 3, 19879, 19879 },
+    { 0, 3, 3, 19882, 19882 },
+    { 0, 3, 3, 19885, 19885 },
+    { 0, 4, 4, 19888, 19888 },
+};
+
+const char unicode_mapping_data[] =
+    "\x6f\x6c\x61\x62\x63\x64\x65\x66\x67\x68\x69\x6a\x6b\x6d\x6e\x70\x71\x72\x73\x74\x75\x76\x77\x78"
+    "\x79\x7a\x20\x20\xcc\x88\x20\xcc\x84\x32\x33\x20\xcc\x81\xce\xbc\x20\xcc\xa7\x31\x31\xe2\x81\x84"
+    "\x34\x6c\xe2\x81\x84\x34\x31\xe2\x81\x84\x32\x6c\xe2\x81\x84\x32\x33\xe2\x81\x84\x34\xc3\xa0\xc3"
+    "\xa1\xc3\xa2\xc3\xa3\xc3\xa4\xc3\xa5\xc3\xa6\xc3\xa7\xc3\xa8\xc3\xa9\xc3\xaa\xc3\xab\xc3\xac\xc3"
+    "\xad\xc3\xae\xc3\xaf\xc3\xb0\xc3\xb1\xc3\xb2\xc3\xb3\xc3\xb4\xc3\xb5\xc3\xb6\xc3\xb8\xc3\xb9\xc3"
+    "\xba\xc3\xbb\xc3\xbc\xc3\xbd\xc3\xbe\x73\x73\xc4\x81\xc4\x83\xc4\x85\xc4\x87\xc4\x89\xc4\x8b\xc4"
+    "\x8d\xc4\x8f\xc4\x91\xc4\x93\xc4\x95\xc4\x97\xc4\x99\xc4\x9b\xc4\x9d\xc4\x9f\xc4\xa1\xc4\xa3\xc4"
+    "\xa5\xc4\xa7\xc4\xa9\xc4\xab\xc4\xad\xc4\xaf\x69\xcc\x87\x69\x6a\xc4\xb5\xc4\xb7\xc4\xba\xc4\xbc"
+    "\xc4\xbe\x6c\xc2\xb7\xc5\x82\xc5\x84\xc5\x86\xc5\x88\xca\xbc\x6e\xc5\x8b\xc5\x8d\xc5\x8f\xc5\x91"
+    "\xc5\x93\xc5\x95\xc5\x97\xc5\x99\xc5\x9b\xc5\x9d\xc5\x9f\xc5\xa1\xc5\xa3\xc5\xa5\xc5\xa7\xc5\xa9"
+    "\xc5\xab\xc5\xad\xc5\xaf\xc5\xb1\xc5\xb3\xc5\xb5\xc5\xb7\xc3\xbf\xc5\xba\xc5\xbc\xc5\xbe\xc9\x93"
+    "\xc6\x83\xc6\x85\xc9\x94\xc6\x88\xc9\x96\xc9\x97\xc6\x8c\xc7\x9d\xc9\x99\xc9\x9b\xc6\x92\xc9\xa0"
+    "\xc9\xa3\xc9\xa9\xc9\xa8\xc6\x99\xc9\xaf\xc9\xb2\xc9\xb5\xc6\xa1\xc6\xa3\xc6\xa5\xca\x80\xc6\xa8"
+    "\xca\x83\xc6\xad\xca\x88\xc6\xb0\xca\x8a\xca\x8b\xc6\xb4\xc6\xb6\xca\x92\xc6\xb9\xc6\xbd\x64\xc5"
+    "\xbe\x64\x7a\x6c\x6a\x6e\x6a\xc7\x8e\xc7\x90\xc7\x92\xc7\x94\xc7\x96\xc7\x98\xc7\x9a\xc7\x9c\xc7"
+    "\x9f\xc7\xa1\xc7\xa3\xc7\xa5\xc7\xa7\xc7\xa9\xc7\xab\xc7\xad\xc7\xaf\xc7\xb5\xc6\x95\xc6\xbf\xc7"
+    "\xb9\xc7\xbb\xc7\xbd\xc7\xbf\xc8\x81\xc8\x83\xc8\x85\xc8\x87\xc8\x89\xc8\x8b\xc8\x8d\xc8\x8f\xc8"
+    "\x91\xc8\x93\xc8\x95\xc8\x97\xc8\x99\xc8\x9b\xc8\x9d\xc8\x9f\xc6\x9e\xc8\xa3\xc8\xa5\xc8\xa7\xc8"
+    "\xa9\xc8\xab\xc8\xad\xc8\xaf\xc8\xb1\xc8\xb3\xe2\xb1\xa5\xc8\xbc\xc6\x9a\xe2\xb1\xa6\xc9\x82\xc6"
+    "\x80\xca\x89\xca\x8c\xc9\x87\xc9\x89\xc9\x8b\xc9\x8d\xc9\x8f\xc9\xa6\xc9\xb9\xc9\xbb\xca\x81\x20"
+    "\xcc\x86\x20\xcc\x87\x20\xcc\x8a\x20\xcc\xa8\x20\xcc\x83\x20\xcc\x8b\xca\x95\xcc\x80\xcc\x81\xcc"
+    "\x82\xcc\x83\xcc\x84\xcc\x85\xcc\x86\xcc\x87\xcc\x88\xcc\x89\xcc\x8a\xcc\x8b\xcc\x8c\xcc\x8d\xcc"
+    "\x8e\xcc\x8f\xcc\x90\xcc\x91\xcc\x92\xcc\x93\xcc\x94\xcc\x95\xcc\x96\xcc\x97\xcc\x98\xcc\x99\xcc"
+    "\x9a\xcc\x9b\xcc\x9c\xcc\x9d\xcc\x9e\xcc\x9f\xcc\xa0\xcc\xa1\xcc\xa2\xcc\xa3\xcc\xa4\xcc\xa5\xcc"
+    "\xa6\xcc\xa7\xcc\xa8\xcc\xa9\xcc\xaa\xcc\xab\xcc\xac\xcc\xad\xcc\xae\xcc\xaf\xcc\xb0\xcc\xb1\xcc"
+    "\xb2\xcc\xb3\xcc\xb4\xcc\xb5\xcc\xb6\xcc\xb7\xcc\xb8\xcc\xb9\xcc\xba\xcc\xbb\xcc\xbc\xcc\xbd\xcc"
+    "\xbe\xcc\xbf\xcd\x82\xcc\x88\xcc\x81\xce\xb9\xcd\x86\xcd\x87\xcd\x88\xcd\x89\xcd\x8a\xcd\x8b\xcd"
+    "\x8c\xcd\x8d\xcd\x8e\xcd\x90\xcd\x91\xcd\x92\xcd\x93\xcd\x94\xcd\x95\xcd\x96\xcd\x97\xcd\x98\xcd"
+    "\x99\xcd\x9a\xcd\x9b\xcd\x9c\xcd\x9d\xcd\x9e\xcd\x9f\xcd\xa0\xcd\xa1\xcd\xa2\xcd\xa3\xcd\xa4\xcd"
+    "\xa5\xcd\xa6\xcd\xa7\xcd\xa8\xcd\xa9\xcd\xaa\xcd\xab\xcd\xac\xcd\xad\xcd\xae\xcd\xaf\xcd\xb1\xcd"
+    "\xb3\xca\xb9\xcd\xb7\x20\xce\xb9\x20\x69\x3b\xcf\xb3\x20\xcc\x88\xcc\x81\xce\xac\xc2\xb7\xce\xad"
+    "\xce\xae\xce\xb7\xce\xaf\xcf\x8c\xcf\x8d\xcf\x8e\xce\xb1\xce\xb2\xce\xb3\xce\xb4\xce\xb5\xce\xb6"
+    "\xce\xb8\xce\xba\xce\xbb\xce\xbd\xce\xbe\xce\xbf\xcf\x80\xcf\x81\xcf\x83\xcf\x84\xcf\x85\xcf\x86"
+    "\xcf\x87\xcf\x88\xcf\x89\xcf\x8a\xcf\x8b\xcf\x97\xcf\x99\xcf\x9b\xcf\x9d\xcf\x9f\xcf\xa1\xcf\xa3"
+    "\xcf\xa5\xcf\xa7\xcf\xa9\xcf\xab\xcf\xad\xcf\xaf\xcf\xb8\xcf\xbb\xcd\xbb\xcd\xbc\xcd\xbd\xd1\x90"
+    "\xd1\x91\xd1\x92\xd1\x93\xd1\x94\xd1\x95\xd1\x96\xd1\x97\xd1\x98\xd1\x99\xd1\x9a\xd1\x9b\xd1\x9c"
+    "\xd1\x9d\xd0\xb8\xd1\x9e\xd1\x9f\xd0\xb0\xd0\xb1\xd0\xb2\xd0\xb3\xd0\xb4\xd0\xb5\xd0\xb6\xd0\xb7"
+    "\xd0\xb9\xd0\xba\xd0\xbb\xd0\xbc\xd0\xbd\xd0\xbe\xd0\xbf\xd1\x80\xd1\x81\xd1\x82\xd1\x83\xd1\x84"
+    "\xd1\x85\xd1\x86\xd1\x87\xd1\x88\xd1\x89\xd1\x8a\xd1\x8b\xd1\x8c\xd1\x8d\xd1\x8e\xd1\x8f\xd1\xa1"
+    "\xd1\xa3\xd1\xa5\xd1\xa7\xd1\xa9\xd1\xab\xd1\xad\xd1\xaf\xd1\xb1\xd1\xb3\xd1\xb5\xd1\xb7\xd1\xb9"
+    "\xd1\xbb\xd1\xbd\xd1\xbf\xd2\x81\xd2\x83\xd2\x84\xd2\x85\xd2\x86\xd2\x87\xd2\x88\xd2\x89\xd2\x8b"
+    "\xd2\x8d\xd2\x8f\xd2\x91\xd2\x93\xd2\x95\xd2\x97\xd2\x99\xd2\x9b\xd2\x9d\xd2\x9f\xd2\xa1\xd2\xa3"
+    "\xd2\xa5\xd2\xa7\xd2\xa9\xd2\xab\xd2\xad\xd2\xaf\xd2\xb1\xd2\xb3\xd2\xb5\xd2\xb7\xd2\xb9\xd2\xbb"
+    "\xd2\xbd\xd2\xbf\xd3\x8f\xd3\x82\xd3\x84\xd3\x86\xd3\x88\xd3\x8a\xd3\x8c\xd3\x8e\xd3\x91\xd3\x93"
+    "\xd3\x95\xd3\x97\xd3\x99\xd3\x9b\xd3\x9d\xd3\x9f\xd3\xa1\xd3\xa3\xd3\xa5\xd3\xa7\xd3\xa9\xd3\xab"
+    "\xd3\xad\xd3\xaf\xd3\xb1\xd3\xb3\xd3\xb5\xd3\xb7\xd3\xb9\xd3\xbb\xd3\xbd\xd3\xbf\xd4\x81\xd4\x83"
+    "\xd4\x85\xd4\x87\xd4\x89\xd4\x8b\xd4\x8d\xd4\x8f\xd4\x91\xd4\x93\xd4\x95\xd4\x97\xd4\x99\xd4\x9b"
+    "\xd4\x9d\xd4\x9f\xd4\xa1\xd4\xa3\xd4\xa5\xd4\xa7\xd4\xa9\xd4\xab\xd4\xad\xd4\xaf\xd5\xa1\xd5\xa2"
+    "\xd5\xa3\xd5\xa4\xd5\xa5\xd5\xa6\xd5\xa7\xd5\xa8\xd5\xa9\xd5\xaa\xd5\xab\xd5\xac\xd5\xad\xd5\xae"
+    "\xd5\xaf\xd5\xb0\xd5\xb1\xd5\xb2\xd5\xb3\xd5\xb4\xd5\xb5\xd5\xb6\xd5\xb7\xd5\xb8\xd5\xb9\xd5\xba"
+    "\xd5\xbb\xd5\xbc\xd5\xbd\xd5\xbe\xd5\xbf\xd6\x80\xd6\x81\xd6\x82\xd6\x83\xd6\x84\xd6\x85\xd6\x86"
+    "\xd5\xa5\xd6\x82\xd6\x91\xd6\x92\xd6\x93\xd6\x94\xd6\x95\xd6\x96\xd6\x97\xd6\x98\xd6\x99\xd6\x9a"
+    "\xd6\x9b\xd6\x9c\xd6\x9d\xd6\x9e\xd6\x9f\xd6\xa0\xd6\xa1\xd6\xa2\xd6\xa3\xd6\xa4\xd6\xa5\xd6\xa6"
+    "\xd6\xa7\xd6\xa8\xd6\xa9\xd6\xaa\xd6\xab\xd6\xac\xd6\xad\xd6\xae\xd6\xaf\xd6\xb0\xd6\xb1\xd6\xb2"
+    "\xd6\xb3\xd6\xb4\xd6\xb5\xd6\xb6\xd6\xb7\xd6\xb8\xd6\xb9\xd6\xba\xd6\xbb\xd6\xbc\xd6\xbd\xd6\xbf"
+    "\xd7\x81\xd7\x82\xd7\x84\xd7\x85\xd7\x87\xd8\x90\xd8\x91\xd8\x92\xd8\x93\xd8\x94\xd8\x95\xd8\x96"
+    "\xd8\x97\xd8\x98\xd8\x99\xd8\x9a\xd8\xa7\xd9\x88\xd9\x8a\xd9\x8b\xd9\x8c\xd9\x8d\xd9\x8e\xd9\x8f"
+    "\xd9\x90\xd9\x91\xd9\x92\xd9\x93\xd9\x94\xd9\x95\xd9\x96\xd9\x97\xd9\x98\xd9\x99\xd9\x9a\xd9\x9b"
+    "\xd9\x9c\xd9\x9d\xd9\x9e\xd9\x9f\xd9\xb0\xd8\xa7\xd9\xb4\xd9\x88\xd9\xb4\xdb\x87\xd9\xb4\xd9\x8a"
+    "\xd9\xb4\xdb\x95\xdb\x81\xdb\x92\xdb\x96\xdb\x97\xdb\x98\xdb\x99\xdb\x9a\xdb\x9b\xdb\x9c\xdb\x9f"
+    "\xdb\xa0\xdb\xa1\xdb\xa2\xdb\xa3\xdb\xa4\xdb\xa7\xdb\xa8\xdb\xaa\xdb\xab\xdb\xac\xdb\xad\xdc\x91"
+    "\xdc\xb0\xdc\xb1\xdc\xb2\xdc\xb3\xdc\xb4\xdc\xb5\xdc\xb6\xdc\xb7\xdc\xb8\xdc\xb9\xdc\xba\xdc\xbb"
+    "\xdc\xbc\xdc\xbd\xdc\xbe\xdc\xbf\xdd\x80\xdd\x81\xdd\x82\xdd\x83\xdd\x84\xdd\x85\xdd\x86\xdd\x87"
+    "\xdd\x88\xdd\x89\xdd\x8a\xde\xa6\xde\xa7\xde\xa8\xde\xa9\xde\xaa\xde\xab\xde\xac\xde\xad\xde\xae"
+    "\xde\xaf\xde\xb0\xdf\xab\xdf\xac\xdf\xad\xdf\xae\xdf\xaf\xdf\xb0\xdf\xb1\xdf\xb2\xdf\xb3\xdf\xbd"
+    "\xe0\xa0\x96\xe0\xa0\x97\xe0\xa0\x98\xe0\xa0\x99\xe0\xa0\x9b\xe0\xa0\x9c\xe0\xa0\x9d\xe0\xa0\x9e"
+    "\xe0\xa0\x9f\xe0\xa0\xa0\xe0\xa0\xa1\xe0\xa0\xa2\xe0\xa0\xa3\xe0\xa0\xa5\xe0\xa0\xa6\xe0\xa0\xa7"
+    "\xe0\xa0\xa9\xe0\xa0\xaa\xe0\xa0\xab\xe0\xa0\xac\xe0\xa0\xad\xe0\xa1\x99\xe0\xa1\x9a\xe0\xa1\x9b"
+    "\xe0\xa2\x98\xe0\xa2\x99\xe0\xa2\x9a\xe0\xa2\x9b\xe0\xa2\x9c\xe0\xa2\x9d\xe0\xa2\x9e\xe0\xa2\x9f"
+    "\xe0\xa3\x8a\xe0\xa3\x8b\xe0\xa3\x8c\xe0\xa3\x8d\xe0\xa3\x8e\xe0\xa3\x8f\xe0\xa3\x90\xe0\xa3\x91"
+    "\xe0\xa3\x92\xe0\xa3\x93\xe0\xa3\x94\xe0\xa3\x95\xe0\xa3\x96\xe0\xa3\x97\xe0\xa3\x98\xe0\xa3\x99"
+    "\xe0\xa3\x9a\xe0\xa3\x9b\xe0\xa3\x9c\xe0\xa3\x9d\xe0\xa3\x9e\xe0\xa3\x9f\xe0\xa3\xa0\xe0\xa3\xa1"
+    "\xe0\xa3\xa3\xe0\xa3\xa4\xe0\xa3\xa5\xe0\xa3\xa6\xe0\xa3\xa7\xe0\xa3\xa8\xe0\xa3\xa9\xe0\xa3\xaa"
+    "\xe0\xa3\xab\xe0\xa3\xac\xe0\xa3\xad\xe0\xa3\xae\xe0\xa3\xaf\xe0\xa3\xb0\xe0\xa3\xb1\xe0\xa3\xb2"
+    "\xe0\xa3\xb3\xe0\xa3\xb4\xe0\xa3\xb5\xe0\xa3\xb6\xe0\xa3\xb7\xe0\xa3\xb8\xe0\xa3\xb9\xe0\xa3\xba"
+    "\xe0\xa3\xbb\xe0\xa3\xbc\xe0\xa3\xbd\xe0\xa3\xbe\xe0\xa3\xbf\xe0\xa4\x80\xe0\xa4\x81\xe0\xa4\x82"
+    "\xe0\xa4\xa8\xe0\xa4\xb0\xe0\xa4\xb3\xe0\xa4\xba\xe0\xa4\xbc\xe0\xa5\x81\xe0\xa5\x82\xe0\xa5\x83"
+    "\xe0\xa5\x84\xe0\xa5\x85\xe0\xa5\x86\xe0\xa5\x87\xe0\xa5\x88\xe0\xa5\x8d\xe0\xa5\x91\xe0\xa5\x92"
+    "\xe0\xa5\x93\xe0\xa5\x94\xe0\xa5\x95\xe0\xa5\x96\xe0\xa5\x97\xe0\xa4\x95\xe0\xa4\xbc\xe0\xa4\x95"
+    "\xe0\xa4\x96\xe0\xa4\xbc\xe0\xa4\x96\xe0\xa4\x97\xe0\xa4\xbc\xe0\xa4\x97\xe0\xa4\x9c\xe0\xa4\xbc"
+    "\xe0\xa4\x9c\xe0\xa4\xa1\xe0\xa4\xbc\xe0\xa4\xa1\xe0\xa4\xa2\xe0\xa4\xbc\xe0\xa4\xa2\xe0\xa4\xab"
+    "\xe0\xa4\xbc\xe0\xa4\xab\xe0\xa4\xaf\xe0\xa4\xbc\xe0\xa4\xaf\xe0\xa5\xa2\xe0\xa5\xa3\xe0\xa6\x81"
+    "\xe0\xa6\xbc\xe0\xa7\x81\xe0\xa7\x82\xe0\xa7\x83\xe0\xa7\x84\xe0\xa7\x8d\xe0\xa6\xa1\xe0\xa6\xbc"
+    "\xe0\xa6\xa1\xe0\xa6\xa2\xe0\xa6\xbc\xe0\xa6\xa2\xe0\xa6\xaf\xe0\xa6\xbc\xe0\xa6\xaf\xe0\xa7\xa2"
+    "\xe0\xa7\xa3\xe0\xa7\xbe\xe0\xa8\x81\xe0\xa8\x82\xe0\xa8\xb2\xe0\xa8\xbc\xe0\xa8\xb2\xe0\xa8\xb8"
+    "\xe0\xa8\xbc\xe0\xa8\xb8\xe0\xa8\xbc\xe0\xa9\x81\xe0\xa9\x82\xe0\xa9\x87\xe0\xa9\x88\xe0\xa9\x8b"
+    "\xe0\xa9\x8c\xe0\xa9\x8d\xe0\xa9\x91\xe0\xa8\x96\xe0\xa8\xbc\xe0\xa8\x96\xe0\xa8\x97\xe0\xa8\xbc"
+    "\xe0\xa8\x97\xe0\xa8\x9c\xe0\xa8\xbc\xe0\xa8\x9c\xe0\xa8\xab\xe0\xa8\xbc\xe0\xa8\xab\xe0\xa9\xb0"
+    "\xe0\xa9\xb1\xe0\xa9\xb5\xe0\xaa\x81\xe0\xaa\x82\xe0\xaa\xbc\xe0\xab\x81\xe0\xab\x82\xe0\xab\x83"
+    "\xe0\xab\x84\xe0\xab\x85\xe0\xab\x87\xe0\xab\x88\xe0\xab\x8d\xe0\xab\xa2\xe0\xab\xa3\xe0\xab\xba"
+    "\xe0\xab\xbb\xe0\xab\xbc\xe0\xab\xbd\xe0\xab\xbe\xe0\xab\xbf\xe0\xac\x81\xe0\xac\xbc\xe0\xac\xbf"
+    "\xe0\xad\x81\xe0\xad\x82\xe0\xad\x83\xe0\xad\x84\xe0\xad\x8d\xe0\xad\x95\xe0\xad\x96\xe0\xac\xa1"
+    "\xe0\xac\xbc\xe0\xac\xa1\xe0\xac\xa2\xe0\xac\xbc\xe0\xac\xa2\xe0\xad\xa2\xe0\xad\xa3\xe0\xae\x82"
+    "\xe0\xae\x92\xe0\xaf\x80\xe0\xaf\x8d\xe0\xb0\x80\xe0\xb0\x84\xe0\xb0\xbc\xe0\xb0\xbe\xe0\xb0\xbf"
+    "\xe0\xb1\x80\xe0\xb1\x86\xe0\xb1\x87\xe0\xb1\x88\xe0\xb1\x8a\xe0\xb1\x8b\xe0\xb1\x8c\xe0\xb1\x8d"
+    "\xe0\xb1\x95\xe0\xb1\x96\xe0\xb1\xa2\xe0\xb1\xa3\xe0\xb2\x81\xe0\xb2\xbc\xe0\xb2\xbf\xe0\xb3\x86"
+    "\xe0\xb3\x8c\xe0\xb3\x8d\xe0\xb3\xa2\xe0\xb3\xa3\xe0\xb4\x80\xe0\xb4\x81\xe0\xb4\xbb\xe0\xb4\xbc"
+    "\xe0\xb5\x81\xe0\xb5\x82\xe0\xb5\x83\xe0\xb5\x84\xe0\xb5\x8d\xe0\xb5\xa2\xe0\xb5\xa3\xe0\xb6\x81"
+    "\xe0\xb7\x8a\xe0\xb7\x92\xe0\xb7\x93\xe0\xb7\x94\xe0\xb7\x96\xe0\xb8\xb1\xe0\xb9\x8d\xe0\xb8\xb2"
+    "\xe0\xb8\xb2\xe0\xb8\xb4\xe0\xb8\xb5\xe0\xb8\xb6\xe0\xb8\xb7\xe0\xb8\xb8\xe0\xb8\xb9\xe0\xb8\xba"
+    "\xe0\xb9\x87\xe0\xb9\x88\xe0\xb9\x89\xe0\xb9\x8a\xe0\xb9\x8b\xe0\xb9\x8c\xe0\xb9\x8d\xe0\xb9\x8e"
+    "\xe0\xba\xb1\xe0\xbb\x8d\xe0\xba\xb2\xe0\xba\xb2\xe0\xba\xb4\xe0\xba\xb5\xe0\xba\xb6\xe0\xba\xb7"
+    "\xe0\xba\xb8\xe0\xba\xb9\xe0\xba\xba\xe0\xba\xbb\xe0\xba\xbc\xe0\xbb\x88\xe0\xbb\x89\xe0\xbb\x8a"
+    "\xe0\xbb\x8b\xe0\xbb\x8c\xe0\xbb\x8d\xe0\xba\xab\xe0\xba\x99\xe0\xba\xab\xe0\xba\xa1\xe0\xbc\x8b"
+    "\xe0\xbc\x98\xe0\xbc\x99\xe0\xbc\xb5\xe0\xbc\xb7\xe0\xbc\xb9\xe0\xbd\x82\xe0\xbe\xb7\xe0\xbd\x82"
+    "\xe0\xbd\x8c\xe0\xbe\xb7\xe0\xbd\x8c\xe0\xbd\x91\xe0\xbe\xb7\xe0\xbd\x91\xe0\xbd\x96\xe0\xbe\xb7"
+    "\xe0\xbd\x96\xe0\xbd\x9b\xe0\xbe\xb7\xe0\xbd\x9b\xe0\xbd\x80\xe0\xbe\xb5\xe0\xbd\x80\xe0\xbd\xb1"
+    "\xe0\xbd\xb2\xe0\xbd\xb1\xe0\xbd\xb2\xe0\xbd\xb4\xe0\xbd\xb1\xe0\xbd\xb4\xe0\xbe\xb2\xe0\xbe\x80"
+    "\xe0\xbe\xb2\xe0\xbd\xb1\xe0\xbe\x80\xe0\xbe\xb3\xe0\xbe\x80\xe0\xbe\xb3\xe0\xbd\xb1\xe0\xbe\x80"
+    "\xe0\xbd\xba\xe0\xbd\xbb\xe0\xbd\xbc\xe0\xbd\xbd\xe0\xbd\xbe\xe0\xbe\x80\xe0\xbd\xb1\xe0\xbe\x80"
+    "\xe0\xbe\x82\xe0\xbe\x83\xe0\xbe\x84\xe0\xbe\x86\xe0\xbe\x87\xe0\xbe\x8d\xe0\xbe\x8e\xe0\xbe\x8f"
+    "\xe0\xbe\x90\xe0\xbe\x91\xe0\xbe\x92\xe0\xbe\x92\xe0\xbe\xb7\xe0\xbe\x94\xe0\xbe\x95\xe0\xbe\x96"
+    "\xe0\xbe\x97\xe0\xbe\x99\xe0\xbe\x9a\xe0\xbe\x9b\xe0\xbe\x9c\xe0\xbe\x9c\xe0\xbe\xb7\xe0\xbe\x9e"
+    "\xe0\xbe\x9f\xe0\xbe\xa0\xe0\xbe\xa1\xe0\xbe\xa1\xe0\xbe\xb7\xe0\xbe\xa3\xe0\xbe\xa4\xe0\xbe\xa5"
+    "\xe0\xbe\xa6\xe0\xbe\xa6\xe0\xbe\xb7\xe0\xbe\xa8\xe0\xbe\xa9\xe0\xbe\xaa\xe0\xbe\xab\xe0\xbe\xab"
+    "\xe0\xbe\xb7\xe0\xbe\xad\xe0\xbe\xae\xe0\xbe\xaf\xe0\xbe\xb0\xe0\xbe\xb1\xe0\xbe\xb2\xe0\xbe\xb3"
+    "\xe0\xbe\xb4\xe0\xbe\xb5\xe0\xbe\xb6\xe0\xbe\xb7\xe0\xbe\xb8\xe0\xbe\x90\xe0\xbe\xb5\xe0\xbe\xba"
+    "\xe0\xbe\xbb\xe0\xbe\xbc\xe0\xbf\x86\xe1\x80\xa5\xe1\x80\xad\xe1\x80\xae\xe1\x80\xaf\xe1\x80\xb0"
+    "\xe1\x80\xb2\xe1\x80\xb3\xe1\x80\xb4\xe1\x80\xb5\xe1\x80\xb6\xe1\x80\xb7\xe1\x80\xb9\xe1\x80\xba"
+    "\xe1\x80\xbd\xe1\x80\xbe\xe1\x81\x98\xe1\x81\x99\xe1\x81\x9e\xe1\x81\x9f\xe1\x81\xa0\xe1\x81\xb1"
+    "\xe1\x81\xb2\xe1\x81\xb3\xe1\x81\xb4\xe1\x82\x82\xe1\x82\x85\xe1\x82\x86\xe1\x82\x8d\xe1\x82\x9d"
+    "\xe2\xb4\x80\xe2\xb4\x81\xe2\xb4\x82\xe2\xb4\x83\xe2\xb4\x84\xe2\xb4\x85\xe2\xb4\x86\xe2\xb4\x87"
+    "\xe2\xb4\x88\xe2\xb4\x89\xe2\xb4\x8a\xe2\xb4\x8b\xe2\xb4\x8c\xe2\xb4\x8d\xe2\xb4\x8e\xe2\xb4\x8f"
+    "\xe2\xb4\x90\xe2\xb4\x91\xe2\xb4\x92\xe2\xb4\x93\xe2\xb4\x94\xe2\xb4\x95\xe2\xb4\x96\xe2\xb4\x97"
+    "\xe2\xb4\x98\xe2\xb4\x99\xe2\xb4\x9a\xe2\xb4\x9b\xe2\xb4\x9c\xe2\xb4\x9d\xe2\xb4\x9e\xe2\xb4\x9f"
+    "\xe2\xb4\xa0\xe2\xb4\xa1\xe2\xb4\xa2\xe2\xb4\xa3\xe2\xb4\xa4\xe2\xb4\xa5\xe2\xb4\xa7\xe2\xb4\xad"
+    "\xe1\x83\x9c\xe1\x8d\x9d\xe1\x8d\x9e\xe1\x8d\x9f\xe1\x8f\xb0\xe1\x8f\xb1\xe1\x8f\xb2\xe1\x8f\xb3"
+    "\xe1\x8f\xb4\xe1\x8f\xb5\xe1\x9c\x92\xe1\x9c\x93\xe1\x9c\x94\xe1\x9c\xb2\xe1\x9c\xb3\xe1\x9d\x92"
+    "\xe1\x9d\x93\xe1\x9d\xb2\xe1\x9d\xb3\xe1\x9e\xb7\xe1\x9e\xb8\xe1\x9e\xb9\xe1\x9e\xba\xe1\x9e\xbb"
+    "\xe1\x9e\xbc\xe1\x9e\xbd\xe1\x9f\x86\xe1\x9f\x89\xe1\x9f\x8a\xe1\x9f\x8b\xe1\x9f\x8c\xe1\x9f\x8d"
+    "\xe1\x9f\x8e\xe1\x9f\x8f\xe1\x9f\x90\xe1\x9f\x91\xe1\x9f\x92\xe1\x9f\x93\xe1\x9f\x9d\xe1\xa2\x85"
+    "\xe1\xa2\x86\xe1\xa2\xa9\xe1\xa4\xa0\xe1\xa4\xa1\xe1\xa4\xa2\xe1\xa4\xa7\xe1\xa4\xa8\xe1\xa4\xb2"
+    "\xe1\xa4\xb9\xe1\xa4\xba\xe1\xa4\xbb\xe1\xa8\x97\xe1\xa8\x98\xe1\xa8\x9b\xe1\xa9\x96\xe1\xa9\x98"
+    "\xe1\xa9\x99\xe1\xa9\x9a\xe1\xa9\x9b\xe1\xa9\x9c\xe1\xa9\x9d\xe1\xa9\x9e\xe1\xa9\xa0\xe1\xa9\xa2"
+    "\xe1\xa9\xa5\xe1\xa9\xa6\xe1\xa9\xa7\xe1\xa9\xa8\xe1\xa9\xa9\xe1\xa9\xaa\xe1\xa9\xab\xe1\xa9\xac"
+    "\xe1\xa9\xb3\xe1\xa9\xb4\xe1\xa9\xb5\xe1\xa9\xb6\xe1\xa9\xb7\xe1\xa9\xb8\xe1\xa9\xb9\xe1\xa9\xba"
+    "\xe1\xa9\xbb\xe1\xa9\xbc\xe1\xa9\xbf\xe1\xaa\xb0\xe1\xaa\xb1\xe1\xaa\xb2\xe1\xaa\xb3\xe1\xaa\xb4"
+    "\xe1\xaa\xb5\xe1\xaa\xb6\xe1\xaa\xb7\xe1\xaa\xb8\xe1\xaa\xb9\xe1\xaa\xba\xe1\xaa\xbb\xe1\xaa\xbc"
+    "\xe1\xaa\xbd\xe1\xaa\xbe\xe1\xaa\xbf\xe1\xab\x80\xe1\xab\x81\xe1\xab\x82\xe1\xab\x83\xe1\xab\x84"
+    "\xe1\xab\x85\xe1\xab\x86\xe1\xab\x87\xe1\xab\x88\xe1\xab\x89\xe1\xab\x8a\xe1\xab\x8b\xe1\xab\x8c"
+    "\xe1\xab\x8d\xe1\xab\x8e\xe1\xac\x80\xe1\xac\x81\xe1\xac\x82\xe1\xac\x83\xe1\xac\x85\xe1\xac\x87"
+    "\xe1\xac\x89\xe1\xac\x8b\xe1\xac\x8d\xe1\xac\x91\xe1\xac\xb4\xe1\xac\xb6\xe1\xac\xb7\xe1\xac\xb8"
+    "\xe1\xac\xb9\xe1\xac\xba\xe1\xac\xbc\xe1\xad\x82\xe1\xad\xab\xe1\xad\xac\xe1\xad\xad\xe1\xad\xae"
+    "\xe1\xad\xaf\xe1\xad\xb0\xe1\xad\xb1\xe1\xad\xb2\xe1\xad\xb3\xe1\xae\x80\xe1\xae\x81\xe1\xae\xa2"
+    "\xe1\xae\xa3\xe1\xae\xa4\xe1\xae\xa5\xe1\xae\xa8\xe1\xae\xa9\xe1\xae\xab\xe1\xae\xac\xe1\xae\xad"
+    "\xe1\xaf\xa6\xe1\xaf\xa8\xe1\xaf\xa9\xe1\xaf\xad\xe1\xaf\xaf\xe1\xaf\xb0\xe1\xaf\xb1\xe1\xb0\xac"
+    "\xe1\xb0\xad\xe1\xb0\xae\xe1\xb0\xaf\xe1\xb0\xb0\xe1\xb0\xb1\xe1\xb0\xb2\xe1\xb0\xb3\xe1\xb0\xb6"
+    "\xe1\xb0\xb7\xea\x99\x8b\xe1\x83\x90\xe1\x83\x91\xe1\x83\x92\xe1\x83\x93\xe1\x83\x94\xe1\x83\x95"
+    "\xe1\x83\x96\xe1\x83\x97\xe1\x83\x98\xe1\x83\x99\xe1\x83\x9a\xe1\x83\x9b\xe1\x83\x9d\xe1\x83\x9e"
+    "\xe1\x83\x9f\xe1\x83\xa0\xe1\x83\xa1\xe1\x83\xa2\xe1\x83\xa3\xe1\x83\xa4\xe1\x83\xa5\xe1\x83\xa6"
+    "\xe1\x83\xa7\xe1\x83\xa8\xe1\x83\xa9\xe1\x83\xaa\xe1\x83\xab\xe1\x83\xac\xe1\x83\xad\xe1\x83\xae"
+    "\xe1\x83\xaf\xe1\x83\xb0\xe1\x83\xb1\xe1\x83\xb2\xe1\x83\xb3\xe1\x83\xb4\xe1\x83\xb5\xe1\x83\xb6"
+    "\xe1\x83\xb7\xe1\x83\xb8\xe1\x83\xb9\xe1\x83\xba\xe1\x83\xbd\xe1\x83\xbe\xe1\x83\xbf\xe1\xb3\x90"
+    "\xe1\xb3\x91\xe1\xb3\x92\xe1\xb3\x94\xe1\xb3\x95\xe1\xb3\x96\xe1\xb3\x97\xe1\xb3\x98\xe1\xb3\x99"
+    "\xe1\xb3\x9a\xe1\xb3\x9b\xe1\xb3\x9c\xe1\xb3\x9d\xe1\xb3\x9e\xe1\xb3\x9f\xe1\xb3\xa0\xe1\xb3\xa2"
+    "\xe1\xb3\xa3\xe1\xb3\xa4\xe1\xb3\xa5\xe1\xb3\xa6\xe1\xb3\xa7\xe1\xb3\xa8\xe1\xb3\xad\xe1\xb3\xb4"
+    "\xe1\xb3\xb8\xe1\xb3\xb9\xc9\x90\xc9\x91\xe1\xb4\x82\xc9\x9c\xe1\xb4\x96\xe1\xb4\x97\xe1\xb4\x9d"
+    "\xe1\xb4\xa5\xc9\x92\xc9\x95\xc9\x9f\xc9\xa1\xc9\xa5\xc9\xaa\xe1\xb5\xbb\xca\x9d\xc9\xad\xe1\xb6"
+    "\x85\xca\x9f\xc9\xb1\xc9\xb0\xc9\xb3\xc9\xb4\xc9\xb8\xca\x82\xc6\xab\xe1\xb4\x9c\xca\x90\xca\x91"
+    "\xe1\xb7\x80\xe1\xb7\x81\xe1\xb7\x82\xe1\xb7\x83\xe1\xb7\x84\xe1\xb7\x85\xe1\xb7\x86\xe1\xb7\x87"
+    "\xe1\xb7\x88\xe1\xb7\x89\xe1\xb7\x8a\xe1\xb7\x8b\xe1\xb7\x8c\xe1\xb7\x8d\xe1\xb7\x8e\xe1\xb7\x8f"
+    "\xe1\xb7\x90\xe1\xb7\x91\xe1\xb7\x92\xe1\xb7\x93\xe1\xb7\x94\xe1\xb7\x95\xe1\xb7\x96\xe1\xb7\x97"
+    "\xe1\xb7\x98\xe1\xb7\x99\xe1\xb7\x9a\xe1\xb7\x9b\xe1\xb7\x9c\xe1\xb7\x9d\xe1\xb7\x9e\xe1\xb7\x9f"
+    "\xe1\xb7\xa0\xe1\xb7\xa1\xe1\xb7\xa2\xe1\xb7\xa3\xe1\xb7\xa4\xe1\xb7\xa5\xe1\xb7\xa6\xe1\xb7\xa7"
+    "\xe1\xb7\xa8\xe1\xb7\xa9\xe1\xb7\xaa\xe1\xb7\xab\xe1\xb7\xac\xe1\xb7\xad\xe1\xb7\xae\xe1\xb7\xaf"
+    "\xe1\xb7\xb0\xe1\xb7\xb1\xe1\xb7\xb2\xe1\xb7\xb3\xe1\xb7\xb4\xe1\xb7\xb5\xe1\xb7\xb6\xe1\xb7\xb7"
+    "\xe1\xb7\xb8\xe1\xb7\xb9\xe1\xb7\xba\xe1\xb7\xbb\xe1\xb7\xbc\xe1\xb7\xbd\xe1\xb7\xbe\xe1\xb7\xbf"
+    "\xe1\xb8\x81\xe1\xb8\x83\xe1\xb8\x85\xe1\xb8\x87\xe1\xb8\x89\xe1\xb8\x8b\xe1\xb8\x8d\xe1\xb8\x8f"
+    "\xe1\xb8\x91\xe1\xb8\x93\xe1\xb8\x95\xe1\xb8\x97\xe1\xb8\x99\xe1\xb8\x9b\xe1\xb8\x9d\xe1\xb8\x9f"
+    "\xe1\xb8\xa1\xe1\xb8\xa3\xe1\xb8\xa5\xe1\xb8\xa7\xe1\xb8\xa9\xe1\xb8\xab\xe1\xb8\xad\xe1\xb8\xaf"
+    "\xe1\xb8\xb1\xe1\xb8\xb3\xe1\xb8\xb5\xe1\xb8\xb7\xe1\xb8\xb9\xe1\xb8\xbb\xe1\xb8\xbd\xe1\xb8\xbf"
+    "\xe1\xb9\x81\xe1\xb9\x83\xe1\xb9\x85\xe1\xb9\x87\xe1\xb9\x89\xe1\xb9\x8b\xe1\xb9\x8d\xe1\xb9\x8f"
+    "\xe1\xb9\x91\xe1\xb9\x93\xe1\xb9\x95\xe1\xb9\x97\xe1\xb9\x99\xe1\xb9\x9b\xe1\xb9\x9d\xe1\xb9\x9f"
+    "\xe1\xb9\xa1\xe1\xb9\xa3\xe1\xb9\xa5\xe1\xb9\xa7\xe1\xb9\xa9\xe1\xb9\xab\xe1\xb9\xad\xe1\xb9\xaf"
+    "\xe1\xb9\xb1\xe1\xb9\xb3\xe1\xb9\xb5\xe1\xb9\xb7\xe1\xb9\xb9\xe1\xb9\xbb\xe1\xb9\xbd\xe1\xb9\xbf"
+    "\xe1\xba\x81\xe1\xba\x83\xe1\xba\x85\xe1\xba\x87\xe1\xba\x89\xe1\xba\x8b\xe1\xba\x8d\xe1\xba\x8f"
+    "\xe1\xba\x91\xe1\xba\x93\xe1\xba\x95\x61\xca\xbe\xe1\xba\xa1\xe1\xba\xa3\xe1\xba\xa5\xe1\xba\xa7"
+    "\xe1\xba\xa9\xe1\xba\xab\xe1\xba\xad\xe1\xba\xaf\xe1\xba\xb1\xe1\xba\xb3\xe1\xba\xb5\xe1\xba\xb7"
+    "\xe1\xba\xb9\xe1\xba\xbb\xe1\xba\xbd\xe1\xba\xbf\xe1\xbb\x81\xe1\xbb\x83\xe1\xbb\x85\xe1\xbb\x87"
+    "\xe1\xbb\x89\xe1\xbb\x8b\xe1\xbb\x8d\xe1\xbb\x8f\xe1\xbb\x91\xe1\xbb\x93\xe1\xbb\x95\xe1\xbb\x97"
+    "\xe1\xbb\x99\xe1\xbb\x9b\xe1\xbb\x9d\xe1\xbb\x9f\xe1\xbb\xa1\xe1\xbb\xa3\xe1\xbb\xa5\xe1\xbb\xa7"
+    "\xe1\xbb\xa9\xe1\xbb\xab\xe1\xbb\xad\xe1\xbb\xaf\xe1\xbb\xb1\xe1\xbb\xb3\xe1\xbb\xb5\xe1\xbb\xb7"
+    "\xe1\xbb\xb9\xe1\xbb\xbb\xe1\xbb\xbd\xe1\xbb\xbf\xe1\xbc\x80\xe1\xbc\x81\xe1\xbc\x82\xe1\xbc\x83"
+    "\xe1\xbc\x84\xe1\xbc\x85\xe1\xbc\x86\xe1\xbc\x87\xe1\xbc\x90\xe1\xbc\x91\xe1\xbc\x92\xe1\xbc\x93"
+    "\xe1\xbc\x94\xe1\xbc\x95\xe1\xbc\xa0\xe1\xbc\xa1\xe1\xbc\xa2\xe1\xbc\xa3\xe1\xbc\xa4\xe1\xbc\xa5"
+    "\xe1\xbc\xa6\xe1\xbc\xa7\xe1\xbc\xb0\xe1\xbc\xb1\xe1\xbc\xb2\xe1\xbc\xb3\xe1\xbc\xb4\xe1\xbc\xb5"
+    "\xe1\xbc\xb6\xe1\xbc\xb7\xe1\xbd\x80\xe1\xbd\x81\xe1\xbd\x82\xe1\xbd\x83\xe1\xbd\x84\xe1\xbd\x85"
+    "\xe1\xbd\x91\xe1\xbd\x93\xe1\xbd\x95\xe1\xbd\x97\xe1\xbd\xa0\xe1\xbd\xa1\xe1\xbd\xa2\xe1\xbd\xa3"
+    "\xe1\xbd\xa4\xe1\xbd\xa5\xe1\xbd\xa6\xe1\xbd\xa7\xe1\xbc\x80\xce\xb9\x61\x69\xe1\xbc\x81\xce\xb9"
+    "\xe1\xbc\x82\xce\xb9\xe1\xbc\x83\xce\xb9\xe1\xbc\x84\xce\xb9\xe1\xbc\x85\xce\xb9\xe1\xbc\x86\xce"
+    "\xb9\xe1\xbc\x87\xce\xb9\xe1\xbc\xa0\xce\xb9\xce\xb7\x69\xe1\xbc\xa1\xce\xb9\xe1\xbc\xa2\xce\xb9"
+    "\xe1\xbc\xa3\xce\xb9\xe1\xbc\xa4\xce\xb9\xe1\xbc\xa5\xce\xb9\xe1\xbc\xa6\xce\xb9\xe1\xbc\xa7\xce"
+    "\xb9\xe1\xbd\xa0\xce\xb9\x77\x69\xe1\xbd\xa1\xce\xb9\xe1\xbd\xa2\xce\xb9\xe1\xbd\xa3\xce\xb9\xe1"
+    "\xbd\xa4\xce\xb9\xe1\xbd\xa5\xce\xb9\xe1\xbd\xa6\xce\xb9\xe1\xbd\xa7\xce\xb9\xe1\xbd\xb0\xce\xb9"
+    "\xce\xb1\xce\xb9\xce\xac\xce\xb9\xe1\xbe\xb6\xce\xb9\xe1\xbe\xb0\xe1\xbe\xb1\xe1\xbd\xb0\x20\xcc"
+    "\x93\x20\xcd\x82\x20\xcc\x88\xcd\x82\xe1\xbd\xb4\xce\xb9\xce\xb7\xce\xb9\xce\xae\xce\xb9\xe1\xbf"
+    "\x86\xce\xb9\xe1\xbd\xb2\xe1\xbd\xb4\x20\xcc\x93\xcc\x80\x20\xcc\x93\xcc\x81\x20\xcc\x93\xcd\x82"
+    "\xce\x90\xe1\xbf\x90\xe1\xbf\x91\xe1\xbd\xb6\x20\xcc\x94\xcc\x80\x20\xcc\x94\xcc\x81\x20\xcc\x94"
+    "\xcd\x82\xce\xb0\xe1\xbf\xa0\xe1\xbf\xa1\xe1\xbd\xba\xe1\xbf\xa5\x20\xcc\x88\xcc\x80\x60\xe1\xbd"
+    "\xbc\xce\xb9\xcf\x89\xce\xb9\xcf\x8e\xce\xb9\xe1\xbf\xb6\xce\xb9\xe1\xbd\xb8\xe1\xbd\xbc\x20\xcc"
+    "\x94\xe2\x80\x90\x20\xcc\xb3\x2e\x2e\x2e\x2e\x2e\x2e\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2\x80"
+    "\xb2\xe2\x80\xb2\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\xe2\x80\xb5\x21\x21\x20\xcc\x85"
+    "\x3f\x3f\x3f\x21\x21\x3f\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\xe2\x80\xb2\x30\x34\x35\x36\x37\x38"
+    "\x39\x2b\xe2\x88\x92\x3d\x28\x29\x72\x73\xe2\x83\x90\xe2\x83\x91\xe2\x83\x92\xe2\x83\x93\xe2\x83"
+    "\x94\xe2\x83\x95\xe2\x83\x96\xe2\x83\x97\xe2\x83\x98\xe2\x83\x99\xe2\x83\x9a\xe2\x83\x9b\xe2\x83"
+    "\x9c\xe2\x83\x9d\xe2\x83\x9e\xe2\x83\x9f\xe2\x83\xa0\xe2\x83\xa1\xe2\x83\xa2\xe2\x83\xa3\xe2\x83"
+    "\xa4\xe2\x83\xa5\xe2\x83\xa6\xe2\x83\xa7\xe2\x83\xa8\xe2\x83\xa9\xe2\x83\xaa\xe2\x83\xab\xe2\x83"
+    "\xac\xe2\x83\xad\xe2\x83\xae\xe2\x83\xaf\xe2\x83\xb0\x61\x2f\x63\x61\x2f\x73\xc2\xb0\x63\x63\x2f"
+    "\x6f\x63\x2f\x75\xc2\xb0\x66\x6e\x6f\x73\x6d\x74\x65\x6c\x74\x6d\xe2\x85\x8e\xd7\x90\xd7\x91\xd7"
+    "\x92\xd7\x93\x66\x61\x78\xe2\x88\x91\x31\xe2\x81\x84\x37\x6c\xe2\x81\x84\x37\x31\xe2\x81\x84\x39"
+    "\x6c\xe2\x81\x84\x39\x31\xe2\x81\x84\x31\x30\x6c\xe2\x81\x84\x6c\x6f\x31\xe2\x81\x84\x33\x6c\xe2"
+    "\x81\x84\x33\x32\xe2\x81\x84\x33\x31\xe2\x81\x84\x35\x6c\xe2\x81\x84\x35\x32\xe2\x81\x84\x35\x33"
+    "\xe2\x81\x84\x35\x34\xe2\x81\x84\x35\x31\xe2\x81\x84\x36\x6c\xe2\x81\x84\x36\x35\xe2\x81\x84\x36"
+    "\x31\xe2\x81\x84\x38\x6c\xe2\x81\x84\x38\x33\xe2\x81\x84\x38\x35\xe2\x81\x84\x38\x37\xe2\x81\x84"
+    "\x38\x31\xe2\x81\x84\x6c\xe2\x81\x84\x69\x69\x69\x69\x69\x69\x76\x76\x69\x76\x69\x69\x76\x69\x69"
+    "\x69\x69\x78\x78\x69\x78\x69\x69\xe2\x86\x84\x30\xe2\x81\x84\x33\x6f\xe2\x81\x84\x33\xe2\x86\x90"
+    "\xe2\x86\x92\xe2\x86\x94\xe2\x87\x90\xe2\x87\x94\xe2\x87\x92\xe2\x88\x83\xe2\x88\x88\xe2\x88\x8b"
+    "\xe2\x88\xa3\xe2\x88\xa5\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xae"
+    "\xe2\x88\xae\xe2\x88\xae\xe2\x88\xae\xe2\x88\xae\xe2\x88\xbc\xe2\x89\x83\xe2\x89\x85\xe2\x89\x88"
+    "\xe2\x89\xa1\xe2\x89\x8d\x3c\x3e\xe2\x89\xa4\xe2\x89\xa5\xe2\x89\xb2\xe2\x89\xb3\xe2\x89\xb6\xe2"
+    "\x89\xb7\xe2\x89\xba\xe2\x89\xbb\xe2\x8a\x82\xe2\x8a\x83\xe2\x8a\x86\xe2\x8a\x87\xe2\x8a\xa2\xe2"
+    "\x8a\xa8\xe2\x8a\xa9\xe2\x8a\xab\xe2\x89\xbc\xe2\x89\xbd\xe2\x8a\x91\xe2\x8a\x92\xe2\x8a\xb2\xe2"
+    "\x8a\xb3\xe2\x8a\xb4\xe2\x8a\xb5\xe3\x80\x88\xe3\x80\x89\x31\x30\x6c\x6f\x31\x31\x6c\x6c\x31\x32"
+    "\x6c\x32\x31\x33\x6c\x33\x31\x34\x6c\x34\x31\x35\x6c\x35\x31\x36\x6c\x36\x31\x37\x6c\x37\x31\x38"
+    "\x6c\x38\x31\x39\x6c\x39\x32\x30\x32\x6f\x28\x31\x29\x28\x6c\x29\x28\x32\x29\x28\x33\x29\x28\x34"
+    "\x29\x28\x35\x29\x28\x36\x29\x28\x37\x29\x28\x38\x29\x28\x39\x29\x28\x31\x30\x29\x28\x6c\x6f\x29"
+    "\x28\x31\x31\x29\x28\x6c\x6c\x29\x28\x31\x32\x29\x28\x6c\x32\x29\x28\x31\x33\x29\x28\x6c\x33\x29"
+    "\x28\x31\x34\x29\x28\x6c\x34\x29\x28\x31\x35\x29\x28\x6c\x35\x29\x28\x31\x36\x29\x28\x6c\x36\x29"
+    "\x28\x31\x37\x29\x28\x6c\x37\x29\x28\x31\x38\x29\x28\x6c\x38\x29\x28\x31\x39\x29\x28\x6c\x39\x29"
+    "\x28\x32\x30\x29\x28\x32\x6f\x29\x31\x2e\x6c\x2e\x32\x2e\x33\x2e\x34\x2e\x35\x2e\x36\x2e\x37\x2e"
+    "\x38\x2e\x39\x2e\x31\x30\x2e\x6c\x6f\x2e\x31\x31\x2e\x6c\x6c\x2e\x31\x32\x2e\x6c\x32\x2e\x31\x33"
+    "\x2e\x6c\x33\x2e\x31\x34\x2e\x6c\x34\x2e\x31\x35\x2e\x6c\x35\x2e\x31\x36\x2e\x6c\x36\x2e\x31\x37"
+    "\x2e\x6c\x37\x2e\x31\x38\x2e\x6c\x38\x2e\x31\x39\x2e\x6c\x39\x2e\x32\x30\x2e\x32\x6f\x2e\x28\x61"
+    "\x29\x28\x62\x29\x28\x63\x29\x28\x64\x29\x28\x65\x29\x28\x66\x29\x28\x67\x29\x28\x68\x29\x28\x69"
+    "\x29\x28\x6a\x29\x28\x6b\x29\x28\x6d\x29\x28\x6e\x29\x28\x6f\x29\x28\x70\x29\x28\x71\x29\x28\x72"
+    "\x29\x28\x73\x29\x28\x74\x29\x28\x75\x29\x28\x76\x29\x28\x77\x29\x28\x78\x29\x28\x79\x29\x28\x7a"
+    "\x29\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\xe2\x88\xab\x3a\x3a\x3d\x3d\x3d\x3d\x3d\x3d\xe2\xab\x9d"
+    "\xcc\xb8\xe2\xab\x9d\xe2\xb0\xb0\xe2\xb0\xb1\xe2\xb0\xb2\xe2\xb0\xb3\xe2\xb0\xb4\xe2\xb0\xb5\xe2"
+    "\xb0\xb6\xe2\xb0\xb7\xe2\xb0\xb8\xe2\xb0\xb9\xe2\xb0\xba\xe2\xb0\xbb\xe2\xb0\xbc\xe2\xb0\xbd\xe2"
+    "\xb0\xbe\xe2\xb0\xbf\xe2\xb1\x80\xe2\xb1\x81\xe2\xb1\x82\xe2\xb1\x83\xe2\xb1\x84\xe2\xb1\x85\xe2"
+    "\xb1\x86\xe2\xb1\x87\xe2\xb1\x88\xe2\xb1\x89\xe2\xb1\x8a\xe2\xb1\x8b\xe2\xb1\x8c\xe2\xb1\x8d\xe2"
+    "\xb1\x8e\xe2\xb1\x8f\xe2\xb1\x90\xe2\xb1\x91\xe2\xb1\x92\xe2\xb1\x93\xe2\xb1\x94\xe2\xb1\x95\xe2"
+    "\xb1\x96\xe2\xb1\x97\xe2\xb1\x98\xe2\xb1\x99\xe2\xb1\x9a\xe2\xb1\x9b\xe2\xb1\x9c\xe2\xb1\x9d\xe2"
+    "\xb1\x9e\xe2\xb1\x9f\xe2\xb1\xa1\xc9\xab\xe1\xb5\xbd\xc9\xbd\xe2\xb1\xa8\xe2\xb1\xaa\xe2\xb1\xac"
+    "\xe2\xb1\xb3\xe2\xb1\xb6\xc8\xbf\xc9\x80\xe2\xb2\x81\xe2\xb2\x83\xe2\xb2\x85\xe2\xb2\x87\xe2\xb2"
+    "\x89\xe2\xb2\x8b\xe2\xb2\x8d\xe2\xb2\x8f\xe2\xb2\x91\xe2\xb2\x93\xe2\xb2\x95\xe2\xb2\x97\xe2\xb2"
+    "\x99\xe2\xb2\x9b\xe2\xb2\x9d\xe2\xb2\x9f\xe2\xb2\xa1\xe2\xb2\xa3\xe2\xb2\xa5\xe2\xb2\xa7\xe2\xb2"
+    "\xa9\xe2\xb2\xab\xe2\xb2\xad\xe2\xb2\xaf\xe2\xb2\xb1\xe2\xb2\xb3\xe2\xb2\xb5\xe2\xb2\xb7\xe2\xb2"
+    "\xb9\xe2\xb2\xbb\xe2\xb2\xbd\xe2\xb2\xbf\xe2\xb3\x81\xe2\xb3\x83\xe2\xb3\x85\xe2\xb3\x87\xe2\xb3"
+    "\x89\xe2\xb3\x8b\xe2\xb3\x8d\xe2\xb3\x8f\xe2\xb3\x91\xe2\xb3\x93\xe2\xb3\x95\xe2\xb3\x97\xe2\xb3"
+    "\x99\xe2\xb3\x9b\xe2\xb3\x9d\xe2\xb3\x9f\xe2\xb3\xa1\xe2\xb3\xa3\xe2\xb3\xac\xe2\xb3\xae\xe2\xb3"
+    "\xaf\xe2\xb3\xb0\xe2\xb3\xb1\xe2\xb3\xb3\xe2\xb5\xa1\xe2\xb5\xbf\xe2\xb7\xa0\xe2\xb7\xa1\xe2\xb7"
+    "\xa2\xe2\xb7\xa3\xe2\xb7\xa4\xe2\xb7\xa5\xe2\xb7\xa6\xe2\xb7\xa7\xe2\xb7\xa8\xe2\xb7\xa9\xe2\xb7"
+    "\xaa\xe2\xb7\xab\xe2\xb7\xac\xe2\xb7\xad\xe2\xb7\xae\xe2\xb7\xaf\xe2\xb7\xb0\xe2\xb7\xb1\xe2\xb7"
+    "\xb2\xe2\xb7\xb3\xe2\xb7\xb4\xe2\xb7\xb5\xe2\xb7\xb6\xe2\xb7\xb7\xe2\xb7\xb8\xe2\xb7\xb9\xe2\xb7"
+    "\xba\xe2\xb7\xbb\xe2\xb7\xbc\xe2\xb7\xbd\xe2\xb7\xbe\xe2\xb7\xbf\xe6\xaf\x8d\xe9\xbe\x9f\xe4\xb8"
+    "\x80\xe4\xb8\xa8\xe4\xb8\xb6\xe4\xb8\xbf\xe4\xb9\x99\xe4\xba\x85\xe4\xba\x8c\xe4\xba\xa0\xe4\xba"
+    "\xba\xe5\x84\xbf\xe5\x85\xa5\xe5\x85\xab\xe5\x86\x82\xe5\x86\x96\xe5\x86\xab\xe5\x87\xa0\xe5\x87"
+    "\xb5\xe5\x88\x80\xe5\x8a\x9b\xe5\x8b\xb9\xe5\x8c\x95\xe5\x8c\x9a\xe5\x8c\xb8\xe5\x8d\x81\xe5\x8d"
+    "\x9c\xe5\x8d\xa9\xe5\x8e\x82\xe5\x8e\xb6\xe5\x8f\x88\xe5\x8f\xa3\xe5\x9b\x97\xe5\x9c\x9f\xe5\xa3"
+    "\xab\xe5\xa4\x82\xe5\xa4\x8a\xe5\xa4\x95\xe5\xa4\xa7\xe5\xa5\xb3\xe5\xad\x90\xe5\xae\x80\xe5\xaf"
+    "\xb8\xe5\xb0\x8f\xe5\xb0\xa2\xe5\xb0\xb8\xe5\xb1\xae\xe5\xb1\xb1\xe5\xb7\x9b\xe5\xb7\xa5\xe5\xb7"
+    "\xb1\xe5\xb7\xbe\xe5\xb9\xb2\xe5\xb9\xba\xe5\xb9\xbf\xe5\xbb\xb4\xe5\xbb\xbe\xe5\xbc\x8b\xe5\xbc"
+    "\x93\xe5\xbd\x90\xe5\xbd\xa1\xe5\xbd\xb3\xe5\xbf\x83\xe6\x88\x88\xe6\x88\xb6\xe6\x89\x8b\xe6\x94"
+    "\xaf\xe6\x94\xb4\xe6\x96\x87\xe6\x96\x97\xe6\x96\xa4\xe6\x96\xb9\xe6\x97\xa0\xe6\x97\xa5\xe6\x9b"
+    "\xb0\xe6\x9c\x88\xe6\x9c\xa8\xe6\xac\xa0\xe6\xad\xa2\xe6\xad\xb9\xe6\xae\xb3\xe6\xaf\x8b\xe6\xaf"
+    "\x94\xe6\xaf\x9b\xe6\xb0\x8f\xe6\xb0\x94\xe6\xb0\xb4\xe7\x81\xab\xe7\x88\xaa\xe7\x88\xb6\xe7\x88"
+    "\xbb\xe7\x88\xbf\xe7\x89\x87\xe7\x89\x99\xe7\x89\x9b\xe7\x8a\xac\xe7\x8e\x84\xe7\x8e\x89\xe7\x93"
+    "\x9c\xe7\x93\xa6\xe7\x94\x98\xe7\x94\x9f\xe7\x94\xa8\xe7\x94\xb0\xe7\x96\x8b\xe7\x96\x92\xe7\x99"
+    "\xb6\xe7\x99\xbd\xe7\x9a\xae\xe7\x9a\xbf\xe7\x9b\xae\xe7\x9f\x9b\xe7\x9f\xa2\xe7\x9f\xb3\xe7\xa4"
+    "\xba\xe7\xa6\xb8\xe7\xa6\xbe\xe7\xa9\xb4\xe7\xab\x8b\xe7\xab\xb9\xe7\xb1\xb3\xe7\xb3\xb8\xe7\xbc"
+    "\xb6\xe7\xbd\x91\xe7\xbe\x8a\xe7\xbe\xbd\xe8\x80\x81\xe8\x80\x8c\xe8\x80\x92\xe8\x80\xb3\xe8\x81"
+    "\xbf\xe8\x82\x89\xe8\x87\xa3\xe8\x87\xaa\xe8\x87\xb3\xe8\x87\xbc\xe8\x88\x8c\xe8\x88\x9b\xe8\x88"
+    "\x9f\xe8\x89\xae\xe8\x89\xb2\xe8\x89\xb8\xe8\x99\x8d\xe8\x99\xab\xe8\xa1\x80\xe8\xa1\x8c\xe8\xa1"
+    "\xa3\xe8\xa5\xbe\xe8\xa6\x8b\xe8\xa7\x92\xe8\xa8\x80\xe8\xb0\xb7\xe8\xb1\x86\xe8\xb1\x95\xe8\xb1"
+    "\xb8\xe8\xb2\x9d\xe8\xb5\xa4\xe8\xb5\xb0\xe8\xb6\xb3\xe8\xba\xab\xe8\xbb\x8a\xe8\xbe\x9b\xe8\xbe"
+    "\xb0\xe8\xbe\xb5\xe9\x82\x91\xe9\x85\x89\xe9\x87\x86\xe9\x87\x8c\xe9\x87\x91\xe9\x95\xb7\xe9\x96"
+    "\x80\xe9\x98\x9c\xe9\x9a\xb6\xe9\x9a\xb9\xe9\x9b\xa8\xe9\x9d\x91\xe9\x9d\x9e\xe9\x9d\xa2\xe9\x9d"
+    "\xa9\xe9\x9f\x8b\xe9\x9f\xad\xe9\x9f\xb3\xe9\xa0\x81\xe9\xa2\xa8\xe9\xa3\x9b\xe9\xa3\x9f\xe9\xa6"
+    "\x96\xe9\xa6\x99\xe9\xa6\xac\xe9\xaa\xa8\xe9\xab\x98\xe9\xab\x9f\xe9\xac\xa5\xe9\xac\xaf\xe9\xac"
+    "\xb2\xe9\xac\xbc\xe9\xad\x9a\xe9\xb3\xa5\xe9\xb9\xb5\xe9\xb9\xbf\xe9\xba\xa5\xe9\xba\xbb\xe9\xbb"
+    "\x83\xe9\xbb\x8d\xe9\xbb\x91\xe9\xbb\xb9\xe9\xbb\xbd\xe9\xbc\x8e\xe9\xbc\x93\xe9\xbc\xa0\xe9\xbc"
+    "\xbb\xe9\xbd\x8a\xe9\xbd\x92\xe9\xbe\x8d\xe9\xbe\x9c\xe9\xbe\xa0\xe3\x80\xaa\xe3\x80\xab\xe3\x80"
+    "\xac\xe3\x80\xad\xe3\x80\x92\xe5\x8d\x84\xe5\x8d\x85\xe3\x81\x8b\xe3\x81\x8d\xe3\x81\x8f\xe3\x81"
+    "\x91\xe3\x81\x93\xe3\x81\x95\xe3\x81\x97\xe3\x81\x99\xe3\x81\x9b\xe3\x81\x9d\xe3\x81\x9f\xe3\x81"
+    "\xa1\xe3\x81\xa4\xe3\x81\xa6\xe3\x81\xa8\xe3\x81\xaf\xe3\x81\xb2\xe3\x81\xb5\xe3\x81\xb8\xe3\x81"
+    "\xbb\xe3\x81\x86\xe3\x82\x99\xe3\x82\x9a\x20\xe3\x82\x99\x20\xe3\x82\x9a\xe3\x82\x9d\xe3\x82\x88"
+    "\xe3\x82\x8a\xe3\x82\xab\xe3\x82\xad\xe3\x82\xaf\xe3\x82\xb1\xe3\x82\xb3\xe3\x82\xb5\xe3\x82\xb7"
+    "\xe3\x82\xb9\xe3\x82\xbb\xe3\x82\xbd\xe3\x82\xbf\xe3\x83\x81\xe3\x83\x84\xe3\x83\x86\xe3\x83\x88"
+    "\xe3\x83\x8f\xe3\x83\x92\xe3\x83\x95\xe3\x83\x98\xe3\x83\x9b\xe3\x82\xa6\xe3\x83\xaf\xe3\x83\xb0"
+    "\xe3\x83\xb1\xe3\x83\xb2\xe3\x83\xbd\xe3\x82\xb3\xe3\x83\x88\xe1\x84\x80\xe1\x84\x81\xe1\x86\xaa"
+    "\xe1\x84\x82\xe1\x86\xac\xe1\x86\xad\xe1\x84\x83\xe1\x84\x84\xe1\x84\x85\xe1\x86\xb0\xe1\x86\xb1"
+    "\xe1\x86\xb2\xe1\x86\xb3\xe1\x86\xb4\xe1\x86\xb5\xe1\x84\x9a\xe1\x84\x86\xe1\x84\x87\xe1\x84\x88"
+    "\xe1\x84\xa1\xe1\x84\x89\xe1\x84\x8a\xe1\x84\x8b\xe1\x84\x8c\xe1\x84\x8d\xe1\x84\x8e\xe1\x84\x8f"
+    "\xe1\x84\x90\xe1\x84\x91\xe1\x84\x92\xe1\x85\xa1\xe1\x85\xa2\xe1\x85\xa3\xe1\x85\xa4\xe1\x85\xa5"
+    "\xe1\x85\xa6\xe1\x85\xa7\xe1\x85\xa8\xe1\x85\xa9\xe1\x85\xaa\xe1\x85\xab\xe1\x85\xac\xe1\x85\xad"
+    "\xe1\x85\xae\xe1\x85\xaf\xe1\x85\xb0\xe1\x85\xb1\xe1\x85\xb2\xe1\x85\xb3\xe1\x85\xb4\xe1\x85\xb5"
+    "\xe1\x84\x94\xe1\x84\x95\xe1\x87\x87\xe1\x87\x88\xe1\x87\x8c\xe1\x87\x8e\xe1\x87\x93\xe1\x87\x97"
+    "\xe1\x87\x99\xe1\x84\x9c\xe1\x87\x9d\xe1\x87\x9f\xe1\x84\x9d\xe1\x84\x9e\xe1\x84\xa0\xe1\x84\xa2"
+    "\xe1\x84\xa3\xe1\x84\xa7\xe1\x84\xa9\xe1\x84\xab\xe1\x84\xac\xe1\x84\xad\xe1\x84\xae\xe1\x84\xaf"
+    "\xe1\x84\xb2\xe1\x84\xb6\xe1\x85\x80\xe1\x85\x87\xe1\x85\x8c\xe1\x87\xb1\xe1\x87\xb2\xe1\x85\x97"
+    "\xe1\x85\x98\xe1\x85\x99\xe1\x86\x84\xe1\x86\x85\xe1\x86\x88\xe1\x86\x91\xe1\x86\x92\xe1\x86\x94"
+    "\xe1\x86\x9e\xe1\x86\xa1\xe4\xb8\x89\xe5\x9b\x9b\xe4\xb8\x8a\xe4\xb8\xad\xe4\xb8\x8b\xe7\x94\xb2"
+    "\xe4\xb8\x99\xe4\xb8\x81\xe5\xa4\xa9\xe5\x9c\xb0\x28\xe1\x84\x80\x29\x28\xe1\x84\x82\x29\x28\xe1"
+    "\x84\x83\x29\x28\xe1\x84\x85\x29\x28\xe1\x84\x86\x29\x28\xe1\x84\x87\x29\x28\xe1\x84\x89\x29\x28"
+    "\xe1\x84\x8b\x29\x28\xe1\x84\x8c\x29\x28\xe1\x84\x8e\x29\x28\xe1\x84\x8f\x29\x28\xe1\x84\x90\x29"
+    "\x28\xe1\x84\x91\x29\x28\xe1\x84\x92\x29\x28\xea\xb0\x80\x29\x28\xeb\x82\x98\x29\x28\xeb\x8b\xa4"
+    "\x29\x28\xeb\x9d\xbc\x29\x28\xeb\xa7\x88\x29\x28\xeb\xb0\x94\x29\x28\xec\x82\xac\x29\x28\xec\x95"
+    "\x84\x29\x28\xec\x9e\x90\x29\x28\xec\xb0\xa8\x29\x28\xec\xb9\xb4\x29\x28\xed\x83\x80\x29\x28\xed"
+    "\x8c\x8c\x29\x28\xed\x95\x98\x29\x28\xec\xa3\xbc\x29\x28\xec\x98\xa4\xec\xa0\x84\x29\x28\xec\x98"
+    "\xa4\xed\x9b\x84\x29\x28\xe4\xb8\x80\x29\x28\xe4\xba\x8c\x29\x28\xe4\xb8\x89\x29\x28\xe5\x9b\x9b"
+    "\x29\x28\xe4\xba\x94\x29\x28\xe5\x85\xad\x29\x28\xe4\xb8\x83\x29\x28\xe5\x85\xab\x29\x28\xe4\xb9"
+    "\x9d\x29\x28\xe5\x8d\x81\x29\x28\xe6\x9c\x88\x29\x28\xe7\x81\xab\x29\x28\xe6\xb0\xb4\x29\x28\xe6"
+    "\x9c\xa8\x29\x28\xe9\x87\x91\x29\x28\xe5\x9c\x9f\x29\x28\xe6\x97\xa5\x29\x28\xe6\xa0\xaa\x29\x28"
+    "\xe6\x9c\x89\x29\x28\xe7\xa4\xbe\x29\x28\xe5\x90\x8d\x29\x28\xe7\x89\xb9\x29\x28\xe8\xb2\xa1\x29"
+    "\x28\xe7\xa5\x9d\x29\x28\xe5\x8a\xb4\x29\x28\xe4\xbb\xa3\x29\x28\xe5\x91\xbc\x29\x28\xe5\xad\xa6"
+    "\x29\x28\xe7\x9b\xa3\x29\x28\xe4\xbc\x81\x29\x28\xe8\xb3\x87\x29\x28\xe5\x8d\x94\x29\x28\xe7\xa5"
+    "\xad\x29\x28\xe4\xbc\x91\x29\x28\xe8\x87\xaa\x29\x28\xe8\x87\xb3\x29\xe5\x95\x8f\xe5\xb9\xbc\xe7"
+    "\xae\x8f\x70\x74\x65\x32\x31\x32\x6c\x32\x32\x32\x33\x32\x34\x32\x35\x32\x36\x32\x37\x32\x38\x32"
+    "\x39\x33\x30\x33\x6f\x33\x31\x33\x6c\x33\x32\x33\x33\x33\x34\x33\x35\xea\xb0\x80\xeb\x82\x98\xeb"
+    "\x8b\xa4\xeb\x9d\xbc\xeb\xa7\x88\xeb\xb0\x94\xec\x82\xac\xec\x95\x84\xec\x9e\x90\xec\xb0\xa8\xec"
+    "\xb9\xb4\xed\x83\x80\xed\x8c\x8c\xed\x95\x98\xec\xb0\xb8\xea\xb3\xa0\xec\xa3\xbc\xec\x9d\x98\xec"
+    "\x9a\xb0\xe4\xba\x94\xe5\x85\xad\xe4\xb8\x83\xe4\xb9\x9d\xe6\xa0\xaa\xe6\x9c\x89\xe7\xa4\xbe\xe5"
+    "\x90\x8d\xe7\x89\xb9\xe8\xb2\xa1\xe7\xa5\x9d\xe5\x8a\xb4\xe7\xa7\x98\xe7\x94\xb7\xe9\x81\xa9\xe5"
+    "\x84\xaa\xe5\x8d\xb0\xe6\xb3\xa8\xe9\xa0\x85\xe4\xbc\x91\xe5\x86\x99\xe6\xad\xa3\xe5\xb7\xa6\xe5"
+    "\x8f\xb3\xe5\x8c\xbb\xe5\xae\x97\xe5\xad\xa6\xe7\x9b\xa3\xe4\xbc\x81\xe8\xb3\x87\xe5\x8d\x94\xe5"
+    "\xa4\x9c\x33\x36\x33\x37\x33\x38\x33\x39\x34\x30\x34\x6f\x34\x31\x34\x6c\x34\x32\x34\x33\x34\x34"
+    "\x34\x35\x34\x36\x34\x37\x34\x38\x34\x39\x35\x30\x35\x6f\x31\xe6\x9c\x88\x6c\xe6\x9c\x88\x32\xe6"
+    "\x9c\x88\x33\xe6\x9c\x88\x34\xe6\x9c\x88\x35\xe6\x9c\x88\x36\xe6\x9c\x88\x37\xe6\x9c\x88\x38\xe6"
+    "\x9c\x88\x39\xe6\x9c\x88\x31\x30\xe6\x9c\x88\x6c\x6f\xe6\x9c\x88\x31\x31\xe6\x9c\x88\x6c\x6c\xe6"
+    "\x9c\x88\x31\x32\xe6\x9c\x88\x6c\x32\xe6\x9c\x88\x68\x67\x65\x72\x67\x65\x76\x6c\x74\x64\xe3\x82"
+    "\xa2\xe3\x82\xa4\xe3\x82\xa8\xe3\x82\xaa\xe3\x83\x8a\xe3\x83\x8b\xe3\x83\x8c\xe3\x83\x8d\xe3\x83"
+    "\x8e\xe3\x83\x9e\xe3\x83\x9f\xe3\x83\xa0\xe3\x83\xa1\xe3\x83\xa2\xe3\x83\xa4\xe3\x83\xa6\xe3\x83"
+    "\xa8\xe3\x83\xa9\xe3\x83\xaa\xe3\x83\xab\xe3\x83\xac\xe3\x83\xad\xe4\xbb\xa4\xe5\x92\x8c\xe3\x82"
+    "\xa2\xe3\x83\x91\xe3\x83\xbc\xe3\x83\x88\xe3\x82\xa2\xe3\x83\x8f\xe3\x83\xbc\xe3\x83\x88\xe3\x82"
+    "\xa2\xe3\x83\xab\xe3\x83\x95\xe3\x82\xa1\xe3\x82\xa2\xe3\x83\xb3\xe3\x83\x9a\xe3\x82\xa2\xe3\x82"
+    "\xa2\xe3\x83\xb3\xe3\x83\x98\xe3\x82\xa2\xe3\x82\xa2\xe3\x83\xbc\xe3\x83\xab\xe3\x82\xa4\xe3\x83"
+    "\x8b\xe3\x83\xb3\xe3\x82\xb0\xe3\x82\xa4\xe3\x83\x8b\xe3\x83\xb3\xe3\x82\xaf\xe3\x82\xa4\xe3\x83"
+    "\xb3\xe3\x83\x81\xe3\x82\xa6\xe3\x82\xa9\xe3\x83\xb3\xe3\x82\xa8\xe3\x82\xb9\xe3\x82\xaf\xe3\x83"
+    "\xbc\xe3\x83\x89\xe3\x82\xa8\xe3\x82\xb9\xe3\x82\xaf\xe3\x83\xbc\xe3\x83\x88\xe3\x82\xa8\xe3\x83"
+    "\xbc\xe3\x82\xab\xe3\x83\xbc\xe3\x82\xaa\xe3\x83\xb3\xe3\x82\xb9\xe3\x82\xaa\xe3\x83\xbc\xe3\x83"
+    "\xa0\xe3\x82\xab\xe3\x82\xa4\xe3\x83\xaa\xe3\x82\xab\xe3\x83\xa9\xe3\x83\x83\xe3\x83\x88\xe3\x82"
+    "\xab\xe3\x83\xad\xe3\x83\xaa\xe3\x83\xbc\xe3\x82\xac\xe3\x83\xad\xe3\x83\xb3\xe3\x82\xab\xe3\x83"
+    "\xad\xe3\x83\xb3\xe3\x82\xac\xe3\x83\xb3\xe3\x83\x9e\xe3\x82\xab\xe3\x83\xb3\xe3\x83\x9e\xe3\x82"
+    "\xae\xe3\x82\xac\xe3\x82\xad\xe3\x82\xab\xe3\x82\xae\xe3\x83\x8b\xe3\x83\xbc\xe3\x82\xad\xe3\x83"
+    "\x8b\xe3\x83\xbc\xe3\x82\xad\xe3\x83\xa5\xe3\x83\xaa\xe3\x83\xbc\xe3\x82\xae\xe3\x83\xab\xe3\x83"
+    "\x80\xe3\x83\xbc\xe3\x82\xad\xe3\x83\xab\xe3\x82\xbf\xe3\x83\xbc\xe3\x82\xad\xe3\x83\xad\xe3\x82"
+    "\xad\xe3\x83\xad\xe3\x82\xb0\xe3\x83\xa9\xe3\x83\xa0\xe3\x82\xad\xe3\x83\xad\xe3\x82\xaf\xe3\x83"
+    "\xa9\xe3\x83\xa0\xe3\x82\xad\xe3\x83\xad\xe3\x83\xa1\xe3\x83\xbc\xe3\x83\x88\xe3\x83\xab\xe3\x82"
+    "\xad\xe3\x83\xad\xe3\x83\xaf\xe3\x83\x83\xe3\x83\x88\xe3\x82\xb0\xe3\x83\xa9\xe3\x83\xa0\xe3\x82"
+    "\xaf\xe3\x83\xa9\xe3\x83\xa0\xe3\x82\xb0\xe3\x83\xa9\xe3\x83\xa0\xe3\x83\x88\xe3\x83\xb3\xe3\x82"
+    "\xaf\xe3\x83\xa9\xe3\x83\xa0\xe3\x83\x88\xe3\x83\xb3\xe3\x82\xaf\xe3\x83\xab\xe3\x82\xbc\xe3\x82"
+    "\xa4\xe3\x83\xad\xe3\x82\xaf\xe3\x83\xab\xe3\x82\xbb\xe3\x82\xa4\xe3\x83\xad\xe3\x82\xaf\xe3\x83"
+    "\xad\xe3\x83\xbc\xe3\x83\x8d\xe3\x82\xb1\xe3\x83\xbc\xe3\x82\xb9\xe3\x82\xb3\xe3\x83\xab\xe3\x83"
+    "\x8a\xe3\x82\xb3\xe3\x83\xbc\xe3\x83\x9d\xe3\x82\xb3\xe3\x83\xbc\xe3\x83\x9b\xe3\x82\xb5\xe3\x82"
+    "\xa4\xe3\x82\xaf\xe3\x83\xab\xe3\x82\xb5\xe3\x83\xb3\xe3\x83\x81\xe3\x83\xbc\xe3\x83\xa0\xe3\x82"
+    "\xb7\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xb0\xe3\x82\xb7\xe3\x83\xaa\xe3\x83\xb3\xe3\x82\xaf\xe3\x82"
+    "\xbb\xe3\x83\xb3\xe3\x83\x81\xe3\x82\xbb\xe3\x83\xb3\xe3\x83\x88\xe3\x83\x80\xe3\x83\xbc\xe3\x82"
+    "\xb9\xe3\x82\xbf\xe3\x83\xbc\xe3\x82\xb9\xe3\x83\x87\xe3\x82\xb7\xe3\x83\x86\xe3\x82\xb7\xe3\x83"
+    "\x89\xe3\x83\xab\xe3\x83\x88\xe3\x83\xab\xe3\x83\x88\xe3\x83\xb3\xe3\x83\x8a\xe3\x83\x8e\xe3\x83"
+    "\x8e\xe3\x83\x83\xe3\x83\x88\xe3\x83\x8f\xe3\x82\xa4\xe3\x83\x84\xe3\x83\x91\xe3\x83\xbc\xe3\x82"
+    "\xbb\xe3\x83\xb3\xe3\x83\x88\xe3\x83\x8f\xe3\x83\xbc\xe3\x82\xbb\xe3\x83\xb3\xe3\x83\x88\xe3\x83"
+    "\x91\xe3\x83\xbc\xe3\x83\x84\xe3\x83\x8f\xe3\x83\xbc\xe3\x83\x84\xe3\x83\x90\xe3\x83\xbc\xe3\x83"
+    "\xac\xe3\x83\xab\xe3\x83\x8f\xe3\x83\xbc\xe3\x83\xac\xe3\x83\xab\xe3\x83\x94\xe3\x82\xa2\xe3\x82"
+    "\xb9\xe3\x83\x88\xe3\x83\xab\xe3\x83\x92\xe3\x82\xa2\xe3\x82\xb9\xe3\x83\x88\xe3\x83\xab\xe3\x83"
+    "\x94\xe3\x82\xaf\xe3\x83\xab\xe3\x83\x92\xe3\x82\xaf\xe3\x83\xab\xe3\x83\x94\xe3\x82\xb3\xe3\x83"
+    "\x92\xe3\x82\xb3\xe3\x83\x93\xe3\x83\xab\xe3\x83\x92\xe3\x83\xab\xe3\x83\x95\xe3\x82\xa1\xe3\x83"
+    "\xa9\xe3\x83\x83\xe3\x83\x89\xe3\x83\x95\xe3\x82\xa1\xe3\x83\xa9\xe3\x83\x83\xe3\x83\x88\xe3\x83"
+    "\x95\xe3\x82\xa3\xe3\x83\xbc\xe3\x83\x88\xe3\x83\x96\xe3\x83\x83\xe3\x82\xb7\xe3\x82\xa7\xe3\x83"
+    "\xab\xe3\x83\x95\xe3\x83\x83\xe3\x82\xb7\xe3\x82\xa7\xe3\x83\xab\xe3\x83\x95\xe3\x83\xa9\xe3\x83"
+    "\xb3\xe3\x83\x98\xe3\x82\xaf\xe3\x82\xbf\xe3\x83\xbc\xe3\x83\xab\xe3\x83\x9a\xe3\x82\xbd\xe3\x83"
+    "\x98\xe3\x82\xbd\xe3\x83\x9a\xe3\x83\x8b\xe3\x83\x92\xe3\x83\x98\xe3\x83\x8b\xe3\x83\x92\xe3\x83"
+    "\x98\xe3\x83\xab\xe3\x83\x84\xe3\x83\x9a\xe3\x83\xb3\xe3\x82\xb9\xe3\x83\x98\xe3\x83\xb3\xe3\x82"
+    "\xb9\xe3\x83\x9a\xe3\x83\xbc\xe3\x82\xb8\xe3\x83\x98\xe3\x83\xbc\xe3\x82\xb7\xe3\x83\x99\xe3\x83"
+    "\xbc\xe3\x82\xbf\xe3\x83\x98\xe3\x83\xbc\xe3\x82\xbf\xe3\x83\x9d\xe3\x82\xa4\xe3\x83\xb3\xe3\x83"
+    "\x88\xe3\x83\x9b\xe3\x82\xa4\xe3\x83\xb3\xe3\x83\x88\xe3\x83\x9c\xe3\x83\xab\xe3\x83\x88\xe3\x83"
+    "\x9b\xe3\x83\xab\xe3\x83\x88\xe3\x83\x9b\xe3\x83\xb3\xe3\x83\x9d\xe3\x83\xb3\xe3\x83\x89\xe3\x83"
+    "\x9b\xe3\x83\xb3\xe3\x83\x88\xe3\x83\x9b\xe3\x83\xbc\xe3\x83\xab\xe3\x83\x9b\xe3\x83\xbc\xe3\x83"
+    "\xb3\xe3\x83\x9e\xe3\x82\xa4\xe3\x82\xaf\xe3\x83\xad\xe3\x83\x9e\xe3\x82\xa4\xe3\x83\xab\xe3\x83"
+    "\x9e\xe3\x83\x83\xe3\x83\x8f\xe3\x83\x9e\xe3\x83\xab\xe3\x82\xaf\xe3\x83\x9e\xe3\x83\xb3\xe3\x82"
+    "\xb7\xe3\x83\xa7\xe3\x83\xb3\xe3\x83\x9f\xe3\x82\xaf\xe3\x83\xad\xe3\x83\xb3\xe3\x83\x9f\xe3\x83"
+    "\xaa\xe3\x83\x9f\xe3\x83\xaa\xe3\x83\x90\xe3\x83\xbc\xe3\x83\xab\xe3\x83\x9f\xe3\x83\xaa\xe3\x83"
+    "\x8f\xe3\x83\xbc\xe3\x83\xab\xe3\x83\xa1\xe3\x82\xac\xe3\x83\xa1\xe3\x82\xab\xe3\x83\xa1\xe3\x82"
+    "\xac\xe3\x83\x88\xe3\x83\xb3\xe3\x83\xa1\xe3\x82\xab\xe3\x83\x88\xe3\x83\xb3\xe3\x83\xa1\xe3\x83"
+    "\xbc\xe3\x83\x88\xe3\x83\xab\xe3\x83\xa4\xe3\x83\xbc\xe3\x83\x89\xe3\x83\xa4\xe3\x83\xbc\xe3\x83"
+    "\x88\xe3\x83\xa4\xe3\x83\xbc\xe3\x83\xab\xe3\x83\xa6\xe3\x82\xa2\xe3\x83\xb3\xe3\x83\xaa\xe3\x83"
+    "\x83\xe3\x83\x88\xe3\x83\xab\xe3\x83\xaa\xe3\x83\xa9\xe3\x83\xab\xe3\x83\x94\xe3\x83\xbc\xe3\x83"
+    "\xab\xe3\x83\x92\xe3\x83\xbc\xe3\x83\xab\xe3\x83\xbc\xe3\x83\x96\xe3\x83\xab\xe3\x83\xab\xe3\x83"
+    "\xbc\xe3\x83\x95\xe3\x83\xab\xe3\x83\xac\xe3\x83\xa0\xe3\x83\xac\xe3\x83\xb3\xe3\x83\x88\xe3\x82"
+    "\xb2\xe3\x83\xb3\xe3\x83\xac\xe3\x83\xb3\xe3\x83\x88\xe3\x82\xb1\xe3\x83\xb3\xe3\x83\xaf\xe3\x83"
+    "\x83\xe3\x83\x88\x30\xe7\x82\xb9\x6f\xe7\x82\xb9\x31\xe7\x82\xb9\x6c\xe7\x82\xb9\x32\xe7\x82\xb9"
+    "\x33\xe7\x82\xb9\x34\xe7\x82\xb9\x35\xe7\x82\xb9\x36\xe7\x82\xb9\x37\xe7\x82\xb9\x38\xe7\x82\xb9"
+    "\x39\xe7\x82\xb9\x31\x30\xe7\x82\xb9\x6c\x6f\xe7\x82\xb9\x31\x31\xe7\x82\xb9\x6c\x6c\xe7\x82\xb9"
+    "\x31\x32\xe7\x82\xb9\x6c\x32\xe7\x82\xb9\x31\x33\xe7\x82\xb9\x6c\x33\xe7\x82\xb9\x31\x34\xe7\x82"
+    "\xb9\x6c\x34\xe7\x82\xb9\x31\x35\xe7\x82\xb9\x6c\x35\xe7\x82\xb9\x31\x36\xe7\x82\xb9\x6c\x36\xe7"
+    "\x82\xb9\x31\x37\xe7\x82\xb9\x6c\x37\xe7\x82\xb9\x31\x38\xe7\x82\xb9\x6c\x38\xe7\x82\xb9\x31\x39"
+    "\xe7\x82\xb9\x6c\x39\xe7\x82\xb9\x32\x30\xe7\x82\xb9\x32\x6f\xe7\x82\xb9\x32\x31\xe7\x82\xb9\x32"
+    "\x6c\xe7\x82\xb9\x32\x32\xe7\x82\xb9\x32\x33\xe7\x82\xb9\x32\x34\xe7\x82\xb9\x68\x70\x61\x64\x61"
+    "\x61\x75\x62\x61\x72\x6f\x76\x70\x63\x64\x6d\x64\x6d\x32\x64\x6d\x33\x69\x75\xe5\xb9\xb3\xe6\x88"
+    "\x90\xe6\x98\xad\xe5\x92\x8c\xe5\xa4\xa7\xe6\xad\xa3\xe6\x98\x8e\xe6\xb2\xbb\xe6\xa0\xaa\xe5\xbc"
+    "\x8f\xe4\xbc\x9a\xe7\xa4\xbe\x70\x61\x6e\x61\xce\xbc\x61\x6d\x61\x6b\x61\x6b\x62\x6d\x62\x67\x62"
+    "\x63\x61\x6c\x6b\x63\x61\x6c\x70\x66\x6e\x66\xce\xbc\x66\xce\xbc\x67\x6d\x67\x6b\x67\x68\x7a\x6b"
+    "\x68\x7a\x6d\x68\x7a\x67\x68\x7a\x74\x68\x7a\xce\xbc\x6c\x6d\x6c\x64\x6c\x6b\x6c\x66\x6d\x6e\x6d"
+    "\xce\xbc\x6d\x6d\x6d\x63\x6d\x6b\x6d\x6d\x6d\x32\x63\x6d\x32\x6d\x32\x6b\x6d\x32\x6d\x6d\x33\x63"
+    "\x6d\x33\x6d\x33\x6b\x6d\x33\x6d\xe2\x88\x95\x73\x6d\xe2\x88\x95\x73\x32\x6b\x70\x61\x6d\x70\x61"
+    "\x67\x70\x61\x72\x61\x64\x72\x61\x64\xe2\x88\x95\x73\x72\x61\x64\xe2\x88\x95\x73\x32\x70\x73\x6e"
+    "\x73\xce\xbc\x73\x6d\x73\x70\x76\x6e\x76\xce\xbc\x76\x6d\x76\x6b\x76\x70\x77\x6e\x77\xce\xbc\x77"
+    "\x6d\x77\x6b\x77\x6b\xcf\x89\x6d\xcf\x89\x61\x2e\x6d\x2e\x62\x71\x63\x63\x63\x64\x63\xe2\x88\x95"
+    "\x6b\x67\x63\x6f\x2e\x64\x62\x67\x79\x68\x61\x68\x70\x69\x6e\x6b\x6b\x6b\x74\x6c\x6d\x6c\x6e\x6c"
+    "\x6f\x67\x6c\x78\x6d\x69\x6c\x6d\x6f\x6c\x70\x68\x70\x2e\x6d\x2e\x70\x70\x6d\x70\x72\x73\x72\x73"
+    "\x76\x77\x62\x76\xe2\x88\x95\x6d\x61\xe2\x88\x95\x6d\x31\xe6\x97\xa5\x6c\xe6\x97\xa5\x32\xe6\x97"
+    "\xa5\x33\xe6\x97\xa5\x34\xe6\x97\xa5\x35\xe6\x97\xa5\x36\xe6\x97\xa5\x37\xe6\x97\xa5\x38\xe6\x97"
+    "\xa5\x39\xe6\x97\xa5\x31\x30\xe6\x97\xa5\x6c\x6f\xe6\x97\xa5\x31\x31\xe6\x97\xa5\x6c\x6c\xe6\x97"
+    "\xa5\x31\x32\xe6\x97\xa5\x6c\x32\xe6\x97\xa5\x31\x33\xe6\x97\xa5\x6c\x33\xe6\x97\xa5\x31\x34\xe6"
+    "\x97\xa5\x6c\x34\xe6\x97\xa5\x31\x35\xe6\x97\xa5\x6c\x35\xe6\x97\xa5\x31\x36\xe6\x97\xa5\x6c\x36"
+    "\xe6\x97\xa5\x31\x37\xe6\x97\xa5\x6c\x37\xe6\x97\xa5\x31\x38\xe6\x97\xa5\x6c\x38\xe6\x97\xa5\x31"
+    "\x39\xe6\x97\xa5\x6c\x39\xe6\x97\xa5\x32\x30\xe6\x97\xa5\x32\x6f\xe6\x97\xa5\x32\x31\xe6\x97\xa5"
+    "\x32\x6c\xe6\x97\xa5\x32\x32\xe6\x97\xa5\x32\x33\xe6\x97\xa5\x32\x34\xe6\x97\xa5\x32\x35\xe6\x97"
+    "\xa5\x32\x36\xe6\x97\xa5\x32\x37\xe6\x97\xa5\x32\x38\xe6\x97\xa5\x32\x39\xe6\x97\xa5\x33\x30\xe6"
+    "\x97\xa5\x33\x6f\xe6\x97\xa5\x33\x31\xe6\x97\xa5\x33\x6c\xe6\x97\xa5\x67\x61\x6c\xea\x99\x81\xea"
+    "\x99\x83\xea\x99\x85\xea\x99\x87\xea\x99\x89\xea\x99\x8d\xea\x99\x8f\xea\x99\x91\xea\x99\x93\xea"
+    "\x99\x95\xea\x99\x97\xea\x99\x99\xea\x99\x9b\xea\x99\x9d\xea\x99\x9f\xea\x99\xa1\xea\x99\xa3\xea"
+    "\x99\xa5\xea\x99\xa7\xea\x99\xa9\xea\x99\xab\xea\x99\xad\xea\x99\xaf\xea\x99\xb0\xea\x99\xb1\xea"
+    "\x99\xb2\xea\x99\xb4\xea\x99\xb5\xea\x99\xb6\xea\x99\xb7\xea\x99\xb8\xea\x99\xb9\xea\x99\xba\xea"
+    "\x99\xbb\xea\x99\xbc\xea\x99\xbd\xea\x9a\x81\xea\x9a\x83\xea\x9a\x85\xea\x9a\x87\xea\x9a\x89\xea"
+    "\x9a\x8b\xea\x9a\x8d\xea\x9a\x8f\xea\x9a\x91\xea\x9a\x93\xea\x9a\x95\xea\x9a\x97\xea\x9a\x99\xea"
+    "\x9a\x9b\xea\x9a\x9e\xea\x9a\x9f\xea\x9b\xb0\xea\x9b\xb1\xea\x9c\xa3\xea\x9c\xa5\xea\x9c\xa7\xea"
+    "\x9c\xa9\xea\x9c\xab\xea\x9c\xad\xea\x9c\xaf\xea\x9c\xb3\xea\x9c\xb5\xea\x9c\xb7\xea\x9c\xb9\xea"
+    "\x9c\xbb\xea\x9c\xbd\xea\x9c\xbf\xea\x9d\x81\xea\x9d\x83\xea\x9d\x85\xea\x9d\x87\xea\x9d\x89\xea"
+    "\x9d\x8b\xea\x9d\x8d\xea\x9d\x8f\xea\x9d\x91\xea\x9d\x93\xea\x9d\x95\xea\x9d\x97\xea\x9d\x99\xea"
+    "\x9d\x9b\xea\x9d\x9d\xea\x9d\x9f\xea\x9d\xa1\xea\x9d\xa3\xea\x9d\xa5\xea\x9d\xa7\xea\x9d\xa9\xea"
+    "\x9d\xab\xea\x9d\xad\xea\x9d\xaf\xea\x9d\xba\xea\x9d\xbc\xe1\xb5\xb9\xea\x9d\xbf\xea\x9e\x81\xea"
+    "\x9e\x83\xea\x9e\x85\xea\x9e\x87\xea\x9e\x8c\xea\x9e\x91\xea\x9e\x93\xea\x9e\x97\xea\x9e\x99\xea"
+    "\x9e\x9b\xea\x9e\x9d\xea\x9e\x9f\xea\x9e\xa1\xea\x9e\xa3\xea\x9e\xa5\xea\x9e\xa7\xea\x9e\xa9\xc9"
+    "\xac\xca\x9e\xca\x87\xea\xad\x93\xea\x9e\xb5\xea\x9e\xb7\xea\x9e\xb9\xea\x9e\xbb\xea\x9e\xbd\xea"
+    "\x9e\xbf\xea\x9f\x81\xea\x9f\x83\xea\x9e\x94\xe1\xb6\x8e\xea\x9f\x88\xea\x9f\x8a\xea\x9f\x91\xea"
+    "\x9f\x97\xea\x9f\x99\xea\x9f\xb6\xea\xa0\x82\xea\xa0\x86\xea\xa0\x8b\xea\xa0\xa5\xea\xa0\xa6\xea"
+    "\xa0\xac\xea\xa3\x84\xea\xa3\x85\xea\xa3\xa0\xea\xa3\xa1\xea\xa3\xa2\xea\xa3\xa3\xea\xa3\xa4\xea"
+    "\xa3\xa5\xea\xa3\xa6\xea\xa3\xa7\xea\xa3\xa8\xea\xa3\xa9\xea\xa3\xaa\xea\xa3\xab\xea\xa3\xac\xea"
+    "\xa3\xad\xea\xa3\xae\xea\xa3\xaf\xea\xa3\xb0\xea\xa3\xb1\xea\xa3\xbf\xea\xa4\xa6\xea\xa4\xa7\xea"
+    "\xa4\xa8\xea\xa4\xa9\xea\xa4\xaa\xea\xa4\xab\xea\xa4\xac\xea\xa4\xad\xea\xa5\x87\xea\xa5\x88\xea"
+    "\xa5\x89\xea\xa5\x8a\xea\xa5\x8b\xea\xa5\x8c\xea\xa5\x8d\xea\xa5\x8e\xea\xa5\x8f\xea\xa5\x90\xea"
+    "\xa5\x91\xea\xa6\x80\xea\xa6\x81\xea\xa6\x82\xea\xa6\xb3\xea\xa6\xb6\xea\xa6\xb7\xea\xa6\xb8\xea"
+    "\xa6\xb9\xea\xa6\xbc\xea\xa6\xbd\xea\xa7\xa5\xea\xa8\xa9\xea\xa8\xaa\xea\xa8\xab\xea\xa8\xac\xea"
+    "\xa8\xad\xea\xa8\xae\xea\xa8\xb1\xea\xa8\xb2\xea\xa8\xb5\xea\xa8\xb6\xea\xa9\x83\xea\xa9\x8c\xea"
+    "\xa9\xbc\xea\xaa\xb0\xea\xaa\xb2\xea\xaa\xb3\xea\xaa\xb4\xea\xaa\xb7\xea\xaa\xb8\xea\xaa\xbe\xea"
+    "\xaa\xbf\xea\xab\x81\xea\xab\xac\xea\xab\xad\xea\xab\xb6\xea\xac\xb7\xea\xad\x92\xca\x8d\xe1\x8e"
+    "\xa0\xe1\x8e\xa1\xe1\x8e\xa2\xe1\x8e\xa3\xe1\x8e\xa4\xe1\x8e\xa5\xe1\x8e\xa6\xe1\x8e\xa7\xe1\x8e"
+    "\xa8\xe1\x8e\xa9\xe1\x8e\xaa\xe1\x8e\xab\xe1\x8e\xac\xe1\x8e\xad\xe1\x8e\xae\xe1\x8e\xaf\xe1\x8e"
+    "\xb0\xe1\x8e\xb1\xe1\x8e\xb2\xe1\x8e\xb3\xe1\x8e\xb4\xe1\x8e\xb5\xe1\x8e\xb6\xe1\x8e\xb7\xe1\x8e"
+    "\xb8\xe1\x8e\xb9\xe1\x8e\xba\xe1\x8e\xbb\xe1\x8e\xbc\xe1\x8e\xbd\xe1\x8e\xbe\xe1\x8e\xbf\xe1\x8f"
+    "\x80\xe1\x8f\x81\xe1\x8f\x82\xe1\x8f\x83\xe1\x8f\x84\xe1\x8f\x85\xe1\x8f\x86\xe1\x8f\x87\xe1\x8f"
+    "\x88\xe1\x8f\x89\xe1\x8f\x8a\xe1\x8f\x8b\xe1\x8f\x8c\xe1\x8f\x8d\xe1\x8f\x8e\xe1\x8f\x8f\xe1\x8f"
+    "\x90\xe1\x8f\x91\xe1\x8f\x92\xe1\x8f\x93\xe1\x8f\x94\xe1\x8f\x95\xe1\x8f\x96\xe1\x8f\x97\xe1\x8f"
+    "\x98\xe1\x8f\x99\xe1\x8f\x9a\xe1\x8f\x9b\xe1\x8f\x9c\xe1\x8f\x9d\xe1\x8f\x9e\xe1\x8f\x9f\xe1\x8f"
+    "\xa0\xe1\x8f\xa1\xe1\x8f\xa2\xe1\x8f\xa3\xe1\x8f\xa4\xe1\x8f\xa5\xe1\x8f\xa6\xe1\x8f\xa7\xe1\x8f"
+    "\xa8\xe1\x8f\xa9\xe1\x8f\xaa\xe1\x8f\xab\xe1\x8f\xac\xe1\x8f\xad\xe1\x8f\xae\xe1\x8f\xaf\xea\xaf"
+    "\xa5\xea\xaf\xa8\xea\xaf\xad\xe8\xb1\x88\xe6\x9b\xb4\xe8\xb3\x88\xe6\xbb\x91\xe4\xb8\xb2\xe5\x8f"
+    "\xa5\xe5\xa5\x91\xe5\x96\x87\xe5\xa5\x88\xe6\x87\xb6\xe7\x99\xa9\xe7\xbe\x85\xe8\x98\xbf\xe8\x9e"
+    "\xba\xe8\xa3\xb8\xe9\x82\x8f\xe6\xa8\x82\xe6\xb4\x9b\xe7\x83\x99\xe7\x8f\x9e\xe8\x90\xbd\xe9\x85"
+    "\xaa\xe9\xa7\xb1\xe4\xba\x82\xe5\x8d\xb5\xe6\xac\x84\xe7\x88\x9b\xe8\x98\xad\xe9\xb8\x9e\xe5\xb5"
+    "\x90\xe6\xbf\xab\xe8\x97\x8d\xe8\xa5\xa4\xe6\x8b\x89\xe8\x87\x98\xe8\xa0\x9f\xe5\xbb\x8a\xe6\x9c"
+    "\x97\xe6\xb5\xaa\xe7\x8b\xbc\xe9\x83\x8e\xe4\xbe\x86\xe5\x86\xb7\xe5\x8b\x9e\xe6\x93\x84\xe6\xab"
+    "\x93\xe7\x88\x90\xe7\x9b\xa7\xe8\x98\x86\xe8\x99\x9c\xe8\xb7\xaf\xe9\x9c\xb2\xe9\xad\xaf\xe9\xb7"
+    "\xba\xe7\xa2\x8c\xe7\xa5\xbf\xe7\xb6\xa0\xe8\x8f\x89\xe9\x8c\x84\xe8\xab\x96\xe5\xa3\x9f\xe5\xbc"
+    "\x84\xe7\xb1\xa0\xe8\x81\xbe\xe7\x89\xa2\xe7\xa3\x8a\xe8\xb3\x82\xe9\x9b\xb7\xe5\xa3\x98\xe5\xb1"
+    "\xa2\xe6\xa8\x93\xe6\xb7\x9a\xe6\xbc\x8f\xe7\xb4\xaf\xe7\xb8\xb7\xe9\x99\x8b\xe5\x8b\x92\xe8\x82"
+    "\x8b\xe5\x87\x9c\xe5\x87\x8c\xe7\xa8\x9c\xe7\xb6\xbe\xe8\x8f\xb1\xe9\x99\xb5\xe8\xae\x80\xe6\x8b"
+    "\x8f\xe8\xab\xbe\xe4\xb8\xb9\xe5\xaf\xa7\xe6\x80\x92\xe7\x8e\x87\xe7\x95\xb0\xe5\x8c\x97\xe7\xa3"
+    "\xbb\xe4\xbe\xbf\xe5\xbe\xa9\xe4\xb8\x8d\xe6\xb3\x8c\xe6\x95\xb8\xe7\xb4\xa2\xe5\x8f\x83\xe5\xa1"
+    "\x9e\xe7\x9c\x81\xe8\x91\x89\xe8\xaa\xaa\xe6\xae\xba\xe6\xb2\x88\xe6\x8b\xbe\xe8\x8b\xa5\xe6\x8e"
+    "\xa0\xe7\x95\xa5\xe4\xba\xae\xe5\x85\xa9\xe5\x87\x89\xe6\xa2\x81\xe7\xb3\xa7\xe8\x89\xaf\xe8\xab"
+    "\x92\xe9\x87\x8f\xe5\x8b\xb5\xe5\x91\x82\xe5\xbb\xac\xe6\x97\x85\xe6\xbf\xbe\xe7\xa4\xaa\xe9\x96"
+    "\xad\xe9\xa9\xaa\xe9\xba\x97\xe9\xbb\x8e\xe6\x9b\x86\xe6\xad\xb7\xe8\xbd\xa2\xe5\xb9\xb4\xe6\x86"
+    "\x90\xe6\x88\x80\xe6\x92\x9a\xe6\xbc\xa3\xe7\x85\x89\xe7\x92\x89\xe7\xa7\x8a\xe7\xb7\xb4\xe8\x81"
+    "\xaf\xe8\xbc\xa6\xe8\x93\xae\xe9\x80\xa3\xe9\x8d\x8a\xe5\x88\x97\xe5\x8a\xa3\xe5\x92\xbd\xe7\x83"
+    "\x88\xe8\xa3\x82\xe5\xbb\x89\xe5\xbf\xb5\xe6\x8d\xbb\xe6\xae\xae\xe7\xb0\xbe\xe7\x8d\xb5\xe4\xbb"
+    "\xa4\xe5\x9b\xb9\xe5\xb6\xba\xe6\x80\x9c\xe7\x8e\xb2\xe7\x91\xa9\xe7\xbe\x9a\xe8\x81\x86\xe9\x88"
+    "\xb4\xe9\x9b\xb6\xe9\x9d\x88\xe9\xa0\x98\xe4\xbe\x8b\xe7\xa6\xae\xe9\x86\xb4\xe9\x9a\xb8\xe6\x83"
+    "\xa1\xe4\xba\x86\xe5\x83\x9a\xe5\xaf\xae\xe5\xb0\xbf\xe6\x96\x99\xe7\x87\x8e\xe7\x99\x82\xe8\x93"
+    "\xbc\xe9\x81\xbc\xe6\x9a\x88\xe9\x98\xae\xe5\x8a\x89\xe6\x9d\xbb\xe6\x9f\xb3\xe6\xb5\x81\xe6\xba"
+    "\x9c\xe7\x90\x89\xe7\x95\x99\xe7\xa1\xab\xe7\xb4\x90\xe9\xa1\x9e\xe6\x88\xae\xe9\x99\xb8\xe5\x80"
+    "\xab\xe5\xb4\x99\xe6\xb7\xaa\xe8\xbc\xaa\xe5\xbe\x8b\xe6\x85\x84\xe6\xa0\x97\xe9\x9a\x86\xe5\x88"
+    "\xa9\xe5\x90\x8f\xe5\xb1\xa5\xe6\x98\x93\xe6\x9d\x8e\xe6\xa2\xa8\xe6\xb3\xa5\xe7\x90\x86\xe7\x97"
+    "\xa2\xe7\xbd\xb9\xe8\xa3\x8f\xe8\xa3\xa1\xe9\x9b\xa2\xe5\x8c\xbf\xe6\xba\xba\xe5\x90\x9d\xe7\x87"
+    "\x90\xe7\x92\x98\xe8\x97\xba\xe9\x9a\xa3\xe9\xb1\x97\xe9\xba\x9f\xe6\x9e\x97\xe6\xb7\x8b\xe8\x87"
+    "\xa8\xe7\xac\xa0\xe7\xb2\x92\xe7\x8b\x80\xe7\x82\x99\xe8\xad\x98\xe4\xbb\x80\xe8\x8c\xb6\xe5\x88"
+    "\xba\xe5\x88\x87\xe5\xba\xa6\xe6\x8b\x93\xe7\xb3\x96\xe5\xae\x85\xe6\xb4\x9e\xe6\x9a\xb4\xe8\xbc"
+    "\xbb\xe9\x99\x8d\xe5\xbb\x93\xe5\x85\x80\xe5\x97\x80\xe5\xa1\x9a\xe6\x99\xb4\xe5\x87\x9e\xe7\x8c"
+    "\xaa\xe7\x9b\x8a\xe7\xa4\xbc\xe7\xa5\x9e\xe7\xa5\xa5\xe7\xa6\x8f\xe9\x9d\x96\xe7\xb2\xbe\xe8\x98"
+    "\x92\xe8\xab\xb8\xe9\x80\xb8\xe9\x83\xbd\xe9\xa3\xaf\xe9\xa3\xbc\xe9\xa4\xa8\xe9\xb6\xb4\xe9\x83"
+    "\x9e\xe9\x9a\xb7\xe4\xbe\xae\xe5\x83\xa7\xe5\x85\x8d\xe5\x8b\x89\xe5\x8b\xa4\xe5\x8d\x91\xe5\x96"
+    "\x9d\xe5\x98\x86\xe5\x99\xa8\xe5\xa1\x80\xe5\xa2\xa8\xe5\xb1\xa4\xe6\x82\x94\xe6\x85\xa8\xe6\x86"
+    "\x8e\xe6\x87\xb2\xe6\x95\x8f\xe6\x97\xa2\xe6\x9a\x91\xe6\xa2\x85\xe6\xb5\xb7\xe6\xb8\x9a\xe6\xbc"
+    "\xa2\xe7\x85\xae\xe7\x88\xab\xe7\x90\xa2\xe7\xa2\x91\xe7\xa5\x89\xe7\xa5\x88\xe7\xa5\x90\xe7\xa5"
+    "\x96\xe7\xa6\x8d\xe7\xa6\x8e\xe7\xa9\x80\xe7\xaa\x81\xe7\xaf\x80\xe7\xb8\x89\xe7\xb9\x81\xe7\xbd"
+    "\xb2\xe8\x80\x85\xe8\x87\xad\xe8\x89\xb9\xe8\x91\x97\xe8\xa4\x90\xe8\xa6\x96\xe8\xac\x81\xe8\xac"
+    "\xb9\xe8\xb3\x93\xe8\xb4\x88\xe8\xbe\xb6\xe9\x9b\xa3\xe9\x9f\xbf\xe9\xa0\xbb\xe6\x81\xb5\xf0\xa4"
+    "\x8b\xae\xe8\x88\x98\xe4\xb8\xa6\xe5\x86\xb5\xe5\x85\xa8\xe4\xbe\x80\xe5\x85\x85\xe5\x86\x80\xe5"
+    "\x8b\x87\xe5\x8b\xba\xe5\x95\x95\xe5\x96\x99\xe5\x97\xa2\xe5\xa2\xb3\xe5\xa5\x84\xe5\xa5\x94\xe5"
+    "\xa9\xa2\xe5\xac\xa8\xe5\xbb\x92\xe5\xbb\x99\xe5\xbd\xa9\xe5\xbe\xad\xe6\x83\x98\xe6\x85\x8e\xe6"
+    "\x84\x88\xe6\x85\xa0\xe6\x88\xb4\xe6\x8f\x84\xe6\x90\x9c\xe6\x91\x92\xe6\x95\x96\xe6\x9c\x9b\xe6"
+    "\x9d\x96\xe6\xbb\x9b\xe6\xbb\x8b\xe7\x80\x9e\xe7\x9e\xa7\xe7\x88\xb5\xe7\x8a\xaf\xe7\x91\xb1\xe7"
+    "\x94\x86\xe7\x94\xbb\xe7\x98\x9d\xe7\x98\x9f\xe7\x9b\x9b\xe7\x9b\xb4\xe7\x9d\x8a\xe7\x9d\x80\xe7"
+    "\xa3\x8c\xe7\xaa\xb1\xe7\xb1\xbb\xe7\xb5\x9b\xe7\xbc\xbe\xe8\x8d\x92\xe8\x8f\xaf\xe8\x9d\xb9\xe8"
+    "\xa5\x81\xe8\xa6\x86\xe8\xaa\xbf\xe8\xab\x8b\xe8\xab\xad\xe8\xae\x8a\xe8\xbc\xb8\xe9\x81\xb2\xe9"
+    "\x86\x99\xe9\x89\xb6\xe9\x99\xbc\xe9\x9f\x9b\xe9\xa0\x8b\xe9\xac\x92\xf0\xa2\xa1\x8a\xf0\xa2\xa1"
+    "\x84\xf0\xa3\x8f\x95\xe3\xae\x9d\xe4\x80\x98\xe4\x80\xb9\xf0\xa5\x89\x89\xf0\xa5\xb3\x90\xf0\xa7"
+    "\xbb\x93\xe9\xbd\x83\xe9\xbe\x8e\x66\x66\x66\x69\x66\x6c\x66\x66\x69\x66\x66\x6c\x73\x74\xd5\xb4"
+    "\xd5\xb6\xd5\xb4\xd5\xa5\xd5\xb4\xd5\xab\xd5\xbe\xd5\xb6\xd5\xb4\xd5\xad\xd7\x99\xd6\xb4\xd7\x99"
+    "\xef\xac\x9e\xd7\xb2\xd6\xb7\xd7\xb2\xd7\xa2\xd7\x94\xd7\x9b\xd7\x9c\xd7\x9d\xd7\xa8\xd7\xaa\xd7"
+    "\xa9\xd7\x81\xd7\xa9\xd7\xa9\xd7\x82\xd7\xa9\xd6\xbc\xd7\x81\xd7\xa9\xd6\xbc\xd7\x82\xd7\x90\xd6"
+    "\xb7\xd7\x90\xd6\xb8\xd7\x90\xd6\xbc\xd7\x91\xd6\xbc\xd7\x92\xd6\xbc\xd7\x93\xd6\xbc\xd7\x94\xd6"
+    "\xbc\xd7\x95\xd6\xbc\xd7\x95\xd7\x96\xd6\xbc\xd7\x96\xd7\x98\xd6\xbc\xd7\x98\xd7\x99\xd6\xbc\xd7"
+    "\x9a\xd6\xbc\xd7\x9a\xd7\x9b\xd6\xbc\xd7\x9c\xd6\xbc\xd7\x9e\xd6\xbc\xd7\x9e\xd7\xa0\xd6\xbc\xd7"
+    "\xa0\xd7\xa1\xd6\xbc\xd7\xa1\xd7\xa3\xd6\xbc\xd7\xa3\xd7\xa4\xd6\xbc\xd7\xa4\xd7\xa6\xd6\xbc\xd7"
+    "\xa6\xd7\xa7\xd6\xbc\xd7\xa7\xd7\xa8\xd6\xbc\xd7\xa9\xd6\xbc\xd7\xaa\xd6\xbc\xd7\x95\xd6\xb9\xd7"
+    "\x91\xd6\xbf\xd7\x9b\xd6\xbf\xd7\xa4\xd6\xbf\xd7\x90\xd7\x9c\xd9\xb1\xd9\xbb\xd9\xbe\xda\x80\xd9"
+    "\xba\xd9\xbf\xd9\xb9\xda\xa4\xda\xa6\xda\x84\xda\x83\xda\x86\xda\x87\xda\x8d\xda\x8c\xda\x8e\xda"
+    "\x88\xda\x98\xda\x91\xda\xa9\xda\xaf\xda\xb3\xda\xb1\xda\xba\xda\xbb\xdb\x80\xda\xbe\xdb\x93\xda"
+    "\xad\xdb\x87\xdb\x86\xdb\x88\xdb\x8b\xdb\x85\xdb\x89\xdb\x90\xd9\x89\xd8\xa6\xd8\xa7\xd9\x8a\xd8"
+    "\xa7\xd8\xa6\xdb\x95\xd9\x8a\xdb\x95\xd8\xa6\xd9\x88\xd9\x8a\xd9\x88\xd8\xa6\xdb\x87\xd9\x8a\xdb"
+    "\x87\xd8\xa6\xdb\x86\xd9\x8a\xdb\x86\xd8\xa6\xdb\x88\xd9\x8a\xdb\x88\xd8\xa6\xdb\x90\xd9\x8a\xdb"
+    "\x90\xd8\xa6\xd9\x89\xd9\x8a\xd9\x89\xdb\x8c\xd8\xa6\xd8\xac\xd9\x8a\xd8\xac\xd8\xa6\xd8\xad\xd9"
+    "\x8a\xd8\xad\xd8\xa6\xd9\x85\xd9\x8a\xd9\x85\xd8\xa6\xd9\x8a\xd9\x8a\xd9\x8a\xd8\xa8\xd8\xac\xd8"
+    "\xa8\xd8\xad\xd8\xa8\xd8\xae\xd8\xa8\xd9\x85\xd8\xa8\xd9\x89\xd8\xa8\xd9\x8a\xd8\xaa\xd8\xac\xd8"
+    "\xaa\xd8\xad\xd8\xaa\xd8\xae\xd8\xaa\xd9\x85\xd8\xaa\xd9\x89\xd8\xaa\xd9\x8a\xd8\xab\xd8\xac\xd8"
+    "\xab\xd9\x85\xd8\xab\xd9\x89\xd8\xab\xd9\x8a\xd8\xac\xd8\xad\xd8\xac\xd9\x85\xd8\xad\xd8\xac\xd8"
+    "\xad\xd9\x85\xd8\xae\xd8\xac\xd8\xae\xd8\xad\xd8\xae\xd9\x85\xd8\xb3\xd8\xac\xd8\xb3\xd8\xad\xd8"
+    "\xb3\xd8\xae\xd8\xb3\xd9\x85\xd8\xb5\xd8\xad\xd8\xb5\xd9\x85\xd8\xb6\xd8\xac\xd8\xb6\xd8\xad\xd8"
+    "\xb6\xd8\xae\xd8\xb6\xd9\x85\xd8\xb7\xd8\xad\xd8\xb7\xd9\x85\xd8\xb8\xd9\x85\xd8\xb9\xd8\xac\xd8"
+    "\xb9\xd9\x85\xd8\xba\xd8\xac\xd8\xba\xd9\x85\xd9\x81\xd8\xac\xd9\x81\xd8\xad\xd9\x81\xd8\xae\xd9"
+    "\x81\xd9\x85\xd9\x81\xd9\x89\xd9\x81\xd9\x8a\xd9\x82\xd8\xad\xd9\x82\xd9\x85\xd9\x82\xd9\x89\xd9"
+    "\x82\xd9\x8a\xd9\x83\xd8\xa7\xd9\x83\xd8\xac\xd9\x83\xd8\xad\xd9\x83\xd8\xae\xd9\x83\xd9\x84\xd9"
+    "\x83\xd9\x85\xd9\x83\xd9\x89\xd9\x83\xd9\x8a\xd9\x84\xd8\xac\xd9\x84\xd8\xad\xd9\x84\xd8\xae\xd9"
+    "\x84\xd9\x85\xd9\x84\xd9\x89\xd9\x84\xd9\x8a\xd9\x85\xd8\xac\xd9\x85\xd8\xad\xd9\x85\xd8\xae\xd9"
+    "\x85\xd9\x85\xd9\x85\xd9\x89\xd9\x85\xd9\x8a\xd9\x86\xd8\xac\xd9\x86\xd8\xad\xd9\x86\xd8\xae\xd9"
+    "\x86\xd9\x85\xd9\x86\xd9\x89\xd9\x86\xd9\x8a\xd9\x87\xd8\xac\xd9\x87\xd9\x85\xd9\x87\xd9\x89\xd9"
+    "\x87\xd9\x8a\xd9\x8a\xd8\xae\xd8\xb0\xd9\xb0\xd8\xb0\xd8\xb1\xd9\xb0\xd8\xb1\xd9\x89\xd9\xb0\x20"
+    "\xd9\x8c\xd9\x91\x20\xd9\x8d\xd9\x91\x20\xd9\x8e\xd9\x91\x20\xd9\x8f\xd9\x91\x20\xd9\x90\xd9\x91"
+    "\x20\xd9\x91\xd9\xb0\xd8\xa6\xd8\xb1\xd9\x8a\xd8\xb1\xd8\xa6\xd8\xb2\xd9\x8a\xd8\xb2\xd8\xa6\xd9"
+    "\x86\xd9\x8a\xd9\x86\xd8\xa8\xd8\xb1\xd8\xa8\xd8\xb2\xd8\xa8\xd9\x86\xd8\xaa\xd8\xb1\xd8\xaa\xd8"
+    "\xb2\xd8\xaa\xd9\x86\xd8\xab\xd8\xb1\xd8\xab\xd8\xb2\xd8\xab\xd9\x86\xd9\x85\xd8\xa7\xd9\x86\xd8"
+    "\xb1\xd9\x86\xd8\xb2\xd9\x86\xd9\x86\xd8\xa6\xd8\xae\xd8\xa6\xd9\x87\xd9\x8a\xd9\x87\xd8\xa8\xd9"
+    "\x87\xd8\xaa\xd9\x87\xd8\xb5\xd8\xae\xd9\x84\xd9\x87\xd9\x86\xd9\x87\xd9\x87\xd9\xb0\xd9\x87\xd8"
+    "\xab\xd9\x87\xd8\xb3\xd9\x87\xd8\xb4\xd9\x85\xd8\xb4\xd9\x87\xd9\x80\xd9\x8e\xd9\x91\xd9\x80\xd9"
+    "\x80\xd9\x8f\xd9\x91\xd9\x80\xd9\x90\xd9\x91\xd8\xb7\xd9\x89\xd8\xb7\xd9\x8a\xd8\xb9\xd9\x89\xd8"
+    "\xb9\xd9\x8a\xd8\xba\xd9\x89\xd8\xba\xd9\x8a\xd8\xb3\xd9\x89\xd8\xb3\xd9\x8a\xd8\xb4\xd9\x89\xd8"
+    "\xb4\xd9\x8a\xd8\xad\xd9\x89\xd8\xad\xd9\x8a\xd8\xac\xd9\x89\xd8\xac\xd9\x8a\xd8\xae\xd9\x89\xd8"
+    "\xae\xd9\x8a\xd8\xb5\xd9\x89\xd8\xb5\xd9\x8a\xd8\xb6\xd9\x89\xd8\xb6\xd9\x8a\xd8\xb4\xd8\xac\xd8"
+    "\xb4\xd8\xad\xd8\xb4\xd8\xae\xd8\xb4\xd8\xb1\xd8\xb3\xd8\xb1\xd8\xb5\xd8\xb1\xd8\xb6\xd8\xb1\xd8"
+    "\xa7\xd9\x8b\xd8\xaa\xd8\xac\xd9\x85\xd8\xaa\xd8\xad\xd8\xac\xd8\xaa\xd8\xad\xd9\x85\xd8\xaa\xd8"
+    "\xae\xd9\x85\xd8\xaa\xd9\x85\xd8\xac\xd8\xaa\xd9\x85\xd8\xad\xd8\xaa\xd9\x85\xd8\xae\xd8\xac\xd9"
+    "\x85\xd8\xad\xd8\xad\xd9\x85\xd9\x8a\xd8\xad\xd9\x85\xd9\x89\xd8\xb3\xd8\xad\xd8\xac\xd8\xb3\xd8"
+    "\xac\xd8\xad\xd8\xb3\xd8\xac\xd9\x89\xd8\xb3\xd9\x85\xd8\xad\xd8\xb3\xd9\x85\xd8\xac\xd8\xb3\xd9"
+    "\x85\xd9\x85\xd8\xb5\xd8\xad\xd8\xad\xd8\xb5\xd9\x85\xd9\x85\xd8\xb4\xd8\xad\xd9\x85\xd8\xb4\xd8"
+    "\xac\xd9\x8a\xd8\xb4\xd9\x85\xd8\xae\xd8\xb4\xd9\x85\xd9\x85\xd8\xb6\xd8\xad\xd9\x89\xd8\xb6\xd8"
+    "\xae\xd9\x85\xd8\xb7\xd9\x85\xd8\xad\xd8\xb7\xd9\x85\xd9\x85\xd8\xb7\xd9\x85\xd9\x8a\xd8\xb9\xd8"
+    "\xac\xd9\x85\xd8\xb9\xd9\x85\xd9\x85\xd8\xb9\xd9\x85\xd9\x89\xd8\xba\xd9\x85\xd9\x85\xd8\xba\xd9"
+    "\x85\xd9\x8a\xd8\xba\xd9\x85\xd9\x89\xd9\x81\xd8\xae\xd9\x85\xd9\x82\xd9\x85\xd8\xad\xd9\x82\xd9"
+    "\x85\xd9\x85\xd9\x84\xd8\xad\xd9\x85\xd9\x84\xd8\xad\xd9\x8a\xd9\x84\xd8\xad\xd9\x89\xd9\x84\xd8"
+    "\xac\xd8\xac\xd9\x84\xd8\xae\xd9\x85\xd9\x84\xd9\x85\xd8\xad\xd9\x85\xd8\xad\xd8\xac\xd9\x85\xd8"
+    "\xad\xd9\x85\xd9\x85\xd8\xad\xd9\x8a\xd9\x85\xd8\xac\xd8\xad\xd9\x85\xd8\xac\xd9\x85\xd9\x85\xd8"
+    "\xae\xd8\xac\xd9\x85\xd8\xae\xd9\x85\xd9\x85\xd8\xac\xd8\xae\xd9\x87\xd9\x85\xd8\xac\xd9\x87\xd9"
+    "\x85\xd9\x85\xd9\x86\xd8\xad\xd9\x85\xd9\x86\xd8\xad\xd9\x89\xd9\x86\xd8\xac\xd9\x85\xd9\x86\xd8"
+    "\xac\xd9\x89\xd9\x86\xd9\x85\xd9\x8a\xd9\x86\xd9\x85\xd9\x89\xd9\x8a\xd9\x85\xd9\x85\xd8\xa8\xd8"
+    "\xae\xd9\x8a\xd8\xaa\xd8\xac\xd9\x8a\xd8\xaa\xd8\xac\xd9\x89\xd8\xaa\xd8\xae\xd9\x8a\xd8\xaa\xd8"
+    "\xae\xd9\x89\xd8\xaa\xd9\x85\xd9\x8a\xd8\xaa\xd9\x85\xd9\x89\xd8\xac\xd9\x85\xd9\x8a\xd8\xac\xd8"
+    "\xad\xd9\x89\xd8\xac\xd9\x85\xd9\x89\xd8\xb3\xd8\xae\xd9\x89\xd8\xb5\xd8\xad\xd9\x8a\xd8\xb4\xd8"
+    "\xad\xd9\x8a\xd8\xb6\xd8\xad\xd9\x8a\xd9\x84\xd8\xac\xd9\x8a\xd9\x84\xd9\x85\xd9\x8a\xd9\x8a\xd8"
+    "\xad\xd9\x8a\xd9\x8a\xd8\xac\xd9\x8a\xd9\x8a\xd9\x85\xd9\x8a\xd9\x85\xd9\x85\xd9\x8a\xd9\x82\xd9"
+    "\x85\xd9\x8a\xd9\x86\xd8\xad\xd9\x8a\xd8\xb9\xd9\x85\xd9\x8a\xd9\x83\xd9\x85\xd9\x8a\xd9\x86\xd8"
+    "\xac\xd8\xad\xd9\x85\xd8\xae\xd9\x8a\xd9\x84\xd8\xac\xd9\x85\xd9\x83\xd9\x85\xd9\x85\xd8\xac\xd8"
+    "\xad\xd9\x8a\xd8\xad\xd8\xac\xd9\x8a\xd9\x85\xd8\xac\xd9\x8a\xd9\x81\xd9\x85\xd9\x8a\xd8\xa8\xd8"
+    "\xad\xd9\x8a\xd8\xb3\xd8\xae\xd9\x8a\xd9\x86\xd8\xac\xd9\x8a\xd8\xb5\xd9\x84\xdb\x92\xd9\x82\xd9"
+    "\x84\xdb\x92\xd8\xa7\xd9\x84\xd9\x84\xd9\x87\xd8\xa7\xd9\x83\xd8\xa8\xd8\xb1\xd9\x85\xd8\xad\xd9"
+    "\x85\xd8\xaf\xd8\xb5\xd9\x84\xd8\xb9\xd9\x85\xd8\xb1\xd8\xb3\xd9\x88\xd9\x84\xd8\xb9\xd9\x84\xd9"
+    "\x8a\xd9\x87\xd9\x88\xd8\xb3\xd9\x84\xd9\x85\xd8\xb5\xd9\x84\xd9\x89\xd8\xb5\xd9\x84\xd9\x89\x20"
+    "\xd8\xa7\xd9\x84\xd9\x84\xd9\x87\x20\xd8\xb9\xd9\x84\xd9\x8a\xd9\x87\x20\xd9\x88\xd8\xb3\xd9\x84"
+    "\xd9\x85\xd8\xac\xd9\x84\x20\xd8\xac\xd9\x84\xd8\xa7\xd9\x84\xd9\x87\xd8\xb1\xdb\x8c\xd8\xa7\xd9"
+    "\x84\x2c\xe3\x80\x81\xe3\x80\x82\x3a\x21\x3f\xe3\x80\x96\xe3\x80\x97\xef\xb8\xa0\xef\xb8\xa1\xef"
+    "\xb8\xa2\xef\xb8\xa3\xef\xb8\xa4\xef\xb8\xa5\xef\xb8\xa6\xef\xb8\xa7\xef\xb8\xa8\xef\xb8\xa9\xef"
+    "\xb8\xaa\xef\xb8\xab\xef\xb8\xac\xef\xb8\xad\xef\xb8\xae\xef\xb8\xaf\xe2\x80\x94\xe2\x80\x93\x5f"
+    "\x7b\x7d\xe3\x80\x94\xe3\x80\x95\xe3\x80\x90\xe3\x80\x91\xe3\x80\x8a\xe3\x80\x8b\xe3\x80\x8c\xe3"
+    "\x80\x8d\xe3\x80\x8e\xe3\x80\x8f\x5b\x5d\x23\x26\x2a\x2d\x5c\x24\x25\x40\x20\xd9\x8b\xd9\x80\xd9"
+    "\x8b\x20\xd9\x8c\x20\xd9\x8d\x20\xd9\x8e\xd9\x80\xd9\x8e\x20\xd9\x8f\xd9\x80\xd9\x8f\x20\xd9\x90"
+    "\xd9\x80\xd9\x90\x20\xd9\x91\xd9\x80\xd9\x91\x20\xd9\x92\xd9\x80\xd9\x92\xd8\xa1\xd8\xa2\xd8\xa3"
+    "\xd8\xa4\xd8\xa5\xd8\xa6\xd8\xa8\xd8\xa9\xd8\xaa\xd8\xab\xd8\xac\xd8\xad\xd8\xae\xd8\xaf\xd8\xb2"
+    "\xd8\xb3\xd8\xb4\xd8\xb5\xd8\xb6\xd8\xb7\xd8\xb8\xd8\xb9\xd8\xba\xd9\x81\xd9\x82\xd9\x83\xd9\x84"
+    "\xd9\x85\xd9\x86\xd9\x84\xd8\xa2\xd9\x84\xd8\xa7\xd9\x84\xd8\xa3\xd9\x84\xd8\xa5\x22\x27\x2f\x5e"
+    "\x7c\x7e\xe2\xa6\x85\xe2\xa6\x86\xe3\x83\xbb\xe3\x82\xa1\xe3\x82\xa3\xe3\x82\xa5\xe3\x82\xa7\xe3"
+    "\x82\xa9\xe3\x83\xa3\xe3\x83\xa5\xe3\x83\xa7\xe3\x83\x83\xe3\x83\xbc\xe3\x83\xb3\xc2\xa2\xc2\xa3"
+    "\xc2\xac\xc2\xa6\xc2\xa5\xe2\x82\xa9\xe2\x94\x82\xe2\x86\x91\xe2\x86\x93\xe2\x96\xa0\xe2\x97\x8b"
+    "\xf0\x90\x87\xbd\xf0\x90\x8b\xa0\xf0\x90\x8d\xb6\xf0\x90\x8d\xb7\xf0\x90\x8d\xb8\xf0\x90\x8d\xb9"
+    "\xf0\x90\x8d\xba\xf0\x90\x90\xa8\xf0\x90\x90\xa9\xf0\x90\x90\xaa\xf0\x90\x90\xab\xf0\x90\x90\xac"
+    "\xf0\x90\x90\xad\xf0\x90\x90\xae\xf0\x90\x90\xaf\xf0\x90\x90\xb0\xf0\x90\x90\xb1\xf0\x90\x90\xb2"
+    "\xf0\x90\x90\xb3\xf0\x90\x90\xb4\xf0\x90\x90\xb5\xf0\x90\x90\xb6\xf0\x90\x90\xb7\xf0\x90\x90\xb8"
+    "\xf0\x90\x90\xb9\xf0\x90\x90\xba\xf0\x90\x90\xbb\xf0\x90\x90\xbc\xf0\x90\x90\xbd\xf0\x90\x90\xbe"
+    "\xf0\x90\x90\xbf\xf0\x90\x91\x80\xf0\x90\x91\x81\xf0\x90\x91\x82\xf0\x90\x91\x83\xf0\x90\x91\x84"
+    "\xf0\x90\x91\x85\xf0\x90\x91\x86\xf0\x90\x91\x87\xf0\x90\x91\x88\xf0\x90\x91\x89\xf0\x90\x91\x8a"
+    "\xf0\x90\x91\x8b\xf0\x90\x91\x8c\xf0\x90\x91\x8d\xf0\x90\x91\x8e\xf0\x90\x91\x8f\xf0\x90\x93\x98"
+    "\xf0\x90\x93\x99\xf0\x90\x93\x9a\xf0\x90\x93\x9b\xf0\x90\x93\x9c\xf0\x90\x93\x9d\xf0\x90\x93\x9e"
+    "\xf0\x90\x93\x9f\xf0\x90\x93\xa0\xf0\x90\x93\xa1\xf0\x90\x93\xa2\xf0\x90\x93\xa3\xf0\x90\x93\xa4"
+    "\xf0\x90\x93\xa5\xf0\x90\x93\xa6\xf0\x90\x93\xa7\xf0\x90\x93\xa8\xf0\x90\x93\xa9\xf0\x90\x93\xaa"
+    "\xf0\x90\x93\xab\xf0\x90\x93\xac\xf0\x90\x93\xad\xf0\x90\x93\xae\xf0\x90\x93\xaf\xf0\x90\x93\xb0"
+    "\xf0\x90\x93\xb1\xf0\x90\x93\xb2\xf0\x90\x93\xb3\xf0\x90\x93\xb4\xf0\x90\x93\xb5\xf0\x90\x93\xb6"
+    "\xf0\x90\x93\xb7\xf0\x90\x93\xb8\xf0\x90\x93\xb9\xf0\x90\x93\xba\xf0\x90\x93\xbb\xf0\x90\x96\x97"
+    "\xf0\x90\x96\x98\xf0\x90\x96\x99\xf0\x90\x96\x9a\xf0\x90\x96\x9b\xf0\x90\x96\x9c\xf0\x90\x96\x9d"
+    "\xf0\x90\x96\x9e\xf0\x90\x96\x9f\xf0\x90\x96\xa0\xf0\x90\x96\xa1\xf0\x90\x96\xa3\xf0\x90\x96\xa4"
+    "\xf0\x90\x96\xa5\xf0\x90\x96\xa6\xf0\x90\x96\xa7\xf0\x90\x96\xa8\xf0\x90\x96\xa9\xf0\x90\x96\xaa"
+    "\xf0\x90\x96\xab\xf0\x90\x96\xac\xf0\x90\x96\xad\xf0\x90\x96\xae\xf0\x90\x96\xaf\xf0\x90\x96\xb0"
+    "\xf0\x90\x96\xb1\xf0\x90\x96\xb3\xf0\x90\x96\xb4\xf0\x90\x96\xb5\xf0\x90\x96\xb6\xf0\x90\x96\xb7"
+    "\xf0\x90\x96\xb8\xf0\x90\x96\xb9\xf0\x90\x96\xbb\xf0\x90\x96\xbc\xcb\x90\xcb\x91\xca\x99\xca\xa3"
+    "\xea\xad\xa6\xca\xa5\xca\xa4\xe1\xb6\x91\xc9\x98\xc9\x9e\xca\xa9\xc9\xa4\xc9\xa2\xca\x9b\xca\x9c"
+    "\xc9\xa7\xca\x84\xca\xaa\xca\xab\xf0\x9d\xbc\x84\xea\x9e\x8e\xc9\xae\xf0\x9d\xbc\x85\xca\x8e\xf0"
+    "\x9d\xbc\x86\xc9\xb6\xc9\xb7\xc9\xba\xf0\x9d\xbc\x88\xc9\xbe\xca\xa8\xca\xa6\xea\xad\xa7\xca\xa7"
+    "\xe2\xb1\xb1\xca\x8f\xca\xa1\xca\xa2\xca\x98\xc7\x80\xc7\x81\xc7\x82\xf0\x9d\xbc\x8a\xf0\x9d\xbc"
+    "\x9e\xf0\x90\xa8\x81\xf0\x90\xa8\x82\xf0\x90\xa8\x83\xf0\x90\xa8\x85\xf0\x90\xa8\x86\xf0\x90\xa8"
+    "\x8c\xf0\x90\xa8\x8d\xf0\x90\xa8\x8e\xf0\x90\xa8\x8f\xf0\x90\xa8\xb8\xf0\x90\xa8\xb9\xf0\x90\xa8"
+    "\xba\xf0\x90\xa8\xbf\xf0\x90\xab\xa5\xf0\x90\xab\xa6\xf0\x90\xb3\x80\xf0\x90\xb3\x81\xf0\x90\xb3"
+    "\x82\xf0\x90\xb3\x83\xf0\x90\xb3\x84\xf0\x90\xb3\x85\xf0\x90\xb3\x86\xf0\x90\xb3\x87\xf0\x90\xb3"
+    "\x88\xf0\x90\xb3\x89\xf0\x90\xb3\x8a\xf0\x90\xb3\x8b\xf0\x90\xb3\x8c\xf0\x90\xb3\x8d\xf0\x90\xb3"
+    "\x8e\xf0\x90\xb3\x8f\xf0\x90\xb3\x90\xf0\x90\xb3\x91\xf0\x90\xb3\x92\xf0\x90\xb3\x93\xf0\x90\xb3"
+    "\x94\xf0\x90\xb3\x95\xf0\x90\xb3\x96\xf0\x90\xb3\x97\xf0\x90\xb3\x98\xf0\x90\xb3\x99\xf0\x90\xb3"
+    "\x9a\xf0\x90\xb3\x9b\xf0\x90\xb3\x9c\xf0\x90\xb3\x9d\xf0\x90\xb3\x9e\xf0\x90\xb3\x9f\xf0\x90\xb3"
+    "\xa0\xf0\x90\xb3\xa1\xf0\x90\xb3\xa2\xf0\x90\xb3\xa3\xf0\x90\xb3\xa4\xf0\x90\xb3\xa5\xf0\x90\xb3"
+    "\xa6\xf0\x90\xb3\xa7\xf0\x90\xb3\xa8\xf0\x90\xb3\xa9\xf0\x90\xb3\xaa\xf0\x90\xb3\xab\xf0\x90\xb3"
+    "\xac\xf0\x90\xb3\xad\xf0\x90\xb3\xae\xf0\x90\xb3\xaf\xf0\x90\xb3\xb0\xf0\x90\xb3\xb1\xf0\x90\xb3"
+    "\xb2\xf0\x90\xb4\xa4\xf0\x90\xb4\xa5\xf0\x90\xb4\xa6\xf0\x90\xb4\xa7\xf0\x90\xba\xab\xf0\x90\xba"
+    "\xac\xf0\x90\xbd\x86\xf0\x90\xbd\x87\xf0\x90\xbd\x88\xf0\x90\xbd\x89\xf0\x90\xbd\x8a\xf0\x90\xbd"
+    "\x8b\xf0\x90\xbd\x8c\xf0\x90\xbd\x8d\xf0\x90\xbd\x8e\xf0\x90\xbd\x8f\xf0\x90\xbd\x90\xf0\x90\xbe"
+    "\x82\xf0\x90\xbe\x83\xf0\x90\xbe\x84\xf0\x90\xbe\x85\xf0\x91\x80\x81\xf0\x91\x80\xb8\xf0\x91\x80"
+    "\xb9\xf0\x91\x80\xba\xf0\x91\x80\xbb\xf0\x91\x80\xbc\xf0\x91\x80\xbd\xf0\x91\x80\xbe\xf0\x91\x80"
+    "\xbf\xf0\x91\x81\x80\xf0\x91\x81\x81\xf0\x91\x81\x82\xf0\x91\x81\x83\xf0\x91\x81\x84\xf0\x91\x81"
+    "\x85\xf0\x91\x81\x86\xf0\x91\x81\xb0\xf0\x91\x81\xb3\xf0\x91\x81\xb4\xf0\x91\x81\xbf\xf0\x91\x82"
+    "\x80\xf0\x91\x82\x81\xf0\x91\x82\x99\xf0\x91\x82\x9b\xf0\x91\x82\xa5\xf0\x91\x82\xb3\xf0\x91\x82"
+    "\xb4\xf0\x91\x82\xb5\xf0\x91\x82\xb6\xf0\x91\x82\xb9\xf0\x91\x82\xba\xf0\x91\x83\x82\xf0\x91\x84"
+    "\x80\xf0\x91\x84\x81\xf0\x91\x84\x82\xf0\x91\x84\xa7\xf0\x91\x84\xa8\xf0\x91\x84\xa9\xf0\x91\x84"
+    "\xaa\xf0\x91\x84\xab\xf0\x91\x84\xad\xf0\x91\x84\xae\xf0\x91\x84\xaf\xf0\x91\x84\xb0\xf0\x91\x84"
+    "\xb1\xf0\x91\x84\xb2\xf0\x91\x84\xb3\xf0\x91\x84\xb4\xf0\x91\x85\xb3\xf0\x91\x86\x80\xf0\x91\x86"
+    "\x81\xf0\x91\x86\xb6\xf0\x91\x86\xb7\xf0\x91\x86\xb8\xf0\x91\x86\xb9\xf0\x91\x86\xba\xf0\x91\x86"
+    "\xbb\xf0\x91\x86\xbc\xf0\x91\x86\xbd\xf0\x91\x86\xbe\xf0\x91\x87\x89\xf0\x91\x87\x8a\xf0\x91\x87"
+    "\x8b\xf0\x91\x87\x8c\xf0\x91\x87\x8f\xf0\x91\x88\xaf\xf0\x91\x88\xb0\xf0\x91\x88\xb1\xf0\x91\x88"
+    "\xb4\xf0\x91\x88\xb6\xf0\x91\x88\xb7\xf0\x91\x88\xbe\xf0\x91\x8b\x9f\xf0\x91\x8b\xa3\xf0\x91\x8b"
+    "\xa4\xf0\x91\x8b\xa5\xf0\x91\x8b\xa6\xf0\x91\x8b\xa7\xf0\x91\x8b\xa8\xf0\x91\x8b\xa9\xf0\x91\x8b"
+    "\xaa\xf0\x91\x8c\x80\xf0\x91\x8c\x81\xf0\x91\x8c\xbb\xf0\x91\x8c\xbc\xf0\x91\x8d\x80\xf0\x91\x8d"
+    "\xa6\xf0\x91\x8d\xa7\xf0\x91\x8d\xa8\xf0\x91\x8d\xa9\xf0\x91\x8d\xaa\xf0\x91\x8d\xab\xf0\x91\x8d"
+    "\xac\xf0\x91\x8d\xb0\xf0\x91\x8d\xb1\xf0\x91\x8d\xb2\xf0\x91\x8d\xb3\xf0\x91\x8d\xb4\xf0\x91\x90"
+    "\xb8\xf0\x91\x90\xb9\xf0\x91\x90\xba\xf0\x91\x90\xbb\xf0\x91\x90\xbc\xf0\x91\x90\xbd\xf0\x91\x90"
+    "\xbe\xf0\x91\x90\xbf\xf0\x91\x91\x82\xf0\x91\x91\x83\xf0\x91\x91\x84\xf0\x91\x91\x86\xf0\x91\x91"
+    "\x9e\xf0\x91\x92\xb3\xf0\x91\x92\xb4\xf0\x91\x92\xb5\xf0\x91\x92\xb6\xf0\x91\x92\xb7\xf0\x91\x92"
+    "\xb8\xf0\x91\x92\xba\xf0\x91\x92\xbf\xf0\x91\x93\x80\xf0\x91\x93\x82\xf0\x91\x93\x83\xf0\x91\x96"
+    "\xb2\xf0\x91\x96\xb3\xf0\x91\x96\xb4\xf0\x91\x96\xb5\xf0\x91\x96\xbc\xf0\x91\x96\xbd\xf0\x91\x96"
+    "\xbf\xf0\x91\x97\x80\xf0\x91\x97\x9c\xf0\x91\x97\x9d\xf0\x91\x98\xb3\xf0\x91\x98\xb4\xf0\x91\x98"
+    "\xb5\xf0\x91\x98\xb6\xf0\x91\x98\xb7\xf0\x91\x98\xb8\xf0\x91\x98\xb9\xf0\x91\x98\xba\xf0\x91\x98"
+    "\xbd\xf0\x91\x98\xbf\xf0\x91\x99\x80\xf0\x91\x9a\xab\xf0\x91\x9a\xad\xf0\x91\x9a\xb0\xf0\x91\x9a"
+    "\xb1\xf0\x91\x9a\xb2\xf0\x91\x9a\xb3\xf0\x91\x9a\xb4\xf0\x91\x9a\xb5\xf0\x91\x9a\xb7\xf0\x91\x9c"
+    "\x9d\xf0\x91\x9c\x9e\xf0\x91\x9c\x9f\xf0\x91\x9c\xa2\xf0\x91\x9c\xa3\xf0\x91\x9c\xa4\xf0\x91\x9c"
+    "\xa5\xf0\x91\x9c\xa7\xf0\x91\x9c\xa8\xf0\x91\x9c\xa9\xf0\x91\x9c\xaa\xf0\x91\x9c\xab\xf0\x91\xa0"
+    "\xaf\xf0\x91\xa0\xb0\xf0\x91\xa0\xb1\xf0\x91\xa0\xb2\xf0\x91\xa0\xb3\xf0\x91\xa0\xb4\xf0\x91\xa0"
+    "\xb5\xf0\x91\xa0\xb6\xf0\x91\xa0\xb7\xf0\x91\xa0\xb9\xf0\x91\xa0\xba\xf0\x91\xa3\x80\xf0\x91\xa3"
+    "\x81\xf0\x91\xa3\x82\xf0\x91\xa3\x83\xf0\x91\xa3\x84\xf0\x91\xa3\x85\xf0\x91\xa3\x86\xf0\x91\xa3"
+    "\x87\xf0\x91\xa3\x88\xf0\x91\xa3\x89\xf0\x91\xa3\x8a\xf0\x91\xa3\x8b\xf0\x91\xa3\x8c\xf0\x91\xa3"
+    "\x8d\xf0\x91\xa3\x8e\xf0\x91\xa3\x8f\xf0\x91\xa3\x90\xf0\x91\xa3\x91\xf0\x91\xa3\x92\xf0\x91\xa3"
+    "\x93\xf0\x91\xa3\x94\xf0\x91\xa3\x95\xf0\x91\xa3\x96\xf0\x91\xa3\x97\xf0\x91\xa3\x98\xf0\x91\xa3"
+    "\x99\xf0\x91\xa3\x9a\xf0\x91\xa3\x9b\xf0\x91\xa3\x9c\xf0\x91\xa3\x9d\xf0\x91\xa3\x9e\xf0\x91\xa3"
+    "\x9f\xf0\x91\xa4\xbb\xf0\x91\xa4\xbc\xf0\x91\xa4\xbe\xf0\x91\xa5\x83\xf0\x91\xa7\x94\xf0\x91\xa7"
+    "\x95\xf0\x91\xa7\x96\xf0\x91\xa7\x97\xf0\x91\xa7\x9a\xf0\x91\xa7\x9b\xf0\x91\xa7\xa0\xf0\x91\xa8"
+    "\x81\xf0\x91\xa8\x82\xf0\x91\xa8\x83\xf0\x91\xa8\x84\xf0\x91\xa8\x85\xf0\x91\xa8\x86\xf0\x91\xa8"
+    "\x87\xf0\x91\xa8\x88\xf0\x91\xa8\x89\xf0\x91\xa8\x8a\xf0\x91\xa8\xb3\xf0\x91\xa8\xb4\xf0\x91\xa8"
+    "\xb5\xf0\x91\xa8\xb6\xf0\x91\xa8\xb7\xf0\x91\xa8\xb8\xf0\x91\xa8\xbb\xf0\x91\xa8\xbc\xf0\x91\xa8"
+    "\xbd\xf0\x91\xa8\xbe\xf0\x91\xa9\x87\xf0\x91\xa9\x91\xf0\x91\xa9\x92\xf0\x91\xa9\x93\xf0\x91\xa9"
+    "\x94\xf0\x91\xa9\x95\xf0\x91\xa9\x96\xf0\x91\xa9\x99\xf0\x91\xa9\x9a\xf0\x91\xa9\x9b\xf0\x91\xaa"
+    "\x8a\xf0\x91\xaa\x8b\xf0\x91\xaa\x8c\xf0\x91\xaa\x8d\xf0\x91\xaa\x8e\xf0\x91\xaa\x8f\xf0\x91\xaa"
+    "\x90\xf0\x91\xaa\x91\xf0\x91\xaa\x92\xf0\x91\xaa\x93\xf0\x91\xaa\x94\xf0\x91\xaa\x95\xf0\x91\xaa"
+    "\x96\xf0\x91\xaa\x98\xf0\x91\xaa\x99\xf0\x91\xb0\xb0\xf0\x91\xb0\xb1\xf0\x91\xb0\xb2\xf0\x91\xb0"
+    "\xb3\xf0\x91\xb0\xb4\xf0\x91\xb0\xb5\xf0\x91\xb0\xb6\xf0\x91\xb0\xb8\xf0\x91\xb0\xb9\xf0\x91\xb0"
+    "\xba\xf0\x91\xb0\xbb\xf0\x91\xb0\xbc\xf0\x91\xb0\xbd\xf0\x91\xb0\xbf\xf0\x91\xb2\x92\xf0\x91\xb2"
+    "\x93\xf0\x91\xb2\x94\xf0\x91\xb2\x95\xf0\x91\xb2\x96\xf0\x91\xb2\x97\xf0\x91\xb2\x98\xf0\x91\xb2"
+    "\x99\xf0\x91\xb2\x9a\xf0\x91\xb2\x9b\xf0\x91\xb2\x9c\xf0\x91\xb2\x9d\xf0\x91\xb2\x9e\xf0\x91\xb2"
+    "\x9f\xf0\x91\xb2\xa0\xf0\x91\xb2\xa1\xf0\x91\xb2\xa2\xf0\x91\xb2\xa3\xf0\x91\xb2\xa4\xf0\x91\xb2"
+    "\xa5\xf0\x91\xb2\xa6\xf0\x91\xb2\xa7\xf0\x91\xb2\xaa\xf0\x91\xb2\xab\xf0\x91\xb2\xac\xf0\x91\xb2"
+    "\xad\xf0\x91\xb2\xae\xf0\x91\xb2\xaf\xf0\x91\xb2\xb0\xf0\x91\xb2\xb2\xf0\x91\xb2\xb3\xf0\x91\xb2"
+    "\xb5\xf0\x91\xb2\xb6\xf0\x91\xb4\xb1\xf0\x91\xb4\xb2\xf0\x91\xb4\xb3\xf0\x91\xb4\xb4\xf0\x91\xb4"
+    "\xb5\xf0\x91\xb4\xb6\xf0\x91\xb4\xba\xf0\x91\xb4\xbc\xf0\x91\xb4\xbd\xf0\x91\xb4\xbf\xf0\x91\xb5"
+    "\x80\xf0\x91\xb5\x81\xf0\x91\xb5\x82\xf0\x91\xb5\x83\xf0\x91\xb5\x84\xf0\x91\xb5\x85\xf0\x91\xb5"
+    "\x87\xf0\x91\xb6\x90\xf0\x91\xb6\x91\xf0\x91\xb6\x95\xf0\x91\xb6\x97\xf0\x91\xbb\xb3\xf0\x91\xbb"
+    "\xb4\xf0\x96\xab\xb0\xf0\x96\xab\xb1\xf0\x96\xab\xb2\xf0\x96\xab\xb3\xf0\x96\xab\xb4\xf0\x96\xac"
+    "\xb0\xf0\x96\xac\xb1\xf0\x96\xac\xb2\xf0\x96\xac\xb3\xf0\x96\xac\xb4\xf0\x96\xac\xb5\xf0\x96\xac"
+    "\xb6\xf0\x96\xb9\xa0\xf0\x96\xb9\xa1\xf0\x96\xb9\xa2\xf0\x96\xb9\xa3\xf0\x96\xb9\xa4\xf0\x96\xb9"
+    "\xa5\xf0\x96\xb9\xa6\xf0\x96\xb9\xa7\xf0\x96\xb9\xa8\xf0\x96\xb9\xa9\xf0\x96\xb9\xaa\xf0\x96\xb9"
+    "\xab\xf0\x96\xb9\xac\xf0\x96\xb9\xad\xf0\x96\xb9\xae\xf0\x96\xb9\xaf\xf0\x96\xb9\xb0\xf0\x96\xb9"
+    "\xb1\xf0\x96\xb9\xb2\xf0\x96\xb9\xb3\xf0\x96\xb9\xb4\xf0\x96\xb9\xb5\xf0\x96\xb9\xb6\xf0\x96\xb9"
+    "\xb7\xf0\x96\xb9\xb8\xf0\x96\xb9\xb9\xf0\x96\xb9\xba\xf0\x96\xb9\xbb\xf0\x96\xb9\xbc\xf0\x96\xb9"
+    "\xbd\xf0\x96\xb9\xbe\xf0\x96\xb9\xbf\xf0\x96\xbd\x8f\xf0\x96\xbe\x8f\xf0\x96\xbe\x90\xf0\x96\xbe"
+    "\x91\xf0\x96\xbe\x92\xf0\x96\xbf\xa4\xf0\x9b\xb2\x9d\xf0\x9b\xb2\x9e\xf0\x9c\xbc\x80\xf0\x9c\xbc"
+    "\x81\xf0\x9c\xbc\x82\xf0\x9c\xbc\x83\xf0\x9c\xbc\x84\xf0\x9c\xbc\x85\xf0\x9c\xbc\x86\xf0\x9c\xbc"
+    "\x87\xf0\x9c\xbc\x88\xf0\x9c\xbc\x89\xf0\x9c\xbc\x8a\xf0\x9c\xbc\x8b\xf0\x9c\xbc\x8c\xf0\x9c\xbc"
+    "\x8d\xf0\x9c\xbc\x8e\xf0\x9c\xbc\x8f\xf0\x9c\xbc\x90\xf0\x9c\xbc\x91\xf0\x9c\xbc\x92\xf0\x9c\xbc"
+    "\x93\xf0\x9c\xbc\x94\xf0\x9c\xbc\x95\xf0\x9c\xbc\x96\xf0\x9c\xbc\x97\xf0\x9c\xbc\x98\xf0\x9c\xbc"
+    "\x99\xf0\x9c\xbc\x9a\xf0\x9c\xbc\x9b\xf0\x9c\xbc\x9c\xf0\x9c\xbc\x9d\xf0\x9c\xbc\x9e\xf0\x9c\xbc"
+    "\x9f\xf0\x9c\xbc\xa0\xf0\x9c\xbc\xa1\xf0\x9c\xbc\xa2\xf0\x9c\xbc\xa3\xf0\x9c\xbc\xa4\xf0\x9c\xbc"
+    "\xa5\xf0\x9c\xbc\xa6\xf0\x9c\xbc\xa7\xf0\x9c\xbc\xa8\xf0\x9c\xbc\xa9\xf0\x9c\xbc\xaa\xf0\x9c\xbc"
+    "\xab\xf0\x9c\xbc\xac\xf0\x9c\xbc\xad\xf0\x9c\xbc\xb0\xf0\x9c\xbc\xb1\xf0\x9c\xbc\xb2\xf0\x9c\xbc"
+    "\xb3\xf0\x9c\xbc\xb4\xf0\x9c\xbc\xb5\xf0\x9c\xbc\xb6\xf0\x9c\xbc\xb7\xf0\x9c\xbc\xb8\xf0\x9c\xbc"
+    "\xb9\xf0\x9c\xbc\xba\xf0\x9c\xbc\xbb\xf0\x9c\xbc\xbc\xf0\x9c\xbc\xbd\xf0\x9c\xbc\xbe\xf0\x9c\xbc"
+    "\xbf\xf0\x9c\xbd\x80\xf0\x9c\xbd\x81\xf0\x9c\xbd\x82\xf0\x9c\xbd\x83\xf0\x9c\xbd\x84\xf0\x9c\xbd"
+    "\x85\xf0\x9c\xbd\x86\xf0\x9d\x85\x97\xf0\x9d\x85\xa5\xf0\x9d\x85\x97\xf0\x9d\x85\x98\xf0\x9d\x85"
+    "\xa5\xf0\x9d\x85\x98\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xae\xf0\x9d\x85\x98\xf0\x9d\x85"
+    "\xa5\xf0\x9d\x85\xaf\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xb0\xf0\x9d\x85\x98\xf0\x9d\x85"
+    "\xa5\xf0\x9d\x85\xb1\xf0\x9d\x85\x98\xf0\x9d\x85\xa5\xf0\x9d\x85\xb2\xf0\x9d\x85\xa7\xf0\x9d\x85"
+    "\xa8\xf0\x9d\x85\xa9\xf0\x9d\x85\xbb\xf0\x9d\x85\xbc\xf0\x9d\x85\xbd\xf0\x9d\x85\xbe\xf0\x9d\x85"
+    "\xbf\xf0\x9d\x86\x80\xf0\x9d\x86\x81\xf0\x9d\x86\x82\xf0\x9d\x86\x85\xf0\x9d\x86\x86\xf0\x9d\x86"
+    "\x87\xf0\x9d\x86\x88\xf0\x9d\x86\x89\xf0\x9d\x86\x8a\xf0\x9d\x86\x8b\xf0\x9d\x86\xaa\xf0\x9d\x86"
+    "\xab\xf0\x9d\x86\xac\xf0\x9d\x86\xad\xf0\x9d\x86\xb9\xf0\x9d\x85\xa5\xf0\x9d\x86\xb9\xf0\x9d\x86"
+    "\xba\xf0\x9d\x85\xa5\xf0\x9d\x86\xba\xf0\x9d\x86\xb9\xf0\x9d\x85\xa5\xf0\x9d\x85\xae\xf0\x9d\x86"
+    "\xba\xf0\x9d\x85\xa5\xf0\x9d\x85\xae\xf0\x9d\x86\xb9\xf0\x9d\x85\xa5\xf0\x9d\x85\xaf\xf0\x9d\x86"
+    "\xba\xf0\x9d\x85\xa5\xf0\x9d\x85\xaf\xf0\x9d\x89\x82\xf0\x9d\x89\x83\xf0\x9d\x89\x84\xc4\xb1\xc8"
+    "\xb7\xe2\x88\x87\xe2\x88\x82\xf0\x9d\xa8\x80\xf0\x9d\xa8\x81\xf0\x9d\xa8\x82\xf0\x9d\xa8\x83\xf0"
+    "\x9d\xa8\x84\xf0\x9d\xa8\x85\xf0\x9d\xa8\x86\xf0\x9d\xa8\x87\xf0\x9d\xa8\x88\xf0\x9d\xa8\x89\xf0"
+    "\x9d\xa8\x8a\xf0\x9d\xa8\x8b\xf0\x9d\xa8\x8c\xf0\x9d\xa8\x8d\xf0\x9d\xa8\x8e\xf0\x9d\xa8\x8f\xf0"
+    "\x9d\xa8\x90\xf0\x9d\xa8\x91\xf0\x9d\xa8\x92\xf0\x9d\xa8\x93\xf0\x9d\xa8\x94\xf0\x9d\xa8\x95\xf0"
+    "\x9d\xa8\x96\xf0\x9d\xa8\x97\xf0\x9d\xa8\x98\xf0\x9d\xa8\x99\xf0\x9d\xa8\x9a\xf0\x9d\xa8\x9b\xf0"
+    "\x9d\xa8\x9c\xf0\x9d\xa8\x9d\xf0\x9d\xa8\x9e\xf0\x9d\xa8\x9f\xf0\x9d\xa8\xa0\xf0\x9d\xa8\xa1\xf0"
+    "\x9d\xa8\xa2\xf0\x9d\xa8\xa3\xf0\x9d\xa8\xa4\xf0\x9d\xa8\xa5\xf0\x9d\xa8\xa6\xf0\x9d\xa8\xa7\xf0"
+    "\x9d\xa8\xa8\xf0\x9d\xa8\xa9\xf0\x9d\xa8\xaa\xf0\x9d\xa8\xab\xf0\x9d\xa8\xac\xf0\x9d\xa8\xad\xf0"
+    "\x9d\xa8\xae\xf0\x9d\xa8\xaf\xf0\x9d\xa8\xb0\xf0\x9d\xa8\xb1\xf0\x9d\xa8\xb2\xf0\x9d\xa8\xb3\xf0"
+    "\x9d\xa8\xb4\xf0\x9d\xa8\xb5\xf0\x9d\xa8\xb6\xf0\x9d\xa8\xbb\xf0\x9d\xa8\xbc\xf0\x9d\xa8\xbd\xf0"
+    "\x9d\xa8\xbe\xf0\x9d\xa8\xbf\xf0\x9d\xa9\x80\xf0\x9d\xa9\x81\xf0\x9d\xa9\x82\xf0\x9d\xa9\x83\xf0"
+    "\x9d\xa9\x84\xf0\x9d\xa9\x85\xf0\x9d\xa9\x86\xf0\x9d\xa9\x87\xf0\x9d\xa9\x88\xf0\x9d\xa9\x89\xf0"
+    "\x9d\xa9\x8a\xf0\x9d\xa9\x8b\xf0\x9d\xa9\x8c\xf0\x9d\xa9\x8d\xf0\x9d\xa9\x8e\xf0\x9d\xa9\x8f\xf0"
+    "\x9d\xa9\x90\xf0\x9d\xa9\x91\xf0\x9d\xa9\x92\xf0\x9d\xa9\x93\xf0\x9d\xa9\x94\xf0\x9d\xa9\x95\xf0"
+    "\x9d\xa9\x96\xf0\x9d\xa9\x97\xf0\x9d\xa9\x98\xf0\x9d\xa9\x99\xf0\x9d\xa9\x9a\xf0\x9d\xa9\x9b\xf0"
+    "\x9d\xa9\x9c\xf0\x9d\xa9\x9d\xf0\x9d\xa9\x9e\xf0\x9d\xa9\x9f\xf0\x9d\xa9\xa0\xf0\x9d\xa9\xa1\xf0"
+    "\x9d\xa9\xa2\xf0\x9d\xa9\xa3\xf0\x9d\xa9\xa4\xf0\x9d\xa9\xa5\xf0\x9d\xa9\xa6\xf0\x9d\xa9\xa7\xf0"
+    "\x9d\xa9\xa8\xf0\x9d\xa9\xa9\xf0\x9d\xa9\xaa\xf0\x9d\xa9\xab\xf0\x9d\xa9\xac\xf0\x9d\xa9\xb5\xf0"
+    "\x9d\xaa\x84\xf0\x9d\xaa\x9b\xf0\x9d\xaa\x9c\xf0\x9d\xaa\x9d\xf0\x9d\xaa\x9e\xf0\x9d\xaa\x9f\xf0"
+    "\x9d\xaa\xa1\xf0\x9d\xaa\xa2\xf0\x9d\xaa\xa3\xf0\x9d\xaa\xa4\xf0\x9d\xaa\xa5\xf0\x9d\xaa\xa6\xf0"
+    "\x9d\xaa\xa7\xf0\x9d\xaa\xa8\xf0\x9d\xaa\xa9\xf0\x9d\xaa\xaa\xf0\x9d\xaa\xab\xf0\x9d\xaa\xac\xf0"
+    "\x9d\xaa\xad\xf0\x9d\xaa\xae\xf0\x9d\xaa\xaf\xf0\x9e\x80\x80\xf0\x9e\x80\x81\xf0\x9e\x80\x82\xf0"
+    "\x9e\x80\x83\xf0\x9e\x80\x84\xf0\x9e\x80\x85\xf0\x9e\x80\x86\xf0\x9e\x80\x88\xf0\x9e\x80\x89\xf0"
+    "\x9e\x80\x8a\xf0\x9e\x80\x8b\xf0\x9e\x80\x8c\xf0\x9e\x80\x8d\xf0\x9e\x80\x8e\xf0\x9e\x80\x8f\xf0"
+    "\x9e\x80\x90\xf0\x9e\x80\x91\xf0\x9e\x80\x92\xf0\x9e\x80\x93\xf0\x9e\x80\x94\xf0\x9e\x80\x95\xf0"
+    "\x9e\x80\x96\xf0\x9e\x80\x97\xf0\x9e\x80\x98\xf0\x9e\x80\x9b\xf0\x9e\x80\x9c\xf0\x9e\x80\x9d\xf0"
+    "\x9e\x80\x9e\xf0\x9e\x80\x9f\xf0\x9e\x80\xa0\xf0\x9e\x80\xa1\xf0\x9e\x80\xa3\xf0\x9e\x80\xa4\xf0"
+    "\x9e\x80\xa6\xf0\x9e\x80\xa7\xf0\x9e\x80\xa8\xf0\x9e\x80\xa9\xf0\x9e\x80\xaa\xf0\x9e\x84\xb0\xf0"
+    "\x9e\x84\xb1\xf0\x9e\x84\xb2\xf0\x9e\x84\xb3\xf0\x9e\x84\xb4\xf0\x9e\x84\xb5\xf0\x9e\x84\xb6\xf0"
+    "\x9e\x8a\xae\xf0\x9e\x8b\xac\xf0\x9e\x8b\xad\xf0\x9e\x8b\xae\xf0\x9e\x8b\xaf\xf0\x9e\xa3\x90\xf0"
+    "\x9e\xa3\x91\xf0\x9e\xa3\x92\xf0\x9e\xa3\x93\xf0\x9e\xa3\x94\xf0\x9e\xa3\x95\xf0\x9e\xa3\x96\xf0"
+    "\x9e\xa4\xa2\xf0\x9e\xa4\xa3\xf0\x9e\xa4\xa4\xf0\x9e\xa4\xa5\xf0\x9e\xa4\xa6\xf0\x9e\xa4\xa7\xf0"
+    "\x9e\xa4\xa8\xf0\x9e\xa4\xa9\xf0\x9e\xa4\xaa\xf0\x9e\xa4\xab\xf0\x9e\xa4\xac\xf0\x9e\xa4\xad\xf0"
+    "\x9e\xa4\xae\xf0\x9e\xa4\xaf\xf0\x9e\xa4\xb0\xf0\x9e\xa4\xb1\xf0\x9e\xa4\xb2\xf0\x9e\xa4\xb3\xf0"
+    "\x9e\xa4\xb4\xf0\x9e\xa4\xb5\xf0\x9e\xa4\xb6\xf0\x9e\xa4\xb7\xf0\x9e\xa4\xb8\xf0\x9e\xa4\xb9\xf0"
+    "\x9e\xa4\xba\xf0\x9e\xa4\xbb\xf0\x9e\xa4\xbc\xf0\x9e\xa4\xbd\xf0\x9e\xa4\xbe\xf0\x9e\xa4\xbf\xf0"
+    "\x9e\xa5\x80\xf0\x9e\xa5\x81\xf0\x9e\xa5\x82\xf0\x9e\xa5\x83\xf0\x9e\xa5\x84\xf0\x9e\xa5\x85\xf0"
+    "\x9e\xa5\x86\xf0\x9e\xa5\x87\xf0\x9e\xa5\x88\xf0\x9e\xa5\x89\xf0\x9e\xa5\x8a\xd9\xae\xda\xa1\xd9"
+    "\xaf\x30\x2e\x6f\x2e\x30\x2c\x6f\x2c\x31\x2c\x6c\x2c\x32\x2c\x33\x2c\x34\x2c\x35\x2c\x36\x2c\x37"
+    "\x2c\x38\x2c\x39\x2c\xe3\x80\x94\x73\xe3\x80\x95\x77\x7a\x68\x76\x73\x64\x70\x70\x76\x77\x63\x6d"
+    "\x63\x6d\x64\x6d\x72\x64\x6a\xe3\x81\xbb\xe3\x81\x8b\xe3\x82\xb3\xe3\x82\xb3\xe5\xad\x97\xe5\x8f"
+    "\x8c\xe3\x83\x87\xe5\xa4\x9a\xe8\xa7\xa3\xe4\xba\xa4\xe6\x98\xa0\xe7\x84\xa1\xe5\x89\x8d\xe5\xbe"
+    "\x8c\xe5\x86\x8d\xe6\x96\xb0\xe5\x88\x9d\xe7\xb5\x82\xe8\xb2\xa9\xe5\xa3\xb0\xe5\x90\xb9\xe6\xbc"
+    "\x94\xe6\x8a\x95\xe6\x8d\x95\xe9\x81\x8a\xe6\x8c\x87\xe6\x89\x93\xe7\xa6\x81\xe7\xa9\xba\xe5\x90"
+    "\x88\xe6\xba\x80\xe7\x94\xb3\xe5\x89\xb2\xe5\x96\xb6\xe9\x85\x8d\xe3\x80\x94\xe6\x9c\xac\xe3\x80"
+    "\x95\xe3\x80\x94\xe4\xb8\x89\xe3\x80\x95\xe3\x80\x94\xe4\xba\x8c\xe3\x80\x95\xe3\x80\x94\xe5\xae"
+    "\x89\xe3\x80\x95\xe3\x80\x94\xe7\x82\xb9\xe3\x80\x95\xe3\x80\x94\xe6\x89\x93\xe3\x80\x95\xe3\x80"
+    "\x94\xe7\x9b\x97\xe3\x80\x95\xe3\x80\x94\xe5\x8b\x9d\xe3\x80\x95\xe3\x80\x94\xe6\x95\x97\xe3\x80"
+    "\x95\xe5\xbe\x97\xe5\x8f\xaf\xe4\xb8\xbd\xe4\xb8\xb8\xe4\xb9\x81\xf0\xa0\x84\xa2\xe4\xbd\xa0\xe4"
+    "\xbe\xbb\xe5\x80\x82\xe5\x81\xba\xe5\x82\x99\xe5\x83\x8f\xe3\x92\x9e\xf0\xa0\x98\xba\xe5\x85\x94"
+    "\xe5\x85\xa4\xe5\x85\xb7\xf0\xa0\x94\x9c\xe3\x92\xb9\xe5\x85\xa7\xf0\xa0\x95\x8b\xe5\x86\x97\xe5"
+    "\x86\xa4\xe4\xbb\x8c\xe5\x86\xac\xf0\xa9\x87\x9f\xe5\x88\x83\xe3\x93\x9f\xe5\x88\xbb\xe5\x89\x86"
+    "\xe5\x89\xb7\xe3\x94\x95\xe5\x8c\x85\xe5\x8c\x86\xe5\x8d\x89\xe5\x8d\x9a\xe5\x8d\xb3\xe5\x8d\xbd"
+    "\xe5\x8d\xbf\xf0\xa0\xa8\xac\xe7\x81\xb0\xe5\x8f\x8a\xe5\x8f\x9f\xf0\xa0\xad\xa3\xe5\x8f\xab\xe5"
+    "\x8f\xb1\xe5\x90\x86\xe5\x92\x9e\xe5\x90\xb8\xe5\x91\x88\xe5\x91\xa8\xe5\x92\xa2\xe5\x93\xb6\xe5"
+    "\x94\x90\xe5\x95\x93\xe5\x95\xa3\xe5\x96\x84\xe5\x96\xab\xe5\x96\xb3\xe5\x97\x82\xe5\x9c\x96\xe5"
+    "\x9c\x97\xe5\x99\x91\xe5\x99\xb4\xe5\xa3\xae\xe5\x9f\x8e\xe5\x9f\xb4\xe5\xa0\x8d\xe5\x9e\x8b\xe5"
+    "\xa0\xb2\xe5\xa0\xb1\xe5\xa2\xac\xf0\xa1\x93\xa4\xe5\xa3\xb2\xe5\xa3\xb7\xe5\xa4\x86\xe5\xa4\xa2"
+    "\xe5\xa5\xa2\xf0\xa1\x9a\xa8\xf0\xa1\x9b\xaa\xe5\xa7\xac\xe5\xa8\x9b\xe5\xa8\xa7\xe5\xa7\x98\xe5"
+    "\xa9\xa6\xe3\x9b\xae\xe3\x9b\xbc\xe5\xac\x88\xe5\xac\xbe\xf0\xa1\xa7\x88\xe5\xaf\x83\xe5\xaf\x98"
+    "\xe5\xaf\xb3\xf0\xa1\xac\x98\xe5\xaf\xbf\xe5\xb0\x86\xe5\xbd\x93\xe3\x9e\x81\xe5\xb1\xa0\xe5\xb3"
+    "\x80\xe5\xb2\x8d\xf0\xa1\xb7\xa4\xe5\xb5\x83\xf0\xa1\xb7\xa6\xe5\xb5\xae\xe5\xb5\xab\xe5\xb5\xbc"
+    "\xe5\xb7\xa1\xe5\xb7\xa2\xe3\xa0\xaf\xe5\xb7\xbd\xe5\xb8\xa8\xe5\xb8\xbd\xe5\xb9\xa9\xe3\xa1\xa2"
+    "\xf0\xa2\x86\x83\xe3\xa1\xbc\xe5\xba\xb0\xe5\xba\xb3\xe5\xba\xb6\xf0\xaa\x8e\x92\xf0\xa2\x8c\xb1"
+    "\xe8\x88\x81\xe5\xbc\xa2\xe3\xa3\x87\xf0\xa3\x8a\xb8\xf0\xa6\x87\x9a\xe5\xbd\xa2\xe5\xbd\xab\xe3"
+    "\xa3\xa3\xe5\xbe\x9a\xe5\xbf\x8d\xe5\xbf\x97\xe5\xbf\xb9\xe6\x82\x81\xe3\xa4\xba\xe3\xa4\x9c\xf0"
+    "\xa2\x9b\x94\xe6\x83\x87\xe6\x85\x88\xe6\x85\x8c\xe6\x85\xba\xe6\x86\xb2\xe6\x86\xa4\xe6\x86\xaf"
+    "\xe6\x87\x9e\xe6\x88\x90\xe6\x88\x9b\xe6\x89\x9d\xe6\x8a\xb1\xe6\x8b\x94\xe6\x8d\x90\xf0\xa2\xac"
+    "\x8c\xe6\x8c\xbd\xe6\x8b\xbc\xe6\x8d\xa8\xe6\x8e\x83\xe6\x8f\xa4\xf0\xa2\xaf\xb1\xe6\x90\xa2\xe6"
+    "\x8f\x85\xe6\x8e\xa9\xe3\xa8\xae\xe6\x91\xa9\xe6\x91\xbe\xe6\x92\x9d\xe6\x91\xb7\xe3\xa9\xac\xe6"
+    "\x95\xac\xf0\xa3\x80\x8a\xe6\x97\xa3\xe6\x9b\xb8\xe6\x99\x89\xe3\xac\x99\xe3\xac\x88\xe3\xab\xa4"
+    "\xe5\x86\x92\xe5\x86\x95\xe6\x9c\x80\xe6\x9a\x9c\xe8\x82\xad\xe4\x8f\x99\xe6\x9c\xa1\xe6\x9d\x9e"
+    "\xe6\x9d\x93\xf0\xa3\x8f\x83\xe3\xad\x89\xe6\x9f\xba\xe6\x9e\x85\xe6\xa1\x92\xf0\xa3\x91\xad\xe6"
+    "\xa2\x8e\xe6\xa0\x9f\xe6\xa4\x94\xe6\xa5\x82\xe6\xa6\xa3\xe6\xa7\xaa\xe6\xaa\xa8\xf0\xa3\x9a\xa3"
+    "\xe6\xab\x9b\xe3\xb0\x98\xe6\xac\xa1\xf0\xa3\xa2\xa7\xe6\xad\x94\xe3\xb1\x8e\xe6\xad\xb2\xe6\xae"
+    "\x9f\xe6\xae\xbb\xf0\xa3\xaa\x8d\xf0\xa1\xb4\x8b\xf0\xa3\xab\xba\xe6\xb1\x8e\xf0\xa3\xb2\xbc\xe6"
+    "\xb2\xbf\xe6\xb3\x8d\xe6\xb1\xa7\xe6\xb4\x96\xe6\xb4\xbe\xe6\xb5\xa9\xe6\xb5\xb8\xe6\xb6\x85\xf0"
+    "\xa3\xb4\x9e\xe6\xb4\xb4\xe6\xb8\xaf\xe6\xb9\xae\xe3\xb4\xb3\xe6\xbb\x87\xf0\xa3\xbb\x91\xe6\xb7"
+    "\xb9\xe6\xbd\xae\xf0\xa3\xbd\x9e\xf0\xa3\xbe\x8e\xe6\xbf\x86\xe7\x80\xb9\xe7\x80\x9b\xe3\xb6\x96"
+    "\xe7\x81\x8a\xe7\x81\xbd\xe7\x81\xb7\xe7\x82\xad\xf0\xa0\x94\xa5\xe7\x85\x85\xf0\xa4\x89\xa3\xe7"
+    "\x86\x9c\xf0\xa4\x8e\xab\xe7\x88\xa8\xe7\x89\x90\xf0\xa4\x98\x88\xe7\x8a\x80\xe7\x8a\x95\xf0\xa4"
+    "\x9c\xb5\xf0\xa4\xa0\x94\xe7\x8d\xba\xe7\x8e\x8b\xe3\xba\xac\xe7\x8e\xa5\xe3\xba\xb8\xe7\x91\x87"
+    "\xe7\x91\x9c\xe7\x92\x85\xe7\x93\x8a\xe3\xbc\x9b\xe7\x94\xa4\xf0\xa4\xb0\xb6\xe7\x94\xbe\xf0\xa4"
+    "\xb2\x92\xf0\xa2\x86\x9f\xe7\x98\x90\xf0\xa4\xbe\xa1\xf0\xa4\xbe\xb8\xf0\xa5\x81\x84\xe3\xbf\xbc"
+    "\xe4\x80\x88\xf0\xa5\x83\xb3\xf0\xa5\x83\xb2\xf0\xa5\x84\x99\xf0\xa5\x84\xb3\xe7\x9c\x9e\xe7\x9c"
+    "\x9f\xe7\x9e\x8b\xe4\x81\x86\xe4\x82\x96\xf0\xa5\x90\x9d\xe7\xa1\x8e\xe4\x83\xa3\xf0\xa5\x98\xa6"
+    "\xf0\xa5\x9a\x9a\xf0\xa5\x9b\x85\xe7\xa7\xab\xe4\x84\xaf\xe7\xa9\x8a\xe7\xa9\x8f\xf0\xa5\xa5\xbc"
+    "\xf0\xa5\xaa\xa7\xe7\xab\xae\xe4\x88\x82\xf0\xa5\xae\xab\xe7\xaf\x86\xe7\xaf\x89\xe4\x88\xa7\xf0"
+    "\xa5\xb2\x80\xe7\xb3\x92\xe4\x8a\xa0\xe7\xb3\xa8\xe7\xb3\xa3\xe7\xb4\x80\xf0\xa5\xbe\x86\xe7\xb5"
+    "\xa3\xe4\x8c\x81\xe7\xb7\x87\xe7\xb8\x82\xe7\xb9\x85\xe4\x8c\xb4\xf0\xa6\x88\xa8\xf0\xa6\x89\x87"
+    "\xe4\x8d\x99\xf0\xa6\x8b\x99\xe7\xbd\xba\xf0\xa6\x8c\xbe\xe7\xbe\x95\xe7\xbf\xba\xf0\xa6\x93\x9a"
+    "\xf0\xa6\x94\xa3\xe8\x81\xa0\xf0\xa6\x96\xa8\xe8\x81\xb0\xf0\xa3\x8d\x9f\xe4\x8f\x95\xe8\x82\xb2"
+    "\xe8\x84\x83\xe4\x90\x8b\xe8\x84\xbe\xe5\xaa\xb5\xf0\xa6\x9e\xa7\xf0\xa6\x9e\xb5\xf0\xa3\x8e\x93"
+    "\xf0\xa3\x8e\x9c\xe8\x88\x84\xe8\xbe\x9e\xe4\x91\xab\xe8\x8a\x91\xe8\x8a\x8b\xe8\x8a\x9d\xe5\x8a"
+    "\xb3\xe8\x8a\xb1\xe8\x8a\xb3\xe8\x8a\xbd\xe8\x8b\xa6\xf0\xa6\xac\xbc\xe8\x8c\x9d\xe8\x8d\xa3\xe8"
+    "\x8e\xad\xe8\x8c\xa3\xe8\x8e\xbd\xe8\x8f\xa7\xe8\x8d\x93\xe8\x8f\x8a\xe8\x8f\x8c\xe8\x8f\x9c\xf0"
+    "\xa6\xb0\xb6\xf0\xa6\xb5\xab\xf0\xa6\xb3\x95\xe4\x94\xab\xe8\x93\xb1\xe8\x93\xb3\xe8\x94\x96\xf0"
+    "\xa7\x8f\x8a\xe8\x95\xa4\xf0\xa6\xbc\xac\xe4\x95\x9d\xe4\x95\xa1\xf0\xa6\xbe\xb1\xf0\xa7\x83\x92"
+    "\xe4\x95\xab\xe8\x99\x90\xe8\x99\xa7\xe8\x99\xa9\xe8\x9a\xa9\xe8\x9a\x88\xe8\x9c\x8e\xe8\x9b\xa2"
+    "\xe8\x9c\xa8\xe8\x9d\xab\xe8\x9e\x86\xe4\x97\x97\xe8\x9f\xa1\xe8\xa0\x81\xe4\x97\xb9\xe8\xa1\xa0"
+    "\xf0\xa7\x99\xa7\xe8\xa3\x97\xe8\xa3\x9e\xe4\x98\xb5\xe8\xa3\xba\xe3\x92\xbb\xf0\xa7\xa2\xae\xf0"
+    "\xa7\xa5\xa6\xe4\x9a\xbe\xe4\x9b\x87\xe8\xaa\xa0\xf0\xa7\xb2\xa8\xe8\xb2\xab\xe8\xb3\x81\xe8\xb4"
+    "\x9b\xe8\xb5\xb7\xf0\xa7\xbc\xaf\xf0\xa0\xa0\x84\xe8\xb7\x8b\xe8\xb6\xbc\xe8\xb7\xb0\xf0\xa0\xa3"
+    "\x9e\xe8\xbb\x94\xf0\xa8\x97\x92\xf0\xa8\x97\xad\xe9\x82\x94\xe9\x83\xb1\xe9\x84\x91\xf0\xa8\x9c"
+    "\xae\xe9\x84\x9b\xe9\x88\xb8\xe9\x8b\x97\xe9\x8b\x98\xe9\x89\xbc\xe9\x8f\xb9\xe9\x90\x95\xf0\xa8"
+    "\xaf\xba\xe9\x96\x8b\xe4\xa6\x95\xe9\x96\xb7\xf0\xa8\xb5\xb7\xe4\xa7\xa6\xe9\x9b\x83\xe5\xb6\xb2"
+    "\xe9\x9c\xa3\xf0\xa9\x85\x85\xf0\xa9\x88\x9a\xe4\xa9\xae\xe4\xa9\xb6\xe9\x9f\xa0\xf0\xa9\x90\x8a"
+    "\xe4\xaa\xb2\xf0\xa9\x92\x96\xe9\xa0\xa9\xf0\xa9\x96\xb6\xe9\xa3\xa2\xe4\xac\xb3\xe9\xa4\xa9\xe9"
+    "\xa6\xa7\xe9\xa7\x82\xe9\xa7\xbe\xe4\xaf\x8e\xf0\xa9\xac\xb0\xe9\xb1\x80\xe9\xb3\xbd\xe4\xb3\x8e"
+    "\xe4\xb3\xad\xe9\xb5\xa7\xf0\xaa\x83\x8e\xe4\xb3\xb8\xf0\xaa\x84\x85\xf0\xaa\x88\x8e\xf0\xaa\x8a"
+    "\x91\xe4\xb5\x96\xe9\xbb\xbe\xe9\xbc\x85\xe9\xbc\x8f\xe9\xbc\x96\xf0\xaa\x98\x80"
+    "";
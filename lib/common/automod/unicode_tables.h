@@ -0,0 +1,44 @@
+#ifndef SUDOBOT_AUTOMOD_UNICODE_TABLES_H
+#define SUDOBOT_AUTOMOD_UNICODE_TABLES_H
+
+#include <stdint.h>
+
+#define UNICODE_BLOCK_SHIFT 7
+#define UNICODE_BLOCK_SIZE (1 << UNICODE_BLOCK_SHIFT)
+#define UNICODE_MAX_CODEPOINT 0x10FFFF
+#define UNICODE_STAGE1_SIZE ((UNICODE_MAX_CODEPOINT + 1) >> UNICODE_BLOCK_SHIFT)
+
+#define UNICODE_NO_MAPPING 0xFFFF
+
+enum unicode_prop_flags
+{
+    UNICODE_PROP_MARK = 1,
+    UNICODE_PROP_IGNORABLE = 2,
+};
+
+/*
+ * Per code point properties. The fold and skeleton mappings are UTF-8
+ * byte ranges in unicode_mapping_data; an offset of UNICODE_NO_MAPPING
+ * means the code point maps to itself.
+ */
+struct unicode_props
+{
+    uint8_t flags;
+    uint8_t fold_length;
+    uint8_t skeleton_length;
+    uint16_t fold_offset;
+    uint16_t skeleton_offset;
+};
+
+extern const uint16_t unicode_stage1[UNICODE_STAGE1_SIZE];
+extern const uint16_t unicode_stage2[][UNICODE_BLOCK_SIZE];
+extern const struct unicode_props unicode_props[];
+extern const char unicode_mapping_data[];
+
+static inline const struct unicode_props *unicode_lookup(uint32_t codepoint)
+{
+    uint16_t block = unicode_stage1[codepoint >> UNICODE_BLOCK_SHIFT];
+    return &unicode_props[unicode_stage2[block][codepoint & (UNICODE_BLOCK_SIZE - 1)]];
+}
+
+#endif /* SUDOBOT_AUTOMOD_UNICODE_TABLES_H */
@@ -1,11 +1,17 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include <concord/discord.h>
 #include "io/log.h"
 
 #include "sudobot.h"
+#include "bridge.h"
+#include "ipc/event_bridge.h"
+#include "runtime.h"
+
+static sudobot_runtime_t *runtime = NULL;
 
 bool libsudobot_native_start(const char *token)
 {
@@ -16,4 +22,491 @@ bool libsudobot_native_start(const char *token)
     }
 
     return sudobot_start_with_token(token);
-}
\ No newline at end of file
+}
+
+static bool libsudobot_bridge_name_valid(const char *name)
+{
+    return name != NULL && name[0] != '\0' && strlen(name) <= EVENT_BRIDGE_NAME_MAX && strchr(name, '/') == NULL;
+}
+
+/*
+ * Starts the bot with the native side owning the gateway connection.
+ * MESSAGE_CREATE and INTERACTION_CREATE events are also published on the
+ * bridge rings; no other dispatch type is. Actions written back by the
+ * other side are executed through the REST scheduler.
+ */
+bool libsudobot_native_start_bridged(const char *token, const char *name)
+{
+    if (token == NULL || !libsudobot_bridge_name_valid(name))
+    {
+        log_error("%s(...): Token and a valid bridge name are required!", __func__);
+        return false;
+    }
+
+    event_bridge = event_bridge_create(name);
+
+    if (event_bridge == NULL)
+    {
+        log_error("%s(...): Failed to create bridge rings for `%s`", __func__, name);
+        return false;
+    }
+
+    return sudobot_start_with_token(token);
+}
+
+/*
+ * The functions below are used by the consumer side of the bridge (the
+ * N-API addon, or any other process) after the native side has started.
+ */
+
+bool libsudobot_bridge_attach(const char *name)
+{
+    if (!libsudobot_bridge_name_valid(name))
+        return false;
+
+    if (event_bridge != NULL)
+        return !event_bridge->owns_gateway;
+
+    event_bridge = event_bridge_attach(name);
+    return event_bridge != NULL;
+}
+
+/**
+ * @brief Copies the next event record into buffer, waiting up to timeout_ms.
+ * @return The payload length, 0 on timeout, or -1 if the buffer is too
+ * small (the record is kept) or the bridge is not attached.
+ */
+long libsudobot_bridge_read_event(void *buffer, size_t size, uint16_t *type, int timeout_ms)
+{
+    if (event_bridge == NULL || event_bridge->owns_gateway)
+        return -1;
+
+    const struct ipc_record *record = ipc_ring_peek(event_bridge->events);
+
+    if (record == NULL)
+    {
+        if (timeout_ms == 0 || !ipc_ring_wait(event_bridge->events, timeout_ms))
+            return 0;
+
+        record = ipc_ring_peek(event_bridge->events);
+
+        if (record == NULL)
+            return 0;
+    }
+
+    if (record->length > size)
+        return -1;
+
+    memcpy(buffer, ipc_record_payload(record), record->length);
+
+    if (type != NULL)
+        *type = record->type;
+
+    long length = (long) record->length;
+    ipc_ring_release(event_bridge->events, record);
+    return length;
+}
+
+bool libsudobot_bridge_submit_action(const struct bridge_action_record *action, const char *text)
+{
+    if (event_bridge == NULL || event_bridge->owns_gateway || action == NULL)
+        return false;
+
+    struct bridge_action_record record = *action;
+    record.text_length = text == NULL ? 0 : (uint32_t) strlen(text);
+
+    const void *parts[] = { &record, text };
+    const uint32_t lengths[] = { sizeof record, record.text_length };
+
+    return ipc_ring_writev(event_bridge->actions, BRIDGE_RECORD_ACTION, parts, lengths, 2);
+}
+
+uint64_t libsudobot_bridge_dropped_events()
+{
+    if (event_bridge == NULL)
+        return 0;
+
+    return ipc_ring_dropped(event_bridge->events);
+}
+
+void libsudobot_bridge_detach()
+{
+    if (event_bridge == NULL || event_bridge->owns_gateway)
+        return;
+
+    event_bridge_free(event_bridge);
+    event_bridge = NULL;
+}
+
+/*
+ * Batch verdicts: one call checks a whole columnar batch of messages, so
+ * callers cross the FFI boundary once per tick rather than once per check.
+ */
+
+size_t libsudobot_check_batch(const automod_batch_t *batch, automod_verdict_t *verdicts)
+{
+    if (batch == NULL || verdicts == NULL || batch->content_offsets == NULL ||
+        (batch->count > 0 && batch->content == NULL))
+        return 0;
+
+    return automod_batch_run(batch, verdicts);
+}
+
+size_t libsudobot_batch_size_hint()
+{
+    return automod_batch_size_hint();
+}
+
+void libsudobot_set_batch_budget_us(uint64_t budget_us)
+{
+    automod_batch_set_budget_us(budget_us);
+}
+
+/*
+ * Embedded runtime: the host polls the returned fd in its own event loop
+ * and calls libsudobot_runtime_poll() whenever it becomes readable.
+ */
+
+/**
+ * @brief Starts the bot without blocking.
+ * @return A pollable file descriptor, or -1 on failure.
+ */
+int libsudobot_runtime_start(const char *token)
+{
+    if (token == NULL)
+    {
+        log_error("%s(...): Token must not be null!", __func__);
+        return -1;
+    }
+
+    if (runtime == NULL && (runtime = sudobot_runtime_create()) == NULL)
+        return -1;
+
+    if (!sudobot_runtime_start(runtime, token))
+        return -1;
+
+    return sudobot_runtime_fd(runtime);
+}
+
+/**
+ * @return The runtime state after this step; see sudobot_runtime_state_t.
+ */
+int libsudobot_runtime_poll()
+{
+    if (runtime == NULL)
+        return SUDOBOT_RUNTIME_STOPPED;
+
+    return (int) sudobot_runtime_poll(runtime);
+}
+
+void libsudobot_runtime_stop()
+{
+    if (runtime != NULL)
+        sudobot_runtime_stop(runtime);
+}
+
+void libsudobot_runtime_free()
+{
+    sudobot_runtime_free(runtime);
+    runtime = NULL;
+}
+
+/*
+ * Local infraction store. Callers write through to it after committing to
+ * the database and read escalation counts from it. It only knows what was
+ * put or backfilled into it, so existing history has to be backfilled
+ * once before its counts can stand in for the database's.
+ * These return false/-1 when no store is configured.
+ */
+
+bool libsudobot_infraction_put(const infraction_t *infraction)
+{
+    if (infraction_store == NULL || infraction == NULL)
+        return false;
+
+    return infraction_store_append(infraction_store, infraction);
+}
+
+bool libsudobot_infraction_revoke(uint64_t guild_id, uint64_t user_id, uint64_t id)
+{
+    if (infraction_store == NULL)
+        return false;
+
+    return infraction_store_revoke(infraction_store, guild_id, user_id, id);
+}
+
+long libsudobot_infraction_backfill(const infraction_t *infractions, size_t count)
+{
+    if (infraction_store == NULL || (infractions == NULL && count > 0))
+        return -1;
+
+    return (long) infraction_store_backfill(infraction_store, infractions, count);
+}
+
+long libsudobot_infraction_count(uint64_t guild_id, uint64_t user_id, uint64_t from_ms, uint32_t type_mask)
+{
+    if (infraction_store == NULL)
+        return -1;
+
+    return (long) infraction_store_count(infraction_store, guild_id, user_id, from_ms, type_mask);
+}
+
+/*
+ * Message cache lookups for MESSAGE_DELETE and MESSAGE_UPDATE. Both copy the
+ * cached (pre-event) message out and then apply the event, so the caller
+ * can log what was deleted or what the content was before the edit.
+ */
+
+bool libsudobot_message_cache_on_delete(uint64_t channel_id, uint64_t message_id, cached_message_t *message,
+                                        char *content, size_t content_size)
+{
+    if (message_cache == NULL || message == NULL)
+        return false;
+
+    if (!message_cache_get(message_cache, channel_id, message_id, message, content, content_size))
+        return false;
+
+    message_cache_remove(message_cache, channel_id, message_id);
+    return true;
+}
+
+bool libsudobot_message_cache_on_update(uint64_t channel_id, uint64_t message_id, const char *new_content,
+                                        size_t new_content_length, cached_message_t *message, char *content,
+                                        size_t content_size)
+{
+    if (message_cache == NULL || message == NULL)
+        return false;
+
+    if (!message_cache_get(message_cache, channel_id, message_id, message, content, content_size))
+        return false;
+
+    if (new_content != NULL)
+        message_cache_update(message_cache, channel_id, message_id, new_content, new_content_length);
+
+    return true;
+}
+
+bool libsudobot_message_cache_stats(message_cache_stats_t *stats)
+{
+    if (message_cache == NULL || stats == NULL)
+        return false;
+
+    message_cache_get_stats(message_cache, stats);
+    return true;
+}
+
+/*
+ * Native permission engine, for the TS PermissionManagerService and
+ * automod exemption checks. A channel_id of 0 asks for guild-level
+ * permissions. When the engine is off or has not seen the guild, member
+ * or channel yet, these return false/-1 and the caller computes the answer
+ * itself.
+ */
+
+bool libsudobot_permissions_get(uint64_t guild_id, uint64_t user_id, uint64_t channel_id, uint64_t *result)
+{
+    if (permissions == NULL || result == NULL)
+        return false;
+
+    return permissions_compute(permissions, guild_id, user_id, channel_id, result);
+}
+
+int libsudobot_permissions_check(uint64_t guild_id, uint64_t user_id, uint64_t channel_id, uint64_t required)
+{
+    uint64_t result;
+
+    if (!libsudobot_permissions_get(guild_id, user_id, channel_id, &result))
+        return -1;
+
+    return (result & required) == required;
+}
+
+bool libsudobot_permissions_stats(permissions_stats_t *stats)
+{
+    if (permissions == NULL || stats == NULL)
+        return false;
+
+    permissions_get_stats(permissions, stats);
+    return true;
+}
+
+/*
+ * Guild member table, so the TS side need not keep every member of large
+ * guilds itself. libsudobot_members_scan() answers raid cleanup queries
+ * such as "joined in the last ten minutes, no roles" and returns -1 when
+ * the table is off; record role IDs are copied up to max_roles.
+ */
+
+bool libsudobot_member_get(uint64_t guild_id, uint64_t user_id, member_record_t *record, uint64_t *roles,
+                           size_t max_roles)
+{
+    if (member_table == NULL || record == NULL)
+        return false;
+
+    return member_table_get(member_table, guild_id, user_id, record, roles, max_roles);
+}
+
+long libsudobot_members_scan(uint64_t guild_id, const member_query_t *query, uint64_t *user_ids, size_t max,
+                             size_t *total)
+{
+    if (member_table == NULL || query == NULL || (user_ids == NULL && max != 0))
+        return -1;
+
+    return (long) member_table_scan(member_table, guild_id, query, user_ids, max, total);
+}
+
+bool libsudobot_member_table_stats(member_table_stats_t *stats)
+{
+    if (member_table == NULL || stats == NULL)
+        return false;
+
+    member_table_get_stats(member_table, stats);
+    return true;
+}
+
+/*
+ * Image attachment screening. The TS side first asks for a verdict by URL,
+ * which needs no download when the attachment was seen before; on a miss it
+ * decodes the thumbnail to raw pixels and passes them to
+ * libsudobot_image_check(). Both return -1 when the filter is off.
+ * libsudobot_image_hash() works without it, e.g. to fingerprint images
+ * being added to the known list.
+ */
+
+bool libsudobot_image_hash(const uint8_t *pixels, uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                           image_hash_t *hash)
+{
+    if (hash == NULL)
+        return false;
+
+    return image_hash_compute(pixels, width, height, stride, channels, hash);
+}
+
+int libsudobot_image_lookup(const char *url, size_t length, image_result_t *result)
+{
+    if (image_filter == NULL || url == NULL || result == NULL)
+        return -1;
+
+    return (int) image_filter_lookup(image_filter, url, length, result);
+}
+
+int libsudobot_image_check(const char *url, size_t length, const uint8_t *pixels, uint32_t width, uint32_t height,
+                           size_t stride, uint32_t channels, image_result_t *result)
+{
+    if (image_filter == NULL || result == NULL)
+        return -1;
+
+    return (int) image_filter_check(image_filter, url, length, pixels, width, height, stride, channels, result);
+}
+
+bool libsudobot_image_add_known(const image_hash_t *hash, uint64_t value)
+{
+    if (image_filter == NULL || hash == NULL)
+        return false;
+
+    return image_filter_add(image_filter, hash, value);
+}
+
+bool libsudobot_image_remove_known(const image_hash_t *hash)
+{
+    if (image_filter == NULL || hash == NULL)
+        return false;
+
+    return image_filter_remove(image_filter, hash);
+}
+
+bool libsudobot_image_stats(image_filter_stats_t *stats)
+{
+    if (image_filter == NULL || stats == NULL)
+        return false;
+
+    image_filter_get_stats(image_filter, stats);
+    return true;
+}
+
+/*
+ * Audit log posts for the TS AuditLoggingService and
+ * SystemAuditLoggingService. Records are packed per channel into as few
+ * messages as Discord allows and sent in order; emit returns false when
+ * the emitter is off or the record had to be dropped.
+ */
+
+bool libsudobot_audit_log_emit(uint64_t channel_id, const audit_log_record_t *record)
+{
+    if (audit_log == NULL || record == NULL)
+        return false;
+
+    return audit_log_emit(audit_log, channel_id, record);
+}
+
+bool libsudobot_audit_log_stats(audit_log_stats_t *stats)
+{
+    if (audit_log == NULL || stats == NULL)
+        return false;
+
+    audit_log_get_stats(audit_log, stats);
+    return true;
+}
+
+/*
+ * Timed moderation jobs for the TS QueueService: unmutes, unbans, role
+ * removals and reminders. The native side keeps them on its timing wheel
+ * and journal, so they survive restarts without database polling; the TS
+ * side polls for the jobs that came due and carries them out. The job ID
+ * of timer_job_t is ignored on schedule and assigned here.
+ */
+
+uint64_t libsudobot_timer_schedule(const timer_job_t *job)
+{
+    if (timers == NULL || job == NULL)
+        return 0;
+
+    return timers_schedule(timers, job);
+}
+
+bool libsudobot_timer_cancel(uint64_t id)
+{
+    if (timers == NULL)
+        return false;
+
+    return timers_cancel(timers, id);
+}
+
+size_t libsudobot_timer_poll(timer_job_t *jobs, size_t max)
+{
+    if (timers == NULL || jobs == NULL)
+        return 0;
+
+    return timers_poll(timers, jobs, max);
+}
+
+bool libsudobot_timer_stats(timers_stats_t *stats)
+{
+    if (timers == NULL || stats == NULL)
+        return false;
+
+    timers_get_stats(timers, stats);
+    return true;
+}
+
+/*
+ * Mention and ID parsing for TS commands, e.g. the argument list of a
+ * mass ban. Unlike the rest of the bridge these need no running subsystem.
+ */
+
+size_t libsudobot_mentions_extract(const char *content, size_t length, mention_t *mentions, size_t max,
+                                   size_t *total)
+{
+    if (content == NULL || (mentions == NULL && max != 0))
+        return 0;
+
+    return mentions_extract(content, length, mentions, max, total);
+}
+
+bool libsudobot_parse_target(const char *argument, size_t length, mention_t *target)
+{
+    if (argument == NULL || target == NULL)
+        return false;
+
+    return snowflake_parse_target(argument, length, target);
+}
@@ -2,7 +2,78 @@
 #define SUDOBOT_BRIDGE_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ipc/records.h"
+#include "automod/batch.h"
+#include "store/infractions.h"
+#include "cache/message_cache.h"
+#include "security/permissions.h"
+#include "cache/member_table.h"
+#include "media/image_filter.h"
+#include "rest/audit_log.h"
+#include "timers/timers.h"
+#include "utils/snowflake.h"
 
 bool libsudobot_native_start(const char *token);
+bool libsudobot_native_start_bridged(const char *token, const char *name);
 
-#endif /* SUDOBOT_BRIDGE_H */
\ No newline at end of file
+bool libsudobot_bridge_attach(const char *name);
+long libsudobot_bridge_read_event(void *buffer, size_t size, uint16_t *type, int timeout_ms);
+bool libsudobot_bridge_submit_action(const struct bridge_action_record *action, const char *text);
+uint64_t libsudobot_bridge_dropped_events();
+void libsudobot_bridge_detach();
+
+size_t libsudobot_check_batch(const automod_batch_t *batch, automod_verdict_t *verdicts);
+size_t libsudobot_batch_size_hint();
+void libsudobot_set_batch_budget_us(uint64_t budget_us);
+
+int libsudobot_runtime_start(const char *token);
+int libsudobot_runtime_poll();
+void libsudobot_runtime_stop();
+void libsudobot_runtime_free();
+
+bool libsudobot_infraction_put(const infraction_t *infraction);
+bool libsudobot_infraction_revoke(uint64_t guild_id, uint64_t user_id, uint64_t id);
+long libsudobot_infraction_backfill(const infraction_t *infractions, size_t count);
+long libsudobot_infraction_count(uint64_t guild_id, uint64_t user_id, uint64_t from_ms, uint32_t type_mask);
+
+bool libsudobot_message_cache_on_delete(uint64_t channel_id, uint64_t message_id, cached_message_t *message,
+                                        char *content, size_t content_size);
+bool libsudobot_message_cache_on_update(uint64_t channel_id, uint64_t message_id, const char *new_content,
+                                        size_t new_content_length, cached_message_t *message, char *content,
+                                        size_t content_size);
+bool libsudobot_message_cache_stats(message_cache_stats_t *stats);
+
+bool libsudobot_permissions_get(uint64_t guild_id, uint64_t user_id, uint64_t channel_id, uint64_t *result);
+int libsudobot_permissions_check(uint64_t guild_id, uint64_t user_id, uint64_t channel_id, uint64_t required);
+bool libsudobot_permissions_stats(permissions_stats_t *stats);
+
+bool libsudobot_member_get(uint64_t guild_id, uint64_t user_id, member_record_t *record, uint64_t *roles,
+                           size_t max_roles);
+long libsudobot_members_scan(uint64_t guild_id, const member_query_t *query, uint64_t *user_ids, size_t max,
+                             size_t *total);
+bool libsudobot_member_table_stats(member_table_stats_t *stats);
+
+bool libsudobot_image_hash(const uint8_t *pixels, uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                           image_hash_t *hash);
+int libsudobot_image_lookup(const char *url, size_t length, image_result_t *result);
+int libsudobot_image_check(const char *url, size_t length, const uint8_t *pixels, uint32_t width, uint32_t height,
+                           size_t stride, uint32_t channels, image_result_t *result);
+bool libsudobot_image_add_known(const image_hash_t *hash, uint64_t value);
+bool libsudobot_image_remove_known(const image_hash_t *hash);
+bool libsudobot_image_stats(image_filter_stats_t *stats);
+
+bool libsudobot_audit_log_emit(uint64_t channel_id, const audit_log_record_t *record);
+bool libsudobot_audit_log_stats(audit_log_stats_t *stats);
+
+uint64_t libsudobot_timer_schedule(const timer_job_t *job);
+bool libsudobot_timer_cancel(uint64_t id);
+size_t libsudobot_timer_poll(timer_job_t *jobs, size_t max);
+bool libsudobot_timer_stats(timers_stats_t *stats);
+
+size_t libsudobot_mentions_extract(const char *content, size_t length, mention_t *mentions, size_t max,
+                                   size_t *total);
+bool libsudobot_parse_target(const char *argument, size_t length, mention_t *target);
+
+#endif /* SUDOBOT_BRIDGE_H */
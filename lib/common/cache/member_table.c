@@ -0,0 +1,801 @@
+#include <string.h>
+#include <concord/discord.h>
+#include "member_table.h"
+#include "../utils/snowflake.h"
+#include "../utils/xmalloc.h"
+
+#define MEMBER_TABLE_MAP_MIN_CAPACITY 16
+#define MEMBER_TABLE_MIN_ARENA 4096
+#define MEMBER_TABLE_MIN_GARBAGE 65536
+/* Marks a staged entry whose member left again before the rebuild. */
+#define MEMBER_STAGED_REMOVED 0x80
+
+member_table_t *member_table = NULL;
+
+static uint64_t member_table_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static uint64_t *member_table_map_find(struct member_table_map *map, uint64_t key)
+{
+    if (map->capacity == 0)
+        return NULL;
+
+    for (size_t i = member_table_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+            return &map->values[i];
+
+        if (map->keys[i] == 0)
+            return NULL;
+    }
+}
+
+static void member_table_map_put(struct member_table_map *map, uint64_t key, uint64_t value);
+
+static void member_table_map_grow(struct member_table_map *map)
+{
+    struct member_table_map old = *map;
+
+    map->capacity = old.capacity == 0 ? MEMBER_TABLE_MAP_MIN_CAPACITY : old.capacity * 2;
+    map->keys = xcalloc(map->capacity, sizeof (*map->keys));
+    map->values = xcalloc(map->capacity, sizeof (*map->values));
+    map->length = 0;
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        if (old.keys[i] != 0)
+            member_table_map_put(map, old.keys[i], old.values[i]);
+    }
+
+    free(old.keys);
+    free(old.values);
+}
+
+static void member_table_map_put(struct member_table_map *map, uint64_t key, uint64_t value)
+{
+    if ((map->length + 1) * 4 > map->capacity * 3)
+        member_table_map_grow(map);
+
+    for (size_t i = member_table_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+        {
+            map->values[i] = value;
+            return;
+        }
+
+        if (map->keys[i] == 0)
+        {
+            map->keys[i] = key;
+            map->values[i] = value;
+            map->length++;
+            return;
+        }
+    }
+}
+
+member_table_t *member_table_init(void)
+{
+    member_table_t *table = xcalloc(1, sizeof (*table));
+
+    pthread_mutex_init(&table->lock, NULL);
+    return table;
+}
+
+static void member_guild_free_columns(member_guild_t *guild)
+{
+    free(guild->user_ids);
+    free(guild->joined_at);
+    free(guild->role_offsets);
+    free(guild->role_counts);
+    free(guild->removed);
+
+    for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+        free(guild->flags[flag]);
+}
+
+void member_table_free(member_table_t *table)
+{
+    for (size_t i = 0; i < table->guilds.capacity; i++)
+    {
+        if (table->guilds.keys[i] == 0)
+            continue;
+
+        member_guild_t *guild = (member_guild_t *) (uintptr_t) table->guilds.values[i];
+
+        member_guild_free_columns(guild);
+        free(guild->staged);
+        free(guild);
+    }
+
+    free(table->guilds.keys);
+    free(table->guilds.values);
+    free(table->role_arena);
+    pthread_mutex_destroy(&table->lock);
+    free(table);
+}
+
+static member_guild_t *member_table_guild_get(member_table_t *table, uint64_t guild_id, bool create)
+{
+    uint64_t *value = member_table_map_find(&table->guilds, guild_id);
+
+    if (value != NULL)
+        return (member_guild_t *) (uintptr_t) *value;
+
+    if (!create || guild_id == 0)
+        return NULL;
+
+    member_guild_t *guild = xcalloc(1, sizeof (*guild));
+
+    guild->id = guild_id;
+    member_table_map_put(&table->guilds, guild_id, (uint64_t) (uintptr_t) guild);
+    return guild;
+}
+
+static uint32_t member_table_seconds(uint64_t unix_ms)
+{
+    if (unix_ms <= SNOWFLAKE_EPOCH_MS)
+        return 0;
+
+    uint64_t seconds = (unix_ms - SNOWFLAKE_EPOCH_MS) / 1000;
+    return seconds < UINT32_MAX ? (uint32_t) seconds : UINT32_MAX;
+}
+
+static bool member_bit_get(const uint64_t *bits, size_t index)
+{
+    return (bits[index / 64] >> (index % 64)) & 1;
+}
+
+static void member_bit_set(uint64_t *bits, size_t index, bool value)
+{
+    if (value)
+        bits[index / 64] |= 1ULL << (index % 64);
+    else
+        bits[index / 64] &= ~(1ULL << (index % 64));
+}
+
+/*
+ * Stores a role set, sorted, over the member's current run when it fits
+ * and at the end of the arena otherwise. Role sets are never shared, so
+ * the old run simply becomes garbage.
+ */
+static void member_table_roles_store(member_table_t *table, const struct snowflakes *roles, uint32_t *offset,
+                                     uint8_t *count)
+{
+    size_t length = roles == NULL || roles->size < 0 ? 0 : (size_t) roles->size;
+
+    if (length > MEMBER_TABLE_MAX_ROLES)
+        length = MEMBER_TABLE_MAX_ROLES;
+
+    if (table->role_arena_length + length > UINT32_MAX)
+        length = 0;
+
+    if (length == 0)
+    {
+        table->role_arena_garbage += *count;
+        *count = 0;
+        return;
+    }
+
+    if (length > *count)
+    {
+        if (table->role_arena_length + length > table->role_arena_capacity)
+        {
+            size_t capacity = table->role_arena_capacity != 0 ? table->role_arena_capacity : MEMBER_TABLE_MIN_ARENA;
+
+            while (capacity < table->role_arena_length + length)
+                capacity *= 2;
+
+            table->role_arena = xrealloc(table->role_arena, sizeof (*table->role_arena) * capacity);
+            table->role_arena_capacity = capacity;
+        }
+
+        table->role_arena_garbage += *count;
+        *offset = (uint32_t) table->role_arena_length;
+        table->role_arena_length += length;
+    }
+    else
+    {
+        table->role_arena_garbage += *count - length;
+    }
+
+    uint64_t *run = table->role_arena + *offset;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        uint64_t role_id = roles->array[i];
+        size_t j = i;
+
+        while (j > 0 && run[j - 1] > role_id)
+        {
+            run[j] = run[j - 1];
+            j--;
+        }
+
+        run[j] = role_id;
+    }
+
+    *count = (uint8_t) length;
+}
+
+/* Rewrites the arena with only the runs members point at. */
+static void member_table_compact_roles(member_table_t *table)
+{
+    size_t capacity = MEMBER_TABLE_MIN_ARENA;
+    size_t used = 0;
+
+    for (size_t i = 0; i < table->guilds.capacity; i++)
+    {
+        if (table->guilds.keys[i] == 0)
+            continue;
+
+        const member_guild_t *guild = (const member_guild_t *) (uintptr_t) table->guilds.values[i];
+
+        for (size_t member = 0; member < guild->count; member++)
+            used += guild->role_counts[member];
+
+        for (size_t staged = 0; staged < guild->staged_count; staged++)
+            used += guild->staged[staged].role_count;
+    }
+
+    while (capacity < used)
+        capacity *= 2;
+
+    uint64_t *arena = xmalloc(sizeof (*arena) * capacity);
+    size_t length = 0;
+
+    for (size_t i = 0; i < table->guilds.capacity; i++)
+    {
+        if (table->guilds.keys[i] == 0)
+            continue;
+
+        member_guild_t *guild = (member_guild_t *) (uintptr_t) table->guilds.values[i];
+
+        for (size_t member = 0; member < guild->count; member++)
+        {
+            memcpy(arena + length, table->role_arena + guild->role_offsets[member],
+                   sizeof (*arena) * guild->role_counts[member]);
+            guild->role_offsets[member] = (uint32_t) length;
+            length += guild->role_counts[member];
+        }
+
+        for (size_t staged = 0; staged < guild->staged_count; staged++)
+        {
+            struct member_staged *entry = &guild->staged[staged];
+
+            memcpy(arena + length, table->role_arena + entry->role_offset, sizeof (*arena) * entry->role_count);
+            entry->role_offset = (uint32_t) length;
+            length += entry->role_count;
+        }
+    }
+
+    free(table->role_arena);
+    table->role_arena = arena;
+    table->role_arena_length = length;
+    table->role_arena_capacity = capacity;
+    table->role_arena_garbage = 0;
+    table->stats.compactions++;
+}
+
+static void member_table_maybe_compact(member_table_t *table)
+{
+    if (table->role_arena_garbage >= MEMBER_TABLE_MIN_GARBAGE &&
+        table->role_arena_garbage * 2 > table->role_arena_length)
+        member_table_compact_roles(table);
+}
+
+static int member_staged_compare(const void *a, const void *b)
+{
+    const struct member_staged *left = a;
+    const struct member_staged *right = b;
+
+    if (left->user_id != right->user_id)
+        return left->user_id < right->user_id ? -1 : 1;
+
+    return left->sequence < right->sequence ? -1 : left->sequence > right->sequence;
+}
+
+/*
+ * Merges the staged members into the sorted columns and drops removed
+ * ones, writing fresh columns. A member staged more than once keeps its
+ * last entry.
+ */
+static void member_guild_rebuild(member_table_t *table, member_guild_t *guild)
+{
+    size_t unique = 0;
+
+    if (guild->staged_count > 1)
+        qsort(guild->staged, guild->staged_count, sizeof (*guild->staged), &member_staged_compare);
+
+    for (size_t i = 0; i < guild->staged_count; i++)
+    {
+        if (i + 1 < guild->staged_count && guild->staged[i + 1].user_id == guild->staged[i].user_id)
+            table->role_arena_garbage += guild->staged[i].role_count;
+        else if (!(guild->staged[i].flags & MEMBER_STAGED_REMOVED))
+            guild->staged[unique++] = guild->staged[i];
+    }
+
+    member_guild_t old = *guild;
+    size_t count = old.count - old.removed_count + unique;
+    size_t capacity = (count + 63) & ~(size_t) 63;
+    size_t words = capacity / 64;
+
+    guild->count = 0;
+    guild->capacity = capacity;
+    guild->removed_count = 0;
+    guild->user_ids = xmalloc(sizeof (*guild->user_ids) * (capacity != 0 ? capacity : 1));
+    guild->joined_at = xmalloc(sizeof (*guild->joined_at) * (capacity != 0 ? capacity : 1));
+    guild->role_offsets = xmalloc(sizeof (*guild->role_offsets) * (capacity != 0 ? capacity : 1));
+    guild->role_counts = xmalloc(sizeof (*guild->role_counts) * (capacity != 0 ? capacity : 1));
+    guild->removed = xcalloc(words != 0 ? words : 1, sizeof (*guild->removed));
+
+    for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+        guild->flags[flag] = xcalloc(words != 0 ? words : 1, sizeof (*guild->flags[flag]));
+
+    size_t i = 0;
+    size_t j = 0;
+
+    while (i < old.count || j < unique)
+    {
+        if (i < old.count && member_bit_get(old.removed, i))
+        {
+            i++;
+            continue;
+        }
+
+        size_t index = guild->count++;
+
+        if (j >= unique || (i < old.count && old.user_ids[i] < guild->staged[j].user_id))
+        {
+            guild->user_ids[index] = old.user_ids[i];
+            guild->joined_at[index] = old.joined_at[i];
+            guild->role_offsets[index] = old.role_offsets[i];
+            guild->role_counts[index] = old.role_counts[i];
+
+            for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+                member_bit_set(guild->flags[flag], index, member_bit_get(old.flags[flag], i));
+
+            i++;
+        }
+        else
+        {
+            const struct member_staged *entry = &guild->staged[j++];
+
+            guild->user_ids[index] = entry->user_id;
+            guild->joined_at[index] = entry->joined_at;
+            guild->role_offsets[index] = entry->role_offset;
+            guild->role_counts[index] = entry->role_count;
+
+            for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+                member_bit_set(guild->flags[flag], index, (entry->flags >> flag) & 1);
+        }
+    }
+
+    /* Scans read whole blocks of 64; the tail must not look like members. */
+    memset(guild->joined_at + guild->count, 0, sizeof (*guild->joined_at) * (capacity - guild->count));
+    memset(guild->role_counts + guild->count, 0, sizeof (*guild->role_counts) * (capacity - guild->count));
+    member_guild_free_columns(&old);
+
+    guild->staged_count = 0;
+    table->stats.rebuilds++;
+    member_table_maybe_compact(table);
+}
+
+static void member_guild_maybe_rebuild(member_table_t *table, member_guild_t *guild)
+{
+    if (guild->staged_count >= MEMBER_TABLE_STAGE_LIMIT &&
+        guild->staged_count * MEMBER_TABLE_STAGE_RATIO >= guild->count - guild->removed_count)
+        member_guild_rebuild(table, guild);
+}
+
+/* Latest staged entry of the user, or NULL. */
+static struct member_staged *member_guild_find_staged(member_guild_t *guild, uint64_t user_id)
+{
+    for (size_t i = guild->staged_count; i > 0; i--)
+    {
+        if (guild->staged[i - 1].user_id == user_id)
+            return &guild->staged[i - 1];
+    }
+
+    return NULL;
+}
+
+/* Index of the user in the sorted columns, removed or not, or SIZE_MAX. */
+static size_t member_guild_find(const member_guild_t *guild, uint64_t user_id)
+{
+    size_t low = 0;
+    size_t high = guild->count;
+
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+
+        if (guild->user_ids[middle] < user_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low < guild->count && guild->user_ids[low] == user_id ? low : SIZE_MAX;
+}
+
+/* A zero joined_at keeps the member's current join time. */
+static void member_table_upsert(member_table_t *table, member_guild_t *guild, uint64_t user_id, uint32_t joined_at,
+                                const struct snowflakes *roles, uint8_t flags)
+{
+    size_t index = member_guild_find(guild, user_id);
+
+    if (index != SIZE_MAX)
+    {
+        if (member_bit_get(guild->removed, index))
+        {
+            member_bit_set(guild->removed, index, false);
+            guild->removed_count--;
+        }
+
+        if (joined_at != 0)
+            guild->joined_at[index] = joined_at;
+
+        for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+            member_bit_set(guild->flags[flag], index, (flags >> flag) & 1);
+
+        member_table_roles_store(table, roles, &guild->role_offsets[index], &guild->role_counts[index]);
+        return;
+    }
+
+    /* Without a join time the staged entry is updated; otherwise a new one supersedes it. */
+    struct member_staged *previous = joined_at == 0 ? member_guild_find_staged(guild, user_id) : NULL;
+
+    if (previous != NULL)
+    {
+        previous->flags = flags;
+        member_table_roles_store(table, roles, &previous->role_offset, &previous->role_count);
+        return;
+    }
+
+    if (guild->staged_count == guild->staged_capacity)
+    {
+        guild->staged_capacity = guild->staged_capacity != 0 ? guild->staged_capacity * 2 : MEMBER_TABLE_STAGE_LIMIT;
+        guild->staged = xrealloc(guild->staged, sizeof (*guild->staged) * guild->staged_capacity);
+    }
+
+    struct member_staged *entry = &guild->staged[guild->staged_count];
+
+    *entry = (struct member_staged) {
+        .user_id = user_id,
+        .joined_at = joined_at,
+        .sequence = (uint32_t) guild->staged_count,
+        .flags = flags,
+    };
+
+    member_table_roles_store(table, roles, &entry->role_offset, &entry->role_count);
+    guild->staged_count++;
+}
+
+static uint8_t member_table_member_flags(const struct discord_user *user, const char *avatar, bool pending)
+{
+    uint8_t flags = 0;
+
+    if (user->bot)
+        flags |= MEMBER_FLAG_BOT;
+
+    if (pending)
+        flags |= MEMBER_FLAG_PENDING;
+
+    if (user->avatar == NULL && avatar == NULL)
+        flags |= MEMBER_FLAG_NO_AVATAR;
+
+    return flags;
+}
+
+static void member_table_add_member(member_table_t *table, member_guild_t *guild,
+                                    const struct discord_guild_member *member)
+{
+    if (member->user == NULL || member->user->id == 0)
+        return;
+
+    member_table_upsert(table, guild, member->user->id, member_table_seconds(member->joined_at), member->roles,
+                        member_table_member_flags(member->user, member->avatar, member->pending));
+}
+
+void member_table_on_member_add(member_table_t *table, uint64_t guild_id, const struct discord_guild_member *member)
+{
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, guild_id, true);
+
+    if (guild != NULL)
+    {
+        member_table_add_member(table, guild, member);
+
+        member_guild_maybe_rebuild(table, guild);
+    }
+
+    pthread_mutex_unlock(&table->lock);
+}
+
+void member_table_on_member_update(member_table_t *table, const struct discord_guild_member_update *event)
+{
+    if (event->user == NULL || event->user->id == 0)
+        return;
+
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, event->guild_id, true);
+
+    if (guild != NULL)
+    {
+        member_table_upsert(table, guild, event->user->id, member_table_seconds(event->joined_at), event->roles,
+                            member_table_member_flags(event->user, event->avatar, event->pending));
+
+        member_guild_maybe_rebuild(table, guild);
+    }
+
+    pthread_mutex_unlock(&table->lock);
+}
+
+void member_table_on_member_remove(member_table_t *table, uint64_t guild_id, uint64_t user_id)
+{
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, guild_id, false);
+
+    if (guild != NULL)
+    {
+        size_t index = member_guild_find(guild, user_id);
+        struct member_staged *entry;
+
+        if (index != SIZE_MAX && !member_bit_get(guild->removed, index))
+        {
+            member_bit_set(guild->removed, index, true);
+            guild->removed_count++;
+            table->role_arena_garbage += guild->role_counts[index];
+            guild->role_counts[index] = 0;
+
+            if (guild->removed_count * 4 > guild->count)
+                member_guild_rebuild(table, guild);
+        }
+        else if ((entry = member_guild_find_staged(guild, user_id)) != NULL)
+        {
+            /* Only the latest entry counts; older ones are dropped by the rebuild anyway. */
+            entry->flags |= MEMBER_STAGED_REMOVED;
+            table->role_arena_garbage += entry->role_count;
+            entry->role_count = 0;
+        }
+    }
+
+    pthread_mutex_unlock(&table->lock);
+}
+
+/* Chunks are staged as a whole; a guild being loaded is rebuilt a logarithmic number of times. */
+/* GUILD_CREATE members and GUILD_MEMBERS_CHUNK both carry a batch of members without their guild ID. */
+void member_table_add_members(member_table_t *table, uint64_t guild_id, const struct discord_guild_members *members)
+{
+    if (members == NULL)
+        return;
+
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, guild_id, true);
+
+    if (guild != NULL)
+    {
+        for (int i = 0; i < members->size; i++)
+            member_table_add_member(table, guild, &members->array[i]);
+
+        member_guild_maybe_rebuild(table, guild);
+    }
+
+    pthread_mutex_unlock(&table->lock);
+}
+
+void member_table_on_members_chunk(member_table_t *table, const struct discord_guild_members_chunk *event)
+{
+    member_table_add_members(table, event->guild_id, event->members);
+}
+
+static void member_table_record_fill(const member_table_t *table, member_record_t *record, uint64_t *roles,
+                                     size_t max_roles, uint32_t joined_at, uint32_t role_offset, uint8_t role_count)
+{
+    record->joined_at_ms = joined_at != 0 ? SNOWFLAKE_EPOCH_MS + (uint64_t) joined_at * 1000 : 0;
+    record->role_count = role_count;
+
+    if (roles != NULL && role_count != 0)
+        memcpy(roles, table->role_arena + role_offset,
+               sizeof (*roles) * (role_count < max_roles ? role_count : max_roles));
+}
+
+bool member_table_get(member_table_t *table, uint64_t guild_id, uint64_t user_id, member_record_t *record,
+                      uint64_t *roles, size_t max_roles)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, guild_id, false);
+
+    if (guild != NULL)
+    {
+        size_t index = member_guild_find(guild, user_id);
+        const struct member_staged *entry;
+
+        record->user_id = user_id;
+        record->flags = 0;
+
+        if (index != SIZE_MAX && !member_bit_get(guild->removed, index))
+        {
+            for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+                record->flags |= (uint32_t) member_bit_get(guild->flags[flag], index) << flag;
+
+            member_table_record_fill(table, record, roles, max_roles, guild->joined_at[index],
+                                     guild->role_offsets[index], guild->role_counts[index]);
+            found = true;
+        }
+        else if ((entry = member_guild_find_staged(guild, user_id)) != NULL && !(entry->flags & MEMBER_STAGED_REMOVED))
+        {
+            record->flags = entry->flags;
+            member_table_record_fill(table, record, roles, max_roles, entry->joined_at, entry->role_offset,
+                                     entry->role_count);
+            found = true;
+        }
+    }
+
+    pthread_mutex_unlock(&table->lock);
+    return found;
+}
+
+/*
+ * Works through the columns 64 members at a time: the flag words narrow
+ * each block down first, then a branch-free pass over the join times and
+ * role counts, which the compiler vectorizes, decides the rest.
+ * Matches come out in user ID order.
+ */
+static size_t member_guild_scan(const member_guild_t *guild, const member_query_t *query, uint64_t *user_ids,
+                                size_t max, size_t *total)
+{
+    uint32_t after = 0;
+    uint32_t before = UINT32_MAX;
+    size_t matched = 0;
+
+    if (query->joined_after_ms != 0)
+    {
+        /* Join times are kept to the second, so this may take in a member from just before. */
+        after = member_table_seconds(query->joined_after_ms);
+        after = after != 0 ? after : 1;
+    }
+
+    if (query->joined_before_ms != 0)
+    {
+        before = member_table_seconds(query->joined_before_ms);
+
+        if (before == 0)
+            return 0;
+    }
+
+    if (before < after)
+        return 0;
+
+    uint32_t span = before - after;
+    uint32_t max_roles = query->max_roles;
+
+    for (size_t base = 0; base < guild->count; base += 64)
+    {
+        size_t word = base / 64;
+        size_t length = guild->count - base < 64 ? guild->count - base : 64;
+        uint64_t mask = (length == 64 ? UINT64_MAX : (1ULL << length) - 1) & ~guild->removed[word];
+
+        for (size_t flag = 0; flag < MEMBER_FLAG_COUNT; flag++)
+        {
+            if (query->required_flags & (1U << flag))
+                mask &= guild->flags[flag][word];
+
+            if (query->excluded_flags & (1U << flag))
+                mask &= ~guild->flags[flag][word];
+        }
+
+        if (mask == 0)
+            continue;
+
+        const uint32_t *joined_at = guild->joined_at + base;
+        const uint8_t *role_counts = guild->role_counts + base;
+        uint8_t keep[64];
+        uint64_t hits = 0;
+
+        for (size_t i = 0; i < 64; i++)
+            keep[i] = ((uint32_t) (joined_at[i] - after) <= span) & (role_counts[i] <= max_roles);
+
+        /* Eight 0/1 bytes, first in the lowest byte, to eight bits in one multiply. */
+        for (size_t i = 0; i < 64; i += 8)
+        {
+            uint64_t bytes;
+
+            memcpy(&bytes, keep + i, sizeof (bytes));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            bytes = __builtin_bswap64(bytes);
+#endif
+
+            hits |= ((bytes * 0x0102040810204080ULL) >> 56) << i;
+        }
+
+        mask &= hits;
+
+        while (mask != 0)
+        {
+            size_t index = base + (size_t) __builtin_ctzll(mask);
+
+            if (matched < max)
+                user_ids[matched] = guild->user_ids[index];
+
+            (*total)++;
+            matched += matched < max;
+            mask &= mask - 1;
+        }
+    }
+
+    return matched;
+}
+
+/**
+ * @brief Finds the members of a guild matching a query, e.g. everyone who
+ * joined in the last ten minutes and has no roles, for raid cleanup.
+ * Writes at most max user IDs; total receives the full match count.
+ */
+size_t member_table_scan(member_table_t *table, uint64_t guild_id, const member_query_t *query, uint64_t *user_ids,
+                         size_t max, size_t *total)
+{
+    size_t matched = 0;
+    size_t all = 0;
+
+    pthread_mutex_lock(&table->lock);
+
+    member_guild_t *guild = member_table_guild_get(table, guild_id, false);
+
+    if (guild != NULL)
+    {
+        if (guild->staged_count != 0)
+            member_guild_rebuild(table, guild);
+
+        matched = member_guild_scan(guild, query, user_ids, max, &all);
+    }
+
+    pthread_mutex_unlock(&table->lock);
+
+    if (total != NULL)
+        *total = all;
+
+    return matched;
+}
+
+void member_table_get_stats(member_table_t *table, member_table_stats_t *stats)
+{
+    pthread_mutex_lock(&table->lock);
+
+    *stats = table->stats;
+    stats->guilds = table->guilds.length;
+    stats->members = 0;
+    stats->role_arena_used = table->role_arena_length - table->role_arena_garbage;
+    stats->role_arena_garbage = table->role_arena_garbage;
+    stats->bytes = table->role_arena_capacity * sizeof (*table->role_arena) +
+                   table->guilds.capacity * (sizeof (*table->guilds.keys) + sizeof (*table->guilds.values));
+
+    for (size_t i = 0; i < table->guilds.capacity; i++)
+    {
+        if (table->guilds.keys[i] == 0)
+            continue;
+
+        const member_guild_t *guild = (const member_guild_t *) (uintptr_t) table->guilds.values[i];
+
+        stats->members += guild->count - guild->removed_count + guild->staged_count;
+        stats->bytes += sizeof (*guild) + guild->staged_capacity * sizeof (*guild->staged) +
+                        guild->capacity * (sizeof (*guild->user_ids) + sizeof (*guild->joined_at) +
+                                           sizeof (*guild->role_offsets) + sizeof (*guild->role_counts)) +
+                        guild->capacity / 64 * (MEMBER_FLAG_COUNT + 1) * sizeof (uint64_t);
+    }
+
+    pthread_mutex_unlock(&table->lock);
+}
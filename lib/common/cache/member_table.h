@@ -0,0 +1,133 @@
+#ifndef SUDOBOT_CACHE_MEMBER_TABLE_H
+#define SUDOBOT_CACHE_MEMBER_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define MEMBER_TABLE_MAX_ROLES 255
+#define MEMBER_TABLE_STAGE_LIMIT 256
+/* Staged members are merged in once they are this fraction (1/n) of the guild, so loading stays linear. */
+#define MEMBER_TABLE_STAGE_RATIO 8
+#define MEMBER_TABLE_ANY_ROLES UINT32_MAX
+
+enum member_flags
+{
+    MEMBER_FLAG_BOT = 1,
+    /* Has not passed membership screening yet. */
+    MEMBER_FLAG_PENDING = 2,
+    /* Neither a user nor a guild avatar. */
+    MEMBER_FLAG_NO_AVATAR = 4,
+};
+
+#define MEMBER_FLAG_COUNT 3
+
+/* u64 -> u64 open-addressing map; key 0 marks an empty slot. */
+struct member_table_map
+{
+    uint64_t *keys;
+    uint64_t *values;
+    size_t capacity;
+    size_t length;
+};
+
+/* A member added since the columns were last rebuilt. */
+struct member_staged
+{
+    uint64_t user_id;
+    uint32_t joined_at;
+    uint32_t role_offset;
+    /* Staging order; the latest entry for a user wins. */
+    uint32_t sequence;
+    uint8_t role_count;
+    uint8_t flags;
+};
+
+/*
+ * Members of one guild as columns, sorted by user ID. Each member has a
+ * join time in seconds since the Discord epoch and a sorted run of role
+ * IDs in the table's shared role arena; flags are one bitset per flag.
+ * Removed members stay in place, marked in `removed`, and new members are
+ * staged unsorted, until the next rebuild merges both away.
+ */
+typedef struct member_guild
+{
+    uint64_t id;
+    size_t count;
+    size_t capacity;
+    size_t removed_count;
+    uint64_t *user_ids;
+    uint32_t *joined_at;
+    uint32_t *role_offsets;
+    uint8_t *role_counts;
+    uint64_t *flags[MEMBER_FLAG_COUNT];
+    uint64_t *removed;
+    struct member_staged *staged;
+    size_t staged_count;
+    size_t staged_capacity;
+} member_guild_t;
+
+typedef struct member_record
+{
+    uint64_t user_id;
+    /* Unix time in milliseconds, to the second. */
+    uint64_t joined_at_ms;
+    uint32_t flags;
+    uint32_t role_count;
+} member_record_t;
+
+typedef struct member_query
+{
+    /* Unix milliseconds, inclusive; 0 for no bound. */
+    uint64_t joined_after_ms;
+    uint64_t joined_before_ms;
+    /* Members with more roles are skipped: 0 for no roles, MEMBER_TABLE_ANY_ROLES for no limit. */
+    uint32_t max_roles;
+    uint32_t required_flags;
+    uint32_t excluded_flags;
+} member_query_t;
+
+typedef struct member_table_stats
+{
+    size_t guilds;
+    size_t members;
+    size_t role_arena_used;
+    size_t role_arena_garbage;
+    size_t bytes;
+    uint64_t rebuilds;
+    uint64_t compactions;
+} member_table_stats_t;
+
+typedef struct member_table
+{
+    pthread_mutex_t lock;
+    /* guild ID -> member_guild_t * */
+    struct member_table_map guilds;
+    uint64_t *role_arena;
+    size_t role_arena_length;
+    size_t role_arena_capacity;
+    /* Arena entries no member points at any more. */
+    size_t role_arena_garbage;
+    member_table_stats_t stats;
+} member_table_t;
+
+extern member_table_t *member_table;
+
+member_table_t *member_table_init(void);
+void member_table_free(member_table_t *table);
+
+void member_table_on_member_add(member_table_t *table, uint64_t guild_id, const struct discord_guild_member *member);
+void member_table_on_member_update(member_table_t *table, const struct discord_guild_member_update *event);
+void member_table_on_member_remove(member_table_t *table, uint64_t guild_id, uint64_t user_id);
+void member_table_add_members(member_table_t *table, uint64_t guild_id, const struct discord_guild_members *members);
+void member_table_on_members_chunk(member_table_t *table, const struct discord_guild_members_chunk *event);
+
+bool member_table_get(member_table_t *table, uint64_t guild_id, uint64_t user_id, member_record_t *record,
+                      uint64_t *roles, size_t max_roles);
+size_t member_table_scan(member_table_t *table, uint64_t guild_id, const member_query_t *query, uint64_t *user_ids,
+                         size_t max, size_t *total);
+void member_table_get_stats(member_table_t *table, member_table_stats_t *stats);
+
+#endif /* SUDOBOT_CACHE_MEMBER_TABLE_H */
@@ -0,0 +1,955 @@
+#include <string.h>
+#include <concord/discord.h>
+#include "message_cache.h"
+#include "../io/log.h"
+#include "../store/snapshot.h"
+#include "../utils/trace.h"
+#include "../utils/xmalloc.h"
+
+#define MESSAGE_CACHE_MAP_MIN_CAPACITY 64
+
+message_cache_t *message_cache = NULL;
+
+static uint64_t message_cache_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static size_t message_cache_round_up(size_t value)
+{
+    size_t result = 1;
+
+    while (result < value)
+        result <<= 1;
+
+    return result;
+}
+
+static uint64_t *message_cache_map_find(struct message_cache_map *map, uint64_t key)
+{
+    if (map->capacity == 0)
+        return NULL;
+
+    for (size_t i = message_cache_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+            return &map->values[i];
+
+        if (map->keys[i] == 0)
+            return NULL;
+    }
+}
+
+static void message_cache_map_put(struct message_cache_map *map, uint64_t key, uint64_t value);
+
+static void message_cache_map_grow(struct message_cache_map *map)
+{
+    struct message_cache_map old = *map;
+
+    map->capacity = old.capacity == 0 ? MESSAGE_CACHE_MAP_MIN_CAPACITY : old.capacity * 2;
+    map->keys = xcalloc(map->capacity, sizeof (*map->keys));
+    map->values = xcalloc(map->capacity, sizeof (*map->values));
+    map->length = 0;
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        if (old.keys[i] != 0)
+            message_cache_map_put(map, old.keys[i], old.values[i]);
+    }
+
+    free(old.keys);
+    free(old.values);
+}
+
+static void message_cache_map_put(struct message_cache_map *map, uint64_t key, uint64_t value)
+{
+    if ((map->length + 1) * 4 > map->capacity * 3)
+        message_cache_map_grow(map);
+
+    for (size_t i = message_cache_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+        {
+            map->values[i] = value;
+            return;
+        }
+
+        if (map->keys[i] == 0)
+        {
+            map->keys[i] = key;
+            map->values[i] = value;
+            map->length++;
+            return;
+        }
+    }
+}
+
+/* Backward-shift deletion keeps probe chains intact without tombstones. */
+static void message_cache_map_remove(struct message_cache_map *map, uint64_t key)
+{
+    uint64_t *value = message_cache_map_find(map, key);
+
+    if (value == NULL)
+        return;
+
+    size_t mask = map->capacity - 1;
+    size_t hole = (size_t) (value - map->values);
+
+    for (size_t i = (hole + 1) & mask; map->keys[i] != 0; i = (i + 1) & mask)
+    {
+        size_t home = message_cache_hash(map->keys[i]) & mask;
+
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            map->keys[hole] = map->keys[i];
+            map->values[hole] = map->values[i];
+            hole = i;
+        }
+    }
+
+    map->keys[hole] = 0;
+    map->values[hole] = 0;
+    map->length--;
+}
+
+static void message_cache_map_free(struct message_cache_map *map)
+{
+    free(map->keys);
+    free(map->values);
+}
+
+message_cache_t *message_cache_init(const message_cache_config_t *config)
+{
+    message_cache_t *cache = xcalloc(1, sizeof (*cache));
+
+    cache->config = *config;
+
+    if (cache->config.guild_bytes == 0)
+        cache->config.guild_bytes = MESSAGE_CACHE_DEFAULT_GUILD_BYTES;
+
+    if (cache->config.channel_bytes == 0)
+        cache->config.channel_bytes = MESSAGE_CACHE_DEFAULT_CHANNEL_BYTES;
+
+    if (cache->config.channel_messages == 0)
+        cache->config.channel_messages = MESSAGE_CACHE_DEFAULT_CHANNEL_MESSAGES;
+
+    cache->config.channel_bytes = message_cache_round_up(cache->config.channel_bytes);
+    cache->config.channel_messages = message_cache_round_up(cache->config.channel_messages);
+    pthread_rwlock_init(&cache->lock, NULL);
+    return cache;
+}
+
+static void message_cache_channel_free(message_cache_channel_t *channel)
+{
+    free(channel->entries);
+    free(channel->arena);
+    free(channel->index);
+    free(channel);
+}
+
+void message_cache_free(message_cache_t *cache)
+{
+    message_cache_channel_t *channel = cache->lru_head;
+
+    while (channel != NULL)
+    {
+        message_cache_channel_t *next = channel->lru_next;
+        message_cache_channel_free(channel);
+        channel = next;
+    }
+
+    for (size_t i = 0; i < cache->guilds.capacity; i++)
+    {
+        if (cache->guilds.keys[i] != 0)
+            free((void *) (uintptr_t) cache->guilds.values[i]);
+    }
+
+    message_cache_map_free(&cache->channels);
+    message_cache_map_free(&cache->guilds);
+    message_cache_map_free(&cache->author_index);
+    free(cache->authors);
+    free(cache->author_free);
+    pthread_rwlock_destroy(&cache->lock);
+    free(cache);
+}
+
+static uint32_t message_cache_author_acquire(message_cache_t *cache, uint64_t author_id, const char *name)
+{
+    uint64_t *existing = message_cache_map_find(&cache->author_index, author_id);
+
+    if (existing != NULL)
+    {
+        cache->authors[*existing].refs++;
+        return (uint32_t) *existing;
+    }
+
+    uint32_t index;
+
+    if (cache->author_free_count > 0)
+    {
+        index = cache->author_free[--cache->author_free_count];
+    }
+    else
+    {
+        if (cache->author_count == cache->author_capacity)
+        {
+            cache->author_capacity = cache->author_capacity == 0 ? 256 : cache->author_capacity * 2;
+            cache->authors = xrealloc(cache->authors, cache->author_capacity * sizeof (*cache->authors));
+            cache->author_free = xrealloc(cache->author_free, cache->author_capacity * sizeof (*cache->author_free));
+        }
+
+        index = (uint32_t) cache->author_count++;
+    }
+
+    struct message_cache_author *author = &cache->authors[index];
+    size_t name_length = name == NULL ? 0 : strnlen(name, MESSAGE_CACHE_AUTHOR_NAME_MAX);
+
+    author->id = author_id;
+    author->refs = 1;
+    author->name_length = (uint8_t) name_length;
+    memcpy(author->name, name == NULL ? "" : name, name_length);
+    author->name[name_length] = 0;
+    message_cache_map_put(&cache->author_index, author_id, index);
+    return index;
+}
+
+static void message_cache_author_release(message_cache_t *cache, uint32_t index)
+{
+    if (index == MESSAGE_CACHE_NO_AUTHOR || --cache->authors[index].refs > 0)
+        return;
+
+    message_cache_map_remove(&cache->author_index, cache->authors[index].id);
+    cache->author_free[cache->author_free_count++] = index;
+}
+
+/* Guild ID 0 (DMs) doubles as the empty-slot key of the map, so DMs have no guild. */
+static struct message_cache_guild *message_cache_guild_get(message_cache_t *cache, uint64_t guild_id)
+{
+    uint64_t *value = guild_id == 0 ? NULL : message_cache_map_find(&cache->guilds, guild_id);
+    return value == NULL ? NULL : (struct message_cache_guild *) (uintptr_t) *value;
+}
+
+static size_t message_cache_channel_footprint(const message_cache_channel_t *channel)
+{
+    return sizeof (*channel) + channel->entry_capacity * sizeof (*channel->entries) + channel->arena_capacity +
+           channel->index_capacity * sizeof (*channel->index);
+}
+
+/* What a new channel takes before its first message; see message_cache_channel_create(). */
+static size_t message_cache_channel_min_footprint()
+{
+    return sizeof (message_cache_channel_t) + MESSAGE_CACHE_MIN_ENTRIES * sizeof (struct message_cache_entry) +
+           MESSAGE_CACHE_MIN_ARENA + MESSAGE_CACHE_MIN_ENTRIES * 2 * sizeof (uint64_t);
+}
+
+/* Charges the channel's current allocations to its guild and to the total. */
+static void message_cache_account(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    size_t footprint = message_cache_channel_footprint(channel);
+
+    cache->used_bytes = cache->used_bytes - channel->used_bytes + footprint;
+
+    if (channel->guild != NULL)
+        channel->guild->used_bytes = channel->guild->used_bytes - channel->used_bytes + footprint;
+
+    channel->used_bytes = footprint;
+}
+
+static struct message_cache_entry *message_cache_entry_at(message_cache_channel_t *channel, uint64_t sequence)
+{
+    return &channel->entries[sequence & (channel->entry_capacity - 1)];
+}
+
+/* Returns the index slot holding message_id, or the empty slot where it would go. */
+static uint64_t *message_cache_index_slot(message_cache_channel_t *channel, uint64_t message_id)
+{
+    size_t mask = channel->index_capacity - 1;
+
+    for (size_t i = message_cache_hash(message_id) & mask;; i = (i + 1) & mask)
+    {
+        if (channel->index[i] == 0 || message_cache_entry_at(channel, channel->index[i] - 1)->id == message_id)
+            return &channel->index[i];
+    }
+}
+
+static void message_cache_index_remove(message_cache_channel_t *channel, uint64_t *slot)
+{
+    size_t mask = channel->index_capacity - 1;
+    size_t hole = (size_t) (slot - channel->index);
+
+    for (size_t i = (hole + 1) & mask; channel->index[i] != 0; i = (i + 1) & mask)
+    {
+        uint64_t id = message_cache_entry_at(channel, channel->index[i] - 1)->id;
+        size_t home = message_cache_hash(id) & mask;
+
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            channel->index[hole] = channel->index[i];
+            hole = i;
+        }
+    }
+
+    channel->index[hole] = 0;
+}
+
+static void message_cache_index_rebuild(message_cache_channel_t *channel)
+{
+    free(channel->index);
+    channel->index_capacity = channel->entry_capacity * 2;
+    channel->index = xcalloc(channel->index_capacity, sizeof (*channel->index));
+
+    for (uint64_t sequence = channel->entry_tail; sequence != channel->entry_head; sequence++)
+    {
+        struct message_cache_entry *entry = message_cache_entry_at(channel, sequence);
+
+        if (!(entry->flags & MESSAGE_CACHE_ENTRY_DELETED))
+            *message_cache_index_slot(channel, entry->id) = sequence + 1;
+    }
+}
+
+/* Drops the oldest entry of the channel. */
+static void message_cache_evict_oldest(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    struct message_cache_entry *entry = message_cache_entry_at(channel, channel->entry_tail);
+
+    if (!(entry->flags & MESSAGE_CACHE_ENTRY_DELETED))
+    {
+        uint64_t *slot = message_cache_index_slot(channel, entry->id);
+
+        if (*slot == channel->entry_tail + 1)
+            message_cache_index_remove(channel, slot);
+    }
+
+    message_cache_author_release(cache, entry->author);
+    channel->content_bytes -= entry->content_length;
+    channel->arena_tail = entry->arena_offset + entry->content_length;
+    channel->entry_tail++;
+
+    if (channel->entry_tail == channel->entry_head)
+    {
+        channel->arena_tail = channel->arena_head;
+        TRACE_PROBE3(arena_reset, channel->id, channel->arena_capacity, 0UL);
+    }
+
+    cache->stats.evicted++;
+}
+
+static void message_cache_lru_unlink(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    if (channel->lru_prev != NULL)
+        channel->lru_prev->lru_next = channel->lru_next;
+    else
+        cache->lru_head = channel->lru_next;
+
+    if (channel->lru_next != NULL)
+        channel->lru_next->lru_prev = channel->lru_prev;
+    else
+        cache->lru_tail = channel->lru_prev;
+
+    channel->lru_prev = channel->lru_next = NULL;
+}
+
+static void message_cache_lru_push_front(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    channel->lru_next = cache->lru_head;
+
+    if (cache->lru_head != NULL)
+        cache->lru_head->lru_prev = channel;
+    else
+        cache->lru_tail = channel;
+
+    cache->lru_head = channel;
+}
+
+static void message_cache_channel_drop(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    struct message_cache_guild *guild = channel->guild;
+
+    while (channel->entry_tail != channel->entry_head)
+        message_cache_evict_oldest(cache, channel);
+
+    cache->used_bytes -= channel->used_bytes;
+
+    if (guild != NULL)
+    {
+        guild->used_bytes -= channel->used_bytes;
+
+        if (channel->guild_prev != NULL)
+            channel->guild_prev->guild_next = channel->guild_next;
+        else
+            guild->channels = channel->guild_next;
+
+        if (channel->guild_next != NULL)
+            channel->guild_next->guild_prev = channel->guild_prev;
+
+        if (guild->channels == NULL)
+        {
+            message_cache_map_remove(&cache->guilds, guild->id);
+            free(guild);
+        }
+    }
+
+    message_cache_lru_unlink(cache, channel);
+    message_cache_map_remove(&cache->channels, channel->id);
+    message_cache_channel_free(channel);
+}
+
+static message_cache_channel_t *message_cache_channel_get(message_cache_t *cache, uint64_t channel_id)
+{
+    uint64_t *value = message_cache_map_find(&cache->channels, channel_id);
+    return value == NULL ? NULL : (message_cache_channel_t *) (uintptr_t) *value;
+}
+
+static message_cache_channel_t *message_cache_channel_create(message_cache_t *cache, uint64_t channel_id,
+                                                             uint64_t guild_id)
+{
+    message_cache_channel_t *channel = xcalloc(1, sizeof (*channel));
+
+    channel->id = channel_id;
+    channel->guild_id = guild_id;
+    channel->entry_capacity = MESSAGE_CACHE_MIN_ENTRIES;
+    channel->entries = xcalloc(channel->entry_capacity, sizeof (*channel->entries));
+    channel->arena_capacity = MESSAGE_CACHE_MIN_ARENA;
+    channel->arena = xmalloc(channel->arena_capacity);
+    message_cache_index_rebuild(channel);
+    message_cache_map_put(&cache->channels, channel_id, (uint64_t) (uintptr_t) channel);
+    message_cache_lru_push_front(cache, channel);
+
+    if (guild_id != 0)
+    {
+        struct message_cache_guild *guild = message_cache_guild_get(cache, guild_id);
+
+        if (guild == NULL)
+        {
+            guild = xcalloc(1, sizeof (*guild));
+            guild->id = guild_id;
+            message_cache_map_put(&cache->guilds, guild_id, (uint64_t) (uintptr_t) guild);
+        }
+
+        channel->guild = guild;
+        channel->guild_next = guild->channels;
+
+        if (guild->channels != NULL)
+            guild->channels->guild_prev = channel;
+
+        guild->channels = channel;
+    }
+
+    message_cache_account(cache, channel);
+    return channel;
+}
+
+/* Moves the entries into an array of the given capacity, which must hold all of them. */
+static void message_cache_resize_entries(message_cache_channel_t *channel, size_t capacity)
+{
+    struct message_cache_entry *entries = xcalloc(capacity, sizeof (*entries));
+
+    for (uint64_t sequence = channel->entry_tail; sequence != channel->entry_head; sequence++)
+        entries[sequence & (capacity - 1)] = *message_cache_entry_at(channel, sequence);
+
+    free(channel->entries);
+    channel->entries = entries;
+    channel->entry_capacity = capacity;
+    message_cache_index_rebuild(channel);
+}
+
+/* Moves the content into an arena of the given capacity, packed at its start. */
+static void message_cache_resize_arena(message_cache_channel_t *channel, size_t capacity)
+{
+    unsigned char *arena = xmalloc(capacity);
+    uint64_t offset = 0;
+
+    for (uint64_t sequence = channel->entry_tail; sequence != channel->entry_head; sequence++)
+    {
+        struct message_cache_entry *entry = message_cache_entry_at(channel, sequence);
+
+        memcpy(arena + offset, channel->arena + (entry->arena_offset & (channel->arena_capacity - 1)),
+               entry->content_length);
+        entry->arena_offset = offset;
+        offset += entry->content_length;
+    }
+
+    free(channel->arena);
+    channel->arena = arena;
+    channel->arena_capacity = capacity;
+    channel->arena_tail = 0;
+    channel->arena_head = offset;
+    TRACE_PROBE3(arena_reset, channel->id, channel->arena_capacity, offset);
+}
+
+/* Returns where content of this length would be placed, or UINT64_MAX if it does not fit yet. */
+static uint64_t message_cache_arena_place(const message_cache_channel_t *channel, size_t length)
+{
+    uint64_t head = channel->arena_head;
+    uint64_t offset = head & (channel->arena_capacity - 1);
+
+    if (offset + length > channel->arena_capacity)
+        head += channel->arena_capacity - offset;
+
+    return head + length - channel->arena_tail <= channel->arena_capacity ? head : UINT64_MAX;
+}
+
+/* Halves the arrays of the channel for as long as what it holds fits in half of them. */
+static void message_cache_channel_shrink(message_cache_t *cache, message_cache_channel_t *channel)
+{
+    size_t entries = channel->entry_head - channel->entry_tail;
+    size_t entry_capacity = channel->entry_capacity;
+    size_t arena_capacity = channel->arena_capacity;
+
+    while (entry_capacity > MESSAGE_CACHE_MIN_ENTRIES && entries <= entry_capacity / 2)
+        entry_capacity /= 2;
+
+    while (arena_capacity > MESSAGE_CACHE_MIN_ARENA && channel->content_bytes <= arena_capacity / 2)
+        arena_capacity /= 2;
+
+    if (entry_capacity != channel->entry_capacity)
+        message_cache_resize_entries(channel, entry_capacity);
+
+    if (arena_capacity != channel->arena_capacity)
+        message_cache_resize_arena(channel, arena_capacity);
+
+    message_cache_account(cache, channel);
+}
+
+/*
+ * Frees memory held by victim: evicts its oldest messages until its arrays
+ * can shrink, or drops the channel once nothing is left in it.
+ */
+static void message_cache_reclaim(message_cache_t *cache, message_cache_channel_t *victim)
+{
+    size_t used_bytes = victim->used_bytes;
+
+    while (victim->entry_tail != victim->entry_head)
+    {
+        message_cache_evict_oldest(cache, victim);
+        message_cache_channel_shrink(cache, victim);
+
+        if (victim->used_bytes < used_bytes)
+            return;
+    }
+
+    message_cache_channel_drop(cache, victim);
+}
+
+/* The channel of the guild, other than current, holding the guild's oldest message. */
+static message_cache_channel_t *message_cache_guild_oldest(struct message_cache_guild *guild,
+                                                           const message_cache_channel_t *current)
+{
+    message_cache_channel_t *oldest = NULL;
+    uint64_t oldest_timestamp = UINT64_MAX;
+
+    for (message_cache_channel_t *channel = guild->channels; channel != NULL; channel = channel->guild_next)
+    {
+        if (channel == current)
+            continue;
+
+        if (channel->entry_tail == channel->entry_head)
+            return channel;
+
+        uint64_t timestamp = message_cache_entry_at(channel, channel->entry_tail)->timestamp;
+
+        if (oldest == NULL || timestamp < oldest_timestamp)
+        {
+            oldest = channel;
+            oldest_timestamp = timestamp;
+        }
+    }
+
+    return oldest;
+}
+
+/*
+ * Makes room for `bytes` more of allocations for current (NULL for a
+ * channel about to be created) under the guild and total budgets. Within
+ * the guild memory comes from the channel holding its oldest message, and
+ * overall from the least recently written channel; never from current.
+ */
+static bool message_cache_reserve(message_cache_t *cache, uint64_t guild_id, message_cache_channel_t *current,
+                                  size_t bytes)
+{
+    struct message_cache_guild *guild;
+
+    while ((guild = message_cache_guild_get(cache, guild_id)) != NULL &&
+           guild->used_bytes + bytes > cache->config.guild_bytes)
+    {
+        message_cache_channel_t *victim = message_cache_guild_oldest(guild, current);
+
+        if (victim == NULL)
+            return false;
+
+        message_cache_reclaim(cache, victim);
+    }
+
+    if (guild == NULL && guild_id != 0 && bytes > cache->config.guild_bytes)
+        return false;
+
+    while (cache->used_bytes + bytes > cache->config.total_bytes)
+    {
+        message_cache_channel_t *victim = cache->lru_tail;
+
+        if (victim == current)
+            victim = victim->lru_prev;
+
+        if (victim == NULL)
+            return false;
+
+        message_cache_reclaim(cache, victim);
+    }
+
+    return true;
+}
+
+static bool message_cache_insert_locked(message_cache_t *cache, uint64_t channel_id, uint64_t guild_id,
+                                        uint64_t message_id, uint32_t author, uint64_t timestamp,
+                                        const char *content, size_t content_length, uint32_t flags)
+{
+    message_cache_channel_t *channel = message_cache_channel_get(cache, channel_id);
+    size_t content_max = cache->config.channel_bytes / 4;
+
+    if (content_length > content_max)
+        content_length = content_max;
+
+
+    /* Messages only fill memory a channel already holds; growing it is what gets charged. */
+    if (channel == NULL)
+    {
+        if (!message_cache_reserve(cache, guild_id, NULL, message_cache_channel_min_footprint()))
+        {
+            message_cache_author_release(cache, author);
+            cache->stats.rejected++;
+            return false;
+        }
+
+        channel = message_cache_channel_create(cache, channel_id, guild_id);
+    }
+
+    if (channel->entry_head - channel->entry_tail == channel->entry_capacity)
+    {
+        size_t growth = channel->entry_capacity * (sizeof (*channel->entries) + 2 * sizeof (*channel->index));
+
+        if (channel->entry_capacity < cache->config.channel_messages &&
+            message_cache_reserve(cache, channel->guild_id, channel, growth))
+        {
+            message_cache_resize_entries(channel, channel->entry_capacity * 2);
+            message_cache_account(cache, channel);
+        }
+        else
+            message_cache_evict_oldest(cache, channel);
+    }
+
+    uint64_t offset;
+
+    while ((offset = message_cache_arena_place(channel, content_length)) == UINT64_MAX)
+    {
+        if (channel->arena_capacity < cache->config.channel_bytes &&
+            message_cache_reserve(cache, channel->guild_id, channel, channel->arena_capacity))
+        {
+            message_cache_resize_arena(channel, channel->arena_capacity * 2);
+            message_cache_account(cache, channel);
+        }
+        else if (channel->entry_tail != channel->entry_head)
+            message_cache_evict_oldest(cache, channel);
+        else
+            goto reject;
+    }
+
+    uint64_t *slot = message_cache_index_slot(channel, message_id);
+
+    /* An edit supersedes the previous version of the same message. */
+    if (*slot != 0)
+    {
+        message_cache_entry_at(channel, *slot - 1)->flags |= MESSAGE_CACHE_ENTRY_DELETED;
+        message_cache_index_remove(channel, slot);
+        slot = message_cache_index_slot(channel, message_id);
+    }
+
+    struct message_cache_entry *entry = message_cache_entry_at(channel, channel->entry_head);
+
+    memcpy(channel->arena + (offset & (channel->arena_capacity - 1)), content, content_length);
+    entry->id = message_id;
+    entry->timestamp = timestamp;
+    entry->arena_offset = offset;
+    entry->author = author;
+    entry->content_length = (uint32_t) content_length;
+    entry->flags = flags;
+    *slot = channel->entry_head + 1;
+    channel->entry_head++;
+    channel->arena_head = offset + content_length;
+    channel->content_bytes += content_length;
+
+    message_cache_lru_unlink(cache, channel);
+    message_cache_lru_push_front(cache, channel);
+    cache->stats.inserted++;
+    return true;
+
+reject:
+    message_cache_author_release(cache, author);
+    cache->stats.rejected++;
+
+    if (channel->entry_tail == channel->entry_head)
+        message_cache_channel_drop(cache, channel);
+
+    return false;
+}
+
+bool message_cache_insert(message_cache_t *cache, uint64_t channel_id, uint64_t guild_id, uint64_t message_id,
+                          uint64_t author_id, const char *author_name, uint64_t timestamp, const char *content,
+                          size_t content_length)
+{
+    pthread_rwlock_wrlock(&cache->lock);
+
+    uint32_t author = author_id == 0 ? MESSAGE_CACHE_NO_AUTHOR
+                                     : message_cache_author_acquire(cache, author_id, author_name);
+    bool ret = message_cache_insert_locked(cache, channel_id, guild_id, message_id, author, timestamp, content,
+                                           content_length, 0);
+
+    pthread_rwlock_unlock(&cache->lock);
+    return ret;
+}
+
+void message_cache_on_message(message_cache_t *cache, const struct discord_message *message)
+{
+    const char *content = message->content == NULL ? "" : message->content;
+
+    if (message->author != NULL && message->author->bot)
+        return;
+
+    message_cache_insert(cache, message->channel_id, message->guild_id, message->id,
+                         message->author == NULL ? 0 : message->author->id,
+                         message->author == NULL ? NULL : message->author->username, message->timestamp, content,
+                         strlen(content));
+}
+
+static struct message_cache_entry *message_cache_lookup(message_cache_t *cache, uint64_t channel_id,
+                                                        uint64_t message_id, message_cache_channel_t **channel_out)
+{
+    message_cache_channel_t *channel = message_cache_channel_get(cache, channel_id);
+
+    if (channel == NULL)
+        return NULL;
+
+    uint64_t *slot = message_cache_index_slot(channel, message_id);
+
+    if (*slot == 0)
+        return NULL;
+
+    *channel_out = channel;
+    return message_cache_entry_at(channel, *slot - 1);
+}
+
+/**
+ * @brief Copies a cached message out. Meant to be called when
+ * MESSAGE_DELETE or MESSAGE_UPDATE arrives, before the entry is dropped or
+ * replaced.
+ */
+bool message_cache_get(message_cache_t *cache, uint64_t channel_id, uint64_t message_id, cached_message_t *message,
+                       char *content, size_t content_size)
+{
+    message_cache_channel_t *channel = NULL;
+
+    pthread_rwlock_rdlock(&cache->lock);
+
+    const struct message_cache_entry *entry = message_cache_lookup(cache, channel_id, message_id, &channel);
+
+    if (entry == NULL)
+    {
+        pthread_rwlock_unlock(&cache->lock);
+        __atomic_fetch_add(&cache->stats.misses, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    const struct message_cache_author *author =
+        entry->author == MESSAGE_CACHE_NO_AUTHOR ? NULL : &cache->authors[entry->author];
+
+    message->id = entry->id;
+    message->channel_id = channel->id;
+    message->guild_id = channel->guild_id;
+    message->author_id = author == NULL ? 0 : author->id;
+    message->timestamp = entry->timestamp;
+    message->edited = (entry->flags & MESSAGE_CACHE_ENTRY_EDITED) != 0;
+    message->content_length = entry->content_length;
+    memcpy(message->author_name, author == NULL ? "" : author->name, author == NULL ? 1 : author->name_length + 1u);
+
+    if (content != NULL && content_size > 0)
+    {
+        size_t length = entry->content_length < content_size - 1 ? entry->content_length : content_size - 1;
+
+        memcpy(content, channel->arena + (entry->arena_offset & (channel->arena_capacity - 1)), length);
+        content[length] = 0;
+    }
+
+    pthread_rwlock_unlock(&cache->lock);
+    __atomic_fetch_add(&cache->stats.hits, 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+bool message_cache_update(message_cache_t *cache, uint64_t channel_id, uint64_t message_id, const char *content,
+                          size_t content_length)
+{
+    message_cache_channel_t *channel = NULL;
+    bool ret = false;
+
+    pthread_rwlock_wrlock(&cache->lock);
+
+    struct message_cache_entry *entry = message_cache_lookup(cache, channel_id, message_id, &channel);
+
+    if (entry != NULL)
+    {
+        uint32_t author = entry->author;
+
+        if (author != MESSAGE_CACHE_NO_AUTHOR)
+            cache->authors[author].refs++;
+
+        ret = message_cache_insert_locked(cache, channel_id, channel->guild_id, message_id, author, entry->timestamp,
+                                          content, content_length, MESSAGE_CACHE_ENTRY_EDITED);
+    }
+
+    pthread_rwlock_unlock(&cache->lock);
+    return ret;
+}
+
+/* Deleted messages stay in the ring, unreachable, until it wraps past them. */
+bool message_cache_remove(message_cache_t *cache, uint64_t channel_id, uint64_t message_id)
+{
+    message_cache_channel_t *channel;
+    bool ret = false;
+
+    pthread_rwlock_wrlock(&cache->lock);
+
+    if ((channel = message_cache_channel_get(cache, channel_id)) != NULL)
+    {
+        uint64_t *slot = message_cache_index_slot(channel, message_id);
+
+        if (*slot != 0)
+        {
+            message_cache_entry_at(channel, *slot - 1)->flags |= MESSAGE_CACHE_ENTRY_DELETED;
+            message_cache_index_remove(channel, slot);
+            ret = true;
+        }
+    }
+
+    pthread_rwlock_unlock(&cache->lock);
+    return ret;
+}
+
+void message_cache_get_stats(message_cache_t *cache, message_cache_stats_t *stats)
+{
+    pthread_rwlock_rdlock(&cache->lock);
+    *stats = cache->stats;
+    stats->channels = cache->channels.length;
+    stats->authors = cache->author_index.length;
+    stats->used_bytes = cache->used_bytes;
+    stats->messages = 0;
+
+    for (message_cache_channel_t *channel = cache->lru_head; channel != NULL; channel = channel->lru_next)
+        stats->messages += channel->entry_head - channel->entry_tail;
+
+    pthread_rwlock_unlock(&cache->lock);
+}
+
+/*
+ * Snapshot section: live messages, coldest channel first and oldest message
+ * first, so reinserting them rebuilds the same LRU and ring order.
+ */
+struct message_cache_snapshot_record
+{
+    uint64_t channel_id;
+    uint64_t guild_id;
+    uint64_t id;
+    uint64_t author_id;
+    uint64_t timestamp;
+    uint32_t flags;
+    uint16_t name_length;
+    uint16_t reserved;
+    uint32_t content_length;
+    uint32_t reserved2;
+    /* char name[name_length]; char content[content_length]; */
+};
+
+void message_cache_snapshot_save(snapshot_writer_t *writer)
+{
+    message_cache_t *cache = message_cache;
+
+    if (cache == NULL)
+        return;
+
+    pthread_rwlock_rdlock(&cache->lock);
+
+    for (message_cache_channel_t *channel = cache->lru_tail; channel != NULL; channel = channel->lru_prev)
+    {
+        for (uint64_t sequence = channel->entry_tail; sequence != channel->entry_head; sequence++)
+        {
+            const struct message_cache_entry *entry = message_cache_entry_at(channel, sequence);
+            const struct message_cache_author *author =
+                entry->author == MESSAGE_CACHE_NO_AUTHOR ? NULL : &cache->authors[entry->author];
+
+            if (entry->flags & MESSAGE_CACHE_ENTRY_DELETED)
+                continue;
+
+            struct message_cache_snapshot_record record = {
+                .channel_id = channel->id,
+                .guild_id = channel->guild_id,
+                .id = entry->id,
+                .author_id = author == NULL ? 0 : author->id,
+                .timestamp = entry->timestamp,
+                .flags = entry->flags,
+                .name_length = author == NULL ? 0 : author->name_length,
+                .content_length = entry->content_length,
+            };
+
+            snapshot_write(writer, &record, sizeof record);
+            snapshot_write(writer, author == NULL ? "" : author->name, record.name_length);
+            snapshot_write(writer, channel->arena + (entry->arena_offset & (channel->arena_capacity - 1)),
+                           entry->content_length);
+        }
+    }
+
+    pthread_rwlock_unlock(&cache->lock);
+}
+
+bool message_cache_snapshot_load(const void *data, size_t length, const snapshot_info_t *info)
+{
+    message_cache_t *cache = message_cache;
+    const unsigned char *cursor = data;
+    const unsigned char *end = cursor + length;
+    char name[MESSAGE_CACHE_AUTHOR_NAME_MAX + 1];
+    size_t restored = 0;
+
+    (void) info;
+
+    if (cache == NULL)
+        return false;
+
+    pthread_rwlock_wrlock(&cache->lock);
+
+    while ((size_t) (end - cursor) >= sizeof (struct message_cache_snapshot_record))
+    {
+        struct message_cache_snapshot_record record;
+
+        memcpy(&record, cursor, sizeof record);
+        cursor += sizeof record;
+
+        if (record.name_length > MESSAGE_CACHE_AUTHOR_NAME_MAX ||
+            (size_t) (end - cursor) < (size_t) record.name_length + record.content_length)
+            break;
+
+        memcpy(name, cursor, record.name_length);
+        name[record.name_length] = 0;
+        cursor += record.name_length;
+
+        uint32_t author = record.author_id == 0 ? MESSAGE_CACHE_NO_AUTHOR
+                                                : message_cache_author_acquire(cache, record.author_id, name);
+
+        restored += message_cache_insert_locked(cache, record.channel_id, record.guild_id, record.id, author,
+                                                record.timestamp, (const char *) cursor, record.content_length,
+                                                record.flags);
+        cursor += record.content_length;
+    }
+
+    pthread_rwlock_unlock(&cache->lock);
+    log_debug("message_cache: restored %zu message(s) from snapshot", restored);
+    return cursor == end;
+}
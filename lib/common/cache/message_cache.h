@@ -0,0 +1,169 @@
+#ifndef SUDOBOT_CACHE_MESSAGE_CACHE_H
+#define SUDOBOT_CACHE_MESSAGE_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define MESSAGE_CACHE_DEFAULT_GUILD_BYTES (8 * 1024 * 1024)
+#define MESSAGE_CACHE_DEFAULT_CHANNEL_BYTES (1024 * 1024)
+#define MESSAGE_CACHE_DEFAULT_CHANNEL_MESSAGES 4096
+#define MESSAGE_CACHE_MIN_ENTRIES 16
+#define MESSAGE_CACHE_MIN_ARENA 4096
+#define MESSAGE_CACHE_AUTHOR_NAME_MAX 32
+#define MESSAGE_CACHE_NO_AUTHOR UINT32_MAX
+
+enum message_cache_entry_flags
+{
+    MESSAGE_CACHE_ENTRY_DELETED = 1,
+    MESSAGE_CACHE_ENTRY_EDITED = 2,
+};
+
+/* u64 -> u64 open-addressing map; key 0 marks an empty slot. */
+struct message_cache_map
+{
+    uint64_t *keys;
+    uint64_t *values;
+    size_t capacity;
+    size_t length;
+};
+
+struct message_cache_entry
+{
+    uint64_t id;
+    uint64_t timestamp;
+    /* Monotonic byte offset of the content in the channel arena. */
+    uint64_t arena_offset;
+    uint32_t author;
+    uint32_t content_length;
+    uint32_t flags;
+};
+
+struct message_cache_guild;
+
+/*
+ * One ring per channel: entry metadata in a circular array, content in a
+ * circular byte arena, and a small hash from message ID to entry sequence.
+ * Sequences only grow; entry s lives at entries[s & (entry_capacity - 1)].
+ */
+typedef struct message_cache_channel
+{
+    uint64_t id;
+    uint64_t guild_id;
+    /* NULL for DMs, which only count against the total budget. */
+    struct message_cache_guild *guild;
+    struct message_cache_entry *entries;
+    size_t entry_capacity;
+    uint64_t entry_head;
+    uint64_t entry_tail;
+    unsigned char *arena;
+    size_t arena_capacity;
+    uint64_t arena_head;
+    uint64_t arena_tail;
+    /* Entry sequence + 1; 0 marks an empty slot. */
+    uint64_t *index;
+    size_t index_capacity;
+    /* Content bytes of the entries in the ring. */
+    size_t content_bytes;
+    /* Memory held by the channel, with its arrays at their allocated capacity. */
+    size_t used_bytes;
+    struct message_cache_channel *lru_prev;
+    struct message_cache_channel *lru_next;
+    struct message_cache_channel *guild_prev;
+    struct message_cache_channel *guild_next;
+} message_cache_channel_t;
+
+struct message_cache_guild
+{
+    uint64_t id;
+    size_t used_bytes;
+    message_cache_channel_t *channels;
+};
+
+struct message_cache_author
+{
+    uint64_t id;
+    uint32_t refs;
+    uint8_t name_length;
+    char name[MESSAGE_CACHE_AUTHOR_NAME_MAX + 1];
+};
+
+typedef struct message_cache_config
+{
+    size_t total_bytes;
+    size_t guild_bytes;
+    size_t channel_bytes;
+    size_t channel_messages;
+} message_cache_config_t;
+
+typedef struct message_cache_stats
+{
+    size_t channels;
+    size_t messages;
+    size_t authors;
+    size_t used_bytes;
+    uint64_t inserted;
+    uint64_t evicted;
+    uint64_t rejected;
+    uint64_t hits;
+    uint64_t misses;
+} message_cache_stats_t;
+
+typedef struct message_cache
+{
+    message_cache_config_t config;
+    pthread_rwlock_t lock;
+    /* channel ID -> message_cache_channel_t * */
+    struct message_cache_map channels;
+    /* guild ID -> struct message_cache_guild * */
+    struct message_cache_map guilds;
+    /* user ID -> index into authors */
+    struct message_cache_map author_index;
+    struct message_cache_author *authors;
+    size_t author_capacity;
+    size_t author_count;
+    uint32_t *author_free;
+    size_t author_free_count;
+    /* Most recently written channel first. */
+    message_cache_channel_t *lru_head;
+    message_cache_channel_t *lru_tail;
+    size_t used_bytes;
+    message_cache_stats_t stats;
+} message_cache_t;
+
+typedef struct cached_message
+{
+    uint64_t id;
+    uint64_t channel_id;
+    uint64_t guild_id;
+    uint64_t author_id;
+    uint64_t timestamp;
+    char author_name[MESSAGE_CACHE_AUTHOR_NAME_MAX + 1];
+    bool edited;
+    /* Full length; at most the buffer size is copied. */
+    size_t content_length;
+} cached_message_t;
+
+extern message_cache_t *message_cache;
+
+message_cache_t *message_cache_init(const message_cache_config_t *config);
+void message_cache_free(message_cache_t *cache);
+bool message_cache_insert(message_cache_t *cache, uint64_t channel_id, uint64_t guild_id, uint64_t message_id,
+                          uint64_t author_id, const char *author_name, uint64_t timestamp, const char *content,
+                          size_t content_length);
+void message_cache_on_message(message_cache_t *cache, const struct discord_message *message);
+bool message_cache_get(message_cache_t *cache, uint64_t channel_id, uint64_t message_id, cached_message_t *message,
+                       char *content, size_t content_size);
+bool message_cache_update(message_cache_t *cache, uint64_t channel_id, uint64_t message_id, const char *content,
+                          size_t content_length);
+bool message_cache_remove(message_cache_t *cache, uint64_t channel_id, uint64_t message_id);
+void message_cache_get_stats(message_cache_t *cache, message_cache_stats_t *stats);
+
+struct snapshot_writer;
+struct snapshot_info;
+void message_cache_snapshot_save(struct snapshot_writer *writer);
+bool message_cache_snapshot_load(const void *data, size_t length, const struct snapshot_info *info);
+
+#endif /* SUDOBOT_CACHE_MESSAGE_CACHE_H */
@@ -6,7 +6,8 @@
 #include "../commands/settings/about.h"
 
 static struct command_info const command_list[] = {
-    { "about", &command_about, CMD_MODE_BASIC, "Shows information about the bot", DISCORD_APPLICATION_CHAT_INPUT },
+    { "about", &command_about, CMD_MODE_BASIC, "Shows information about the bot", DISCORD_APPLICATION_CHAT_INPUT, 5000,
+      NULL },
 };
 
 static size_t command_count = sizeof (command_list) / sizeof (command_list[0]);
@@ -8,21 +8,28 @@
 #include "../../utils/defs.h"
 #include "../../utils/utils.h"
 #include "../../io/printf.h"
+#include "../../rest/scheduler.h"
 
-void command_about(struct discord *client, cmdctx_t context)
+struct about_state
 {
-    struct discord_user user = { 0 };
-    struct discord_ret_user ret_user = {
-        .sync = &user
-    };
-    
-    discord_get_current_user(client, &ret_user);
+    const struct discord_user *user;
+};
+
+static void command_about_reply(struct discord *client, cmd_async_t *async)
+{
+    struct about_state *state = async->data;
+    cmdctx_t context = async->context;
+    const struct discord_user *user = state->user;
+    const char *avatar = user->avatar;
+    char *icon_url = NULL;
 
-    const char *avatar = user.avatar;
-    bool avatar_is_animated = avatar[0] == 'a' && avatar[1] == '_';
-    const char *avatar_extension = avatar_is_animated ? "gif" : "png";
-    char *icon_url = casprintf("https://cdn.discordapp.com/avatars/%lu/%s.%s",
-                              user.id, avatar, avatar_extension);
+    if (avatar != NULL)
+    {
+        bool avatar_is_animated = avatar[0] == 'a' && avatar[1] == '_';
+        const char *avatar_extension = avatar_is_animated ? "gif" : "png";
+        icon_url = casprintf("https://cdn.discordapp.com/avatars/%lu/%s.%s",
+                             user->id, avatar, avatar_extension);
+    }
 
     struct discord_embed_field embed_fields[] = {
         { .name = "Version", .value = SUDOBOT_VERSION, .Inline = true },
@@ -67,7 +74,7 @@ See the " SUDOBOT_LICENSE_MD_LINK " for more detailed information.\n",
             },
         };
 
-        discord_create_message(client, context.message->channel_id, &params, NULL);
+        rest_create_message(client, context.message->channel_id, &params, REST_PRIORITY_REPLY);
     }
     else
     {
@@ -78,8 +85,22 @@ See the " SUDOBOT_LICENSE_MD_LINK " for more detailed information.\n",
             }
         };
 
-        discord_create_interaction_response(client, context.interaction->id, context.interaction->token, &params, NULL);
+        rest_create_interaction_response(client, context.interaction->id, context.interaction->token, &params);
     }
 
     dealloc(icon_url);
 }
+
+static void command_about_fetch(struct discord *client, cmd_async_t *async)
+{
+    (void) client;
+    struct about_state *state = async->data;
+
+    cmd_async_get_current_user(async, &state->user);
+    cmd_async_then(async, &command_about_reply);
+}
+
+void command_about(struct discord *client, cmdctx_t context)
+{
+    cmd_async_start(client, context, sizeof (struct about_state), &command_about_fetch);
+}
@@ -2,10 +2,16 @@
 #include <string.h>
 #include <ctype.h>
 #include <assert.h>
+#include <stdio.h>
 #include "command.h"
 #include "../utils/strutils.h"
 #include "../utils/xmalloc.h"
 #include "../io/log.h"
+#include "../metrics/metrics.h"
+#include "../rest/scheduler.h"
+#include "../timers/timers.h"
+#include "../utils/trace.h"
+#include "../utils/utils.h"
 #include "../commands/commands.h"
 
 static void command_argv_create(const char *content, size_t *_argc, char ***_argv)
@@ -69,7 +75,7 @@ static void command_argv_print(size_t argc, char **argv)
 #endif
 }
 
-#define PREFIX "-"
+#define PREFIX COMMAND_PREFIX
 
 const struct command_info *command_find_by_name(const char *name)
 {
@@ -84,15 +90,37 @@ const struct command_info *command_find_by_name(const char *name)
     return NULL;
 }
 
+/*
+ * Starts the user's cooldown on the command, or returns false (and the time
+ * left in remaining_ms) while it is still running. Commands dispatch freely
+ * when the timers are not running.
+ */
+static bool command_cooldown_acquire(const struct command_info *command, uint64_t user_id, uint64_t *remaining_ms)
+{
+    if (command->cooldown_ms == 0 || timers == NULL)
+        return true;
+
+    if (timers_cooldown_acquire(timers, (size_t) (command - command_list), user_id, command->cooldown_ms,
+                                remaining_ms))
+        return true;
+
+    TRACE_PROBE3(cooldown_rejected, command->name, user_id, *remaining_ms);
+    log_debug("Command %s is on cooldown for user %lu (%lu ms left)", command->name, user_id, *remaining_ms);
+    return false;
+}
+
 void command_on_interaction_handler(struct discord *client, const struct discord_interaction *interaction)
 {
     if (interaction->type != DISCORD_INTERACTION_APPLICATION_COMMAND)
         return;
 
+    uint64_t started_at = get_monotonic_time_ns();
     const char *command_name = interaction->data->name;
 
     const struct command_info *command = command_find_by_name(command_name);
-    
+
+    TRACE_PROBE2(command_resolved, command_name, command == NULL ? -1L : (long) (command - command_list));
+
     if (command == NULL)
     {
         log_debug("Command not found: %s", command_name);
@@ -104,6 +132,29 @@ void command_on_interaction_handler(struct discord *client, const struct discord
         return;
     }
 
+    uint64_t user_id = interaction->member != NULL ? interaction->member->user->id : interaction->user->id;
+    uint64_t remaining_ms;
+
+    if (!command_cooldown_acquire(command, user_id, &remaining_ms))
+    {
+        char content[128];
+
+        snprintf(content, sizeof content, "This command is on cooldown. Try again in %lu second(s).",
+                 (remaining_ms + 999) / 1000);
+
+        struct discord_interaction_response params = {
+            .type = DISCORD_INTERACTION_CHANNEL_MESSAGE_WITH_SOURCE,
+            .data = & (struct discord_interaction_callback_data) {
+                .content = content,
+                .flags = DISCORD_MESSAGE_EPHEMERAL
+            }
+        };
+
+        rest_create_interaction_response(client, interaction->id, interaction->token, &params);
+        metrics_record_handler(METRICS_HANDLER_COMMAND_INTERACTION, started_at);
+        return;
+    }
+
     cmd_callback_t callback = command->callback;
 
     cmdctx_t context = {
@@ -115,16 +166,46 @@ void command_on_interaction_handler(struct discord *client, const struct discord
         .interaction = interaction
     };
 
+    uint64_t callback_started_at = get_monotonic_time_ns();
+
+    TRACE_PROBE2(callback_start, command->name, context.type);
     callback(client, context);
+    TRACE_PROBE2(callback_end, command->name, callback_started_at);
+    metrics_record_command((size_t) (command - command_list), command->name, callback_started_at);
+    metrics_record_handler(METRICS_HANDLER_COMMAND_INTERACTION, started_at);
+}
+
+/* Replies to a legacy command whose arguments did not parse, pointing at where they went wrong. */
+static void command_reply_args_error(struct discord *client, const struct discord_message *message,
+                                     const struct command_info *command, const cmd_args_result_t *result)
+{
+    char content[REST_MESSAGE_CONTENT_MAX + 1];
+
+    command_args_format_error(command->args, result, message->content, strlen(message->content), content,
+                              sizeof (content));
+
+    struct discord_create_message params = {
+        .content = content,
+        .message_reference = & (struct discord_message_reference) {
+            .channel_id = message->channel_id,
+            .fail_if_not_exists = false,
+            .guild_id = message->guild_id,
+            .message_id = message->id,
+        },
+    };
+
+    rest_create_message(client, message->channel_id, &params, REST_PRIORITY_REPLY);
 }
 
 void command_on_message_handler(struct discord *client, const struct discord_message *message)
 {
     if (message->author->bot || !str_starts_with(message->content, PREFIX))
     {
+        TRACE_PROBE2(prefix_rejected, message->id, message->author->bot);
         return;
     }
 
+    uint64_t started_at = get_monotonic_time_ns();
     size_t prefix_len = strlen(PREFIX);
     assert(prefix_len != 0 && "Prefix cannot be an empty string");
     const char *content = message->content + prefix_len;
@@ -136,7 +217,9 @@ void command_on_message_handler(struct discord *client, const struct discord_mes
 
     const char *command_name = argv[0];
     const struct command_info *command = command_find_by_name(command_name);
-    
+
+    TRACE_PROBE2(command_resolved, command_name, command == NULL ? -1L : (long) (command - command_list));
+
     if (command == NULL)
     {
         log_debug("Command not found: %s", command_name);
@@ -148,6 +231,35 @@ void command_on_message_handler(struct discord *client, const struct discord_mes
         goto command_on_message_handler_end;
     }
 
+    /* Legacy commands on cooldown are ignored silently, so spamming them does not spam replies. */
+    uint64_t remaining_ms;
+
+    if (!command_cooldown_acquire(command, message->author->id, &remaining_ms))
+        goto command_on_message_handler_end;
+
+    _Alignas (max_align_t) unsigned char args[COMMAND_ARGS_MAX_SIZE];
+
+    if (command->args != NULL)
+    {
+        size_t args_offset = prefix_len;
+        cmd_args_result_t result;
+
+        assert(command->args->size <= sizeof (args) && "Argument struct larger than COMMAND_ARGS_MAX_SIZE");
+
+        while (isspace((unsigned char) message->content[args_offset]))
+            args_offset++;
+
+        args_offset += strlen(command_name);
+
+        if (!command_args_parse(command->args, message->content, strlen(message->content), args_offset, args,
+                                &result))
+        {
+            TRACE_PROBE3(args_rejected, command->name, result.arg, result.offset);
+            command_reply_args_error(client, message, command, &result);
+            goto command_on_message_handler_end;
+        }
+    }
+
     cmd_callback_t callback = command->callback;
 
     cmdctx_t context = {
@@ -159,12 +271,20 @@ void command_on_message_handler(struct discord *client, const struct discord_mes
         .argv = (const char **)argv,
         .command_name = command_name,
         .message = message,
+        .args = command->args != NULL ? args : NULL,
+        .args_size = command->args != NULL ? command->args->size : 0,
     };
 
+    uint64_t callback_started_at = get_monotonic_time_ns();
+
+    TRACE_PROBE2(callback_start, command->name, context.type);
     callback(client, context);
+    TRACE_PROBE2(callback_end, command->name, callback_started_at);
+    metrics_record_command((size_t) (command - command_list), command->name, callback_started_at);
 
 command_on_message_handler_end:
     command_argv_free(argc, argv);
+    metrics_record_handler(METRICS_HANDLER_COMMAND_MESSAGE, started_at);
 }
 
 void register_slash_commands(struct discord *client, u64snowflake guild)
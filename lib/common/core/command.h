@@ -1,9 +1,13 @@
 #ifndef SUDOBOT_CORE_COMMAND_H
 #define SUDOBOT_CORE_COMMAND_H
 
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <stdbool.h>
 #include <concord/discord.h>
+#include "command_args.h"
+
+#define COMMAND_PREFIX "-"
 
 #define CMD_MODE_INTERACTION (CMD_MODE_CHAT_INPUT_COMMAND_INTERACTION | CMD_MODE_CONTEXT_MENU_INTERACTION)
 #define CMD_MODE_ALL (CMD_MODE_INTERACTION | CMD_MODE_LEGACY)
@@ -31,6 +35,9 @@ typedef struct sudobot_command_context
     const char *command_name;
     size_t argc;
     const char **argv;
+    /* Legacy commands with an argument layout: the parsed values, args_size bytes. */
+    const void *args;
+    size_t args_size;
 } cmdctx_t;
 
 typedef void (*cmd_callback_t)(struct discord *, cmdctx_t);
@@ -49,10 +56,52 @@ struct command_info
     int mode;
     const char *description;
     enum discord_application_command_types type;
+    /* Per-user cooldown, checked against the timing wheel before dispatch; 0 for none. */
+    uint64_t cooldown_ms;
+    /* Arguments of the legacy form, parsed before dispatch; NULL to leave them to the command. */
+    const cmd_args_t *args;
+};
+
+struct cmd_async_request;
+typedef struct sudobot_command_async cmd_async_t;
+typedef void (*cmd_async_step_t)(struct discord *, cmd_async_t *);
+
+/*
+ * State of an asynchronous command. A step issues any number of REST
+ * requests through the cmd_async_get_* functions and names the step to
+ * continue with through cmd_async_then(); the continuation runs once
+ * every request of the step has completed, on whichever thread completed
+ * the last one. When a step does not set a continuation the chain ends
+ * and everything below is released, including the claimed event and all
+ * claimed request results.
+ */
+struct sudobot_command_async
+{
+    struct discord *client;
+    cmdctx_t context;
+    void *data;
+    _Atomic size_t pending;
+    cmd_async_step_t next;
+    cmd_async_step_t on_error;
+    _Atomic bool failed;
+    _Atomic CCORDcode error;
+    struct cmd_async_request *_Atomic requests;
+    char **argv;
 };
 
 void command_on_message_handler(struct discord *client, const struct discord_message *message);
 void register_slash_commands(struct discord *client, u64snowflake guild);
 void command_on_interaction_handler(struct discord *client, const struct discord_interaction *interaction);
 
+void cmd_async_start(struct discord *client, cmdctx_t context, size_t data_size, cmd_async_step_t step);
+void cmd_async_set_offline(bool offline);
+void cmd_async_then(cmd_async_t *async, cmd_async_step_t next);
+void cmd_async_catch(cmd_async_t *async, cmd_async_step_t on_error);
+void cmd_async_get_current_user(cmd_async_t *async, const struct discord_user **result);
+void cmd_async_get_user(cmd_async_t *async, u64snowflake user_id, const struct discord_user **result);
+void cmd_async_get_guild(cmd_async_t *async, u64snowflake guild_id, const struct discord_guild **result);
+void cmd_async_get_channel(cmd_async_t *async, u64snowflake channel_id, const struct discord_channel **result);
+void cmd_async_get_guild_member(cmd_async_t *async, u64snowflake guild_id, u64snowflake user_id,
+                                const struct discord_guild_member **result);
+
 #endif /* SUDOBOT_CORE_COMMAND_H */
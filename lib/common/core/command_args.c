@@ -0,0 +1,453 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "command_args.h"
+#include "../utils/snowflake.h"
+
+/* Bytes of context shown on each side of the offending token in error replies. */
+#define COMMAND_ARGS_ERROR_CONTEXT 32
+
+struct command_duration_unit
+{
+    const char *name;
+    uint8_t length;
+    uint64_t ms;
+};
+
+static const struct command_duration_unit command_duration_units[] = {
+    { "ms", 2, 1 },
+    { "s", 1, 1000 },
+    { "sec", 3, 1000 },
+    { "secs", 4, 1000 },
+    { "second", 6, 1000 },
+    { "seconds", 7, 1000 },
+    { "m", 1, 60 * 1000 },
+    { "min", 3, 60 * 1000 },
+    { "mins", 4, 60 * 1000 },
+    { "minute", 6, 60 * 1000 },
+    { "minutes", 7, 60 * 1000 },
+    { "h", 1, 60 * 60 * 1000 },
+    { "hr", 2, 60 * 60 * 1000 },
+    { "hrs", 3, 60 * 60 * 1000 },
+    { "hour", 4, 60 * 60 * 1000 },
+    { "hours", 5, 60 * 60 * 1000 },
+    { "d", 1, 24 * 60 * 60 * 1000 },
+    { "day", 3, 24 * 60 * 60 * 1000 },
+    { "days", 4, 24 * 60 * 60 * 1000 },
+    { "w", 1, 7 * 24 * 60 * 60 * 1000 },
+    { "week", 4, 7 * 24 * 60 * 60 * 1000 },
+    { "weeks", 5, 7 * 24 * 60 * 60 * 1000 },
+};
+
+static const char *const command_args_expected[] = {
+    [CMD_ARG_SNOWFLAKE] = "an ID",
+    [CMD_ARG_USER] = "a user mention or ID",
+    [CMD_ARG_CHANNEL] = "a channel mention or ID",
+    [CMD_ARG_ROLE] = "a role mention or ID",
+    [CMD_ARG_INTEGER] = "a whole number",
+    [CMD_ARG_DURATION] = "a duration such as 1d2h30m",
+    [CMD_ARG_WORD] = "a word",
+    [CMD_ARG_REST] = "some text",
+};
+
+static bool command_args_is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static bool command_args_is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+#ifndef NDEBUG
+static size_t command_args_value_size(cmd_arg_type_t type)
+{
+    switch (type)
+    {
+        case CMD_ARG_INTEGER:
+            return sizeof (int64_t);
+
+        case CMD_ARG_WORD:
+        case CMD_ARG_REST:
+            return sizeof (cmd_text_t);
+
+        default:
+            return sizeof (uint64_t);
+    }
+}
+#endif
+
+/**
+ * @brief Parses an optionally signed decimal integer spanning the whole string.
+ */
+cmd_args_error_t command_parse_integer(const char *str, size_t length, int64_t *value)
+{
+    size_t i = 0;
+    bool negative = false, overflow = false;
+    uint64_t magnitude = 0;
+
+    if (length > 0 && (str[0] == '-' || str[0] == '+'))
+    {
+        negative = str[0] == '-';
+        i = 1;
+    }
+
+    if (i == length)
+        return CMD_ARGS_INVALID;
+
+    for (; i < length; i++)
+    {
+        if (!command_args_is_digit(str[i]))
+            return CMD_ARGS_INVALID;
+
+        unsigned int digit = (unsigned int) (str[i] - '0');
+
+        if (magnitude > (UINT64_MAX - digit) / 10)
+            overflow = true;
+        else
+            magnitude = magnitude * 10 + digit;
+    }
+
+    uint64_t limit = negative ? (uint64_t) INT64_MAX + 1 : (uint64_t) INT64_MAX;
+
+    if (overflow || magnitude > limit)
+        return CMD_ARGS_OUT_OF_RANGE;
+
+    *value = !negative ? (int64_t) magnitude : magnitude == limit ? INT64_MIN : -(int64_t) magnitude;
+    return CMD_ARGS_OK;
+}
+
+static const struct command_duration_unit *command_duration_unit_find(const char *name, size_t length)
+{
+    for (size_t i = 0; i < sizeof (command_duration_units) / sizeof (command_duration_units[0]); i++)
+    {
+        const struct command_duration_unit *unit = &command_duration_units[i];
+
+        if (unit->length == length && strncasecmp(unit->name, name, length) == 0)
+            return unit;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Parses a duration made of one or more amounts with units, such as
+ * "90s", "1d2h30m" or "2weeks", spanning the whole string.
+ */
+cmd_args_error_t command_parse_duration(const char *str, size_t length, uint64_t *duration_ms)
+{
+    uint64_t total = 0;
+    bool overflow = false;
+    size_t i = 0;
+
+    if (length == 0)
+        return CMD_ARGS_INVALID;
+
+    while (i < length)
+    {
+        uint64_t amount = 0;
+        size_t start = i;
+
+        while (i < length && command_args_is_digit(str[i]))
+        {
+            unsigned int digit = (unsigned int) (str[i] - '0');
+
+            if (amount > (COMMAND_DURATION_MAX_MS - digit) / 10)
+                overflow = true;
+            else
+                amount = amount * 10 + digit;
+
+            i++;
+        }
+
+        if (i == start)
+            return CMD_ARGS_INVALID;
+
+        start = i;
+
+        while (i < length && !command_args_is_digit(str[i]))
+            i++;
+
+        const struct command_duration_unit *unit = command_duration_unit_find(str + start, i - start);
+
+        if (unit == NULL)
+            return CMD_ARGS_INVALID;
+
+        if (overflow || amount > (COMMAND_DURATION_MAX_MS - total) / unit->ms)
+            overflow = true;
+        else
+            total += amount * unit->ms;
+    }
+
+    if (overflow)
+        return CMD_ARGS_OUT_OF_RANGE;
+
+    *duration_ms = total;
+    return CMD_ARGS_OK;
+}
+
+static cmd_args_error_t command_args_convert(const cmd_arg_t *arg, const char *token, size_t length, void *value)
+{
+    switch ((cmd_arg_type_t) arg->type)
+    {
+        case CMD_ARG_SNOWFLAKE:
+        case CMD_ARG_USER:
+        case CMD_ARG_CHANNEL:
+        case CMD_ARG_ROLE:
+        {
+            static const uint8_t mention_types[] = {
+                [CMD_ARG_SNOWFLAKE] = MENTION_ID,
+                [CMD_ARG_USER] = MENTION_USER,
+                [CMD_ARG_CHANNEL] = MENTION_CHANNEL,
+                [CMD_ARG_ROLE] = MENTION_ROLE,
+            };
+            mention_t target;
+
+            if (!snowflake_parse_target(token, length, &target) ||
+                (target.type != MENTION_ID && target.type != mention_types[arg->type]))
+                return CMD_ARGS_INVALID;
+
+            memcpy(value, &target.id, sizeof (target.id));
+            return CMD_ARGS_OK;
+        }
+
+        case CMD_ARG_INTEGER:
+        {
+            int64_t integer;
+            cmd_args_error_t error = command_parse_integer(token, length, &integer);
+
+            if (error != CMD_ARGS_OK)
+                return error;
+
+            if ((arg->min != 0 || arg->max != 0) && (integer < arg->min || integer > arg->max))
+                return CMD_ARGS_OUT_OF_RANGE;
+
+            memcpy(value, &integer, sizeof (integer));
+            return CMD_ARGS_OK;
+        }
+
+        case CMD_ARG_DURATION:
+        {
+            uint64_t duration_ms;
+            cmd_args_error_t error = command_parse_duration(token, length, &duration_ms);
+
+            if (error != CMD_ARGS_OK)
+                return error;
+
+            if ((arg->min != 0 || arg->max != 0) &&
+                ((int64_t) duration_ms < arg->min || (int64_t) duration_ms > arg->max))
+                return CMD_ARGS_OUT_OF_RANGE;
+
+            memcpy(value, &duration_ms, sizeof (duration_ms));
+            return CMD_ARGS_OK;
+        }
+
+        case CMD_ARG_WORD:
+        case CMD_ARG_REST:
+        {
+            cmd_text_t text = { token, length };
+
+            memcpy(value, &text, sizeof (text));
+            return CMD_ARGS_OK;
+        }
+    }
+
+    return CMD_ARGS_INVALID;
+}
+
+static bool command_args_fail(cmd_args_result_t *result, cmd_args_error_t error, size_t arg, size_t offset,
+                              size_t length)
+{
+    result->error = (uint8_t) error;
+    result->arg = (uint8_t) arg;
+    result->offset = (uint32_t) offset;
+    result->length = (uint32_t) length;
+    return false;
+}
+
+/**
+ * @brief Parses text from offset on into values, a struct laid out as args
+ * describes, which is zeroed first. Values of text arguments point into
+ * text; nothing is allocated. On failure result says which argument failed
+ * and where.
+ */
+bool command_args_parse(const cmd_args_t *args, const char *text, size_t length, size_t offset, void *values,
+                        cmd_args_result_t *result)
+{
+    size_t position = offset;
+
+    assert(args->count <= COMMAND_ARGS_MAX && "Too many arguments in command layout");
+    memset(values, 0, args->size);
+    memset(result, 0, sizeof (*result));
+
+    for (size_t i = 0; i < args->count; i++)
+    {
+        const cmd_arg_t *arg = &args->list[i];
+        bool optional = (arg->flags & CMD_ARG_OPTIONAL) != 0;
+        void *value = (char *) values + arg->offset;
+
+        assert(arg->offset + command_args_value_size(arg->type) <= args->size && "Argument outside of its struct");
+
+        while (position < length && command_args_is_space(text[position]))
+            position++;
+
+        if (position == length)
+        {
+            if (!optional)
+                return command_args_fail(result, CMD_ARGS_MISSING, i, position, 0);
+
+            continue;
+        }
+
+        size_t end = position;
+
+        if (arg->type == CMD_ARG_REST)
+        {
+            end = length;
+
+            while (end > position && command_args_is_space(text[end - 1]))
+                end--;
+        }
+        else
+        {
+            while (end < length && !command_args_is_space(text[end]))
+                end++;
+        }
+
+        cmd_args_error_t error = command_args_convert(arg, text + position, end - position, value);
+
+        if (error == CMD_ARGS_INVALID && optional)
+            continue;
+
+        if (error != CMD_ARGS_OK)
+            return command_args_fail(result, error, i, position, end - position);
+
+        result->present |= 1U << i;
+        position = end;
+    }
+
+    while (position < length && command_args_is_space(text[position]))
+        position++;
+
+    if (position < length)
+    {
+        size_t end = position;
+
+        while (end < length && !command_args_is_space(text[end]))
+            end++;
+
+        return command_args_fail(result, CMD_ARGS_TOO_MANY, args->count, position, end - position);
+    }
+
+    return true;
+}
+
+static void command_args_append(char *buffer, size_t size, size_t *used, const char *str, size_t length)
+{
+    if (*used + 1 < size)
+    {
+        size_t room = size - 1 - *used;
+        memcpy(buffer + *used, str, length < room ? length : room);
+    }
+
+    *used += length;
+}
+
+static bool command_args_is_continuation(char c)
+{
+    return ((unsigned char) c & 0xC0) == 0x80;
+}
+
+/**
+ * @brief Describes a parse failure for a reply to the user, quoting the
+ * text around it in a code block with the offending token underlined.
+ * Returns the length of the full message like snprintf() does; the buffer
+ * always ends up terminated.
+ */
+size_t command_args_format_error(const cmd_args_t *args, const cmd_args_result_t *result, const char *text,
+                                 size_t length, char *buffer, size_t size)
+{
+    const cmd_arg_t *arg = result->arg < args->count ? &args->list[result->arg] : NULL;
+    const char *name = arg != NULL ? arg->name : "";
+    char line[160];
+    size_t used = 0;
+    int written;
+
+    switch ((cmd_args_error_t) result->error)
+    {
+        case CMD_ARGS_MISSING:
+            written = snprintf(line, sizeof (line), "Missing `%s`, %s.", name, command_args_expected[arg->type]);
+            break;
+
+        case CMD_ARGS_INVALID:
+            written = snprintf(line, sizeof (line), "Expected %s for `%s`.", command_args_expected[arg->type], name);
+            break;
+
+        case CMD_ARGS_OUT_OF_RANGE:
+            if (arg->type == CMD_ARG_INTEGER && (arg->min != 0 || arg->max != 0))
+                written = snprintf(line, sizeof (line), "`%s` must be between %" PRId64 " and %" PRId64 ".", name,
+                                   arg->min, arg->max);
+            else
+                written = snprintf(line, sizeof (line), "`%s` is out of range.", name);
+
+            break;
+
+        case CMD_ARGS_TOO_MANY:
+            written = snprintf(line, sizeof (line), "Too many arguments.");
+            break;
+
+        default:
+            written = snprintf(line, sizeof (line), "Invalid arguments.");
+            break;
+    }
+
+    command_args_append(buffer, size, &used, line, written < 0 ? 0 : (size_t) written);
+
+    size_t offset = result->offset <= length ? result->offset : length;
+    size_t token_end = offset + result->length <= length ? offset + result->length : length;
+    size_t start = offset > COMMAND_ARGS_ERROR_CONTEXT ? offset - COMMAND_ARGS_ERROR_CONTEXT : 0;
+    size_t end = length - token_end > COMMAND_ARGS_ERROR_CONTEXT ? token_end + COMMAND_ARGS_ERROR_CONTEXT : length;
+    size_t column = 0, width = 0;
+
+    while (start > 0 && command_args_is_continuation(text[start]))
+        start--;
+
+    while (end < length && command_args_is_continuation(text[end]))
+        end++;
+
+    command_args_append(buffer, size, &used, "\n```\n", 5);
+
+    /* Line breaks and backticks would break the quote or misplace the marker. */
+    for (size_t i = start; i < end; i++)
+    {
+        char c = text[i] == '`' ? '\'' : command_args_is_space(text[i]) ? ' ' : text[i];
+
+        command_args_append(buffer, size, &used, &c, 1);
+
+        if (!command_args_is_continuation(text[i]))
+        {
+            if (i < offset)
+                column++;
+            else if (i < token_end)
+                width++;
+        }
+    }
+
+    command_args_append(buffer, size, &used, "\n", 1);
+
+    for (size_t i = 0; i < column; i++)
+        command_args_append(buffer, size, &used, " ", 1);
+
+    for (size_t i = 0; i < (width == 0 ? 1 : width); i++)
+        command_args_append(buffer, size, &used, "^", 1);
+
+    command_args_append(buffer, size, &used, "\n```", 4);
+
+    if (size != 0)
+        buffer[used < size ? used : size - 1] = 0;
+
+    return used;
+}
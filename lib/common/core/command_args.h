@@ -0,0 +1,110 @@
+#ifndef SUDOBOT_CORE_COMMAND_ARGS_H
+#define SUDOBOT_CORE_COMMAND_ARGS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Bytes reserved on the stack for the parsed values of a legacy command. */
+#define COMMAND_ARGS_MAX_SIZE 256
+/* Arguments per layout; one bit each in cmd_args_result_t.present. */
+#define COMMAND_ARGS_MAX 32
+#define COMMAND_DURATION_MAX_MS (10ULL * 365 * 24 * 60 * 60 * 1000)
+
+/*
+ * Value types and the field each one fills in the result struct:
+ * snowflakes, users, channels and roles a uint64_t ID (mentions and bare
+ * IDs are both accepted), integers an int64_t, durations such as "1d2h30m"
+ * a uint64_t in milliseconds, and words and the rest of the text a
+ * cmd_text_t pointing into the message.
+ */
+typedef enum cmd_arg_type
+{
+    CMD_ARG_SNOWFLAKE,
+    CMD_ARG_USER,
+    CMD_ARG_CHANNEL,
+    CMD_ARG_ROLE,
+    CMD_ARG_INTEGER,
+    CMD_ARG_DURATION,
+    CMD_ARG_WORD,
+    /* Everything left, trimmed; must come last. */
+    CMD_ARG_REST,
+} cmd_arg_type_t;
+
+/*
+ * An optional argument whose token does not parse is skipped and the
+ * token offered to the next argument, so "-ban @user spam" and
+ * "-ban @user 1d spam" both fit user, optional duration, reason.
+ */
+#define CMD_ARG_OPTIONAL 1
+
+typedef struct cmd_text
+{
+    const char *data;
+    size_t length;
+} cmd_text_t;
+
+typedef struct cmd_arg
+{
+    const char *name;
+    uint8_t type;
+    uint8_t flags;
+    /* offsetof() the field in the result struct. */
+    uint16_t offset;
+    /* Inclusive bounds for integers and durations; ignored when both are 0. */
+    int64_t min;
+    int64_t max;
+} cmd_arg_t;
+
+/*
+ * Argument layout of a command, e.g.
+ *
+ *     struct ban_args { uint64_t user_id; uint64_t duration_ms; cmd_text_t reason; };
+ *
+ *     static const cmd_arg_t ban_arg_list[] = {
+ *         { "user", CMD_ARG_USER, 0, offsetof(struct ban_args, user_id) },
+ *         { "duration", CMD_ARG_DURATION, CMD_ARG_OPTIONAL, offsetof(struct ban_args, duration_ms) },
+ *         { "reason", CMD_ARG_REST, CMD_ARG_OPTIONAL, offsetof(struct ban_args, reason) },
+ *     };
+ *
+ *     static const cmd_args_t ban_args = CMD_ARGS(struct ban_args, ban_arg_list);
+ */
+typedef struct cmd_args
+{
+    const cmd_arg_t *list;
+    size_t count;
+    size_t size;
+} cmd_args_t;
+
+#define CMD_ARGS(type, list) { (list), sizeof (list) / sizeof ((list)[0]), sizeof (type) }
+
+typedef enum cmd_args_error
+{
+    CMD_ARGS_OK,
+    CMD_ARGS_MISSING,
+    CMD_ARGS_INVALID,
+    CMD_ARGS_OUT_OF_RANGE,
+    CMD_ARGS_TOO_MANY,
+} cmd_args_error_t;
+
+typedef struct cmd_args_result
+{
+    uint8_t error;
+    /* Index of the failing argument in the layout. */
+    uint8_t arg;
+    /* Byte range of the offending token in the parsed text; at its end for missing arguments. */
+    uint32_t offset;
+    uint32_t length;
+    /* Bit i is set when argument i was given. */
+    uint32_t present;
+} cmd_args_result_t;
+
+bool command_args_parse(const cmd_args_t *args, const char *text, size_t length, size_t offset, void *values,
+                        cmd_args_result_t *result);
+size_t command_args_format_error(const cmd_args_t *args, const cmd_args_result_t *result, const char *text,
+                                 size_t length, char *buffer, size_t size);
+cmd_args_error_t command_parse_duration(const char *str, size_t length, uint64_t *duration_ms);
+cmd_args_error_t command_parse_integer(const char *str, size_t length, int64_t *value);
+
+#endif /* SUDOBOT_CORE_COMMAND_ARGS_H */
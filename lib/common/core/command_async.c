@@ -0,0 +1,274 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <concord/discord.h>
+#include "command.h"
+#include "../io/log.h"
+#include "../utils/xmalloc.h"
+
+struct cmd_async_request
+{
+    cmd_async_t *async;
+    const void **slot;
+    const void *claimed;
+    struct cmd_async_request *next;
+};
+
+static _Atomic bool cmd_async_offline = false;
+
+static void cmd_async_finish(cmd_async_t *async)
+{
+    struct discord *client = async->client;
+    struct cmd_async_request *request = atomic_load(&async->requests);
+
+    while (request != NULL)
+    {
+        struct cmd_async_request *next = request->next;
+
+        if (request->claimed != NULL)
+            discord_unclaim(client, request->claimed);
+
+        free(request);
+        request = next;
+    }
+
+    if (async->context.is_legacy)
+    {
+        for (size_t i = 0; i < async->context.argc; i++)
+            free(async->argv[i]);
+
+        free(async->argv);
+    }
+
+    if (!atomic_load(&cmd_async_offline))
+    {
+        if (async->context.is_legacy)
+            discord_unclaim(client, async->context.message);
+        else
+            discord_unclaim(client, async->context.interaction);
+    }
+
+    free(async);
+}
+
+/*
+ * Runs continuations until one leaves requests outstanding or the chain
+ * ends. The step being run holds one extra pending reference, so requests
+ * that complete before it returns cannot start the next step early.
+ */
+static void cmd_async_advance(cmd_async_t *async)
+{
+    while (true)
+    {
+        cmd_async_step_t step = async->next;
+
+        if (atomic_load(&async->failed))
+        {
+            step = async->on_error;
+            async->on_error = NULL;
+            atomic_store(&async->failed, false);
+        }
+
+        async->next = NULL;
+
+        if (step == NULL)
+        {
+            cmd_async_finish(async);
+            return;
+        }
+
+        atomic_store(&async->pending, 1);
+        step(async->client, async);
+
+        if (atomic_fetch_sub(&async->pending, 1) != 1)
+            return;
+    }
+}
+
+static void cmd_async_settle(struct cmd_async_request *request, struct discord *client, const void *result,
+                             CCORDcode code)
+{
+    cmd_async_t *async = request->async;
+
+    if (code == CCORD_OK && result != NULL)
+    {
+        discord_claim(client, result);
+        request->claimed = result;
+        *request->slot = result;
+    }
+    else if (code != CCORD_OK)
+    {
+        log_debug("%s: request in command `%s` failed: %s", __func__, async->context.command_name,
+                  discord_strerror(code, client));
+        atomic_store(&async->error, code);
+        atomic_store(&async->failed, true);
+    }
+
+    if (atomic_fetch_sub(&async->pending, 1) == 1)
+        cmd_async_advance(async);
+}
+
+static struct cmd_async_request *cmd_async_request_new(cmd_async_t *async, const void **slot)
+{
+    struct cmd_async_request *request = xcalloc(1, sizeof (*request));
+
+    request->async = async;
+    request->slot = slot;
+    *slot = NULL;
+    request->next = atomic_load(&async->requests);
+
+    while (!atomic_compare_exchange_weak(&async->requests, &request->next, request))
+        ;
+
+    atomic_fetch_add(&async->pending, 1);
+    return request;
+}
+
+static void cmd_async_fail(struct discord *client, struct discord_response *resp)
+{
+    cmd_async_settle(resp->data, client, NULL, resp->code);
+}
+
+/* Settles requests that concord refused to enqueue. */
+static void cmd_async_check_enqueued(struct discord *client, struct cmd_async_request *request, CCORDcode code)
+{
+    if (code != CCORD_OK)
+        cmd_async_settle(request, client, NULL, code);
+}
+
+/* Offline, requests fail without reaching concord. */
+#define CMD_ASYNC_REQUEST(call) (atomic_load(&cmd_async_offline) ? CCORD_RESOURCE_UNAVAILABLE : (call))
+
+#define CMD_ASYNC_DONE_CALLBACK(name, type)                                                                    \
+    static void cmd_async_done_##name(struct discord *client, struct discord_response *resp, const type *ret) \
+    {                                                                                                          \
+        cmd_async_settle(resp->data, client, ret, CCORD_OK);                                                   \
+    }
+
+CMD_ASYNC_DONE_CALLBACK(user, struct discord_user)
+CMD_ASYNC_DONE_CALLBACK(guild, struct discord_guild)
+CMD_ASYNC_DONE_CALLBACK(channel, struct discord_channel)
+CMD_ASYNC_DONE_CALLBACK(guild_member, struct discord_guild_member)
+
+/**
+ * @brief Starts an asynchronous command chain with step as its first step.
+ *
+ * The message or interaction in context is claimed, and the legacy argv
+ * and parsed arguments copied, so all stay valid after the command
+ * callback returns. data_size bytes of zeroed per-command state are
+ * available through async->data.
+ */
+void cmd_async_start(struct discord *client, cmdctx_t context, size_t data_size, cmd_async_step_t step)
+{
+    size_t args_at = (sizeof (cmd_async_t) + data_size + _Alignof (max_align_t) - 1) &
+                     ~(_Alignof (max_align_t) - 1);
+    cmd_async_t *async = xcalloc(1, args_at + context.args_size);
+
+    async->client = client;
+    async->context = context;
+    async->data = data_size == 0 ? NULL : (void *) (async + 1);
+    async->next = step;
+
+    if (context.args != NULL)
+    {
+        async->context.args = (char *) async + args_at;
+        memcpy((char *) async + args_at, context.args, context.args_size);
+    }
+
+    if (context.is_legacy)
+    {
+        async->argv = xcalloc(context.argc == 0 ? 1 : context.argc, sizeof (char *));
+
+        for (size_t i = 0; i < context.argc; i++)
+            async->argv[i] = strdup(context.argv[i]);
+
+        async->context.argv = (const char **) async->argv;
+        async->context.command_name = context.argc == 0 ? "" : async->argv[0];
+    }
+    else
+        async->context.command_name = context.interaction->data->name;
+
+    if (!atomic_load(&cmd_async_offline))
+    {
+        if (context.is_legacy)
+            discord_claim(client, context.message);
+        else
+            discord_claim(client, context.interaction);
+    }
+
+    cmd_async_advance(async);
+}
+
+/**
+ * @brief Runs asynchronous commands without Discord, for offline replay.
+ *
+ * Events are not claimed, since they were not decoded by concord, and
+ * every request fails at once with CCORD_RESOURCE_UNAVAILABLE. Chains
+ * therefore finish before the command callback returns, while the event
+ * is still valid.
+ */
+void cmd_async_set_offline(bool offline)
+{
+    atomic_store(&cmd_async_offline, offline);
+}
+
+void cmd_async_then(cmd_async_t *async, cmd_async_step_t next)
+{
+    async->next = next;
+}
+
+/* Sets the step to run instead of the continuation if any request fails. */
+void cmd_async_catch(cmd_async_t *async, cmd_async_step_t on_error)
+{
+    async->on_error = on_error;
+}
+
+void cmd_async_get_current_user(cmd_async_t *async, const struct discord_user **result)
+{
+    struct cmd_async_request *request = cmd_async_request_new(async, (const void **) result);
+    struct discord_ret_user ret = { .done = &cmd_async_done_user, .fail = &cmd_async_fail, .data = request };
+
+    cmd_async_check_enqueued(async->client, request,
+                             CMD_ASYNC_REQUEST(discord_get_current_user(async->client, &ret)));
+}
+
+void cmd_async_get_user(cmd_async_t *async, u64snowflake user_id, const struct discord_user **result)
+{
+    struct cmd_async_request *request = cmd_async_request_new(async, (const void **) result);
+    struct discord_ret_user ret = { .done = &cmd_async_done_user, .fail = &cmd_async_fail, .data = request };
+
+    cmd_async_check_enqueued(async->client, request,
+                             CMD_ASYNC_REQUEST(discord_get_user(async->client, user_id, &ret)));
+}
+
+void cmd_async_get_guild(cmd_async_t *async, u64snowflake guild_id, const struct discord_guild **result)
+{
+    struct cmd_async_request *request = cmd_async_request_new(async, (const void **) result);
+    struct discord_ret_guild ret = { .done = &cmd_async_done_guild, .fail = &cmd_async_fail, .data = request };
+
+    cmd_async_check_enqueued(async->client, request,
+                             CMD_ASYNC_REQUEST(discord_get_guild(async->client, guild_id, &ret)));
+}
+
+void cmd_async_get_channel(cmd_async_t *async, u64snowflake channel_id, const struct discord_channel **result)
+{
+    struct cmd_async_request *request = cmd_async_request_new(async, (const void **) result);
+    struct discord_ret_channel ret = { .done = &cmd_async_done_channel, .fail = &cmd_async_fail, .data = request };
+
+    cmd_async_check_enqueued(async->client, request,
+                             CMD_ASYNC_REQUEST(discord_get_channel(async->client, channel_id, &ret)));
+}
+
+void cmd_async_get_guild_member(cmd_async_t *async, u64snowflake guild_id, u64snowflake user_id,
+                                const struct discord_guild_member **result)
+{
+    struct cmd_async_request *request = cmd_async_request_new(async, (const void **) result);
+    struct discord_ret_guild_member ret = {
+        .done = &cmd_async_done_guild_member,
+        .fail = &cmd_async_fail,
+        .data = request,
+    };
+
+    cmd_async_check_enqueued(async->client, request,
+                             CMD_ASYNC_REQUEST(discord_get_guild_member(async->client, guild_id, user_id, &ret)));
+}
@@ -309,12 +309,12 @@ void env_free(env_t *env)
 
 const char *env_get_local(env_t *env, const char *restrict name)
 {
-    int contains = chash_contains(env->table, "TOKEN", contains, ENVTABLE);;
-    char *value;
+    int contains = chash_contains(env->table, name, contains, ENVTABLE);
+    char *value = NULL;
 
     if (contains == 0)
         return NULL;
-        
+
     value = chash_lookup(env->table, name, value, ENVTABLE);
     return value;
 }
@@ -327,4 +327,27 @@ const char *env_get(env_t *env, const char *restrict name)
         return getenv(name);
 
     return value;
+}
+
+/**
+ * @brief Reads a positive integer option, falling back to the process
+ * environment when no env file has been loaded.
+ */
+size_t env_get_size(env_t *env, const char *restrict name, size_t default_value)
+{
+    const char *value = env != NULL ? env_get(env, name) : getenv(name);
+
+    if (value == NULL || *value == 0)
+        return default_value;
+
+    char *end = NULL;
+    unsigned long long parsed = strtoull(value, &end, 10);
+
+    if (*end != 0 || parsed == 0)
+    {
+        log_warn("Ignoring invalid value for `%s`: %s", name, value);
+        return default_value;
+    }
+
+    return (size_t) parsed;
 }
\ No newline at end of file
@@ -18,5 +18,6 @@ bool env_load(env_t *env);
 void env_free(env_t *env);
 const char *env_get_local(env_t *env, const char *restrict name);
 const char *env_get(env_t *env, const char *restrict name);
+size_t env_get_size(env_t *env, const char *restrict name, size_t default_value);
 
 #endif /* SUDOBOT_ENV_ENV_H */
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "event_filter.h"
+#include "../core/command.h"
+#include "../ipc/event_bridge.h"
+
+event_filter_mode_t event_filter_mode = EVENT_FILTER_OFF;
+
+static _Atomic uint64_t event_filter_scanned = 0;
+static _Atomic uint64_t event_filter_passed = 0;
+static _Atomic uint64_t event_filter_malformed = 0;
+static _Atomic uint64_t event_filter_filtered[EVENT_FILTER_REASON_COUNT];
+
+static const char *const event_filter_reason_names[EVENT_FILTER_REASON_COUNT] = {
+    [EVENT_FILTER_REASON_BOT] = "bot",
+    [EVENT_FILTER_REASON_DIRECT_MESSAGE] = "direct_message",
+    [EVENT_FILTER_REASON_NO_PREFIX] = "no_prefix",
+};
+
+/*
+ * Just enough of a JSON reader to find a few members without decoding
+ * anything: values that are not looked at are skipped over, strings with
+ * memchr.
+ */
+struct json_scan
+{
+    const char *p;
+    const char *end;
+    bool malformed;
+};
+
+static void json_skip_space(struct json_scan *scan)
+{
+    while (scan->p < scan->end && (*scan->p == ' ' || *scan->p == '\t' || *scan->p == '\n' || *scan->p == '\r'))
+        scan->p++;
+}
+
+/* At an opening quote; moves past the closing one and returns where the contents end. */
+static const char *json_skip_string(struct json_scan *scan)
+{
+    const char *start = scan->p + 1;
+    const char *quote = start;
+
+    while ((quote = memchr(quote, '"', (size_t) (scan->end - quote))) != NULL)
+    {
+        size_t backslashes = 0;
+
+        while (quote - backslashes > start && quote[-1 - (ptrdiff_t) backslashes] == '\\')
+            backslashes++;
+
+        if (backslashes % 2 == 0)
+        {
+            scan->p = quote + 1;
+            return quote;
+        }
+
+        quote++;
+    }
+
+    scan->malformed = true;
+    scan->p = scan->end;
+    return scan->end;
+}
+
+static void json_skip_value(struct json_scan *scan)
+{
+    size_t depth = 0;
+
+    if (scan->p >= scan->end)
+    {
+        scan->malformed = true;
+        return;
+    }
+
+    if (*scan->p == '"')
+    {
+        json_skip_string(scan);
+        return;
+    }
+
+    if (*scan->p != '{' && *scan->p != '[')
+    {
+        while (scan->p < scan->end && *scan->p != ',' && *scan->p != '}' && *scan->p != ']' && *scan->p != ' ' &&
+               *scan->p != '\n' && *scan->p != '\r' && *scan->p != '\t')
+            scan->p++;
+
+        return;
+    }
+
+    while (scan->p < scan->end && !scan->malformed)
+    {
+        switch (*scan->p)
+        {
+            case '"':
+                json_skip_string(scan);
+                continue;
+
+            case '{':
+            case '[':
+                depth++;
+                break;
+
+            case '}':
+            case ']':
+                if (--depth == 0)
+                {
+                    scan->p++;
+                    return;
+                }
+
+                break;
+
+            default:
+                break;
+        }
+
+        scan->p++;
+    }
+
+    scan->malformed = true;
+}
+
+/*
+ * Steps to the next member of the object the scan is in, right after its
+ * opening brace or a previous value. Returns false at the end of the
+ * object (the scan is then past the closing brace) or on malformed input.
+ */
+static bool json_next_member(struct json_scan *scan, bool first, const char **key, size_t *key_length)
+{
+    json_skip_space(scan);
+
+    if (!first && scan->p < scan->end && *scan->p == ',')
+    {
+        scan->p++;
+        json_skip_space(scan);
+    }
+
+    if (scan->p < scan->end && *scan->p == '}')
+    {
+        scan->p++;
+        return false;
+    }
+
+    if (scan->p >= scan->end || *scan->p != '"')
+    {
+        scan->malformed = true;
+        return false;
+    }
+
+    *key = scan->p + 1;
+    *key_length = (size_t) (json_skip_string(scan) - *key);
+    json_skip_space(scan);
+
+    if (scan->p >= scan->end || *scan->p != ':')
+    {
+        scan->malformed = true;
+        return false;
+    }
+
+    scan->p++;
+    json_skip_space(scan);
+    return scan->p < scan->end;
+}
+
+static bool json_key_is(const char *key, size_t key_length, const char *name)
+{
+    size_t length = strlen(name);
+    return key_length == length && memcmp(key, name, length) == 0;
+}
+
+struct event_filter_fields
+{
+    bool seen_author;
+    bool seen_content;
+    bool bot;
+    bool guild;
+    bool prefixed;
+};
+
+static void event_filter_scan_author(struct json_scan *scan, struct event_filter_fields *fields)
+{
+    const char *key;
+    size_t key_length;
+
+    scan->p++;
+
+    for (bool first = true; json_next_member(scan, first, &key, &key_length); first = false)
+    {
+        if (json_key_is(key, key_length, "bot"))
+            fields->bot = *scan->p == 't';
+
+        json_skip_value(scan);
+    }
+}
+
+static bool event_filter_scan(const char *data, size_t size, struct event_filter_fields *fields)
+{
+    struct json_scan scan = { .p = data, .end = data + size };
+    const char *key;
+    size_t key_length;
+
+    json_skip_space(&scan);
+
+    if (scan.p >= scan.end || *scan.p != '{')
+        return false;
+
+    scan.p++;
+
+    for (bool first = true; json_next_member(&scan, first, &key, &key_length); first = false)
+    {
+        if (json_key_is(key, key_length, "author") && *scan.p == '{')
+        {
+            event_filter_scan_author(&scan, fields);
+            fields->seen_author = true;
+        }
+        else if (json_key_is(key, key_length, "guild_id"))
+        {
+            fields->guild = *scan.p == '"';
+            json_skip_value(&scan);
+        }
+        else if (json_key_is(key, key_length, "content") && *scan.p == '"')
+        {
+            /* The prefix has no characters JSON escapes, so the raw bytes compare as they are. */
+            const char *content = scan.p + 1;
+            const char *content_end = json_skip_string(&scan);
+
+            fields->prefixed = (size_t) (content_end - content) >= sizeof (COMMAND_PREFIX) - 1 &&
+                               memcmp(content, COMMAND_PREFIX, sizeof (COMMAND_PREFIX) - 1) == 0;
+            fields->seen_content = true;
+        }
+        else
+        {
+            json_skip_value(&scan);
+        }
+
+        if (scan.malformed)
+            return false;
+
+        /* Only the absence of guild_id needs the whole object. */
+        if (fields->seen_author && fields->seen_content && (fields->guild || event_filter_mode == EVENT_FILTER_COMMANDS))
+            return true;
+    }
+
+    return !scan.malformed;
+}
+
+/**
+ * @brief Decides from the raw MESSAGE_CREATE payload whether the message
+ * is worth decoding. Anything the scan does not understand is passed.
+ */
+bool event_filter_message_create(const char *data, size_t size)
+{
+    struct event_filter_fields fields = { 0 };
+    event_filter_reason_t reason = EVENT_FILTER_REASON_COUNT;
+
+    /* With the TS side attached, everything it might want has to be decoded anyway. */
+    if (event_filter_mode == EVENT_FILTER_OFF || (event_filter_mode == EVENT_FILTER_UNUSED && event_bridge != NULL))
+        return true;
+
+    atomic_fetch_add_explicit(&event_filter_scanned, 1, memory_order_relaxed);
+
+    if (!event_filter_scan(data, size, &fields))
+    {
+        atomic_fetch_add_explicit(&event_filter_malformed, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&event_filter_passed, 1, memory_order_relaxed);
+        return true;
+    }
+
+    if (event_filter_mode == EVENT_FILTER_COMMANDS)
+    {
+        if (fields.bot)
+            reason = EVENT_FILTER_REASON_BOT;
+        else if (!fields.prefixed)
+            reason = EVENT_FILTER_REASON_NO_PREFIX;
+    }
+    else if (fields.bot)
+    {
+        /* Automod, the message cache and commands all skip bots, and only commands work in DMs. */
+        reason = EVENT_FILTER_REASON_BOT;
+    }
+    else if (!fields.guild && !fields.prefixed)
+    {
+        reason = EVENT_FILTER_REASON_DIRECT_MESSAGE;
+    }
+
+    if (reason == EVENT_FILTER_REASON_COUNT)
+    {
+        atomic_fetch_add_explicit(&event_filter_passed, 1, memory_order_relaxed);
+        return true;
+    }
+
+    atomic_fetch_add_explicit(&event_filter_filtered[reason], 1, memory_order_relaxed);
+    return false;
+}
+
+void event_filter_get_stats(event_filter_stats_t *stats)
+{
+    stats->scanned = atomic_load_explicit(&event_filter_scanned, memory_order_relaxed);
+    stats->passed = atomic_load_explicit(&event_filter_passed, memory_order_relaxed);
+    stats->malformed = atomic_load_explicit(&event_filter_malformed, memory_order_relaxed);
+
+    for (size_t i = 0; i < EVENT_FILTER_REASON_COUNT; i++)
+        stats->filtered[i] = atomic_load_explicit(&event_filter_filtered[i], memory_order_relaxed);
+}
+
+const char *event_filter_reason_name(event_filter_reason_t reason)
+{
+    return reason < EVENT_FILTER_REASON_COUNT ? event_filter_reason_names[reason] : "unknown";
+}
@@ -0,0 +1,40 @@
+#ifndef SUDOBOT_EVENTS_EVENT_FILTER_H
+#define SUDOBOT_EVENTS_EVENT_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef enum event_filter_mode
+{
+    EVENT_FILTER_OFF = 0,
+    /* Drop only messages no native consumer or the TS bridge would look at. */
+    EVENT_FILTER_UNUSED = 1,
+    /* Pass only human messages that start with the command prefix. */
+    EVENT_FILTER_COMMANDS = 2,
+} event_filter_mode_t;
+
+typedef enum event_filter_reason
+{
+    EVENT_FILTER_REASON_BOT,
+    EVENT_FILTER_REASON_DIRECT_MESSAGE,
+    EVENT_FILTER_REASON_NO_PREFIX,
+    EVENT_FILTER_REASON_COUNT
+} event_filter_reason_t;
+
+typedef struct event_filter_stats
+{
+    uint64_t scanned;
+    uint64_t passed;
+    /* Payloads the scan could not make sense of; they are passed on. */
+    uint64_t malformed;
+    uint64_t filtered[EVENT_FILTER_REASON_COUNT];
+} event_filter_stats_t;
+
+extern event_filter_mode_t event_filter_mode;
+
+bool event_filter_message_create(const char *data, size_t size);
+void event_filter_get_stats(event_filter_stats_t *stats);
+const char *event_filter_reason_name(event_filter_reason_t reason);
+
+#endif /* SUDOBOT_EVENTS_EVENT_FILTER_H */
@@ -0,0 +1,17 @@
+#include <concord/discord.h>
+#include "../rest/scheduler.h"
+#include "../rest/audit_log.h"
+#include "../timers/timers.h"
+#include "on_cycle.h"
+
+/* Runs once per event loop iteration. */
+void on_cycle(struct discord *client)
+{
+    if (audit_log != NULL)
+        audit_log_flush(audit_log, client);
+
+    rest_on_cycle(client);
+
+    if (timers != NULL)
+        timers_advance(timers);
+}
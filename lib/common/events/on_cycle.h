@@ -0,0 +1,8 @@
+#ifndef SUDOBOT_EVENTS_ON_CYCLE_H
+#define SUDOBOT_EVENTS_ON_CYCLE_H
+
+#include <concord/discord.h>
+
+void on_cycle(struct discord *client);
+
+#endif /* SUDOBOT_EVENTS_ON_CYCLE_H */
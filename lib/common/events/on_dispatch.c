@@ -0,0 +1,26 @@
+#include <concord/discord.h>
+#include "../gateway/recorder.h"
+#include "../gateway/session.h"
+#include "event_filter.h"
+#include "on_dispatch.h"
+
+/*
+ * Sees every gateway dispatch before concord decodes it. Events without a
+ * dedicated callback, such as RESUMED, are observed here, and this is where
+ * raw payloads are captured for offline replay. Messages the event filter
+ * rejects are never decoded.
+ */
+enum discord_event_scheduler on_dispatch(struct discord *client, const char data[], size_t size,
+                                         enum discord_gateway_events event)
+{
+    if (gateway_recorder != NULL)
+        gateway_recorder_write(gateway_recorder, client, event, data, size);
+
+    if (event == DISCORD_EV_RESUMED)
+        gateway_session_on_resumed(client);
+
+    if (event == DISCORD_EV_MESSAGE_CREATE && !event_filter_message_create(data, size))
+        return DISCORD_EVENT_IGNORE;
+
+    return DISCORD_EVENT_MAIN_THREAD;
+}
@@ -0,0 +1,9 @@
+#ifndef SUDOBOT_EVENTS_ON_DISPATCH_H
+#define SUDOBOT_EVENTS_ON_DISPATCH_H
+
+#include <concord/discord.h>
+
+enum discord_event_scheduler on_dispatch(struct discord *client, const char data[], size_t size,
+                                         enum discord_gateway_events event);
+
+#endif /* SUDOBOT_EVENTS_ON_DISPATCH_H */
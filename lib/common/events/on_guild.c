@@ -0,0 +1,156 @@
+#include <stdint.h>
+#include "on_guild.h"
+#include "../cache/member_table.h"
+#include "../gateway/shard.h"
+#include "../security/permissions.h"
+
+/*
+ * REQUEST_GUILD_MEMBERS counts against the gateway's 120 commands a minute,
+ * which heartbeats share, so a connection sends at most one per interval.
+ */
+#define ON_GUILD_MEMBER_REQUEST_INTERVAL_MS 1000
+
+/*
+ * Guild, role, channel and member events. Only registered when the
+ * permission engine (or, for GUILD_CREATE and member events, the member
+ * table) is enabled, so concord does not decode them otherwise.
+ */
+
+static void on_guild_request_members(struct discord *client, struct discord_timer *timer)
+{
+    struct discord_request_guild_members request = {
+        .guild_id = (u64snowflake) (uintptr_t) timer->data,
+        .query = "",
+        .limit = 0,
+    };
+
+    discord_request_guild_members(client, &request);
+}
+
+/* Schedules a REQUEST_GUILD_MEMBERS for the guild; the chunks it brings fill the member table. */
+static void on_guild_schedule_member_request(struct discord *client, u64snowflake guild_id)
+{
+    static uint64_t unsharded_request_at_ms = 0;
+    shard_t *shard = shard_from_client(client);
+    uint64_t *request_at_ms = shard != NULL ? &shard->member_request_at_ms : &unsharded_request_at_ms;
+    uint64_t now = discord_timestamp(client);
+
+    if (*request_at_ms < now)
+        *request_at_ms = now;
+
+    discord_timer(client, &on_guild_request_members, NULL, (void *) (uintptr_t) guild_id,
+                  (int64_t) (*request_at_ms - now));
+    *request_at_ms += ON_GUILD_MEMBER_REQUEST_INTERVAL_MS;
+}
+
+void on_guild_create(struct discord *client, const struct discord_guild *guild)
+{
+    if (permissions != NULL)
+        permissions_on_guild_create(permissions, guild);
+
+    if (member_table == NULL)
+        return;
+
+    int received = guild->members == NULL ? 0 : guild->members->size;
+
+    member_table_add_members(member_table, guild->id, guild->members);
+
+    /* Large guilds only come with a few members; the rest have to be requested. */
+    if (received < guild->member_count)
+        on_guild_schedule_member_request(client, guild->id);
+}
+
+void on_guild_update(struct discord *client, const struct discord_guild *guild)
+{
+    (void) client;
+    permissions_on_guild_update(permissions, guild);
+}
+
+void on_guild_role_create(struct discord *client, const struct discord_guild_role_create *event)
+{
+    (void) client;
+    permissions_on_role_update(permissions, event->guild_id, event->role);
+}
+
+void on_guild_role_update(struct discord *client, const struct discord_guild_role_update *event)
+{
+    (void) client;
+    permissions_on_role_update(permissions, event->guild_id, event->role);
+}
+
+void on_guild_role_delete(struct discord *client, const struct discord_guild_role_delete *event)
+{
+    (void) client;
+    permissions_on_role_delete(permissions, event->guild_id, event->role_id);
+}
+
+/* Also registered for CHANNEL_CREATE. */
+void on_channel_update(struct discord *client, const struct discord_channel *channel)
+{
+    (void) client;
+    permissions_on_channel_update(permissions, channel);
+}
+
+void on_channel_delete(struct discord *client, const struct discord_channel *channel)
+{
+    (void) client;
+    permissions_on_channel_delete(permissions, channel->id);
+}
+
+void on_guild_member_add(struct discord *client, const struct discord_guild_member *member)
+{
+    (void) client;
+
+    if (member->user == NULL)
+        return;
+
+    if (permissions != NULL)
+        permissions_on_member_update(permissions, member->guild_id, member->user->id, member->roles);
+
+    if (member_table != NULL)
+        member_table_on_member_add(member_table, member->guild_id, member);
+}
+
+void on_guild_member_update(struct discord *client, const struct discord_guild_member_update *event)
+{
+    (void) client;
+
+    if (event->user == NULL)
+        return;
+
+    if (permissions != NULL)
+        permissions_on_member_update(permissions, event->guild_id, event->user->id, event->roles);
+
+    if (member_table != NULL)
+        member_table_on_member_update(member_table, event);
+}
+
+void on_guild_member_remove(struct discord *client, const struct discord_guild_member_remove *event)
+{
+    (void) client;
+
+    if (event->user == NULL)
+        return;
+
+    if (permissions != NULL)
+        permissions_on_member_remove(permissions, event->guild_id, event->user->id);
+
+    if (member_table != NULL)
+        member_table_on_member_remove(member_table, event->guild_id, event->user->id);
+}
+
+void on_guild_members_chunk(struct discord *client, const struct discord_guild_members_chunk *event)
+{
+    (void) client;
+
+    if (member_table != NULL)
+        member_table_on_members_chunk(member_table, event);
+
+    for (int i = 0; permissions != NULL && event->members != NULL && i < event->members->size; i++)
+    {
+        const struct discord_guild_member *member = &event->members->array[i];
+
+        if (member->user != NULL)
+            permissions_on_member_update(permissions, event->guild_id, member->user->id, member->roles);
+    }
+}
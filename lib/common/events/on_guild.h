@@ -0,0 +1,18 @@
+#ifndef SUDOBOT_EVENTS_ON_GUILD_H
+#define SUDOBOT_EVENTS_ON_GUILD_H
+
+#include <concord/discord.h>
+
+void on_guild_create(struct discord *client, const struct discord_guild *guild);
+void on_guild_update(struct discord *client, const struct discord_guild *guild);
+void on_guild_role_create(struct discord *client, const struct discord_guild_role_create *event);
+void on_guild_role_update(struct discord *client, const struct discord_guild_role_update *event);
+void on_guild_role_delete(struct discord *client, const struct discord_guild_role_delete *event);
+void on_channel_update(struct discord *client, const struct discord_channel *channel);
+void on_channel_delete(struct discord *client, const struct discord_channel *channel);
+void on_guild_member_add(struct discord *client, const struct discord_guild_member *member);
+void on_guild_member_update(struct discord *client, const struct discord_guild_member_update *event);
+void on_guild_member_remove(struct discord *client, const struct discord_guild_member_remove *event);
+void on_guild_members_chunk(struct discord *client, const struct discord_guild_members_chunk *event);
+
+#endif /* SUDOBOT_EVENTS_ON_GUILD_H */
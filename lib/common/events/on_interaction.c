@@ -1,10 +1,34 @@
 #include "on_interaction.h"
 #include "../core/command.h"
+#include "../gateway/shard.h"
+#include "../ipc/event_bridge.h"
+#include "../metrics/metrics.h"
+#include "../pipeline/pipeline.h"
+#include "../security/permissions.h"
+#include "../utils/trace.h"
+#include "../utils/utils.h"
 
 void on_interaction_create(struct discord *client, const struct discord_interaction *interaction)
 {
+    uint64_t started_at = get_monotonic_time_ns();
+
     if (interaction->type == DISCORD_INTERACTION_PING) 
         return;
 
-    command_on_interaction_handler(client, interaction);
+    TRACE_PROBE3(event_received, TRACE_EVENT_INTERACTION, interaction->id, interaction->channel_id);
+
+    if (event_bridge != NULL)
+        event_bridge_publish_interaction(event_bridge, interaction);
+
+    if (permissions != NULL && interaction->member != NULL && interaction->member->user != NULL)
+        permissions_on_member_update(permissions, interaction->guild_id, interaction->member->user->id,
+                                     interaction->member->roles);
+
+    if (pipeline != NULL)
+        pipeline_submit_interaction(pipeline, client, interaction);
+    else
+        command_on_interaction_handler(client, interaction);
+
+    shard_record_event(client, SHARD_EVENT_INTERACTION, started_at);
+    metrics_record_handler(METRICS_HANDLER_ON_INTERACTION, started_at);
 }
\ No newline at end of file
@@ -1,7 +1,43 @@
 #include "on_message.h"
+#include "../automod/automod.h"
+#include "../cache/message_cache.h"
 #include "../core/command.h"
+#include "../gateway/shard.h"
+#include "../ipc/event_bridge.h"
+#include "../metrics/metrics.h"
+#include "../pipeline/pipeline.h"
+#include "../security/permissions.h"
+#include "../utils/trace.h"
+#include "../utils/utils.h"
 
 void on_message(struct discord *client, const struct discord_message *message)
 {
+    uint64_t started_at = get_monotonic_time_ns();
+    automod_ctx_t context;
+
+    TRACE_PROBE3(event_received, TRACE_EVENT_MESSAGE, message->id, message->channel_id);
+
+    if (event_bridge != NULL)
+        event_bridge_publish_message(event_bridge, message);
+
+    if (message_cache != NULL)
+        message_cache_on_message(message_cache, message);
+
+    if (permissions != NULL && message->member != NULL && message->author != NULL)
+        permissions_on_member_update(permissions, message->guild_id, message->author->id, message->member->roles);
+
+    if (pipeline != NULL)
+    {
+        pipeline_submit_message(pipeline, client, message);
+        shard_record_event(client, SHARD_EVENT_MESSAGE, started_at);
+        metrics_record_handler(METRICS_HANDLER_ON_MESSAGE, started_at);
+        return;
+    }
+
+    automod_context_init(&context, message);
+    automod_on_message(client, &context);
     command_on_message_handler(client, message);
-}
\ No newline at end of file
+    automod_context_destroy(&context);
+    shard_record_event(client, SHARD_EVENT_MESSAGE, started_at);
+    metrics_record_handler(METRICS_HANDLER_ON_MESSAGE, started_at);
+}
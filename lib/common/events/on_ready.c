@@ -2,14 +2,22 @@
 #include "../io/log.h"
 #include "../flags.h"
 #include "../core/command.h"
+#include "../gateway/shard.h"
+#include "../gateway/session.h"
+#include "../utils/utils.h"
 #include "on_ready.h"
 
 #define GUILD_ID ((u64snowflake) 911987536379912193)
 
 void on_ready(struct discord *client, const struct discord_ready *event)
 {
+    uint64_t started_at = get_monotonic_time_ns();
+
     log_info("Successfully logged in as @%s!", event->user->username);
+    gateway_session_on_ready(client);
 
-    if (flags_has(FLAG_UPDATE_COMMANDS)) 
+    if (flags_has(FLAG_UPDATE_COMMANDS) && shard_owns_guild(client, GUILD_ID)) 
         register_slash_commands(client, GUILD_ID);
+
+    shard_record_event(client, SHARD_EVENT_READY, started_at);
 }
\ No newline at end of file
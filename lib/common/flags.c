@@ -2,6 +2,7 @@
 #include "flags.h"
 
 char *opt_env_file_path = NULL;
+size_t opt_shard_count = 0;
 static int flags = 0;
 
 void flags_add(int flag)
@@ -2,8 +2,10 @@
 #define SUDOBOT_FLAGS_H
 
 #include <stdbool.h>
+#include <stdlib.h>
 
 extern char *opt_env_file_path;
+extern size_t opt_shard_count;
 
 enum sudobot_flags
 {
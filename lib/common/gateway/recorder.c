@@ -0,0 +1,200 @@
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "recorder.h"
+#include "shard.h"
+#include "../io/log.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+gateway_recorder_t *gateway_recorder = NULL;
+
+static uint64_t gateway_recorder_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static size_t gateway_recorder_put_varint(unsigned char *buffer, uint64_t value)
+{
+    size_t length = 0;
+
+    while (value >= 0x80)
+    {
+        buffer[length++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+
+    buffer[length++] = (unsigned char) value;
+    return length;
+}
+
+gateway_recorder_t *gateway_recorder_open(const char *path)
+{
+    /* Recordings hold every gateway payload, message content included. */
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    FILE *file = fd < 0 ? NULL : fdopen(fd, "wb");
+
+    if (file == NULL)
+    {
+        log_error("Failed to open gateway recording %s: %s", path, get_last_error());
+
+        if (fd >= 0)
+            close(fd);
+
+        return NULL;
+    }
+
+    gateway_recorder_t *recorder = xcalloc(1, sizeof (*recorder));
+    struct gateway_recording_header header = {
+        .magic = GATEWAY_RECORDING_MAGIC,
+        .version = GATEWAY_RECORDING_VERSION,
+        .started_at_ms = gateway_recorder_now_ms(),
+    };
+
+    recorder->file = file;
+    recorder->buffer = xmalloc(GATEWAY_RECORDER_BUFFER_SIZE);
+    recorder->last_at_us = get_monotonic_time_ns() / 1000;
+    setvbuf(file, recorder->buffer, _IOFBF, GATEWAY_RECORDER_BUFFER_SIZE);
+    fwrite(&header, sizeof header, 1, file);
+    pthread_mutex_init(&recorder->lock, NULL);
+
+    log_info("Recording gateway dispatches to %s", path);
+    return recorder;
+}
+
+/*
+ * Called from the event scheduler hook, on whichever thread received the
+ * dispatch; shards share one file, so writes are serialized.
+ */
+void gateway_recorder_write(gateway_recorder_t *recorder, struct discord *client, enum discord_gateway_events event,
+                            const char *data, size_t size)
+{
+    shard_t *shard = shard_from_client(client);
+    unsigned char prefix[40];
+
+    pthread_mutex_lock(&recorder->lock);
+
+    uint64_t now_us = get_monotonic_time_ns() / 1000;
+    size_t length = gateway_recorder_put_varint(prefix, now_us - recorder->last_at_us);
+
+    length += gateway_recorder_put_varint(prefix + length, (uint64_t) event);
+    length += gateway_recorder_put_varint(prefix + length, shard != NULL ? shard->id : 0);
+    length += gateway_recorder_put_varint(prefix + length, size);
+
+    if (fwrite(prefix, 1, length, recorder->file) == length && fwrite(data, 1, size, recorder->file) == size)
+    {
+        recorder->last_at_us = now_us;
+        recorder->events++;
+        recorder->bytes += length + size;
+    }
+
+    pthread_mutex_unlock(&recorder->lock);
+}
+
+void gateway_recorder_close(gateway_recorder_t *recorder)
+{
+    fclose(recorder->file);
+    log_info("Recorded %lu gateway dispatches (%lu bytes)", recorder->events, recorder->bytes);
+    pthread_mutex_destroy(&recorder->lock);
+    free(recorder->buffer);
+    free(recorder);
+}
+
+gateway_recording_t *gateway_recording_open(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    struct gateway_recording_header header;
+
+    if (file == NULL)
+    {
+        log_error("Failed to open gateway recording %s: %s", path, get_last_error());
+        return NULL;
+    }
+
+    if (fread(&header, sizeof header, 1, file) != 1 || header.magic != GATEWAY_RECORDING_MAGIC ||
+        header.version != GATEWAY_RECORDING_VERSION)
+    {
+        log_error("%s is not a gateway recording", path);
+        fclose(file);
+        return NULL;
+    }
+
+    gateway_recording_t *recording = xcalloc(1, sizeof (*recording));
+    size_t capacity = 0;
+    size_t read;
+
+    recording->started_at_ms = header.started_at_ms;
+
+    do
+    {
+        capacity = capacity == 0 ? 1024 * 1024 : capacity * 2;
+        recording->data = xrealloc(recording->data, capacity);
+        read = fread(recording->data + recording->length, 1, capacity - recording->length, file);
+        recording->length += read;
+    }
+    while (recording->length == capacity);
+
+    fclose(file);
+    return recording;
+}
+
+static bool gateway_recording_get_varint(gateway_recording_t *recording, uint64_t *value)
+{
+    uint64_t result = 0;
+
+    for (unsigned int shift = 0; shift < 64 && recording->cursor < recording->length; shift += 7)
+    {
+        unsigned char byte = recording->data[recording->cursor++];
+
+        result |= (uint64_t) (byte & 0x7F) << shift;
+
+        if (!(byte & 0x80))
+        {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool gateway_recording_next(gateway_recording_t *recording, gateway_recorded_event_t *event)
+{
+    uint64_t delta_us, type, shard_id, size;
+    size_t start = recording->cursor;
+
+    if (!gateway_recording_get_varint(recording, &delta_us) || !gateway_recording_get_varint(recording, &type) ||
+        !gateway_recording_get_varint(recording, &shard_id) || !gateway_recording_get_varint(recording, &size) ||
+        size > recording->length - recording->cursor)
+    {
+        if (start != recording->length)
+            log_warn("Ignoring a truncated record at the end of the gateway recording");
+
+        recording->cursor = recording->length;
+        return false;
+    }
+
+    recording->at_us += delta_us;
+    event->at_ns = recording->at_us * 1000;
+    event->event = (enum discord_gateway_events) type;
+    event->shard_id = (size_t) shard_id;
+    event->data = (const char *) recording->data + recording->cursor;
+    event->size = (size_t) size;
+    recording->cursor += (size_t) size;
+    return true;
+}
+
+void gateway_recording_rewind(gateway_recording_t *recording)
+{
+    recording->cursor = 0;
+    recording->at_us = 0;
+}
+
+void gateway_recording_free(gateway_recording_t *recording)
+{
+    free(recording->data);
+    free(recording);
+}
@@ -0,0 +1,75 @@
+#ifndef SUDOBOT_GATEWAY_RECORDER_H
+#define SUDOBOT_GATEWAY_RECORDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define GATEWAY_RECORDING_MAGIC 0x53424752 /* "SBGR" */
+#define GATEWAY_RECORDING_VERSION 1
+#define GATEWAY_RECORDER_BUFFER_SIZE (256 * 1024)
+
+/*
+ * File layout: this header, then one record per dispatch:
+ *
+ *   varint  microseconds since the previous record
+ *   varint  enum discord_gateway_events
+ *   varint  shard ID
+ *   varint  payload length
+ *   bytes   raw JSON payload of the dispatch ("d")
+ *
+ * A truncated last record (the process died mid-write) is ignored.
+ */
+struct gateway_recording_header
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint64_t started_at_ms;
+};
+
+typedef struct gateway_recorder
+{
+    FILE *file;
+    char *buffer;
+    pthread_mutex_t lock;
+    uint64_t last_at_us;
+    uint64_t events;
+    uint64_t bytes;
+} gateway_recorder_t;
+
+typedef struct gateway_recorded_event
+{
+    /* Time since the first record. */
+    uint64_t at_ns;
+    enum discord_gateway_events event;
+    size_t shard_id;
+    const char *data;
+    size_t size;
+} gateway_recorded_event_t;
+
+typedef struct gateway_recording
+{
+    unsigned char *data;
+    size_t length;
+    size_t cursor;
+    uint64_t at_us;
+    uint64_t started_at_ms;
+} gateway_recording_t;
+
+extern gateway_recorder_t *gateway_recorder;
+
+gateway_recorder_t *gateway_recorder_open(const char *path);
+void gateway_recorder_write(gateway_recorder_t *recorder, struct discord *client, enum discord_gateway_events event,
+                            const char *data, size_t size);
+void gateway_recorder_close(gateway_recorder_t *recorder);
+
+gateway_recording_t *gateway_recording_open(const char *path);
+bool gateway_recording_next(gateway_recording_t *recording, gateway_recorded_event_t *event);
+void gateway_recording_rewind(gateway_recording_t *recording);
+void gateway_recording_free(gateway_recording_t *recording);
+
+#endif /* SUDOBOT_GATEWAY_RECORDER_H */
@@ -0,0 +1,267 @@
+#define _GNU_SOURCE
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <concord/discord.h>
+#include <concord/discord-internal.h>
+#include "session.h"
+#include "shard.h"
+#include "../io/log.h"
+#include "../utils/crc32.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+/*
+ * Session state lives in concord's internal gateway structures; everything
+ * that touches them is kept in this file.
+ */
+
+static struct gateway_session_file *loaded = NULL;
+/* Per-shard flag: a RESUME was sent and neither READY nor RESUMED has arrived yet. */
+static _Atomic bool *resume_pending = NULL;
+static size_t resume_pending_count = 0;
+static _Atomic uint64_t stats_identified = 0;
+static _Atomic uint64_t stats_resumed = 0;
+static _Atomic uint64_t stats_resume_failed = 0;
+static _Atomic int stats_last_path = GATEWAY_SESSION_PATH_NONE;
+
+static uint64_t gateway_session_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static uint32_t gateway_session_checksum(const struct gateway_session_file *file)
+{
+    return crc32c(crc32c(0, &file->saved_at_ms, sizeof file->saved_at_ms), file->entries,
+                  file->count * sizeof (struct gateway_session_entry));
+}
+
+static size_t gateway_session_shard_id(struct discord *client)
+{
+    shard_t *shard = shard_from_client(client);
+    return shard == NULL ? 0 : shard->id;
+}
+
+/**
+ * @brief Reads the state file left by the previous process. Stale or
+ * damaged state is ignored, and every shard will IDENTIFY.
+ */
+bool gateway_session_load(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    struct gateway_session_file header;
+
+    if (file == NULL)
+        return false;
+
+    if (fread(&header, sizeof header, 1, file) != 1 || header.magic != GATEWAY_SESSION_MAGIC ||
+        header.version != GATEWAY_SESSION_VERSION || header.count == 0 || header.count > 65536)
+    {
+        fclose(file);
+        return false;
+    }
+
+    struct gateway_session_file *state = xmalloc(sizeof header + header.count * sizeof (struct gateway_session_entry));
+    *state = header;
+
+    bool valid = fread(state->entries, sizeof (struct gateway_session_entry), header.count, file) == header.count &&
+                 state->checksum == gateway_session_checksum(state);
+    uint64_t now = gateway_session_now_ms();
+
+    fclose(file);
+
+    /* A state file is only good for one start. */
+    unlink(path);
+
+    if (!valid || now < state->saved_at_ms || now - state->saved_at_ms > GATEWAY_SESSION_MAX_AGE_MS)
+    {
+        log_info("gateway: ignoring %s session state", valid ? "stale" : "damaged");
+        free(state);
+        return false;
+    }
+
+    free(loaded);
+    loaded = state;
+    return true;
+}
+
+/**
+ * @brief Primes the client's gateway with the saved session, so that its
+ * first connection sends RESUME instead of IDENTIFY.
+ */
+void gateway_session_restore(struct discord *client, size_t shard_id, size_t shard_count)
+{
+    if (resume_pending == NULL || resume_pending_count < shard_count)
+    {
+        free((void *) resume_pending);
+        resume_pending = xcalloc(shard_count, sizeof (*resume_pending));
+        resume_pending_count = shard_count;
+    }
+
+    if (loaded == NULL)
+        return;
+
+    for (uint32_t i = 0; i < loaded->count; i++)
+    {
+        const struct gateway_session_entry *entry = &loaded->entries[i];
+        struct discord_gateway_session *session = client->gw.session;
+
+        if (entry->shard_id != shard_id || entry->shard_count != shard_count || entry->session_id[0] == 0 ||
+            memchr(entry->session_id, 0, sizeof entry->session_id) == NULL ||
+            memchr(entry->resume_url, 0, sizeof entry->resume_url) == NULL)
+            continue;
+
+        snprintf(session->id, sizeof session->id, "%s", entry->session_id);
+        snprintf(session->resume_url, sizeof session->resume_url, "%s", entry->resume_url);
+        client->gw.payload.seq = entry->sequence;
+        session->status |= DISCORD_SESSION_RESUMABLE;
+        atomic_store(&resume_pending[shard_id], true);
+
+        log_info("gateway: shard %zu will try to resume session %s at sequence %d", shard_id, session->id,
+                 entry->sequence);
+        return;
+    }
+}
+
+/**
+ * @brief Writes the session of every client to path, to be resumed by the
+ * next process.
+ */
+bool gateway_session_save(const char *path, struct discord *const *clients, size_t count)
+{
+    struct gateway_session_file *state = xcalloc(1, sizeof (*state) + count * sizeof (struct gateway_session_entry));
+    char *temporary_path = NULL;
+    bool ret = false;
+
+    state->magic = GATEWAY_SESSION_MAGIC;
+    state->version = GATEWAY_SESSION_VERSION;
+    state->saved_at_ms = gateway_session_now_ms();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const struct discord_gateway *gw = &clients[i]->gw;
+        struct gateway_session_entry *entry = &state->entries[state->count];
+
+        if (gw->session == NULL || gw->session->id[0] == 0)
+            continue;
+
+        entry->shard_id = (uint32_t) i;
+        entry->shard_count = (uint32_t) count;
+        entry->sequence = gw->payload.seq;
+        snprintf(entry->session_id, sizeof entry->session_id, "%s", gw->session->id);
+        snprintf(entry->resume_url, sizeof entry->resume_url, "%s", gw->session->resume_url);
+        state->count++;
+    }
+
+    state->checksum = gateway_session_checksum(state);
+
+    if (state->count == 0 || asprintf(&temporary_path, "%s.tmp", path) < 0)
+    {
+        free(state);
+        return false;
+    }
+
+    FILE *file = fopen(temporary_path, "wb");
+    size_t size = sizeof (*state) + state->count * sizeof (struct gateway_session_entry);
+
+    if (file != NULL)
+    {
+        bool written = fwrite(state, size, 1, file) == 1 && fflush(file) == 0 && fdatasync(fileno(file)) == 0;
+        ret = fclose(file) == 0 && written && rename(temporary_path, path) == 0;
+    }
+
+    if (ret)
+        log_info("gateway: saved %u session(s) to %s", state->count, path);
+    else
+        log_error("gateway: failed to save session state to %s: %s", path, get_last_error());
+
+    free(temporary_path);
+    free(state);
+    return ret;
+}
+
+/*
+ * Ends the gateway loop without invalidating the session. A normal close
+ * (1000) makes Discord discard the session, so close with concord's
+ * reconnect code instead. When the close frame comes back with that code,
+ * concord turns retrying back on, so the retry limit is also set to 0:
+ * discord_gateway_end() then stops on the first attempt and discord_run()
+ * returns rather than resuming.
+ */
+void gateway_session_shutdown(struct discord *client)
+{
+    static const char reason[] = "Restarting";
+
+    if (client->gw.session == NULL || client->gw.ws == NULL)
+    {
+        discord_shutdown(client);
+        return;
+    }
+
+    client->gw.session->status = DISCORD_SESSION_SHUTDOWN;
+    client->gw.session->retry.enable = false;
+    client->gw.session->retry.limit = 0;
+    ws_close(client->gw.ws, (enum ws_close_reason) DISCORD_GATEWAY_CLOSE_REASON_RECONNECT, reason,
+             sizeof reason - 1);
+}
+
+static void gateway_session_record(gateway_session_path_t path, size_t shard_id)
+{
+    atomic_store(&stats_last_path, (int) path);
+    log_info("gateway: shard %zu connected via %s", shard_id, gateway_session_path_name(path));
+}
+
+void gateway_session_on_ready(struct discord *client)
+{
+    size_t shard_id = gateway_session_shard_id(client);
+    bool pending = shard_id < resume_pending_count && atomic_exchange(&resume_pending[shard_id], false);
+
+    atomic_fetch_add(&stats_identified, 1);
+
+    if (pending)
+        atomic_fetch_add(&stats_resume_failed, 1);
+
+    gateway_session_record(pending ? GATEWAY_SESSION_PATH_RESUME_FAILED : GATEWAY_SESSION_PATH_IDENTIFY, shard_id);
+}
+
+void gateway_session_on_resumed(struct discord *client)
+{
+    size_t shard_id = gateway_session_shard_id(client);
+
+    if (shard_id < resume_pending_count)
+        atomic_store(&resume_pending[shard_id], false);
+
+    atomic_fetch_add(&stats_resumed, 1);
+    gateway_session_record(GATEWAY_SESSION_PATH_RESUME, shard_id);
+}
+
+void gateway_session_get_stats(gateway_session_stats_t *stats)
+{
+    stats->identified = atomic_load(&stats_identified);
+    stats->resumed = atomic_load(&stats_resumed);
+    stats->resume_failed = atomic_load(&stats_resume_failed);
+    stats->last_path = (gateway_session_path_t) atomic_load(&stats_last_path);
+}
+
+const char *gateway_session_path_name(gateway_session_path_t path)
+{
+    switch (path)
+    {
+        case GATEWAY_SESSION_PATH_IDENTIFY:
+            return "identify";
+
+        case GATEWAY_SESSION_PATH_RESUME:
+            return "resume";
+
+        case GATEWAY_SESSION_PATH_RESUME_FAILED:
+            return "identify (resume failed)";
+
+        default:
+            return "none";
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef SUDOBOT_GATEWAY_SESSION_H
+#define SUDOBOT_GATEWAY_SESSION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <concord/discord.h>
+
+#define GATEWAY_SESSION_MAGIC 0x53424753 /* "SBGS" */
+#define GATEWAY_SESSION_VERSION 2
+/* Discord drops resumable sessions after a few minutes; older state is not worth trying. */
+#define GATEWAY_SESSION_MAX_AGE_MS (3ULL * 60 * 1000)
+
+struct gateway_session_entry
+{
+    uint32_t shard_id;
+    uint32_t shard_count;
+    int32_t sequence;
+    uint32_t reserved;
+    /* Sized like the fields of concord's discord_gateway_session, so nothing is cut short. */
+    char session_id[64];
+    char resume_url[1024];
+};
+
+struct gateway_session_file
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t checksum;
+    uint64_t saved_at_ms;
+    struct gateway_session_entry entries[];
+};
+
+/* How the most recent connection of a shard was established. */
+typedef enum gateway_session_path
+{
+    GATEWAY_SESSION_PATH_NONE,
+    GATEWAY_SESSION_PATH_IDENTIFY,
+    GATEWAY_SESSION_PATH_RESUME,
+    /* A RESUME was attempted, rejected, and followed by a fresh IDENTIFY. */
+    GATEWAY_SESSION_PATH_RESUME_FAILED,
+} gateway_session_path_t;
+
+typedef struct gateway_session_stats
+{
+    uint64_t identified;
+    uint64_t resumed;
+    uint64_t resume_failed;
+    gateway_session_path_t last_path;
+} gateway_session_stats_t;
+
+bool gateway_session_load(const char *path);
+void gateway_session_restore(struct discord *client, size_t shard_id, size_t shard_count);
+bool gateway_session_save(const char *path, struct discord *const *clients, size_t count);
+void gateway_session_shutdown(struct discord *client);
+void gateway_session_on_ready(struct discord *client);
+void gateway_session_on_resumed(struct discord *client);
+void gateway_session_get_stats(gateway_session_stats_t *stats);
+const char *gateway_session_path_name(gateway_session_path_t path);
+
+#endif /* SUDOBOT_GATEWAY_SESSION_H */
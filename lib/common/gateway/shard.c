@@ -0,0 +1,362 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <concord/discord.h>
+#include <concord/discord-internal.h>
+#include "shard.h"
+#include "../io/log.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+static const char *const shard_state_names[] = {
+    [SHARD_STATE_IDLE] = "idle",
+    [SHARD_STATE_WAITING_IDENTIFY] = "waiting-identify",
+    [SHARD_STATE_CONNECTING] = "connecting",
+    [SHARD_STATE_READY] = "ready",
+    [SHARD_STATE_STOPPED] = "stopped",
+};
+
+const char *shard_state_name(shard_state_t state)
+{
+    return shard_state_names[state];
+}
+
+size_t shard_for_guild(u64snowflake guild_id, size_t count)
+{
+    return (size_t) ((guild_id >> 22) % count);
+}
+
+shard_t *shard_from_client(struct discord *client)
+{
+    return discord_get_data(client);
+}
+
+bool shard_owns_guild(struct discord *client, u64snowflake guild_id)
+{
+    shard_t *shard = shard_from_client(client);
+
+    if (shard == NULL)
+        return true;
+
+    return shard_for_guild(guild_id, shard->runtime->count) == shard->id;
+}
+
+void shard_record_event(struct discord *client, shard_event_type_t type, uint64_t started_at_ns)
+{
+    shard_t *shard = shard_from_client(client);
+
+    if (shard == NULL)
+        return;
+
+    uint64_t now = get_monotonic_time_ns();
+    uint64_t elapsed = now - started_at_ns;
+    uint64_t max = atomic_load_explicit(&shard->dispatch_max_ns, memory_order_relaxed);
+
+    atomic_fetch_add_explicit(&shard->events, 1, memory_order_relaxed);
+    atomic_store_explicit(&shard->last_event_at_ns, now, memory_order_relaxed);
+    atomic_fetch_add_explicit(&shard->dispatch_total_ns, elapsed, memory_order_relaxed);
+
+    while (elapsed > max &&
+           !atomic_compare_exchange_weak_explicit(&shard->dispatch_max_ns, &max, elapsed, memory_order_relaxed,
+                                                  memory_order_relaxed))
+        ;
+
+    switch (type)
+    {
+        case SHARD_EVENT_READY:
+            atomic_fetch_add_explicit(&shard->ready_count, 1, memory_order_relaxed);
+            atomic_store(&shard->state, SHARD_STATE_READY);
+            break;
+
+        case SHARD_EVENT_MESSAGE:
+            atomic_fetch_add_explicit(&shard->messages, 1, memory_order_relaxed);
+            break;
+
+        case SHARD_EVENT_INTERACTION:
+            atomic_fetch_add_explicit(&shard->interactions, 1, memory_order_relaxed);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void shard_get_stats(shard_t *shard, shard_stats_t *stats)
+{
+    uint64_t events = atomic_load_explicit(&shard->events, memory_order_relaxed);
+    uint64_t last_event_at = atomic_load_explicit(&shard->last_event_at_ns, memory_order_relaxed);
+
+    stats->id = shard->id;
+    stats->state = atomic_load(&shard->state);
+    stats->events = events;
+    stats->messages = atomic_load_explicit(&shard->messages, memory_order_relaxed);
+    stats->interactions = atomic_load_explicit(&shard->interactions, memory_order_relaxed);
+    stats->ready_count = atomic_load_explicit(&shard->ready_count, memory_order_relaxed);
+    stats->idle_ms = last_event_at == 0 ? 0 : (get_monotonic_time_ns() - last_event_at) / 1000000;
+    stats->dispatch_avg_ns =
+        events == 0 ? 0 : atomic_load_explicit(&shard->dispatch_total_ns, memory_order_relaxed) / events;
+    stats->dispatch_max_ns = atomic_load_explicit(&shard->dispatch_max_ns, memory_order_relaxed);
+    stats->gateway_ping_ms = stats->state == SHARD_STATE_READY ? discord_get_ping(shard->client) : -1;
+}
+
+/*
+ * Reserves the next IDENTIFY slot in this shard's concurrency bucket and
+ * sleeps until it is due. Shards in different buckets do not wait for
+ * each other.
+ */
+static void shard_wait_identify(shard_t *shard)
+{
+    shard_runtime_t *runtime = shard->runtime;
+    size_t bucket = shard->id % runtime->identify_concurrency;
+    uint64_t now = get_monotonic_time_ns();
+    uint64_t due;
+
+    pthread_mutex_lock(&runtime->identify_lock);
+    due = runtime->identify_next_at_ns[bucket];
+
+    if (due < now)
+        due = now;
+
+    runtime->identify_next_at_ns[bucket] = due + (SHARD_IDENTIFY_INTERVAL_MS * 1000000ULL);
+    pthread_mutex_unlock(&runtime->identify_lock);
+
+    if (due > now)
+    {
+        uint64_t delay = due - now;
+        struct timespec ts = { .tv_sec = delay / 1000000000ULL, .tv_nsec = delay % 1000000000ULL };
+
+        log_debug("shard %zu: waiting %lu ms for identify slot in bucket %zu", shard->id, delay / 1000000, bucket);
+
+        while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+            ;
+    }
+}
+
+static void *shard_thread_main(void *data)
+{
+    shard_t *shard = data;
+    shard_runtime_t *runtime = shard->runtime;
+
+    atomic_store(&shard->state, SHARD_STATE_WAITING_IDENTIFY);
+    shard_wait_identify(shard);
+
+    atomic_store(&shard->state, SHARD_STATE_CONNECTING);
+    log_info("shard %zu/%zu: connecting", shard->id, runtime->count);
+
+    CCORDcode code = discord_run(shard->client);
+
+    if (code != CCORD_OK)
+        log_error("shard %zu: gateway loop exited: %s", shard->id, discord_strerror(code, shard->client));
+
+    atomic_store(&shard->state, SHARD_STATE_STOPPED);
+
+    pthread_mutex_lock(&runtime->lock);
+    runtime->running--;
+    pthread_cond_broadcast(&runtime->stopped);
+    pthread_mutex_unlock(&runtime->lock);
+
+    return NULL;
+}
+
+/*
+ * Concord does not expose a public setter for the shard pair sent in
+ * IDENTIFY, so it is written into the gateway identify payload directly.
+ */
+static void shard_set_identity(shard_t *shard)
+{
+    struct discord_identify *identify = &shard->client->gw.id;
+    struct integers *pair = xcalloc(1, sizeof (*pair));
+
+    pair->array = xcalloc(2, sizeof (int));
+    pair->array[0] = (int) shard->id;
+    pair->array[1] = (int) shard->runtime->count;
+    pair->size = 2;
+    pair->realsize = 2;
+    identify->shard = pair;
+}
+
+shard_runtime_t *shard_runtime_init(const char *token, size_t count, size_t identify_concurrency,
+                                    shard_setup_callback_t setup)
+{
+    shard_runtime_t *runtime = xcalloc(1, sizeof (*runtime));
+
+    runtime->count = count;
+    runtime->identify_concurrency = identify_concurrency == 0 ? 1 : identify_concurrency;
+    runtime->shards = xcalloc(count, sizeof (shard_t));
+    runtime->identify_next_at_ns = xcalloc(runtime->identify_concurrency, sizeof (uint64_t));
+    pthread_mutex_init(&runtime->identify_lock, NULL);
+    pthread_mutex_init(&runtime->lock, NULL);
+    pthread_cond_init(&runtime->stopped, NULL);
+
+    ccord_global_init();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        shard_t *shard = &runtime->shards[i];
+
+        shard->id = i;
+        shard->runtime = runtime;
+        shard->client = discord_init(token);
+
+        if (shard->client == NULL)
+        {
+            log_error("shard %zu: failed to create the client", i);
+            runtime->count = i;
+            shard_runtime_free(runtime);
+            return NULL;
+        }
+
+        atomic_init(&shard->state, SHARD_STATE_IDLE);
+        discord_set_data(shard->client, shard);
+        shard_set_identity(shard);
+        setup(shard->client);
+    }
+
+    return runtime;
+}
+
+/**
+ * @brief Starts every shard on its own thread and blocks until all of them stop.
+ *
+ * SIGTERM and SIGINT are blocked on the shard threads so that they are
+ * always delivered to the calling thread.
+ */
+bool shard_runtime_run(shard_runtime_t *runtime)
+{
+    sigset_t set, old_set;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGTERM);
+    sigaddset(&set, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &set, &old_set);
+
+    pthread_mutex_lock(&runtime->lock);
+
+    for (size_t i = 0; i < runtime->count; i++)
+    {
+        shard_t *shard = &runtime->shards[i];
+        int err = pthread_create(&shard->thread, NULL, &shard_thread_main, shard);
+
+        if (err != 0)
+        {
+            log_error("shard %zu: failed to create thread: %s", i, strerror(err));
+            atomic_store(&shard->state, SHARD_STATE_STOPPED);
+            continue;
+        }
+
+        shard->started = true;
+        runtime->running++;
+    }
+
+    pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+
+    bool stopping = false;
+    unsigned int ticks = 0;
+
+    while (runtime->running > 0)
+    {
+        struct timespec deadline;
+
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += 1;
+
+        if (pthread_cond_timedwait(&runtime->stopped, &runtime->lock, &deadline) != ETIMEDOUT)
+            continue;
+
+        pthread_mutex_unlock(&runtime->lock);
+
+        if (runtime->stop_requested && !stopping)
+        {
+            log_info("Stopping %zu shard(s)", runtime->count);
+            shard_runtime_shutdown(runtime);
+            stopping = true;
+        }
+        else if (++ticks % SHARD_HEALTH_LOG_INTERVAL_SEC == 0)
+            shard_runtime_log_health(runtime);
+
+        pthread_mutex_lock(&runtime->lock);
+    }
+
+    pthread_mutex_unlock(&runtime->lock);
+
+    for (size_t i = 0; i < runtime->count; i++)
+    {
+        if (runtime->shards[i].started)
+            pthread_join(runtime->shards[i].thread, NULL);
+    }
+
+    return true;
+}
+
+/*
+ * Only sets a flag, so this is safe to call from a signal handler; the
+ * thread blocked in shard_runtime_run() performs the actual shutdown.
+ */
+void shard_runtime_request_stop(shard_runtime_t *runtime)
+{
+    runtime->stop_requested = 1;
+}
+
+void shard_runtime_shutdown(shard_runtime_t *runtime)
+{
+    for (size_t i = 0; i < runtime->count; i++)
+        discord_shutdown(runtime->shards[i].client);
+}
+
+void shard_runtime_log_health(shard_runtime_t *runtime)
+{
+    for (size_t i = 0; i < runtime->count; i++)
+    {
+        shard_stats_t stats;
+        shard_get_stats(&runtime->shards[i], &stats);
+
+        log_info("shard %zu: %s, ping %d ms, events %lu (messages %lu, interactions %lu), ready %lu, "
+                 "idle %lu ms, dispatch avg %lu ns max %lu ns",
+                 stats.id, shard_state_name(stats.state), stats.gateway_ping_ms, stats.events, stats.messages,
+                 stats.interactions, stats.ready_count, stats.idle_ms, stats.dispatch_avg_ns, stats.dispatch_max_ns);
+    }
+}
+
+/*
+ * Shuts every shard down and waits for their gateway loops to return, so
+ * no more events arrive. A shard thread calling this only waits for the
+ * others.
+ */
+void shard_runtime_stop(shard_runtime_t *runtime)
+{
+    size_t own = 0;
+
+    for (size_t i = 0; i < runtime->count; i++)
+    {
+        shard_t *shard = &runtime->shards[i];
+
+        if (shard->started && pthread_equal(shard->thread, pthread_self()) &&
+            atomic_load(&shard->state) != SHARD_STATE_STOPPED)
+            own = 1;
+    }
+
+    shard_runtime_shutdown(runtime);
+    pthread_mutex_lock(&runtime->lock);
+
+    while (runtime->running > own)
+        pthread_cond_wait(&runtime->stopped, &runtime->lock);
+
+    pthread_mutex_unlock(&runtime->lock);
+}
+
+void shard_runtime_free(shard_runtime_t *runtime)
+{
+    for (size_t i = 0; i < runtime->count; i++)
+        discord_cleanup(runtime->shards[i].client);
+
+    ccord_global_cleanup();
+    pthread_mutex_destroy(&runtime->identify_lock);
+    pthread_mutex_destroy(&runtime->lock);
+    pthread_cond_destroy(&runtime->stopped);
+    free(runtime->identify_next_at_ns);
+    free(runtime->shards);
+    free(runtime);
+}
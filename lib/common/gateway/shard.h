@@ -0,0 +1,99 @@
+#ifndef SUDOBOT_GATEWAY_SHARD_H
+#define SUDOBOT_GATEWAY_SHARD_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <signal.h>
+#include <concord/discord.h>
+
+/* Minimum spacing between two IDENTIFYs in the same concurrency bucket. */
+#define SHARD_IDENTIFY_INTERVAL_MS 5000
+#define SHARD_HEALTH_LOG_INTERVAL_SEC 60
+
+typedef enum shard_state
+{
+    SHARD_STATE_IDLE,
+    SHARD_STATE_WAITING_IDENTIFY,
+    SHARD_STATE_CONNECTING,
+    SHARD_STATE_READY,
+    SHARD_STATE_STOPPED
+} shard_state_t;
+
+typedef enum shard_event_type
+{
+    SHARD_EVENT_READY,
+    SHARD_EVENT_MESSAGE,
+    SHARD_EVENT_INTERACTION,
+    SHARD_EVENT_OTHER,
+} shard_event_type_t;
+
+struct shard_runtime;
+
+typedef struct shard
+{
+    size_t id;
+    struct discord *client;
+    struct shard_runtime *runtime;
+    pthread_t thread;
+    bool started;
+    _Atomic shard_state_t state;
+    _Atomic uint64_t events;
+    _Atomic uint64_t messages;
+    _Atomic uint64_t interactions;
+    _Atomic uint64_t ready_count;
+    _Atomic uint64_t last_event_at_ns;
+    _Atomic uint64_t dispatch_total_ns;
+    _Atomic uint64_t dispatch_max_ns;
+    /* When the next REQUEST_GUILD_MEMBERS may go out; only used on the shard's thread. */
+    uint64_t member_request_at_ms;
+} shard_t;
+
+typedef struct shard_stats
+{
+    size_t id;
+    shard_state_t state;
+    uint64_t events;
+    uint64_t messages;
+    uint64_t interactions;
+    uint64_t ready_count;
+    uint64_t idle_ms;
+    uint64_t dispatch_avg_ns;
+    uint64_t dispatch_max_ns;
+    int gateway_ping_ms;
+} shard_stats_t;
+
+typedef void (*shard_setup_callback_t)(struct discord *client);
+
+typedef struct shard_runtime
+{
+    size_t count;
+    size_t identify_concurrency;
+    shard_t *shards;
+    uint64_t *identify_next_at_ns;
+    pthread_mutex_t identify_lock;
+    pthread_mutex_t lock;
+    pthread_cond_t stopped;
+    size_t running;
+    volatile sig_atomic_t stop_requested;
+} shard_runtime_t;
+
+shard_runtime_t *shard_runtime_init(const char *token, size_t count, size_t identify_concurrency,
+                                    shard_setup_callback_t setup);
+bool shard_runtime_run(shard_runtime_t *runtime);
+void shard_runtime_request_stop(shard_runtime_t *runtime);
+void shard_runtime_shutdown(shard_runtime_t *runtime);
+void shard_runtime_stop(shard_runtime_t *runtime);
+void shard_runtime_free(shard_runtime_t *runtime);
+void shard_runtime_log_health(shard_runtime_t *runtime);
+
+size_t shard_for_guild(u64snowflake guild_id, size_t count);
+shard_t *shard_from_client(struct discord *client);
+bool shard_owns_guild(struct discord *client, u64snowflake guild_id);
+void shard_record_event(struct discord *client, shard_event_type_t type, uint64_t started_at_ns);
+void shard_get_stats(shard_t *shard, shard_stats_t *stats);
+const char *shard_state_name(shard_state_t state);
+
+#endif /* SUDOBOT_GATEWAY_SHARD_H */
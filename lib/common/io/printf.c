@@ -45,7 +45,7 @@ casprintf_buffer_concat_str(char **buffer, size_t *buffer_size, const char *str)
     *buffer_size += len;
     size_t size = *buffer_size;
     *buffer = xrealloc(*buffer, size);
-    strncat(*buffer, str, len);
+    memcpy(*buffer + size - len, str, len);
 }
 
 static format_flags_t casprintf_length_flags(
@@ -217,12 +217,12 @@ static void casprintf_concat(
         if (is_negative)
             casprintf_buffer_push_char(buffer, buffer_size, '-');
 
-        size_t i = (literal_size != 0 ? literal_size : numbuf_size) - 1;
+        size_t i = numbuf_size - 1;
 
-        if (zero && literal_size > numbuf_size)
+        if (literal_size > numbuf_size)
         {
             for (size_t zi = 0; zi < (literal_size - numbuf_size); zi++)
-                casprintf_buffer_push_char(buffer, buffer_size, '0');
+                casprintf_buffer_push_char(buffer, buffer_size, zero ? '0' : ' ');
         }
 
         while (true)
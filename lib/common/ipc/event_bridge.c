@@ -0,0 +1,202 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <concord/discord.h>
+#include "event_bridge.h"
+#include "../io/log.h"
+#include "../rest/scheduler.h"
+#include "../utils/xmalloc.h"
+
+#define EVENT_BRIDGE_WAIT_MS 250
+
+event_bridge_t *event_bridge = NULL;
+
+static void event_bridge_ring_name(char *buffer, size_t size, const char *name, const char *kind)
+{
+    snprintf(buffer, size, "/sudobot-%s-%s", name, kind);
+}
+
+/**
+ * @brief Creates both rings; used by the side that owns the gateway.
+ */
+event_bridge_t *event_bridge_create(const char *name)
+{
+    char ring_name[EVENT_BRIDGE_NAME_MAX + 32];
+    event_bridge_t *bridge = xcalloc(1, sizeof (*bridge));
+
+    event_bridge_ring_name(ring_name, sizeof ring_name, name, "events");
+    bridge->events = ipc_ring_create(ring_name, EVENT_BRIDGE_RING_CAPACITY);
+    event_bridge_ring_name(ring_name, sizeof ring_name, name, "actions");
+    bridge->actions = ipc_ring_create(ring_name, EVENT_BRIDGE_RING_CAPACITY);
+    bridge->owns_gateway = true;
+
+    if (bridge->events == NULL || bridge->actions == NULL)
+    {
+        event_bridge_free(bridge);
+        return NULL;
+    }
+
+    return bridge;
+}
+
+/**
+ * @brief Maps the rings created by the other side of the bridge.
+ */
+event_bridge_t *event_bridge_attach(const char *name)
+{
+    char ring_name[EVENT_BRIDGE_NAME_MAX + 32];
+    event_bridge_t *bridge = xcalloc(1, sizeof (*bridge));
+
+    event_bridge_ring_name(ring_name, sizeof ring_name, name, "events");
+    bridge->events = ipc_ring_open(ring_name);
+    event_bridge_ring_name(ring_name, sizeof ring_name, name, "actions");
+    bridge->actions = ipc_ring_open(ring_name);
+    bridge->owns_gateway = false;
+
+    if (bridge->events == NULL || bridge->actions == NULL)
+    {
+        event_bridge_free(bridge);
+        return NULL;
+    }
+
+    return bridge;
+}
+
+void event_bridge_free(event_bridge_t *bridge)
+{
+    if (bridge == NULL)
+        return;
+
+    bridge->running = false;
+
+    if (bridge->action_thread_started)
+    {
+        ipc_ring_wake(bridge->actions);
+        pthread_join(bridge->action_thread, NULL);
+    }
+
+    ipc_ring_close(bridge->events);
+    ipc_ring_close(bridge->actions);
+    free(bridge);
+}
+
+bool event_bridge_publish_message(event_bridge_t *bridge, const struct discord_message *message)
+{
+    const char *content = message->content == NULL ? "" : message->content;
+    struct bridge_message_record record = {
+        .id = message->id,
+        .channel_id = message->channel_id,
+        .guild_id = message->guild_id,
+        .author_id = message->author == NULL ? 0 : message->author->id,
+        .timestamp = message->timestamp,
+        .flags = message->author != NULL && message->author->bot ? BRIDGE_MESSAGE_AUTHOR_BOT : 0,
+        .attachment_count = message->attachments == NULL ? 0 : (uint32_t) message->attachments->size,
+        .content_length = (uint32_t) strlen(content),
+    };
+    const void *parts[] = { &record, content };
+    const uint32_t lengths[] = { sizeof record, record.content_length };
+
+    return ipc_ring_writev(bridge->events, BRIDGE_RECORD_MESSAGE_CREATE, parts, lengths, 2);
+}
+
+bool event_bridge_publish_interaction(event_bridge_t *bridge, const struct discord_interaction *interaction)
+{
+    const char *name = interaction->data == NULL || interaction->data->name == NULL ? "" : interaction->data->name;
+    const char *token = interaction->token == NULL ? "" : interaction->token;
+    const struct discord_user *user = interaction->member != NULL ? interaction->member->user : interaction->user;
+    struct bridge_interaction_record record = {
+        .id = interaction->id,
+        .application_id = interaction->application_id,
+        .channel_id = interaction->channel_id,
+        .guild_id = interaction->guild_id,
+        .user_id = user == NULL ? 0 : user->id,
+        .type = (uint32_t) interaction->type,
+        .name_length = (uint16_t) strlen(name),
+        .token_length = (uint16_t) strlen(token),
+    };
+    const void *parts[] = { &record, name, token };
+    const uint32_t lengths[] = { sizeof record, record.name_length, record.token_length };
+
+    return ipc_ring_writev(bridge->events, BRIDGE_RECORD_INTERACTION_CREATE, parts, lengths, 3);
+}
+
+bool event_bridge_execute_action(struct discord *client, const struct bridge_action_record *action,
+                                 const char *text)
+{
+    switch (action->action)
+    {
+        case BRIDGE_ACTION_DELETE_MESSAGE:
+            rest_delete_message(client, action->channel_id, action->message_id, REST_PRIORITY_MODERATION);
+            return true;
+
+        case BRIDGE_ACTION_BAN:
+            rest_ban_member(client, action->guild_id, action->user_id, (int) action->delete_message_seconds, text);
+            return true;
+
+        case BRIDGE_ACTION_LOG:
+        {
+            struct discord_create_message params = { .content = (char *) text };
+            rest_create_message(client, action->channel_id, &params, REST_PRIORITY_LOG);
+            return true;
+        }
+
+        default:
+            log_warn("bridge: unknown action %u", action->action);
+            return false;
+    }
+}
+
+static void *event_bridge_action_thread(void *data)
+{
+    event_bridge_t *bridge = data;
+    struct discord *client = bridge->action_client;
+
+    while (bridge->running)
+    {
+        const struct ipc_record *record = ipc_ring_peek(bridge->actions);
+
+        if (record == NULL)
+        {
+            ipc_ring_wait(bridge->actions, EVENT_BRIDGE_WAIT_MS);
+            continue;
+        }
+
+        if (record->type == BRIDGE_RECORD_ACTION && record->length >= sizeof (struct bridge_action_record))
+        {
+            const struct bridge_action_record *action = ipc_record_payload(record);
+            size_t text_length = record->length - sizeof (*action);
+            char *text = NULL;
+
+            if (action->text_length > 0 && action->text_length <= text_length)
+                text = strndup((const char *) (action + 1), action->text_length);
+
+            event_bridge_execute_action(client, action, text);
+            free(text);
+        }
+
+        ipc_ring_release(bridge->actions, record);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Starts the thread that executes actions sent back over the bridge
+ * through the REST scheduler.
+ */
+bool event_bridge_start_actions(event_bridge_t *bridge, struct discord *client)
+{
+    bridge->running = true;
+    bridge->action_client = client;
+
+    if (pthread_create(&bridge->action_thread, NULL, &event_bridge_action_thread, bridge) != 0)
+    {
+        bridge->running = false;
+        log_error("bridge: failed to start the action thread");
+        return false;
+    }
+
+    bridge->action_thread_started = true;
+    return true;
+}
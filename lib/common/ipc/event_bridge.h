@@ -0,0 +1,42 @@
+#ifndef SUDOBOT_IPC_EVENT_BRIDGE_H
+#define SUDOBOT_IPC_EVENT_BRIDGE_H
+
+#include <stdbool.h>
+#include <pthread.h>
+#include <concord/discord.h>
+#include "ring.h"
+#include "records.h"
+
+#define EVENT_BRIDGE_RING_CAPACITY (8 * 1024 * 1024)
+#define EVENT_BRIDGE_NAME_MAX 64
+
+/*
+ * Two rings per bridge: events flow from the side that owns the gateway
+ * to the other side, and actions/verdicts flow back. Only MESSAGE_CREATE
+ * and INTERACTION_CREATE are bridged; other dispatch events are handled
+ * on the gateway side alone.
+ */
+typedef struct event_bridge
+{
+    ipc_ring_t *events;
+    ipc_ring_t *actions;
+    bool owns_gateway;
+    volatile bool running;
+    pthread_t action_thread;
+    bool action_thread_started;
+    /* Client the action thread sends REST requests with. */
+    struct discord *action_client;
+} event_bridge_t;
+
+extern event_bridge_t *event_bridge;
+
+event_bridge_t *event_bridge_create(const char *name);
+event_bridge_t *event_bridge_attach(const char *name);
+void event_bridge_free(event_bridge_t *bridge);
+bool event_bridge_start_actions(event_bridge_t *bridge, struct discord *client);
+bool event_bridge_publish_message(event_bridge_t *bridge, const struct discord_message *message);
+bool event_bridge_publish_interaction(event_bridge_t *bridge, const struct discord_interaction *interaction);
+bool event_bridge_execute_action(struct discord *client, const struct bridge_action_record *action,
+                                 const char *text);
+
+#endif /* SUDOBOT_IPC_EVENT_BRIDGE_H */
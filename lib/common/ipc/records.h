@@ -0,0 +1,73 @@
+#ifndef SUDOBOT_IPC_RECORDS_H
+#define SUDOBOT_IPC_RECORDS_H
+
+#include <stdint.h>
+
+/*
+ * Fixed-layout records exchanged over the bridge rings. Variable-length
+ * strings follow the fixed part in the order of their length fields.
+ * Consumers on the other side of the bridge read these directly instead
+ * of decoding the gateway JSON a second time.
+ */
+
+enum bridge_record_type
+{
+    BRIDGE_RECORD_MESSAGE_CREATE = 1,
+    BRIDGE_RECORD_INTERACTION_CREATE = 2,
+    BRIDGE_RECORD_ACTION = 16,
+};
+
+enum bridge_message_flags
+{
+    BRIDGE_MESSAGE_AUTHOR_BOT = 1,
+};
+
+struct bridge_message_record
+{
+    uint64_t id;
+    uint64_t channel_id;
+    uint64_t guild_id;
+    uint64_t author_id;
+    uint64_t timestamp;
+    uint32_t flags;
+    uint32_t attachment_count;
+    uint32_t content_length;
+    uint32_t reserved;
+    /* char content[content_length]; */
+};
+
+struct bridge_interaction_record
+{
+    uint64_t id;
+    uint64_t application_id;
+    uint64_t channel_id;
+    uint64_t guild_id;
+    uint64_t user_id;
+    uint32_t type;
+    uint16_t name_length;
+    uint16_t token_length;
+    /* char name[name_length]; char token[token_length]; */
+};
+
+enum bridge_action_type
+{
+    BRIDGE_ACTION_NONE = 0,
+    BRIDGE_ACTION_DELETE_MESSAGE = 1,
+    BRIDGE_ACTION_BAN = 2,
+    BRIDGE_ACTION_LOG = 3,
+};
+
+struct bridge_action_record
+{
+    uint64_t guild_id;
+    uint64_t channel_id;
+    uint64_t message_id;
+    uint64_t user_id;
+    uint32_t action;
+    uint32_t delete_message_seconds;
+    uint32_t text_length;
+    uint32_t reserved;
+    /* char text[text_length]; reason for bans, content for log posts */
+};
+
+#endif /* SUDOBOT_IPC_RECORDS_H */
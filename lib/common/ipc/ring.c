@@ -0,0 +1,271 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include "ring.h"
+#include "../io/log.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define IPC_ALIGN_UP(n) (((n) + (IPC_RING_ALIGN - 1)) & ~((uint64_t) IPC_RING_ALIGN - 1))
+
+static long ipc_futex(_Atomic uint32_t *address, int op, uint32_t value, const struct timespec *timeout)
+{
+    return syscall(SYS_futex, (uint32_t *) address, op, value, timeout, NULL, 0);
+}
+
+/**
+ * @brief Creates (or truncates) a named ring of at least capacity bytes.
+ */
+ipc_ring_t *ipc_ring_create(const char *name, size_t capacity)
+{
+    size_t size = 4096;
+
+    while (size < capacity)
+        size <<= 1;
+
+    size_t mapping_size = sizeof (struct ipc_ring_header) + size;
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+
+    if (fd < 0)
+    {
+        log_error("ipc: %s: shm_open failed: %s", name, get_last_error());
+        return NULL;
+    }
+
+    if (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t) mapping_size) != 0)
+    {
+        log_error("ipc: %s: ftruncate failed: %s", name, get_last_error());
+        close(fd);
+        return NULL;
+    }
+
+    struct ipc_ring_header *header = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (header == MAP_FAILED)
+    {
+        log_error("ipc: %s: mmap failed: %s", name, get_last_error());
+        return NULL;
+    }
+
+    header->version = IPC_RING_VERSION;
+    header->capacity = size;
+    atomic_store(&header->head, 0);
+    atomic_store(&header->tail, 0);
+    atomic_store(&header->signal, 0);
+    atomic_store(&header->waiting, 0);
+    atomic_store(&header->dropped, 0);
+    atomic_thread_fence(memory_order_release);
+    header->magic = IPC_RING_MAGIC;
+
+    ipc_ring_t *ring = xcalloc(1, sizeof (*ring));
+    ring->header = header;
+    ring->mapping_size = mapping_size;
+    ring->name = strdup(name);
+    ring->owner = true;
+    pthread_mutex_init(&ring->write_lock, NULL);
+    return ring;
+}
+
+ipc_ring_t *ipc_ring_open(const char *name)
+{
+    int fd = shm_open(name, O_RDWR, 0600);
+    struct stat st;
+
+    if (fd < 0)
+    {
+        log_error("ipc: %s: shm_open failed: %s", name, get_last_error());
+        return NULL;
+    }
+
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof (struct ipc_ring_header))
+    {
+        log_error("ipc: %s: not a ring", name);
+        close(fd);
+        return NULL;
+    }
+
+    struct ipc_ring_header *header = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (header == MAP_FAILED)
+    {
+        log_error("ipc: %s: mmap failed: %s", name, get_last_error());
+        return NULL;
+    }
+
+    if (header->magic != IPC_RING_MAGIC || header->version != IPC_RING_VERSION ||
+        sizeof (struct ipc_ring_header) + header->capacity != (size_t) st.st_size)
+    {
+        log_error("ipc: %s: incompatible ring (magic %#x, version %u)", name, header->magic, header->version);
+        munmap(header, (size_t) st.st_size);
+        return NULL;
+    }
+
+    ipc_ring_t *ring = xcalloc(1, sizeof (*ring));
+    ring->header = header;
+    ring->mapping_size = (size_t) st.st_size;
+    ring->name = strdup(name);
+    ring->owner = false;
+    pthread_mutex_init(&ring->write_lock, NULL);
+    return ring;
+}
+
+void ipc_ring_close(ipc_ring_t *ring)
+{
+    if (ring == NULL)
+        return;
+
+    munmap(ring->header, ring->mapping_size);
+
+    if (ring->owner)
+        shm_unlink(ring->name);
+
+    pthread_mutex_destroy(&ring->write_lock);
+    free(ring->name);
+    free(ring);
+}
+
+/**
+ * @brief Appends one record made of the given parts. Safe to call from any
+ * thread of the producing process. Never waits for the consumer: if it has
+ * fallen behind, the record is dropped and counted instead.
+ */
+bool ipc_ring_writev(ipc_ring_t *ring, uint16_t type, const void *const *parts, const uint32_t *lengths,
+                     size_t count)
+{
+    struct ipc_ring_header *header = ring->header;
+    uint64_t capacity = header->capacity;
+    uint64_t length = 0;
+
+    for (size_t i = 0; i < count; i++)
+        length += lengths[i];
+
+    uint64_t size = sizeof (struct ipc_record) + IPC_ALIGN_UP(length);
+
+    pthread_mutex_lock(&ring->write_lock);
+
+    uint64_t head = atomic_load_explicit(&header->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&header->tail, memory_order_acquire);
+    uint64_t offset = head & (capacity - 1);
+    uint64_t padding = offset + size > capacity ? capacity - offset : 0;
+
+    if (length > UINT32_MAX || size > capacity / 2 || head + padding + size - tail > capacity)
+    {
+        pthread_mutex_unlock(&ring->write_lock);
+        atomic_fetch_add_explicit(&header->dropped, 1, memory_order_relaxed);
+        return false;
+    }
+
+    if (padding != 0)
+    {
+        struct ipc_record *pad = (struct ipc_record *) (header->data + offset);
+        pad->length = (uint32_t) (padding - sizeof (struct ipc_record));
+        pad->type = IPC_RECORD_PADDING;
+        pad->flags = 0;
+        head += padding;
+        offset = 0;
+    }
+
+    struct ipc_record *record = (struct ipc_record *) (header->data + offset);
+    unsigned char *payload = (unsigned char *) (record + 1);
+
+    record->length = (uint32_t) length;
+    record->type = type;
+    record->flags = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (lengths[i] != 0)
+            memcpy(payload, parts[i], lengths[i]);
+
+        payload += lengths[i];
+    }
+
+    atomic_store_explicit(&header->head, head + size, memory_order_release);
+    pthread_mutex_unlock(&ring->write_lock);
+    ipc_ring_wake(ring);
+    return true;
+}
+
+bool ipc_ring_write(ipc_ring_t *ring, uint16_t type, const void *payload, uint32_t length)
+{
+    return ipc_ring_writev(ring, type, &payload, &length, 1);
+}
+
+/* Returns the next record, or NULL if the ring is empty. */
+const struct ipc_record *ipc_ring_peek(ipc_ring_t *ring)
+{
+    struct ipc_ring_header *header = ring->header;
+
+    while (true)
+    {
+        uint64_t tail = atomic_load_explicit(&header->tail, memory_order_relaxed);
+        uint64_t head = atomic_load_explicit(&header->head, memory_order_acquire);
+
+        if (tail == head)
+            return NULL;
+
+        const struct ipc_record *record =
+            (const struct ipc_record *) (header->data + (tail & (header->capacity - 1)));
+
+        if (record->type != IPC_RECORD_PADDING)
+            return record;
+
+        atomic_store_explicit(&header->tail, tail + sizeof (struct ipc_record) + record->length,
+                              memory_order_release);
+    }
+}
+
+void ipc_ring_release(ipc_ring_t *ring, const struct ipc_record *record)
+{
+    struct ipc_ring_header *header = ring->header;
+    uint64_t tail = atomic_load_explicit(&header->tail, memory_order_relaxed);
+
+    atomic_store_explicit(&header->tail, tail + sizeof (struct ipc_record) + IPC_ALIGN_UP(record->length),
+                          memory_order_release);
+}
+
+/*
+ * Sleeps on the shared futex until a record is published or the timeout
+ * expires. The futex is not process-private, so producer and consumer
+ * may live in different processes.
+ */
+bool ipc_ring_wait(ipc_ring_t *ring, int timeout_ms)
+{
+    struct ipc_ring_header *header = ring->header;
+    uint32_t signal = atomic_load(&header->signal);
+    struct timespec timeout = { .tv_sec = timeout_ms / 1000, .tv_nsec = (timeout_ms % 1000) * 1000000L };
+
+    atomic_store(&header->waiting, 1);
+
+    if (ipc_ring_peek(ring) != NULL)
+    {
+        atomic_store(&header->waiting, 0);
+        return true;
+    }
+
+    long ret = ipc_futex(&header->signal, FUTEX_WAIT, signal, timeout_ms < 0 ? NULL : &timeout);
+    atomic_store(&header->waiting, 0);
+
+    return ret == 0 || errno == EAGAIN || ipc_ring_peek(ring) != NULL;
+}
+
+void ipc_ring_wake(ipc_ring_t *ring)
+{
+    struct ipc_ring_header *header = ring->header;
+
+    atomic_fetch_add(&header->signal, 1);
+
+    if (atomic_load(&header->waiting))
+        ipc_futex(&header->signal, FUTEX_WAKE, INT_MAX, NULL);
+}
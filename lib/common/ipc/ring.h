@@ -0,0 +1,76 @@
+#ifndef SUDOBOT_IPC_RING_H
+#define SUDOBOT_IPC_RING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define IPC_RING_MAGIC 0x53425247 /* "SBRG" */
+#define IPC_RING_VERSION 1
+#define IPC_RING_ALIGN 8
+
+enum ipc_record_type
+{
+    IPC_RECORD_PADDING = 0,
+};
+
+struct ipc_record
+{
+    uint32_t length;
+    uint16_t type;
+    uint16_t flags;
+};
+
+/*
+ * Shared-memory layout. The producer owns head and the consumer owns
+ * tail; both are byte offsets that only ever grow, wrapped into the data
+ * area with the capacity mask. One process produces; its threads take
+ * turns through the write lock of its ipc_ring_t.
+ */
+struct ipc_ring_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    _Alignas(64) _Atomic uint64_t head;
+    _Alignas(64) _Atomic uint64_t tail;
+    _Alignas(64) _Atomic uint32_t signal;
+    _Atomic uint32_t waiting;
+    _Atomic uint64_t dropped;
+    _Alignas(64) unsigned char data[];
+};
+
+typedef struct ipc_ring
+{
+    struct ipc_ring_header *header;
+    /* Serializes writers of this process, such as the shard threads. */
+    pthread_mutex_t write_lock;
+    size_t mapping_size;
+    char *name;
+    bool owner;
+} ipc_ring_t;
+
+ipc_ring_t *ipc_ring_create(const char *name, size_t capacity);
+ipc_ring_t *ipc_ring_open(const char *name);
+void ipc_ring_close(ipc_ring_t *ring);
+bool ipc_ring_write(ipc_ring_t *ring, uint16_t type, const void *payload, uint32_t length);
+bool ipc_ring_writev(ipc_ring_t *ring, uint16_t type, const void *const *parts, const uint32_t *lengths,
+                     size_t count);
+const struct ipc_record *ipc_ring_peek(ipc_ring_t *ring);
+void ipc_ring_release(ipc_ring_t *ring, const struct ipc_record *record);
+bool ipc_ring_wait(ipc_ring_t *ring, int timeout_ms);
+void ipc_ring_wake(ipc_ring_t *ring);
+
+static inline const void *ipc_record_payload(const struct ipc_record *record)
+{
+    return record + 1;
+}
+
+static inline uint64_t ipc_ring_dropped(const ipc_ring_t *ring)
+{
+    return atomic_load_explicit(&ring->header->dropped, memory_order_relaxed);
+}
+
+#endif /* SUDOBOT_IPC_RING_H */
@@ -19,13 +19,14 @@
 static struct option const long_options[] = {
     { "update", no_argument,       NULL, 'u' },
     { "env",    required_argument, NULL, 'e' },
+    { "shards", required_argument, NULL, 's' },
     { 0,        0,                 0,     0  }
 };
 
 int main(int argc, char **argv)
 {
     int longind = 0;
-    const char *shortopts = "ue:";
+    const char *shortopts = "ue:s:";
 
     opterr = 0;
 
@@ -46,6 +47,17 @@ int main(int argc, char **argv)
             case 'e':
                 opt_env_file_path = strdup(optarg);
                 break;
+
+            case 's':
+                opt_shard_count = strtoul(optarg, NULL, 10);
+
+                if (opt_shard_count == 0)
+                {
+                    log_error("Invalid shard count -- '%s'", optarg);
+                    exit(EXIT_FAILURE);
+                }
+
+                break;
             
             default:
                 if (optopt == 0)
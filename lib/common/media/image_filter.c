@@ -0,0 +1,457 @@
+#include <string.h>
+#include <sys/random.h>
+#include "image_filter.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define IMAGE_FILTER_MIN_KNOWN 64
+#define IMAGE_FILTER_MIN_SETS 64
+
+image_filter_t *image_filter = NULL;
+
+/* Attachments are served from both hosts under the same path. */
+static const char *const image_filter_discord_hosts[] = {
+    "https://cdn.discordapp.com/",
+    "https://media.discordapp.net/",
+};
+
+static uint64_t image_filter_mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+static uint64_t image_filter_hash(const char *data, size_t length, uint64_t seed)
+{
+    uint64_t hash = seed ^ (length * 0x9E3779B97F4A7C15ULL);
+    uint64_t tail = 0;
+
+    for (; length >= 8; data += 8, length -= 8)
+    {
+        uint64_t word;
+
+        memcpy(&word, data, sizeof (word));
+        hash = image_filter_mix(hash ^ word);
+    }
+
+    memcpy(&tail, data, length);
+    return image_filter_mix(hash ^ tail);
+}
+
+/*
+ * For Discord's attachment hosts the query string and fragment are
+ * dropped, since Discord signs attachment URLs with parameters that
+ * change, and both hosts map to the same key. Any other URL is keyed on
+ * all of it: elsewhere the query can select an entirely different image.
+ * The seeds are random per process, so keys cannot be collided on purpose.
+ */
+static void image_filter_url_key(const image_filter_t *filter, const char *url, size_t length, uint64_t key[2])
+{
+    uint64_t tag = 0;
+
+    for (size_t i = 0; i < sizeof (image_filter_discord_hosts) / sizeof (image_filter_discord_hosts[0]); i++)
+    {
+        size_t prefix = strlen(image_filter_discord_hosts[i]);
+
+        if (length >= prefix && memcmp(url, image_filter_discord_hosts[i], prefix) == 0)
+        {
+            const char *query = memchr(url, '?', length);
+            const char *fragment = memchr(url, '#', length);
+
+            if (query != NULL)
+                length = (size_t) (query - url);
+
+            if (fragment != NULL && (size_t) (fragment - url) < length)
+                length = (size_t) (fragment - url);
+
+            url += prefix;
+            length -= prefix;
+            tag = 0x5D;
+            break;
+        }
+    }
+
+    key[0] = image_filter_hash(url, length, filter->seed[0] ^ tag);
+    key[1] = image_filter_hash(url, length, filter->seed[1] ^ tag);
+
+    if (key[0] == 0 && key[1] == 0)
+        key[0] = 1;
+}
+
+image_filter_t *image_filter_init(const image_filter_config_t *config)
+{
+    image_filter_t *filter = xcalloc(1, sizeof (*filter));
+    size_t sets = IMAGE_FILTER_MIN_SETS;
+
+    while (sets * 2 < config->cache_entries)
+        sets <<= 1;
+
+    filter->config = *config;
+
+    if (filter->config.phash_distance > IMAGE_FILTER_MAX_PHASH_DISTANCE)
+        filter->config.phash_distance = IMAGE_FILTER_MAX_PHASH_DISTANCE;
+
+    filter->chunk_distance = filter->config.phash_distance / IMAGE_FILTER_CHUNKS;
+
+    for (size_t chunk = 0; chunk < IMAGE_FILTER_CHUNKS; chunk++)
+    {
+        filter->buckets[chunk] = xmalloc(sizeof (*filter->buckets[chunk]) << IMAGE_FILTER_CHUNK_BITS);
+        memset(filter->buckets[chunk], 0xFF, sizeof (*filter->buckets[chunk]) << IMAGE_FILTER_CHUNK_BITS);
+    }
+
+    for (uint32_t mask = 0; mask < 1U << IMAGE_FILTER_CHUNK_BITS; mask++)
+    {
+        if ((uint32_t) __builtin_popcount(mask) > filter->chunk_distance)
+            continue;
+
+        filter->masks = xrealloc(filter->masks, sizeof (*filter->masks) * (filter->mask_count + 1));
+        filter->masks[filter->mask_count++] = (uint16_t) mask;
+    }
+
+    filter->cache_sets = sets;
+    filter->cache = xcalloc(sets * 2, sizeof (*filter->cache));
+
+    if (getrandom(filter->seed, sizeof (filter->seed), 0) != (ssize_t) sizeof (filter->seed))
+    {
+        filter->seed[0] = image_filter_mix(get_monotonic_time_ns() ^ (uint64_t) (uintptr_t) filter);
+        filter->seed[1] = image_filter_mix(filter->seed[0] + 0x9E3779B97F4A7C15ULL);
+    }
+
+    pthread_mutex_init(&filter->lock, NULL);
+    return filter;
+}
+
+void image_filter_free(image_filter_t *filter)
+{
+    for (size_t chunk = 0; chunk < IMAGE_FILTER_CHUNKS; chunk++)
+        free(filter->buckets[chunk]);
+
+    free(filter->known);
+    free(filter->masks);
+    free(filter->cache);
+    pthread_mutex_destroy(&filter->lock);
+    free(filter);
+}
+
+static uint16_t image_filter_chunk(uint64_t phash, size_t chunk)
+{
+    return (uint16_t) (phash >> (chunk * IMAGE_FILTER_CHUNK_BITS));
+}
+
+static uint32_t image_filter_find_exact(const image_filter_t *filter, const image_hash_t *hash)
+{
+    for (uint32_t index = filter->buckets[0][image_filter_chunk(hash->phash, 0)]; index != IMAGE_FILTER_NIL;
+         index = filter->known[index].next[0])
+    {
+        if (filter->known[index].phash == hash->phash && filter->known[index].dhash == hash->dhash)
+            return index;
+    }
+
+    return IMAGE_FILTER_NIL;
+}
+
+static void image_filter_link(image_filter_t *filter, uint32_t index)
+{
+    struct image_known *known = &filter->known[index];
+
+    for (size_t chunk = 0; chunk < IMAGE_FILTER_CHUNKS; chunk++)
+    {
+        uint32_t *head = &filter->buckets[chunk][image_filter_chunk(known->phash, chunk)];
+
+        known->next[chunk] = *head;
+        *head = index;
+    }
+}
+
+/* Drops removed images once they are half of all. */
+static void image_filter_rebuild(image_filter_t *filter)
+{
+    size_t live = 0;
+
+    for (size_t i = 0; i < filter->known_count; i++)
+    {
+        if (!filter->known[i].removed)
+            filter->known[live++] = filter->known[i];
+    }
+
+    filter->known_count = live;
+    filter->known_removed = 0;
+
+    for (size_t chunk = 0; chunk < IMAGE_FILTER_CHUNKS; chunk++)
+        memset(filter->buckets[chunk], 0xFF, sizeof (*filter->buckets[chunk]) << IMAGE_FILTER_CHUNK_BITS);
+
+    for (size_t i = 0; i < live; i++)
+        image_filter_link(filter, (uint32_t) i);
+}
+
+/**
+ * @brief Adds a known image; value is handed back with every match (e.g.
+ * the ID of the entry it came from). Adding the same hashes again only
+ * updates the value.
+ */
+bool image_filter_add(image_filter_t *filter, const image_hash_t *hash, uint64_t value)
+{
+    pthread_mutex_lock(&filter->lock);
+
+    uint32_t index = image_filter_find_exact(filter, hash);
+
+    if (index != IMAGE_FILTER_NIL)
+    {
+        if (filter->known[index].removed)
+        {
+            filter->known[index].removed = false;
+            filter->known_removed--;
+        }
+
+        filter->known[index].value = value;
+    }
+    else
+    {
+        if (filter->known_count == IMAGE_FILTER_NIL)
+        {
+            pthread_mutex_unlock(&filter->lock);
+            return false;
+        }
+
+        if (filter->known_count == filter->known_capacity)
+        {
+            filter->known_capacity = filter->known_capacity != 0 ? filter->known_capacity * 2 : IMAGE_FILTER_MIN_KNOWN;
+            filter->known = xrealloc(filter->known, sizeof (*filter->known) * filter->known_capacity);
+        }
+
+        index = (uint32_t) filter->known_count++;
+        filter->known[index] = (struct image_known) {
+            .phash = hash->phash,
+            .dhash = hash->dhash,
+            .value = value,
+        };
+
+        image_filter_link(filter, index);
+    }
+
+    filter->generation++;
+    pthread_mutex_unlock(&filter->lock);
+    return true;
+}
+
+bool image_filter_remove(image_filter_t *filter, const image_hash_t *hash)
+{
+    bool removed = false;
+
+    pthread_mutex_lock(&filter->lock);
+
+    uint32_t index = image_filter_find_exact(filter, hash);
+
+    if (index != IMAGE_FILTER_NIL && !filter->known[index].removed)
+    {
+        filter->known[index].removed = true;
+        filter->known_removed++;
+        filter->generation++;
+        removed = true;
+
+        if (filter->known_removed * 2 > filter->known_count)
+            image_filter_rebuild(filter);
+    }
+
+    pthread_mutex_unlock(&filter->lock);
+    return removed;
+}
+
+/*
+ * Probes, for every chunk of the query, each bucket within chunk_distance
+ * bits of it. A candidate close enough on an earlier chunk was already
+ * seen there and is skipped. Candidates must also be close in dhash; the
+ * closest wins.
+ */
+static void image_filter_search(image_filter_t *filter, const image_hash_t *hash, image_result_t *result)
+{
+    uint32_t best_phash = UINT32_MAX;
+    uint32_t best_dhash = UINT32_MAX;
+
+    result->hash = *hash;
+    result->verdict = IMAGE_VERDICT_CLEAN;
+    result->value = 0;
+    result->phash_distance = 0;
+    result->dhash_distance = 0;
+
+    if (filter->known_count == filter->known_removed)
+        return;
+
+    for (size_t chunk = 0; chunk < IMAGE_FILTER_CHUNKS; chunk++)
+    {
+        uint16_t part = image_filter_chunk(hash->phash, chunk);
+
+        for (size_t mask = 0; mask < filter->mask_count; mask++)
+        {
+            for (uint32_t index = filter->buckets[chunk][part ^ filter->masks[mask]]; index != IMAGE_FILTER_NIL;
+                 index = filter->known[index].next[chunk])
+            {
+                const struct image_known *known = &filter->known[index];
+                uint64_t difference = known->phash ^ hash->phash;
+                bool seen = false;
+
+                if (known->removed)
+                    continue;
+
+                for (size_t earlier = 0; earlier < chunk && !seen; earlier++)
+                    seen = (uint32_t) __builtin_popcount(image_filter_chunk(difference, earlier)) <=
+                           filter->chunk_distance;
+
+                uint32_t distance = (uint32_t) __builtin_popcountll(difference);
+
+                if (seen || distance > filter->config.phash_distance)
+                    continue;
+
+                uint32_t dhash_distance = image_hash_distance(known->dhash, hash->dhash);
+
+                if (dhash_distance <= filter->config.dhash_distance &&
+                    (distance < best_phash || (distance == best_phash && dhash_distance < best_dhash)))
+                {
+                    best_phash = distance;
+                    best_dhash = dhash_distance;
+                    result->verdict = IMAGE_VERDICT_KNOWN;
+                    result->value = known->value;
+                    result->phash_distance = distance;
+                    result->dhash_distance = dhash_distance;
+                }
+            }
+        }
+    }
+
+    if (result->verdict == IMAGE_VERDICT_KNOWN)
+        filter->stats.matches++;
+}
+
+image_verdict_t image_filter_match(image_filter_t *filter, const image_hash_t *hash, image_result_t *result)
+{
+    pthread_mutex_lock(&filter->lock);
+    image_filter_search(filter, hash, result);
+    result->cached = false;
+    pthread_mutex_unlock(&filter->lock);
+
+    return result->verdict;
+}
+
+static struct image_cache_entry *image_filter_cache_find(image_filter_t *filter, const uint64_t key[2])
+{
+    struct image_cache_entry *set = &filter->cache[(key[0] & (filter->cache_sets - 1)) * 2];
+
+    for (size_t way = 0; way < 2; way++)
+    {
+        if (set[way].key[0] == key[0] && set[way].key[1] == key[1])
+            return &set[way];
+    }
+
+    return NULL;
+}
+
+static void image_filter_cache_store(image_filter_t *filter, const uint64_t key[2], const image_result_t *result)
+{
+    struct image_cache_entry *entry = image_filter_cache_find(filter, key);
+
+    if (entry == NULL)
+    {
+        struct image_cache_entry *set = &filter->cache[(key[0] & (filter->cache_sets - 1)) * 2];
+
+        entry = set[0].used_at <= set[1].used_at ? &set[0] : &set[1];
+
+        if (entry->key[0] == 0 && entry->key[1] == 0)
+            filter->stats.cached++;
+    }
+
+    *entry = (struct image_cache_entry) {
+        .key = { key[0], key[1] },
+        .hash = result->hash,
+        .value = result->value,
+        .generation = filter->generation,
+        .used_at = ++filter->clock,
+        .phash_distance = result->phash_distance,
+        .dhash_distance = result->dhash_distance,
+        .verdict = result->verdict,
+    };
+}
+
+/**
+ * @brief Looks the URL up in the verdict cache only.
+ * @return IMAGE_VERDICT_UNKNOWN if the image has not been checked yet.
+ */
+image_verdict_t image_filter_lookup(image_filter_t *filter, const char *url, size_t length, image_result_t *result)
+{
+    uint64_t key[2];
+
+    image_filter_url_key(filter, url, length, key);
+    pthread_mutex_lock(&filter->lock);
+
+    struct image_cache_entry *entry = image_filter_cache_find(filter, key);
+
+    if (entry == NULL)
+    {
+        filter->stats.cache_misses++;
+        pthread_mutex_unlock(&filter->lock);
+        return IMAGE_VERDICT_UNKNOWN;
+    }
+
+    filter->stats.cache_hits++;
+    entry->used_at = ++filter->clock;
+
+    if (entry->generation != filter->generation)
+    {
+        image_filter_search(filter, &entry->hash, result);
+        image_filter_cache_store(filter, key, result);
+    }
+    else
+    {
+        result->hash = entry->hash;
+        result->value = entry->value;
+        result->phash_distance = entry->phash_distance;
+        result->dhash_distance = entry->dhash_distance;
+        result->verdict = entry->verdict;
+    }
+
+    result->cached = true;
+    pthread_mutex_unlock(&filter->lock);
+    return result->verdict;
+}
+
+/**
+ * @brief Hashes a decoded image, matches it against the known images and
+ * caches the verdict under its URL (if url is not NULL).
+ * @return IMAGE_VERDICT_UNKNOWN if the pixels could not be hashed.
+ */
+image_verdict_t image_filter_check(image_filter_t *filter, const char *url, size_t length, const uint8_t *pixels,
+                                   uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                                   image_result_t *result)
+{
+    image_hash_t hash;
+    uint64_t key[2];
+
+    if (!image_hash_compute(pixels, width, height, stride, channels, &hash))
+        return IMAGE_VERDICT_UNKNOWN;
+
+    if (url != NULL)
+        image_filter_url_key(filter, url, length, key);
+
+    pthread_mutex_lock(&filter->lock);
+
+    filter->stats.hashed++;
+    image_filter_search(filter, &hash, result);
+    result->cached = false;
+
+    if (url != NULL)
+        image_filter_cache_store(filter, key, result);
+
+    pthread_mutex_unlock(&filter->lock);
+    return result->verdict;
+}
+
+void image_filter_get_stats(image_filter_t *filter, image_filter_stats_t *stats)
+{
+    pthread_mutex_lock(&filter->lock);
+    *stats = filter->stats;
+    stats->known = filter->known_count - filter->known_removed;
+    pthread_mutex_unlock(&filter->lock);
+}
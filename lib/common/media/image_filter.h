@@ -0,0 +1,125 @@
+#ifndef SUDOBOT_MEDIA_IMAGE_FILTER_H
+#define SUDOBOT_MEDIA_IMAGE_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "image_hash.h"
+
+#define IMAGE_FILTER_DEFAULT_CACHE_ENTRIES 65536
+#define IMAGE_FILTER_DEFAULT_PHASH_DISTANCE 8
+#define IMAGE_FILTER_DEFAULT_DHASH_DISTANCE 12
+#define IMAGE_FILTER_NIL UINT32_MAX
+
+typedef enum image_verdict
+{
+    /* Not cached, or the image could not be hashed. */
+    IMAGE_VERDICT_UNKNOWN = 0,
+    IMAGE_VERDICT_CLEAN = 1,
+    /* Within the distance thresholds of a known image. */
+    IMAGE_VERDICT_KNOWN = 2,
+} image_verdict_t;
+
+typedef struct image_filter_config
+{
+    size_t cache_entries;
+    uint32_t phash_distance;
+    uint32_t dhash_distance;
+} image_filter_config_t;
+
+typedef struct image_result
+{
+    image_hash_t hash;
+    /* What the matched known image was added with. */
+    uint64_t value;
+    uint32_t phash_distance;
+    uint32_t dhash_distance;
+    uint8_t verdict;
+    bool cached;
+} image_result_t;
+
+#define IMAGE_FILTER_CHUNKS 4
+#define IMAGE_FILTER_CHUNK_BITS 16
+/* Above this the probes per lookup (all masks within threshold / 4 bits) get too many. */
+#define IMAGE_FILTER_MAX_PHASH_DISTANCE 19
+
+/* A known image; next links it into one bucket list per phash chunk. */
+struct image_known
+{
+    uint64_t phash;
+    uint64_t dhash;
+    uint64_t value;
+    uint32_t next[IMAGE_FILTER_CHUNKS];
+    bool removed;
+};
+
+/*
+ * Two-way set-associative verdict cache keyed by a seeded 128-bit hash of
+ * the attachment URL. Entries from before the last change to the known
+ * images are matched again from their stored hashes.
+ */
+struct image_cache_entry
+{
+    uint64_t key[2];
+    image_hash_t hash;
+    uint64_t value;
+    uint64_t generation;
+    uint64_t used_at;
+    uint32_t phash_distance;
+    uint32_t dhash_distance;
+    uint8_t verdict;
+};
+
+typedef struct image_filter_stats
+{
+    size_t known;
+    size_t cached;
+    uint64_t hashed;
+    uint64_t cache_hits;
+    uint64_t cache_misses;
+    uint64_t matches;
+} image_filter_stats_t;
+
+typedef struct image_filter
+{
+    pthread_mutex_t lock;
+    image_filter_config_t config;
+    struct image_known *known;
+    size_t known_count;
+    size_t known_capacity;
+    size_t known_removed;
+    /*
+     * Multi-index hashing: phash is split into four 16-bit chunks, each with
+     * its own bucket table. Two hashes within distance t agree to within t / 4
+     * bits on at least one chunk, so probing every bucket that close to each
+     * chunk of the query finds all candidates.
+     */
+    uint32_t *buckets[IMAGE_FILTER_CHUNKS];
+    uint16_t *masks;
+    size_t mask_count;
+    uint32_t chunk_distance;
+    uint64_t generation;
+    struct image_cache_entry *cache;
+    size_t cache_sets;
+    uint64_t seed[2];
+    uint64_t clock;
+    image_filter_stats_t stats;
+} image_filter_t;
+
+extern image_filter_t *image_filter;
+
+image_filter_t *image_filter_init(const image_filter_config_t *config);
+void image_filter_free(image_filter_t *filter);
+
+bool image_filter_add(image_filter_t *filter, const image_hash_t *hash, uint64_t value);
+bool image_filter_remove(image_filter_t *filter, const image_hash_t *hash);
+
+image_verdict_t image_filter_match(image_filter_t *filter, const image_hash_t *hash, image_result_t *result);
+image_verdict_t image_filter_lookup(image_filter_t *filter, const char *url, size_t length, image_result_t *result);
+image_verdict_t image_filter_check(image_filter_t *filter, const char *url, size_t length, const uint8_t *pixels,
+                                   uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                                   image_result_t *result);
+void image_filter_get_stats(image_filter_t *filter, image_filter_stats_t *stats);
+
+#endif /* SUDOBOT_MEDIA_IMAGE_FILTER_H */
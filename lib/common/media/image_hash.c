@@ -0,0 +1,214 @@
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+#include "image_hash.h"
+
+#define IMAGE_HASH_DHASH_WIDTH 9
+#define IMAGE_HASH_DHASH_HEIGHT 8
+
+static float image_hash_cosines[IMAGE_HASH_PHASH_LOW][IMAGE_HASH_PHASH_SIZE];
+static pthread_once_t image_hash_cosines_once = PTHREAD_ONCE_INIT;
+
+static void image_hash_init_cosines(void)
+{
+    for (size_t k = 0; k < IMAGE_HASH_PHASH_LOW; k++)
+    {
+        for (size_t n = 0; n < IMAGE_HASH_PHASH_SIZE; n++)
+            image_hash_cosines[k][n] = (float) cos(M_PI * (double) ((2 * n + 1) * k) / (2 * IMAGE_HASH_PHASH_SIZE));
+    }
+}
+
+struct image_hash_bins
+{
+    uint32_t count;
+    uint32_t start[IMAGE_HASH_PHASH_SIZE];
+    uint32_t end[IMAGE_HASH_PHASH_SIZE];
+};
+
+/* Splits length source pixels into count bins of at least one pixel each, so tiny images are sampled. */
+static void image_hash_bins_init(struct image_hash_bins *bins, uint32_t length, uint32_t count)
+{
+    bins->count = count;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        bins->start[i] = (uint32_t) ((uint64_t) i * length / count);
+        bins->end[i] = (uint32_t) ((uint64_t) (i + 1) * length / count);
+
+        if (bins->end[i] <= bins->start[i])
+            bins->end[i] = bins->start[i] + 1;
+    }
+}
+
+/* Adds one source row, given as prefix sums, to every grid row whose bin contains it. */
+static void image_hash_bins_add(const struct image_hash_bins *columns, const struct image_hash_bins *rows,
+                                const uint32_t *prefix, uint32_t y, uint32_t *sums)
+{
+    for (uint32_t row = 0; row < rows->count; row++)
+    {
+        if (y < rows->start[row] || y >= rows->end[row])
+            continue;
+
+        for (uint32_t column = 0; column < columns->count; column++)
+            sums[row * columns->count + column] += prefix[columns->end[column]] - prefix[columns->start[column]];
+    }
+}
+
+static void image_hash_bins_average(const struct image_hash_bins *columns, const struct image_hash_bins *rows,
+                                    const uint32_t *sums, float *grid)
+{
+    for (uint32_t row = 0; row < rows->count; row++)
+    {
+        for (uint32_t column = 0; column < columns->count; column++)
+        {
+            uint32_t area = (columns->end[column] - columns->start[column]) * (rows->end[row] - rows->start[row]);
+            grid[row * columns->count + column] = (float) sums[row * columns->count + column] / (float) area;
+        }
+    }
+}
+
+/*
+ * Area-averaging downscale to both grids in one pass over the pixels:
+ * each row is turned into luma prefix sums (ITU-R BT.601 weights in 8-bit
+ * fixed point), from which every cell's share of the row is a single
+ * subtraction. Nothing is allocated.
+ */
+static void image_hash_grids(const uint8_t *pixels, uint32_t width, uint32_t height, size_t stride,
+                             uint32_t channels, float *dhash_grid, float *phash_grid)
+{
+    uint32_t prefix[IMAGE_HASH_MAX_SIDE + 1];
+    uint32_t dhash_sums[IMAGE_HASH_DHASH_HEIGHT * IMAGE_HASH_DHASH_WIDTH] = { 0 };
+    uint32_t phash_sums[IMAGE_HASH_PHASH_SIZE * IMAGE_HASH_PHASH_SIZE] = { 0 };
+    struct image_hash_bins dhash_columns, dhash_rows, phash_columns, phash_rows;
+
+    image_hash_bins_init(&dhash_columns, width, IMAGE_HASH_DHASH_WIDTH);
+    image_hash_bins_init(&dhash_rows, height, IMAGE_HASH_DHASH_HEIGHT);
+    image_hash_bins_init(&phash_columns, width, IMAGE_HASH_PHASH_SIZE);
+    image_hash_bins_init(&phash_rows, height, IMAGE_HASH_PHASH_SIZE);
+
+    prefix[0] = 0;
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        const uint8_t *row = pixels + y * stride;
+        uint32_t sum = 0;
+
+        if (channels < 3)
+        {
+            for (uint32_t x = 0; x < width; x++)
+                prefix[x + 1] = sum += row[x * channels];
+        }
+        else
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                const uint8_t *pixel = row + x * channels;
+                prefix[x + 1] = sum += (77U * pixel[0] + 150U * pixel[1] + 29U * pixel[2]) >> 8;
+            }
+        }
+
+        image_hash_bins_add(&dhash_columns, &dhash_rows, prefix, y, dhash_sums);
+        image_hash_bins_add(&phash_columns, &phash_rows, prefix, y, phash_sums);
+    }
+
+    image_hash_bins_average(&dhash_columns, &dhash_rows, dhash_sums, dhash_grid);
+    image_hash_bins_average(&phash_columns, &phash_rows, phash_sums, phash_grid);
+}
+
+static uint64_t image_hash_dhash(const float grid[IMAGE_HASH_DHASH_HEIGHT * IMAGE_HASH_DHASH_WIDTH])
+{
+    uint64_t hash = 0;
+
+    for (size_t y = 0; y < IMAGE_HASH_DHASH_HEIGHT; y++)
+    {
+        const float *row = grid + y * IMAGE_HASH_DHASH_WIDTH;
+
+        for (size_t x = 0; x < IMAGE_HASH_DHASH_WIDTH - 1; x++)
+            hash |= (uint64_t) (row[x + 1] > row[x]) << (y * 8 + x);
+    }
+
+    return hash;
+}
+
+/*
+ * Only the 8x8 lowest frequencies of the 32x32 DCT-II are needed, so it is
+ * done as two small matrix products against the cosine table instead of a
+ * full transform.
+ */
+static uint64_t image_hash_phash(const float grid[IMAGE_HASH_PHASH_SIZE * IMAGE_HASH_PHASH_SIZE])
+{
+    float columns[IMAGE_HASH_PHASH_LOW][IMAGE_HASH_PHASH_SIZE] = { { 0 } };
+    float coefficients[IMAGE_HASH_PHASH_LOW * IMAGE_HASH_PHASH_LOW];
+    float sorted[IMAGE_HASH_PHASH_LOW * IMAGE_HASH_PHASH_LOW];
+    uint64_t hash = 0;
+
+    pthread_once(&image_hash_cosines_once, &image_hash_init_cosines);
+
+    for (size_t k = 0; k < IMAGE_HASH_PHASH_LOW; k++)
+    {
+        for (size_t n = 0; n < IMAGE_HASH_PHASH_SIZE; n++)
+        {
+            const float *row = grid + n * IMAGE_HASH_PHASH_SIZE;
+            float weight = image_hash_cosines[k][n];
+
+            for (size_t x = 0; x < IMAGE_HASH_PHASH_SIZE; x++)
+                columns[k][x] += weight * row[x];
+        }
+    }
+
+    for (size_t k = 0; k < IMAGE_HASH_PHASH_LOW; k++)
+    {
+        for (size_t l = 0; l < IMAGE_HASH_PHASH_LOW; l++)
+        {
+            float sum = 0;
+
+            for (size_t x = 0; x < IMAGE_HASH_PHASH_SIZE; x++)
+                sum += columns[k][x] * image_hash_cosines[l][x];
+
+            coefficients[k * IMAGE_HASH_PHASH_LOW + l] = sum;
+        }
+    }
+
+    memcpy(sorted, coefficients, sizeof (sorted));
+
+    for (size_t i = 1; i < IMAGE_HASH_PHASH_LOW * IMAGE_HASH_PHASH_LOW; i++)
+    {
+        float value = sorted[i];
+        size_t j = i;
+
+        while (j > 0 && sorted[j - 1] > value)
+        {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+
+        sorted[j] = value;
+    }
+
+    float median = (sorted[31] + sorted[32]) / 2;
+
+    for (size_t i = 0; i < IMAGE_HASH_PHASH_LOW * IMAGE_HASH_PHASH_LOW; i++)
+        hash |= (uint64_t) (coefficients[i] > median) << i;
+
+    return hash;
+}
+
+/**
+ * @brief Fingerprints an 8-bit image: 1 (grey), 2 (grey and alpha), 3 (RGB)
+ * or 4 (RGBA) channels, rows stride bytes apart. Alpha is ignored.
+ */
+bool image_hash_compute(const uint8_t *pixels, uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                        image_hash_t *hash)
+{
+    float dhash_grid[IMAGE_HASH_DHASH_HEIGHT * IMAGE_HASH_DHASH_WIDTH];
+    float phash_grid[IMAGE_HASH_PHASH_SIZE * IMAGE_HASH_PHASH_SIZE];
+
+    if (pixels == NULL || width == 0 || height == 0 || width > IMAGE_HASH_MAX_SIDE || height > IMAGE_HASH_MAX_SIDE ||
+        channels == 0 || channels > 4 || stride < (size_t) width * channels)
+        return false;
+
+    image_hash_grids(pixels, width, height, stride, channels, dhash_grid, phash_grid);
+    hash->dhash = image_hash_dhash(dhash_grid);
+    hash->phash = image_hash_phash(phash_grid);
+    return true;
+}
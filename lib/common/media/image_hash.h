@@ -0,0 +1,33 @@
+#ifndef SUDOBOT_MEDIA_IMAGE_HASH_H
+#define SUDOBOT_MEDIA_IMAGE_HASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Larger images are refused; callers are expected to pass thumbnails. */
+#define IMAGE_HASH_MAX_SIDE 4096
+#define IMAGE_HASH_PHASH_SIZE 32
+#define IMAGE_HASH_PHASH_LOW 8
+
+/*
+ * Two 64-bit perceptual fingerprints of an image. dhash compares
+ * neighbouring cells of a 9x8 downscale; phash thresholds the lowest 8x8
+ * DCT coefficients of a 32x32 downscale at their median. Similar images
+ * differ in few bits of either.
+ */
+typedef struct image_hash
+{
+    uint64_t dhash;
+    uint64_t phash;
+} image_hash_t;
+
+bool image_hash_compute(const uint8_t *pixels, uint32_t width, uint32_t height, size_t stride, uint32_t channels,
+                        image_hash_t *hash);
+
+static inline uint32_t image_hash_distance(uint64_t a, uint64_t b)
+{
+    return (uint32_t) __builtin_popcountll(a ^ b);
+}
+
+#endif /* SUDOBOT_MEDIA_IMAGE_HASH_H */
@@ -0,0 +1,342 @@
+#include <string.h>
+#include <pthread.h>
+#include "metrics.h"
+#include "../events/event_filter.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+bool metrics_enabled = false;
+
+static metrics_thread_t *metrics_threads = NULL;
+static pthread_mutex_t metrics_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread metrics_thread_t *metrics_local = NULL;
+/* Bumped when the blocks are freed, so threads allocate a new one rather than use their stale pointer. */
+static _Atomic uint64_t metrics_generation = 0;
+static __thread uint64_t metrics_local_generation = 0;
+static const char *_Atomic metrics_command_names[METRICS_COMMAND_MAX];
+
+static const char *const metrics_handler_names[METRICS_HANDLER_COUNT] = {
+    [METRICS_HANDLER_ON_MESSAGE] = "on_message",
+    [METRICS_HANDLER_ON_INTERACTION] = "on_interaction_create",
+    [METRICS_HANDLER_AUTOMOD] = "automod_on_message",
+    [METRICS_HANDLER_COMMAND_MESSAGE] = "command_on_message_handler",
+    [METRICS_HANDLER_COMMAND_INTERACTION] = "command_on_interaction_handler",
+};
+
+static const char *const metrics_route_names[REST_ROUTE_COUNT] = {
+    [REST_ROUTE_DELETE_MESSAGE] = "delete_message",
+    [REST_ROUTE_BULK_DELETE_MESSAGES] = "bulk_delete_messages",
+    [REST_ROUTE_CREATE_GUILD_BAN] = "create_guild_ban",
+    [REST_ROUTE_CREATE_MESSAGE] = "create_message",
+    [REST_ROUTE_INTERACTION_RESPONSE] = "interaction_response",
+};
+
+static const char *const metrics_outcome_names[METRICS_REST_OUTCOME_COUNT] = {
+    [METRICS_REST_OK] = "ok",
+    [METRICS_REST_RATE_LIMITED] = "rate_limited",
+    [METRICS_REST_FAILED] = "failed",
+};
+
+/* Exported bucket boundaries, in nanoseconds; the fine buckets are folded into these. */
+static const uint64_t metrics_export_bounds[] = {
+    1000,      2500,      5000,      10000,      25000,      50000,      100000,     250000,
+    500000,    1000000,   2500000,   5000000,    10000000,   25000000,   50000000,   100000000,
+    250000000, 500000000, 1000000000, 2500000000, 5000000000, 10000000000,
+};
+
+static const double metrics_quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+#define METRICS_EXPORT_BOUND_COUNT (sizeof (metrics_export_bounds) / sizeof (metrics_export_bounds[0]))
+#define METRICS_QUANTILE_COUNT (sizeof (metrics_quantiles) / sizeof (metrics_quantiles[0]))
+
+void metrics_init()
+{
+    metrics_enabled = true;
+}
+
+/*
+ * Stops recording and frees every thread block, so an embedded runtime
+ * that restarts does not leak one per thread each time. Threads that
+ * record must have stopped; any that record again later get a new block.
+ */
+void metrics_disable()
+{
+    metrics_enabled = false;
+
+    pthread_mutex_lock(&metrics_threads_lock);
+
+    while (metrics_threads != NULL)
+    {
+        metrics_thread_t *next = metrics_threads->next;
+
+        free(metrics_threads);
+        metrics_threads = next;
+    }
+
+    atomic_fetch_add(&metrics_generation, 1);
+    pthread_mutex_unlock(&metrics_threads_lock);
+}
+
+size_t metrics_bucket_index(uint64_t value)
+{
+    if (value < METRICS_SUB_BUCKETS)
+        return (size_t) value;
+
+    unsigned int exponent = 63 - (unsigned int) __builtin_clzll(value);
+
+    if (exponent > METRICS_MAX_EXPONENT)
+        return METRICS_BUCKETS - 1;
+
+    size_t sub = (size_t) (value >> (exponent - METRICS_SUB_BUCKET_BITS)) & (METRICS_SUB_BUCKETS - 1);
+    return (exponent - METRICS_SUB_BUCKET_BITS + 1) * METRICS_SUB_BUCKETS + sub;
+}
+
+/* Highest value that falls into the bucket. */
+uint64_t metrics_bucket_upper_bound(size_t index)
+{
+    if (index < METRICS_SUB_BUCKETS)
+        return index;
+
+    unsigned int shift = (unsigned int) (index / METRICS_SUB_BUCKETS) - 1;
+    uint64_t lower = (uint64_t) (METRICS_SUB_BUCKETS + index % METRICS_SUB_BUCKETS) << shift;
+
+    return lower + (1ULL << shift) - 1;
+}
+
+/* First sample on a thread allocates its block; after that recording never takes a lock. */
+static metrics_thread_t *metrics_thread_get()
+{
+    metrics_thread_t *local = metrics_local;
+    uint64_t generation = atomic_load_explicit(&metrics_generation, memory_order_relaxed);
+
+    if (__builtin_expect(local != NULL && metrics_local_generation == generation, 1))
+        return local;
+
+    local = xcalloc(1, sizeof (*local));
+    pthread_mutex_lock(&metrics_threads_lock);
+    local->next = metrics_threads;
+    metrics_threads = local;
+    metrics_local_generation = atomic_load_explicit(&metrics_generation, memory_order_relaxed);
+    pthread_mutex_unlock(&metrics_threads_lock);
+    metrics_local = local;
+    return local;
+}
+
+static inline void metrics_add(_Atomic uint64_t *counter, uint64_t value)
+{
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + value,
+                          memory_order_relaxed);
+}
+
+static inline void metrics_series_record(struct metrics_series *series, uint64_t elapsed_ns)
+{
+    metrics_add(&series->buckets[metrics_bucket_index(elapsed_ns)], 1);
+    metrics_add(&series->sum_ns, elapsed_ns);
+    metrics_add(&series->count, 1);
+}
+
+/* Each of these records the time from started_at_ns (monotonic) to now. */
+void metrics_record_handler(metrics_handler_t handler, uint64_t started_at_ns)
+{
+    if (!metrics_enabled)
+        return;
+
+    metrics_series_record(&metrics_thread_get()->series[handler], get_monotonic_time_ns() - started_at_ns);
+}
+
+void metrics_record_command(size_t index, const char *name, uint64_t started_at_ns)
+{
+    if (!metrics_enabled || index >= METRICS_COMMAND_MAX)
+        return;
+
+    if (atomic_load_explicit(&metrics_command_names[index], memory_order_relaxed) == NULL)
+        atomic_store_explicit(&metrics_command_names[index], name, memory_order_release);
+
+    metrics_series_record(&metrics_thread_get()->series[METRICS_SERIES_COMMAND(index)],
+                          get_monotonic_time_ns() - started_at_ns);
+}
+
+void metrics_record_rest(rest_route_t route, metrics_rest_outcome_t outcome, uint64_t started_at_ns)
+{
+    if (!metrics_enabled)
+        return;
+
+    metrics_thread_t *local = metrics_thread_get();
+
+    metrics_add(&local->rest_outcomes[route][outcome], 1);
+    metrics_series_record(&local->series[METRICS_SERIES_REST(route)], get_monotonic_time_ns() - started_at_ns);
+}
+
+struct metrics_merged
+{
+    uint64_t count;
+    uint64_t sum_ns;
+    uint64_t buckets[METRICS_BUCKETS];
+};
+
+static void metrics_merge(struct metrics_merged *merged, uint64_t (*outcomes)[METRICS_REST_OUTCOME_COUNT])
+{
+    pthread_mutex_lock(&metrics_threads_lock);
+
+    for (const metrics_thread_t *block = metrics_threads; block != NULL; block = block->next)
+    {
+        for (size_t s = 0; s < METRICS_SERIES_COUNT; s++)
+        {
+            const struct metrics_series *series = &block->series[s];
+            uint64_t count = atomic_load_explicit(&series->count, memory_order_relaxed);
+
+            if (count == 0)
+                continue;
+
+            merged[s].count += count;
+            merged[s].sum_ns += atomic_load_explicit(&series->sum_ns, memory_order_relaxed);
+
+            for (size_t b = 0; b < METRICS_BUCKETS; b++)
+                merged[s].buckets[b] += atomic_load_explicit(&series->buckets[b], memory_order_relaxed);
+        }
+
+        for (size_t route = 0; route < REST_ROUTE_COUNT; route++)
+        {
+            for (size_t outcome = 0; outcome < METRICS_REST_OUTCOME_COUNT; outcome++)
+                outcomes[route][outcome] +=
+                    atomic_load_explicit(&block->rest_outcomes[route][outcome], memory_order_relaxed);
+        }
+    }
+
+    pthread_mutex_unlock(&metrics_threads_lock);
+}
+
+static void metrics_write_series(FILE *out, const char *family, const char *label, const char *value,
+                                 const struct metrics_merged *series)
+{
+    size_t bucket = 0;
+    uint64_t cumulative = 0;
+
+    /*
+     * Bucket counts and the total are read without a snapshot barrier, so
+     * a concurrent sample may show up in one and not the other; the total
+     * is taken from the buckets to keep the histogram self-consistent.
+     */
+    for (size_t i = 0; i < METRICS_EXPORT_BOUND_COUNT; i++)
+    {
+        while (bucket < METRICS_BUCKETS && metrics_bucket_upper_bound(bucket) <= metrics_export_bounds[i])
+            cumulative += series->buckets[bucket++];
+
+        fprintf(out, "%s_bucket{%s=\"%s\",le=\"%g\"} %lu\n", family, label, value,
+                (double) metrics_export_bounds[i] / 1e9, cumulative);
+    }
+
+    while (bucket < METRICS_BUCKETS)
+        cumulative += series->buckets[bucket++];
+
+    fprintf(out, "%s_bucket{%s=\"%s\",le=\"+Inf\"} %lu\n", family, label, value, cumulative);
+    fprintf(out, "%s_sum{%s=\"%s\"} %.9f\n", family, label, value, (double) series->sum_ns / 1e9);
+    fprintf(out, "%s_count{%s=\"%s\"} %lu\n", family, label, value, cumulative);
+}
+
+static void metrics_write_quantiles(FILE *out, const char *family, const char *label, const char *value,
+                                    const struct metrics_merged *series)
+{
+    uint64_t total = 0;
+
+    for (size_t b = 0; b < METRICS_BUCKETS; b++)
+        total += series->buckets[b];
+
+    for (size_t q = 0; q < METRICS_QUANTILE_COUNT; q++)
+    {
+        uint64_t rank = (uint64_t) (metrics_quantiles[q] * (double) total + 0.5);
+        uint64_t seen = 0;
+        size_t bucket = 0;
+
+        if (total == 0)
+            continue;
+
+        if (rank == 0)
+            rank = 1;
+
+        while (bucket < METRICS_BUCKETS - 1 && (seen += series->buckets[bucket]) < rank)
+            bucket++;
+
+        fprintf(out, "%s_quantile_seconds{%s=\"%s\",quantile=\"%g\"} %.9f\n", family, label, value,
+                metrics_quantiles[q], (double) metrics_bucket_upper_bound(bucket) / 1e9);
+    }
+}
+
+static void metrics_write_family(FILE *out, const char *family, const char *help, const char *label,
+                                 const struct metrics_merged *merged, size_t first, size_t count,
+                                 const char *const *names, bool skip_empty)
+{
+    fprintf(out, "# HELP %s_duration_seconds %s\n# TYPE %s_duration_seconds histogram\n", family, help, family);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (names[i] == NULL || (skip_empty && merged[first + i].count == 0))
+            continue;
+
+        char name[128];
+        snprintf(name, sizeof name, "%s_duration_seconds", family);
+        metrics_write_series(out, name, label, names[i], &merged[first + i]);
+    }
+
+    fprintf(out,
+            "# HELP %s_duration_quantile_seconds %s Quantiles from the histogram buckets.\n"
+            "# TYPE %s_duration_quantile_seconds gauge\n",
+            family, help, family);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (names[i] == NULL || (skip_empty && merged[first + i].count == 0))
+            continue;
+
+        char name[128];
+        snprintf(name, sizeof name, "%s_duration", family);
+        metrics_write_quantiles(out, name, label, names[i], &merged[first + i]);
+    }
+}
+
+/* Renders every series in the Prometheus text exposition format (0.0.4). */
+void metrics_write_prometheus(FILE *out)
+{
+    struct metrics_merged *merged = xcalloc(METRICS_SERIES_COUNT, sizeof (*merged));
+    uint64_t outcomes[REST_ROUTE_COUNT][METRICS_REST_OUTCOME_COUNT] = { 0 };
+    const char *commands[METRICS_COMMAND_MAX];
+
+    metrics_merge(merged, outcomes);
+
+    for (size_t i = 0; i < METRICS_COMMAND_MAX; i++)
+        commands[i] = atomic_load_explicit(&metrics_command_names[i], memory_order_acquire);
+
+    metrics_write_family(out, "sudobot_handler", "Time spent in gateway event handlers.", "handler", merged, 0,
+                         METRICS_HANDLER_COUNT, metrics_handler_names, false);
+    metrics_write_family(out, "sudobot_command", "Time spent in command callbacks.", "command", merged,
+                         METRICS_SERIES_COMMAND(0), METRICS_COMMAND_MAX, commands, true);
+    metrics_write_family(out, "sudobot_rest", "Time from dispatching a REST request to its completion.", "route",
+                         merged, METRICS_SERIES_REST(0), REST_ROUTE_COUNT, metrics_route_names, false);
+
+    fprintf(out, "# HELP sudobot_rest_requests_total REST requests by route and outcome.\n"
+                 "# TYPE sudobot_rest_requests_total counter\n");
+
+    for (size_t route = 0; route < REST_ROUTE_COUNT; route++)
+    {
+        for (size_t outcome = 0; outcome < METRICS_REST_OUTCOME_COUNT; outcome++)
+            fprintf(out, "sudobot_rest_requests_total{route=\"%s\",outcome=\"%s\"} %lu\n",
+                    metrics_route_names[route], metrics_outcome_names[outcome], outcomes[route][outcome]);
+    }
+
+    event_filter_stats_t filter_stats;
+    event_filter_get_stats(&filter_stats);
+
+    fprintf(out, "# HELP sudobot_events_filtered_total MESSAGE_CREATE events dropped before decoding, by reason.\n"
+                 "# TYPE sudobot_events_filtered_total counter\n");
+
+    for (size_t reason = 0; reason < EVENT_FILTER_REASON_COUNT; reason++)
+        fprintf(out, "sudobot_events_filtered_total{reason=\"%s\"} %lu\n", event_filter_reason_name(reason),
+                filter_stats.filtered[reason]);
+
+    fprintf(out, "# HELP sudobot_events_scanned_total MESSAGE_CREATE events seen by the event filter.\n"
+                 "# TYPE sudobot_events_scanned_total counter\n"
+                 "sudobot_events_scanned_total %lu\n",
+            filter_stats.scanned);
+
+    free(merged);
+}
@@ -0,0 +1,77 @@
+#ifndef SUDOBOT_METRICS_METRICS_H
+#define SUDOBOT_METRICS_METRICS_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "../rest/scheduler.h"
+
+/*
+ * Log-linear (HDR-style) buckets: values below 2^SUB_BUCKET_BITS get a
+ * bucket each, every power of two above that is split into SUB_BUCKETS
+ * equal buckets, so the relative error stays under 1/SUB_BUCKETS.
+ * Durations are in nanoseconds; anything from 2^(MAX_EXPONENT + 1) ns
+ * (about two minutes) up lands in the last bucket.
+ */
+#define METRICS_SUB_BUCKET_BITS 3
+#define METRICS_SUB_BUCKETS (1 << METRICS_SUB_BUCKET_BITS)
+#define METRICS_MAX_EXPONENT 36
+#define METRICS_BUCKETS ((METRICS_MAX_EXPONENT - 1) * METRICS_SUB_BUCKETS)
+#define METRICS_COMMAND_MAX 64
+
+typedef enum metrics_handler
+{
+    METRICS_HANDLER_ON_MESSAGE,
+    METRICS_HANDLER_ON_INTERACTION,
+    METRICS_HANDLER_AUTOMOD,
+    METRICS_HANDLER_COMMAND_MESSAGE,
+    METRICS_HANDLER_COMMAND_INTERACTION,
+    METRICS_HANDLER_COUNT
+} metrics_handler_t;
+
+typedef enum metrics_rest_outcome
+{
+    METRICS_REST_OK,
+    METRICS_REST_RATE_LIMITED,
+    METRICS_REST_FAILED,
+    METRICS_REST_OUTCOME_COUNT
+} metrics_rest_outcome_t;
+
+/* Series are laid out as handlers, then commands, then REST routes. */
+#define METRICS_SERIES_COMMAND(index) (METRICS_HANDLER_COUNT + (index))
+#define METRICS_SERIES_REST(route) (METRICS_HANDLER_COUNT + METRICS_COMMAND_MAX + (route))
+#define METRICS_SERIES_COUNT (METRICS_HANDLER_COUNT + METRICS_COMMAND_MAX + REST_ROUTE_COUNT)
+
+struct metrics_series
+{
+    _Atomic uint64_t count;
+    _Atomic uint64_t sum_ns;
+    _Atomic uint64_t buckets[METRICS_BUCKETS];
+};
+
+/*
+ * Per-thread block. Only its owner thread writes to it, with plain
+ * relaxed load/store pairs instead of locked read-modify-writes; the
+ * scraper sums every block.
+ */
+typedef struct metrics_thread
+{
+    struct metrics_series series[METRICS_SERIES_COUNT];
+    _Atomic uint64_t rest_outcomes[REST_ROUTE_COUNT][METRICS_REST_OUTCOME_COUNT];
+    struct metrics_thread *next;
+} metrics_thread_t;
+
+extern bool metrics_enabled;
+
+void metrics_init();
+void metrics_disable();
+void metrics_record_handler(metrics_handler_t handler, uint64_t started_at_ns);
+void metrics_record_command(size_t index, const char *name, uint64_t started_at_ns);
+void metrics_record_rest(rest_route_t route, metrics_rest_outcome_t outcome, uint64_t started_at_ns);
+size_t metrics_bucket_index(uint64_t value);
+uint64_t metrics_bucket_upper_bound(size_t index);
+void metrics_write_prometheus(FILE *out);
+
+#endif /* SUDOBOT_METRICS_METRICS_H */
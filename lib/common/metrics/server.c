@@ -0,0 +1,282 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "server.h"
+#include "metrics.h"
+#include "../gateway/session.h"
+#include "../io/log.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+metrics_server_t *metrics_server = NULL;
+
+/*
+ * Gateway session counters live with the gateway code rather than in
+ * metrics.c, which the REST mock links without the gateway.
+ */
+static void metrics_server_write_gateway_sessions(FILE *out)
+{
+    gateway_session_stats_t stats;
+    gateway_session_get_stats(&stats);
+
+    fprintf(out,
+            "# HELP sudobot_gateway_connections_total Gateway connections by how they were established.\n"
+            "# TYPE sudobot_gateway_connections_total counter\n"
+            "sudobot_gateway_connections_total{path=\"identify\"} %lu\n"
+            "sudobot_gateway_connections_total{path=\"resume\"} %lu\n"
+            "# HELP sudobot_gateway_resume_failed_total RESUME attempts rejected and followed by an IDENTIFY.\n"
+            "# TYPE sudobot_gateway_resume_failed_total counter\n"
+            "sudobot_gateway_resume_failed_total %lu\n",
+            stats.identified, stats.resumed, stats.resume_failed);
+}
+
+/* Accepts "unix:/path", "host:port", ":port" or "port". */
+static int metrics_server_listen(const char *address, char **unix_path)
+{
+    int fd = -1;
+
+    if (strncmp(address, "unix:", 5) == 0)
+    {
+        struct sockaddr_un addr = { .sun_family = AF_UNIX };
+        const char *path = address + 5;
+
+        if (strlen(path) >= sizeof addr.sun_path)
+        {
+            log_error("Metrics socket path is too long: %s", path);
+            return -1;
+        }
+
+        strcpy(addr.sun_path, path);
+        unlink(path);
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        if (fd < 0 || bind(fd, (struct sockaddr *) &addr, sizeof addr) != 0)
+            goto fail;
+
+        *unix_path = strdup(path);
+    }
+    else
+    {
+        struct sockaddr_in addr = { .sin_family = AF_INET };
+        const char *colon = strrchr(address, ':');
+        char host[64] = METRICS_SERVER_DEFAULT_HOST;
+        int one = 1;
+
+        if (colon != NULL && colon != address)
+            snprintf(host, sizeof host, "%.*s", (int) (colon - address), address);
+
+        addr.sin_port = htons((uint16_t) strtoul(colon != NULL ? colon + 1 : address, NULL, 10));
+
+        if (addr.sin_port == 0 || inet_pton(AF_INET, host, &addr.sin_addr) != 1)
+        {
+            log_error("Invalid metrics listen address: %s", address);
+            return -1;
+        }
+
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        if (fd < 0)
+            goto fail;
+
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+
+        if (bind(fd, (struct sockaddr *) &addr, sizeof addr) != 0)
+            goto fail;
+    }
+
+    if (listen(fd, 16) != 0)
+        goto fail;
+
+    return fd;
+
+fail:
+    log_error("Failed to listen for metrics on %s: %s", address, get_last_error());
+
+    if (fd >= 0)
+        close(fd);
+
+    return -1;
+}
+
+/* Waits for fd until deadline_ns, so a slow client cannot hold the server past its connection timeout. */
+static bool metrics_server_wait(int fd, short events, uint64_t deadline_ns)
+{
+    struct pollfd pfd = { .fd = fd, .events = events };
+    int ret;
+
+    do
+    {
+        uint64_t now = get_monotonic_time_ns();
+
+        if (now >= deadline_ns)
+            return false;
+
+        ret = poll(&pfd, 1, (int) ((deadline_ns - now + 999999) / 1000000));
+    }
+    while (ret < 0 && errno == EINTR);
+
+    return ret == 1;
+}
+
+static void metrics_server_respond(int fd)
+{
+    char request[METRICS_SERVER_REQUEST_MAX];
+    size_t received = 0;
+    uint64_t deadline_ns = get_monotonic_time_ns() + (uint64_t) METRICS_SERVER_CONNECTION_TIMEOUT_MS * 1000000;
+
+    /* Read the request head; its contents do not matter. */
+    while (received < sizeof request - 1 && metrics_server_wait(fd, POLLIN, deadline_ns))
+    {
+        ssize_t n = recv(fd, request + received, sizeof request - 1 - received, 0);
+
+        if (n <= 0)
+            return;
+
+        received += (size_t) n;
+        request[received] = 0;
+
+        if (strstr(request, "\r\n\r\n") != NULL || strstr(request, "\n\n") != NULL)
+            break;
+    }
+
+    char *body = NULL;
+    size_t body_length = 0;
+    FILE *out = open_memstream(&body, &body_length);
+
+    if (out == NULL)
+        return;
+
+    metrics_write_prometheus(out);
+    metrics_server_write_gateway_sessions(out);
+    fclose(out);
+
+    char head[256];
+    int head_length = snprintf(head, sizeof head,
+                               "HTTP/1.0 200 OK\r\n"
+                               "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                               "Content-Length: %zu\r\n"
+                               "Connection: close\r\n\r\n",
+                               body_length);
+    const char *parts[] = { head, body };
+    size_t lengths[] = { (size_t) head_length, body_length };
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        size_t sent = 0;
+
+        while (sent < lengths[i] && metrics_server_wait(fd, POLLOUT, deadline_ns))
+        {
+            ssize_t n = send(fd, parts[i] + sent, lengths[i] - sent, MSG_NOSIGNAL);
+
+            if (n <= 0)
+                break;
+
+            sent += (size_t) n;
+        }
+    }
+
+    free(body);
+}
+
+static void *metrics_server_main(void *data)
+{
+    metrics_server_t *server = data;
+    struct pollfd fds[2] = {
+        { .fd = server->listen_fd, .events = POLLIN },
+        { .fd = server->wake_fd, .events = POLLIN },
+    };
+
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        if (fds[1].revents != 0)
+            break;
+
+        int fd = accept4(server->listen_fd, NULL, NULL, SOCK_CLOEXEC);
+
+        if (fd < 0)
+            continue;
+
+        metrics_server_respond(fd);
+        close(fd);
+    }
+
+    return NULL;
+}
+
+metrics_server_t *metrics_server_start(const char *address)
+{
+    char *unix_path = NULL;
+    int listen_fd = metrics_server_listen(address, &unix_path);
+
+    if (listen_fd < 0)
+        return NULL;
+
+    metrics_server_t *server = xcalloc(1, sizeof (*server));
+
+    server->listen_fd = listen_fd;
+    server->unix_path = unix_path;
+    server->wake_fd = eventfd(0, EFD_CLOEXEC);
+
+    int err = 0;
+
+    /* Before the thread starts, since a scrape can arrive at once. */
+    metrics_init();
+
+    if (server->wake_fd < 0 || (err = pthread_create(&server->thread, NULL, &metrics_server_main, server)) != 0)
+    {
+        /* pthread_create() reports its error rather than setting errno. */
+        if (err != 0)
+            errno = err;
+
+        log_error("Failed to start the metrics server: %s", get_last_error());
+        metrics_disable();
+
+        if (server->wake_fd >= 0)
+            close(server->wake_fd);
+
+        close(listen_fd);
+        free(unix_path);
+        free(server);
+        return NULL;
+    }
+
+    log_info("Serving metrics on %s", address);
+    return server;
+}
+
+void metrics_server_stop(metrics_server_t *server)
+{
+    uint64_t one = 1;
+
+    if (write(server->wake_fd, &one, sizeof one) == sizeof one)
+        pthread_join(server->thread, NULL);
+
+    metrics_disable();
+    close(server->listen_fd);
+    close(server->wake_fd);
+
+    if (server->unix_path != NULL)
+    {
+        unlink(server->unix_path);
+        free(server->unix_path);
+    }
+
+    free(server);
+}
@@ -0,0 +1,30 @@
+#ifndef SUDOBOT_METRICS_SERVER_H
+#define SUDOBOT_METRICS_SERVER_H
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#define METRICS_SERVER_DEFAULT_HOST "127.0.0.1"
+#define METRICS_SERVER_REQUEST_MAX 4096
+/* Longest a connection is served, request and response together. */
+#define METRICS_SERVER_CONNECTION_TIMEOUT_MS 2000
+
+/*
+ * Minimal HTTP/1.0 responder for Prometheus scrapes. Every request,
+ * whatever its path, gets the current metrics; one connection is served
+ * at a time.
+ */
+typedef struct metrics_server
+{
+    int listen_fd;
+    int wake_fd;
+    char *unix_path;
+    pthread_t thread;
+} metrics_server_t;
+
+extern metrics_server_t *metrics_server;
+
+metrics_server_t *metrics_server_start(const char *address);
+void metrics_server_stop(metrics_server_t *server);
+
+#endif /* SUDOBOT_METRICS_SERVER_H */
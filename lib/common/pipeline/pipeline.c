@@ -0,0 +1,371 @@
+#define _GNU_SOURCE
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <concord/discord.h>
+#include "pipeline.h"
+#include "../automod/automod.h"
+#include "../core/command.h"
+#include "../io/log.h"
+#include "../rest/scheduler.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+#include "../sudobot.h"
+
+/* Longest a DROP_OLDEST producer sleeps before trying to evict again. */
+#define PIPELINE_DROP_OLDEST_WAIT_MS 1
+
+/*
+ * Queued by pipeline_free() once per worker. NULL cannot serve, since
+ * pipeline_queue_try_pop() also returns it for an empty queue.
+ */
+static char pipeline_stop_marker;
+#define PIPELINE_STOP ((pipeline_event_t *) &pipeline_stop_marker)
+
+/*
+ * Ingest is the gateway callback itself: it drops events that no stage is
+ * interested in and hands the rest to the first queue, so it never runs
+ * more than a claim and an enqueue.
+ */
+static const pipeline_stage_config_t pipeline_default_config[PIPELINE_STAGE_COUNT] = {
+    [PIPELINE_STAGE_NORMALIZE] = { "normalize", 2, 4096, PIPELINE_SHED_DROP_NEWEST, 0 },
+    [PIPELINE_STAGE_AUTOMOD] = { "automod", 2, 4096, PIPELINE_SHED_BLOCK, 50 },
+    [PIPELINE_STAGE_COMMAND] = { "command", 2, 1024, PIPELINE_SHED_DROP_OLDEST, 0 },
+    [PIPELINE_STAGE_OUTBOUND] = { "outbound", 1, 4096, PIPELINE_SHED_BLOCK, 50 },
+};
+
+pipeline_t *pipeline = NULL;
+
+static void atomic_max(_Atomic uint64_t *target, uint64_t value)
+{
+    uint64_t current = atomic_load_explicit(target, memory_order_relaxed);
+
+    while (value > current &&
+           !atomic_compare_exchange_weak_explicit(target, &current, value, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
+
+static void pipeline_event_release(pipeline_t *pipeline, pipeline_event_t *event, bool completed)
+{
+    if (completed)
+    {
+        uint64_t elapsed = get_monotonic_time_ns() - event->ingested_at_ns;
+
+        atomic_fetch_add_explicit(&pipeline->end_to_end_total_ns, elapsed, memory_order_relaxed);
+        atomic_max(&pipeline->end_to_end_max_ns, elapsed);
+    }
+
+    if (event->type == PIPELINE_EVENT_MESSAGE)
+    {
+        automod_context_destroy(&event->automod);
+        discord_unclaim(event->client, event->message);
+    }
+    else
+        discord_unclaim(event->client, event->interaction);
+
+    free(event);
+}
+
+/*
+ * Enqueues the event on the given stage, applying that stage's shedding
+ * policy when its queue is full. Returns false if the event was dropped.
+ */
+static bool pipeline_stage_enqueue(pipeline_t *pipeline, pipeline_stage_id_t id, pipeline_event_t *event)
+{
+    pipeline_stage_t *stage = &pipeline->stages[id];
+    bool reserved = pipeline_queue_try_reserve(&stage->queue);
+
+    if (!reserved)
+    {
+        switch (stage->config.policy)
+        {
+            case PIPELINE_SHED_DROP_OLDEST:
+                while (!reserved)
+                {
+                    pipeline_event_t *oldest = pipeline_queue_try_pop(&stage->queue);
+
+                    /* The stage is stopping: put the marker back in the cell it held and drop the event instead. */
+                    if (oldest == PIPELINE_STOP)
+                    {
+                        while (!pipeline_queue_reserve(&stage->queue, 1000))
+                            ;
+
+                        pipeline_queue_push_reserved(&stage->queue, PIPELINE_STOP);
+                        break;
+                    }
+
+                    if (oldest != NULL)
+                    {
+                        atomic_fetch_add_explicit(&stage->dropped, 1, memory_order_relaxed);
+                        pipeline_event_release(pipeline, oldest, false);
+                        reserved = pipeline_queue_try_reserve(&stage->queue);
+                    }
+                    else
+                    {
+                        /*
+                         * Consumers are taking every queued event and free
+                         * a cell as each one leaves; sleep until they do.
+                         */
+                        reserved = pipeline_queue_reserve(&stage->queue, PIPELINE_DROP_OLDEST_WAIT_MS);
+                    }
+                }
+
+                break;
+
+            case PIPELINE_SHED_BLOCK:
+                reserved = pipeline_queue_reserve(&stage->queue, stage->config.block_timeout_ms);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (!reserved)
+    {
+        atomic_fetch_add_explicit(&stage->dropped, 1, memory_order_relaxed);
+        pipeline_event_release(pipeline, event, false);
+        return false;
+    }
+
+    event->stage_entered_at_ns = get_monotonic_time_ns();
+    pipeline_queue_push_reserved(&stage->queue, event);
+    atomic_fetch_add_explicit(&stage->enqueued, 1, memory_order_relaxed);
+    atomic_max(&stage->max_depth, pipeline_queue_depth(&stage->queue));
+    return true;
+}
+
+static void pipeline_stage_process(pipeline_t *pipeline, pipeline_stage_t *stage, pipeline_event_t *event)
+{
+    switch (stage->id)
+    {
+        case PIPELINE_STAGE_NORMALIZE:
+            automod_context_text(&event->automod);
+            break;
+
+        case PIPELINE_STAGE_AUTOMOD:
+            automod_on_message(event->client, &event->automod);
+            break;
+
+        case PIPELINE_STAGE_COMMAND:
+            if (event->type == PIPELINE_EVENT_MESSAGE)
+                command_on_message_handler(event->client, event->message);
+            else
+                command_on_interaction_handler(event->client, event->interaction);
+
+            break;
+
+        case PIPELINE_STAGE_OUTBOUND:
+            rest_on_cycle(event->client);
+            break;
+
+        default:
+            break;
+    }
+
+    uint64_t now = get_monotonic_time_ns();
+    uint64_t elapsed = now - event->stage_entered_at_ns;
+
+    atomic_fetch_add_explicit(&stage->processed, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stage->time_total_ns, elapsed, memory_order_relaxed);
+    atomic_max(&stage->time_max_ns, elapsed);
+
+    if (stage->id == PIPELINE_STAGE_OUTBOUND)
+    {
+        uint64_t logged_at = atomic_load_explicit(&pipeline->metrics_logged_at_ns, memory_order_relaxed);
+
+        pipeline_event_release(pipeline, event, true);
+
+        if (now - logged_at >= PIPELINE_METRICS_LOG_INTERVAL_NS &&
+            atomic_compare_exchange_strong(&pipeline->metrics_logged_at_ns, &logged_at, now))
+            pipeline_log_metrics(pipeline);
+
+        return;
+    }
+
+    pipeline_stage_enqueue(pipeline, stage->id + 1, event);
+}
+
+static void *pipeline_worker_main(void *data)
+{
+    pipeline_stage_t *stage = data;
+    pipeline_event_t *event;
+
+    while ((event = pipeline_queue_pop(&stage->queue)) != PIPELINE_STOP)
+        pipeline_stage_process(stage->pipeline, stage, event);
+
+    return NULL;
+}
+
+static void pipeline_stage_configure(pipeline_stage_config_t *config)
+{
+    char name[64];
+
+    snprintf(name, sizeof name, "PIPELINE_%s_WORKERS", config->name);
+
+    for (char *c = name; *c; c++)
+        *c = (char) toupper((unsigned char) *c);
+
+    config->workers = env_get_size(env, name, config->workers);
+
+    /* A stage without workers would never drain, and pipeline_free() would wait on it forever. */
+    if (config->workers == 0)
+    {
+        log_warn("pipeline: %s needs at least one worker", name);
+        config->workers = 1;
+    }
+
+    snprintf(name, sizeof name, "PIPELINE_%s_CAPACITY", config->name);
+
+    for (char *c = name; *c; c++)
+        *c = (char) toupper((unsigned char) *c);
+
+    config->capacity = env_get_size(env, name, config->capacity);
+}
+
+/**
+ * @brief Creates the stage queues and starts each stage's workers.
+ *
+ * Worker counts and queue capacities default to pipeline_default_config
+ * and can be overridden with PIPELINE_<STAGE>_WORKERS and
+ * PIPELINE_<STAGE>_CAPACITY.
+ */
+pipeline_t *pipeline_init()
+{
+    pipeline_t *pipeline = xcalloc(1, sizeof (*pipeline));
+
+    atomic_init(&pipeline->metrics_logged_at_ns, get_monotonic_time_ns());
+
+    for (size_t id = 0; id < PIPELINE_STAGE_COUNT; id++)
+    {
+        pipeline_stage_t *stage = &pipeline->stages[id];
+
+        stage->id = id;
+        stage->pipeline = pipeline;
+        stage->config = pipeline_default_config[id];
+        pipeline_stage_configure(&stage->config);
+        pipeline_queue_init(&stage->queue, stage->config.capacity);
+        stage->threads = xcalloc(stage->config.workers, sizeof (pthread_t));
+    }
+
+    for (size_t id = 0; id < PIPELINE_STAGE_COUNT; id++)
+    {
+        pipeline_stage_t *stage = &pipeline->stages[id];
+
+        for (size_t i = 0; i < stage->config.workers; i++)
+        {
+            if (pthread_create(&stage->threads[i], NULL, &pipeline_worker_main, stage) != 0)
+                sudobot_fatal_error("pipeline: failed to start %s worker: %s", stage->config.name, get_last_error());
+        }
+
+        log_debug("pipeline: stage %s: %zu worker(s), capacity %zu", stage->config.name, stage->config.workers,
+                  stage->config.capacity);
+    }
+
+    return pipeline;
+}
+
+/*
+ * Stops the stages front to back. Each stage drains what is already queued
+ * before its workers see the stop marker, so no accepted event is lost.
+ * Whatever feeds the pipeline must be stopped first.
+ */
+void pipeline_free(pipeline_t *pipeline)
+{
+    for (size_t id = 0; id < PIPELINE_STAGE_COUNT; id++)
+    {
+        pipeline_stage_t *stage = &pipeline->stages[id];
+
+        for (size_t i = 0; i < stage->config.workers; i++)
+        {
+            while (!pipeline_queue_reserve(&stage->queue, 1000))
+                ;
+
+            pipeline_queue_push_reserved(&stage->queue, PIPELINE_STOP);
+        }
+
+        for (size_t i = 0; i < stage->config.workers; i++)
+            pthread_join(stage->threads[i], NULL);
+    }
+
+    pipeline_log_metrics(pipeline);
+
+    for (size_t id = 0; id < PIPELINE_STAGE_COUNT; id++)
+    {
+        pipeline_queue_destroy(&pipeline->stages[id].queue);
+        free(pipeline->stages[id].threads);
+    }
+
+    free(pipeline);
+}
+
+static pipeline_event_t *pipeline_event_new(struct discord *client, pipeline_event_type_t type)
+{
+    pipeline_event_t *event = xmalloc(sizeof (*event));
+
+    event->type = type;
+    event->client = client;
+    event->ingested_at_ns = get_monotonic_time_ns();
+    return event;
+}
+
+bool pipeline_submit_message(pipeline_t *pipeline, struct discord *client, const struct discord_message *message)
+{
+    if (message->author == NULL || message->author->bot)
+        return true;
+
+    pipeline_event_t *event = pipeline_event_new(client, PIPELINE_EVENT_MESSAGE);
+
+    discord_claim(client, message);
+    event->message = message;
+    automod_context_init(&event->automod, message);
+
+    return pipeline_stage_enqueue(pipeline, PIPELINE_STAGE_NORMALIZE, event);
+}
+
+bool pipeline_submit_interaction(pipeline_t *pipeline, struct discord *client,
+                                 const struct discord_interaction *interaction)
+{
+    pipeline_event_t *event = pipeline_event_new(client, PIPELINE_EVENT_INTERACTION);
+
+    discord_claim(client, interaction);
+    event->interaction = interaction;
+
+    return pipeline_stage_enqueue(pipeline, PIPELINE_STAGE_COMMAND, event);
+}
+
+void pipeline_get_metrics(pipeline_t *pipeline, pipeline_stage_id_t id, pipeline_stage_metrics_t *metrics)
+{
+    pipeline_stage_t *stage = &pipeline->stages[id];
+
+    metrics->depth = pipeline_queue_depth(&stage->queue);
+    metrics->max_depth = atomic_load_explicit(&stage->max_depth, memory_order_relaxed);
+    metrics->enqueued = atomic_load_explicit(&stage->enqueued, memory_order_relaxed);
+    metrics->dropped = atomic_load_explicit(&stage->dropped, memory_order_relaxed);
+    metrics->processed = atomic_load_explicit(&stage->processed, memory_order_relaxed);
+    metrics->time_total_ns = atomic_load_explicit(&stage->time_total_ns, memory_order_relaxed);
+    metrics->time_max_ns = atomic_load_explicit(&stage->time_max_ns, memory_order_relaxed);
+}
+
+void pipeline_log_metrics(pipeline_t *pipeline)
+{
+    uint64_t completed = atomic_load_explicit(&pipeline->stages[PIPELINE_STAGE_OUTBOUND].processed, memory_order_relaxed);
+    uint64_t end_to_end_total = atomic_load_explicit(&pipeline->end_to_end_total_ns, memory_order_relaxed);
+
+    log_info("pipeline: %lu event(s) completed, end-to-end avg %lu ns max %lu ns", completed,
+             completed == 0 ? 0 : end_to_end_total / completed,
+             atomic_load_explicit(&pipeline->end_to_end_max_ns, memory_order_relaxed));
+
+    for (size_t id = 0; id < PIPELINE_STAGE_COUNT; id++)
+    {
+        pipeline_stage_metrics_t metrics;
+        pipeline_get_metrics(pipeline, id, &metrics);
+
+        log_info("pipeline: %-9s depth %zu (max %lu/%zu), enqueued %lu, dropped %lu, processed %lu, "
+                 "time in stage avg %lu ns max %lu ns",
+                 pipeline->stages[id].config.name, metrics.depth, metrics.max_depth,
+                 pipeline->stages[id].config.capacity, metrics.enqueued, metrics.dropped, metrics.processed,
+                 metrics.processed == 0 ? 0 : metrics.time_total_ns / metrics.processed, metrics.time_max_ns);
+    }
+}
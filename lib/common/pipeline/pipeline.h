@@ -0,0 +1,109 @@
+#ifndef SUDOBOT_PIPELINE_PIPELINE_H
+#define SUDOBOT_PIPELINE_PIPELINE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <concord/discord.h>
+#include "queue.h"
+#include "../automod/automod.h"
+
+#define PIPELINE_METRICS_LOG_INTERVAL_NS (60ULL * 1000000000ULL)
+
+typedef enum pipeline_stage_id
+{
+    PIPELINE_STAGE_NORMALIZE,
+    PIPELINE_STAGE_AUTOMOD,
+    PIPELINE_STAGE_COMMAND,
+    PIPELINE_STAGE_OUTBOUND,
+    PIPELINE_STAGE_COUNT
+} pipeline_stage_id_t;
+
+/* What a producer does when the next stage's queue is full. */
+typedef enum pipeline_shed_policy
+{
+    /* Reject the incoming event. */
+    PIPELINE_SHED_DROP_NEWEST,
+    /* Evict the oldest queued event to make room. */
+    PIPELINE_SHED_DROP_OLDEST,
+    /* Wait for space up to the stage's block timeout, then reject. */
+    PIPELINE_SHED_BLOCK,
+} pipeline_shed_policy_t;
+
+typedef enum pipeline_event_type
+{
+    PIPELINE_EVENT_MESSAGE,
+    PIPELINE_EVENT_INTERACTION,
+} pipeline_event_type_t;
+
+typedef struct pipeline_event
+{
+    pipeline_event_type_t type;
+    struct discord *client;
+
+    union
+    {
+        const struct discord_message *message;
+        const struct discord_interaction *interaction;
+    };
+
+    automod_ctx_t automod;
+    uint64_t ingested_at_ns;
+    uint64_t stage_entered_at_ns;
+} pipeline_event_t;
+
+typedef struct pipeline_stage_config
+{
+    const char *name;
+    size_t workers;
+    size_t capacity;
+    pipeline_shed_policy_t policy;
+    uint64_t block_timeout_ms;
+} pipeline_stage_config_t;
+
+typedef struct pipeline_stage_metrics
+{
+    size_t depth;
+    uint64_t max_depth;
+    uint64_t enqueued;
+    uint64_t dropped;
+    uint64_t processed;
+    uint64_t time_total_ns;
+    uint64_t time_max_ns;
+} pipeline_stage_metrics_t;
+
+typedef struct pipeline_stage
+{
+    pipeline_stage_id_t id;
+    pipeline_stage_config_t config;
+    pipeline_queue_t queue;
+    pthread_t *threads;
+    struct pipeline *pipeline;
+    _Atomic uint64_t max_depth;
+    _Atomic uint64_t enqueued;
+    _Atomic uint64_t dropped;
+    _Atomic uint64_t processed;
+    _Atomic uint64_t time_total_ns;
+    _Atomic uint64_t time_max_ns;
+} pipeline_stage_t;
+
+typedef struct pipeline
+{
+    pipeline_stage_t stages[PIPELINE_STAGE_COUNT];
+    _Atomic uint64_t end_to_end_total_ns;
+    _Atomic uint64_t end_to_end_max_ns;
+    _Atomic uint64_t metrics_logged_at_ns;
+} pipeline_t;
+
+extern pipeline_t *pipeline;
+
+pipeline_t *pipeline_init();
+void pipeline_free(pipeline_t *pipeline);
+bool pipeline_submit_message(pipeline_t *pipeline, struct discord *client, const struct discord_message *message);
+bool pipeline_submit_interaction(pipeline_t *pipeline, struct discord *client,
+                                 const struct discord_interaction *interaction);
+void pipeline_get_metrics(pipeline_t *pipeline, pipeline_stage_id_t stage, pipeline_stage_metrics_t *metrics);
+void pipeline_log_metrics(pipeline_t *pipeline);
+
+#endif /* SUDOBOT_PIPELINE_PIPELINE_H */
@@ -0,0 +1,140 @@
+#include <errno.h>
+#include <time.h>
+#include "queue.h"
+#include "../utils/xmalloc.h"
+
+void pipeline_queue_init(pipeline_queue_t *queue, size_t capacity)
+{
+    size_t size = 2;
+
+    while (size < capacity)
+        size <<= 1;
+
+    queue->cells = xcalloc(size, sizeof (struct pipeline_queue_cell));
+    queue->mask = size - 1;
+
+    for (size_t i = 0; i < size; i++)
+        atomic_init(&queue->cells[i].sequence, i);
+
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    sem_init(&queue->items, 0, 0);
+    sem_init(&queue->slots, 0, (unsigned int) size);
+}
+
+void pipeline_queue_destroy(pipeline_queue_t *queue)
+{
+    sem_destroy(&queue->items);
+    sem_destroy(&queue->slots);
+    free(queue->cells);
+}
+
+bool pipeline_queue_try_reserve(pipeline_queue_t *queue)
+{
+    return sem_trywait(&queue->slots) == 0;
+}
+
+/* Waits up to timeout_ms for a free cell. */
+bool pipeline_queue_reserve(pipeline_queue_t *queue, uint64_t timeout_ms)
+{
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t) (timeout_ms / 1000);
+    deadline.tv_nsec += (long) ((timeout_ms % 1000) * 1000000);
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    while (sem_timedwait(&queue->slots, &deadline) != 0)
+    {
+        if (errno != EINTR)
+            return false;
+    }
+
+    return true;
+}
+
+/*
+ * The caller must hold a reservation from one of the reserve functions,
+ * which guarantees that a cell is free.
+ */
+void pipeline_queue_push_reserved(pipeline_queue_t *queue, void *data)
+{
+    size_t pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    struct pipeline_queue_cell *cell;
+
+    while (true)
+    {
+        cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t) sequence - (intptr_t) pos;
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueue_pos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
+        }
+        else
+            pos = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    }
+
+    cell->data = data;
+    atomic_store_explicit(&cell->sequence, pos + 1, memory_order_release);
+    sem_post(&queue->items);
+}
+
+static void *pipeline_queue_take(pipeline_queue_t *queue)
+{
+    size_t pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    struct pipeline_queue_cell *cell;
+
+    while (true)
+    {
+        cell = &queue->cells[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t) sequence - (intptr_t) (pos + 1);
+
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeue_pos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
+        }
+        else
+            pos = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+    }
+
+    void *data = cell->data;
+    atomic_store_explicit(&cell->sequence, pos + queue->mask + 1, memory_order_release);
+    sem_post(&queue->slots);
+    return data;
+}
+
+void *pipeline_queue_pop(pipeline_queue_t *queue)
+{
+    while (sem_wait(&queue->items) != 0)
+        ;
+
+    return pipeline_queue_take(queue);
+}
+
+void *pipeline_queue_try_pop(pipeline_queue_t *queue)
+{
+    if (sem_trywait(&queue->items) != 0)
+        return NULL;
+
+    return pipeline_queue_take(queue);
+}
+
+size_t pipeline_queue_depth(pipeline_queue_t *queue)
+{
+    size_t enqueued = atomic_load_explicit(&queue->enqueue_pos, memory_order_relaxed);
+    size_t dequeued = atomic_load_explicit(&queue->dequeue_pos, memory_order_relaxed);
+
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
@@ -0,0 +1,41 @@
+#ifndef SUDOBOT_PIPELINE_QUEUE_H
+#define SUDOBOT_PIPELINE_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <semaphore.h>
+
+struct pipeline_queue_cell
+{
+    _Atomic size_t sequence;
+    void *data;
+};
+
+/*
+ * Bounded lock-free MPMC ring (Vyukov's sequence-numbered design); it
+ * serves single-producer and single-consumer stages just as well. The
+ * semaphores count filled and free cells so that consumers can sleep
+ * while the queue is empty and producers can wait for space.
+ */
+typedef struct pipeline_queue
+{
+    struct pipeline_queue_cell *cells;
+    size_t mask;
+    sem_t items;
+    sem_t slots;
+    _Alignas(64) _Atomic size_t enqueue_pos;
+    _Alignas(64) _Atomic size_t dequeue_pos;
+} pipeline_queue_t;
+
+void pipeline_queue_init(pipeline_queue_t *queue, size_t capacity);
+void pipeline_queue_destroy(pipeline_queue_t *queue);
+bool pipeline_queue_try_reserve(pipeline_queue_t *queue);
+bool pipeline_queue_reserve(pipeline_queue_t *queue, uint64_t timeout_ms);
+void pipeline_queue_push_reserved(pipeline_queue_t *queue, void *data);
+void *pipeline_queue_pop(pipeline_queue_t *queue);
+void *pipeline_queue_try_pop(pipeline_queue_t *queue);
+size_t pipeline_queue_depth(pipeline_queue_t *queue);
+
+#endif /* SUDOBOT_PIPELINE_QUEUE_H */
@@ -0,0 +1,592 @@
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <concord/discord.h>
+#include "audit_log.h"
+#include "embeds.h"
+#include "scheduler.h"
+#include "../io/log.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define AUDIT_LOG_MIN_CAPACITY 16
+#define AUDIT_LOG_NOTICE_COLOR 0xf14a60
+
+typedef enum audit_log_placement
+{
+    AUDIT_LOG_PLACEMENT_FULL,
+    AUDIT_LOG_PLACEMENT_EMBED,
+    AUDIT_LOG_PLACEMENT_FIELD,
+} audit_log_placement_t;
+
+audit_log_t *audit_log = NULL;
+
+static uint64_t audit_log_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static struct audit_log_channel **audit_log_slot(audit_log_t *log, u64snowflake channel_id)
+{
+    for (size_t i = audit_log_hash(channel_id) & (log->capacity - 1);; i = (i + 1) & (log->capacity - 1))
+    {
+        if (log->channels[i] == NULL || log->channels[i]->id == channel_id)
+            return &log->channels[i];
+    }
+}
+
+static void audit_log_grow(audit_log_t *log)
+{
+    struct audit_log_channel **old = log->channels;
+    size_t old_capacity = log->capacity;
+
+    log->capacity = old_capacity == 0 ? AUDIT_LOG_MIN_CAPACITY : old_capacity * 2;
+    log->channels = xcalloc(log->capacity, sizeof (*log->channels));
+
+    for (size_t i = 0; i < old_capacity; i++)
+    {
+        if (old[i] != NULL)
+            *audit_log_slot(log, old[i]->id) = old[i];
+    }
+
+    free(old);
+}
+
+static struct audit_log_channel *audit_log_channel_get(audit_log_t *log, u64snowflake channel_id)
+{
+    if ((log->length + 1) * 4 > log->capacity * 3)
+        audit_log_grow(log);
+
+    struct audit_log_channel **slot = audit_log_slot(log, channel_id);
+
+    if (*slot == NULL)
+    {
+        *slot = xcalloc(1, sizeof (**slot));
+        (*slot)->log = log;
+        (*slot)->id = channel_id;
+        log->length++;
+    }
+
+    return *slot;
+}
+
+/* Copies at most max bytes, cutting on a UTF-8 character boundary and marking the cut with an ellipsis. */
+static char *audit_log_strdup(const char *str, size_t max)
+{
+    if (str == NULL)
+        return NULL;
+
+    size_t length = strnlen(str, max + 1);
+    char *copy;
+
+    if (length <= max)
+    {
+        copy = xmalloc(length + 1);
+        memcpy(copy, str, length + 1);
+        return copy;
+    }
+
+    length = max - 3;
+
+    while (length > 0 && ((unsigned char) str[length] & 0xC0) == 0x80)
+        length--;
+
+    copy = xmalloc(length + 4);
+    memcpy(copy, str, length);
+    memcpy(copy + length, "\xE2\x80\xA6", 4);
+    return copy;
+}
+
+static uint64_t audit_log_realtime_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static struct audit_log_entry *audit_log_entry_new(const audit_log_record_t *record)
+{
+    struct audit_log_entry *entry = xcalloc(1, sizeof (*entry));
+    struct discord_embed *embed = &entry->embed;
+
+    embed->title = audit_log_strdup(record->title, REST_EMBED_TITLE_MAX);
+    embed->color = record->color;
+    embed->timestamp = record->timestamp_ms != 0 ? record->timestamp_ms : audit_log_realtime_ms();
+    entry->compact = record->compact;
+
+    if (record->compact)
+    {
+        char name[32];
+
+        /* Rendered by the client as the local time of the record. */
+        snprintf(name, sizeof (name), "<t:%lu:T>", embed->timestamp / 1000);
+
+        embed->fields = xcalloc(1, sizeof (*embed->fields));
+        embed->fields->array = xcalloc(1, sizeof (struct discord_embed_field));
+        embed->fields->size = embed->fields->realsize = 1;
+        embed->fields->array[0].name = audit_log_strdup(name, REST_EMBED_FIELD_NAME_MAX);
+        embed->fields->array[0].value =
+            audit_log_strdup(record->description != NULL && *record->description != 0 ? record->description : "-",
+                             REST_EMBED_FIELD_VALUE_MAX);
+        entry->field_length = strlen(embed->fields->array[0].name) + strlen(embed->fields->array[0].value);
+        entry->length = rest_embed_length(embed);
+        return entry;
+    }
+
+    embed->description = audit_log_strdup(record->description, REST_EMBED_DESCRIPTION_MAX);
+
+    if (record->footer != NULL)
+    {
+        embed->footer = xcalloc(1, sizeof (*embed->footer));
+        embed->footer->text = audit_log_strdup(record->footer, REST_EMBED_FOOTER_MAX);
+    }
+
+    if (record->fields != NULL && record->field_count != 0)
+    {
+        size_t count = record->field_count < REST_EMBED_FIELDS_MAX ? record->field_count : REST_EMBED_FIELDS_MAX;
+
+        embed->fields = xcalloc(1, sizeof (*embed->fields));
+        embed->fields->array = xcalloc(count, sizeof (struct discord_embed_field));
+        embed->fields->realsize = (int) count;
+
+        size_t length = rest_embed_length(embed);
+
+        /* Fields that would take the embed past what a message may hold are left out. */
+        for (size_t i = 0; i < count; i++)
+        {
+            struct discord_embed_field *field = &embed->fields->array[embed->fields->size];
+
+            field->name = audit_log_strdup(record->fields[i].name != NULL ? record->fields[i].name : "-",
+                                           REST_EMBED_FIELD_NAME_MAX);
+            field->value = audit_log_strdup(record->fields[i].value != NULL ? record->fields[i].value : "-",
+                                            REST_EMBED_FIELD_VALUE_MAX);
+            field->Inline = record->fields[i].is_inline;
+            length += strlen(field->name) + strlen(field->value);
+
+            if (length > REST_MESSAGE_EMBED_LENGTH_MAX)
+            {
+                free(field->name);
+                free(field->value);
+                *field = (struct discord_embed_field) { 0 };
+                break;
+            }
+
+            embed->fields->size++;
+        }
+    }
+
+    entry->length = rest_embed_length(embed);
+    return entry;
+}
+
+static void audit_log_entry_free(struct audit_log_entry *entry)
+{
+    rest_embed_free(&entry->embed);
+    free(entry);
+}
+
+static bool audit_log_plan_groups(const struct audit_log_plan *plan, const struct audit_log_entry *entry)
+{
+    if (plan->group_fields == 0 || !entry->compact || entry->embed.color != plan->group_color)
+        return false;
+
+    if (entry->embed.title == NULL || plan->group_title == NULL)
+        return entry->embed.title == plan->group_title;
+
+    return strcmp(entry->embed.title, plan->group_title) == 0;
+}
+
+/*
+ * Decides where entry goes in the message planned so far: as a field of the
+ * last embed, as an embed of its own, or into the next message. Sending
+ * replays the same decisions, so the plan and the message always agree.
+ */
+static audit_log_placement_t audit_log_plan_add(struct audit_log_plan *plan, const struct audit_log_entry *entry)
+{
+    if (plan->group_fields < REST_EMBED_FIELDS_MAX && audit_log_plan_groups(plan, entry))
+    {
+        if (plan->length + entry->field_length > REST_MESSAGE_EMBED_LENGTH_MAX)
+            return AUDIT_LOG_PLACEMENT_FULL;
+
+        plan->length += entry->field_length;
+        plan->group_fields++;
+        plan->entries++;
+        return AUDIT_LOG_PLACEMENT_FIELD;
+    }
+
+    if (plan->embeds == REST_MESSAGE_EMBEDS_MAX ||
+        (plan->embeds != 0 && plan->length + entry->length > REST_MESSAGE_EMBED_LENGTH_MAX))
+        return AUDIT_LOG_PLACEMENT_FULL;
+
+    plan->length += entry->length;
+    plan->embeds++;
+    plan->group_fields = entry->compact ? 1 : 0;
+    plan->group_title = entry->embed.title;
+    plan->group_color = entry->embed.color;
+    plan->entries++;
+    return AUDIT_LOG_PLACEMENT_EMBED;
+}
+
+static void audit_log_replan(struct audit_log_channel *channel)
+{
+    channel->plan = (struct audit_log_plan) { 0 };
+    channel->full = false;
+
+    for (struct audit_log_entry *entry = channel->head; entry != NULL; entry = entry->next)
+    {
+        if (audit_log_plan_add(&channel->plan, entry) == AUDIT_LOG_PLACEMENT_FULL)
+        {
+            channel->full = true;
+            break;
+        }
+    }
+}
+
+static void audit_log_push(audit_log_t *log, struct audit_log_channel *channel, struct audit_log_entry *entry)
+{
+    entry->queued_at_ns = rest_scheduler_now(rest_scheduler);
+
+    if (channel->tail != NULL)
+        channel->tail->next = entry;
+    else
+        channel->head = entry;
+
+    channel->tail = entry;
+    channel->count++;
+    log->stats.buffered++;
+
+    if (!channel->full && audit_log_plan_add(&channel->plan, entry) == AUDIT_LOG_PLACEMENT_FULL)
+        channel->full = true;
+
+    if (!channel->active)
+    {
+        channel->active = true;
+        channel->next_active = log->active;
+        log->active = channel;
+    }
+}
+
+static void audit_log_write_text(FILE *file, const char *prefix, const char *text)
+{
+    if (text == NULL)
+        return;
+
+    fputs(prefix, file);
+
+    for (const char *c = text; *c != 0; c++)
+    {
+        if (*c == '\n')
+            fputs("\\n", file);
+        else
+            fputc(*c, file);
+    }
+}
+
+/* One line per embed: time, channel, title, description, fields and footer. */
+static void audit_log_write_embed(audit_log_t *log, u64snowflake channel_id, const struct discord_embed *embed)
+{
+    time_t seconds = (time_t) (embed->timestamp / 1000);
+    struct tm tm;
+    char timestamp[32];
+
+    gmtime_r(&seconds, &tm);
+    strftime(timestamp, sizeof (timestamp), "%Y-%m-%dT%H:%M:%SZ", &tm);
+    fprintf(log->overflow, "%s %lu", timestamp, channel_id);
+    audit_log_write_text(log->overflow, " ", embed->title);
+    audit_log_write_text(log->overflow, ": ", embed->description);
+
+    if (embed->fields != NULL)
+    {
+        for (int i = 0; i < embed->fields->size; i++)
+        {
+            audit_log_write_text(log->overflow, " | ", embed->fields->array[i].name);
+            audit_log_write_text(log->overflow, ": ", embed->fields->array[i].value);
+        }
+    }
+
+    if (embed->footer != NULL)
+        audit_log_write_text(log->overflow, " | ", embed->footer->text);
+
+    fputc('\n', log->overflow);
+}
+
+/* Takes the place of the records overflowed since the last one, so the channel shows where they went. */
+static void audit_log_push_notice(audit_log_t *log, struct audit_log_channel *channel)
+{
+    char description[128];
+
+    snprintf(description, sizeof (description), "%lu log %s %s.", channel->overflowed,
+             channel->overflowed == 1 ? "entry" : "entries",
+             log->overflow != NULL ? "could not be sent in time and went to the overflow log"
+                                   : "could not be sent in time and were dropped");
+
+    audit_log_record_t notice = {
+        .title = "Audit log overflow",
+        .description = description,
+        .color = AUDIT_LOG_NOTICE_COLOR,
+    };
+
+    channel->overflowed = 0;
+    audit_log_push(log, channel, audit_log_entry_new(&notice));
+}
+
+audit_log_t *audit_log_init(const audit_log_config_t *config)
+{
+    audit_log_t *log = xcalloc(1, sizeof (*log));
+
+    log->config = *config;
+    log->config.overflow_path = NULL;
+
+    if (log->config.channel_limit == 0)
+        log->config.channel_limit = AUDIT_LOG_DEFAULT_CHANNEL_LIMIT;
+
+    if (config->overflow_path != NULL && *config->overflow_path != 0)
+    {
+        /* Records can quote deleted messages, so only the bot may read them. */
+        int fd = open(config->overflow_path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0600);
+
+        if (fd >= 0 && (log->overflow = fdopen(fd, "a")) == NULL)
+            close(fd);
+
+        if (log->overflow == NULL)
+            log_error("audit_log: cannot open overflow file %s: %s; overflowing records will be dropped",
+                      config->overflow_path, get_last_error());
+        else
+            setvbuf(log->overflow, NULL, _IOLBF, 0);
+    }
+
+    pthread_mutex_init(&log->lock, NULL);
+    return log;
+}
+
+/**
+ * @brief Frees the emitter. Records still buffered go to the overflow file
+ * rather than being lost. Must not be called while messages it sent are
+ * still pending in the REST scheduler.
+ */
+void audit_log_free(audit_log_t *log)
+{
+    size_t written = 0;
+
+    for (size_t i = 0; i < log->capacity; i++)
+    {
+        struct audit_log_channel *channel = log->channels[i];
+
+        if (channel == NULL)
+            continue;
+
+        struct audit_log_entry *entry = channel->head;
+
+        while (entry != NULL)
+        {
+            struct audit_log_entry *next = entry->next;
+
+            if (log->overflow != NULL)
+            {
+                audit_log_write_embed(log, channel->id, &entry->embed);
+                written++;
+            }
+
+            audit_log_entry_free(entry);
+            entry = next;
+        }
+
+        free(channel);
+    }
+
+    if (written != 0)
+        log_warn("audit_log: wrote %zu unsent record(s) to the overflow file", written);
+
+    if (log->overflow != NULL)
+        fclose(log->overflow);
+
+    free(log->channels);
+    pthread_mutex_destroy(&log->lock);
+    free(log);
+}
+
+/**
+ * @brief Buffers a record for the log channel. Once the channel holds
+ * channel_limit records, further ones go to the overflow file until it
+ * catches up. Returns false if the record was dropped.
+ */
+bool audit_log_emit(audit_log_t *log, u64snowflake channel_id, const audit_log_record_t *record)
+{
+    struct audit_log_entry *entry = audit_log_entry_new(record);
+    bool buffered = true;
+
+    pthread_mutex_lock(&log->lock);
+
+    struct audit_log_channel *channel = audit_log_channel_get(log, channel_id);
+
+    log->stats.records++;
+
+    if (channel->count >= log->config.channel_limit)
+    {
+        if (log->overflow != NULL)
+        {
+            audit_log_write_embed(log, channel_id, &entry->embed);
+            log->stats.overflowed++;
+        }
+        else
+        {
+            log->stats.dropped++;
+            buffered = false;
+        }
+
+        channel->overflowed++;
+        audit_log_entry_free(entry);
+    }
+    else
+    {
+        if (channel->overflowed != 0)
+            audit_log_push_notice(log, channel);
+
+        audit_log_push(log, channel, entry);
+    }
+
+    pthread_mutex_unlock(&log->lock);
+    return buffered;
+}
+
+static void audit_log_done(rest_op_t *op, CCORDcode code)
+{
+    struct audit_log_channel *channel = op->data;
+    audit_log_t *log = channel->log;
+
+    pthread_mutex_lock(&log->lock);
+    channel->in_flight = false;
+
+    /* The notice goes out with the channel's next record, so a channel that keeps failing does not loop. */
+    if (code != CCORD_OK && op->message.params.embeds != NULL)
+    {
+        const struct discord_embeds *embeds = op->message.params.embeds;
+
+        log->stats.failed++;
+
+        if (log->overflow != NULL)
+        {
+            for (int i = 0; i < embeds->size; i++)
+                audit_log_write_embed(log, channel->id, &embeds->array[i]);
+
+            log->stats.overflowed += channel->in_flight_records;
+        }
+        else
+        {
+            log->stats.dropped += channel->in_flight_records;
+        }
+
+        channel->overflowed += channel->in_flight_records;
+    }
+
+    channel->in_flight_records = 0;
+
+    pthread_mutex_unlock(&log->lock);
+}
+
+/* Moves the planned records off the head of the channel into one message. */
+static struct discord_embeds *audit_log_take(audit_log_t *log, struct audit_log_channel *channel)
+{
+    struct discord_embeds *embeds = xcalloc(1, sizeof (*embeds));
+    struct audit_log_plan plan = { 0 };
+
+    embeds->array = xcalloc(REST_MESSAGE_EMBEDS_MAX, sizeof (*embeds->array));
+
+    while (channel->head != NULL)
+    {
+        struct audit_log_entry *entry = channel->head;
+        audit_log_placement_t placement = audit_log_plan_add(&plan, entry);
+
+        if (placement == AUDIT_LOG_PLACEMENT_FULL)
+            break;
+
+        channel->head = entry->next;
+        channel->count--;
+        log->stats.buffered--;
+
+        if (placement == AUDIT_LOG_PLACEMENT_EMBED)
+        {
+            embeds->array[embeds->size++] = entry->embed;
+            free(entry);
+            continue;
+        }
+
+        struct discord_embed_fields *fields = embeds->array[embeds->size - 1].fields;
+
+        if (fields->size == fields->realsize)
+        {
+            fields->realsize = REST_EMBED_FIELDS_MAX;
+            fields->array = xrealloc(fields->array, sizeof (*fields->array) * REST_EMBED_FIELDS_MAX);
+        }
+
+        fields->array[fields->size++] = entry->embed.fields->array[0];
+        entry->embed.fields->size = 0;
+        log->stats.folded++;
+        audit_log_entry_free(entry);
+    }
+
+    if (channel->head == NULL)
+        channel->tail = NULL;
+
+    channel->in_flight_records = plan.entries;
+    embeds->realsize = embeds->size;
+    return embeds;
+}
+
+/**
+ * @brief Sends the next message of every channel that is not waiting on
+ * its previous one, once it is full or its oldest record has waited
+ * flush_delay_ms. Runs on every event loop iteration.
+ */
+size_t audit_log_flush(audit_log_t *log, struct discord *client)
+{
+    uint64_t now = rest_scheduler_now(rest_scheduler);
+    uint64_t delay_ns = log->config.flush_delay_ms * 1000000;
+    struct audit_log_channel **link;
+    size_t sent = 0;
+
+    pthread_mutex_lock(&log->lock);
+    link = &log->active;
+
+    while (*link != NULL)
+    {
+        struct audit_log_channel *channel = *link;
+
+        if (channel->head == NULL)
+        {
+            channel->active = false;
+            *link = channel->next_active;
+            continue;
+        }
+
+        link = &channel->next_active;
+
+        if (channel->in_flight || (!channel->full && now - channel->head->queued_at_ns < delay_ns))
+            continue;
+
+        struct discord_create_message params = { .embeds = audit_log_take(log, channel) };
+
+        audit_log_replan(channel);
+        channel->in_flight = true;
+        log->stats.messages++;
+        rest_submit_message(client, channel->id, &params, REST_PRIORITY_LOG, &audit_log_done, channel);
+        sent++;
+    }
+
+    pthread_mutex_unlock(&log->lock);
+    return sent;
+}
+
+void audit_log_get_stats(audit_log_t *log, audit_log_stats_t *stats)
+{
+    pthread_mutex_lock(&log->lock);
+    *stats = log->stats;
+    pthread_mutex_unlock(&log->lock);
+}
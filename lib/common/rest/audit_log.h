@@ -0,0 +1,131 @@
+#ifndef SUDOBOT_REST_AUDIT_LOG_H
+#define SUDOBOT_REST_AUDIT_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define AUDIT_LOG_DEFAULT_FLUSH_DELAY_MS 1000
+#define AUDIT_LOG_DEFAULT_CHANNEL_LIMIT 5000
+
+typedef struct audit_log_field
+{
+    const char *name;
+    const char *value;
+    bool is_inline;
+} audit_log_field_t;
+
+typedef struct audit_log_record
+{
+    const char *title;
+    const char *description;
+    const char *footer;
+    int color;
+    /* Unix time in milliseconds; 0 for now. */
+    uint64_t timestamp_ms;
+    const audit_log_field_t *fields;
+    size_t field_count;
+    /*
+     * Compact records are reduced to a title and one line. Consecutive
+     * compact records with the same title and colour share an embed, each
+     * as one of its fields.
+     */
+    bool compact;
+} audit_log_record_t;
+
+typedef struct audit_log_config
+{
+    uint64_t flush_delay_ms;
+    /* Records buffered per channel before they go to the overflow file. */
+    size_t channel_limit;
+    const char *overflow_path;
+} audit_log_config_t;
+
+typedef struct audit_log_stats
+{
+    uint64_t records;
+    /* Records that became a field of an earlier record's embed. */
+    uint64_t folded;
+    uint64_t messages;
+    uint64_t overflowed;
+    /* Overflowed without an overflow file. */
+    uint64_t dropped;
+    uint64_t failed;
+    size_t buffered;
+} audit_log_stats_t;
+
+struct audit_log_entry
+{
+    struct audit_log_entry *next;
+    struct discord_embed embed;
+    /* rest_embed_length() of embed, and of its only field if compact. */
+    size_t length;
+    size_t field_length;
+    uint64_t queued_at_ns;
+    bool compact;
+};
+
+/* What the next message of a channel holds, built up as records arrive. */
+struct audit_log_plan
+{
+    size_t entries;
+    int embeds;
+    size_t length;
+    /* Fields of the last embed if it is a compact group, which shares the title and colour below. */
+    int group_fields;
+    const char *group_title;
+    int group_color;
+};
+
+struct audit_log;
+
+/*
+ * Records of one log channel, sent strictly in order: the next message is
+ * only built once the previous one has landed, so records arriving in the
+ * meantime are packed into it.
+ */
+struct audit_log_channel
+{
+    struct audit_log *log;
+    u64snowflake id;
+    struct audit_log_entry *head;
+    struct audit_log_entry *tail;
+    size_t count;
+    struct audit_log_plan plan;
+    /* The plan is a full message; more records wait for the one after. */
+    bool full;
+    bool in_flight;
+    bool active;
+    /* Records in the message in flight, counted as overflowed if it fails. */
+    size_t in_flight_records;
+    /* Records overflowed since the last notice in the channel. */
+    uint64_t overflowed;
+    struct audit_log_channel *next_active;
+};
+
+typedef struct audit_log
+{
+    pthread_mutex_t lock;
+    audit_log_config_t config;
+    FILE *overflow;
+    /* Open-addressed, keyed by channel ID. */
+    struct audit_log_channel **channels;
+    size_t capacity;
+    size_t length;
+    /* Channels with buffered records. */
+    struct audit_log_channel *active;
+    audit_log_stats_t stats;
+} audit_log_t;
+
+extern audit_log_t *audit_log;
+
+audit_log_t *audit_log_init(const audit_log_config_t *config);
+void audit_log_free(audit_log_t *log);
+bool audit_log_emit(audit_log_t *log, u64snowflake channel_id, const audit_log_record_t *record);
+size_t audit_log_flush(audit_log_t *log, struct discord *client);
+void audit_log_get_stats(audit_log_t *log, audit_log_stats_t *stats);
+
+#endif /* SUDOBOT_REST_AUDIT_LOG_H */
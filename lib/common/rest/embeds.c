@@ -0,0 +1,191 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <concord/discord.h>
+#include "embeds.h"
+#include "../utils/xmalloc.h"
+
+#define STRDUP_OR_NULL(str) ((str) == NULL ? NULL : strdup(str))
+
+static void *rest_memdup(const void *src, size_t size)
+{
+    if (src == NULL)
+        return NULL;
+
+    void *dest = xmalloc(size);
+    memcpy(dest, src, size);
+    return dest;
+}
+
+static void rest_embed_copy(struct discord_embed *dest, const struct discord_embed *src)
+{
+    *dest = *src;
+    dest->title = STRDUP_OR_NULL(src->title);
+    dest->type = STRDUP_OR_NULL(src->type);
+    dest->description = STRDUP_OR_NULL(src->description);
+    dest->url = STRDUP_OR_NULL(src->url);
+
+    if ((dest->footer = rest_memdup(src->footer, sizeof (*src->footer))) != NULL)
+    {
+        dest->footer->text = STRDUP_OR_NULL(src->footer->text);
+        dest->footer->icon_url = STRDUP_OR_NULL(src->footer->icon_url);
+    }
+
+    if ((dest->image = rest_memdup(src->image, sizeof (*src->image))) != NULL)
+    {
+        dest->image->url = STRDUP_OR_NULL(src->image->url);
+        dest->image->proxy_url = STRDUP_OR_NULL(src->image->proxy_url);
+    }
+
+    if ((dest->thumbnail = rest_memdup(src->thumbnail, sizeof (*src->thumbnail))) != NULL)
+    {
+        dest->thumbnail->url = STRDUP_OR_NULL(src->thumbnail->url);
+        dest->thumbnail->proxy_url = STRDUP_OR_NULL(src->thumbnail->proxy_url);
+    }
+
+    if ((dest->author = rest_memdup(src->author, sizeof (*src->author))) != NULL)
+    {
+        dest->author->name = STRDUP_OR_NULL(src->author->name);
+        dest->author->url = STRDUP_OR_NULL(src->author->url);
+        dest->author->icon_url = STRDUP_OR_NULL(src->author->icon_url);
+    }
+
+    if (src->fields != NULL)
+    {
+        dest->fields = xcalloc(1, sizeof (*dest->fields));
+        dest->fields->size = src->fields->size;
+        dest->fields->realsize = src->fields->size;
+        dest->fields->array = xcalloc(src->fields->size == 0 ? 1 : src->fields->size, sizeof (struct discord_embed_field));
+
+        for (int i = 0; i < src->fields->size; i++)
+        {
+            dest->fields->array[i] = src->fields->array[i];
+            dest->fields->array[i].name = STRDUP_OR_NULL(src->fields->array[i].name);
+            dest->fields->array[i].value = STRDUP_OR_NULL(src->fields->array[i].value);
+        }
+    }
+}
+
+void rest_embed_free(struct discord_embed *embed)
+{
+    free(embed->title);
+    free(embed->type);
+    free(embed->description);
+    free(embed->url);
+
+    if (embed->footer != NULL)
+    {
+        free(embed->footer->text);
+        free(embed->footer->icon_url);
+        free(embed->footer);
+    }
+
+    if (embed->image != NULL)
+    {
+        free(embed->image->url);
+        free(embed->image->proxy_url);
+        free(embed->image);
+    }
+
+    if (embed->thumbnail != NULL)
+    {
+        free(embed->thumbnail->url);
+        free(embed->thumbnail->proxy_url);
+        free(embed->thumbnail);
+    }
+
+    if (embed->author != NULL)
+    {
+        free(embed->author->name);
+        free(embed->author->url);
+        free(embed->author->icon_url);
+        free(embed->author);
+    }
+
+    if (embed->fields != NULL)
+    {
+        for (int i = 0; i < embed->fields->size; i++)
+        {
+            free(embed->fields->array[i].name);
+            free(embed->fields->array[i].value);
+        }
+
+        free(embed->fields->array);
+        free(embed->fields);
+    }
+}
+
+/**
+ * @brief Deep-copies the embeds in src to the end of dest.
+ *
+ * Queued requests outlive the caller's stack, so every string and nested
+ * object is duplicated.
+ */
+void rest_embeds_append(struct discord_embeds *dest, const struct discord_embeds *src)
+{
+    if (src == NULL || src->size == 0)
+        return;
+
+    dest->array = xrealloc(dest->array, sizeof (struct discord_embed) * (dest->size + src->size));
+
+    for (int i = 0; i < src->size; i++)
+        rest_embed_copy(&dest->array[dest->size + i], &src->array[i]);
+
+    dest->size += src->size;
+    dest->realsize = dest->size;
+}
+
+void rest_embeds_free(struct discord_embeds *embeds)
+{
+    if (embeds == NULL)
+        return;
+
+    for (int i = 0; i < embeds->size; i++)
+        rest_embed_free(&embeds->array[i]);
+
+    free(embeds->array);
+    free(embeds);
+}
+
+static size_t rest_strlen_or_zero(const char *str)
+{
+    return str == NULL ? 0 : strlen(str);
+}
+
+/**
+ * @brief Counts what Discord limits to REST_MESSAGE_EMBED_LENGTH_MAX per
+ * message: title, description, field names and values, footer text and
+ * author name. Bytes, so multi-byte characters are overcounted, never under.
+ */
+size_t rest_embed_length(const struct discord_embed *embed)
+{
+    size_t length = rest_strlen_or_zero(embed->title) + rest_strlen_or_zero(embed->description);
+
+    if (embed->footer != NULL)
+        length += rest_strlen_or_zero(embed->footer->text);
+
+    if (embed->author != NULL)
+        length += rest_strlen_or_zero(embed->author->name);
+
+    if (embed->fields != NULL)
+    {
+        for (int i = 0; i < embed->fields->size; i++)
+            length += rest_strlen_or_zero(embed->fields->array[i].name) +
+                      rest_strlen_or_zero(embed->fields->array[i].value);
+    }
+
+    return length;
+}
+
+size_t rest_embeds_length(const struct discord_embeds *embeds)
+{
+    size_t length = 0;
+
+    if (embeds == NULL)
+        return 0;
+
+    for (int i = 0; i < embeds->size; i++)
+        length += rest_embed_length(&embeds->array[i]);
+
+    return length;
+}
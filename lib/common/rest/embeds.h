@@ -0,0 +1,20 @@
+#ifndef SUDOBOT_REST_EMBEDS_H
+#define SUDOBOT_REST_EMBEDS_H
+
+#include <stdlib.h>
+#include <concord/discord.h>
+
+#define REST_EMBED_TITLE_MAX 256
+#define REST_EMBED_DESCRIPTION_MAX 4096
+#define REST_EMBED_FIELDS_MAX 25
+#define REST_EMBED_FIELD_NAME_MAX 256
+#define REST_EMBED_FIELD_VALUE_MAX 1024
+#define REST_EMBED_FOOTER_MAX 2048
+
+void rest_embeds_append(struct discord_embeds *dest, const struct discord_embeds *src);
+void rest_embeds_free(struct discord_embeds *embeds);
+void rest_embed_free(struct discord_embed *embed);
+size_t rest_embed_length(const struct discord_embed *embed);
+size_t rest_embeds_length(const struct discord_embeds *embeds);
+
+#endif /* SUDOBOT_REST_EMBEDS_H */
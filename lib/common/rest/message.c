@@ -0,0 +1,259 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <concord/discord.h>
+#include "embeds.h"
+#include "message.h"
+#include "../utils/xmalloc.h"
+
+#define STRDUP_OR_NULL(str) ((str) == NULL ? NULL : strdup(str))
+#define REST_JSON_INITIAL_SIZE 1024
+#define REST_JSON_MAX_SIZE (1024 * 1024)
+
+static struct strings *rest_strings_copy(const struct strings *src)
+{
+    if (src == NULL)
+        return NULL;
+
+    struct strings *dest = xcalloc(1, sizeof (*dest));
+
+    dest->size = dest->realsize = src->size;
+    dest->array = xcalloc(src->size == 0 ? 1 : src->size, sizeof (char *));
+
+    for (int i = 0; i < src->size; i++)
+        dest->array[i] = STRDUP_OR_NULL(src->array[i]);
+
+    return dest;
+}
+
+static void rest_strings_free(struct strings *strings)
+{
+    if (strings == NULL)
+        return;
+
+    for (int i = 0; i < strings->size; i++)
+        free(strings->array[i]);
+
+    free(strings->array);
+    free(strings);
+}
+
+static bool rest_strings_equal(const struct strings *a, const struct strings *b)
+{
+    int a_size = a == NULL ? 0 : a->size;
+    int b_size = b == NULL ? 0 : b->size;
+
+    if (a_size != b_size)
+        return false;
+
+    for (int i = 0; i < a_size; i++)
+    {
+        if ((a->array[i] == NULL || b->array[i] == NULL) ? a->array[i] != b->array[i]
+                                                         : strcmp(a->array[i], b->array[i]) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+static struct snowflakes *rest_snowflakes_copy(const struct snowflakes *src)
+{
+    if (src == NULL)
+        return NULL;
+
+    struct snowflakes *dest = xcalloc(1, sizeof (*dest));
+
+    dest->size = dest->realsize = src->size;
+    dest->array = xcalloc(src->size == 0 ? 1 : src->size, sizeof (u64snowflake));
+
+    if (src->size != 0)
+        memcpy(dest->array, src->array, sizeof (u64snowflake) * src->size);
+
+    return dest;
+}
+
+static void rest_snowflakes_free(struct snowflakes *snowflakes)
+{
+    if (snowflakes == NULL)
+        return;
+
+    free(snowflakes->array);
+    free(snowflakes);
+}
+
+static bool rest_snowflakes_equal(const struct snowflakes *a, const struct snowflakes *b)
+{
+    int a_size = a == NULL ? 0 : a->size;
+    int b_size = b == NULL ? 0 : b->size;
+
+    return a_size == b_size && (a_size == 0 || memcmp(a->array, b->array, sizeof (u64snowflake) * a_size) == 0);
+}
+
+struct discord_allowed_mention *rest_allowed_mention_copy(const struct discord_allowed_mention *src)
+{
+    if (src == NULL)
+        return NULL;
+
+    struct discord_allowed_mention *dest = xcalloc(1, sizeof (*dest));
+
+    *dest = *src;
+    dest->parse = rest_strings_copy(src->parse);
+    dest->roles = rest_snowflakes_copy(src->roles);
+    dest->users = rest_snowflakes_copy(src->users);
+    return dest;
+}
+
+void rest_allowed_mention_free(struct discord_allowed_mention *mention)
+{
+    if (mention == NULL)
+        return;
+
+    rest_strings_free(mention->parse);
+    rest_snowflakes_free(mention->roles);
+    rest_snowflakes_free(mention->users);
+    free(mention);
+}
+
+/*
+ * Whether two messages ping the same way. NULL, which lets Discord ping
+ * everything the content mentions, only matches NULL.
+ */
+bool rest_allowed_mention_equal(const struct discord_allowed_mention *a, const struct discord_allowed_mention *b)
+{
+    if (a == NULL || b == NULL)
+        return a == b;
+
+    return a->replied_user == b->replied_user && rest_strings_equal(a->parse, b->parse) &&
+           rest_snowflakes_equal(a->roles, b->roles) && rest_snowflakes_equal(a->users, b->users);
+}
+
+/* Components nest arbitrarily deep, so they are copied through concord's own JSON codec. */
+struct discord_components *rest_components_copy(const struct discord_components *src)
+{
+    if (src == NULL)
+        return NULL;
+
+    struct discord_components *dest = xcalloc(1, sizeof (*dest));
+    char *json = NULL;
+    size_t length = 0;
+
+    for (size_t size = REST_JSON_INITIAL_SIZE; length == 0 && size <= REST_JSON_MAX_SIZE; size *= 2)
+    {
+        json = xrealloc(json, size);
+        length = discord_components_to_json(json, size, src);
+    }
+
+    if (length != 0)
+        discord_components_from_json(json, length, dest);
+
+    free(json);
+    return dest;
+}
+
+void rest_components_free(struct discord_components *components)
+{
+    if (components == NULL)
+        return;
+
+    discord_components_cleanup(components);
+    free(components);
+}
+
+struct discord_attachments *rest_attachments_copy(const struct discord_attachments *src)
+{
+    if (src == NULL)
+        return NULL;
+
+    struct discord_attachments *dest = xcalloc(1, sizeof (*dest));
+
+    dest->size = dest->realsize = src->size;
+    dest->array = xcalloc(src->size == 0 ? 1 : src->size, sizeof (struct discord_attachment));
+
+    for (int i = 0; i < src->size; i++)
+    {
+        const struct discord_attachment *from = &src->array[i];
+        struct discord_attachment *to = &dest->array[i];
+
+        *to = *from;
+        to->filename = STRDUP_OR_NULL(from->filename);
+        to->description = STRDUP_OR_NULL(from->description);
+        to->content_type = STRDUP_OR_NULL(from->content_type);
+        to->url = STRDUP_OR_NULL(from->url);
+        to->proxy_url = STRDUP_OR_NULL(from->proxy_url);
+
+        /* Uploads carry the file itself; concord takes its length from size, or from strlen() when it is 0. */
+        if (from->content != NULL)
+        {
+            size_t length = from->size != 0 ? from->size : strlen(from->content);
+
+            to->content = xmalloc(length + 1);
+            memcpy(to->content, from->content, length);
+            to->content[length] = 0;
+        }
+    }
+
+    return dest;
+}
+
+void rest_attachments_free(struct discord_attachments *attachments)
+{
+    if (attachments == NULL)
+        return;
+
+    for (int i = 0; i < attachments->size; i++)
+    {
+        struct discord_attachment *attachment = &attachments->array[i];
+
+        free(attachment->content);
+        free(attachment->filename);
+        free(attachment->description);
+        free(attachment->content_type);
+        free(attachment->url);
+        free(attachment->proxy_url);
+    }
+
+    free(attachments->array);
+    free(attachments);
+}
+
+/**
+ * @brief Deep-copies every field of src into dest, so the message can be
+ * queued after the caller's copy is gone.
+ */
+void rest_message_copy(struct discord_create_message *dest, const struct discord_create_message *src)
+{
+    *dest = *src;
+    dest->content = STRDUP_OR_NULL(src->content);
+    dest->embeds = NULL;
+
+    if (src->embeds != NULL)
+    {
+        dest->embeds = xcalloc(1, sizeof (*dest->embeds));
+        rest_embeds_append(dest->embeds, src->embeds);
+    }
+
+    dest->allowed_mentions = rest_allowed_mention_copy(src->allowed_mentions);
+    dest->message_reference = NULL;
+
+    if (src->message_reference != NULL)
+    {
+        dest->message_reference = xmalloc(sizeof (*dest->message_reference));
+        *dest->message_reference = *src->message_reference;
+    }
+
+    dest->components = rest_components_copy(src->components);
+    dest->sticker_ids = rest_snowflakes_copy(src->sticker_ids);
+    dest->attachments = rest_attachments_copy(src->attachments);
+}
+
+/* Frees every field of a message copied by rest_message_copy(), but not params itself. */
+void rest_message_cleanup(struct discord_create_message *params)
+{
+    free(params->content);
+    rest_embeds_free(params->embeds);
+    rest_allowed_mention_free(params->allowed_mentions);
+    free(params->message_reference);
+    rest_components_free(params->components);
+    rest_snowflakes_free(params->sticker_ids);
+    rest_attachments_free(params->attachments);
+}
@@ -0,0 +1,17 @@
+#ifndef SUDOBOT_REST_MESSAGE_H
+#define SUDOBOT_REST_MESSAGE_H
+
+#include <stdbool.h>
+#include <concord/discord.h>
+
+struct discord_allowed_mention *rest_allowed_mention_copy(const struct discord_allowed_mention *src);
+void rest_allowed_mention_free(struct discord_allowed_mention *mention);
+bool rest_allowed_mention_equal(const struct discord_allowed_mention *a, const struct discord_allowed_mention *b);
+struct discord_components *rest_components_copy(const struct discord_components *src);
+void rest_components_free(struct discord_components *components);
+struct discord_attachments *rest_attachments_copy(const struct discord_attachments *src);
+void rest_attachments_free(struct discord_attachments *attachments);
+void rest_message_copy(struct discord_create_message *dest, const struct discord_create_message *src);
+void rest_message_cleanup(struct discord_create_message *params);
+
+#endif /* SUDOBOT_REST_MESSAGE_H */
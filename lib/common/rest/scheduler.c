@@ -0,0 +1,917 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <time.h>
+#include <concord/discord.h>
+#include "scheduler.h"
+#include "embeds.h"
+#include "message.h"
+#include "../io/log.h"
+#include "../metrics/metrics.h"
+#include "../store/snapshot.h"
+#include "../utils/trace.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define DISCORD_EPOCH_MS 1420070400000ULL
+#define REST_TABLE_INITIAL_CAPACITY 64
+#define REST_BUCKET_PRUNE_THRESHOLD 4096
+
+struct rest_route_limit
+{
+    unsigned int limit;
+    unsigned int window_ms;
+    bool global;
+};
+
+/*
+ * Per-route limits assumed until a response reports the real ones. Staying
+ * under Discord's windows keeps concord's own queues short and lets us pick
+ * the order.
+ */
+static const struct rest_route_limit rest_route_limits[REST_ROUTE_COUNT] = {
+    [REST_ROUTE_DELETE_MESSAGE] = { 5, 1000, true },
+    [REST_ROUTE_BULK_DELETE_MESSAGES] = { 1, 1000, true },
+    [REST_ROUTE_CREATE_GUILD_BAN] = { 5, 1000, true },
+    [REST_ROUTE_CREATE_MESSAGE] = { 5, 5000, true },
+    [REST_ROUTE_INTERACTION_RESPONSE] = { 50, 1000, false },
+};
+
+rest_scheduler_t *rest_scheduler = NULL;
+
+static uint64_t rest_now(rest_scheduler_t *scheduler)
+{
+    return scheduler->transport->now_ns != NULL ? scheduler->transport->now_ns() : get_monotonic_time_ns();
+}
+
+static size_t rest_table_slot(const struct rest_table *table, u64snowflake id, rest_route_t route)
+{
+    uint64_t hash = (id ^ ((uint64_t) route * 0x9E3779B97F4A7C15ULL)) * 0xFF51AFD7ED558CCDULL;
+    return (size_t) (hash >> 32) & (table->capacity - 1);
+}
+
+static struct rest_table_entry *rest_table_find(struct rest_table *table, u64snowflake id, rest_route_t route)
+{
+    if (table->capacity == 0)
+        return NULL;
+
+    for (size_t i = rest_table_slot(table, id, route);; i = (i + 1) & (table->capacity - 1))
+    {
+        struct rest_table_entry *entry = &table->entries[i];
+
+        if (entry->value == NULL)
+            return NULL;
+
+        if (entry->id == id && entry->route == route)
+            return entry;
+    }
+}
+
+static void rest_table_insert(struct rest_table *table, u64snowflake id, rest_route_t route, void *value);
+
+static void rest_table_grow(struct rest_table *table)
+{
+    struct rest_table old = *table;
+
+    table->capacity = old.capacity == 0 ? REST_TABLE_INITIAL_CAPACITY : old.capacity * 2;
+    table->entries = xcalloc(table->capacity, sizeof (struct rest_table_entry));
+    table->length = 0;
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        if (old.entries[i].value != NULL)
+            rest_table_insert(table, old.entries[i].id, old.entries[i].route, old.entries[i].value);
+    }
+
+    free(old.entries);
+}
+
+static void rest_table_insert(struct rest_table *table, u64snowflake id, rest_route_t route, void *value)
+{
+    if ((table->length + 1) * 4 > table->capacity * 3)
+        rest_table_grow(table);
+
+    for (size_t i = rest_table_slot(table, id, route);; i = (i + 1) & (table->capacity - 1))
+    {
+        struct rest_table_entry *entry = &table->entries[i];
+
+        if (entry->value == NULL || (entry->id == id && entry->route == route))
+        {
+            if (entry->value == NULL)
+                table->length++;
+
+            entry->id = id;
+            entry->route = route;
+            entry->value = value;
+            return;
+        }
+    }
+}
+
+/* Backward-shift deletion keeps probe chains intact without tombstones. */
+static void rest_table_remove(struct rest_table *table, struct rest_table_entry *entry)
+{
+    size_t mask = table->capacity - 1;
+    size_t hole = (size_t) (entry - table->entries);
+
+    for (size_t i = (hole + 1) & mask; table->entries[i].value != NULL; i = (i + 1) & mask)
+    {
+        size_t home = rest_table_slot(table, table->entries[i].id, table->entries[i].route);
+
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            table->entries[hole] = table->entries[i];
+            hole = i;
+        }
+    }
+
+    table->entries[hole].value = NULL;
+    table->length--;
+}
+
+static void rest_op_free(rest_op_t *op)
+{
+    switch (op->route)
+    {
+        case REST_ROUTE_DELETE_MESSAGE:
+        case REST_ROUTE_BULK_DELETE_MESSAGES:
+            free(op->delete.message_ids);
+            break;
+
+        case REST_ROUTE_CREATE_GUILD_BAN:
+            free(op->ban.reason);
+            break;
+
+        case REST_ROUTE_CREATE_MESSAGE:
+            rest_message_cleanup(&op->message.params);
+            break;
+
+        case REST_ROUTE_INTERACTION_RESPONSE:
+            free(op->interaction.token);
+
+            if (op->interaction.params.data != NULL)
+            {
+                free(op->interaction.params.data->content);
+                rest_embeds_free(op->interaction.params.data->embeds);
+                rest_allowed_mention_free(op->interaction.params.data->allowed_mentions);
+                rest_components_free(op->interaction.params.data->components);
+                rest_attachments_free(op->interaction.params.data->attachments);
+                free(op->interaction.params.data);
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    free(op);
+}
+
+static void rest_queue_push(rest_scheduler_t *scheduler, rest_op_t *op, bool front)
+{
+    rest_priority_t priority = op->priority;
+
+    if (front)
+    {
+        op->prev = NULL;
+        op->next = scheduler->head[priority];
+
+        if (op->next != NULL)
+            op->next->prev = op;
+        else
+            scheduler->tail[priority] = op;
+
+        scheduler->head[priority] = op;
+    }
+    else
+    {
+        op->next = NULL;
+        op->prev = scheduler->tail[priority];
+
+        if (op->prev != NULL)
+            op->prev->next = op;
+        else
+            scheduler->head[priority] = op;
+
+        scheduler->tail[priority] = op;
+    }
+
+    scheduler->pending++;
+}
+
+static void rest_queue_unlink(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    if (op->prev != NULL)
+        op->prev->next = op->next;
+    else
+        scheduler->head[op->priority] = op->next;
+
+    if (op->next != NULL)
+        op->next->prev = op->prev;
+    else
+        scheduler->tail[op->priority] = op->prev;
+
+    op->prev = op->next = NULL;
+    scheduler->pending--;
+}
+
+static void rest_close_open_op(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    struct rest_table_entry *entry = rest_table_find(&scheduler->open_ops, op->major_id, op->route);
+
+    if (entry != NULL && entry->value == op)
+        rest_table_remove(&scheduler->open_ops, entry);
+}
+
+static bool rest_message_id_is_bulk_deletable(rest_scheduler_t *scheduler, u64snowflake message_id)
+{
+    (void) scheduler;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    uint64_t now_ms = ((uint64_t) ts.tv_sec * 1000) + ((uint64_t) ts.tv_nsec / 1000000);
+    uint64_t created_at_ms = (message_id >> 22) + DISCORD_EPOCH_MS;
+
+    return now_ms < created_at_ms + REST_BULK_DELETE_MAX_AGE_MS;
+}
+
+/*
+ * Tries to fold op into a pending operation on the same route and major
+ * ID. Returns true if op was merged, in which case it has been freed.
+ */
+static bool rest_try_coalesce(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    struct rest_table_entry *entry = rest_table_find(&scheduler->open_ops, op->major_id, op->route);
+    rest_op_t *open = entry == NULL ? NULL : entry->value;
+
+    if (op->route == REST_ROUTE_DELETE_MESSAGE)
+    {
+        if (!rest_message_id_is_bulk_deletable(scheduler, op->delete.message_ids[0]))
+            return false;
+
+        if (open == NULL)
+        {
+            rest_table_insert(&scheduler->open_ops, op->major_id, op->route, op);
+            return false;
+        }
+
+        for (size_t i = 0; i < open->delete.count; i++)
+        {
+            if (open->delete.message_ids[i] == op->delete.message_ids[0])
+            {
+                rest_op_free(op);
+                return true;
+            }
+        }
+
+        open->delete.message_ids =
+            xrealloc(open->delete.message_ids, sizeof (u64snowflake) * (open->delete.count + 1));
+        open->delete.message_ids[open->delete.count++] = op->delete.message_ids[0];
+
+        if (op->priority < open->priority)
+        {
+            rest_queue_unlink(scheduler, open);
+            open->priority = op->priority;
+            rest_queue_push(scheduler, open, false);
+        }
+
+        if (open->delete.count == REST_BULK_DELETE_MAX)
+            rest_table_remove(&scheduler->open_ops, entry);
+
+        rest_op_free(op);
+        return true;
+    }
+
+    if (op->route == REST_ROUTE_CREATE_MESSAGE && op->message.mergeable)
+    {
+        struct discord_create_message *params = &op->message.params;
+        int embed_count = params->embeds == NULL ? 0 : params->embeds->size;
+
+        if (open != NULL)
+        {
+            struct discord_create_message *open_params = &open->message.params;
+            int open_embed_count = open_params->embeds == NULL ? 0 : open_params->embeds->size;
+            size_t content_length = open->message.content_length + op->message.content_length +
+                                    (open->message.content_length != 0 && op->message.content_length != 0);
+
+            if (open_params->flags == params->flags &&
+                rest_allowed_mention_equal(open_params->allowed_mentions, params->allowed_mentions) &&
+                open_embed_count + embed_count <= REST_MESSAGE_EMBEDS_MAX &&
+                content_length <= REST_MESSAGE_CONTENT_MAX &&
+                open->message.embed_length + op->message.embed_length <= REST_MESSAGE_EMBED_LENGTH_MAX)
+            {
+                if (op->message.content_length != 0)
+                {
+                    if (open->message.content_length == 0)
+                    {
+                        open_params->content = params->content;
+                        params->content = NULL;
+                    }
+                    else
+                    {
+                        open_params->content = xrealloc(open_params->content, content_length + 1);
+                        open_params->content[open->message.content_length] = '\n';
+                        memcpy(open_params->content + open->message.content_length + 1, params->content,
+                               op->message.content_length + 1);
+                    }
+
+                    open->message.content_length = content_length;
+                }
+
+                if (embed_count != 0)
+                {
+                    if (open_params->embeds == NULL)
+                    {
+                        open_params->embeds = params->embeds;
+                        params->embeds = NULL;
+                    }
+                    else
+                        rest_embeds_append(open_params->embeds, params->embeds);
+
+                    open->message.embed_length += op->message.embed_length;
+                }
+
+                rest_op_free(op);
+                return true;
+            }
+
+            rest_table_remove(&scheduler->open_ops, entry);
+        }
+
+        rest_table_insert(&scheduler->open_ops, op->major_id, op->route, op);
+    }
+
+    return false;
+}
+
+rest_scheduler_t *rest_scheduler_init(const rest_transport_t *transport)
+{
+    rest_scheduler_t *scheduler = xcalloc(1, sizeof (*scheduler));
+
+    scheduler->transport = transport;
+    scheduler->global.limit = scheduler->global.remaining = REST_GLOBAL_LIMIT;
+    pthread_mutex_init(&scheduler->lock, NULL);
+
+    return scheduler;
+}
+
+/**
+ * @brief Frees the scheduler. Requests still queued are dropped; those with
+ * a completion callback are told so with CCORD_RESOURCE_UNAVAILABLE.
+ */
+void rest_scheduler_free(rest_scheduler_t *scheduler)
+{
+    for (size_t priority = 0; priority < REST_PRIORITY_COUNT; priority++)
+    {
+        rest_op_t *op = scheduler->head[priority];
+
+        while (op != NULL)
+        {
+            rest_op_t *next = op->next;
+
+            if (op->done != NULL)
+                op->done(op, CCORD_RESOURCE_UNAVAILABLE);
+
+            rest_op_free(op);
+            op = next;
+        }
+    }
+
+    for (size_t i = 0; i < scheduler->buckets.capacity; i++)
+        free(scheduler->buckets.entries[i].value);
+
+    if (scheduler->pending != 0)
+        log_warn("rest: dropped %zu pending request(s)", scheduler->pending);
+
+    free(scheduler->buckets.entries);
+    free(scheduler->open_ops.entries);
+    pthread_mutex_destroy(&scheduler->lock);
+    free(scheduler);
+}
+
+void rest_scheduler_submit(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    pthread_mutex_lock(&scheduler->lock);
+    scheduler->stats.submitted[op->route]++;
+
+    TRACE_PROBE3(rest_enqueue, op->route, op->major_id, op->priority);
+
+    if (rest_try_coalesce(scheduler, op))
+        scheduler->stats.coalesced++;
+    else
+        rest_queue_push(scheduler, op, false);
+
+    void (*wake)(void *data) = scheduler->wake;
+    void *wake_data = scheduler->wake_data;
+
+    pthread_mutex_unlock(&scheduler->lock);
+
+    if (wake != NULL)
+        wake(wake_data);
+}
+
+/* Closes the window once its reset has passed, restoring the full limit. */
+static void rest_window_roll(struct rest_window *window, uint64_t now)
+{
+    if (window->reset_at_ns != 0 && window->reset_at_ns <= now)
+    {
+        window->remaining = window->limit;
+        window->opened_at_ns = window->reset_at_ns = 0;
+    }
+}
+
+/*
+ * Counts a request against the window. Discord opens a window with the
+ * first request it sees; until a response says when it resets, it is
+ * assumed to last window_ms from now.
+ */
+static void rest_window_take(struct rest_window *window, unsigned int window_ms, uint64_t now)
+{
+    if (window->reset_at_ns == 0)
+    {
+        window->opened_at_ns = now;
+        window->reset_at_ns = now + (uint64_t) window_ms * 1000000;
+    }
+
+    window->remaining--;
+}
+
+/*
+ * Applies the headers of a response to a request counted in the window
+ * opened at opened_at_ns. Responses arriving after that window has closed
+ * describe it rather than the current one, and are left out.
+ */
+static void rest_window_update(struct rest_window *window, const rest_ratelimit_t *ratelimit,
+                               uint64_t opened_at_ns, uint64_t now)
+{
+    rest_window_roll(window, now);
+
+    if (ratelimit->limit == 0 || window->reset_at_ns == 0 || window->opened_at_ns != opened_at_ns)
+        return;
+
+    window->limit = ratelimit->limit;
+    window->reset_at_ns = now + ratelimit->reset_after_ms * 1000000;
+
+    if (ratelimit->remaining < window->remaining)
+        window->remaining = ratelimit->remaining;
+}
+
+/* Blocks the window until a rate limited request may be retried. */
+static void rest_window_block(struct rest_window *window, uint64_t retry_after_ms, uint64_t now)
+{
+    uint64_t reset_at_ns = now + retry_after_ms * 1000000;
+
+    window->remaining = 0;
+
+    if (window->reset_at_ns == 0)
+        window->opened_at_ns = now;
+
+    if (reset_at_ns > window->reset_at_ns)
+        window->reset_at_ns = reset_at_ns;
+}
+
+static struct rest_window *rest_bucket_get(rest_scheduler_t *scheduler, rest_route_t route, u64snowflake major_id)
+{
+    struct rest_table_entry *entry = rest_table_find(&scheduler->buckets, major_id, route);
+
+    if (entry != NULL)
+        return entry->value;
+
+    struct rest_window *bucket = xcalloc(1, sizeof (*bucket));
+
+    bucket->limit = bucket->remaining = rest_route_limits[route].limit;
+    rest_table_insert(&scheduler->buckets, major_id, route, bucket);
+    return bucket;
+}
+
+/* Drops buckets whose window has closed; they are recreated on demand. */
+static void rest_buckets_prune(rest_scheduler_t *scheduler, uint64_t now)
+{
+    struct rest_table old = scheduler->buckets;
+
+    memset(&scheduler->buckets, 0, sizeof (scheduler->buckets));
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        struct rest_table_entry *entry = &old.entries[i];
+        struct rest_window *bucket = entry->value;
+
+        if (bucket == NULL)
+            continue;
+
+        rest_window_roll(bucket, now);
+
+        if (bucket->reset_at_ns == 0)
+            free(bucket);
+        else
+            rest_table_insert(&scheduler->buckets, entry->id, entry->route, bucket);
+    }
+
+    free(old.entries);
+}
+
+static rest_route_t rest_op_effective_route(const rest_op_t *op)
+{
+    if (op->route == REST_ROUTE_DELETE_MESSAGE && op->delete.count > 1)
+        return REST_ROUTE_BULK_DELETE_MESSAGES;
+
+    return op->route;
+}
+
+/**
+ * @brief Sends every queued request that its buckets currently allow.
+ *
+ * Queues are walked in priority order, so moderation actions take the
+ * global budget first. A request whose route bucket is exhausted does not
+ * block requests on other buckets behind it.
+ */
+size_t rest_scheduler_flush(rest_scheduler_t *scheduler)
+{
+    rest_op_t *ready = NULL, **ready_tail = &ready;
+    size_t count = 0;
+
+    pthread_mutex_lock(&scheduler->lock);
+
+    uint64_t now = rest_now(scheduler);
+
+    rest_window_roll(&scheduler->global, now);
+
+    if (scheduler->buckets.length > REST_BUCKET_PRUNE_THRESHOLD)
+        rest_buckets_prune(scheduler, now);
+
+    for (size_t priority = 0; priority < REST_PRIORITY_COUNT; priority++)
+    {
+        rest_op_t *next;
+
+        for (rest_op_t *op = scheduler->head[priority]; op != NULL; op = next)
+        {
+            next = op->next;
+
+            rest_route_t route = rest_op_effective_route(op);
+            const struct rest_route_limit *limit = &rest_route_limits[route];
+
+            if (limit->global && scheduler->global.remaining == 0)
+                continue;
+
+            struct rest_window *bucket = rest_bucket_get(scheduler, route, op->major_id);
+            rest_window_roll(bucket, now);
+
+            if (bucket->remaining == 0)
+                continue;
+
+            rest_window_take(bucket, limit->window_ms, now);
+            op->window_opened_at_ns = bucket->opened_at_ns;
+
+            if (limit->global)
+                rest_window_take(&scheduler->global, REST_GLOBAL_WINDOW_MS, now);
+
+            rest_queue_unlink(scheduler, op);
+            rest_close_open_op(scheduler, op);
+            scheduler->stats.dispatched[route]++;
+
+            *ready_tail = op;
+            ready_tail = &op->next;
+            count++;
+        }
+    }
+
+    pthread_mutex_unlock(&scheduler->lock);
+
+    while (ready != NULL)
+    {
+        rest_op_t *op = ready;
+        ready = op->next;
+        op->next = NULL;
+        op->dispatched_at_ns = get_monotonic_time_ns();
+        scheduler->transport->dispatch(scheduler, op);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Reports the outcome of a dispatched operation. ratelimit carries
+ * the rate-limit headers of the response, or is NULL when the transport
+ * does not know them.
+ */
+void rest_scheduler_complete(rest_scheduler_t *scheduler, rest_op_t *op, CCORDcode code,
+                             const rest_ratelimit_t *ratelimit)
+{
+    TRACE_PROBE4(rest_complete, op->route, op->major_id, code, op->dispatched_at_ns);
+
+    rest_route_t route = rest_op_effective_route(op);
+
+    if (code == CCORD_OK)
+    {
+        if (ratelimit != NULL)
+        {
+            pthread_mutex_lock(&scheduler->lock);
+            rest_window_update(rest_bucket_get(scheduler, route, op->major_id), ratelimit, op->window_opened_at_ns,
+                               rest_now(scheduler));
+            pthread_mutex_unlock(&scheduler->lock);
+        }
+
+        metrics_record_rest(route, METRICS_REST_OK, op->dispatched_at_ns);
+
+        if (op->done != NULL)
+            op->done(op, code);
+
+        rest_op_free(op);
+        return;
+    }
+
+    pthread_mutex_lock(&scheduler->lock);
+
+    if (code == CCORD_DISCORD_RATELIMIT && op->retries < REST_MAX_RETRIES)
+    {
+        uint64_t now = rest_now(scheduler);
+        uint64_t retry_after_ms = ratelimit != NULL ? ratelimit->reset_after_ms : rest_route_limits[route].window_ms;
+
+        if (ratelimit != NULL && ratelimit->global)
+            rest_window_block(&scheduler->global, retry_after_ms, now);
+        else
+            rest_window_block(rest_bucket_get(scheduler, route, op->major_id), retry_after_ms, now);
+
+        scheduler->stats.rate_limited++;
+        metrics_record_rest(route, METRICS_REST_RATE_LIMITED, op->dispatched_at_ns);
+        op->retries++;
+        rest_queue_push(scheduler, op, true);
+        pthread_mutex_unlock(&scheduler->lock);
+        return;
+    }
+
+    scheduler->stats.failed++;
+    pthread_mutex_unlock(&scheduler->lock);
+    metrics_record_rest(route, METRICS_REST_FAILED, op->dispatched_at_ns);
+
+    log_error("rest: request on route %d (major %lu) failed with code %d", op->route, op->major_id, code);
+
+    if (op->done != NULL)
+        op->done(op, code);
+
+    rest_op_free(op);
+}
+
+void rest_scheduler_get_stats(rest_scheduler_t *scheduler, rest_stats_t *stats)
+{
+    pthread_mutex_lock(&scheduler->lock);
+    *stats = scheduler->stats;
+    pthread_mutex_unlock(&scheduler->lock);
+}
+
+size_t rest_scheduler_pending(rest_scheduler_t *scheduler)
+{
+    pthread_mutex_lock(&scheduler->lock);
+    size_t pending = scheduler->pending;
+    pthread_mutex_unlock(&scheduler->lock);
+    return pending;
+}
+
+uint64_t rest_scheduler_now(rest_scheduler_t *scheduler)
+{
+    return rest_now(scheduler);
+}
+
+/*
+ * Snapshot section: the global window and per-route buckets, with their
+ * resets stored relative to the save, since monotonic clocks do not survive
+ * a restart. Version 1 stored continuous token buckets and is not loaded.
+ */
+struct rest_snapshot_header
+{
+    uint32_t global_remaining;
+    uint32_t reserved;
+    uint64_t global_reset_in_ms;
+    uint64_t count;
+};
+
+struct rest_snapshot_bucket
+{
+    uint64_t major_id;
+    uint32_t route;
+    uint32_t limit;
+    uint32_t remaining;
+    uint32_t reserved;
+    uint64_t reset_in_ms;
+};
+
+static uint64_t rest_remaining_ms(uint64_t until_ns, uint64_t now)
+{
+    return until_ns > now ? (until_ns - now) / 1000000 : 0;
+}
+
+/* Restores a window saved with reset_in_ms left, unless it has closed since. */
+static void rest_window_restore(struct rest_window *window, unsigned int remaining, uint64_t reset_in_ms,
+                                const snapshot_info_t *info, uint64_t now)
+{
+    if (reset_in_ms <= info->elapsed_ms)
+        return;
+
+    window->remaining = remaining < window->limit ? remaining : window->limit;
+    window->opened_at_ns = now;
+    window->reset_at_ns = now + (reset_in_ms - info->elapsed_ms) * 1000000;
+}
+
+void rest_scheduler_snapshot_save(snapshot_writer_t *writer)
+{
+    rest_scheduler_t *scheduler = rest_scheduler;
+    struct rest_snapshot_header header = { 0 };
+
+    if (scheduler == NULL)
+    {
+        snapshot_write(writer, &header, sizeof header);
+        return;
+    }
+
+    pthread_mutex_lock(&scheduler->lock);
+
+    uint64_t now = rest_now(scheduler);
+
+    header.global_remaining = scheduler->global.remaining;
+    header.global_reset_in_ms = rest_remaining_ms(scheduler->global.reset_at_ns, now);
+
+    for (size_t i = 0; i < scheduler->buckets.capacity; i++)
+        header.count += scheduler->buckets.entries[i].value != NULL;
+
+    snapshot_write(writer, &header, sizeof header);
+
+    for (size_t i = 0; i < scheduler->buckets.capacity; i++)
+    {
+        const struct rest_table_entry *entry = &scheduler->buckets.entries[i];
+        const struct rest_window *bucket = entry->value;
+
+        if (bucket == NULL)
+            continue;
+
+        struct rest_snapshot_bucket record = {
+            .major_id = entry->id,
+            .route = (uint32_t) entry->route,
+            .limit = bucket->limit,
+            .remaining = bucket->remaining,
+            .reset_in_ms = rest_remaining_ms(bucket->reset_at_ns, now),
+        };
+
+        snapshot_write(writer, &record, sizeof record);
+    }
+
+    pthread_mutex_unlock(&scheduler->lock);
+}
+
+bool rest_scheduler_snapshot_load(const void *data, size_t length, const snapshot_info_t *info)
+{
+    rest_scheduler_t *scheduler = rest_scheduler;
+    const struct rest_snapshot_header *header = data;
+
+    if (scheduler == NULL || info->version < 2 || length < sizeof (*header) ||
+        (length - sizeof (*header)) / sizeof (struct rest_snapshot_bucket) < header->count)
+        return false;
+
+    const struct rest_snapshot_bucket *records = (const struct rest_snapshot_bucket *) (header + 1);
+
+    pthread_mutex_lock(&scheduler->lock);
+
+    uint64_t now = rest_now(scheduler);
+
+    rest_window_restore(&scheduler->global, header->global_remaining, header->global_reset_in_ms, info, now);
+
+    for (uint64_t i = 0; i < header->count; i++)
+    {
+        if (records[i].route >= REST_ROUTE_COUNT || records[i].limit == 0)
+            continue;
+
+        struct rest_window *bucket = rest_bucket_get(scheduler, (rest_route_t) records[i].route,
+                                                     records[i].major_id);
+
+        bucket->limit = bucket->remaining = records[i].limit;
+        rest_window_restore(bucket, records[i].remaining, records[i].reset_in_ms, info, now);
+    }
+
+    pthread_mutex_unlock(&scheduler->lock);
+    log_debug("rest: restored %lu bucket(s) from snapshot", header->count);
+    return true;
+}
+
+void rest_on_cycle(struct discord *client)
+{
+    (void) client;
+
+    if (rest_scheduler == NULL)
+        return;
+
+    pthread_mutex_lock(&rest_scheduler->lock);
+    size_t pending = rest_scheduler->pending;
+    pthread_mutex_unlock(&rest_scheduler->lock);
+
+    if (pending > 0)
+        rest_scheduler_flush(rest_scheduler);
+}
+
+static rest_op_t *rest_op_new(struct discord *client, rest_route_t route, rest_priority_t priority,
+                              u64snowflake major_id)
+{
+    rest_op_t *op = xcalloc(1, sizeof (*op));
+
+    op->client = client;
+    op->route = route;
+    op->priority = priority;
+    op->major_id = major_id;
+
+    return op;
+}
+
+void rest_delete_message(struct discord *client, u64snowflake channel_id, u64snowflake message_id,
+                         rest_priority_t priority)
+{
+    rest_op_t *op = rest_op_new(client, REST_ROUTE_DELETE_MESSAGE, priority, channel_id);
+
+    op->delete.message_ids = xmalloc(sizeof (u64snowflake));
+    op->delete.message_ids[0] = message_id;
+    op->delete.count = 1;
+    rest_scheduler_submit(rest_scheduler, op);
+}
+
+void rest_ban_member(struct discord *client, u64snowflake guild_id, u64snowflake user_id,
+                     int delete_message_seconds, const char *reason)
+{
+    rest_op_t *op = rest_op_new(client, REST_ROUTE_CREATE_GUILD_BAN, REST_PRIORITY_MODERATION, guild_id);
+
+    op->ban.user_id = user_id;
+    op->ban.delete_message_seconds = delete_message_seconds;
+    op->ban.reason = reason == NULL ? NULL : strdup(reason);
+    rest_scheduler_submit(rest_scheduler, op);
+}
+
+/**
+ * @brief Queues a copy of every field of the message. Log messages made
+ * only of content and embeds, without a reply reference, are merged with
+ * other pending log messages to the same channel that have the same flags
+ * and allowed mentions.
+ */
+void rest_create_message(struct discord *client, u64snowflake channel_id,
+                         const struct discord_create_message *params, rest_priority_t priority)
+{
+    rest_op_t *op = rest_op_new(client, REST_ROUTE_CREATE_MESSAGE, priority, channel_id);
+
+    rest_message_copy(&op->message.params, params);
+    op->message.content_length = params->content == NULL ? 0 : strlen(params->content);
+    op->message.embed_length = rest_embeds_length(op->message.params.embeds);
+
+    /* Only plain text and embeds can be folded into another message. */
+    op->message.mergeable = priority == REST_PRIORITY_LOG && params->message_reference == NULL && !params->tts &&
+                            params->components == NULL && params->sticker_ids == NULL &&
+                            params->attachments == NULL;
+    rest_scheduler_submit(rest_scheduler, op);
+}
+
+/**
+ * @brief Queues a message built on the heap, taking over all of its
+ * fields. It is never merged with other messages, and done is called with
+ * data in op->data once it has been sent or has finally failed.
+ */
+void rest_submit_message(struct discord *client, u64snowflake channel_id, struct discord_create_message *params,
+                         rest_priority_t priority, void (*done)(rest_op_t *op, CCORDcode code), void *data)
+{
+    rest_op_t *op = rest_op_new(client, REST_ROUTE_CREATE_MESSAGE, priority, channel_id);
+
+    op->message.params = *params;
+    op->message.content_length = params->content == NULL ? 0 : strlen(params->content);
+    op->message.embed_length = rest_embeds_length(params->embeds);
+    op->done = done;
+    op->data = data;
+    *params = (struct discord_create_message) { 0 };
+    rest_scheduler_submit(rest_scheduler, op);
+}
+
+void rest_create_interaction_response(struct discord *client, u64snowflake interaction_id,
+                                      const char *interaction_token,
+                                      const struct discord_interaction_response *params)
+{
+    rest_op_t *op = rest_op_new(client, REST_ROUTE_INTERACTION_RESPONSE, REST_PRIORITY_INTERACTION, interaction_id);
+
+    op->interaction.token = strdup(interaction_token);
+    op->interaction.params.type = params->type;
+
+    if (params->data != NULL)
+    {
+        struct discord_interaction_callback_data *data = xcalloc(1, sizeof (*data));
+
+        *data = *params->data;
+        data->content = params->data->content == NULL ? NULL : strdup(params->data->content);
+        data->embeds = NULL;
+        data->allowed_mentions = rest_allowed_mention_copy(params->data->allowed_mentions);
+        data->components = rest_components_copy(params->data->components);
+        data->attachments = rest_attachments_copy(params->data->attachments);
+
+        if (params->data->embeds != NULL)
+        {
+            data->embeds = xcalloc(1, sizeof (*data->embeds));
+            rest_embeds_append(data->embeds, params->data->embeds);
+        }
+
+        op->interaction.params.data = data;
+    }
+
+    rest_scheduler_submit(rest_scheduler, op);
+}
@@ -0,0 +1,196 @@
+#ifndef SUDOBOT_REST_SCHEDULER_H
+#define SUDOBOT_REST_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define REST_GLOBAL_LIMIT 50
+#define REST_GLOBAL_WINDOW_MS 1000
+#define REST_BULK_DELETE_MAX 100
+#define REST_BULK_DELETE_MAX_AGE_MS (14ULL * 24 * 60 * 60 * 1000 - 60 * 1000)
+#define REST_MESSAGE_CONTENT_MAX 2000
+#define REST_MESSAGE_EMBEDS_MAX 10
+/* Characters across all embeds of a message. */
+#define REST_MESSAGE_EMBED_LENGTH_MAX 6000
+#define REST_MAX_RETRIES 3
+
+/* Lower values are dispatched first. */
+typedef enum rest_priority
+{
+    REST_PRIORITY_MODERATION,
+    REST_PRIORITY_INTERACTION,
+    REST_PRIORITY_LOG,
+    REST_PRIORITY_REPLY,
+    REST_PRIORITY_COUNT
+} rest_priority_t;
+
+typedef enum rest_route
+{
+    REST_ROUTE_DELETE_MESSAGE,
+    REST_ROUTE_BULK_DELETE_MESSAGES,
+    REST_ROUTE_CREATE_GUILD_BAN,
+    REST_ROUTE_CREATE_MESSAGE,
+    REST_ROUTE_INTERACTION_RESPONSE,
+    REST_ROUTE_COUNT
+} rest_route_t;
+
+typedef struct rest_op
+{
+    rest_route_t route;
+    rest_priority_t priority;
+    struct discord *client;
+    /* Major parameter of the route: channel, guild or interaction ID. */
+    u64snowflake major_id;
+    unsigned int retries;
+    /* Optional; called once the request has succeeded or finally failed. */
+    void (*done)(struct rest_op *op, CCORDcode code);
+    void *data;
+    /* Monotonic time of the latest hand-off to the transport. */
+    uint64_t dispatched_at_ns;
+    /* opened_at_ns of the bucket window the request was counted in. */
+    uint64_t window_opened_at_ns;
+    struct rest_op *prev;
+    struct rest_op *next;
+
+    union
+    {
+        struct
+        {
+            u64snowflake *message_ids;
+            size_t count;
+        } delete;
+
+        struct
+        {
+            u64snowflake user_id;
+            int delete_message_seconds;
+            char *reason;
+        } ban;
+
+        struct
+        {
+            struct discord_create_message params;
+            size_t content_length;
+            size_t embed_length;
+            bool mergeable;
+        } message;
+
+        struct
+        {
+            char *token;
+            struct discord_interaction_response params;
+        } interaction;
+    };
+} rest_op_t;
+
+/* Rate-limit headers of a response, as far as the transport knows them. */
+typedef struct rest_ratelimit
+{
+    /* X-RateLimit-Limit and X-RateLimit-Remaining; limit is 0 when not reported. */
+    unsigned int limit;
+    unsigned int remaining;
+    /* X-RateLimit-Reset-After, or Retry-After for a rate limited request. */
+    uint64_t reset_after_ms;
+    /* The request hit the global limit rather than its route's. */
+    bool global;
+} rest_ratelimit_t;
+
+/*
+ * A rate-limit window as Discord counts them: limit requests until
+ * reset_at_ns, after which the next request opens a fresh window.
+ */
+struct rest_window
+{
+    unsigned int limit;
+    unsigned int remaining;
+    /* Scheduler clock; both 0 while no window is open. */
+    uint64_t opened_at_ns;
+    uint64_t reset_at_ns;
+};
+
+struct rest_scheduler;
+struct snapshot_writer;
+struct snapshot_info;
+
+typedef struct rest_transport
+{
+    /* Sends the operation; must call rest_scheduler_complete() once done. */
+    void (*dispatch)(struct rest_scheduler *scheduler, rest_op_t *op);
+    /* Optional clock override, used by the mock harness. */
+    uint64_t (*now_ns)(void);
+} rest_transport_t;
+
+struct rest_table_entry
+{
+    u64snowflake id;
+    rest_route_t route;
+    void *value;
+};
+
+/* Open-addressing table keyed by (route, major ID). */
+struct rest_table
+{
+    struct rest_table_entry *entries;
+    size_t capacity;
+    size_t length;
+};
+
+typedef struct rest_stats
+{
+    uint64_t submitted[REST_ROUTE_COUNT];
+    uint64_t dispatched[REST_ROUTE_COUNT];
+    uint64_t coalesced;
+    uint64_t rate_limited;
+    uint64_t failed;
+} rest_stats_t;
+
+typedef struct rest_scheduler
+{
+    const rest_transport_t *transport;
+    /* Called after every submit so that an idle event loop comes around to dispatch it. */
+    void (*wake)(void *data);
+    void *wake_data;
+    pthread_mutex_t lock;
+    rest_op_t *head[REST_PRIORITY_COUNT];
+    rest_op_t *tail[REST_PRIORITY_COUNT];
+    size_t pending;
+    /* (route, major ID) -> struct rest_window */
+    struct rest_table buckets;
+    /* (route, major ID) -> pending rest_op_t that still accepts merges */
+    struct rest_table open_ops;
+    struct rest_window global;
+    rest_stats_t stats;
+} rest_scheduler_t;
+
+extern rest_scheduler_t *rest_scheduler;
+extern const rest_transport_t rest_concord_transport;
+
+rest_scheduler_t *rest_scheduler_init(const rest_transport_t *transport);
+void rest_scheduler_free(rest_scheduler_t *scheduler);
+void rest_scheduler_submit(rest_scheduler_t *scheduler, rest_op_t *op);
+size_t rest_scheduler_flush(rest_scheduler_t *scheduler);
+void rest_scheduler_complete(rest_scheduler_t *scheduler, rest_op_t *op, CCORDcode code,
+                             const rest_ratelimit_t *ratelimit);
+void rest_scheduler_get_stats(rest_scheduler_t *scheduler, rest_stats_t *stats);
+size_t rest_scheduler_pending(rest_scheduler_t *scheduler);
+uint64_t rest_scheduler_now(rest_scheduler_t *scheduler);
+void rest_on_cycle(struct discord *client);
+void rest_scheduler_snapshot_save(struct snapshot_writer *writer);
+bool rest_scheduler_snapshot_load(const void *data, size_t length, const struct snapshot_info *info);
+
+void rest_delete_message(struct discord *client, u64snowflake channel_id, u64snowflake message_id,
+                         rest_priority_t priority);
+void rest_ban_member(struct discord *client, u64snowflake guild_id, u64snowflake user_id,
+                     int delete_message_seconds, const char *reason);
+void rest_create_message(struct discord *client, u64snowflake channel_id,
+                         const struct discord_create_message *params, rest_priority_t priority);
+void rest_submit_message(struct discord *client, u64snowflake channel_id, struct discord_create_message *params,
+                         rest_priority_t priority, void (*done)(rest_op_t *op, CCORDcode code), void *data);
+void rest_create_interaction_response(struct discord *client, u64snowflake interaction_id,
+                                      const char *interaction_token,
+                                      const struct discord_interaction_response *params);
+
+#endif /* SUDOBOT_REST_SCHEDULER_H */
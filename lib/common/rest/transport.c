@@ -0,0 +1,173 @@
+#include <inttypes.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <concord/discord.h>
+#include <concord/discord-internal.h>
+#include "scheduler.h"
+
+static void rest_concord_bucket_key(char key[DISCORD_ROUTE_LEN], enum http_method method, const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    discord_ratelimiter_build_key(method, key, format, args);
+    va_end(args);
+}
+
+/*
+ * concord parses the X-RateLimit-* headers of every response into the
+ * bucket of its route before calling back, so they are read from there.
+ * Returns false while concord has not matched the route to a bucket yet.
+ */
+static bool rest_concord_ratelimit(struct discord *client, const rest_op_t *op, rest_ratelimit_t *ratelimit)
+{
+    struct discord_ratelimiter *ratelimiter = &client->rest.requestor.ratelimiter;
+    char key[DISCORD_ROUTE_LEN];
+
+    switch (op->route)
+    {
+        case REST_ROUTE_DELETE_MESSAGE:
+            if (op->delete.count == 1)
+                rest_concord_bucket_key(key, HTTP_DELETE, "/channels/%" PRIu64 "/messages/%" PRIu64, op->major_id,
+                                        op->delete.message_ids[0]);
+            else
+                rest_concord_bucket_key(key, HTTP_POST, "/channels/%" PRIu64 "/messages/bulk-delete", op->major_id);
+
+            break;
+
+        case REST_ROUTE_CREATE_GUILD_BAN:
+            rest_concord_bucket_key(key, HTTP_PUT, "/guilds/%" PRIu64 "/bans/%" PRIu64, op->major_id,
+                                    op->ban.user_id);
+            break;
+
+        case REST_ROUTE_CREATE_MESSAGE:
+            rest_concord_bucket_key(key, HTTP_POST, "/channels/%" PRIu64 "/messages", op->major_id);
+            break;
+
+        default:
+            return false;
+    }
+
+    struct discord_bucket *bucket = discord_bucket_get(ratelimiter, key);
+
+    if (bucket == NULL || bucket == ratelimiter->null || bucket == ratelimiter->miss || bucket->limit <= 0 ||
+        bucket->limit > UINT_MAX)
+        return false;
+
+    uint64_t now_ms = discord_timestamp(client);
+
+    ratelimit->limit = (unsigned int) bucket->limit;
+    ratelimit->remaining = bucket->remaining > 0 ? (unsigned int) bucket->remaining : 0;
+    ratelimit->reset_after_ms = bucket->reset_tstamp > now_ms ? bucket->reset_tstamp - now_ms : 0;
+    ratelimit->global = false;
+    return true;
+}
+
+static void rest_concord_complete(struct discord *client, rest_op_t *op, CCORDcode code)
+{
+    rest_ratelimit_t ratelimit;
+
+    rest_scheduler_complete(rest_scheduler, op, code,
+                            rest_concord_ratelimit(client, op, &ratelimit) ? &ratelimit : NULL);
+}
+
+static void rest_concord_done(struct discord *client, struct discord_response *resp)
+{
+    rest_concord_complete(client, resp->data, CCORD_OK);
+}
+
+static void rest_concord_done_message(struct discord *client, struct discord_response *resp,
+                                      const struct discord_message *message)
+{
+    (void) message;
+    rest_concord_done(client, resp);
+}
+
+static void rest_concord_done_interaction_response(struct discord *client, struct discord_response *resp,
+                                                   const struct discord_interaction_response *response)
+{
+    (void) response;
+    rest_concord_done(client, resp);
+}
+
+static void rest_concord_fail(struct discord *client, struct discord_response *resp)
+{
+    rest_concord_complete(client, resp->data, resp->code);
+}
+
+static void rest_concord_dispatch(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    CCORDcode code = CCORD_OK;
+
+    switch (op->route)
+    {
+        case REST_ROUTE_DELETE_MESSAGE:
+        {
+            struct discord_ret ret = { .done = &rest_concord_done, .fail = &rest_concord_fail, .data = op };
+
+            if (op->delete.count == 1)
+            {
+                code = discord_delete_message(op->client, op->major_id, op->delete.message_ids[0], NULL, &ret);
+                break;
+            }
+
+            struct snowflakes messages = {
+                .size = (int) op->delete.count,
+                .array = op->delete.message_ids,
+            };
+            struct discord_bulk_delete_messages params = { .messages = &messages };
+
+            code = discord_bulk_delete_messages(op->client, op->major_id, &params, &ret);
+            break;
+        }
+
+        case REST_ROUTE_CREATE_GUILD_BAN:
+        {
+            struct discord_ret ret = { .done = &rest_concord_done, .fail = &rest_concord_fail, .data = op };
+            struct discord_create_guild_ban params = {
+                .delete_message_seconds = op->ban.delete_message_seconds,
+                .reason = op->ban.reason,
+            };
+
+            code = discord_create_guild_ban(op->client, op->major_id, op->ban.user_id, &params, &ret);
+            break;
+        }
+
+        case REST_ROUTE_CREATE_MESSAGE:
+        {
+            struct discord_ret_message ret = {
+                .done = &rest_concord_done_message,
+                .fail = &rest_concord_fail,
+                .data = op,
+            };
+
+            code = discord_create_message(op->client, op->major_id, &op->message.params, &ret);
+            break;
+        }
+
+        case REST_ROUTE_INTERACTION_RESPONSE:
+        {
+            struct discord_ret_interaction_response ret = {
+                .done = &rest_concord_done_interaction_response,
+                .fail = &rest_concord_fail,
+                .data = op,
+            };
+
+            code = discord_create_interaction_response(op->client, op->major_id, op->interaction.token,
+                                                       &op->interaction.params, &ret);
+            break;
+        }
+
+        default:
+            code = CCORD_RESOURCE_UNAVAILABLE;
+            break;
+    }
+
+    if (code != CCORD_OK)
+        rest_scheduler_complete(scheduler, op, code, NULL);
+}
+
+const rest_transport_t rest_concord_transport = {
+    .dispatch = &rest_concord_dispatch,
+    .now_ns = NULL,
+};
@@ -0,0 +1,328 @@
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <concord/discord.h>
+#include <concord/discord-internal.h>
+#include "runtime.h"
+#include "sudobot.h"
+#include "io/log.h"
+#include "events/on_cycle.h"
+#include "rest/scheduler.h"
+#include "utils/utils.h"
+#include "utils/xmalloc.h"
+
+static bool runtime_active = false;
+
+static bool sudobot_runtime_watch(int epoll_fd, int fd)
+{
+    struct epoll_event event = { .events = EPOLLIN, .data.fd = fd };
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+sudobot_runtime_t *sudobot_runtime_create()
+{
+    sudobot_runtime_t *runtime = xcalloc(1, sizeof (*runtime));
+
+    runtime->state = SUDOBOT_RUNTIME_STOPPED;
+    runtime->poll_timeout_ms = -1;
+    pthread_mutex_init(&runtime->poll_lock, NULL);
+    pthread_cond_init(&runtime->poll_cond, NULL);
+    runtime->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    runtime->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (runtime->epoll_fd < 0 || runtime->wake_fd < 0 || !sudobot_runtime_watch(runtime->epoll_fd, runtime->wake_fd))
+    {
+        log_error("runtime: failed to create event loop descriptors: %s", get_last_error());
+        sudobot_runtime_free(runtime);
+        return NULL;
+    }
+
+    return runtime;
+}
+
+static void sudobot_runtime_wake(sudobot_runtime_t *runtime)
+{
+    uint64_t one = 1;
+    ssize_t ret = write(runtime->wake_fd, &one, sizeof one);
+    (void) ret;
+}
+
+static void sudobot_runtime_rest_wake(void *data)
+{
+    sudobot_runtime_wake(data);
+}
+
+static void sudobot_runtime_drain(sudobot_runtime_t *runtime)
+{
+    uint64_t value;
+    ssize_t ret = read(runtime->wake_fd, &value, sizeof value);
+    (void) ret;
+}
+
+/*
+ * Waits in concord's poller for as long as the last poll allowed, then
+ * makes the runtime fd readable. The thread touches the poller only
+ * between two polls of the host; sudobot_runtime_poll() parks it first.
+ */
+static void *sudobot_runtime_poll_thread(void *data)
+{
+    sudobot_runtime_t *runtime = data;
+
+    pthread_mutex_lock(&runtime->poll_lock);
+
+    for (;;)
+    {
+        while (!runtime->poll_thread_exit && runtime->poll_timeout_ms < 0)
+            pthread_cond_wait(&runtime->poll_cond, &runtime->poll_lock);
+
+        if (runtime->poll_thread_exit)
+            break;
+
+        int timeout_ms = runtime->poll_timeout_ms;
+
+        runtime->poll_timeout_ms = -1;
+        runtime->polling = true;
+        pthread_mutex_unlock(&runtime->poll_lock);
+
+        io_poller_poll(runtime->client->io_poller, timeout_ms);
+        sudobot_runtime_wake(runtime);
+
+        pthread_mutex_lock(&runtime->poll_lock);
+        runtime->polling = false;
+        pthread_cond_broadcast(&runtime->poll_cond);
+    }
+
+    pthread_mutex_unlock(&runtime->poll_lock);
+    return NULL;
+}
+
+/* Takes the poller back from the poll thread, interrupting its wait. */
+static void sudobot_runtime_park(sudobot_runtime_t *runtime)
+{
+    pthread_mutex_lock(&runtime->poll_lock);
+    runtime->poll_timeout_ms = -1;
+
+    while (runtime->polling)
+    {
+        io_poller_wakeup(runtime->client->io_poller);
+        pthread_cond_wait(&runtime->poll_cond, &runtime->poll_lock);
+    }
+
+    pthread_mutex_unlock(&runtime->poll_lock);
+}
+
+static void sudobot_runtime_arm(sudobot_runtime_t *runtime, int timeout_ms)
+{
+    pthread_mutex_lock(&runtime->poll_lock);
+    runtime->poll_timeout_ms = timeout_ms;
+    pthread_cond_signal(&runtime->poll_cond);
+    pthread_mutex_unlock(&runtime->poll_lock);
+}
+
+/*
+ * The next wait ends at concord's next timer deadline, or earlier when
+ * the REST scheduler holds requests back for a rate-limit window.
+ */
+static int sudobot_runtime_next_timeout(sudobot_runtime_t *runtime)
+{
+    struct discord *client = runtime->client;
+
+    if (!runtime->gateway_started)
+        return SUDOBOT_RUNTIME_RECONNECT_DELAY_MS;
+
+    struct discord_timers *const timers[] = { &client->timers.internal, &client->timers.user };
+    int64_t max_ms = rest_scheduler != NULL && rest_scheduler_pending(rest_scheduler) > 0
+                         ? SUDOBOT_RUNTIME_BUSY_TIMEOUT_MS
+                         : SUDOBOT_RUNTIME_IDLE_TIMEOUT_MS;
+    int64_t next_us = discord_timers_get_next_trigger(timers, sizeof timers / sizeof *timers,
+                                                      (int64_t) discord_timestamp_us(client), max_ms * 1000);
+
+    return next_us > 0 ? (int) ((next_us + 999) / 1000) : 0;
+}
+
+bool sudobot_runtime_start(sudobot_runtime_t *runtime, const char *token)
+{
+    if (runtime->state != SUDOBOT_RUNTIME_STOPPED || runtime_active)
+    {
+        log_error("runtime: already running");
+        return false;
+    }
+
+    runtime->client = sudobot_prepare(token);
+
+    if (runtime->client == NULL)
+        return false;
+
+    runtime_active = true;
+    runtime->state = SUDOBOT_RUNTIME_RUNNING;
+    runtime->gateway_started = false;
+    runtime->stop_requested = false;
+    runtime->poll_timeout_ms = -1;
+    runtime->polling = false;
+    runtime->poll_thread_exit = false;
+
+    if (pthread_create(&runtime->poll_thread, NULL, &sudobot_runtime_poll_thread, runtime) != 0)
+    {
+        log_error("runtime: failed to start the poll thread");
+        sudobot_shutdown();
+        runtime->client = NULL;
+        runtime->state = SUDOBOT_RUNTIME_STOPPED;
+        runtime_active = false;
+        return false;
+    }
+
+    runtime->poll_thread_started = true;
+
+    if (rest_scheduler != NULL)
+    {
+        rest_scheduler->wake_data = runtime;
+        rest_scheduler->wake = &sudobot_runtime_rest_wake;
+    }
+
+    log_info("Attempting to boot (embedded runtime)...");
+    sudobot_runtime_wake(runtime);
+    return true;
+}
+
+int sudobot_runtime_fd(const sudobot_runtime_t *runtime)
+{
+    return runtime->epoll_fd;
+}
+
+static void sudobot_runtime_finish(sudobot_runtime_t *runtime)
+{
+    if (runtime->poll_thread_started)
+    {
+        pthread_mutex_lock(&runtime->poll_lock);
+        runtime->poll_thread_exit = true;
+
+        if (runtime->polling)
+            io_poller_wakeup(runtime->client->io_poller);
+
+        pthread_cond_signal(&runtime->poll_cond);
+        pthread_mutex_unlock(&runtime->poll_lock);
+        pthread_join(runtime->poll_thread, NULL);
+        runtime->poll_thread_started = false;
+    }
+
+    if (rest_scheduler != NULL)
+    {
+        rest_scheduler->wake = NULL;
+        rest_scheduler->wake_data = NULL;
+    }
+
+    sudobot_shutdown();
+    runtime->client = NULL;
+    runtime->gateway_started = false;
+    runtime->state = SUDOBOT_RUNTIME_STOPPED;
+    runtime_active = false;
+    log_info("runtime: stopped");
+}
+
+/*
+ * Runs one iteration of what discord_run() does in a loop, without
+ * blocking, then lets the poll thread wait for the next socket event or
+ * timer deadline.
+ */
+sudobot_runtime_state_t sudobot_runtime_poll(sudobot_runtime_t *runtime)
+{
+    if (runtime->state == SUDOBOT_RUNTIME_STOPPED || runtime->in_poll)
+        return runtime->state;
+
+    struct discord *client = runtime->client;
+    CCORDcode code = CCORD_OK;
+
+    runtime->in_poll = true;
+    sudobot_runtime_park(runtime);
+    sudobot_runtime_drain(runtime);
+
+    if (runtime->stop_requested && runtime->state == SUDOBOT_RUNTIME_RUNNING)
+    {
+        runtime->state = SUDOBOT_RUNTIME_STOPPING;
+
+        if (runtime->gateway_started)
+            discord_shutdown(client);
+    }
+
+    if (!runtime->gateway_started && runtime->state == SUDOBOT_RUNTIME_RUNNING)
+    {
+        code = discord_gateway_start(&client->gw);
+        runtime->gateway_started = code == CCORD_OK;
+    }
+
+    if (runtime->gateway_started)
+    {
+        io_poller_poll(client->io_poller, 0);
+        code = io_poller_perform(client->io_poller);
+
+        discord_requestor_dispatch_responses(&client->rest.requestor);
+        discord_timers_run(client, &client->timers.internal);
+        discord_timers_run(client, &client->timers.user);
+        on_cycle(client);
+
+        if (code == CCORD_OK)
+            code = discord_gateway_perform(&client->gw);
+    }
+
+    if (code != CCORD_OK || runtime->state == SUDOBOT_RUNTIME_STOPPING)
+    {
+        /* Mirrors discord_run(): reconnect unless the gateway is done for good. */
+        if (runtime->gateway_started && code != CCORD_OK)
+        {
+            runtime->gateway_started = false;
+
+            if (discord_gateway_end(&client->gw))
+            {
+                discord_gateway_reset(&client->gw);
+                runtime->state = SUDOBOT_RUNTIME_STOPPING;
+            }
+        }
+
+        if (runtime->state == SUDOBOT_RUNTIME_STOPPING && !runtime->gateway_started)
+        {
+            runtime->in_poll = false;
+            sudobot_runtime_finish(runtime);
+            return runtime->state;
+        }
+    }
+
+    sudobot_runtime_arm(runtime, sudobot_runtime_next_timeout(runtime));
+    runtime->in_poll = false;
+    return runtime->state;
+}
+
+/**
+ * @brief Requests a graceful stop. Safe to call repeatedly and from inside
+ * event callbacks; the host keeps polling until the state is STOPPED.
+ */
+void sudobot_runtime_stop(sudobot_runtime_t *runtime)
+{
+    if (runtime->state != SUDOBOT_RUNTIME_RUNNING)
+        return;
+
+    runtime->stop_requested = true;
+    sudobot_runtime_wake(runtime);
+}
+
+void sudobot_runtime_free(sudobot_runtime_t *runtime)
+{
+    if (runtime == NULL)
+        return;
+
+    if (runtime->state != SUDOBOT_RUNTIME_STOPPED)
+        sudobot_runtime_finish(runtime);
+
+    if (runtime->epoll_fd >= 0)
+        close(runtime->epoll_fd);
+
+    if (runtime->wake_fd >= 0)
+        close(runtime->wake_fd);
+
+    pthread_cond_destroy(&runtime->poll_cond);
+    pthread_mutex_destroy(&runtime->poll_lock);
+    free(runtime);
+}
@@ -0,0 +1,64 @@
+#ifndef SUDOBOT_RUNTIME_H
+#define SUDOBOT_RUNTIME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+/* Upper bound on how long the runtime fd stays quiet with no socket activity and no concord timer due. */
+#define SUDOBOT_RUNTIME_IDLE_TIMEOUT_MS 250
+/* Same, while requests wait in the REST scheduler for their rate-limit window. */
+#define SUDOBOT_RUNTIME_BUSY_TIMEOUT_MS 10
+#define SUDOBOT_RUNTIME_RECONNECT_DELAY_MS 1000
+
+typedef enum sudobot_runtime_state
+{
+    SUDOBOT_RUNTIME_STOPPED,
+    SUDOBOT_RUNTIME_RUNNING,
+    SUDOBOT_RUNTIME_STOPPING,
+} sudobot_runtime_state_t;
+
+/*
+ * Embeddable, non-blocking runtime. Instead of blocking in discord_run(),
+ * the host watches sudobot_runtime_fd() in its own event loop (epoll,
+ * libuv, ...) and calls sudobot_runtime_poll() whenever it is readable.
+ * Only one runtime can be active at a time.
+ *
+ * concord keeps the sockets it polls to itself, so between two polls of
+ * the host a thread waits in concord's own io_poller_poll(), bounded by
+ * the next concord timer, and makes the fd readable once it returns.
+ * This is the one thread the runtime adds to the host. It never runs
+ * handlers or touches the client outside io_poller_poll(), and it is
+ * parked whenever sudobot_runtime_poll() runs, so all bot work still
+ * happens on the host's thread.
+ */
+typedef struct sudobot_runtime
+{
+    struct discord *client;
+    sudobot_runtime_state_t state;
+    /* epoll instance watching wake_fd; this is what hosts poll. */
+    int epoll_fd;
+    int wake_fd;
+    bool gateway_started;
+    bool in_poll;
+    bool stop_requested;
+    pthread_t poll_thread;
+    bool poll_thread_started;
+    pthread_mutex_t poll_lock;
+    pthread_cond_t poll_cond;
+    /* How long the poll thread may wait next, or -1 while it is parked. */
+    int poll_timeout_ms;
+    /* The poll thread is inside io_poller_poll(). */
+    bool polling;
+    bool poll_thread_exit;
+} sudobot_runtime_t;
+
+sudobot_runtime_t *sudobot_runtime_create();
+bool sudobot_runtime_start(sudobot_runtime_t *runtime, const char *token);
+int sudobot_runtime_fd(const sudobot_runtime_t *runtime);
+sudobot_runtime_state_t sudobot_runtime_poll(sudobot_runtime_t *runtime);
+void sudobot_runtime_stop(sudobot_runtime_t *runtime);
+void sudobot_runtime_free(sudobot_runtime_t *runtime);
+
+#endif /* SUDOBOT_RUNTIME_H */
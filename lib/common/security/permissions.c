@@ -0,0 +1,947 @@
+#include <string.h>
+#include <concord/discord.h>
+#include "permissions.h"
+#include "../io/log.h"
+#include "../store/snapshot.h"
+#include "../utils/xmalloc.h"
+
+#define PERMISSIONS_MAP_MIN_CAPACITY 16
+#define PERMISSIONS_OVERWRITE_ROLE 0
+#define PERMISSIONS_OVERWRITE_MEMBER 1
+
+permissions_t *permissions = NULL;
+
+static uint64_t permissions_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static uint64_t *permissions_map_find(struct permissions_map *map, uint64_t key)
+{
+    if (map->capacity == 0)
+        return NULL;
+
+    for (size_t i = permissions_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+            return &map->values[i];
+
+        if (map->keys[i] == 0)
+            return NULL;
+    }
+}
+
+static void permissions_map_put(struct permissions_map *map, uint64_t key, uint64_t value);
+
+static void permissions_map_grow(struct permissions_map *map)
+{
+    struct permissions_map old = *map;
+
+    map->capacity = old.capacity == 0 ? PERMISSIONS_MAP_MIN_CAPACITY : old.capacity * 2;
+    map->keys = xcalloc(map->capacity, sizeof (*map->keys));
+    map->values = xcalloc(map->capacity, sizeof (*map->values));
+    map->length = 0;
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        if (old.keys[i] != 0)
+            permissions_map_put(map, old.keys[i], old.values[i]);
+    }
+
+    free(old.keys);
+    free(old.values);
+}
+
+static void permissions_map_put(struct permissions_map *map, uint64_t key, uint64_t value)
+{
+    if ((map->length + 1) * 4 > map->capacity * 3)
+        permissions_map_grow(map);
+
+    for (size_t i = permissions_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+        {
+            map->values[i] = value;
+            return;
+        }
+
+        if (map->keys[i] == 0)
+        {
+            map->keys[i] = key;
+            map->values[i] = value;
+            map->length++;
+            return;
+        }
+    }
+}
+
+/* Backward-shift deletion keeps probe chains intact without tombstones. */
+static void permissions_map_remove(struct permissions_map *map, uint64_t key)
+{
+    uint64_t *value = permissions_map_find(map, key);
+
+    if (value == NULL)
+        return;
+
+    size_t mask = map->capacity - 1;
+    size_t hole = (size_t) (value - map->values);
+
+    for (size_t i = (hole + 1) & mask; map->keys[i] != 0; i = (i + 1) & mask)
+    {
+        size_t home = permissions_hash(map->keys[i]) & mask;
+
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            map->keys[hole] = map->keys[i];
+            map->values[hole] = map->values[i];
+            hole = i;
+        }
+    }
+
+    map->keys[hole] = 0;
+    map->values[hole] = 0;
+    map->length--;
+}
+
+static void permissions_map_free(struct permissions_map *map)
+{
+    free(map->keys);
+    free(map->values);
+}
+
+permissions_t *permissions_init(size_t memo_slots)
+{
+    permissions_t *engine = xcalloc(1, sizeof (*engine));
+    size_t slots = 1;
+
+    while (slots < memo_slots)
+        slots <<= 1;
+
+    engine->memo_slots = slots;
+    engine->memo = xcalloc(slots, sizeof (*engine->memo));
+    pthread_mutex_init(&engine->lock, NULL);
+    return engine;
+}
+
+static void permissions_channel_free(permissions_channel_t *channel)
+{
+    free(channel->role_ids);
+    free(channel->role_slots);
+    free(channel->role_allow);
+    free(channel->role_deny);
+    free(channel->members);
+    free(channel);
+}
+
+static void permissions_guild_free(permissions_guild_t *guild)
+{
+    permissions_map_free(&guild->role_index);
+    permissions_map_free(&guild->member_index);
+    free(guild->member_ids);
+    free(guild->member_roles);
+    free(guild->member_changed_at);
+    free(guild->member_base);
+    free(guild->member_base_at);
+    free(guild);
+}
+
+void permissions_free(permissions_t *engine)
+{
+    for (size_t i = 0; i < engine->guilds.capacity; i++)
+    {
+        if (engine->guilds.keys[i] != 0)
+            permissions_guild_free((permissions_guild_t *) (uintptr_t) engine->guilds.values[i]);
+    }
+
+    for (size_t i = 0; i < engine->channels.capacity; i++)
+    {
+        if (engine->channels.keys[i] != 0)
+            permissions_channel_free((permissions_channel_t *) (uintptr_t) engine->channels.values[i]);
+    }
+
+    permissions_map_free(&engine->guilds);
+    permissions_map_free(&engine->channels);
+    pthread_mutex_destroy(&engine->lock);
+    free(engine->memo);
+    free(engine);
+}
+
+/*
+ * Only GUILD_CREATE and the snapshot create guilds. A guild made up from a
+ * role, channel or member update would lack its owner and other roles, and
+ * answer checks as if it were known.
+ */
+static permissions_guild_t *permissions_guild_get(permissions_t *engine, uint64_t guild_id, bool create)
+{
+    uint64_t *value = permissions_map_find(&engine->guilds, guild_id);
+
+    if (value != NULL)
+        return (permissions_guild_t *) (uintptr_t) *value;
+
+    if (!create || guild_id == 0)
+        return NULL;
+
+    permissions_guild_t *guild = xcalloc(1, sizeof (*guild));
+
+    guild->id = guild_id;
+    guild->role_count = 1;
+    guild->role_ids[0] = guild_id;
+    guild->roles_changed_at = ++engine->generation;
+    permissions_map_put(&guild->role_index, guild_id, 0);
+    permissions_map_put(&engine->guilds, guild_id, (uint64_t) (uintptr_t) guild);
+    return guild;
+}
+
+/* Role IDs seen before their role (e.g. on a member) get a slot with no permissions until it arrives. */
+static uint16_t permissions_role_slot(permissions_guild_t *guild, uint64_t role_id, bool create)
+{
+    uint64_t *value = permissions_map_find(&guild->role_index, role_id);
+
+    if (value != NULL)
+        return (uint16_t) *value;
+
+    if (!create || role_id == 0)
+        return PERMISSIONS_NO_SLOT;
+
+    size_t slot = 1;
+
+    while (slot < guild->role_count && guild->role_ids[slot] != 0)
+        slot++;
+
+    if (slot == PERMISSIONS_MAX_ROLES)
+    {
+        if (!guild->overflowed)
+            log_warn("permissions: guild %lu has more than %d roles; its checks are disabled", guild->id,
+                     PERMISSIONS_MAX_ROLES);
+
+        guild->overflowed = true;
+        return PERMISSIONS_NO_SLOT;
+    }
+
+    if (slot == guild->role_count)
+        guild->role_count++;
+
+    guild->role_ids[slot] = role_id;
+    guild->role_permissions[slot] = 0;
+    permissions_map_put(&guild->role_index, role_id, slot);
+    return (uint16_t) slot;
+}
+
+static void permissions_role_set(permissions_t *engine, permissions_guild_t *guild, uint64_t role_id,
+                                 uint64_t role_permissions)
+{
+    uint16_t slot = permissions_role_slot(guild, role_id, true);
+
+    if (slot == PERMISSIONS_NO_SLOT || guild->role_permissions[slot] == role_permissions)
+        return;
+
+    guild->role_permissions[slot] = role_permissions;
+    guild->roles_changed_at = ++engine->generation;
+}
+
+static void permissions_role_remove(permissions_t *engine, permissions_guild_t *guild, uint16_t slot)
+{
+    uint64_t word = slot / 64, bit = 1ULL << (slot % 64);
+
+    permissions_map_remove(&guild->role_index, guild->role_ids[slot]);
+    guild->role_ids[slot] = 0;
+    guild->role_permissions[slot] = 0;
+
+    /* The slot may be reused by another role, so no member may keep it. */
+    for (size_t i = 0; i < guild->member_count; i++)
+        guild->member_roles[i].words[word] &= ~bit;
+
+    guild->roles_changed_at = ++engine->generation;
+}
+
+/* Roles missing from a full role list (GUILD_CREATE, GUILD_UPDATE) were deleted while we were not listening. */
+static void permissions_roles_replace(permissions_t *engine, permissions_guild_t *guild,
+                                      const struct discord_roles *roles)
+{
+    permissions_roleset_t seen = { 0 };
+
+    seen.words[0] = 1;
+
+    for (int i = 0; roles != NULL && i < roles->size; i++)
+    {
+        permissions_role_set(engine, guild, roles->array[i].id, roles->array[i].permissions);
+
+        uint16_t slot = permissions_role_slot(guild, roles->array[i].id, false);
+
+        if (slot != PERMISSIONS_NO_SLOT)
+            seen.words[slot / 64] |= 1ULL << (slot % 64);
+    }
+
+    for (size_t slot = 1; slot < guild->role_count; slot++)
+    {
+        if (guild->role_ids[slot] != 0 && !(seen.words[slot / 64] & (1ULL << (slot % 64))))
+            permissions_role_remove(engine, guild, (uint16_t) slot);
+    }
+}
+
+static size_t permissions_member_index(permissions_guild_t *guild, uint64_t user_id)
+{
+    uint64_t *value = permissions_map_find(&guild->member_index, user_id);
+    return value == NULL ? SIZE_MAX : (size_t) *value;
+}
+
+static void permissions_member_set(permissions_t *engine, permissions_guild_t *guild, uint64_t user_id,
+                                   const uint64_t *role_ids, size_t role_count)
+{
+    permissions_roleset_t roles = { 0 };
+
+    for (size_t i = 0; i < role_count; i++)
+    {
+        uint16_t slot = permissions_role_slot(guild, role_ids[i], true);
+
+        if (slot != PERMISSIONS_NO_SLOT)
+            roles.words[slot / 64] |= 1ULL << (slot % 64);
+    }
+
+    size_t index = permissions_member_index(guild, user_id);
+
+    if (index != SIZE_MAX)
+    {
+        if (memcmp(&guild->member_roles[index], &roles, sizeof roles) == 0)
+            return;
+    }
+    else
+    {
+        if (guild->member_count == guild->member_capacity)
+        {
+            size_t capacity = guild->member_capacity == 0 ? 16 : guild->member_capacity * 2;
+
+            guild->member_ids = xrealloc(guild->member_ids, capacity * sizeof (*guild->member_ids));
+            guild->member_roles = xrealloc(guild->member_roles, capacity * sizeof (*guild->member_roles));
+            guild->member_changed_at =
+                xrealloc(guild->member_changed_at, capacity * sizeof (*guild->member_changed_at));
+            guild->member_base = xrealloc(guild->member_base, capacity * sizeof (*guild->member_base));
+            guild->member_base_at = xrealloc(guild->member_base_at, capacity * sizeof (*guild->member_base_at));
+            guild->member_capacity = capacity;
+        }
+
+        index = guild->member_count++;
+        guild->member_ids[index] = user_id;
+        guild->member_base_at[index] = 0;
+        permissions_map_put(&guild->member_index, user_id, index);
+    }
+
+    guild->member_roles[index] = roles;
+    guild->member_changed_at[index] = ++engine->generation;
+}
+
+static void permissions_member_remove(permissions_guild_t *guild, uint64_t user_id)
+{
+    size_t index = permissions_member_index(guild, user_id);
+
+    if (index == SIZE_MAX)
+        return;
+
+    size_t last = --guild->member_count;
+
+    permissions_map_remove(&guild->member_index, user_id);
+
+    if (index != last)
+    {
+        guild->member_ids[index] = guild->member_ids[last];
+        guild->member_roles[index] = guild->member_roles[last];
+        guild->member_changed_at[index] = guild->member_changed_at[last];
+        guild->member_base[index] = guild->member_base[last];
+        guild->member_base_at[index] = guild->member_base_at[last];
+        permissions_map_put(&guild->member_index, guild->member_ids[index], index);
+    }
+}
+
+static bool permissions_channel_equal(const permissions_channel_t *a, const permissions_channel_t *b)
+{
+    return a->everyone_allow == b->everyone_allow && a->everyone_deny == b->everyone_deny &&
+           a->role_count == b->role_count && a->member_count == b->member_count &&
+           memcmp(a->role_ids, b->role_ids, a->role_count * sizeof (*a->role_ids)) == 0 &&
+           memcmp(a->role_allow, b->role_allow, a->role_count * sizeof (*a->role_allow)) == 0 &&
+           memcmp(a->role_deny, b->role_deny, a->role_count * sizeof (*a->role_deny)) == 0 &&
+           memcmp(a->members, b->members, a->member_count * sizeof (*a->members)) == 0;
+}
+
+/* CHANNEL_UPDATE also fires for renames and topic changes; those keep memoized results. */
+static void permissions_channel_set(permissions_t *engine, permissions_guild_t *guild, uint64_t channel_id,
+                                    const struct discord_overwrites *overwrites)
+{
+    permissions_channel_t *channel = xcalloc(1, sizeof (*channel));
+    size_t count = overwrites == NULL ? 0 : (size_t) overwrites->size;
+
+    channel->id = channel_id;
+    channel->guild_id = guild->id;
+    channel->role_ids = xmalloc((count + 1) * sizeof (*channel->role_ids));
+    channel->role_slots = xmalloc((count + 1) * sizeof (*channel->role_slots));
+    channel->role_allow = xmalloc((count + 1) * sizeof (*channel->role_allow));
+    channel->role_deny = xmalloc((count + 1) * sizeof (*channel->role_deny));
+    channel->members = xmalloc((count + 1) * sizeof (*channel->members));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const struct discord_overwrite *overwrite = &overwrites->array[i];
+
+        if (overwrite->type == PERMISSIONS_OVERWRITE_MEMBER)
+        {
+            channel->members[channel->member_count++] = (struct permissions_overwrite) {
+                .id = overwrite->id,
+                .allow = overwrite->allow,
+                .deny = overwrite->deny,
+            };
+        }
+        else if (overwrite->id == guild->id)
+        {
+            channel->everyone_allow = overwrite->allow;
+            channel->everyone_deny = overwrite->deny;
+        }
+        else
+        {
+            channel->role_ids[channel->role_count] = overwrite->id;
+            channel->role_slots[channel->role_count] = permissions_role_slot(guild, overwrite->id, false);
+            channel->role_allow[channel->role_count] = overwrite->allow;
+            channel->role_deny[channel->role_count] = overwrite->deny;
+            channel->role_count++;
+        }
+    }
+
+    uint64_t *value = permissions_map_find(&engine->channels, channel_id);
+    permissions_channel_t *old = value == NULL ? NULL : (permissions_channel_t *) (uintptr_t) *value;
+
+    if (old != NULL && old->guild_id == guild->id && permissions_channel_equal(old, channel))
+    {
+        permissions_channel_free(channel);
+        return;
+    }
+
+    if (old != NULL)
+        permissions_channel_free(old);
+
+    channel->changed_at = ++engine->generation;
+    permissions_map_put(&engine->channels, channel_id, (uint64_t) (uintptr_t) channel);
+}
+
+static void permissions_guild_apply(permissions_t *engine, const struct discord_guild *payload, bool full)
+{
+    permissions_guild_t *guild = permissions_guild_get(engine, payload->id, true);
+
+    if (guild == NULL)
+        return;
+
+    if (guild->owner_id != payload->owner_id)
+    {
+        guild->owner_id = payload->owner_id;
+        guild->roles_changed_at = ++engine->generation;
+    }
+
+    if (payload->roles != NULL)
+        permissions_roles_replace(engine, guild, payload->roles);
+
+    if (!full)
+        return;
+
+    for (int i = 0; payload->channels != NULL && i < payload->channels->size; i++)
+        permissions_channel_set(engine, guild, payload->channels->array[i].id,
+                                payload->channels->array[i].permission_overwrites);
+
+    for (int i = 0; payload->members != NULL && i < payload->members->size; i++)
+    {
+        const struct discord_guild_member *member = &payload->members->array[i];
+
+        if (member->user != NULL)
+            permissions_member_set(engine, guild, member->user->id,
+                                   member->roles == NULL ? NULL : member->roles->array,
+                                   member->roles == NULL ? 0 : (size_t) member->roles->size);
+    }
+}
+
+void permissions_on_guild_create(permissions_t *engine, const struct discord_guild *guild)
+{
+    pthread_mutex_lock(&engine->lock);
+    permissions_guild_apply(engine, guild, true);
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_guild_update(permissions_t *engine, const struct discord_guild *guild)
+{
+    pthread_mutex_lock(&engine->lock);
+    permissions_guild_apply(engine, guild, false);
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_role_update(permissions_t *engine, uint64_t guild_id, const struct discord_role *role)
+{
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, guild_id, false);
+
+    if (guild != NULL && role != NULL)
+        permissions_role_set(engine, guild, role->id, role->permissions);
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_role_delete(permissions_t *engine, uint64_t guild_id, uint64_t role_id)
+{
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, guild_id, false);
+    uint16_t slot = guild == NULL ? PERMISSIONS_NO_SLOT : permissions_role_slot(guild, role_id, false);
+
+    if (slot != PERMISSIONS_NO_SLOT && slot != 0)
+        permissions_role_remove(engine, guild, slot);
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_channel_update(permissions_t *engine, const struct discord_channel *channel)
+{
+    if (channel->guild_id == 0)
+        return;
+
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, channel->guild_id, false);
+
+    if (guild != NULL)
+        permissions_channel_set(engine, guild, channel->id, channel->permission_overwrites);
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_channel_delete(permissions_t *engine, uint64_t channel_id)
+{
+    pthread_mutex_lock(&engine->lock);
+
+    uint64_t *value = permissions_map_find(&engine->channels, channel_id);
+
+    if (value != NULL)
+    {
+        permissions_channel_free((permissions_channel_t *) (uintptr_t) *value);
+        permissions_map_remove(&engine->channels, channel_id);
+    }
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+/* Also fed from MESSAGE_CREATE, which carries the author's roles; unchanged roles cost a lookup and a compare. */
+void permissions_on_member_update(permissions_t *engine, uint64_t guild_id, uint64_t user_id,
+                                  const struct snowflakes *roles)
+{
+    if (guild_id == 0 || user_id == 0)
+        return;
+
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, guild_id, false);
+
+    if (guild != NULL)
+        permissions_member_set(engine, guild, user_id, roles == NULL ? NULL : roles->array,
+                               roles == NULL ? 0 : (size_t) roles->size);
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+void permissions_on_member_remove(permissions_t *engine, uint64_t guild_id, uint64_t user_id)
+{
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, guild_id, false);
+
+    if (guild != NULL)
+        permissions_member_remove(guild, user_id);
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+static uint64_t permissions_max(uint64_t a, uint64_t b)
+{
+    return a > b ? a : b;
+}
+
+/* Guild-level permissions: @everyone OR every role of the member, unless owner or administrator. */
+static uint64_t permissions_base(permissions_t *engine, permissions_guild_t *guild, size_t index)
+{
+    if (guild->member_base_at[index] >= permissions_max(guild->roles_changed_at, guild->member_changed_at[index]))
+        return guild->member_base[index];
+
+    uint64_t base = guild->role_permissions[0];
+
+    if (guild->member_ids[index] == guild->owner_id)
+    {
+        base = PERMISSIONS_ALL;
+    }
+    else
+    {
+        for (size_t word = 0; word < PERMISSIONS_ROLE_WORDS; word++)
+        {
+            for (uint64_t bits = guild->member_roles[index].words[word]; bits != 0; bits &= bits - 1)
+                base |= guild->role_permissions[word * 64 + (size_t) __builtin_ctzll(bits)];
+        }
+
+        if (base & PERMISSIONS_ADMINISTRATOR)
+            base = PERMISSIONS_ALL;
+    }
+
+    guild->member_base[index] = base;
+    guild->member_base_at[index] = engine->generation;
+    return base;
+}
+
+static uint64_t permissions_apply_overwrites(permissions_guild_t *guild, permissions_channel_t *channel,
+                                             size_t index, uint64_t base)
+{
+    const permissions_roleset_t *roles = &guild->member_roles[index];
+    uint64_t result = (base & ~channel->everyone_deny) | channel->everyone_allow;
+    uint64_t allow = 0, deny = 0;
+
+    for (size_t i = 0; i < channel->role_count; i++)
+    {
+        uint16_t slot = channel->role_slots[i];
+
+        if (slot == PERMISSIONS_NO_SLOT || guild->role_ids[slot] != channel->role_ids[i])
+            slot = channel->role_slots[i] = permissions_role_slot(guild, channel->role_ids[i], false);
+
+        if (slot != PERMISSIONS_NO_SLOT && (roles->words[slot / 64] & (1ULL << (slot % 64))))
+        {
+            allow |= channel->role_allow[i];
+            deny |= channel->role_deny[i];
+        }
+    }
+
+    result = (result & ~deny) | allow;
+
+    for (size_t i = 0; i < channel->member_count; i++)
+    {
+        if (channel->members[i].id == guild->member_ids[index])
+        {
+            result = (result & ~channel->members[i].deny) | channel->members[i].allow;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Effective permissions of a member, guild-wide when channel_id is
+ * 0. Returns false when the guild, member or channel has not been seen,
+ * in which case the caller has to fall back to another source.
+ */
+bool permissions_compute(permissions_t *engine, uint64_t guild_id, uint64_t user_id, uint64_t channel_id,
+                         uint64_t *result)
+{
+    pthread_mutex_lock(&engine->lock);
+
+    permissions_guild_t *guild = permissions_guild_get(engine, guild_id, false);
+    size_t index = guild == NULL || guild->overflowed ? SIZE_MAX : permissions_member_index(guild, user_id);
+    uint64_t *value = channel_id == 0 ? NULL : permissions_map_find(&engine->channels, channel_id);
+    permissions_channel_t *channel = value == NULL ? NULL : (permissions_channel_t *) (uintptr_t) *value;
+
+    if (index == SIZE_MAX || (channel_id != 0 && (channel == NULL || channel->guild_id != guild_id)))
+    {
+        engine->stats.unknown++;
+        pthread_mutex_unlock(&engine->lock);
+        return false;
+    }
+
+    if (channel == NULL)
+    {
+        *result = permissions_base(engine, guild, index);
+        pthread_mutex_unlock(&engine->lock);
+        return true;
+    }
+
+    struct permissions_memo *memo =
+        &engine->memo[permissions_hash(user_id ^ permissions_hash(channel_id)) & (engine->memo_slots - 1)];
+    uint64_t stamp = permissions_max(permissions_max(guild->roles_changed_at, guild->member_changed_at[index]),
+                                     channel->changed_at);
+
+    if (memo->user_id == user_id && memo->channel_id == channel_id && memo->computed_at >= stamp)
+    {
+        engine->stats.memo_hits++;
+        *result = memo->permissions;
+        pthread_mutex_unlock(&engine->lock);
+        return true;
+    }
+
+    uint64_t base = permissions_base(engine, guild, index);
+
+    /* Owners and administrators are not subject to overwrites. */
+    *result = base == PERMISSIONS_ALL ? base : permissions_apply_overwrites(guild, channel, index, base);
+    *memo = (struct permissions_memo) {
+        .user_id = user_id,
+        .channel_id = channel_id,
+        .permissions = *result,
+        .computed_at = engine->generation,
+    };
+    engine->stats.memo_misses++;
+    pthread_mutex_unlock(&engine->lock);
+    return true;
+}
+
+void permissions_get_stats(permissions_t *engine, permissions_stats_t *stats)
+{
+    pthread_mutex_lock(&engine->lock);
+    *stats = engine->stats;
+    stats->guilds = engine->guilds.length;
+    stats->channels = engine->channels.length;
+    stats->generation = engine->generation;
+    stats->members = 0;
+
+    for (size_t i = 0; i < engine->guilds.capacity; i++)
+    {
+        if (engine->guilds.keys[i] != 0)
+            stats->members += ((permissions_guild_t *) (uintptr_t) engine->guilds.values[i])->member_count;
+    }
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+/*
+ * Snapshot section. A resumed gateway session does not replay GUILD_CREATE,
+ * so the engine's state is carried across restarts like the message cache.
+ * Each record is followed by `count` items: roles (id, permissions) for a
+ * guild, overwrites for a channel, role IDs for a member.
+ */
+enum permissions_snapshot_kind
+{
+    PERMISSIONS_SNAPSHOT_GUILD = 1,
+    PERMISSIONS_SNAPSHOT_CHANNEL = 2,
+    PERMISSIONS_SNAPSHOT_MEMBER = 3,
+};
+
+struct permissions_snapshot_record
+{
+    uint32_t kind;
+    uint32_t count;
+    uint64_t id;
+    uint64_t guild_id;
+    uint64_t owner_id;
+};
+
+struct permissions_snapshot_overwrite
+{
+    uint64_t id;
+    uint64_t allow;
+    uint64_t deny;
+    uint32_t type;
+    uint32_t reserved;
+};
+
+static void permissions_snapshot_write_guild(snapshot_writer_t *writer, const permissions_guild_t *guild)
+{
+    struct permissions_snapshot_record record = {
+        .kind = PERMISSIONS_SNAPSHOT_GUILD,
+        .id = guild->id,
+        .guild_id = guild->id,
+        .owner_id = guild->owner_id,
+    };
+
+    for (size_t slot = 0; slot < guild->role_count; slot++)
+        record.count += guild->role_ids[slot] != 0;
+
+    snapshot_write(writer, &record, sizeof record);
+
+    for (size_t slot = 0; slot < guild->role_count; slot++)
+    {
+        if (guild->role_ids[slot] == 0)
+            continue;
+
+        uint64_t role[2] = { guild->role_ids[slot], guild->role_permissions[slot] };
+        snapshot_write(writer, role, sizeof role);
+    }
+
+    for (size_t i = 0; i < guild->member_count; i++)
+    {
+        struct permissions_snapshot_record member = {
+            .kind = PERMISSIONS_SNAPSHOT_MEMBER,
+            .id = guild->member_ids[i],
+            .guild_id = guild->id,
+        };
+
+        for (size_t word = 0; word < PERMISSIONS_ROLE_WORDS; word++)
+            member.count += (uint32_t) __builtin_popcountll(guild->member_roles[i].words[word]);
+
+        snapshot_write(writer, &member, sizeof member);
+
+        for (size_t word = 0; word < PERMISSIONS_ROLE_WORDS; word++)
+        {
+            for (uint64_t bits = guild->member_roles[i].words[word]; bits != 0; bits &= bits - 1)
+                snapshot_write(writer, &guild->role_ids[word * 64 + (size_t) __builtin_ctzll(bits)],
+                               sizeof (uint64_t));
+        }
+    }
+}
+
+static void permissions_snapshot_write_channel(snapshot_writer_t *writer, const permissions_channel_t *channel)
+{
+    struct permissions_snapshot_record record = {
+        .kind = PERMISSIONS_SNAPSHOT_CHANNEL,
+        .count = (uint32_t) (1 + channel->role_count + channel->member_count),
+        .id = channel->id,
+        .guild_id = channel->guild_id,
+    };
+    struct permissions_snapshot_overwrite everyone = {
+        .id = channel->guild_id,
+        .type = PERMISSIONS_OVERWRITE_ROLE,
+        .allow = channel->everyone_allow,
+        .deny = channel->everyone_deny,
+    };
+
+    snapshot_write(writer, &record, sizeof record);
+    snapshot_write(writer, &everyone, sizeof everyone);
+
+    for (size_t i = 0; i < channel->role_count; i++)
+    {
+        struct permissions_snapshot_overwrite overwrite = {
+            .id = channel->role_ids[i],
+            .type = PERMISSIONS_OVERWRITE_ROLE,
+            .allow = channel->role_allow[i],
+            .deny = channel->role_deny[i],
+        };
+
+        snapshot_write(writer, &overwrite, sizeof overwrite);
+    }
+
+    for (size_t i = 0; i < channel->member_count; i++)
+    {
+        struct permissions_snapshot_overwrite overwrite = {
+            .id = channel->members[i].id,
+            .type = PERMISSIONS_OVERWRITE_MEMBER,
+            .allow = channel->members[i].allow,
+            .deny = channel->members[i].deny,
+        };
+
+        snapshot_write(writer, &overwrite, sizeof overwrite);
+    }
+}
+
+void permissions_snapshot_save(snapshot_writer_t *writer)
+{
+    permissions_t *engine = permissions;
+
+    if (engine == NULL)
+        return;
+
+    pthread_mutex_lock(&engine->lock);
+
+    for (size_t i = 0; i < engine->guilds.capacity; i++)
+    {
+        if (engine->guilds.keys[i] != 0)
+            permissions_snapshot_write_guild(writer, (permissions_guild_t *) (uintptr_t) engine->guilds.values[i]);
+    }
+
+    for (size_t i = 0; i < engine->channels.capacity; i++)
+    {
+        if (engine->channels.keys[i] != 0)
+            permissions_snapshot_write_channel(writer,
+                                               (permissions_channel_t *) (uintptr_t) engine->channels.values[i]);
+    }
+
+    pthread_mutex_unlock(&engine->lock);
+}
+
+static size_t permissions_snapshot_item_size(uint32_t kind)
+{
+    switch (kind)
+    {
+        case PERMISSIONS_SNAPSHOT_GUILD:
+            return 2 * sizeof (uint64_t);
+
+        case PERMISSIONS_SNAPSHOT_CHANNEL:
+            return sizeof (struct permissions_snapshot_overwrite);
+
+        case PERMISSIONS_SNAPSHOT_MEMBER:
+            return sizeof (uint64_t);
+
+        default:
+            return 0;
+    }
+}
+
+bool permissions_snapshot_load(const void *data, size_t length, const snapshot_info_t *info)
+{
+    permissions_t *engine = permissions;
+    const unsigned char *cursor = data;
+    const unsigned char *end = cursor + length;
+    uint64_t *items = NULL;
+    size_t items_capacity = 0;
+
+    (void) info;
+
+    if (engine == NULL)
+        return false;
+
+    pthread_mutex_lock(&engine->lock);
+
+    while ((size_t) (end - cursor) >= sizeof (struct permissions_snapshot_record))
+    {
+        struct permissions_snapshot_record record;
+
+        memcpy(&record, cursor, sizeof record);
+        cursor += sizeof record;
+
+        size_t item_size = permissions_snapshot_item_size(record.kind);
+        size_t size = item_size * record.count;
+
+        if (item_size == 0 || (size_t) (end - cursor) < size)
+            break;
+
+        /* Items are copied out, as the mapping gives no alignment guarantee for them. */
+        if (size > items_capacity)
+        {
+            items_capacity = size;
+            items = xrealloc(items, items_capacity);
+        }
+
+        memcpy(items, cursor, size);
+        cursor += size;
+
+        permissions_guild_t *guild = permissions_guild_get(engine, record.guild_id, true);
+
+        if (guild == NULL)
+            continue;
+
+        if (record.kind == PERMISSIONS_SNAPSHOT_GUILD)
+        {
+            guild->owner_id = record.owner_id;
+
+            for (size_t i = 0; i < record.count; i++)
+                permissions_role_set(engine, guild, items[2 * i], items[2 * i + 1]);
+        }
+        else if (record.kind == PERMISSIONS_SNAPSHOT_CHANNEL)
+        {
+            const struct permissions_snapshot_overwrite *saved = (const void *) items;
+            struct discord_overwrites overwrites = {
+                .size = (int) record.count,
+                .array = xcalloc(record.count + 1, sizeof (struct discord_overwrite)),
+            };
+
+            for (size_t i = 0; i < record.count; i++)
+            {
+                overwrites.array[i] = (struct discord_overwrite) {
+                    .id = saved[i].id,
+                    .type = (int) saved[i].type,
+                    .allow = saved[i].allow,
+                    .deny = saved[i].deny,
+                };
+            }
+
+            permissions_channel_set(engine, guild, record.id, &overwrites);
+            free(overwrites.array);
+        }
+        else
+        {
+            permissions_member_set(engine, guild, record.id, items, record.count);
+        }
+    }
+
+    pthread_mutex_unlock(&engine->lock);
+    free(items);
+    log_debug("permissions: restored %zu guild(s) and %zu channel(s) from snapshot", engine->guilds.length,
+              engine->channels.length);
+    return cursor == end;
+}
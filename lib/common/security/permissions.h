@@ -0,0 +1,151 @@
+#ifndef SUDOBOT_SECURITY_PERMISSIONS_H
+#define SUDOBOT_SECURITY_PERMISSIONS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <concord/discord.h>
+
+#define PERMISSIONS_MAX_ROLES 256
+#define PERMISSIONS_ROLE_WORDS (PERMISSIONS_MAX_ROLES / 64)
+#define PERMISSIONS_NO_SLOT 0xFFFF
+#define PERMISSIONS_DEFAULT_MEMO_SLOTS 65536
+#define PERMISSIONS_ALL UINT64_MAX
+#define PERMISSIONS_ADMINISTRATOR (1ULL << 3)
+
+struct permissions_map
+{
+    uint64_t *keys;
+    uint64_t *values;
+    size_t capacity;
+    size_t length;
+};
+
+/* One bit per role slot of the guild. */
+typedef struct permissions_roleset
+{
+    uint64_t words[PERMISSIONS_ROLE_WORDS];
+} permissions_roleset_t;
+
+struct permissions_overwrite
+{
+    uint64_t id;
+    uint64_t allow;
+    uint64_t deny;
+};
+
+/*
+ * Channel overwrites. Role overwrites are kept as parallel arrays and carry
+ * the role slot they resolved to; a slot whose role ID no longer matches is
+ * looked up again on the next evaluation.
+ */
+typedef struct permissions_channel
+{
+    uint64_t id;
+    uint64_t guild_id;
+    uint64_t changed_at;
+    uint64_t everyone_allow;
+    uint64_t everyone_deny;
+    size_t role_count;
+    uint64_t *role_ids;
+    uint16_t *role_slots;
+    uint64_t *role_allow;
+    uint64_t *role_deny;
+    size_t member_count;
+    struct permissions_overwrite *members;
+} permissions_channel_t;
+
+/*
+ * Roles and members of one guild, as struct-of-arrays. Role slot 0 is
+ * @everyone (its ID is the guild ID). Members hold a bitset of role slots,
+ * so their guild-level permissions are an OR over role_permissions, cached
+ * in member_base until the member or any role changes.
+ */
+typedef struct permissions_guild
+{
+    uint64_t id;
+    uint64_t owner_id;
+    uint64_t roles_changed_at;
+    /* Set when the guild ran out of role slots; its answers are unknown. */
+    bool overflowed;
+    size_t role_count;
+    uint64_t role_ids[PERMISSIONS_MAX_ROLES];
+    uint64_t role_permissions[PERMISSIONS_MAX_ROLES];
+    /* role ID -> slot */
+    struct permissions_map role_index;
+    /* user ID -> member index */
+    struct permissions_map member_index;
+    size_t member_count;
+    size_t member_capacity;
+    uint64_t *member_ids;
+    permissions_roleset_t *member_roles;
+    uint64_t *member_changed_at;
+    uint64_t *member_base;
+    uint64_t *member_base_at;
+} permissions_guild_t;
+
+/* Direct-mapped memo of channel-level results. */
+struct permissions_memo
+{
+    uint64_t user_id;
+    uint64_t channel_id;
+    uint64_t permissions;
+    uint64_t computed_at;
+};
+
+typedef struct permissions_stats
+{
+    size_t guilds;
+    size_t channels;
+    size_t members;
+    uint64_t generation;
+    uint64_t memo_hits;
+    uint64_t memo_misses;
+    uint64_t unknown;
+} permissions_stats_t;
+
+/*
+ * Every change stamps the object it touched with a fresh value of
+ * `generation`. A memoized result stays valid while it was computed at or
+ * after the stamps of its guild's roles, its channel and its member, so an
+ * update only invalidates the results that depend on it.
+ */
+typedef struct permissions
+{
+    pthread_mutex_t lock;
+    uint64_t generation;
+    /* guild ID -> permissions_guild_t * */
+    struct permissions_map guilds;
+    /* channel ID -> permissions_channel_t * */
+    struct permissions_map channels;
+    struct permissions_memo *memo;
+    size_t memo_slots;
+    permissions_stats_t stats;
+} permissions_t;
+
+extern permissions_t *permissions;
+
+permissions_t *permissions_init(size_t memo_slots);
+void permissions_free(permissions_t *engine);
+
+void permissions_on_guild_create(permissions_t *engine, const struct discord_guild *guild);
+void permissions_on_guild_update(permissions_t *engine, const struct discord_guild *guild);
+void permissions_on_role_update(permissions_t *engine, uint64_t guild_id, const struct discord_role *role);
+void permissions_on_role_delete(permissions_t *engine, uint64_t guild_id, uint64_t role_id);
+void permissions_on_channel_update(permissions_t *engine, const struct discord_channel *channel);
+void permissions_on_channel_delete(permissions_t *engine, uint64_t channel_id);
+void permissions_on_member_update(permissions_t *engine, uint64_t guild_id, uint64_t user_id,
+                                  const struct snowflakes *roles);
+void permissions_on_member_remove(permissions_t *engine, uint64_t guild_id, uint64_t user_id);
+
+bool permissions_compute(permissions_t *engine, uint64_t guild_id, uint64_t user_id, uint64_t channel_id,
+                         uint64_t *result);
+void permissions_get_stats(permissions_t *engine, permissions_stats_t *stats);
+
+struct snapshot_writer;
+struct snapshot_info;
+void permissions_snapshot_save(struct snapshot_writer *writer);
+bool permissions_snapshot_load(const void *data, size_t length, const struct snapshot_info *info);
+
+#endif /* SUDOBOT_SECURITY_PERMISSIONS_H */
@@ -0,0 +1,1082 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include "infractions.h"
+#include "../io/log.h"
+#include "../utils/crc32.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define INFRACTION_ALIGN_UP(n) (((n) + 7) & ~((uint64_t) 7))
+#define INFRACTION_CHECKSUM_START offsetof(struct infraction_record, length)
+
+infraction_store_t *infraction_store = NULL;
+
+static uint64_t infraction_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static uint64_t infraction_key_hash(uint64_t guild_id, uint64_t user_id)
+{
+    uint64_t hash = guild_id * 0x9E3779B97F4A7C15ULL ^ user_id;
+
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static uint32_t infraction_record_checksum(const struct infraction_record *record)
+{
+    return crc32c(0, (const unsigned char *) record + INFRACTION_CHECKSUM_START,
+                  record->length - INFRACTION_CHECKSUM_START);
+}
+
+static const struct infraction_record *infraction_record_at(const infraction_store_t *store, uint64_t offset)
+{
+    return (const struct infraction_record *) (store->log_map + offset);
+}
+
+/* Validates the record at offset against the first `limit` bytes of the log. */
+static bool infraction_record_valid(const infraction_store_t *store, uint64_t offset, uint64_t limit)
+{
+    if (offset + sizeof (struct infraction_record) > limit)
+        return false;
+
+    const struct infraction_record *record = infraction_record_at(store, offset);
+
+    return record->magic == INFRACTION_RECORD_MAGIC && record->length >= sizeof (*record) &&
+           record->length == sizeof (*record) + record->reason_length && offset + record->length <= limit &&
+           record->checksum == infraction_record_checksum(record);
+}
+
+static struct infraction_index_slot *infraction_index_slot(struct infraction_index_header *index,
+                                                           uint64_t guild_id, uint64_t user_id)
+{
+    uint64_t mask = index->capacity - 1;
+    uint64_t i = infraction_key_hash(guild_id, user_id) & mask;
+
+    while (index->slots[i].head != INFRACTION_NO_OFFSET &&
+           (index->slots[i].guild_id != guild_id || index->slots[i].user_id != user_id))
+        i = (i + 1) & mask;
+
+    return &index->slots[i];
+}
+
+static size_t infraction_index_size(uint64_t capacity)
+{
+    return sizeof (struct infraction_index_header) + capacity * sizeof (struct infraction_index_slot);
+}
+
+static void infraction_index_unmap(infraction_store_t *store)
+{
+    if (store->index != NULL)
+        munmap(store->index, store->index_mapping_size);
+
+    if (store->index_fd >= 0)
+        close(store->index_fd);
+
+    store->index = NULL;
+    store->index_fd = -1;
+}
+
+/*
+ * Creates a fresh, empty index file at path and maps it. The store's current
+ * index is left untouched, so callers can fill the new one and swap.
+ */
+static struct infraction_index_header *infraction_index_create(const char *path, uint64_t capacity,
+                                                               uint64_t generation, int *fd_out)
+{
+    size_t size = infraction_index_size(capacity);
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (fd < 0 || ftruncate(fd, (off_t) size) != 0)
+    {
+        log_error("infractions: failed to create index %s: %s", path, get_last_error());
+
+        if (fd >= 0)
+            close(fd);
+
+        return NULL;
+    }
+
+    struct infraction_index_header *index = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (index == MAP_FAILED)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    index->magic = INFRACTION_INDEX_MAGIC;
+    index->version = INFRACTION_STORE_VERSION;
+    index->generation = generation;
+    index->capacity = capacity;
+    index->count = 0;
+    index->indexed_until = sizeof (struct infraction_log_header);
+    index->dead_bytes = 0;
+    index->dirty = 1;
+    msync(index, sizeof (*index), MS_SYNC);
+    *fd_out = fd;
+    return index;
+}
+
+/*
+ * Writes a new index file holding the keys of source (which may be the
+ * store's current index, or NULL for an empty one) and swaps it in.
+ */
+static bool infraction_index_replace(infraction_store_t *store, const struct infraction_index_header *source,
+                                     uint64_t capacity)
+{
+    char *path = NULL;
+    int fd;
+
+    if (asprintf(&path, "%s.tmp", store->index_path) < 0)
+        return false;
+
+    struct infraction_index_header *index = infraction_index_create(path, capacity, store->generation, &fd);
+
+    if (index == NULL)
+    {
+        free(path);
+        return false;
+    }
+
+    if (source != NULL)
+    {
+        for (uint64_t i = 0; i < source->capacity; i++)
+        {
+            const struct infraction_index_slot *slot = &source->slots[i];
+
+            if (slot->head == INFRACTION_NO_OFFSET)
+                continue;
+
+            *infraction_index_slot(index, slot->guild_id, slot->user_id) = *slot;
+            index->count++;
+        }
+
+        index->indexed_until = source->indexed_until;
+        index->dead_bytes = source->dead_bytes;
+    }
+
+    if (rename(path, store->index_path) != 0)
+    {
+        log_error("infractions: failed to replace index: %s", get_last_error());
+        munmap(index, infraction_index_size(capacity));
+        close(fd);
+        unlink(path);
+        free(path);
+        return false;
+    }
+
+    free(path);
+    infraction_index_unmap(store);
+    store->index = index;
+    store->index_fd = fd;
+    store->index_mapping_size = infraction_index_size(capacity);
+    return true;
+}
+
+static bool infraction_index_load(infraction_store_t *store)
+{
+    struct stat st;
+    int fd = open(store->index_path, O_RDWR | O_CLOEXEC);
+
+    if (fd < 0)
+        return false;
+
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof (struct infraction_index_header))
+    {
+        close(fd);
+        return false;
+    }
+
+    struct infraction_index_header *index = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (index == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+
+    if (index->magic != INFRACTION_INDEX_MAGIC || index->version != INFRACTION_STORE_VERSION ||
+        index->generation != store->generation || index->capacity == 0 ||
+        (index->capacity & (index->capacity - 1)) != 0 ||
+        infraction_index_size(index->capacity) != (size_t) st.st_size || index->indexed_until > store->log_size ||
+        index->dirty)
+    {
+        munmap(index, (size_t) st.st_size);
+        close(fd);
+        return false;
+    }
+
+    /* From here on the file may hold changes that never reach the disk. */
+    index->dirty = 1;
+
+    if (msync(index, sizeof (*index), MS_SYNC) != 0)
+    {
+        munmap(index, (size_t) st.st_size);
+        close(fd);
+        return false;
+    }
+
+    store->index = index;
+    store->index_fd = fd;
+    store->index_mapping_size = (size_t) st.st_size;
+    return true;
+}
+
+static bool infraction_index_reserve(infraction_store_t *store)
+{
+    if ((store->index->count + 1) * 10 <= store->index->capacity * 7)
+        return true;
+
+    return infraction_index_replace(store, store->index, store->index->capacity * 2);
+}
+
+/* Finds the record of the given kind and ID in the chain starting at offset. */
+static const struct infraction_record *infraction_chain_find(const infraction_store_t *store, uint64_t offset,
+                                                             uint64_t id, uint16_t kind)
+{
+    while (offset != INFRACTION_NO_OFFSET)
+    {
+        const struct infraction_record *record = infraction_record_at(store, offset);
+
+        if (record->id == id && record->kind == kind)
+            return record;
+
+        offset = record->prev_offset;
+    }
+
+    return NULL;
+}
+
+/* Reflects the record at offset in the index. */
+static bool infraction_index_apply(infraction_store_t *store, uint64_t offset)
+{
+    const struct infraction_record *record = infraction_record_at(store, offset);
+
+    if (!infraction_index_reserve(store))
+        return false;
+
+    struct infraction_index_slot *slot = infraction_index_slot(store->index, record->guild_id, record->user_id);
+
+    if (record->kind == INFRACTION_RECORD_REVOKE)
+    {
+        const struct infraction_record *target = infraction_chain_find(store, slot->head, record->id,
+                                                                        INFRACTION_RECORD_PUT);
+
+        store->index->dead_bytes += INFRACTION_ALIGN_UP(record->length);
+
+        if (target != NULL)
+            store->index->dead_bytes += INFRACTION_ALIGN_UP(target->length);
+    }
+
+    if (slot->head == INFRACTION_NO_OFFSET)
+    {
+        slot->guild_id = record->guild_id;
+        slot->user_id = record->user_id;
+        store->index->count++;
+    }
+
+    slot->head = offset;
+    store->index->indexed_until = offset + INFRACTION_ALIGN_UP(record->length);
+    return true;
+}
+
+/*
+ * Brings the index up to date with the log. Stops at the first record that
+ * fails validation and truncates the log there, discarding a torn write.
+ */
+static bool infraction_store_replay(infraction_store_t *store)
+{
+    uint64_t offset = store->index->indexed_until;
+    uint64_t replayed = 0;
+
+    while (infraction_record_valid(store, offset, store->log_size))
+    {
+        if (!infraction_index_apply(store, offset))
+            return false;
+
+        offset = store->index->indexed_until;
+        replayed++;
+    }
+
+    if (offset < store->log_size)
+    {
+        log_warn("infractions: discarding %lu byte(s) of damaged log tail", store->log_size - offset);
+
+        if (ftruncate(store->log_fd, (off_t) offset) != 0)
+            return false;
+
+        store->log_size = offset;
+    }
+
+    if (replayed > 0)
+        log_debug("infractions: replayed %lu record(s) into the index", replayed);
+
+    return true;
+}
+
+static bool infraction_log_map(infraction_store_t *store)
+{
+    void *map = mmap(NULL, INFRACTION_LOG_MAP_SIZE, PROT_READ, MAP_SHARED, store->log_fd, 0);
+
+    if (map == MAP_FAILED)
+    {
+        log_error("infractions: failed to map log: %s", get_last_error());
+        return false;
+    }
+
+    store->log_map = map;
+    return true;
+}
+
+static bool infraction_log_open(infraction_store_t *store)
+{
+    struct infraction_log_header header;
+    struct stat st;
+
+    store->log_fd = open(store->log_path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+    if (store->log_fd < 0 || fstat(store->log_fd, &st) != 0)
+    {
+        log_error("infractions: failed to open %s: %s", store->log_path, get_last_error());
+        return false;
+    }
+
+    if (st.st_size == 0)
+    {
+        header.magic = INFRACTION_LOG_MAGIC;
+        header.version = INFRACTION_STORE_VERSION;
+        header.generation = get_monotonic_time_ns() ^ infraction_now_ms();
+
+        if (pwrite(store->log_fd, &header, sizeof header, 0) != sizeof header || fdatasync(store->log_fd) != 0)
+            return false;
+
+        st.st_size = sizeof header;
+    }
+    else if (pread(store->log_fd, &header, sizeof header, 0) != sizeof header ||
+             header.magic != INFRACTION_LOG_MAGIC || header.version != INFRACTION_STORE_VERSION)
+    {
+        log_error("infractions: %s is not a version %d infraction log", store->log_path, INFRACTION_STORE_VERSION);
+        return false;
+    }
+
+    store->generation = header.generation;
+    store->log_size = (uint64_t) st.st_size;
+    return infraction_log_map(store);
+}
+
+infraction_store_t *infraction_store_open(const char *directory)
+{
+    infraction_store_t *store = xcalloc(1, sizeof (*store));
+
+    store->log_fd = -1;
+    store->index_fd = -1;
+    pthread_rwlock_init(&store->lock, NULL);
+    pthread_mutex_init(&store->compaction_lock, NULL);
+    pthread_mutex_init(&store->compactor_lock, NULL);
+    pthread_cond_init(&store->compactor_cond, NULL);
+
+    if ((mkdir(directory, 0700) != 0 && errno != EEXIST) ||
+        asprintf(&store->log_path, "%s/infractions.log", directory) < 0 ||
+        asprintf(&store->index_path, "%s/infractions.idx", directory) < 0 ||
+        !infraction_log_open(store))
+    {
+        infraction_store_close(store);
+        return NULL;
+    }
+
+    if (!infraction_index_load(store))
+    {
+        log_info("infractions: rebuilding index from the log");
+
+        if (!infraction_index_replace(store, NULL, INFRACTION_INDEX_MIN_CAPACITY))
+        {
+            infraction_store_close(store);
+            return NULL;
+        }
+    }
+
+    if (!infraction_store_replay(store))
+    {
+        infraction_store_close(store);
+        return NULL;
+    }
+
+    log_info("infractions: opened %s (%lu key(s), %lu byte(s))", directory, store->index->count, store->log_size);
+    return store;
+}
+
+void infraction_store_close(infraction_store_t *store)
+{
+    if (store == NULL)
+        return;
+
+    if (store->compactor_started)
+    {
+        pthread_mutex_lock(&store->compactor_lock);
+        store->stopping = true;
+        pthread_cond_signal(&store->compactor_cond);
+        pthread_mutex_unlock(&store->compactor_lock);
+        pthread_join(store->compactor, NULL);
+    }
+
+    if (store->log_fd >= 0)
+        fdatasync(store->log_fd);
+
+    if (store->index != NULL && msync(store->index, store->index_mapping_size, MS_SYNC) == 0)
+    {
+        store->index->dirty = 0;
+        msync(store->index, sizeof (*store->index), MS_SYNC);
+    }
+
+    infraction_index_unmap(store);
+
+    if (store->log_map != NULL)
+        munmap((void *) store->log_map, INFRACTION_LOG_MAP_SIZE);
+
+    if (store->log_fd >= 0)
+        close(store->log_fd);
+
+    pthread_rwlock_destroy(&store->lock);
+    pthread_mutex_destroy(&store->compaction_lock);
+    pthread_mutex_destroy(&store->compactor_lock);
+    pthread_cond_destroy(&store->compactor_cond);
+    free(store->log_path);
+    free(store->index_path);
+    free(store);
+}
+
+static bool infraction_store_write(infraction_store_t *store, struct infraction_record *record, const char *reason)
+{
+    struct infraction_index_slot *slot = infraction_index_slot(store->index, record->guild_id, record->user_id);
+    uint64_t size = INFRACTION_ALIGN_UP(record->length);
+    static const char padding[8] = { 0 };
+
+    if (store->log_size + size > INFRACTION_LOG_MAP_SIZE)
+    {
+        log_error("infractions: log is full; compaction is required");
+        return false;
+    }
+
+    record->magic = INFRACTION_RECORD_MAGIC;
+    record->prev_offset = slot->head;
+    record->chain_max_created_at_ms = record->created_at_ms;
+
+    if (slot->head != INFRACTION_NO_OFFSET)
+    {
+        uint64_t previous_max = infraction_record_at(store, slot->head)->chain_max_created_at_ms;
+
+        if (previous_max > record->chain_max_created_at_ms)
+            record->chain_max_created_at_ms = previous_max;
+    }
+
+    uint32_t checksum = crc32c(0, (const unsigned char *) record + INFRACTION_CHECKSUM_START,
+                               sizeof (*record) - INFRACTION_CHECKSUM_START);
+    record->checksum = crc32c(checksum, reason, record->reason_length);
+
+    struct iovec parts[] = {
+        { .iov_base = record, .iov_len = sizeof (*record) },
+        { .iov_base = (void *) reason, .iov_len = record->reason_length },
+        { .iov_base = (void *) padding, .iov_len = size - record->length },
+    };
+
+    if (pwritev(store->log_fd, parts, 3, (off_t) store->log_size) != (ssize_t) size)
+    {
+        log_error("infractions: append failed: %s", get_last_error());
+        return false;
+    }
+
+    uint64_t offset = store->log_size;
+    store->log_size += size;
+
+    if (infraction_index_apply(store, offset))
+        return true;
+
+    /*
+     * Take the record back out of the log, or the next append would index
+     * past it and leave it unreachable. The next append overwrites it even
+     * if the truncation fails.
+     */
+    store->log_size = offset;
+
+    if (ftruncate(store->log_fd, (off_t) offset) != 0)
+        log_error("infractions: failed to drop an unindexed record: %s", get_last_error());
+
+    return false;
+}
+
+/* Appended records are only reported as stored once they are on disk. */
+static bool infraction_log_sync(infraction_store_t *store)
+{
+    if (fdatasync(store->log_fd) != 0)
+    {
+        log_error("infractions: failed to sync the log: %s", get_last_error());
+        return false;
+    }
+
+    return true;
+}
+
+static void infraction_record_init(struct infraction_record *record, const infraction_t *infraction)
+{
+    size_t reason_length = infraction->reason == NULL ? 0 : infraction->reason_length;
+
+    *record = (struct infraction_record) {
+        .length = (uint32_t) (sizeof (*record) + (reason_length > UINT16_MAX ? UINT16_MAX : reason_length)),
+        .kind = INFRACTION_RECORD_PUT,
+        .reason_length = (uint16_t) (reason_length > UINT16_MAX ? UINT16_MAX : reason_length),
+        .id = infraction->id,
+        .guild_id = infraction->guild_id,
+        .user_id = infraction->user_id,
+        .moderator_id = infraction->moderator_id,
+        .created_at_ms = infraction->created_at_ms != 0 ? infraction->created_at_ms : infraction_now_ms(),
+        .expires_at_ms = infraction->expires_at_ms,
+        .type = (uint32_t) infraction->type,
+    };
+}
+
+bool infraction_store_append(infraction_store_t *store, const infraction_t *infraction)
+{
+    struct infraction_record record;
+
+    infraction_record_init(&record, infraction);
+    pthread_rwlock_wrlock(&store->lock);
+    bool ret = infraction_store_write(store, &record, infraction->reason) && infraction_log_sync(store);
+    pthread_rwlock_unlock(&store->lock);
+    return ret;
+}
+
+/**
+ * @brief Imports infractions recorded before the store existed, such as
+ * the history kept in the database, so that counts cover them too.
+ * Infractions whose ID the user's chain already holds are skipped, which
+ * makes it safe to backfill the same range again.
+ * @return The number of infractions added.
+ */
+size_t infraction_store_backfill(infraction_store_t *store, const infraction_t *infractions, size_t count)
+{
+    size_t added = 0;
+
+    pthread_rwlock_wrlock(&store->lock);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const infraction_t *infraction = &infractions[i];
+        const struct infraction_index_slot *slot = infraction_index_slot(store->index, infraction->guild_id,
+                                                                         infraction->user_id);
+        struct infraction_record record;
+
+        if (infraction_chain_find(store, slot->head, infraction->id, INFRACTION_RECORD_PUT) != NULL)
+            continue;
+
+        infraction_record_init(&record, infraction);
+
+        if (!infraction_store_write(store, &record, infraction->reason))
+            break;
+
+        added++;
+    }
+
+    if (added > 0 && !infraction_log_sync(store))
+        added = 0;
+
+    pthread_rwlock_unlock(&store->lock);
+    return added;
+}
+
+bool infraction_store_revoke(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t id)
+{
+    struct infraction_record record = {
+        .length = sizeof record,
+        .kind = INFRACTION_RECORD_REVOKE,
+        .id = id,
+        .guild_id = guild_id,
+        .user_id = user_id,
+        .created_at_ms = infraction_now_ms(),
+    };
+    bool ret = false;
+
+    pthread_rwlock_wrlock(&store->lock);
+
+    struct infraction_index_slot *slot = infraction_index_slot(store->index, guild_id, user_id);
+
+    if (infraction_chain_find(store, slot->head, id, INFRACTION_RECORD_PUT) != NULL &&
+        infraction_chain_find(store, slot->head, id, INFRACTION_RECORD_REVOKE) == NULL)
+        ret = infraction_store_write(store, &record, NULL) && infraction_log_sync(store);
+
+    pthread_rwlock_unlock(&store->lock);
+    return ret;
+}
+
+typedef bool (*infraction_visitor_t)(const infraction_store_t *store, const struct infraction_record *record,
+                                     void *data);
+
+/*
+ * Walks the (guild, user) chain from newest to oldest, visiting live PUT
+ * records created in [from_ms, to_ms]. Revocations always come after their
+ * target in the log, so they are seen first.
+ */
+static size_t infraction_chain_walk(const infraction_store_t *store, uint64_t head, uint64_t from_ms, uint64_t to_ms,
+                                    infraction_visitor_t visitor, void *data)
+{
+    uint64_t revoked[INFRACTION_REVOKED_SCAN_MAX];
+    size_t revoked_count = 0;
+    bool revoked_overflow = false;
+    size_t visited = 0;
+
+    for (uint64_t offset = head; offset != INFRACTION_NO_OFFSET;)
+    {
+        const struct infraction_record *record = infraction_record_at(store, offset);
+
+        if (record->chain_max_created_at_ms < from_ms)
+            break;
+
+        offset = record->prev_offset;
+
+        if (record->kind == INFRACTION_RECORD_REVOKE)
+        {
+            if (revoked_count < INFRACTION_REVOKED_SCAN_MAX)
+                revoked[revoked_count++] = record->id;
+            else
+                revoked_overflow = true;
+
+            continue;
+        }
+
+        if (record->created_at_ms < from_ms || record->created_at_ms > to_ms)
+            continue;
+
+        bool is_revoked = false;
+
+        for (size_t i = 0; i < revoked_count && !is_revoked; i++)
+            is_revoked = revoked[i] == record->id;
+
+        if (!is_revoked && revoked_overflow)
+            is_revoked = infraction_chain_find(store, head, record->id, INFRACTION_RECORD_REVOKE) != NULL;
+
+        if (is_revoked)
+            continue;
+
+        visited++;
+
+        if (!visitor(store, record, data))
+            break;
+    }
+
+    return visited;
+}
+
+struct infraction_foreach_state
+{
+    infraction_callback_t callback;
+    void *data;
+};
+
+static bool infraction_foreach_visitor(const infraction_store_t *store, const struct infraction_record *record,
+                                       void *data)
+{
+    struct infraction_foreach_state *state = data;
+    infraction_t infraction = {
+        .id = record->id,
+        .guild_id = record->guild_id,
+        .user_id = record->user_id,
+        .moderator_id = record->moderator_id,
+        .created_at_ms = record->created_at_ms,
+        .expires_at_ms = record->expires_at_ms,
+        .type = (infraction_type_t) record->type,
+        .reason = (const char *) (record + 1),
+        .reason_length = record->reason_length,
+    };
+
+    (void) store;
+    return state->callback(&infraction, state->data);
+}
+
+/**
+ * @brief Calls callback for every live infraction of the user created in
+ * [from_ms, to_ms], newest first, until it returns false.
+ * @return The number of infractions visited.
+ */
+size_t infraction_store_foreach(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t from_ms,
+                                uint64_t to_ms, infraction_callback_t callback, void *data)
+{
+    struct infraction_foreach_state state = { .callback = callback, .data = data };
+
+    pthread_rwlock_rdlock(&store->lock);
+
+    const struct infraction_index_slot *slot = infraction_index_slot(store->index, guild_id, user_id);
+    size_t visited = infraction_chain_walk(store, slot->head, from_ms, to_ms, &infraction_foreach_visitor, &state);
+
+    pthread_rwlock_unlock(&store->lock);
+    return visited;
+}
+
+struct infraction_count_state
+{
+    uint32_t type_mask;
+    size_t count;
+};
+
+static bool infraction_count_callback(const infraction_t *infraction, void *data)
+{
+    struct infraction_count_state *state = data;
+
+    if (infraction->type < 32 && (state->type_mask & INFRACTION_TYPE_MASK(infraction->type)))
+        state->count++;
+
+    return true;
+}
+
+size_t infraction_store_count(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t from_ms,
+                              uint32_t type_mask)
+{
+    struct infraction_count_state state = { .type_mask = type_mask, .count = 0 };
+
+    infraction_store_foreach(store, guild_id, user_id, from_ms, UINT64_MAX, &infraction_count_callback, &state);
+    return state.count;
+}
+
+struct infraction_compaction
+{
+    int fd;
+    uint64_t size;
+    unsigned char *buffer;
+    size_t buffer_length;
+    size_t buffer_capacity;
+    struct infraction_index_header *index;
+};
+
+static bool infraction_compaction_flush(struct infraction_compaction *compaction)
+{
+    size_t written = 0;
+
+    while (written < compaction->buffer_length)
+    {
+        ssize_t ret = write(compaction->fd, compaction->buffer + written, compaction->buffer_length - written);
+
+        if (ret < 0 && errno == EINTR)
+            continue;
+
+        if (ret <= 0)
+            return false;
+
+        written += (size_t) ret;
+    }
+
+    compaction->buffer_length = 0;
+    return true;
+}
+
+static bool infraction_compaction_copy(struct infraction_compaction *compaction,
+                                       const struct infraction_record *source)
+{
+    uint64_t size = INFRACTION_ALIGN_UP(source->length);
+    struct infraction_index_slot *slot = infraction_index_slot(compaction->index, source->guild_id,
+                                                               source->user_id);
+
+    if (compaction->buffer_length + size > compaction->buffer_capacity &&
+        !infraction_compaction_flush(compaction))
+        return false;
+
+    struct infraction_record *record = (struct infraction_record *) (compaction->buffer + compaction->buffer_length);
+
+    memset(record, 0, size);
+    memcpy(record, source, source->length);
+    record->prev_offset = slot->head;
+
+    if (slot->head == INFRACTION_NO_OFFSET)
+    {
+        slot->guild_id = record->guild_id;
+        slot->user_id = record->user_id;
+        compaction->index->count++;
+    }
+
+    record->checksum = infraction_record_checksum(record);
+    slot->head = compaction->size;
+    compaction->size += size;
+    compaction->buffer_length += size;
+    return true;
+}
+
+struct infraction_offsets
+{
+    uint64_t *offsets;
+    size_t count;
+    size_t capacity;
+};
+
+static bool infraction_compaction_collect(const infraction_store_t *store, const struct infraction_record *record,
+                                          void *data)
+{
+    struct infraction_offsets *live = data;
+
+    if (live->count == live->capacity)
+    {
+        live->capacity = live->capacity == 0 ? 16 : live->capacity * 2;
+        live->offsets = xrealloc(live->offsets, live->capacity * sizeof (*live->offsets));
+    }
+
+    live->offsets[live->count++] = (uint64_t) ((const unsigned char *) record - store->log_map);
+    return true;
+}
+
+/* Grows the compaction index so that `extra` more keys keep it at most 70% full. */
+static void infraction_compaction_reserve(struct infraction_compaction *compaction, uint64_t extra)
+{
+    struct infraction_index_header *old = compaction->index;
+    uint64_t capacity = old->capacity;
+
+    while ((old->count + extra) * 10 > capacity * 7)
+        capacity *= 2;
+
+    if (capacity == old->capacity)
+        return;
+
+    struct infraction_index_header *index = xcalloc(1, infraction_index_size(capacity));
+
+    index->capacity = capacity;
+    index->dead_bytes = old->dead_bytes;
+
+    for (uint64_t i = 0; i < old->capacity; i++)
+    {
+        if (old->slots[i].head == INFRACTION_NO_OFFSET)
+            continue;
+
+        *infraction_index_slot(index, old->slots[i].guild_id, old->slots[i].user_id) = old->slots[i];
+        index->count++;
+    }
+
+    free(old);
+    compaction->index = index;
+}
+
+/*
+ * Rewrites the log with only live records, grouped by (guild, user) in their
+ * original order, then swaps in the new log and a matching index. Records
+ * already in the log never change, so they are copied from a snapshot of the
+ * index without the store lock. Only the records appended meanwhile are
+ * copied with the store locked, right before the swap.
+ */
+bool infraction_store_compact(infraction_store_t *store)
+{
+    char *path = NULL;
+    bool ret = false;
+    bool locked = false;
+    struct infraction_offsets live = { 0 };
+    struct infraction_index_slot *heads = NULL;
+    uint64_t head_count = 0;
+    struct infraction_log_header header = {
+        .magic = INFRACTION_LOG_MAGIC,
+        .version = INFRACTION_STORE_VERSION,
+    };
+    struct infraction_compaction compaction = {
+        .fd = -1,
+        .size = sizeof header,
+        .buffer_capacity = 1024 * 1024,
+    };
+    uint64_t started_at = get_monotonic_time_ns();
+    uint64_t locked_at = 0;
+
+    pthread_mutex_lock(&store->compaction_lock);
+    pthread_rwlock_rdlock(&store->lock);
+
+    uint64_t old_size = store->log_size;
+    uint64_t capacity = store->index->capacity;
+
+    header.generation = store->generation + 1;
+    heads = xmalloc(capacity * sizeof (*heads));
+
+    for (uint64_t i = 0; i < capacity; i++)
+    {
+        if (store->index->slots[i].head != INFRACTION_NO_OFFSET)
+            heads[head_count++] = store->index->slots[i];
+    }
+
+    pthread_rwlock_unlock(&store->lock);
+
+    compaction.buffer = xmalloc(compaction.buffer_capacity);
+    compaction.index = xcalloc(1, infraction_index_size(capacity));
+    compaction.index->capacity = capacity;
+
+    if (asprintf(&path, "%s.compact", store->log_path) < 0)
+        goto end;
+
+    compaction.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (compaction.fd < 0 || write(compaction.fd, &header, sizeof header) != sizeof header)
+        goto end;
+
+    for (uint64_t i = 0; i < head_count; i++)
+    {
+        live.count = 0;
+        infraction_chain_walk(store, heads[i].head, 0, UINT64_MAX, &infraction_compaction_collect, &live);
+
+        /* The chain is walked newest first; copy oldest first to keep the order. */
+        for (size_t j = live.count; j > 0; j--)
+        {
+            if (!infraction_compaction_copy(&compaction, infraction_record_at(store, live.offsets[j - 1])))
+                goto end;
+        }
+    }
+
+    if (!infraction_compaction_flush(&compaction) || fdatasync(compaction.fd) != 0)
+        goto end;
+
+    pthread_rwlock_wrlock(&store->lock);
+    locked = true;
+    locked_at = get_monotonic_time_ns();
+
+    uint64_t tail_records = 0;
+
+    for (uint64_t offset = old_size; offset < store->log_size; tail_records++)
+        offset += INFRACTION_ALIGN_UP(infraction_record_at(store, offset)->length);
+
+    infraction_compaction_reserve(&compaction, tail_records);
+
+    for (uint64_t offset = old_size; offset < store->log_size;)
+    {
+        const struct infraction_record *record = infraction_record_at(store, offset);
+
+        if (record->kind == INFRACTION_RECORD_REVOKE)
+        {
+            const struct infraction_record *target = infraction_chain_find(store, record->prev_offset, record->id,
+                                                                            INFRACTION_RECORD_PUT);
+
+            compaction.index->dead_bytes += INFRACTION_ALIGN_UP(record->length);
+
+            if (target != NULL)
+                compaction.index->dead_bytes += INFRACTION_ALIGN_UP(target->length);
+        }
+
+        if (!infraction_compaction_copy(&compaction, record))
+            goto end;
+
+        offset += INFRACTION_ALIGN_UP(record->length);
+    }
+
+    if ((tail_records > 0 && (!infraction_compaction_flush(&compaction) || fdatasync(compaction.fd) != 0)) ||
+        rename(path, store->log_path) != 0)
+        goto end;
+
+    compaction.index->indexed_until = compaction.size;
+    store->generation = header.generation;
+
+    /*
+     * The new log is already in place, so a failure from here on would leave
+     * the store pointing at a file that no longer exists.
+     */
+    munmap((void *) store->log_map, INFRACTION_LOG_MAP_SIZE);
+    close(store->log_fd);
+    store->log_map = NULL;
+    store->log_fd = open(store->log_path, O_RDWR | O_CLOEXEC);
+    store->log_size = compaction.size;
+
+    if (store->log_fd < 0 || !infraction_log_map(store) ||
+        !infraction_index_replace(store, compaction.index, compaction.index->capacity))
+    {
+        log_fatal("infractions: failed to reopen the store after compaction: %s", get_last_error());
+        abort();
+    }
+
+    ret = true;
+
+    log_info("infractions: compacted %lu -> %lu byte(s) in %lu us, %lu us of it locked", old_size, store->log_size,
+             (get_monotonic_time_ns() - started_at) / 1000, (get_monotonic_time_ns() - locked_at) / 1000);
+
+end:
+    if (!ret)
+        log_error("infractions: compaction failed: %s", get_last_error());
+
+    if (locked)
+        pthread_rwlock_unlock(&store->lock);
+
+    if (compaction.fd >= 0)
+        close(compaction.fd);
+
+    if (!ret && path != NULL)
+        unlink(path);
+
+    free(compaction.index);
+    free(compaction.buffer);
+    free(live.offsets);
+    free(heads);
+    free(path);
+    pthread_mutex_unlock(&store->compaction_lock);
+    return ret;
+}
+
+struct infraction_compactor_args
+{
+    infraction_store_t *store;
+    uint64_t interval_s;
+};
+
+static void *infraction_compactor_thread(void *data)
+{
+    struct infraction_compactor_args args = *(struct infraction_compactor_args *) data;
+    infraction_store_t *store = args.store;
+
+    free(data);
+    pthread_mutex_lock(&store->compactor_lock);
+
+    while (!store->stopping)
+    {
+        struct timespec deadline;
+
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += (time_t) args.interval_s;
+        pthread_cond_timedwait(&store->compactor_cond, &store->compactor_lock, &deadline);
+
+        if (store->stopping)
+            break;
+
+        pthread_rwlock_rdlock(&store->lock);
+        uint64_t dead_bytes = store->index->dead_bytes;
+        uint64_t log_size = store->log_size;
+        pthread_rwlock_unlock(&store->lock);
+
+        /* Only worth the pause once at least half of the log is dead. */
+        if (dead_bytes >= INFRACTION_COMPACT_MIN_DEAD_BYTES && dead_bytes * 2 >= log_size)
+        {
+            pthread_mutex_unlock(&store->compactor_lock);
+            infraction_store_compact(store);
+            pthread_mutex_lock(&store->compactor_lock);
+        }
+    }
+
+    pthread_mutex_unlock(&store->compactor_lock);
+    return NULL;
+}
+
+bool infraction_store_start_compactor(infraction_store_t *store, uint64_t interval_s)
+{
+    struct infraction_compactor_args *args = xmalloc(sizeof (*args));
+
+    args->store = store;
+    args->interval_s = interval_s == 0 ? INFRACTION_COMPACT_INTERVAL_S : interval_s;
+
+    if (pthread_create(&store->compactor, NULL, &infraction_compactor_thread, args) != 0)
+    {
+        free(args);
+        log_error("infractions: failed to start the compactor thread");
+        return false;
+    }
+
+    store->compactor_started = true;
+    return true;
+}
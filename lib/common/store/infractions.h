@@ -0,0 +1,153 @@
+#ifndef SUDOBOT_STORE_INFRACTIONS_H
+#define SUDOBOT_STORE_INFRACTIONS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define INFRACTION_LOG_MAGIC 0x53424C47 /* "SBLG" */
+#define INFRACTION_RECORD_MAGIC 0x53424946 /* "SBIF" */
+#define INFRACTION_INDEX_MAGIC 0x53424949 /* "SBII" */
+#define INFRACTION_STORE_VERSION 1
+#define INFRACTION_NO_OFFSET 0
+#define INFRACTION_LOG_MAP_SIZE (1ULL << 32)
+#define INFRACTION_INDEX_MIN_CAPACITY 1024
+#define INFRACTION_REVOKED_SCAN_MAX 64
+#define INFRACTION_COMPACT_INTERVAL_S 300
+#define INFRACTION_COMPACT_MIN_DEAD_BYTES (1024 * 1024)
+
+typedef enum infraction_type
+{
+    INFRACTION_TYPE_WARNING = 1,
+    INFRACTION_TYPE_MUTE,
+    INFRACTION_TYPE_TIMEOUT,
+    INFRACTION_TYPE_KICK,
+    INFRACTION_TYPE_BAN,
+    INFRACTION_TYPE_MESSAGE_DELETE,
+    INFRACTION_TYPE_OTHER,
+} infraction_type_t;
+
+#define INFRACTION_TYPE_MASK(type) (1u << (type))
+#define INFRACTION_TYPE_MASK_ALL 0xFFFFFFFFu
+
+enum infraction_record_kind
+{
+    INFRACTION_RECORD_PUT = 1,
+    /* Revokes an earlier record of the same (guild, user) by ID. */
+    INFRACTION_RECORD_REVOKE = 2,
+};
+
+/*
+ * On-disk record, 8-byte aligned in the log. The checksum covers every
+ * byte after it up to `length`. Records of the same (guild, user) form a
+ * backward chain through prev_offset, and chain_max_created_at_ms lets a
+ * time range query stop as soon as nothing older can match.
+ */
+struct infraction_record
+{
+    uint32_t magic;
+    uint32_t checksum;
+    uint32_t length;
+    uint16_t kind;
+    uint16_t reason_length;
+    uint64_t prev_offset;
+    uint64_t chain_max_created_at_ms;
+    uint64_t id;
+    uint64_t guild_id;
+    uint64_t user_id;
+    uint64_t moderator_id;
+    uint64_t created_at_ms;
+    uint64_t expires_at_ms;
+    uint32_t type;
+    uint32_t reserved;
+    /* char reason[reason_length]; */
+};
+
+struct infraction_log_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+};
+
+struct infraction_index_slot
+{
+    uint64_t guild_id;
+    uint64_t user_id;
+    /* Offset of the newest record for this key; INFRACTION_NO_OFFSET if empty. */
+    uint64_t head;
+};
+
+/*
+ * The index is a cache of the log: it is rebuilt whenever it does not
+ * match. It is not synced while the store is open, so `dirty` is set on
+ * disk before the first change and only cleared by a clean close.
+ */
+struct infraction_index_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+    uint64_t capacity;
+    uint64_t count;
+    /* Log offset up to which records are reflected in the index. */
+    uint64_t indexed_until;
+    uint64_t dead_bytes;
+    uint32_t dirty;
+    uint32_t reserved;
+    struct infraction_index_slot slots[];
+};
+
+typedef struct infraction
+{
+    uint64_t id;
+    uint64_t guild_id;
+    uint64_t user_id;
+    uint64_t moderator_id;
+    uint64_t created_at_ms;
+    uint64_t expires_at_ms;
+    infraction_type_t type;
+    /* Points into the mapped log; only valid inside the callback. */
+    const char *reason;
+    size_t reason_length;
+} infraction_t;
+
+typedef bool (*infraction_callback_t)(const infraction_t *infraction, void *data);
+
+typedef struct infraction_store
+{
+    char *log_path;
+    char *index_path;
+    int log_fd;
+    int index_fd;
+    const unsigned char *log_map;
+    uint64_t log_size;
+    uint64_t generation;
+    struct infraction_index_header *index;
+    size_t index_mapping_size;
+    pthread_rwlock_t lock;
+    /* Held for a whole compaction, which runs mostly outside `lock`. */
+    pthread_mutex_t compaction_lock;
+    pthread_t compactor;
+    pthread_mutex_t compactor_lock;
+    pthread_cond_t compactor_cond;
+    bool compactor_started;
+    bool stopping;
+} infraction_store_t;
+
+extern infraction_store_t *infraction_store;
+
+infraction_store_t *infraction_store_open(const char *directory);
+void infraction_store_close(infraction_store_t *store);
+bool infraction_store_append(infraction_store_t *store, const infraction_t *infraction);
+size_t infraction_store_backfill(infraction_store_t *store, const infraction_t *infractions, size_t count);
+bool infraction_store_revoke(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t id);
+size_t infraction_store_foreach(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t from_ms,
+                                uint64_t to_ms, infraction_callback_t callback, void *data);
+size_t infraction_store_count(infraction_store_t *store, uint64_t guild_id, uint64_t user_id, uint64_t from_ms,
+                              uint32_t type_mask);
+bool infraction_store_compact(infraction_store_t *store);
+bool infraction_store_start_compactor(infraction_store_t *store, uint64_t interval_s);
+
+#endif /* SUDOBOT_STORE_INFRACTIONS_H */
@@ -0,0 +1,240 @@
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "snapshot.h"
+#include "../cache/message_cache.h"
+#include "../io/log.h"
+#include "../rest/scheduler.h"
+#include "../security/permissions.h"
+#include "../utils/crc32.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define SNAPSHOT_ALIGN_UP(n) (((n) + 7) & ~((size_t) 7))
+
+/* Every subsystem whose in-memory state survives a restart. */
+static const snapshot_section_t snapshot_sections[] = {
+    {
+        .id = SNAPSHOT_SECTION_REST_BUCKETS,
+        .version = 2,
+        .name = "rest_buckets",
+        .save = &rest_scheduler_snapshot_save,
+        .load = &rest_scheduler_snapshot_load,
+    },
+    {
+        .id = SNAPSHOT_SECTION_MESSAGE_CACHE,
+        .version = 1,
+        .name = "message_cache",
+        .save = &message_cache_snapshot_save,
+        .load = &message_cache_snapshot_load,
+    },
+    {
+        .id = SNAPSHOT_SECTION_PERMISSIONS,
+        .version = 1,
+        .name = "permissions",
+        .save = &permissions_snapshot_save,
+        .load = &permissions_snapshot_load,
+    },
+};
+
+#define SNAPSHOT_SECTION_COUNT (sizeof (snapshot_sections) / sizeof (snapshot_sections[0]))
+
+static uint64_t snapshot_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+void snapshot_write(snapshot_writer_t *writer, const void *data, size_t length)
+{
+    if (writer->length + length > writer->capacity)
+    {
+        while (writer->length + length > writer->capacity)
+            writer->capacity = writer->capacity == 0 ? 4096 : writer->capacity * 2;
+
+        writer->data = xrealloc(writer->data, writer->capacity);
+    }
+
+    memcpy(writer->data + writer->length, data, length);
+    writer->length += length;
+}
+
+static uint32_t snapshot_header_checksum(const struct snapshot_header *header,
+                                         const struct snapshot_section_entry *entries)
+{
+    struct snapshot_header copy = *header;
+
+    copy.checksum = 0;
+    return crc32c(crc32c(0, &copy, sizeof copy), entries, header->section_count * sizeof (*entries));
+}
+
+/**
+ * @brief Serializes every registered section into path, atomically
+ * replacing any previous snapshot.
+ */
+bool snapshot_save(const char *path)
+{
+    static const unsigned char padding[8] = { 0 };
+    struct snapshot_section_entry entries[SNAPSHOT_SECTION_COUNT];
+    snapshot_writer_t payload = { 0 };
+    uint64_t started_at = get_monotonic_time_ns();
+    size_t offset = sizeof (struct snapshot_header) + sizeof entries;
+    char *temporary_path = NULL;
+    bool ret = false;
+
+    for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; i++)
+    {
+        size_t start = payload.length;
+
+        snapshot_sections[i].save(&payload);
+
+        entries[i] = (struct snapshot_section_entry) {
+            .id = snapshot_sections[i].id,
+            .version = snapshot_sections[i].version,
+            .offset = offset + start,
+            .length = payload.length - start,
+            .checksum = crc32c(0, payload.data + start, payload.length - start),
+        };
+
+        snapshot_write(&payload, padding, SNAPSHOT_ALIGN_UP(payload.length) - payload.length);
+    }
+
+    struct snapshot_header header = {
+        .magic = SNAPSHOT_MAGIC,
+        .version = SNAPSHOT_VERSION,
+        .section_count = SNAPSHOT_SECTION_COUNT,
+        .saved_at_ms = snapshot_now_ms(),
+        .file_size = offset + payload.length,
+    };
+
+    header.checksum = snapshot_header_checksum(&header, entries);
+
+    if (asprintf(&temporary_path, "%s.tmp", path) < 0)
+        goto end;
+
+    FILE *file = fopen(temporary_path, "wb");
+
+    if (file == NULL)
+        goto end;
+
+    bool written = fwrite(&header, sizeof header, 1, file) == 1 && fwrite(entries, sizeof entries, 1, file) == 1 &&
+                   (payload.length == 0 || fwrite(payload.data, payload.length, 1, file) == 1) &&
+                   fflush(file) == 0 && fdatasync(fileno(file)) == 0;
+
+    if (fclose(file) != 0 || !written || rename(temporary_path, path) != 0)
+    {
+        unlink(temporary_path);
+        goto end;
+    }
+
+    ret = true;
+    log_info("snapshot: saved %lu byte(s) to %s in %lu us", header.file_size, path,
+             (get_monotonic_time_ns() - started_at) / 1000);
+
+end:
+    if (!ret)
+        log_error("snapshot: failed to save %s: %s", path, get_last_error());
+
+    free(temporary_path);
+    free(payload.data);
+    return ret;
+}
+
+static const snapshot_section_t *snapshot_section_find(uint32_t id)
+{
+    for (size_t i = 0; i < SNAPSHOT_SECTION_COUNT; i++)
+    {
+        if ((uint32_t) snapshot_sections[i].id == id)
+            return &snapshot_sections[i];
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Maps a snapshot and hands every valid section to its subsystem.
+ * Damaged, stale or unknown sections are skipped; the subsystem then starts
+ * cold as if no snapshot existed.
+ */
+bool snapshot_load(const char *path)
+{
+    struct stat st;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    uint64_t started_at = get_monotonic_time_ns();
+
+    if (fd < 0)
+        return false;
+
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof (struct snapshot_header))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = (size_t) st.st_size;
+    const unsigned char *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (map == MAP_FAILED)
+        return false;
+
+    const struct snapshot_header *header = (const struct snapshot_header *) map;
+    const struct snapshot_section_entry *entries = (const struct snapshot_section_entry *) (header + 1);
+    uint64_t now = snapshot_now_ms();
+    size_t loaded = 0;
+    bool valid = header->magic == SNAPSHOT_MAGIC && header->version == SNAPSHOT_VERSION &&
+                 header->file_size == size &&
+                 sizeof (*header) + (uint64_t) header->section_count * sizeof (*entries) <= size &&
+                 header->checksum == snapshot_header_checksum(header, entries);
+
+    if (!valid)
+    {
+        log_warn("snapshot: %s is damaged or from another version; starting cold", path);
+        munmap((void *) map, size);
+        return false;
+    }
+
+    if (now < header->saved_at_ms || now - header->saved_at_ms > SNAPSHOT_MAX_AGE_MS)
+    {
+        log_warn("snapshot: %s is stale; starting cold", path);
+        munmap((void *) map, size);
+        return false;
+    }
+
+    snapshot_info_t info = { .saved_at_ms = header->saved_at_ms, .elapsed_ms = now - header->saved_at_ms };
+
+    for (uint32_t i = 0; i < header->section_count; i++)
+    {
+        const struct snapshot_section_entry *entry = &entries[i];
+        const snapshot_section_t *section = snapshot_section_find(entry->id);
+
+        if (section == NULL || entry->version > section->version)
+            continue;
+
+        if (entry->offset > size || entry->length > size - entry->offset ||
+            crc32c(0, map + entry->offset, entry->length) != entry->checksum)
+        {
+            log_warn("snapshot: section %s is damaged; skipping", section->name);
+            continue;
+        }
+
+        info.version = entry->version;
+
+        if (section->load(map + entry->offset, entry->length, &info))
+            loaded++;
+        else
+            log_warn("snapshot: section %s was rejected", section->name);
+    }
+
+    munmap((void *) map, size);
+    log_info("snapshot: restored %zu section(s) from %s in %lu us (saved %lu ms ago)", loaded, path,
+             (get_monotonic_time_ns() - started_at) / 1000, info.elapsed_ms);
+    return loaded > 0;
+}
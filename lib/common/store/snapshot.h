@@ -0,0 +1,73 @@
+#ifndef SUDOBOT_STORE_SNAPSHOT_H
+#define SUDOBOT_STORE_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define SNAPSHOT_MAGIC 0x5342534E /* "SBSN" */
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_MAX_AGE_MS (10ULL * 60 * 1000)
+
+typedef enum snapshot_section_id
+{
+    SNAPSHOT_SECTION_REST_BUCKETS = 1,
+    SNAPSHOT_SECTION_MESSAGE_CACHE = 2,
+    SNAPSHOT_SECTION_PERMISSIONS = 3,
+} snapshot_section_id_t;
+
+/*
+ * File layout: header, section table, then 8-byte aligned section payloads.
+ * The header checksum covers the header and the section table; each
+ * section carries its own payload checksum.
+ */
+struct snapshot_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t section_count;
+    uint32_t checksum;
+    uint64_t saved_at_ms;
+    uint64_t file_size;
+};
+
+struct snapshot_section_entry
+{
+    uint32_t id;
+    uint32_t version;
+    uint64_t offset;
+    uint64_t length;
+    uint32_t checksum;
+    uint32_t reserved;
+};
+
+typedef struct snapshot_writer
+{
+    unsigned char *data;
+    size_t length;
+    size_t capacity;
+} snapshot_writer_t;
+
+typedef struct snapshot_info
+{
+    uint32_t version;
+    uint64_t saved_at_ms;
+    /* Wall-clock time between the save and this load. */
+    uint64_t elapsed_ms;
+} snapshot_info_t;
+
+typedef struct snapshot_section
+{
+    snapshot_section_id_t id;
+    uint32_t version;
+    const char *name;
+    void (*save)(snapshot_writer_t *writer);
+    /* data points into the read-only mapping and is only valid during the call. */
+    bool (*load)(const void *data, size_t length, const snapshot_info_t *info);
+} snapshot_section_t;
+
+void snapshot_write(snapshot_writer_t *writer, const void *data, size_t length);
+bool snapshot_save(const char *path);
+bool snapshot_load(const char *path);
+
+#endif /* SUDOBOT_STORE_SNAPSHOT_H */
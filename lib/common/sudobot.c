@@ -5,6 +5,10 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <signal.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
 #include <concord/discord.h>
 #include "io/log.h"
 #include "env.h"
@@ -12,12 +16,62 @@
 #include "events/on_ready.h"
 #include "events/on_message.h"
 #include "events/on_interaction.h"
+#include "events/on_dispatch.h"
+#include "events/on_guild.h"
+#include "events/on_cycle.h"
+#include "events/event_filter.h"
 #include "utils/strutils.h"
 #include "core/command.h"
 #include "utils/utils.h"
+#include "utils/xmalloc.h"
+#include "gateway/shard.h"
+#include "gateway/session.h"
+#include "gateway/recorder.h"
+#include "rest/scheduler.h"
+#include "rest/audit_log.h"
+#include "pipeline/pipeline.h"
+#include "automod/automod.h"
+#include "ipc/event_bridge.h"
+#include "store/infractions.h"
+#include "cache/message_cache.h"
+#include "cache/member_table.h"
+#include "media/image_filter.h"
+#include "security/permissions.h"
+#include "timers/timers.h"
+#include "store/snapshot.h"
+#include "metrics/server.h"
+#include "flags.h"
 #include "sudobot.h"
 
 #define ENV_BOT_TOKEN "TOKEN"
+#define ENV_SHARD_COUNT "SHARD_COUNT"
+#define ENV_SHARD_IDENTIFY_CONCURRENCY "SHARD_IDENTIFY_CONCURRENCY"
+#define ENV_EVENT_PIPELINE "EVENT_PIPELINE"
+#define ENV_EVENT_FILTER "EVENT_FILTER"
+#define ENV_AUTOMOD_DELETE "AUTOMOD_DELETE"
+#define ENV_INFRACTION_STORE_PATH "INFRACTION_STORE_PATH"
+#define ENV_INFRACTION_COMPACT_INTERVAL "INFRACTION_COMPACT_INTERVAL"
+#define ENV_MESSAGE_CACHE_BYTES "MESSAGE_CACHE_BYTES"
+#define ENV_MESSAGE_CACHE_GUILD_BYTES "MESSAGE_CACHE_GUILD_BYTES"
+#define ENV_MESSAGE_CACHE_CHANNEL_BYTES "MESSAGE_CACHE_CHANNEL_BYTES"
+#define ENV_MESSAGE_CACHE_CHANNEL_MESSAGES "MESSAGE_CACHE_CHANNEL_MESSAGES"
+#define ENV_GATEWAY_RECORD_PATH "GATEWAY_RECORD_PATH"
+#define ENV_PERMISSION_ENGINE "PERMISSION_ENGINE"
+#define ENV_PERMISSION_MEMO_SLOTS "PERMISSION_MEMO_SLOTS"
+#define ENV_MEMBER_TABLE "MEMBER_TABLE"
+#define ENV_IMAGE_FILTER "IMAGE_FILTER"
+#define ENV_IMAGE_FILTER_CACHE_ENTRIES "IMAGE_FILTER_CACHE_ENTRIES"
+#define ENV_IMAGE_FILTER_PHASH_DISTANCE "IMAGE_FILTER_PHASH_DISTANCE"
+#define ENV_IMAGE_FILTER_DHASH_DISTANCE "IMAGE_FILTER_DHASH_DISTANCE"
+#define ENV_AUDIT_LOG "AUDIT_LOG"
+#define ENV_AUDIT_LOG_FLUSH_DELAY_MS "AUDIT_LOG_FLUSH_DELAY_MS"
+#define ENV_AUDIT_LOG_CHANNEL_LIMIT "AUDIT_LOG_CHANNEL_LIMIT"
+#define ENV_AUDIT_LOG_OVERFLOW_PATH "AUDIT_LOG_OVERFLOW_PATH"
+#define ENV_TIMER_TICK_MS "TIMER_TICK_MS"
+#define ENV_TIMER_JOURNAL_PATH "TIMER_JOURNAL_PATH"
+#define ENV_METRICS_LISTEN "METRICS_LISTEN"
+#define ENV_SNAPSHOT_PATH "SNAPSHOT_PATH"
+#define ENV_GATEWAY_STATE_PATH "GATEWAY_STATE_PATH"
 
 static const uint64_t INTENTS = DISCORD_GATEWAY_GUILD_MESSAGES |
                                 DISCORD_GATEWAY_GUILD_MEMBERS |
@@ -26,23 +80,219 @@ static const uint64_t INTENTS = DISCORD_GATEWAY_GUILD_MESSAGES |
 
 struct discord *client;
 env_t *env = { 0 };
+static shard_runtime_t *shards = NULL;
+static int shutdown_fd = -1;
+static volatile sig_atomic_t sigterm_count = 0;
+
+static const char *sudobot_env_get(const char *name)
+{
+    return env != NULL ? env_get(env, name) : getenv(name);
+}
+
+/*
+ * Releases everything the bot owns. Safe to call more than once, and from
+ * the embedded runtime as well as the atexit path.
+ */
+void sudobot_shutdown()
+{
+    /* The shards feed the event bridge and the pipeline, so they stop first. */
+    if (shards != NULL)
+        shard_runtime_stop(shards);
+
+    if (event_bridge != NULL)
+    {
+        event_bridge_free(event_bridge);
+        event_bridge = NULL;
+    }
+
+    if (pipeline != NULL)
+    {
+        pipeline_free(pipeline);
+        pipeline = NULL;
+    }
+
+    if (shards != NULL)
+    {
+        shard_runtime_free(shards);
+        shards = NULL;
+    }
+    else if (client != NULL)
+    {
+        discord_cleanup(client);
+    }
+
+    client = NULL;
+
+    if (metrics_server != NULL)
+    {
+        metrics_server_stop(metrics_server);
+        metrics_server = NULL;
+    }
+
+    if (gateway_recorder != NULL)
+    {
+        gateway_recorder_close(gateway_recorder);
+        gateway_recorder = NULL;
+    }
+
+    if (infraction_store != NULL)
+    {
+        infraction_store_close(infraction_store);
+        infraction_store = NULL;
+    }
+
+    if (message_cache != NULL)
+    {
+        message_cache_free(message_cache);
+        message_cache = NULL;
+    }
+
+    if (permissions != NULL)
+    {
+        permissions_free(permissions);
+        permissions = NULL;
+    }
+
+    if (member_table != NULL)
+    {
+        member_table_free(member_table);
+        member_table = NULL;
+    }
+
+    if (image_filter != NULL)
+    {
+        image_filter_free(image_filter);
+        image_filter = NULL;
+    }
+
+    if (timers != NULL)
+    {
+        timers_free(timers);
+        timers = NULL;
+    }
+
+    if (rest_scheduler != NULL)
+    {
+        rest_scheduler_free(rest_scheduler);
+        rest_scheduler = NULL;
+    }
+
+    /* After the scheduler, since messages failing during its shutdown still report back. */
+    if (audit_log != NULL)
+    {
+        audit_log_free(audit_log);
+        audit_log = NULL;
+    }
+
+    if (env != NULL)
+    {
+        env_free(env);
+        env = NULL;
+    }
+}
 
 void sudobot_atexit()
 {
-    discord_cleanup(client);
-    env_free(env);
+    sudobot_shutdown();
 }
 
+/*
+ * Only async-signal-safe work happens here: the shutdown thread is woken
+ * and does the rest. A second SIGTERM exits immediately.
+ */
 void sudobot_sigterm_handler()
 {
+    int saved_errno = errno;
+    uint64_t one = 1;
+
+    if (++sigterm_count > 1 || write(shutdown_fd, &one, sizeof one) != sizeof one)
+        _exit(EXIT_FAILURE);
+
+    errno = saved_errno;
+}
+
+static bool sudobot_has_gateway_state_path()
+{
+    const char *path = sudobot_env_get(ENV_GATEWAY_STATE_PATH);
+    return path != NULL && *path != 0;
+}
+
+/*
+ * Persists the gateway sessions for the next process to resume, then closes
+ * the connections without invalidating them. Returns false if nothing was
+ * closed, in which case the caller still has to shut the clients down.
+ */
+static bool sudobot_save_gateway_sessions()
+{
+    if (!sudobot_has_gateway_state_path() || client == NULL)
+        return false;
+
+    size_t count = shards != NULL ? shards->count : 1;
+    struct discord **clients = xcalloc(count, sizeof (*clients));
+
+    for (size_t i = 0; i < count; i++)
+        clients[i] = shards != NULL ? shards->shards[i].client : client;
+
+    gateway_session_save(sudobot_env_get(ENV_GATEWAY_STATE_PATH), clients, count);
+
+    for (size_t i = 0; i < count; i++)
+        gateway_session_shutdown(clients[i]);
+
+    free(clients);
+    return true;
+}
+
+static void *sudobot_shutdown_thread(void *data)
+{
+    sigset_t signals;
+    uint64_t value;
+
+    (void) data;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    while (read(shutdown_fd, &value, sizeof value) < 0 && errno == EINTR)
+        ;
+
     log_info("SIGTERM received. Exiting");
-    exit(EXIT_SUCCESS);
+
+    const char *snapshot_path = sudobot_env_get(ENV_SNAPSHOT_PATH);
+
+    if (snapshot_path != NULL && *snapshot_path != 0)
+        snapshot_save(snapshot_path);
+
+    /*
+     * Once the sessions are saved, every discord_run() returns on its own; a
+     * discord_shutdown() on top would end the sessions the next process is
+     * meant to resume.
+     */
+    if (sudobot_save_gateway_sessions())
+        return NULL;
+
+    if (shards != NULL)
+        shard_runtime_request_stop(shards);
+    else if (client != NULL)
+        discord_shutdown(client);
+
+    return NULL;
 }
 
 void sudobot_setup_signal_handlers()
 {
     struct sigaction act = {0};
+    pthread_t thread;
+
     act.sa_handler = &sudobot_sigterm_handler;
+    shutdown_fd = eventfd(0, EFD_CLOEXEC);
+
+    if (shutdown_fd < 0 || pthread_create(&thread, NULL, &sudobot_shutdown_thread, NULL) != 0)
+    {
+        log_error("Failed to start the shutdown thread: %s", get_last_error());
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_detach(thread);
 
     if (sigaction(SIGTERM, &act, NULL) != 0)
     {
@@ -51,18 +301,204 @@ void sudobot_setup_signal_handlers()
     }
 }
 
-bool sudobot_start_with_token(const char *token)
+static void sudobot_setup_client(struct discord *client)
+{
+    discord_add_intents(client, INTENTS);
+    discord_set_on_interaction_create(client, &on_interaction_create);
+    discord_set_on_message_create(client, &on_message);
+    discord_set_on_ready(client, &on_ready);
+    discord_set_on_cycle(client, &on_cycle);
+    discord_set_event_scheduler(client, &on_dispatch);
+
+    if (permissions != NULL || member_table != NULL)
+    {
+        discord_set_on_guild_member_add(client, &on_guild_member_add);
+        discord_set_on_guild_member_update(client, &on_guild_member_update);
+        discord_set_on_guild_member_remove(client, &on_guild_member_remove);
+        discord_set_on_guild_members_chunk(client, &on_guild_members_chunk);
+        discord_set_on_guild_create(client, &on_guild_create);
+    }
+
+    if (permissions != NULL)
+    {
+        discord_set_on_guild_update(client, &on_guild_update);
+        discord_set_on_guild_role_create(client, &on_guild_role_create);
+        discord_set_on_guild_role_update(client, &on_guild_role_update);
+        discord_set_on_guild_role_delete(client, &on_guild_role_delete);
+        discord_set_on_channel_create(client, &on_channel_update);
+        discord_set_on_channel_update(client, &on_channel_update);
+        discord_set_on_channel_delete(client, &on_channel_delete);
+    }
+
+    shard_t *shard = shard_from_client(client);
+    gateway_session_restore(client, shard != NULL ? shard->id : 0, shard != NULL ? shard->runtime->count : 1);
+}
+
+static bool sudobot_start_sharded(const char *token, size_t shard_count)
+{
+    size_t identify_concurrency = env_get_size(env, ENV_SHARD_IDENTIFY_CONCURRENCY, 1);
+
+    log_info("Attempting to boot with %zu shards (identify concurrency %zu)...", shard_count, identify_concurrency);
+
+    shards = shard_runtime_init(token, shard_count, identify_concurrency, &sudobot_setup_client);
+
+    if (shards == NULL)
+    {
+        sudobot_shutdown();
+        return false;
+    }
+
+    client = shards->shards[0].client;
+    atexit(&sudobot_atexit);
+
+    if (event_bridge != NULL)
+        event_bridge_start_actions(event_bridge, client);
+
+    sudobot_setup_signal_handlers();
+
+    return shard_runtime_run(shards);
+}
+
+static void sudobot_init_subsystems()
+{
+    rest_scheduler = rest_scheduler_init(&rest_concord_transport);
+
+    if (env_get_size(env, ENV_AUDIT_LOG, 0) != 0 && audit_log == NULL)
+    {
+        audit_log_config_t config = {
+            .flush_delay_ms = env_get_size(env, ENV_AUDIT_LOG_FLUSH_DELAY_MS, AUDIT_LOG_DEFAULT_FLUSH_DELAY_MS),
+            .channel_limit = env_get_size(env, ENV_AUDIT_LOG_CHANNEL_LIMIT, AUDIT_LOG_DEFAULT_CHANNEL_LIMIT),
+            .overflow_path = sudobot_env_get(ENV_AUDIT_LOG_OVERFLOW_PATH),
+        };
+
+        audit_log = audit_log_init(&config);
+    }
+
+    if (env_get_size(env, ENV_EVENT_PIPELINE, 0) != 0)
+        pipeline = pipeline_init();
+
+    size_t filter_mode = env_get_size(env, ENV_EVENT_FILTER, EVENT_FILTER_OFF);
+
+    if (filter_mode > EVENT_FILTER_COMMANDS)
+        log_warn("Ignoring unknown %s mode %zu", ENV_EVENT_FILTER, filter_mode);
+    else
+        event_filter_mode = (event_filter_mode_t) filter_mode;
+
+    /* A mask of automod_verdict_flags, such as 48 for attachment and mention floods. */
+    automod_delete_verdicts = (uint32_t) env_get_size(env, ENV_AUTOMOD_DELETE, 0);
+
+    const char *store_path = sudobot_env_get(ENV_INFRACTION_STORE_PATH);
+
+    if (store_path != NULL && *store_path != 0 && infraction_store == NULL)
+    {
+        infraction_store = infraction_store_open(store_path);
+
+        if (infraction_store != NULL)
+            infraction_store_start_compactor(infraction_store,
+                                             env_get_size(env, ENV_INFRACTION_COMPACT_INTERVAL,
+                                                          INFRACTION_COMPACT_INTERVAL_S));
+    }
+
+    size_t message_cache_bytes = env_get_size(env, ENV_MESSAGE_CACHE_BYTES, 0);
+
+    if (message_cache_bytes != 0 && message_cache == NULL)
+    {
+        message_cache_config_t config = {
+            .total_bytes = message_cache_bytes,
+            .guild_bytes = env_get_size(env, ENV_MESSAGE_CACHE_GUILD_BYTES, MESSAGE_CACHE_DEFAULT_GUILD_BYTES),
+            .channel_bytes = env_get_size(env, ENV_MESSAGE_CACHE_CHANNEL_BYTES, MESSAGE_CACHE_DEFAULT_CHANNEL_BYTES),
+            .channel_messages =
+                env_get_size(env, ENV_MESSAGE_CACHE_CHANNEL_MESSAGES, MESSAGE_CACHE_DEFAULT_CHANNEL_MESSAGES),
+        };
+
+        message_cache = message_cache_init(&config);
+    }
+
+    if (env_get_size(env, ENV_PERMISSION_ENGINE, 0) != 0 && permissions == NULL)
+        permissions = permissions_init(env_get_size(env, ENV_PERMISSION_MEMO_SLOTS, PERMISSIONS_DEFAULT_MEMO_SLOTS));
+
+    if (env_get_size(env, ENV_MEMBER_TABLE, 0) != 0 && member_table == NULL)
+        member_table = member_table_init();
+
+    if (env_get_size(env, ENV_IMAGE_FILTER, 0) != 0 && image_filter == NULL)
+    {
+        image_filter_config_t config = {
+            .cache_entries = env_get_size(env, ENV_IMAGE_FILTER_CACHE_ENTRIES, IMAGE_FILTER_DEFAULT_CACHE_ENTRIES),
+            .phash_distance =
+                (uint32_t) env_get_size(env, ENV_IMAGE_FILTER_PHASH_DISTANCE, IMAGE_FILTER_DEFAULT_PHASH_DISTANCE),
+            .dhash_distance =
+                (uint32_t) env_get_size(env, ENV_IMAGE_FILTER_DHASH_DISTANCE, IMAGE_FILTER_DEFAULT_DHASH_DISTANCE),
+        };
+
+        image_filter = image_filter_init(&config);
+    }
+
+    if (timers == NULL)
+        timers = timers_init(env_get_size(env, ENV_TIMER_TICK_MS, TIMER_WHEEL_DEFAULT_TICK_MS),
+                             sudobot_env_get(ENV_TIMER_JOURNAL_PATH));
+
+    const char *metrics_address = sudobot_env_get(ENV_METRICS_LISTEN);
+
+    if (metrics_address != NULL && *metrics_address != 0 && metrics_server == NULL)
+        metrics_server = metrics_server_start(metrics_address);
+
+    const char *record_path = sudobot_env_get(ENV_GATEWAY_RECORD_PATH);
+
+    if (record_path != NULL && *record_path != 0 && gateway_recorder == NULL)
+        gateway_recorder = gateway_recorder_open(record_path);
+
+    const char *snapshot_path = sudobot_env_get(ENV_SNAPSHOT_PATH);
+
+    if (snapshot_path != NULL && *snapshot_path != 0)
+        snapshot_load(snapshot_path);
+}
+
+/*
+ * Creates the client and every subsystem around it, without connecting.
+ * Used directly by the embedded runtime, which drives the event loop itself.
+ */
+struct discord *sudobot_prepare(const char *token)
 {
     assert(token != NULL && "Token must not be null");
+
+    sudobot_init_subsystems();
     client = discord_init(token);
+
+    if (client == NULL)
+    {
+        sudobot_shutdown();
+        return NULL;
+    }
+
+    if (event_bridge != NULL)
+        event_bridge_start_actions(event_bridge, client);
+
+    sudobot_setup_client(client);
+    return client;
+}
+
+bool sudobot_start_with_token(const char *token)
+{
+    assert(token != NULL && "Token must not be null");
+
+    size_t shard_count = opt_shard_count != 0 ? opt_shard_count : env_get_size(env, ENV_SHARD_COUNT, 1);
+
+    if (sudobot_has_gateway_state_path())
+        gateway_session_load(sudobot_env_get(ENV_GATEWAY_STATE_PATH));
+
+    if (shard_count > 1)
+    {
+        sudobot_init_subsystems();
+        return sudobot_start_sharded(token, shard_count);
+    }
+
+    if (sudobot_prepare(token) == NULL)
+        return false;
+
     atexit(&sudobot_atexit);
     sudobot_setup_signal_handlers();
 
     log_info("Attempting to boot...");
-    discord_add_intents(client, INTENTS);
-    discord_set_on_interaction_create(client, &on_interaction_create);
-    discord_set_on_message_create(client, &on_message);
-    discord_set_on_ready(client, &on_ready);
     discord_run(client);
 
     return true;
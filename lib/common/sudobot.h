@@ -11,6 +11,8 @@
 
 bool sudobot_start_with_token(const char *token);
 bool sudobot_start();
+struct discord *sudobot_prepare(const char *token);
+void sudobot_shutdown();
 
 extern struct discord *client;
 extern env_t *env;
@@ -0,0 +1,282 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "journal.h"
+#include "../io/log.h"
+#include "../utils/crc32.h"
+#include "../utils/utils.h"
+#include "../utils/xmalloc.h"
+
+#define TIMER_JOURNAL_CHECKSUM_START offsetof(struct timer_journal_record, kind)
+#define TIMER_JOURNAL_BATCH 1024
+
+static uint32_t timer_journal_checksum(const struct timer_journal_record *record)
+{
+    return crc32c(0, (const unsigned char *) record + TIMER_JOURNAL_CHECKSUM_START,
+                  sizeof (*record) - TIMER_JOURNAL_CHECKSUM_START);
+}
+
+static bool timer_journal_record_valid(const struct timer_journal_record *record)
+{
+    return record->kind >= TIMER_JOURNAL_SCHEDULE && record->kind <= TIMER_JOURNAL_DONE &&
+           record->checksum == timer_journal_checksum(record);
+}
+
+static bool timer_journal_write_all(int fd, const void *data, size_t size)
+{
+    const char *cursor = data;
+
+    while (size > 0)
+    {
+        ssize_t written = write(fd, cursor, size);
+
+        if (written < 0 && errno == EINTR)
+            continue;
+
+        if (written <= 0)
+            return false;
+
+        cursor += written;
+        size -= (size_t) written;
+    }
+
+    return true;
+}
+
+/* Reads the records after the header and stops at the first torn or corrupt one. */
+static bool timer_journal_replay(timer_journal_t *journal, timer_journal_replay_t replay, void *data)
+{
+    struct timer_journal_record *records = xmalloc(sizeof (*records) * TIMER_JOURNAL_BATCH);
+    uint64_t offset = sizeof (struct timer_journal_header);
+    bool corrupt = false;
+
+    while (!corrupt && offset < journal->size)
+    {
+        ssize_t length = pread(journal->fd, records, sizeof (*records) * TIMER_JOURNAL_BATCH, (off_t) offset);
+
+        if (length < 0 && errno == EINTR)
+            continue;
+
+        if (length < 0)
+        {
+            log_error("timers: failed to read %s: %s", journal->path, get_last_error());
+            free(records);
+            return false;
+        }
+
+        size_t count = (size_t) length / sizeof (*records);
+
+        corrupt = count == 0;
+
+        for (size_t i = 0; i < count; i++)
+        {
+            if (!timer_journal_record_valid(&records[i]))
+            {
+                corrupt = true;
+                break;
+            }
+
+            if (records[i].job.id >= journal->next_id)
+                journal->next_id = records[i].job.id + 1;
+
+            replay(data, records[i].kind, &records[i].job);
+            journal->records++;
+            offset += sizeof (*records);
+        }
+    }
+
+    free(records);
+
+    if (offset < journal->size)
+    {
+        log_warn("timers: dropping %lu byte(s) of torn or corrupt records at the end of %s", journal->size - offset,
+                 journal->path);
+
+        if (ftruncate(journal->fd, (off_t) offset) != 0)
+            return false;
+
+        journal->size = offset;
+    }
+
+    return true;
+}
+
+timer_journal_t *timer_journal_open(const char *path, timer_journal_replay_t replay, void *data)
+{
+    timer_journal_t *journal = xcalloc(1, sizeof (*journal));
+    struct timer_journal_header header = { 0 };
+    struct stat st;
+
+    journal->path = strdup(path);
+    journal->next_id = 1;
+    journal->fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+    if (journal->fd < 0 || fstat(journal->fd, &st) != 0)
+    {
+        log_error("timers: failed to open %s: %s", path, get_last_error());
+        timer_journal_close(journal);
+        return NULL;
+    }
+
+    journal->size = (uint64_t) st.st_size;
+
+    if (journal->size < sizeof header)
+    {
+        header.magic = TIMER_JOURNAL_MAGIC;
+        header.version = TIMER_JOURNAL_VERSION;
+        header.next_id = journal->next_id;
+
+        if (ftruncate(journal->fd, 0) != 0 || !timer_journal_write_all(journal->fd, &header, sizeof header))
+        {
+            log_error("timers: failed to initialize %s: %s", path, get_last_error());
+            timer_journal_close(journal);
+            return NULL;
+        }
+
+        journal->size = sizeof header;
+    }
+    else if (pread(journal->fd, &header, sizeof header, 0) != sizeof header || header.magic != TIMER_JOURNAL_MAGIC ||
+             header.version != TIMER_JOURNAL_VERSION)
+    {
+        log_error("timers: %s is not a timer journal (or has an unsupported version)", path);
+        timer_journal_close(journal);
+        return NULL;
+    }
+    else
+    {
+        journal->next_id = header.next_id > 0 ? header.next_id : 1;
+
+        if (!timer_journal_replay(journal, replay, data))
+        {
+            timer_journal_close(journal);
+            return NULL;
+        }
+    }
+
+    if (fcntl(journal->fd, F_SETFL, O_APPEND) != 0)
+    {
+        timer_journal_close(journal);
+        return NULL;
+    }
+
+    return journal;
+}
+
+void timer_journal_close(timer_journal_t *journal)
+{
+    if (journal == NULL)
+        return;
+
+    if (journal->fd >= 0)
+    {
+        fdatasync(journal->fd);
+        close(journal->fd);
+    }
+
+    free(journal->path);
+    free(journal);
+}
+
+bool timer_journal_append(timer_journal_t *journal, uint32_t kind, const timer_job_t *job)
+{
+    struct timer_journal_record record = { .kind = kind, .job = *job };
+
+    record.checksum = timer_journal_checksum(&record);
+
+    if (!timer_journal_write_all(journal->fd, &record, sizeof record))
+    {
+        log_error("timers: failed to append to %s: %s", journal->path, get_last_error());
+
+        /* Drop a partial record so later appends stay readable. */
+        if (ftruncate(journal->fd, (off_t) journal->size) != 0)
+            log_error("timers: failed to truncate %s: %s", journal->path, get_last_error());
+
+        return false;
+    }
+
+    journal->size += sizeof record;
+    journal->records++;
+    return true;
+}
+
+/*
+ * Replaces the journal with one SCHEDULE record per live job, written to a
+ * temporary file and renamed over the old one.
+ */
+bool timer_journal_rewrite(timer_journal_t *journal, const timer_job_t *jobs, size_t count, uint64_t next_id)
+{
+    struct timer_journal_header header = {
+        .magic = TIMER_JOURNAL_MAGIC,
+        .version = TIMER_JOURNAL_VERSION,
+        .next_id = next_id,
+    };
+    struct timer_journal_record *records = xmalloc(sizeof (*records) * TIMER_JOURNAL_BATCH);
+    char *path = NULL;
+    bool ret = false;
+    int fd = -1;
+
+    if (asprintf(&path, "%s.compact", journal->path) < 0)
+    {
+        path = NULL;
+        goto end;
+    }
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+
+    if (fd < 0 || !timer_journal_write_all(fd, &header, sizeof header))
+        goto end;
+
+    for (size_t i = 0; i < count; i += TIMER_JOURNAL_BATCH)
+    {
+        size_t batch = count - i < TIMER_JOURNAL_BATCH ? count - i : TIMER_JOURNAL_BATCH;
+
+        for (size_t j = 0; j < batch; j++)
+        {
+            records[j] = (struct timer_journal_record) { .kind = TIMER_JOURNAL_SCHEDULE, .job = jobs[i + j] };
+            records[j].checksum = timer_journal_checksum(&records[j]);
+        }
+
+        if (!timer_journal_write_all(fd, records, sizeof (*records) * batch))
+            goto end;
+    }
+
+    if (fdatasync(fd) != 0 || rename(path, journal->path) != 0)
+        goto end;
+
+    close(journal->fd);
+    journal->fd = fd;
+    fd = -1;
+
+    if (fcntl(journal->fd, F_SETFL, O_APPEND) != 0)
+    {
+        log_fatal("timers: failed to reopen %s after compaction: %s", journal->path, get_last_error());
+        abort();
+    }
+
+    journal->size = sizeof header + sizeof (*records) * count;
+    journal->records = count;
+    journal->next_id = next_id;
+    ret = true;
+
+end:
+    if (!ret)
+    {
+        log_error("timers: failed to compact %s: %s", journal->path, get_last_error());
+
+        if (path != NULL)
+            unlink(path);
+    }
+
+    if (fd >= 0)
+        close(fd);
+
+    free(path);
+    free(records);
+    return ret;
+}
@@ -0,0 +1,74 @@
+#ifndef SUDOBOT_TIMERS_JOURNAL_H
+#define SUDOBOT_TIMERS_JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define TIMER_JOURNAL_MAGIC 0x5342544A /* "SBTJ" */
+#define TIMER_JOURNAL_VERSION 1
+
+typedef enum timer_job_type
+{
+    TIMER_JOB_UNMUTE = 1,
+    TIMER_JOB_UNBAN,
+    TIMER_JOB_REMOVE_ROLE,
+    TIMER_JOB_REMINDER,
+    TIMER_JOB_OTHER,
+} timer_job_type_t;
+
+/* A scheduled moderation job; the layout is shared with the TS side. */
+typedef struct timer_job
+{
+    uint64_t id;
+    uint64_t guild_id;
+    uint64_t user_id;
+    /* Job-specific: the role to remove, the channel to remind in, ... */
+    uint64_t data;
+    uint64_t due_at_ms;
+    uint32_t type;
+    uint32_t reserved;
+} timer_job_t;
+
+enum timer_journal_kind
+{
+    TIMER_JOURNAL_SCHEDULE = 1,
+    TIMER_JOURNAL_CANCEL = 2,
+    /* The job fired and was handed over; only the ID is meaningful. */
+    TIMER_JOURNAL_DONE = 3,
+};
+
+struct timer_journal_header
+{
+    uint32_t magic;
+    uint32_t version;
+    /* IDs below this were handed out before the last rewrite. */
+    uint64_t next_id;
+};
+
+/* Fixed-size record; the checksum covers every byte after it. */
+struct timer_journal_record
+{
+    uint32_t checksum;
+    uint32_t kind;
+    timer_job_t job;
+};
+
+typedef struct timer_journal
+{
+    int fd;
+    char *path;
+    uint64_t size;
+    /* Records appended since the journal was last rewritten. */
+    uint64_t records;
+    uint64_t next_id;
+} timer_journal_t;
+
+typedef void (*timer_journal_replay_t)(void *data, uint32_t kind, const timer_job_t *job);
+
+timer_journal_t *timer_journal_open(const char *path, timer_journal_replay_t replay, void *data);
+void timer_journal_close(timer_journal_t *journal);
+bool timer_journal_append(timer_journal_t *journal, uint32_t kind, const timer_job_t *job);
+bool timer_journal_rewrite(timer_journal_t *journal, const timer_job_t *jobs, size_t count, uint64_t next_id);
+
+#endif /* SUDOBOT_TIMERS_JOURNAL_H */
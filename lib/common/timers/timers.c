@@ -0,0 +1,527 @@
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <time.h>
+#include "timers.h"
+#include "../io/log.h"
+#include "../utils/xmalloc.h"
+
+#define TIMERS_MAP_MIN_CAPACITY 64
+#define TIMERS_SLAB_MIN_CAPACITY 64
+#define TIMERS_NIL UINT32_MAX
+/* Set in the wheel value of cooldown timers; job timers carry a plain pending index. */
+#define TIMERS_COOLDOWN_BIT (1ULL << 63)
+
+timers_t *timers = NULL;
+
+static uint64_t timers_now_ms()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t) ts.tv_sec * 1000 + (uint64_t) ts.tv_nsec / 1000000;
+}
+
+static uint64_t timers_hash(uint64_t key)
+{
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    return key;
+}
+
+static uint64_t *timers_map_find(struct timers_map *map, uint64_t key)
+{
+    if (map->capacity == 0)
+        return NULL;
+
+    for (size_t i = timers_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+            return &map->values[i];
+
+        if (map->keys[i] == 0)
+            return NULL;
+    }
+}
+
+static void timers_map_put(struct timers_map *map, uint64_t key, uint64_t value);
+
+static void timers_map_grow(struct timers_map *map)
+{
+    struct timers_map old = *map;
+
+    map->capacity = old.capacity == 0 ? TIMERS_MAP_MIN_CAPACITY : old.capacity * 2;
+    map->keys = xcalloc(map->capacity, sizeof (*map->keys));
+    map->values = xcalloc(map->capacity, sizeof (*map->values));
+    map->length = 0;
+
+    for (size_t i = 0; i < old.capacity; i++)
+    {
+        if (old.keys[i] != 0)
+            timers_map_put(map, old.keys[i], old.values[i]);
+    }
+
+    free(old.keys);
+    free(old.values);
+}
+
+static void timers_map_put(struct timers_map *map, uint64_t key, uint64_t value)
+{
+    if ((map->length + 1) * 4 > map->capacity * 3)
+        timers_map_grow(map);
+
+    for (size_t i = timers_hash(key) & (map->capacity - 1);; i = (i + 1) & (map->capacity - 1))
+    {
+        if (map->keys[i] == key)
+        {
+            map->values[i] = value;
+            return;
+        }
+
+        if (map->keys[i] == 0)
+        {
+            map->keys[i] = key;
+            map->values[i] = value;
+            map->length++;
+            return;
+        }
+    }
+}
+
+/* Backward-shift deletion keeps probe chains intact without tombstones. */
+static void timers_map_remove(struct timers_map *map, uint64_t key)
+{
+    uint64_t *value = timers_map_find(map, key);
+
+    if (value == NULL)
+        return;
+
+    size_t mask = map->capacity - 1;
+    size_t hole = (size_t) (value - map->values);
+
+    for (size_t i = (hole + 1) & mask; map->keys[i] != 0; i = (i + 1) & mask)
+    {
+        size_t home = timers_hash(map->keys[i]) & mask;
+
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            map->keys[hole] = map->keys[i];
+            map->values[hole] = map->values[i];
+            hole = i;
+        }
+    }
+
+    map->keys[hole] = 0;
+    map->values[hole] = 0;
+    map->length--;
+}
+
+static void timers_map_free(struct timers_map *map)
+{
+    free(map->keys);
+    free(map->values);
+    memset(map, 0, sizeof (*map));
+}
+
+static uint32_t timers_pending_alloc(timers_t *timers)
+{
+    uint32_t index = timers->pending_free;
+
+    if (index != TIMERS_NIL)
+    {
+        timers->pending_free = timers->pending[index].next_free;
+        return index;
+    }
+
+    if (timers->pending_used == timers->pending_capacity)
+    {
+        timers->pending_capacity =
+            timers->pending_capacity != 0 ? timers->pending_capacity * 2 : TIMERS_SLAB_MIN_CAPACITY;
+        timers->pending = xrealloc(timers->pending, sizeof (*timers->pending) * timers->pending_capacity);
+    }
+
+    return (uint32_t) timers->pending_used++;
+}
+
+static void timers_pending_release(timers_t *timers, uint32_t index)
+{
+    timers->pending[index].job.id = 0;
+    timers->pending[index].next_free = timers->pending_free;
+    timers->pending_free = index;
+    timers->stats.jobs--;
+}
+
+static uint32_t timers_cooldown_alloc(timers_t *timers)
+{
+    uint32_t index = timers->cooldown_free;
+
+    if (index != TIMERS_NIL)
+    {
+        timers->cooldown_free = timers->cooldowns[index].next_free;
+        return index;
+    }
+
+    if (timers->cooldown_used == timers->cooldown_capacity)
+    {
+        timers->cooldown_capacity =
+            timers->cooldown_capacity != 0 ? timers->cooldown_capacity * 2 : TIMERS_SLAB_MIN_CAPACITY;
+        timers->cooldowns = xrealloc(timers->cooldowns, sizeof (*timers->cooldowns) * timers->cooldown_capacity);
+    }
+
+    return (uint32_t) timers->cooldown_used++;
+}
+
+static void timers_cooldown_release(timers_t *timers, uint32_t index)
+{
+    timers->cooldowns[index].next_free = timers->cooldown_free;
+    timers->cooldown_free = index;
+    timers->stats.cooldowns--;
+}
+
+static void timers_ready_push(timers_t *timers, const timer_job_t *job)
+{
+    if (timers->ready_count == timers->ready_capacity)
+    {
+        size_t capacity = timers->ready_capacity != 0 ? timers->ready_capacity * 2 : TIMERS_SLAB_MIN_CAPACITY;
+        timer_job_t *ready = xmalloc(sizeof (*ready) * capacity);
+
+        for (size_t i = 0; i < timers->ready_count; i++)
+            ready[i] = timers->ready[(timers->ready_head + i) & (timers->ready_capacity - 1)];
+
+        free(timers->ready);
+        timers->ready = ready;
+        timers->ready_capacity = capacity;
+        timers->ready_head = 0;
+    }
+
+    timers->ready[(timers->ready_head + timers->ready_count) & (timers->ready_capacity - 1)] = *job;
+    timers->ready_count++;
+}
+
+static void timers_expire(void *data, timer_handle_t handle, uint64_t value)
+{
+    timers_t *timers = data;
+
+    (void) handle;
+
+    if ((value & TIMERS_COOLDOWN_BIT) != 0)
+    {
+        uint32_t index = (uint32_t) (value & ~TIMERS_COOLDOWN_BIT);
+        const struct timers_cooldown *cooldown = &timers->cooldowns[index];
+
+        timers_map_remove(&timers->cooldown_index[cooldown->command], cooldown->user_id);
+        timers_cooldown_release(timers, index);
+        return;
+    }
+
+    const timer_job_t *job = &timers->pending[value].job;
+
+    timers_map_put(&timers->job_index, job->id, 0);
+    timers_ready_push(timers, job);
+    timers_pending_release(timers, (uint32_t) value);
+    timers->stats.fired++;
+}
+
+static bool timers_add_job(timers_t *timers, const timer_job_t *job)
+{
+    uint32_t index = timers_pending_alloc(timers);
+    timer_handle_t handle = timer_wheel_add(&timers->wheel, job->due_at_ms, index);
+
+    timers->pending[index].job = *job;
+    timers->stats.jobs++;
+
+    if (handle == 0)
+    {
+        timers_pending_release(timers, index);
+        return false;
+    }
+
+    timers_map_put(&timers->job_index, job->id, handle);
+    return true;
+}
+
+/* Forgets a job whether it is still on the wheel or already in the ready queue. */
+static bool timers_remove_job(timers_t *timers, uint64_t id)
+{
+    uint64_t *handle = timers_map_find(&timers->job_index, id);
+    uint64_t index;
+
+    if (handle == NULL)
+        return false;
+
+    if (*handle != 0 && timer_wheel_cancel(&timers->wheel, *handle, &index))
+        timers_pending_release(timers, (uint32_t) index);
+
+    /* Ready queue entries are skipped at poll time once their ID is gone. */
+    timers_map_remove(&timers->job_index, id);
+    return true;
+}
+
+static void timers_replay(void *data, uint32_t kind, const timer_job_t *job)
+{
+    timers_t *timers = data;
+
+    if (kind == TIMER_JOURNAL_SCHEDULE)
+        timers_add_job(timers, job);
+    else
+        timers_remove_job(timers, job->id);
+}
+
+static void timers_maybe_compact(timers_t *timers)
+{
+    if (timers->journal == NULL ||
+        timers->journal->records < TIMERS_COMPACT_MIN_RECORDS + 2 * timers->job_index.length)
+        return;
+
+    timer_job_t *jobs = xmalloc(sizeof (*jobs) * (timers->job_index.length + 1));
+    size_t count = 0;
+
+    for (size_t i = 0; i < timers->pending_used; i++)
+    {
+        if (timers->pending[i].job.id != 0)
+            jobs[count++] = timers->pending[i].job;
+    }
+
+    for (size_t i = 0; i < timers->ready_count; i++)
+    {
+        const timer_job_t *job = &timers->ready[(timers->ready_head + i) & (timers->ready_capacity - 1)];
+
+        if (timers_map_find(&timers->job_index, job->id) != NULL)
+            jobs[count++] = *job;
+    }
+
+    /* Only read by log_debug(), which NDEBUG builds compile out. */
+    size_t records = timers->journal->records;
+    (void) records;
+
+    if (timer_journal_rewrite(timers->journal, jobs, count, timers->next_id))
+        log_debug("timers: compacted the journal from %lu to %zu record(s)", records, count);
+
+    free(jobs);
+}
+
+timers_t *timers_init(uint64_t tick_ms, const char *journal_path)
+{
+    timers_t *timers = xcalloc(1, sizeof (*timers));
+
+    pthread_mutex_init(&timers->lock, NULL);
+    timer_wheel_init(&timers->wheel, tick_ms, timers_now_ms());
+    timers->next_id = 1;
+    timers->pending_free = TIMERS_NIL;
+    timers->cooldown_free = TIMERS_NIL;
+
+    if (journal_path != NULL && *journal_path != 0)
+    {
+        timers->journal = timer_journal_open(journal_path, &timers_replay, timers);
+
+        if (timers->journal == NULL)
+        {
+            timers_free(timers);
+            return NULL;
+        }
+
+        timers->next_id = timers->journal->next_id;
+        log_info("timers: restored %zu job(s) from %s", timers->job_index.length, journal_path);
+        timers_maybe_compact(timers);
+    }
+
+    return timers;
+}
+
+void timers_free(timers_t *timers)
+{
+    if (timers == NULL)
+        return;
+
+    timer_journal_close(timers->journal);
+    timer_wheel_free(&timers->wheel);
+    timers_map_free(&timers->job_index);
+
+    for (size_t i = 0; i < timers->cooldown_commands; i++)
+        timers_map_free(&timers->cooldown_index[i]);
+
+    free(timers->cooldown_index);
+    free(timers->cooldowns);
+    free(timers->pending);
+    free(timers->ready);
+    pthread_mutex_destroy(&timers->lock);
+    free(timers);
+}
+
+/* Returns the ID of the new job, or 0 if it could not be recorded. */
+uint64_t timers_schedule(timers_t *timers, const timer_job_t *job)
+{
+    timer_job_t scheduled = *job;
+
+    pthread_mutex_lock(&timers->lock);
+    scheduled.id = timers->next_id++;
+
+    if (timers->journal != NULL && !timer_journal_append(timers->journal, TIMER_JOURNAL_SCHEDULE, &scheduled))
+    {
+        pthread_mutex_unlock(&timers->lock);
+        return 0;
+    }
+
+    if (!timers_add_job(timers, &scheduled))
+    {
+        if (timers->journal != NULL)
+            timer_journal_append(timers->journal, TIMER_JOURNAL_CANCEL, &scheduled);
+
+        pthread_mutex_unlock(&timers->lock);
+        return 0;
+    }
+
+    timers->stats.scheduled++;
+    timers_maybe_compact(timers);
+    pthread_mutex_unlock(&timers->lock);
+    return scheduled.id;
+}
+
+bool timers_cancel(timers_t *timers, uint64_t id)
+{
+    timer_job_t job = { .id = id };
+
+    pthread_mutex_lock(&timers->lock);
+
+    bool ret = timers_remove_job(timers, id);
+
+    if (ret)
+    {
+        if (timers->journal != NULL)
+            timer_journal_append(timers->journal, TIMER_JOURNAL_CANCEL, &job);
+
+        timers->stats.cancelled++;
+        timers_maybe_compact(timers);
+    }
+
+    pthread_mutex_unlock(&timers->lock);
+    return ret;
+}
+
+void timers_advance(timers_t *timers)
+{
+    pthread_mutex_lock(&timers->lock);
+    timer_wheel_advance(&timers->wheel, timers_now_ms(), &timers_expire, timers);
+    pthread_mutex_unlock(&timers->lock);
+}
+
+/*
+ * Hands over up to `max` jobs that came due. A job counts as done once it
+ * is returned here; until then it is replayed (and fires again) after a
+ * restart.
+ */
+size_t timers_poll(timers_t *timers, timer_job_t *jobs, size_t max)
+{
+    size_t count = 0;
+
+    pthread_mutex_lock(&timers->lock);
+    timer_wheel_advance(&timers->wheel, timers_now_ms(), &timers_expire, timers);
+
+    while (count < max && timers->ready_count > 0)
+    {
+        const timer_job_t *job = &timers->ready[timers->ready_head];
+
+        timers->ready_head = (timers->ready_head + 1) & (timers->ready_capacity - 1);
+        timers->ready_count--;
+
+        if (timers_map_find(&timers->job_index, job->id) == NULL)
+            continue;
+
+        timers_map_remove(&timers->job_index, job->id);
+
+        if (timers->journal != NULL)
+            timer_journal_append(timers->journal, TIMER_JOURNAL_DONE, job);
+
+        jobs[count++] = *job;
+    }
+
+    if (count > 0)
+        timers_maybe_compact(timers);
+
+    pthread_mutex_unlock(&timers->lock);
+    return count;
+}
+
+/*
+ * Starts a cooldown of `cooldown_ms` for the user on the command, unless
+ * one is still running, in which case this returns false and stores how
+ * long it has left in `remaining_ms`.
+ */
+bool timers_cooldown_acquire(timers_t *timers, size_t command, uint64_t user_id, uint64_t cooldown_ms,
+                             uint64_t *remaining_ms)
+{
+    if (cooldown_ms == 0)
+        return true;
+
+    pthread_mutex_lock(&timers->lock);
+
+    uint64_t now = timers_now_ms();
+
+    timer_wheel_advance(&timers->wheel, now, &timers_expire, timers);
+
+    if (command >= timers->cooldown_commands)
+    {
+        timers->cooldown_index = xrealloc(timers->cooldown_index, sizeof (*timers->cooldown_index) * (command + 1));
+        memset(&timers->cooldown_index[timers->cooldown_commands], 0,
+               sizeof (*timers->cooldown_index) * (command + 1 - timers->cooldown_commands));
+        timers->cooldown_commands = command + 1;
+    }
+
+    struct timers_map *index = &timers->cooldown_index[command];
+    uint64_t *slot = timers_map_find(index, user_id);
+
+    if (slot != NULL)
+    {
+        struct timers_cooldown *cooldown = &timers->cooldowns[*slot];
+
+        if (cooldown->expires_at_ms > now)
+        {
+            if (remaining_ms != NULL)
+                *remaining_ms = cooldown->expires_at_ms - now;
+
+            timers->stats.cooldown_rejections++;
+            pthread_mutex_unlock(&timers->lock);
+            return false;
+        }
+
+        /* Ran out within the current tick; start it over in place. */
+        timer_wheel_cancel(&timers->wheel, cooldown->handle, NULL);
+        cooldown->expires_at_ms = now + cooldown_ms;
+        cooldown->handle = timer_wheel_add(&timers->wheel, cooldown->expires_at_ms, TIMERS_COOLDOWN_BIT | *slot);
+
+        if (cooldown->handle == 0)
+        {
+            timers_map_remove(index, user_id);
+            timers_cooldown_release(timers, (uint32_t) (cooldown - timers->cooldowns));
+        }
+
+        pthread_mutex_unlock(&timers->lock);
+        return true;
+    }
+
+    uint32_t position = timers_cooldown_alloc(timers);
+    struct timers_cooldown *cooldown = &timers->cooldowns[position];
+
+    cooldown->user_id = user_id;
+    cooldown->command = (uint32_t) command;
+    cooldown->expires_at_ms = now + cooldown_ms;
+    cooldown->handle = timer_wheel_add(&timers->wheel, cooldown->expires_at_ms, TIMERS_COOLDOWN_BIT | position);
+    timers->stats.cooldowns++;
+
+    if (cooldown->handle != 0)
+        timers_map_put(index, user_id, position);
+    else
+        timers_cooldown_release(timers, position);
+
+    pthread_mutex_unlock(&timers->lock);
+    return true;
+}
+
+void timers_get_stats(timers_t *timers, timers_stats_t *stats)
+{
+    pthread_mutex_lock(&timers->lock);
+    *stats = timers->stats;
+    stats->ready = timers->ready_count;
+    stats->journal_records = timers->journal != NULL ? timers->journal->records : 0;
+    pthread_mutex_unlock(&timers->lock);
+}
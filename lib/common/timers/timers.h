@@ -0,0 +1,99 @@
+#ifndef SUDOBOT_TIMERS_TIMERS_H
+#define SUDOBOT_TIMERS_TIMERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "wheel.h"
+#include "journal.h"
+
+/* Rewrite the journal once it holds this many records more than twice the live jobs. */
+#define TIMERS_COMPACT_MIN_RECORDS 65536
+
+struct timers_map
+{
+    uint64_t *keys;
+    uint64_t *values;
+    size_t capacity;
+    size_t length;
+};
+
+/* Slab entry of a job waiting on the wheel. */
+struct timers_pending
+{
+    timer_job_t job;
+    uint32_t next_free;
+};
+
+/* A running command cooldown; the wheel timer removes it when it runs out. */
+struct timers_cooldown
+{
+    uint64_t user_id;
+    uint64_t expires_at_ms;
+    timer_handle_t handle;
+    uint32_t command;
+    uint32_t next_free;
+};
+
+typedef struct timers_stats
+{
+    size_t jobs;
+    size_t ready;
+    size_t cooldowns;
+    uint64_t scheduled;
+    uint64_t cancelled;
+    uint64_t fired;
+    uint64_t cooldown_rejections;
+    uint64_t journal_records;
+} timers_stats_t;
+
+/*
+ * Scheduled moderation jobs and command cooldowns on one timing wheel.
+ * Jobs are journaled when a journal is open and replayed on startup; a job
+ * that comes due moves to the ready queue, where it stays (and survives a
+ * restart) until it is polled. Cooldowns are only kept in memory.
+ */
+typedef struct timers
+{
+    pthread_mutex_t lock;
+    timer_wheel_t wheel;
+    timer_journal_t *journal;
+    uint64_t next_id;
+    /* job ID -> wheel handle, or 0 once the job is in the ready queue */
+    struct timers_map job_index;
+    /* Wheel timers of jobs carry their index here. */
+    struct timers_pending *pending;
+    size_t pending_capacity;
+    size_t pending_used;
+    uint32_t pending_free;
+    /* Ring of jobs that came due and were not polled yet. */
+    timer_job_t *ready;
+    size_t ready_capacity;
+    size_t ready_head;
+    size_t ready_count;
+    /* user ID -> index into cooldowns, one map per command */
+    struct timers_map *cooldown_index;
+    size_t cooldown_commands;
+    struct timers_cooldown *cooldowns;
+    size_t cooldown_capacity;
+    size_t cooldown_used;
+    uint32_t cooldown_free;
+    timers_stats_t stats;
+} timers_t;
+
+extern timers_t *timers;
+
+timers_t *timers_init(uint64_t tick_ms, const char *journal_path);
+void timers_free(timers_t *timers);
+
+uint64_t timers_schedule(timers_t *timers, const timer_job_t *job);
+bool timers_cancel(timers_t *timers, uint64_t id);
+size_t timers_poll(timers_t *timers, timer_job_t *jobs, size_t max);
+void timers_advance(timers_t *timers);
+
+bool timers_cooldown_acquire(timers_t *timers, size_t command, uint64_t user_id, uint64_t cooldown_ms,
+                             uint64_t *remaining_ms);
+void timers_get_stats(timers_t *timers, timers_stats_t *stats);
+
+#endif /* SUDOBOT_TIMERS_TIMERS_H */
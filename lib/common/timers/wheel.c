@@ -0,0 +1,265 @@
+#include <string.h>
+#include "wheel.h"
+#include "../utils/xmalloc.h"
+
+#define TIMER_WHEEL_FREE 0xFFFF
+#define TIMER_WHEEL_MIN_CAPACITY 1024
+
+static uint32_t *timer_wheel_head(timer_wheel_t *wheel, uint16_t level, uint16_t slot)
+{
+    return level == TIMER_WHEEL_OVERFLOW ? &wheel->overflow : &wheel->heads[level][slot];
+}
+
+static timer_handle_t timer_wheel_handle(const timer_wheel_t *wheel, uint32_t index)
+{
+    return ((uint64_t) wheel->nodes[index].generation << 32) | ((uint64_t) index + 1);
+}
+
+/* Resolves a handle to its node index, or TIMER_WHEEL_NIL if it is stale. */
+static uint32_t timer_wheel_resolve(const timer_wheel_t *wheel, timer_handle_t handle)
+{
+    uint64_t index = (handle & 0xFFFFFFFF) - 1;
+
+    if (handle == 0 || index >= wheel->used)
+        return TIMER_WHEEL_NIL;
+
+    const struct timer_node *node = &wheel->nodes[index];
+
+    if (node->level == TIMER_WHEEL_FREE || node->generation != (uint32_t) (handle >> 32))
+        return TIMER_WHEEL_NIL;
+
+    return (uint32_t) index;
+}
+
+/*
+ * Files a node by how far away it is. New timers that are already due go
+ * to the next tick (earliest = tick + 1); cascading passes the current
+ * tick, whose level 0 slot is fired right after the cascade.
+ */
+static void timer_wheel_link(timer_wheel_t *wheel, uint32_t index, uint64_t earliest)
+{
+    struct timer_node *node = &wheel->nodes[index];
+    uint64_t expires_at = node->expires_at > earliest ? node->expires_at : earliest;
+    uint64_t delta = expires_at - wheel->tick;
+    uint16_t level = 0;
+
+    while (level < TIMER_WHEEL_LEVELS && delta >> (TIMER_WHEEL_SLOT_BITS * (level + 1)) != 0)
+        level++;
+
+    node->level = level;
+    node->slot = level == TIMER_WHEEL_OVERFLOW
+                     ? 0
+                     : (uint16_t) ((expires_at >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_SLOT_MASK);
+
+    uint32_t *head = timer_wheel_head(wheel, node->level, node->slot);
+
+    node->prev = TIMER_WHEEL_NIL;
+    node->next = *head;
+
+    if (*head != TIMER_WHEEL_NIL)
+        wheel->nodes[*head].prev = index;
+
+    *head = index;
+
+    if (level == 0)
+        wheel->occupied[node->slot / 64] |= 1ULL << (node->slot % 64);
+}
+
+static void timer_wheel_unlink(timer_wheel_t *wheel, uint32_t index)
+{
+    struct timer_node *node = &wheel->nodes[index];
+    uint32_t *head = timer_wheel_head(wheel, node->level, node->slot);
+
+    if (node->prev != TIMER_WHEEL_NIL)
+        wheel->nodes[node->prev].next = node->next;
+    else
+        *head = node->next;
+
+    if (node->next != TIMER_WHEEL_NIL)
+        wheel->nodes[node->next].prev = node->prev;
+
+    if (node->level == 0 && *head == TIMER_WHEEL_NIL)
+        wheel->occupied[node->slot / 64] &= ~(1ULL << (node->slot % 64));
+}
+
+static void timer_wheel_release(timer_wheel_t *wheel, uint32_t index)
+{
+    struct timer_node *node = &wheel->nodes[index];
+
+    node->level = TIMER_WHEEL_FREE;
+    node->generation++;
+    node->next = wheel->free_list;
+    wheel->free_list = index;
+    wheel->count--;
+}
+
+void timer_wheel_init(timer_wheel_t *wheel, uint64_t tick_ms, uint64_t now_ms)
+{
+    memset(wheel, 0, sizeof (*wheel));
+    memset(wheel->heads, 0xFF, sizeof (wheel->heads));
+    wheel->tick_ms = tick_ms != 0 ? tick_ms : TIMER_WHEEL_DEFAULT_TICK_MS;
+    wheel->tick = now_ms / wheel->tick_ms;
+    wheel->overflow = TIMER_WHEEL_NIL;
+    wheel->free_list = TIMER_WHEEL_NIL;
+}
+
+void timer_wheel_free(timer_wheel_t *wheel)
+{
+    free(wheel->nodes);
+    wheel->nodes = NULL;
+    wheel->capacity = 0;
+    wheel->used = 0;
+    wheel->count = 0;
+}
+
+timer_handle_t timer_wheel_add(timer_wheel_t *wheel, uint64_t expires_at_ms, uint64_t value)
+{
+    uint32_t index = wheel->free_list;
+
+    if (index != TIMER_WHEEL_NIL)
+    {
+        wheel->free_list = wheel->nodes[index].next;
+    }
+    else
+    {
+        if (wheel->used == TIMER_WHEEL_NIL - 1)
+            return 0;
+
+        if (wheel->used == wheel->capacity)
+        {
+            uint64_t capacity = wheel->capacity != 0 ? (uint64_t) wheel->capacity * 2 : TIMER_WHEEL_MIN_CAPACITY;
+
+            wheel->capacity = capacity < TIMER_WHEEL_NIL ? (uint32_t) capacity : TIMER_WHEEL_NIL - 1;
+            wheel->nodes = xrealloc(wheel->nodes, sizeof (*wheel->nodes) * wheel->capacity);
+        }
+
+        index = wheel->used++;
+        wheel->nodes[index].generation = 1;
+    }
+
+    struct timer_node *node = &wheel->nodes[index];
+
+    /* Rounded up, so a timer never fires before its time. */
+    node->expires_at = (expires_at_ms + wheel->tick_ms - 1) / wheel->tick_ms;
+    node->value = value;
+    timer_wheel_link(wheel, index, wheel->tick + 1);
+    wheel->count++;
+
+    return timer_wheel_handle(wheel, index);
+}
+
+bool timer_wheel_cancel(timer_wheel_t *wheel, timer_handle_t handle, uint64_t *value)
+{
+    uint32_t index = timer_wheel_resolve(wheel, handle);
+
+    if (index == TIMER_WHEEL_NIL)
+        return false;
+
+    if (value != NULL)
+        *value = wheel->nodes[index].value;
+
+    timer_wheel_unlink(wheel, index);
+    timer_wheel_release(wheel, index);
+    return true;
+}
+
+bool timer_wheel_pending(const timer_wheel_t *wheel, timer_handle_t handle)
+{
+    return timer_wheel_resolve(wheel, handle) != TIMER_WHEEL_NIL;
+}
+
+/* Re-files every timer of a list relative to the current tick; they all land on lower levels. */
+static void timer_wheel_cascade(timer_wheel_t *wheel, uint16_t level, uint16_t slot)
+{
+    uint32_t *head = timer_wheel_head(wheel, level, slot);
+    uint32_t index = *head;
+
+    *head = TIMER_WHEEL_NIL;
+
+    while (index != TIMER_WHEEL_NIL)
+    {
+        uint32_t next = wheel->nodes[index].next;
+
+        timer_wheel_link(wheel, index, wheel->tick);
+        index = next;
+    }
+}
+
+/* First tick after the current one that has level 0 timers or crosses a level boundary. */
+static uint64_t timer_wheel_next_tick(const timer_wheel_t *wheel)
+{
+    uint64_t next = wheel->tick + 1;
+    uint64_t boundary = (next | TIMER_WHEEL_SLOT_MASK) + 1;
+    unsigned int slot = (unsigned int) (next & TIMER_WHEEL_SLOT_MASK);
+
+    if (slot == 0)
+        return next;
+
+    for (unsigned int word = slot / 64; word < TIMER_WHEEL_SLOTS / 64; word++)
+    {
+        uint64_t bits = wheel->occupied[word];
+
+        if (word == slot / 64)
+            bits &= UINT64_MAX << (slot % 64);
+
+        if (bits != 0)
+            return (next & ~(uint64_t) TIMER_WHEEL_SLOT_MASK) + word * 64 + (unsigned int) __builtin_ctzll(bits);
+    }
+
+    return boundary;
+}
+
+size_t timer_wheel_advance(timer_wheel_t *wheel, uint64_t now_ms, timer_wheel_expire_t expire, void *data)
+{
+    uint64_t target = now_ms / wheel->tick_ms;
+    size_t fired = 0;
+
+    while (wheel->tick < target)
+    {
+        if (wheel->count == 0)
+        {
+            wheel->tick = target;
+            break;
+        }
+
+        uint64_t tick = timer_wheel_next_tick(wheel);
+
+        if (tick > target)
+        {
+            wheel->tick = target;
+            break;
+        }
+
+        wheel->tick = tick;
+
+        if ((tick & (((uint64_t) 1 << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS)) - 1)) == 0)
+            timer_wheel_cascade(wheel, TIMER_WHEEL_OVERFLOW, 0);
+
+        /* Highest level first, so timers cascading two levels down are seen by the lower cascade. */
+        for (uint16_t level = TIMER_WHEEL_LEVELS - 1; level > 0; level--)
+        {
+            if ((tick & (((uint64_t) 1 << (TIMER_WHEEL_SLOT_BITS * level)) - 1)) == 0)
+                timer_wheel_cascade(wheel, level,
+                                    (uint16_t) ((tick >> (TIMER_WHEEL_SLOT_BITS * level)) & TIMER_WHEEL_SLOT_MASK));
+        }
+
+        uint16_t slot = (uint16_t) (tick & TIMER_WHEEL_SLOT_MASK);
+
+        /* One at a time off the live list: the callback may add or cancel timers. */
+        while (wheel->heads[0][slot] != TIMER_WHEEL_NIL)
+        {
+            uint32_t index = wheel->heads[0][slot];
+            timer_handle_t handle = timer_wheel_handle(wheel, index);
+            uint64_t value = wheel->nodes[index].value;
+
+            timer_wheel_unlink(wheel, index);
+            timer_wheel_release(wheel, index);
+            fired++;
+
+            if (expire != NULL)
+                expire(data, handle, value);
+        }
+    }
+
+    return fired;
+}
@@ -0,0 +1,69 @@
+#ifndef SUDOBOT_TIMERS_WHEEL_H
+#define SUDOBOT_TIMERS_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOT_BITS 8
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+/* Timers further out than the last level wait here until it wraps. */
+#define TIMER_WHEEL_OVERFLOW TIMER_WHEEL_LEVELS
+#define TIMER_WHEEL_NIL UINT32_MAX
+#define TIMER_WHEEL_DEFAULT_TICK_MS 10
+
+/* Generation in the high half, node index + 1 in the low half; 0 is never a valid handle. */
+typedef uint64_t timer_handle_t;
+
+struct timer_node
+{
+    uint64_t expires_at;
+    uint64_t value;
+    uint32_t next;
+    uint32_t prev;
+    uint32_t generation;
+    /* Level and slot of the list the node is on, to unlink it in O(1). */
+    uint16_t level;
+    uint16_t slot;
+};
+
+/*
+ * Hierarchical timing wheel in the style of the kernel's old timer wheel:
+ * four levels of 256 slots, each level covering 256 times the range of the
+ * one below. Adding and cancelling a timer is O(1); a timer is cascaded
+ * down at most once per level on its way to level 0. Nodes live in one
+ * slab and are linked by index, and a bitmap of occupied level 0 slots
+ * lets idle stretches be skipped without visiting every tick.
+ *
+ * Times are in milliseconds on whatever clock the owner uses. The wheel
+ * does no locking of its own.
+ */
+typedef struct timer_wheel
+{
+    uint64_t tick_ms;
+    /* Last tick processed; timers due at or before it have fired. */
+    uint64_t tick;
+    uint32_t heads[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+    uint32_t overflow;
+    uint64_t occupied[TIMER_WHEEL_SLOTS / 64];
+    struct timer_node *nodes;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t free_list;
+    size_t count;
+} timer_wheel_t;
+
+/* Called for every expired timer; it may add and cancel timers. */
+typedef void (*timer_wheel_expire_t)(void *data, timer_handle_t handle, uint64_t value);
+
+void timer_wheel_init(timer_wheel_t *wheel, uint64_t tick_ms, uint64_t now_ms);
+void timer_wheel_free(timer_wheel_t *wheel);
+
+timer_handle_t timer_wheel_add(timer_wheel_t *wheel, uint64_t expires_at_ms, uint64_t value);
+bool timer_wheel_cancel(timer_wheel_t *wheel, timer_handle_t handle, uint64_t *value);
+bool timer_wheel_pending(const timer_wheel_t *wheel, timer_handle_t handle);
+size_t timer_wheel_advance(timer_wheel_t *wheel, uint64_t now_ms, timer_wheel_expire_t expire, void *data);
+
+#endif /* SUDOBOT_TIMERS_WHEEL_H */
@@ -0,0 +1,58 @@
+#include <pthread.h>
+#include "crc32.h"
+
+#define CRC32C_POLYNOMIAL 0x82F63B78
+
+static uint32_t crc32c_table[8][256];
+static pthread_once_t crc32c_table_once = PTHREAD_ONCE_INIT;
+
+static void crc32c_init_table()
+{
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (CRC32C_POLYNOMIAL & -(crc & 1));
+
+        crc32c_table[0][i] = crc;
+    }
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        for (int slice = 1; slice < 8; slice++)
+            crc32c_table[slice][i] = (crc32c_table[slice - 1][i] >> 8) ^ crc32c_table[0][crc32c_table[slice - 1][i] & 0xFF];
+    }
+}
+
+/**
+ * @brief Slicing-by-8 CRC-32C, processing eight bytes per table round.
+ */
+uint32_t crc32c(uint32_t crc, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+
+    pthread_once(&crc32c_table_once, &crc32c_init_table);
+    crc = ~crc;
+
+    while (length >= 8)
+    {
+        uint32_t low = crc ^ ((uint32_t) bytes[0] | (uint32_t) bytes[1] << 8 |
+                              (uint32_t) bytes[2] << 16 | (uint32_t) bytes[3] << 24);
+        uint32_t high = (uint32_t) bytes[4] | (uint32_t) bytes[5] << 8 |
+                        (uint32_t) bytes[6] << 16 | (uint32_t) bytes[7] << 24;
+
+        crc = crc32c_table[7][low & 0xFF] ^ crc32c_table[6][(low >> 8) & 0xFF] ^
+              crc32c_table[5][(low >> 16) & 0xFF] ^ crc32c_table[4][low >> 24] ^
+              crc32c_table[3][high & 0xFF] ^ crc32c_table[2][(high >> 8) & 0xFF] ^
+              crc32c_table[1][(high >> 16) & 0xFF] ^ crc32c_table[0][high >> 24];
+
+        bytes += 8;
+        length -= 8;
+    }
+
+    while (length-- > 0)
+        crc = (crc >> 8) ^ crc32c_table[0][(crc ^ *bytes++) & 0xFF];
+
+    return ~crc;
+}
@@ -0,0 +1,10 @@
+#ifndef SUDOBOT_UTILS_CRC32_H
+#define SUDOBOT_UTILS_CRC32_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* CRC-32C (Castagnoli); pass 0 as the initial crc. */
+uint32_t crc32c(uint32_t crc, const void *data, size_t length);
+
+#endif /* SUDOBOT_UTILS_CRC32_H */
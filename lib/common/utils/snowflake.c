@@ -0,0 +1,443 @@
+#include <string.h>
+#include "snowflake.h"
+
+#define SNOWFLAKE_ONES 0x0101010101010101ULL
+#define SNOWFLAKE_HIGH_NIBBLES 0xF0F0F0F0F0F0F0F0ULL
+#define SNOWFLAKE_ZEROES 0x3030303030303030ULL
+
+static const char snowflake_digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const uint64_t snowflake_powers_of_ten[SNOWFLAKE_MAX_DIGITS] = {
+    1ULL,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL,
+};
+
+/* Eight bytes with the first character in the lowest byte, whatever the host order. */
+static uint64_t snowflake_load8(const char *str)
+{
+    uint64_t word;
+
+    memcpy(&word, str, sizeof word);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+static bool snowflake_is_digit(char c)
+{
+    return (unsigned char) (c - '0') < 10;
+}
+
+/*
+ * Number of leading ASCII digits among eight bytes. A byte is a digit when
+ * its high nibble is 3 both before and after adding 6; a carry out of a
+ * non-digit byte only disturbs the bytes after it.
+ */
+static unsigned int snowflake_digits8(uint64_t word)
+{
+    uint64_t non_digits = ((word & SNOWFLAKE_HIGH_NIBBLES) ^ SNOWFLAKE_ZEROES) |
+                          (((word + 6 * SNOWFLAKE_ONES) & SNOWFLAKE_HIGH_NIBBLES) ^ SNOWFLAKE_ZEROES);
+
+    return non_digits == 0 ? 8 : (unsigned int) __builtin_ctzll(non_digits) / 8;
+}
+
+/* Converts eight ASCII digits in three multiplications instead of eight steps. */
+static uint32_t snowflake_convert8(uint64_t word)
+{
+    word -= SNOWFLAKE_ZEROES;
+    word = word * 10 + (word >> 8);
+    word = (((word & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+            (((word >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return (uint32_t) word;
+}
+
+/* Length of the digit run at str, counting at most SNOWFLAKE_MAX_DIGITS + 1 digits. */
+static size_t snowflake_run_length(const char *str, size_t length)
+{
+    size_t run = 0;
+
+    while (run + 8 <= length && run <= SNOWFLAKE_MAX_DIGITS)
+    {
+        unsigned int digits = snowflake_digits8(snowflake_load8(str + run));
+
+        run += digits;
+
+        if (digits < 8)
+            return run;
+    }
+
+    while (run < length && run <= SNOWFLAKE_MAX_DIGITS && snowflake_is_digit(str[run]))
+        run++;
+
+    return run;
+}
+
+/**
+ * @brief Parses the snowflake at the start of str.
+ * @return The number of digits consumed, or 0 if str does not start with a
+ * run of 17 to 20 digits that fits in 64 bits and is not zero.
+ */
+size_t snowflake_scan(const char *str, size_t length, uint64_t *id)
+{
+    size_t run = snowflake_run_length(str, length);
+
+    if (run < SNOWFLAKE_MIN_DIGITS || run > SNOWFLAKE_MAX_DIGITS)
+        return 0;
+
+    /* One to four leading digits, then two blocks of eight. */
+    const char *blocks = str + run - 16;
+    uint64_t head = 0;
+    uint64_t value;
+
+    for (const char *cursor = str; cursor < blocks; cursor++)
+        head = head * 10 + (uint64_t) (*cursor - '0');
+
+    uint64_t tail = (uint64_t) snowflake_convert8(snowflake_load8(blocks)) * 100000000ULL +
+                    snowflake_convert8(snowflake_load8(blocks + 8));
+
+    if (__builtin_mul_overflow(head, 10000000000000000ULL, &value) || __builtin_add_overflow(value, tail, &value) ||
+        value == 0)
+        return 0;
+
+    *id = value;
+    return run;
+}
+
+/**
+ * @brief Parses a string that holds exactly one snowflake.
+ */
+bool snowflake_parse(const char *str, size_t length, uint64_t *id)
+{
+    return length > 0 && snowflake_scan(str, length, id) == length;
+}
+
+static void snowflake_format4(uint32_t value, char *out)
+{
+    uint32_t high = value / 100;
+    uint32_t low = value - high * 100;
+
+    memcpy(out, &snowflake_digit_pairs[high * 2], 2);
+    memcpy(out + 2, &snowflake_digit_pairs[low * 2], 2);
+}
+
+static void snowflake_format8(uint32_t value, char *out)
+{
+    uint32_t high = value / 10000;
+
+    snowflake_format4(high, out);
+    snowflake_format4(value - high * 10000, out + 4);
+}
+
+/**
+ * @brief Writes id in decimal and NUL-terminates it. The value is split
+ * into blocks of eight and four digits, which are written two digits at a
+ * time from a table; the divisions are by constants and compile to
+ * multiplications.
+ * @param buffer At least SNOWFLAKE_BUFFER_SIZE bytes.
+ * @return The number of digits written.
+ */
+size_t snowflake_format(uint64_t id, char *buffer)
+{
+    char digits[SNOWFLAKE_MAX_DIGITS];
+    uint64_t upper = id / 100000000ULL;
+    unsigned int bits = 64 - (unsigned int) __builtin_clzll(id | 1);
+    /* log10(2) ~ 1233 / 4096 gives the count to within one. */
+    size_t count = (bits * 1233) >> 12;
+
+    if (count < SNOWFLAKE_MAX_DIGITS && id >= snowflake_powers_of_ten[count])
+        count++;
+
+    if (count == 0)
+        count = 1;
+
+    snowflake_format4((uint32_t) (upper / 100000000ULL), digits);
+    snowflake_format8((uint32_t) (upper % 100000000ULL), digits + 4);
+    snowflake_format8((uint32_t) (id % 100000000ULL), digits + 12);
+    memcpy(buffer, digits + SNOWFLAKE_MAX_DIGITS - count, count);
+    buffer[count] = 0;
+    return count;
+}
+
+void snowflake_decode(uint64_t id, snowflake_parts_t *parts)
+{
+    parts->timestamp_ms = (id >> 22) + SNOWFLAKE_EPOCH_MS;
+    parts->worker_id = (uint8_t) ((id >> 17) & 0x1F);
+    parts->process_id = (uint8_t) ((id >> 12) & 0x1F);
+    parts->increment = (uint16_t) (id & 0xFFF);
+}
+
+static bool mention_has_prefix(const char *str, size_t length, const char *prefix, size_t prefix_length)
+{
+    return length >= prefix_length && memcmp(str, prefix, prefix_length) == 0;
+}
+
+/* Parses <@id>, <@!id>, <@&id>, <#id> or a custom emoji at str[0] == '<'. */
+static size_t mention_parse_tag(const char *str, size_t length, mention_t *mention)
+{
+    size_t position = 1;
+
+    if (length < 2)
+        return 0;
+
+    if (str[1] == '@')
+    {
+        position = 2;
+        mention->type = MENTION_USER;
+
+        if (position < length && (str[position] == '!' || str[position] == '&'))
+        {
+            mention->type = str[position] == '&' ? MENTION_ROLE : MENTION_USER;
+            position++;
+        }
+    }
+    else if (str[1] == '#')
+    {
+        position = 2;
+        mention->type = MENTION_CHANNEL;
+    }
+    else
+    {
+        position = str[1] == 'a' ? 2 : 1;
+
+        if (position >= length || str[position] != ':')
+            return 0;
+
+        size_t name = ++position;
+
+        while (position < length && position - name <= MENTION_EMOJI_NAME_MAX &&
+               (snowflake_is_digit(str[position]) || str[position] == '_' ||
+                ((unsigned char) ((str[position] | 0x20) - 'a') < 26)))
+            position++;
+
+        if (position - name < 2 || position - name > MENTION_EMOJI_NAME_MAX || position >= length ||
+            str[position] != ':')
+            return 0;
+
+        position++;
+        mention->type = MENTION_EMOJI;
+    }
+
+    size_t digits = snowflake_scan(str + position, length - position, &mention->id);
+
+    if (digits == 0 || position + digits >= length || str[position + digits] != '>')
+        return 0;
+
+    return position + digits + 1;
+}
+
+/* Letters, digits, '-' and '_', which continue a host name or an ID. */
+static bool mention_is_word(char c)
+{
+    return snowflake_is_digit(c) || (unsigned char) ((c | 0x20) - 'a') < 26 || c == '-' || c == '_';
+}
+
+static const struct
+{
+    const char *host;
+    size_t length;
+} mention_link_hosts[] = {
+    { "discord.com", 11 },
+    { "discordapp.com", 14 },
+};
+
+/*
+ * Parses a message link whose "/channels/" starts at content[slash]. The
+ * scheme and a ptb. or canary. subdomain in front of the host are optional.
+ * The host must be discord.com or discordapp.com itself or one of their
+ * subdomains, and the message ID must end the link.
+ */
+static size_t mention_parse_link(const char *content, size_t length, size_t slash, mention_t *mention)
+{
+    static const char channels[] = "/channels/";
+    size_t start = SIZE_MAX;
+
+    if (!mention_has_prefix(content + slash, length - slash, channels, sizeof channels - 1))
+        return 0;
+
+    for (size_t i = 0; i < sizeof (mention_link_hosts) / sizeof (mention_link_hosts[0]); i++)
+    {
+        size_t host_length = mention_link_hosts[i].length;
+
+        if (slash >= host_length && memcmp(content + slash - host_length, mention_link_hosts[i].host, host_length) == 0)
+        {
+            start = slash - host_length;
+            break;
+        }
+    }
+
+    if (start == SIZE_MAX || (start > 0 && mention_is_word(content[start - 1])))
+        return 0;
+
+    if (start >= 4 && memcmp(content + start - 4, "ptb.", 4) == 0)
+        start -= 4;
+    else if (start >= 7 && memcmp(content + start - 7, "canary.", 7) == 0)
+        start -= 7;
+
+    if (start >= 8 && memcmp(content + start - 8, "https://", 8) == 0)
+        start -= 8;
+    else if (start >= 7 && memcmp(content + start - 7, "http://", 7) == 0)
+        start -= 7;
+
+    size_t position = slash + sizeof channels - 1;
+    size_t digits;
+
+    if (mention_has_prefix(content + position, length - position, "@me/", 4))
+    {
+        mention->guild_id = 0;
+        position += 4;
+    }
+    else if ((digits = snowflake_scan(content + position, length - position, &mention->guild_id)) != 0 &&
+             position + digits < length && content[position + digits] == '/')
+    {
+        position += digits + 1;
+    }
+    else
+    {
+        return 0;
+    }
+
+    if ((digits = snowflake_scan(content + position, length - position, &mention->channel_id)) == 0 ||
+        position + digits >= length || content[position + digits] != '/')
+        return 0;
+
+    position += digits + 1;
+
+    if ((digits = snowflake_scan(content + position, length - position, &mention->id)) == 0 ||
+        (position + digits < length &&
+         (mention_is_word(content[position + digits]) || content[position + digits] == '/')))
+        return 0;
+
+    mention->type = MENTION_MESSAGE_LINK;
+    mention->offset = (uint32_t) start;
+    return position + digits - start;
+}
+
+/* Index of the next '<' or '/' at or after start, or length. */
+static size_t mention_next_candidate(const char *content, size_t length, size_t start)
+{
+    size_t i = start;
+
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t word = snowflake_load8(content + i);
+        uint64_t angle = word ^ ('<' * SNOWFLAKE_ONES);
+        uint64_t slash = word ^ ('/' * SNOWFLAKE_ONES);
+        uint64_t found = ((angle - SNOWFLAKE_ONES) & ~angle) | ((slash - SNOWFLAKE_ONES) & ~slash);
+
+        found &= 0x8080808080808080ULL;
+
+        if (found != 0)
+            return i + (size_t) __builtin_ctzll(found) / 8;
+    }
+
+    for (; i < length; i++)
+    {
+        if (content[i] == '<' || content[i] == '/')
+            return i;
+    }
+
+    return length;
+}
+
+/**
+ * @brief Extracts every mention, custom emoji and message link from the
+ * content in one pass.
+ * @param mentions Receives the first `max` matches, in order.
+ * @param total If not NULL, receives the number of matches, including
+ * the ones that did not fit.
+ * @return The number of matches stored.
+ */
+size_t mentions_extract(const char *content, size_t length, mention_t *mentions, size_t max, size_t *total)
+{
+    size_t stored = 0;
+    size_t found = 0;
+    size_t position = 0;
+
+    /* Offsets and lengths are stored in 32 and 16 bits; message content is far shorter. */
+    if (length > UINT32_MAX)
+        length = UINT32_MAX;
+
+    while ((position = mention_next_candidate(content, length, position)) < length)
+    {
+        mention_t mention = { 0 };
+        size_t consumed;
+
+        if (content[position] == '<')
+        {
+            consumed = mention_parse_tag(content + position, length - position, &mention);
+            mention.offset = (uint32_t) position;
+        }
+        else
+        {
+            consumed = mention_parse_link(content, length, position, &mention);
+        }
+
+        if (consumed == 0 || consumed > UINT16_MAX)
+        {
+            position++;
+            continue;
+        }
+
+        mention.length = (uint16_t) consumed;
+        position = mention.offset + consumed;
+        found++;
+
+        if (stored < max)
+            mentions[stored++] = mention;
+    }
+
+    if (total != NULL)
+        *total = found;
+
+    return stored;
+}
+
+/**
+ * @brief Parses a command argument naming a single target: a bare ID, a
+ * user, role or channel mention, or a message link. The whole string must
+ * match.
+ */
+bool snowflake_parse_target(const char *str, size_t length, mention_t *target)
+{
+    memset(target, 0, sizeof (*target));
+
+    if (length > 0 && snowflake_is_digit(str[0]))
+    {
+        if (!snowflake_parse(str, length, &target->id))
+            return false;
+
+        target->type = MENTION_ID;
+        target->length = (uint16_t) length;
+        return true;
+    }
+
+    mention_t mention;
+
+    if (mentions_extract(str, length, &mention, 1, NULL) != 1 || mention.offset != 0 || mention.length != length)
+        return false;
+
+    *target = mention;
+    return true;
+}
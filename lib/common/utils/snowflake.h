@@ -0,0 +1,61 @@
+#ifndef SUDOBOT_UTILS_SNOWFLAKE_H
+#define SUDOBOT_UTILS_SNOWFLAKE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define SNOWFLAKE_EPOCH_MS 1420070400000ULL
+/* Discord's own clients only treat runs of 17 to 20 digits as IDs. */
+#define SNOWFLAKE_MIN_DIGITS 17
+#define SNOWFLAKE_MAX_DIGITS 20
+#define SNOWFLAKE_BUFFER_SIZE (SNOWFLAKE_MAX_DIGITS + 1)
+#define MENTION_EMOJI_NAME_MAX 32
+
+typedef struct snowflake_parts
+{
+    /* Unix time in milliseconds. */
+    uint64_t timestamp_ms;
+    uint8_t worker_id;
+    uint8_t process_id;
+    uint16_t increment;
+} snowflake_parts_t;
+
+typedef enum mention_type
+{
+    /* <@id> or <@!id> */
+    MENTION_USER = 1,
+    /* <@&id> */
+    MENTION_ROLE,
+    /* <#id> */
+    MENTION_CHANNEL,
+    /* <:name:id> or <a:name:id> */
+    MENTION_EMOJI,
+    /* https://discord.com/channels/guild/channel/message, guild may be @me */
+    MENTION_MESSAGE_LINK,
+    /* A bare ID; only produced by snowflake_parse_target(). */
+    MENTION_ID,
+} mention_type_t;
+
+typedef struct mention
+{
+    /* User, role, channel, emoji or message ID. */
+    uint64_t id;
+    /* Message links only; guild_id is 0 for links into DMs. */
+    uint64_t channel_id;
+    uint64_t guild_id;
+    uint32_t offset;
+    uint16_t length;
+    uint8_t type;
+    uint8_t reserved;
+} mention_t;
+
+size_t snowflake_scan(const char *str, size_t length, uint64_t *id);
+bool snowflake_parse(const char *str, size_t length, uint64_t *id);
+size_t snowflake_format(uint64_t id, char *buffer);
+void snowflake_decode(uint64_t id, snowflake_parts_t *parts);
+
+size_t mentions_extract(const char *content, size_t length, mention_t *mentions, size_t max, size_t *total);
+bool snowflake_parse_target(const char *str, size_t length, mention_t *target);
+
+#endif /* SUDOBOT_UTILS_SNOWFLAKE_H */
@@ -124,7 +124,7 @@ char *str_concat_varg(const char *start, ...)
 
         part_length = strlen(part);
         length += part_length;
-        buffer = xrealloc(buffer, length);
+        buffer = xrealloc(buffer, length + 1);
         strncat(buffer, part, part_length);
     }
     
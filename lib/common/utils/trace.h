@@ -0,0 +1,39 @@
+#ifndef SUDOBOT_UTILS_TRACE_H
+#define SUDOBOT_UTILS_TRACE_H
+
+/*
+ * Static (USDT) tracepoints under the "sudobot" provider. With
+ * <sys/sdt.h> available each probe is a single nop plus an ELF note, so
+ * an unattached probe costs nothing; bpftrace or perf patch it at attach
+ * time. Build with USDT=0 (or without systemtap-sdt headers) to compile
+ * them out entirely. Arguments must be values that are computed anyway.
+ *
+ *   bpftrace -l 'usdt:/path/to/sudobot:sudobot:*'
+ */
+
+#if !defined(SUDOBOT_NO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SUDOBOT_USDT 1
+#endif
+#endif
+
+#ifdef SUDOBOT_USDT
+#define TRACE_PROBE0(name) DTRACE_PROBE(sudobot, name)
+#define TRACE_PROBE1(name, a) DTRACE_PROBE1(sudobot, name, a)
+#define TRACE_PROBE2(name, a, b) DTRACE_PROBE2(sudobot, name, a, b)
+#define TRACE_PROBE3(name, a, b, c) DTRACE_PROBE3(sudobot, name, a, b, c)
+#define TRACE_PROBE4(name, a, b, c, d) DTRACE_PROBE4(sudobot, name, a, b, c, d)
+#else
+#define TRACE_PROBE0(name) do { } while (0)
+#define TRACE_PROBE1(name, a) do { (void) (a); } while (0)
+#define TRACE_PROBE2(name, a, b) do { (void) (a); (void) (b); } while (0)
+#define TRACE_PROBE3(name, a, b, c) do { (void) (a); (void) (b); (void) (c); } while (0)
+#define TRACE_PROBE4(name, a, b, c, d) do { (void) (a); (void) (b); (void) (c); (void) (d); } while (0)
+#endif
+
+/* Values of the event_received probe's first argument. */
+#define TRACE_EVENT_MESSAGE 0
+#define TRACE_EVENT_INTERACTION 1
+
+#endif /* SUDOBOT_UTILS_TRACE_H */
@@ -2,6 +2,7 @@
 #include <string.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <time.h>
 #include "utils.h"
 
 const char *get_last_error()
@@ -20,4 +21,11 @@ void free_varg(void *ptr1, ...)
         free(arg);
 
     va_end(args);
+}
+
+uint64_t get_monotonic_time_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
 }
\ No newline at end of file
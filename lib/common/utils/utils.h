@@ -1,10 +1,13 @@
 #ifndef SUDOBOT_UTILS_UTILS_H
 #define SUDOBOT_UTILS_UTILS_H
 
+#include <stdint.h>
+
 #define FREE_VARG_ENDARG ((void *) 0xFFFFFFFFFFFFFFFFUL)
 #define dealloc(...) free_varg(__VA_ARGS__, FREE_VARG_ENDARG)
 
 const char *get_last_error();
 void free_varg(void *ptr1, ...);
+uint64_t get_monotonic_time_ns();
 
 #endif /* SUDOBOT_UTILS_UTILS_H */
\ No newline at end of file
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+#
+# Compares two JSON reports written by the `make bench` harness
+# (tools/bench.c) and flags cases that got slower.
+#
+# Usage: bench_compare.py [--metric p50] [--threshold 5] baseline.json current.json
+#
+# A case is flagged when the chosen latency metric grew by more than
+# --threshold percent. The p99 is also checked against --tail-threshold
+# since tail regressions are often what hurts under load. Exits with status
+# 1 when anything was flagged, so it can gate CI.
+
+import argparse
+import json
+import sys
+
+METRICS = ("min", "mean", "p50", "p90", "p99", "max")
+
+
+def load(path):
+    with open(path) as file:
+        report = json.load(file)
+
+    return {result["name"]: result for result in report["results"]}, report
+
+
+def change(old, new):
+    if old == 0:
+        return 0.0
+
+    return (new - old) / old * 100.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag slowdowns between two bench reports.")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--metric", choices=METRICS, default="p50")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="percent slowdown of --metric to flag (default: 5)")
+    parser.add_argument("--tail-threshold", type=float, default=15.0,
+                        help="percent slowdown of p99 to flag (default: 15)")
+    args = parser.parse_args()
+
+    baseline, baseline_report = load(args.baseline)
+    current, current_report = load(args.current)
+
+    if baseline_report.get("compiler") != current_report.get("compiler"):
+        print("note: reports were built with different compilers", file=sys.stderr)
+
+    flagged = []
+    print("%-22s %14s %14s %9s %9s %9s" % ("case", "baseline ns", "current ns", args.metric, "p99", "cyc/B"))
+
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline or name not in current:
+            print("%-22s %s" % (name, "only in baseline" if name in baseline else "new"))
+            continue
+
+        old, new = baseline[name], current[name]
+
+        if old["bytes"] != new["bytes"]:
+            print("%-22s corpus changed (%d -> %d bytes), skipped" % (name, old["bytes"], new["bytes"]))
+            continue
+
+        delta = change(old["ns"][args.metric], new["ns"][args.metric])
+        tail = change(old["ns"]["p99"], new["ns"]["p99"])
+        cycles = change(old["cycles_per_byte"], new["cycles_per_byte"]) if old["cycles_per_byte"] > 0 else 0.0
+        mark = ""
+
+        if delta > args.threshold or tail > args.tail_threshold:
+            mark = "  SLOWER"
+            flagged.append(name)
+        elif delta < -args.threshold:
+            mark = "  faster"
+
+        print("%-22s %14.0f %14.0f %+8.1f%% %+8.1f%% %+8.1f%%%s" % (
+            name, old["ns"][args.metric], new["ns"][args.metric], delta, tail, cycles, mark))
+
+    if flagged:
+        print("\n%d case(s) slower than the baseline: %s" % (len(flagged), ", ".join(flagged)))
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+#
+# Generates the two-stage Unicode lookup tables used by
+# common/automod/normalize.c.
+#
+# Usage: gen_unicode_tables.py [--confusables confusables.txt] > unicode_tables.c
+#
+# Without --confusables, a built-in subset of the UTS #39 confusable
+# prototypes (the Latin look-alikes seen most often in filter evasion) is
+# used. Pass the full confusables.txt from unicode.org to regenerate the
+# tables with the complete mapping.
+
+import argparse
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+MAX_CODEPOINT = 0x110000
+
+FLAG_MARK = 1
+FLAG_IGNORABLE = 2
+
+# Subset of confusables.txt, prototype already case-folded.
+BUILTIN_CONFUSABLES = {
+    # Cyrillic
+    0x0430: "a", 0x0432: "b", 0x0435: "e", 0x0433: "r", 0x043A: "k",
+    0x043C: "m", 0x043D: "h", 0x043E: "o", 0x0440: "p", 0x0441: "c",
+    0x0442: "t", 0x0443: "y", 0x0445: "x", 0x0455: "s", 0x0456: "i",
+    0x0458: "j", 0x04BB: "h", 0x0501: "d", 0x051B: "q", 0x051D: "w",
+    0x0491: "r", 0x0457: "i", 0x04CF: "l",
+    # Greek
+    0x03B1: "a", 0x03B2: "b", 0x03B5: "e", 0x03B9: "i", 0x03BA: "k",
+    0x03BD: "v", 0x03BF: "o", 0x03C1: "p", 0x03C4: "t", 0x03C5: "u",
+    0x03C7: "x", 0x03B3: "y", 0x03C9: "w",
+    # Armenian
+    0x0585: "o", 0x0578: "n", 0x057D: "u", 0x0566: "q",
+    # Latin and ASCII look-alikes
+    0x0030: "o", 0x0031: "l", 0x007C: "l", 0x0131: "i", 0x0269: "i",
+    0x0251: "a", 0x0261: "g", 0x028F: "y", 0x1D0F: "o", 0x1D1C: "u",
+    0x0280: "r", 0x0274: "n", 0x026A: "i", 0x1D00: "a", 0x0299: "b",
+    0x1D04: "c", 0x1D05: "d", 0x1D07: "e", 0x0262: "g", 0x029C: "h",
+    0x1D0A: "j", 0x1D0B: "k", 0x029F: "l", 0x1D0D: "m", 0x1D18: "p",
+    0x0455: "s", 0x1D1B: "t", 0x1D20: "v", 0x1D21: "w", 0x1D22: "z",
+    0x017F: "f", 0x00DF: "ss",
+}
+
+# Default_Ignorable_Code_Point ranges (DerivedCoreProperties.txt); these
+# are dropped from both outputs.
+IGNORABLE_RANGES = [
+    (0x00AD, 0x00AD), (0x034F, 0x034F), (0x061C, 0x061C),
+    (0x115F, 0x1160), (0x17B4, 0x17B5), (0x180B, 0x180F),
+    (0x200B, 0x200F), (0x202A, 0x202E), (0x2060, 0x206F),
+    (0x3164, 0x3164), (0xFE00, 0xFE0F), (0xFEFF, 0xFEFF),
+    (0xFFA0, 0xFFA0), (0xFFF0, 0xFFF8), (0x1BCA0, 0x1BCA3),
+    (0x1D173, 0x1D17A), (0xE0000, 0xE0FFF),
+]
+
+
+def load_confusables(path):
+    table = {}
+
+    with open(path, encoding="utf-8-sig") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+
+            if not line:
+                continue
+
+            source, target = [field.strip() for field in line.split(";")[:2]]
+
+            if " " in source:
+                continue
+
+            prototype = "".join(chr(int(cp, 16)) for cp in target.split())
+            table[int(source, 16)] = fold(prototype)
+
+    return table
+
+
+def fold(text):
+    return unicodedata.normalize("NFKC", unicodedata.normalize("NFKC", text).casefold())
+
+
+def is_ignorable(cp):
+    return any(lo <= cp <= hi for lo, hi in IGNORABLE_RANGES)
+
+
+def skeleton_char(c, confusables):
+    cp = ord(c)
+
+    if cp in confusables:
+        return confusables[cp]
+
+    decomposed = unicodedata.normalize("NFD", c)
+    base = "".join(d for d in decomposed if not unicodedata.category(d).startswith("M"))
+
+    if base == decomposed:
+        return c
+
+    return "".join(confusables.get(ord(d), d) for d in base)
+
+
+def properties(cp, confusables):
+    c = chr(cp)
+    category = unicodedata.category(c)
+
+    if category == "Cs":
+        return (0, None, None)
+
+    if is_ignorable(cp):
+        return (FLAG_IGNORABLE, "", "")
+
+    if category in ("Mn", "Me"):
+        return (FLAG_MARK, fold(c), "")
+
+    if category == "Cn":
+        return (0, None, None)
+
+    folded = fold(c)
+    skeleton = "".join(skeleton_char(f, confusables) for f in folded)
+
+    return (0, folded if folded != c else None, skeleton if skeleton != c else None)
+
+
+def c_string(data):
+    return "".join("\\x%02x" % b for b in data)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--confusables", help="path to UTS #39 confusables.txt")
+    args = parser.parse_args()
+
+    confusables = dict(BUILTIN_CONFUSABLES)
+
+    if args.confusables:
+        confusables.update(load_confusables(args.confusables))
+
+    blob = bytearray()
+    blob_index = {}
+
+    def intern(text):
+        if text is None:
+            return (0xFFFF, 0)
+
+        data = text.encode("utf-8")
+
+        if data not in blob_index:
+            blob_index[data] = len(blob)
+            blob.extend(data)
+
+        return (blob_index[data], len(data))
+
+    props = [(0, 0xFFFF, 0, 0xFFFF, 0)]
+    prop_index = {props[0]: 0}
+    blocks = []
+    block_index = {}
+    stage1 = []
+
+    for block_start in range(0, MAX_CODEPOINT, BLOCK_SIZE):
+        block = []
+
+        for cp in range(block_start, block_start + BLOCK_SIZE):
+            flags, folded, skeleton = properties(cp, confusables)
+            entry = (flags,) + intern(folded) + intern(skeleton)
+
+            if entry not in prop_index:
+                prop_index[entry] = len(props)
+                props.append(entry)
+
+            block.append(prop_index[entry])
+
+        block = tuple(block)
+
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+
+        stage1.append(block_index[block])
+
+    assert len(props) < 0xFFFF and len(blob) < 0xFFFF
+
+    out = sys.stdout
+    out.write("/* Generated by lib/scripts/gen_unicode_tables.py from Unicode %s. Do not edit. */\n\n"
+              % unicodedata.unidata_version)
+    out.write("#include \"unicode_tables.h\"\n\n")
+
+    out.write("const uint16_t unicode_stage1[UNICODE_STAGE1_SIZE] = {\n")
+    for i in range(0, len(stage1), 16):
+        out.write("    " + ", ".join(str(v) for v in stage1[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("const uint16_t unicode_stage2[][UNICODE_BLOCK_SIZE] = {\n")
+    for block in blocks:
+        out.write("    {\n")
+        for i in range(0, BLOCK_SIZE, 16):
+            out.write("        " + ", ".join(str(v) for v in block[i:i + 16]) + ",\n")
+        out.write("    },\n")
+    out.write("};\n\n")
+
+    out.write("const struct unicode_props unicode_props[] = {\n")
+    for flags, fold_off, fold_len, skel_off, skel_len in props:
+        out.write("    { %d, %d, %d, %d, %d },\n" % (flags, fold_len, skel_len, fold_off, skel_off))
+    out.write("};\n\n")
+
+    out.write("const char unicode_mapping_data[] =\n")
+    for i in range(0, len(blob), 24):
+        out.write("    \"%s\"\n" % c_string(blob[i:i + 24]))
+    out.write("    \"\";\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# Compares the build variants measured by `make pgo-report`.
+#
+# Usage: pgo_report.py REPORT_DIR baseline lto optimize
+#
+# REPORT_DIR holds, for every variant, <variant>-replay.json (written by
+# gateway-replay --output), <variant>-bench.json (written by the bench
+# harness) and <variant>-size.json. The first variant is the one the
+# others are compared against.
+
+import argparse
+import json
+import os
+import sys
+
+BIN = "sudobot"
+LIB = "libsudobot.so"
+
+
+def load(directory, variant, kind):
+    path = os.path.join(directory, "%s-%s.json" % (variant, kind))
+
+    try:
+        with open(path) as file:
+            return json.load(file)
+    except (OSError, ValueError) as error:
+        print("pgo_report: cannot read %s: %s" % (path, error), file=sys.stderr)
+        return None
+
+
+def change(old, new):
+    if not old:
+        return ""
+
+    return "%+.1f%%" % ((new - old) / old * 100.0)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare build variants measured by make pgo-report.")
+    parser.add_argument("directory")
+    parser.add_argument("variants", nargs="+")
+    args = parser.parse_args()
+
+    variants = args.variants
+    baseline = variants[0]
+    replay = {variant: load(args.directory, variant, "replay") for variant in variants}
+    bench = {variant: load(args.directory, variant, "bench") for variant in variants}
+    size = {variant: load(args.directory, variant, "size") for variant in variants}
+
+    if any(report is None for report in list(replay.values()) + list(bench.values())):
+        return 1
+
+    print("Replay workload (%s, %d events per run)" % (replay[baseline]["source"], replay[baseline]["events"]))
+    print("%-10s %12s %8s %12s %8s %12s %8s" % ("variant", "events/s", "", "p50 ns", "", "p99 ns", ""))
+
+    for variant in variants:
+        result, base = replay[variant], replay[baseline]
+        print("%-10s %12.0f %8s %12d %8s %12d %8s" % (
+            variant,
+            result["events_per_second"], change(base["events_per_second"], result["events_per_second"]),
+            result["service_ns"]["p50"], change(base["service_ns"]["p50"], result["service_ns"]["p50"]),
+            result["service_ns"]["p99"], change(base["service_ns"]["p99"], result["service_ns"]["p99"])))
+
+    print()
+    print("Bench cases (p50 ns per pass)")
+    print("%-22s" % "case" + "".join(" %18s" % variant for variant in variants))
+    cases = {variant: {result["name"]: result for result in bench[variant]["results"]} for variant in variants}
+
+    for name in sorted(cases[baseline]):
+        row = "%-22s" % name
+
+        for variant in variants:
+            result = cases[variant].get(name)
+
+            if result is None:
+                row += " %18s" % "-"
+            elif variant == baseline:
+                row += " %18.0f" % result["ns"]["p50"]
+            else:
+                p50 = result["ns"]["p50"]
+                row += " %10.0f %7s" % (p50, change(cases[baseline][name]["ns"]["p50"], p50))
+
+        print(row)
+
+    if all(size[variant] is not None for variant in variants):
+        print()
+        print("Binary sizes (bytes)")
+        print("%-10s %12s %8s %12s %8s" % ("variant", BIN, "", LIB, ""))
+
+        for variant in variants:
+            print("%-10s %12d %8s %12d %8s" % (
+                variant,
+                size[variant]["bin"], change(size[baseline]["bin"], size[variant]["bin"]),
+                size[variant]["lib"], change(size[baseline]["lib"], size[variant]["lib"])))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,523 @@
+/*
+ * Microbenchmarks for the native core's string-heavy hot paths.
+ *
+ * Every case runs over a corpus (chat messages or env files under
+ * tools/corpus) a number of warmup passes that are discarded, then a
+ * number of timed passes. One sample is one pass over the whole corpus, so
+ * clock overhead stays negligible even for sub-microsecond operations.
+ * Results go to stderr as a table and to stdout (or --output) as JSON, to
+ * be compared between runs with scripts/bench_compare.py.
+ *
+ * Build and run with `make bench`.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Pulled in whole so the static parsers can be measured directly. */
+#include "../common/core/command.c"
+#include "../common/env.c"
+
+#include "../common/io/printf.h"
+#include "../common/utils/snowflake.h"
+#include "../common/utils/strutils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#else
+#define BENCH_HAVE_TSC 0
+#endif
+
+#define BENCH_DEFAULT_WARMUP 20
+#define BENCH_DEFAULT_REPETITIONS 200
+#define BENCH_MAX_ITEMS 4096
+
+struct bench_corpus
+{
+    const char *name;
+    char *items[BENCH_MAX_ITEMS];
+    size_t lengths[BENCH_MAX_ITEMS];
+    size_t count;
+    size_t bytes;
+};
+
+struct bench_case
+{
+    const char *name;
+    struct bench_corpus *corpus;
+    void (*run)(const struct bench_corpus *corpus);
+};
+
+struct bench_result
+{
+    const char *name;
+    size_t items;
+    size_t bytes;
+    double ns_min;
+    double ns_mean;
+    double ns_p50;
+    double ns_p90;
+    double ns_p99;
+    double ns_max;
+    double cycles_per_byte;
+};
+
+static struct bench_corpus messages = { .name = "messages" };
+static struct bench_corpus env_files = { .name = "env" };
+static volatile size_t bench_sink;
+
+static uint64_t bench_now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t bench_cycles()
+{
+#if BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static char *bench_read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char *data = xmalloc((size_t) size + 1);
+    size_t read = fread(data, 1, (size_t) size, file);
+
+    fclose(file);
+    data[read] = 0;
+    *length = read;
+    return data;
+}
+
+static void bench_corpus_add(struct bench_corpus *corpus, char *item, size_t length)
+{
+    if (corpus->count == BENCH_MAX_ITEMS)
+    {
+        free(item);
+        return;
+    }
+
+    corpus->items[corpus->count] = item;
+    corpus->lengths[corpus->count] = length;
+    corpus->count++;
+    corpus->bytes += length;
+}
+
+/* One message per line; a literal "\n" stands for a newline inside a message. */
+static bool bench_load_messages(const char *directory)
+{
+    char path[4096];
+    size_t length;
+
+    snprintf(path, sizeof path, "%s/messages.txt", directory);
+
+    char *data = bench_read_file(path, &length);
+
+    if (data == NULL)
+    {
+        fprintf(stderr, "bench: cannot read %s\n", path);
+        return false;
+    }
+
+    for (char *line = data, *end; *line != 0; line = *end == 0 ? end : end + 1)
+    {
+        end = strchr(line, '\n');
+
+        if (end == NULL)
+            end = line + strlen(line);
+
+        char *message = xmalloc((size_t) (end - line) + 1);
+        size_t j = 0;
+
+        for (const char *p = line; p < end; p++)
+        {
+            if (p[0] == '\\' && p + 1 < end && p[1] == 'n')
+            {
+                message[j++] = '\n';
+                p++;
+            }
+            else
+            {
+                message[j++] = *p;
+            }
+        }
+
+        message[j] = 0;
+        bench_corpus_add(&messages, message, j);
+    }
+
+    free(data);
+    return messages.count > 0;
+}
+
+static bool bench_load_env_files(const char *directory)
+{
+    static const char *const names[] = { "bot.env", "large.env" };
+    char path[4096];
+
+    for (size_t i = 0; i < sizeof (names) / sizeof (names[0]); i++)
+    {
+        size_t length;
+
+        snprintf(path, sizeof path, "%s/%s", directory, names[i]);
+
+        char *data = bench_read_file(path, &length);
+
+        if (data == NULL)
+        {
+            fprintf(stderr, "bench: cannot read %s\n", path);
+            return false;
+        }
+
+        bench_corpus_add(&env_files, data, length);
+    }
+
+    return true;
+}
+
+static void bench_command_argv_create(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        size_t argc;
+        char **argv;
+
+        command_argv_create(corpus->items[i], &argc, &argv);
+        bench_sink += argc;
+        command_argv_free(argc, argv);
+    }
+}
+
+static void bench_command_find_by_name(const struct bench_corpus *corpus)
+{
+    char name[64];
+
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        const char *content = corpus->items[i];
+        size_t length = 0;
+
+        while (*content == ' ' || *content == '-')
+            content++;
+
+        while (content[length] != 0 && content[length] != ' ' && length < sizeof (name) - 1)
+        {
+            name[length] = content[length];
+            length++;
+        }
+
+        name[length] = 0;
+        bench_sink += command_find_by_name(name) != NULL;
+    }
+}
+
+static void bench_casprintf(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        char *line = casprintf("[%05d] message %lu in %lu by %s: %s", (int) i, 1104738291738472448UL + i,
+                               911987536379912196UL, "someone", corpus->items[i]);
+
+        bench_sink += line[0];
+        free(line);
+    }
+}
+
+static void bench_env_parse_load(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        env_t *env = env_init();
+
+        env->contents = xmalloc(corpus->lengths[i] + 1);
+        memcpy(env->contents, corpus->items[i], corpus->lengths[i] + 1);
+        env->length = corpus->lengths[i];
+        bench_sink += env_parse_load(env);
+        env_free(env);
+    }
+}
+
+static void bench_str_trim(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        char *trimmed = str_trim(corpus->items[i]);
+        bench_sink += trimmed[0];
+        free(trimmed);
+    }
+}
+
+static void bench_str_ltrim(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        char *trimmed = str_ltrim(corpus->items[i]);
+        bench_sink += trimmed[0];
+        free(trimmed);
+    }
+}
+
+static void bench_str_rtrim(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        char *trimmed = str_rtrim(corpus->items[i]);
+        bench_sink += trimmed[0];
+        free(trimmed);
+    }
+}
+
+static void bench_str_starts_with(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+        bench_sink += str_starts_with(corpus->items[i], PREFIX);
+}
+
+static void bench_str_concat(const struct bench_corpus *corpus)
+{
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        char *joined = str_concat("<#911987536379912196> ", corpus->items[i], " (edited)");
+        bench_sink += joined[0];
+        free(joined);
+    }
+}
+
+static void bench_mentions_extract(const struct bench_corpus *corpus)
+{
+    mention_t mentions[16];
+    size_t total;
+
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        bench_sink += mentions_extract(corpus->items[i], corpus->lengths[i], mentions, 16, &total);
+        bench_sink += total;
+    }
+}
+
+struct bench_moderation_args
+{
+    uint64_t user_id;
+    uint64_t duration_ms;
+    cmd_text_t reason;
+};
+
+static const cmd_arg_t bench_moderation_arg_list[] = {
+    { "user", CMD_ARG_USER, CMD_ARG_OPTIONAL, offsetof(struct bench_moderation_args, user_id), 0, 0 },
+    { "duration", CMD_ARG_DURATION, CMD_ARG_OPTIONAL, offsetof(struct bench_moderation_args, duration_ms), 0, 0 },
+    { "reason", CMD_ARG_REST, CMD_ARG_OPTIONAL, offsetof(struct bench_moderation_args, reason), 0, 0 },
+};
+
+static const cmd_args_t bench_moderation_args = CMD_ARGS(struct bench_moderation_args, bench_moderation_arg_list);
+
+static void bench_command_args_parse(const struct bench_corpus *corpus)
+{
+    struct bench_moderation_args args;
+    cmd_args_result_t result;
+
+    for (size_t i = 0; i < corpus->count; i++)
+    {
+        bench_sink += command_args_parse(&bench_moderation_args, corpus->items[i], corpus->lengths[i], 0, &args,
+                                         &result);
+        bench_sink += result.present + args.reason.length;
+    }
+}
+
+static struct bench_case bench_cases[] = {
+    { "command_argv_create", &messages, &bench_command_argv_create },
+    { "command_find_by_name", &messages, &bench_command_find_by_name },
+    { "casprintf", &messages, &bench_casprintf },
+    { "env_parse_load", &env_files, &bench_env_parse_load },
+    { "str_trim", &messages, &bench_str_trim },
+    { "str_ltrim", &messages, &bench_str_ltrim },
+    { "str_rtrim", &messages, &bench_str_rtrim },
+    { "str_starts_with", &messages, &bench_str_starts_with },
+    { "str_concat", &messages, &bench_str_concat },
+    { "mentions_extract", &messages, &bench_mentions_extract },
+    { "command_args_parse", &messages, &bench_command_args_parse },
+};
+
+static int bench_compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static double bench_percentile(const uint64_t *sorted, size_t count, double percentile)
+{
+    double rank = percentile / 100.0 * (double) (count - 1);
+    size_t low = (size_t) rank;
+    size_t high = low + 1 < count ? low + 1 : low;
+
+    return (double) sorted[low] + (rank - (double) low) * (double) (sorted[high] - sorted[low]);
+}
+
+static void bench_run(const struct bench_case *bench, size_t warmup, size_t repetitions,
+                      struct bench_result *result)
+{
+    uint64_t *ns = xmalloc(repetitions * sizeof (*ns));
+    uint64_t *cycles = xmalloc(repetitions * sizeof (*cycles));
+    double total = 0;
+
+    for (size_t i = 0; i < warmup; i++)
+        bench->run(bench->corpus);
+
+    for (size_t i = 0; i < repetitions; i++)
+    {
+        uint64_t start_cycles = bench_cycles();
+        uint64_t start = bench_now_ns();
+
+        bench->run(bench->corpus);
+
+        ns[i] = bench_now_ns() - start;
+        cycles[i] = bench_cycles() - start_cycles;
+        total += (double) ns[i];
+    }
+
+    qsort(ns, repetitions, sizeof (*ns), &bench_compare_u64);
+    qsort(cycles, repetitions, sizeof (*cycles), &bench_compare_u64);
+
+    result->name = bench->name;
+    result->items = bench->corpus->count;
+    result->bytes = bench->corpus->bytes;
+    result->ns_min = (double) ns[0];
+    result->ns_mean = total / (double) repetitions;
+    result->ns_p50 = bench_percentile(ns, repetitions, 50);
+    result->ns_p90 = bench_percentile(ns, repetitions, 90);
+    result->ns_p99 = bench_percentile(ns, repetitions, 99);
+    result->ns_max = (double) ns[repetitions - 1];
+    result->cycles_per_byte = BENCH_HAVE_TSC ? bench_percentile(cycles, repetitions, 50) / (double) result->bytes
+                                             : -1;
+
+    free(ns);
+    free(cycles);
+}
+
+static void bench_write_json(FILE *out, const struct bench_result *results, size_t count, size_t warmup,
+                             size_t repetitions)
+{
+    fprintf(out, "{\n  \"version\": 1,\n  \"timestamp\": %ld,\n", (long) time(NULL));
+    fprintf(out, "  \"compiler\": \"%s\",\n", __VERSION__);
+    fprintf(out, "  \"warmup\": %zu,\n  \"repetitions\": %zu,\n", warmup, repetitions);
+    fprintf(out, "  \"cycles\": \"%s\",\n", BENCH_HAVE_TSC ? "tsc" : "none");
+    fprintf(out, "  \"results\": [\n");
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const struct bench_result *r = &results[i];
+
+        fprintf(out,
+                "    {\"name\": \"%s\", \"items\": %zu, \"bytes\": %zu, \"ns\": {\"min\": %.0f, \"mean\": %.1f, "
+                "\"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.0f}, \"ns_per_item\": %.2f, "
+                "\"cycles_per_byte\": %.3f}%s\n",
+                r->name, r->items, r->bytes, r->ns_min, r->ns_mean, r->ns_p50, r->ns_p90, r->ns_p99, r->ns_max,
+                r->ns_p50 / (double) r->items, r->cycles_per_byte, i + 1 < count ? "," : "");
+    }
+
+    fprintf(out, "  ]\n}\n");
+}
+
+static void bench_usage(const char *argv0)
+{
+    fprintf(stderr,
+            "Usage: %s [--warmup N] [--repetitions N] [--corpus DIR] [--output FILE] [--filter SUBSTRING]\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    size_t warmup = BENCH_DEFAULT_WARMUP;
+    size_t repetitions = BENCH_DEFAULT_REPETITIONS;
+    const char *corpus_directory = "tools/corpus";
+    const char *output_path = NULL;
+    const char *filter = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (i + 1 >= argc)
+        {
+            bench_usage(argv[0]);
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--warmup") == 0)
+            warmup = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--repetitions") == 0)
+            repetitions = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--corpus") == 0)
+            corpus_directory = argv[++i];
+        else if (strcmp(argv[i], "--output") == 0)
+            output_path = argv[++i];
+        else if (strcmp(argv[i], "--filter") == 0)
+            filter = argv[++i];
+        else
+        {
+            bench_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (repetitions == 0)
+        repetitions = 1;
+
+    if (!bench_load_messages(corpus_directory) || !bench_load_env_files(corpus_directory))
+        return 1;
+
+    size_t case_count = sizeof (bench_cases) / sizeof (bench_cases[0]);
+    struct bench_result *results = xcalloc(case_count, sizeof (*results));
+    size_t result_count = 0;
+
+    fprintf(stderr, "%-22s %8s %12s %12s %12s %10s\n", "case", "items", "p50 ns/item", "p99 ns/item",
+            "max ns/item", "cyc/byte");
+
+    for (size_t i = 0; i < case_count; i++)
+    {
+        if (filter != NULL && strstr(bench_cases[i].name, filter) == NULL)
+            continue;
+
+        struct bench_result *r = &results[result_count++];
+
+        bench_run(&bench_cases[i], warmup, repetitions, r);
+        fprintf(stderr, "%-22s %8zu %12.1f %12.1f %12.1f %10.2f\n", r->name, r->items, r->ns_p50 / r->items,
+                r->ns_p99 / r->items, r->ns_max / r->items, r->cycles_per_byte);
+    }
+
+    FILE *out = output_path == NULL ? stdout : fopen(output_path, "w");
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "bench: cannot write %s\n", output_path);
+        return 1;
+    }
+
+    bench_write_json(out, results, result_count, warmup, repetitions);
+
+    if (out != stdout)
+        fclose(out);
+
+    for (size_t i = 0; i < messages.count; i++)
+        free(messages.items[i]);
+
+    for (size_t i = 0; i < env_files.count; i++)
+        free(env_files.items[i]);
+
+    free(results);
+    return 0;
+}
@@ -0,0 +1,569 @@
+/*
+ * Offline replay of a gateway recording.
+ *
+ * Record traffic by running the bot with GATEWAY_RECORD_PATH set, then
+ * feed the recording back through the scheduler hook and the real
+ * on_message / on_interaction_create handlers, without a gateway
+ * connection. Outbound REST requests go through the normal scheduler (so
+ * coalescing and rate limiting still apply) to a stub transport that
+ * records what would have been sent, one JSON object per line, instead of
+ * calling Discord.
+ *
+ * Reports events per second, handler service time, and end-to-end latency
+ * measured from when each event was due, which includes any queueing when
+ * the handlers cannot keep up with the replay rate.
+ *
+ * Usage: gateway-replay [--speed X] [--repeat N] [--rest-log FILE] [--drain-ms N] [--output FILE]
+ *                       [--event-filter MODE] [--synthesize] RECORDING
+ *
+ *   --speed 1       recorded speed (default)
+ *   --speed 10      ten times faster than recorded
+ *   --speed 0       as fast as possible
+ *   --output FILE   also write the results as JSON
+ *   --event-filter MODE
+ *                   filter MESSAGE_CREATE before decoding, as EVENT_FILTER
+ *                   does (1 = unused messages, 2 = commands only)
+ *   --synthesize    RECORDING is a chat corpus (tools/corpus/messages.txt)
+ *                   to build traffic from instead of a recording
+ *
+ * Build and run with `make gateway-replay RECORDING=...`.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <concord/discord.h>
+#include "../common/sudobot.h"
+#include "../common/core/command.h"
+#include "../common/events/event_filter.h"
+#include "../common/events/on_dispatch.h"
+#include "../common/events/on_interaction.h"
+#include "../common/events/on_message.h"
+#include "../common/gateway/recorder.h"
+#include "../common/rest/scheduler.h"
+#include "../common/utils/utils.h"
+#include "../common/utils/xmalloc.h"
+
+#define REPLAY_DEFAULT_DRAIN_MS 10000
+#define REPLAY_JSON_BUFFER_SIZE (64 * 1024)
+/* Matches PREFIX in core/command.c. */
+#define REPLAY_SYNTH_PREFIX "-"
+#define REPLAY_SYNTH_INTERVAL_US 2000
+#define REPLAY_SYNTH_CHANNELS 8
+#define REPLAY_SYNTH_USERS 64
+#define REPLAY_SYNTH_SNOWFLAKE 1100000000000000000ULL
+
+struct replay_samples
+{
+    uint64_t *values;
+    size_t count;
+    size_t capacity;
+};
+
+static const char *const replay_route_names[REST_ROUTE_COUNT] = {
+    [REST_ROUTE_DELETE_MESSAGE] = "DELETE /channels/:id/messages/:id",
+    [REST_ROUTE_BULK_DELETE_MESSAGES] = "POST /channels/:id/messages/bulk-delete",
+    [REST_ROUTE_CREATE_GUILD_BAN] = "PUT /guilds/:id/bans/:id",
+    [REST_ROUTE_CREATE_MESSAGE] = "POST /channels/:id/messages",
+    [REST_ROUTE_INTERACTION_RESPONSE] = "POST /interactions/:id/:token/callback",
+};
+
+static FILE *replay_rest_log = NULL;
+static uint64_t replay_started_at_ns = 0;
+static uint64_t replay_rest_calls[REST_ROUTE_COUNT];
+static char replay_json[REPLAY_JSON_BUFFER_SIZE];
+
+static void replay_samples_add(struct replay_samples *samples, uint64_t value)
+{
+    if (samples->count == samples->capacity)
+    {
+        samples->capacity = samples->capacity == 0 ? 4096 : samples->capacity * 2;
+        samples->values = xrealloc(samples->values, samples->capacity * sizeof (*samples->values));
+    }
+
+    samples->values[samples->count++] = value;
+}
+
+static int replay_compare_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t replay_percentile(const struct replay_samples *samples, double percentile)
+{
+    if (samples->count == 0)
+        return 0;
+
+    size_t index = (size_t) (percentile / 100.0 * (double) (samples->count - 1) + 0.5);
+    return samples->values[index];
+}
+
+static void replay_print_samples(const char *name, struct replay_samples *samples)
+{
+    qsort(samples->values, samples->count, sizeof (*samples->values), &replay_compare_u64);
+    printf("%-10s p50 %8.1f us  p90 %8.1f us  p99 %8.1f us  p99.9 %8.1f us  max %8.1f us\n", name,
+           replay_percentile(samples, 50) / 1e3, replay_percentile(samples, 90) / 1e3,
+           replay_percentile(samples, 99) / 1e3, replay_percentile(samples, 99.9) / 1e3,
+           replay_percentile(samples, 100) / 1e3);
+}
+
+static void replay_write_samples(FILE *out, const char *name, const struct replay_samples *samples)
+{
+    fprintf(out, "\"%s\": {\"p50\": %lu, \"p90\": %lu, \"p99\": %lu, \"p999\": %lu, \"max\": %lu}", name,
+            replay_percentile(samples, 50), replay_percentile(samples, 90), replay_percentile(samples, 99),
+            replay_percentile(samples, 99.9), replay_percentile(samples, 100));
+}
+
+static void replay_json_string(FILE *out, const char *string)
+{
+    fputc('"', out);
+
+    for (const unsigned char *p = (const unsigned char *) (string != NULL ? string : ""); *p != 0; p++)
+    {
+        if (*p == '"' || *p == '\\')
+            fprintf(out, "\\%c", *p);
+        else if (*p < 0x20)
+            fprintf(out, "\\u%04x", *p);
+        else
+            fputc(*p, out);
+    }
+
+    fputc('"', out);
+}
+
+/* Like replay_json_string, but a literal "\\n" in corpus lines stands for a newline. */
+static void replay_json_corpus_line(FILE *out, const char *line)
+{
+    fputc('"', out);
+
+    for (const unsigned char *p = (const unsigned char *) line; *p != 0; p++)
+    {
+        if (p[0] == '\\' && p[1] == 'n')
+        {
+            fputs("\\n", out);
+            p++;
+        }
+        else if (*p == '"' || *p == '\\')
+            fprintf(out, "\\%c", *p);
+        else if (*p < 0x20)
+            fprintf(out, "\\u%04x", *p);
+        else
+            fputc(*p, out);
+    }
+
+    fputc('"', out);
+}
+
+static void replay_put_varint(FILE *out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        fputc((int) ((value & 0x7F) | 0x80), out);
+        value >>= 7;
+    }
+
+    fputc((int) value, out);
+}
+
+static void replay_synth_record(FILE *out, enum discord_gateway_events event, const char *payload, size_t length)
+{
+    replay_put_varint(out, REPLAY_SYNTH_INTERVAL_US);
+    replay_put_varint(out, (uint64_t) event);
+    replay_put_varint(out, 0);
+    replay_put_varint(out, length);
+    fwrite(payload, 1, length, out);
+}
+
+/*
+ * Builds an in-memory recording from a chat corpus: every line becomes a
+ * MESSAGE_CREATE from one of a few users and channels, and every line that
+ * starts with the command prefix is sent again as the matching slash
+ * command, so offline runs (PGO training included) exercise the same
+ * decode, automod and command paths as live traffic.
+ */
+static gateway_recording_t *replay_synthesize(const char *path)
+{
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "gateway-replay: cannot read %s: %s\n", path, strerror(errno));
+        return NULL;
+    }
+
+    gateway_recording_t *recording = xcalloc(1, sizeof (*recording));
+    char *data = NULL, *line = NULL, *payload = NULL;
+    size_t line_capacity = 0, length;
+    ssize_t line_length;
+    uint64_t count = 0;
+    FILE *out = open_memstream(&data, &recording->length);
+
+    while ((line_length = getline(&line, &line_capacity, file)) >= 0)
+    {
+        while (line_length > 0 && (line[line_length - 1] == '\n' || line[line_length - 1] == '\r'))
+            line[--line_length] = 0;
+
+        uint64_t id = REPLAY_SYNTH_SNOWFLAKE + count;
+        uint64_t guild_id = REPLAY_SYNTH_SNOWFLAKE - 1;
+        uint64_t channel_id = REPLAY_SYNTH_SNOWFLAKE - 2 - count % REPLAY_SYNTH_CHANNELS;
+        uint64_t user = count * 7 % REPLAY_SYNTH_USERS;
+        uint64_t user_id = REPLAY_SYNTH_SNOWFLAKE / 2 + user;
+        FILE *json = open_memstream(&payload, &length);
+
+        fprintf(json,
+                "{\"id\": \"%lu\", \"type\": 0, \"channel_id\": \"%lu\", \"guild_id\": \"%lu\", "
+                "\"author\": {\"id\": \"%lu\", \"username\": \"user%lu\", \"bot\": false}, \"content\": ",
+                id, channel_id, guild_id, user_id, user);
+        replay_json_corpus_line(json, line);
+        fprintf(json, ", \"timestamp\": \"2024-01-01T00:00:00.000000+00:00\", \"mentions\": [], "
+                      "\"attachments\": [], \"embeds\": []}");
+        fclose(json);
+        replay_synth_record(out, DISCORD_EV_MESSAGE_CREATE, payload, length);
+        free(payload);
+
+        size_t prefix_length = strlen(REPLAY_SYNTH_PREFIX);
+        size_t name_length = 0;
+
+        if (strncmp(line, REPLAY_SYNTH_PREFIX, prefix_length) == 0)
+            name_length = strcspn(line + prefix_length, " \t\\");
+
+        if (name_length > 0)
+        {
+            json = open_memstream(&payload, &length);
+            fprintf(json,
+                    "{\"id\": \"%lu\", \"application_id\": \"%lu\", \"type\": 2, \"token\": \"replay-%lu\", "
+                    "\"channel_id\": \"%lu\", \"guild_id\": \"%lu\", "
+                    "\"member\": {\"user\": {\"id\": \"%lu\", \"username\": \"user%lu\"}}, "
+                    "\"data\": {\"id\": \"%lu\", \"type\": 1, \"name\": \"%.*s\"}}",
+                    id, guild_id, id, channel_id, guild_id, user_id, user, id, (int) name_length,
+                    line + prefix_length);
+            fclose(json);
+            replay_synth_record(out, DISCORD_EV_INTERACTION_CREATE, payload, length);
+            free(payload);
+        }
+
+        count++;
+    }
+
+    fclose(out);
+    fclose(file);
+    free(line);
+    recording->data = (unsigned char *) data;
+    return recording;
+}
+
+/* Stands in for Discord: logs the request and reports success right away. */
+static void replay_dispatch(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    rest_route_t route = op->route;
+
+    if (route == REST_ROUTE_DELETE_MESSAGE && op->delete.count > 1)
+        route = REST_ROUTE_BULK_DELETE_MESSAGES;
+
+    replay_rest_calls[route]++;
+
+    if (replay_rest_log != NULL)
+    {
+        FILE *out = replay_rest_log;
+        size_t length = 0;
+
+        fprintf(out, "{\"at_ms\": %.3f, \"route\": \"%s\", \"priority\": %d, \"major_id\": %lu, ",
+                (double) (get_monotonic_time_ns() - replay_started_at_ns) / 1e6, replay_route_names[route],
+                (int) op->priority, op->major_id);
+
+        switch (op->route)
+        {
+            case REST_ROUTE_DELETE_MESSAGE:
+            case REST_ROUTE_BULK_DELETE_MESSAGES:
+                fprintf(out, "\"messages\": [");
+
+                for (size_t i = 0; i < op->delete.count; i++)
+                    fprintf(out, "%s%lu", i == 0 ? "" : ", ", op->delete.message_ids[i]);
+
+                fprintf(out, "]");
+                break;
+
+            case REST_ROUTE_CREATE_GUILD_BAN:
+                fprintf(out, "\"user_id\": %lu, \"delete_message_seconds\": %d, \"reason\": ", op->ban.user_id,
+                        op->ban.delete_message_seconds);
+                replay_json_string(out, op->ban.reason);
+                break;
+
+            case REST_ROUTE_CREATE_MESSAGE:
+                length = discord_create_message_to_json(replay_json, sizeof replay_json, &op->message.params);
+                fprintf(out, "\"body\": %.*s", (int) length, length > 0 ? replay_json : "null");
+                break;
+
+            case REST_ROUTE_INTERACTION_RESPONSE:
+                length = discord_interaction_response_to_json(replay_json, sizeof replay_json,
+                                                              &op->interaction.params);
+                fprintf(out, "\"body\": %.*s", (int) length, length > 0 ? replay_json : "null");
+                break;
+
+            default:
+                break;
+        }
+
+        fprintf(out, "}\n");
+    }
+
+    rest_scheduler_complete(scheduler, op, CCORD_OK, NULL);
+}
+
+static const rest_transport_t replay_transport = {
+    .dispatch = &replay_dispatch,
+};
+
+static void replay_sleep_until(uint64_t deadline_ns)
+{
+    struct timespec ts = {
+        .tv_sec = (time_t) (deadline_ns / 1000000000ULL),
+        .tv_nsec = (long) (deadline_ns % 1000000000ULL),
+    };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+        ;
+}
+
+/* Mirrors what concord does for a dispatch: ask the scheduler hook, then decode and run the callback. */
+static bool replay_event(struct discord *client, const gateway_recorded_event_t *event)
+{
+    if (on_dispatch(client, event->data, event->size, event->event) == DISCORD_EVENT_IGNORE)
+        return false;
+
+    switch (event->event)
+    {
+        case DISCORD_EV_MESSAGE_CREATE:
+        {
+            struct discord_message message = { 0 };
+
+            discord_message_from_json(event->data, event->size, &message);
+            on_message(client, &message);
+            discord_message_cleanup(&message);
+            break;
+        }
+
+        case DISCORD_EV_INTERACTION_CREATE:
+        {
+            struct discord_interaction interaction = { 0 };
+
+            discord_interaction_from_json(event->data, event->size, &interaction);
+            on_interaction_create(client, &interaction);
+            discord_interaction_cleanup(&interaction);
+            break;
+        }
+
+        default:
+            return false;
+    }
+
+    rest_on_cycle(client);
+    return true;
+}
+
+static void replay_usage(const char *argv0)
+{
+    fprintf(stderr,
+            "Usage: %s [--speed X] [--repeat N] [--rest-log FILE] [--drain-ms N] [--output FILE] "
+            "[--event-filter MODE] [--synthesize] RECORDING\n",
+            argv0);
+}
+
+int main(int argc, char **argv)
+{
+    double speed = 1.0;
+    size_t repeat = 1;
+    uint64_t drain_ms = REPLAY_DEFAULT_DRAIN_MS;
+    const char *rest_log_path = NULL;
+    const char *output_path = NULL;
+    const char *path = NULL;
+    bool synthesize = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc)
+            speed = strtod(argv[++i], NULL);
+        else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--rest-log") == 0 && i + 1 < argc)
+            rest_log_path = argv[++i];
+        else if (strcmp(argv[i], "--drain-ms") == 0 && i + 1 < argc)
+            drain_ms = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            output_path = argv[++i];
+        else if (strcmp(argv[i], "--event-filter") == 0 && i + 1 < argc)
+            event_filter_mode = (event_filter_mode_t) strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--synthesize") == 0)
+            synthesize = true;
+        else if (argv[i][0] != '-' && path == NULL)
+            path = argv[i];
+        else
+        {
+            replay_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (path == NULL || speed < 0 || event_filter_mode > EVENT_FILTER_COMMANDS)
+    {
+        replay_usage(argv[0]);
+        return 1;
+    }
+
+    gateway_recording_t *recording = synthesize ? replay_synthesize(path) : gateway_recording_open(path);
+
+    if (recording == NULL)
+        return 1;
+
+    if (rest_log_path != NULL && (replay_rest_log = fopen(rest_log_path, "w")) == NULL)
+    {
+        fprintf(stderr, "gateway-replay: cannot write %s: %s\n", rest_log_path, strerror(errno));
+        return 1;
+    }
+
+    /*
+     * Events are decoded here rather than by concord, so they cannot be
+     * claimed; handlers run inline instead of through the pipeline.
+     */
+    unsetenv("EVENT_PIPELINE");
+
+    /* A client that never connects; only its state and callbacks are used. */
+    const char *token = getenv("TOKEN");
+    struct discord *client = sudobot_prepare(token != NULL ? token : "replay");
+
+    if (client == NULL)
+        return 1;
+
+    rest_scheduler_free(rest_scheduler);
+    rest_scheduler = rest_scheduler_init(&replay_transport);
+
+    /* Asynchronous commands fetch through concord directly, which would reach Discord and claim replayed events. */
+    cmd_async_set_offline(true);
+
+    struct replay_samples service = { 0 }, latency = { 0 };
+    gateway_recorded_event_t event;
+    uint64_t offset_ns = 0, first_at_ns = UINT64_MAX, last_at_ns = 0;
+    uint64_t handled = 0, skipped = 0, payload_bytes = 0;
+
+    replay_started_at_ns = get_monotonic_time_ns();
+
+    for (size_t round = 0; round < repeat; round++)
+    {
+        gateway_recording_rewind(recording);
+
+        while (gateway_recording_next(recording, &event))
+        {
+            if (first_at_ns == UINT64_MAX)
+                first_at_ns = event.at_ns;
+
+            last_at_ns = event.at_ns;
+
+            uint64_t due_ns = replay_started_at_ns;
+
+            if (speed > 0)
+            {
+                due_ns += (uint64_t) ((double) (offset_ns + event.at_ns - first_at_ns) / speed);
+                replay_sleep_until(due_ns);
+            }
+
+            uint64_t started_at = get_monotonic_time_ns();
+
+            if (!replay_event(client, &event))
+            {
+                skipped++;
+                continue;
+            }
+
+            uint64_t finished_at = get_monotonic_time_ns();
+
+            replay_samples_add(&service, finished_at - started_at);
+            replay_samples_add(&latency, finished_at - (speed > 0 ? due_ns : started_at));
+            payload_bytes += event.size;
+            handled++;
+        }
+
+        offset_ns += last_at_ns - first_at_ns + 1000000;
+    }
+
+    double elapsed_s = (double) (get_monotonic_time_ns() - replay_started_at_ns) / 1e9;
+    uint64_t drain_deadline = get_monotonic_time_ns() + drain_ms * 1000000ULL;
+
+    while (rest_scheduler->pending > 0 && get_monotonic_time_ns() < drain_deadline)
+    {
+        rest_scheduler_flush(rest_scheduler);
+        replay_sleep_until(get_monotonic_time_ns() + 1000000ULL);
+    }
+
+    rest_stats_t stats;
+    rest_scheduler_get_stats(rest_scheduler, &stats);
+
+    printf("recording:   %s\n", path);
+    if (speed > 0)
+        printf("speed:       %.2fx recorded\n", speed);
+    else
+        printf("speed:       as fast as possible\n");
+
+    printf("events:      %lu handled, %lu skipped, %.1f MiB of payload\n", handled, skipped,
+           (double) payload_bytes / (1024 * 1024));
+    printf("elapsed:     %.3f s\n", elapsed_s);
+    printf("throughput:  %.0f events/s\n\n", elapsed_s > 0 ? (double) handled / elapsed_s : 0);
+    replay_print_samples("service", &service);
+    replay_print_samples("latency", &latency);
+    printf("\n");
+
+    for (size_t route = 0; route < REST_ROUTE_COUNT; route++)
+        printf("%-42s %6lu calls\n", replay_route_names[route], replay_rest_calls[route]);
+
+    printf("coalesced:   %lu\n", stats.coalesced);
+    printf("undrained:   %zu\n", rest_scheduler->pending);
+
+    if (event_filter_mode != EVENT_FILTER_OFF)
+    {
+        event_filter_stats_t filter_stats;
+        event_filter_get_stats(&filter_stats);
+
+        printf("filtered:   ");
+
+        for (size_t reason = 0; reason < EVENT_FILTER_REASON_COUNT; reason++)
+            printf(" %s %lu", event_filter_reason_name(reason), filter_stats.filtered[reason]);
+
+        printf(" (%lu scanned, %lu malformed)\n", filter_stats.scanned, filter_stats.malformed);
+    }
+
+    if (output_path != NULL)
+    {
+        FILE *out = fopen(output_path, "w");
+
+        if (out == NULL)
+        {
+            fprintf(stderr, "gateway-replay: cannot write %s: %s\n", output_path, strerror(errno));
+        }
+        else
+        {
+            fprintf(out, "{\"source\": ");
+            replay_json_string(out, path);
+            fprintf(out,
+                    ", \"synthesized\": %s, \"speed\": %g, \"repeat\": %zu, \"compiler\": \"%s\", "
+                    "\"events\": %lu, \"skipped\": %lu, \"elapsed_s\": %.6f, \"events_per_second\": %.1f, ",
+                    synthesize ? "true" : "false", speed, repeat, __VERSION__, handled, skipped, elapsed_s,
+                    elapsed_s > 0 ? (double) handled / elapsed_s : 0);
+            replay_write_samples(out, "service_ns", &service);
+            fprintf(out, ", ");
+            replay_write_samples(out, "latency_ns", &latency);
+            fprintf(out, "}\n");
+            fclose(out);
+        }
+    }
+
+    if (replay_rest_log != NULL)
+        fclose(replay_rest_log);
+
+    free(service.values);
+    free(latency.values);
+    gateway_recording_free(recording);
+    sudobot_shutdown();
+    return 0;
+}
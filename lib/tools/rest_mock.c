@@ -0,0 +1,392 @@
+/*
+ * Mock REST harness for the outbound scheduler.
+ *
+ * Replaces the concord transport with an in-process model of Discord's
+ * REST limits (fixed windows per route bucket and for the global limit,
+ * reported in rate-limit headers, answering with a rate limit error when
+ * exceeded) driven by a virtual clock, then replays
+ * a raid-shaped burst of deletes, bans, log posts and replies through
+ * the scheduler and reports how many API calls were made and when each
+ * class of request landed.
+ *
+ * With --audit-log [RECORDS], instead streams a raid's worth of audit log
+ * records to one log channel through the batching emitter and checks that
+ * every record lands, in order, in far fewer API calls than records.
+ *
+ * Build and run with `make rest-mock`.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../common/rest/scheduler.h"
+#include "../common/rest/audit_log.h"
+
+#define TICK_NS 10000000ULL
+#define MAX_TICKS 60000
+#define CHANNELS 5
+#define LOG_CHANNEL 9000
+#define GUILD 1
+#define RAID_TICKS 1000
+
+struct mock_bucket
+{
+    u64snowflake id;
+    rest_route_t route;
+    unsigned int used;
+    uint64_t window_start_ns;
+};
+
+struct mock_route
+{
+    const char *name;
+    unsigned int limit;
+    uint64_t window_ns;
+};
+
+static const struct mock_route mock_routes[REST_ROUTE_COUNT] = {
+    [REST_ROUTE_DELETE_MESSAGE] = { "DELETE /channels/:id/messages/:id", 5, 1000000000ULL },
+    [REST_ROUTE_BULK_DELETE_MESSAGES] = { "POST /channels/:id/messages/bulk-delete", 1, 1000000000ULL },
+    [REST_ROUTE_CREATE_GUILD_BAN] = { "PUT /guilds/:id/bans/:id", 5, 1000000000ULL },
+    [REST_ROUTE_CREATE_MESSAGE] = { "POST /channels/:id/messages", 5, 5000000000ULL },
+    [REST_ROUTE_INTERACTION_RESPONSE] = { "POST /interactions/:id/:token/callback", 1000, 1000000000ULL },
+};
+
+static uint64_t mock_now = 0;
+static struct mock_bucket mock_buckets[1024];
+static size_t mock_bucket_count = 0;
+static unsigned int mock_global_used = 0;
+static uint64_t mock_global_window_start = 0;
+
+static uint64_t mock_calls[REST_ROUTE_COUNT];
+static uint64_t mock_rate_limited = 0;
+static uint64_t mock_landed[REST_PRIORITY_COUNT];
+static uint64_t mock_last_landed_ns[REST_PRIORITY_COUNT];
+static uint64_t mock_items_landed = 0;
+static void (*mock_on_land)(const rest_op_t *op) = NULL;
+
+static uint64_t mock_clock(void)
+{
+    return mock_now;
+}
+
+static uint64_t mock_reset_after_ms(uint64_t window_start_ns, uint64_t window_ns)
+{
+    return (window_start_ns + window_ns - mock_now + 999999) / 1000000;
+}
+
+static bool mock_take(rest_route_t route, u64snowflake id, rest_ratelimit_t *ratelimit)
+{
+    struct mock_bucket *bucket = NULL;
+
+    for (size_t i = 0; i < mock_bucket_count; i++)
+    {
+        if (mock_buckets[i].id == id && mock_buckets[i].route == route)
+        {
+            bucket = &mock_buckets[i];
+            break;
+        }
+    }
+
+    if (bucket == NULL)
+    {
+        bucket = &mock_buckets[mock_bucket_count++];
+        *bucket = (struct mock_bucket) { .id = id, .route = route, .window_start_ns = mock_now };
+    }
+
+    if (mock_now - bucket->window_start_ns >= mock_routes[route].window_ns)
+    {
+        bucket->window_start_ns = mock_now;
+        bucket->used = 0;
+    }
+
+    if (mock_now - mock_global_window_start >= 1000000000ULL)
+    {
+        mock_global_window_start = mock_now;
+        mock_global_used = 0;
+    }
+
+    if (route != REST_ROUTE_INTERACTION_RESPONSE && mock_global_used >= REST_GLOBAL_LIMIT)
+    {
+        *ratelimit = (rest_ratelimit_t) {
+            .reset_after_ms = mock_reset_after_ms(mock_global_window_start, 1000000000ULL),
+            .global = true,
+        };
+
+        return false;
+    }
+
+    bool allowed = bucket->used < mock_routes[route].limit;
+
+    if (allowed)
+        bucket->used++;
+
+    if (allowed && route != REST_ROUTE_INTERACTION_RESPONSE)
+        mock_global_used++;
+
+    *ratelimit = (rest_ratelimit_t) {
+        .limit = mock_routes[route].limit,
+        .remaining = mock_routes[route].limit - bucket->used,
+        .reset_after_ms = mock_reset_after_ms(bucket->window_start_ns, mock_routes[route].window_ns),
+    };
+
+    return allowed;
+}
+
+static void mock_dispatch(rest_scheduler_t *scheduler, rest_op_t *op)
+{
+    rest_route_t route = op->route;
+    rest_ratelimit_t ratelimit;
+    size_t items = 1;
+
+    if (route == REST_ROUTE_DELETE_MESSAGE && op->delete.count > 1)
+    {
+        route = REST_ROUTE_BULK_DELETE_MESSAGES;
+        items = op->delete.count;
+    }
+    else if (route == REST_ROUTE_CREATE_MESSAGE && op->message.params.embeds != NULL)
+        items = (size_t) op->message.params.embeds->size;
+
+    mock_calls[route]++;
+
+    if (!mock_take(route, op->major_id, &ratelimit))
+    {
+        mock_rate_limited++;
+        rest_scheduler_complete(scheduler, op, CCORD_DISCORD_RATELIMIT, &ratelimit);
+        return;
+    }
+
+    mock_landed[op->priority] += items;
+    mock_last_landed_ns[op->priority] = mock_now;
+    mock_items_landed += items;
+
+    if (mock_on_land != NULL)
+        mock_on_land(op);
+
+    rest_scheduler_complete(scheduler, op, CCORD_OK, &ratelimit);
+}
+
+static const rest_transport_t mock_transport = {
+    .dispatch = &mock_dispatch,
+    .now_ns = &mock_clock,
+};
+
+static u64snowflake mock_recent_snowflake(uint64_t sequence)
+{
+    uint64_t now_ms = (uint64_t) time(NULL) * 1000;
+    return ((now_ms - 1420070400000ULL) << 22) | (sequence & 0x3FFFFF);
+}
+
+static uint64_t audit_landed = 0;
+static uint64_t audit_out_of_order = 0;
+static long long audit_previous = -1;
+
+static void audit_check(const char *text)
+{
+    const char *number = text == NULL ? NULL : strrchr(text, '#');
+    long long sequence = number == NULL ? -1 : strtoll(number + 1, NULL, 10);
+
+    if (sequence <= audit_previous)
+        audit_out_of_order++;
+
+    audit_previous = sequence;
+    audit_landed++;
+}
+
+static void audit_on_land(const rest_op_t *op)
+{
+    const struct discord_embeds *embeds = op->message.params.embeds;
+
+    for (int i = 0; embeds != NULL && i < embeds->size; i++)
+    {
+        const struct discord_embed *embed = &embeds->array[i];
+
+        if (embed->title != NULL && strcmp(embed->title, "Audit log overflow") == 0)
+            continue;
+
+        if (embed->description != NULL)
+        {
+            audit_check(embed->description);
+            continue;
+        }
+
+        for (int j = 0; embed->fields != NULL && j < embed->fields->size; j++)
+            audit_check(embed->fields->array[j].value);
+    }
+}
+
+static int mock_audit_log(size_t records)
+{
+    audit_log_config_t config = {
+        .flush_delay_ms = AUDIT_LOG_DEFAULT_FLUSH_DELAY_MS,
+        .channel_limit = AUDIT_LOG_DEFAULT_CHANNEL_LIMIT,
+    };
+    audit_log_stats_t stats;
+    size_t emitted = 0, ticks = 0;
+    uint64_t calls;
+
+    rest_scheduler = rest_scheduler_init(&mock_transport);
+    audit_log = audit_log_init(&config);
+    mock_on_land = &audit_on_land;
+
+    do
+    {
+        size_t due = ticks >= RAID_TICKS ? records : records * ticks / RAID_TICKS;
+
+        for (; emitted < due; emitted++)
+        {
+            char description[64];
+            audit_log_field_t fields[] = {
+                { .name = "Action", .value = "Lockdown", .is_inline = true },
+                { .name = "Threshold", .value = "10 joins / 10 s", .is_inline = true },
+            };
+            audit_log_record_t record = { .description = description, .timestamp_ms = 1700000000000ULL + ticks * 10 };
+
+            /* Waves of joins and of the bans answering them, with the odd full embed in between. */
+            if (emitted % 250 == 0)
+            {
+                record.title = "Raid detected";
+                record.color = 0xf14a60;
+                record.fields = fields;
+                record.field_count = sizeof (fields) / sizeof (fields[0]);
+                snprintf(description, sizeof (description), "Join rate over the threshold #%zu", emitted);
+            }
+            else if (emitted / 100 % 2 == 0)
+            {
+                record.title = "Member joined";
+                record.color = 0x007bff;
+                record.compact = true;
+                snprintf(description, sizeof (description), "<@%zu> joined #%zu", 5000 + emitted, emitted);
+            }
+            else
+            {
+                record.title = "Member banned";
+                record.color = 0xf14a60;
+                record.compact = true;
+                snprintf(description, sizeof (description), "<@%zu>: Raid #%zu", 5000 + emitted, emitted);
+            }
+
+            audit_log_emit(audit_log, LOG_CHANNEL, &record);
+        }
+
+        audit_log_flush(audit_log, NULL);
+        rest_scheduler_flush(rest_scheduler);
+        audit_log_get_stats(audit_log, &stats);
+        mock_now += TICK_NS;
+    }
+    while ((emitted < records || stats.buffered != 0 || rest_scheduler->pending != 0) && ticks++ < MAX_TICKS);
+
+    calls = mock_calls[REST_ROUTE_CREATE_MESSAGE];
+
+    printf("records:              %zu over %.2f s\n", records, RAID_TICKS * TICK_NS / 1e9);
+    printf("landed:               %lu (%lu out of order)\n", audit_landed, audit_out_of_order);
+    printf("API calls:            %lu (%lu rate limited)\n", calls, mock_rate_limited);
+    printf("messages:             %lu\n", stats.messages);
+    printf("folded into fields:   %lu\n", stats.folded);
+    printf("overflowed:           %lu\n", stats.overflowed + stats.dropped);
+    printf("failed:               %lu\n", stats.failed);
+    printf("last landed at:       %.2f s\n", (double) mock_last_landed_ns[REST_PRIORITY_LOG] / 1e9);
+
+    audit_log_free(audit_log);
+    rest_scheduler_free(rest_scheduler);
+
+    return audit_landed + stats.dropped != records || audit_out_of_order != 0 || stats.failed != 0 ? EXIT_FAILURE
+                                                                                                   : EXIT_SUCCESS;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "--audit-log") == 0)
+        return mock_audit_log(argc > 2 ? strtoul(argv[2], NULL, 10) : 2000);
+
+    size_t deletes = argc > 1 ? strtoul(argv[1], NULL, 10) : 500;
+    size_t bans = argc > 2 ? strtoul(argv[2], NULL, 10) : 150;
+    size_t logs = argc > 3 ? strtoul(argv[3], NULL, 10) : 300;
+    size_t replies = argc > 4 ? strtoul(argv[4], NULL, 10) : 50;
+    size_t total_items = deletes + bans + logs + replies;
+    struct discord_embed embed = { .title = "Member banned", .description = "Raid cleanup", .color = 0xf14a60 };
+    struct discord_embeds embeds = { .array = &embed, .size = 1 };
+    struct discord_create_message log_params = { .embeds = &embeds };
+    struct discord_create_message reply_params = { .content = "Pong!" };
+    size_t ticks = 0;
+
+    rest_scheduler = rest_scheduler_init(&mock_transport);
+
+    for (size_t i = 0; i < total_items; i++)
+    {
+        size_t kind = i % 4;
+
+        if (kind == 0 && deletes > 0)
+        {
+            rest_delete_message(NULL, 100 + (deletes % CHANNELS), mock_recent_snowflake(i), REST_PRIORITY_MODERATION);
+            deletes--;
+        }
+        else if (kind == 1 && bans > 0)
+        {
+            rest_ban_member(NULL, GUILD, 5000 + i, 0, "Raid");
+            bans--;
+        }
+        else if (kind == 2 && logs > 0)
+        {
+            rest_create_message(NULL, LOG_CHANNEL, &log_params, REST_PRIORITY_LOG);
+            logs--;
+        }
+        else if (replies > 0)
+        {
+            rest_create_message(NULL, 100 + (replies % CHANNELS), &reply_params, REST_PRIORITY_REPLY);
+            replies--;
+        }
+        else if (deletes > 0)
+        {
+            rest_delete_message(NULL, 100 + (deletes % CHANNELS), mock_recent_snowflake(i), REST_PRIORITY_MODERATION);
+            deletes--;
+        }
+        else if (bans > 0)
+        {
+            rest_ban_member(NULL, GUILD, 5000 + i, 0, "Raid");
+            bans--;
+        }
+        else if (logs > 0)
+        {
+            rest_create_message(NULL, LOG_CHANNEL, &log_params, REST_PRIORITY_LOG);
+            logs--;
+        }
+    }
+
+    while (rest_scheduler->pending > 0 && ticks++ < MAX_TICKS)
+    {
+        rest_scheduler_flush(rest_scheduler);
+        mock_now += TICK_NS;
+    }
+
+    rest_stats_t stats;
+    uint64_t calls = 0;
+
+    rest_scheduler_get_stats(rest_scheduler, &stats);
+
+    for (size_t route = 0; route < REST_ROUTE_COUNT; route++)
+    {
+        calls += mock_calls[route];
+        printf("%-42s %6lu calls\n", mock_routes[route].name, mock_calls[route]);
+    }
+
+    printf("\nrequested operations: %zu\n", total_items);
+    printf("landed operations:    %lu\n", mock_items_landed);
+    printf("API calls:            %lu (%lu rate limited)\n", calls, mock_rate_limited);
+    printf("coalesced:            %lu\n", stats.coalesced);
+    printf("failed:               %lu\n", stats.failed);
+    printf("simulated time:       %.2f s\n\n", (double) mock_now / 1e9);
+
+    static const char *const priority_names[] = { "moderation", "interaction", "log", "reply" };
+
+    for (size_t priority = 0; priority < REST_PRIORITY_COUNT; priority++)
+    {
+        if (mock_landed[priority] != 0)
+            printf("%-12s %6lu landed, last at %.2f s\n", priority_names[priority], mock_landed[priority],
+                   (double) mock_last_landed_ns[priority] / 1e9);
+    }
+
+    rest_scheduler_free(rest_scheduler);
+    return stats.failed != 0 || mock_items_landed != total_items ? EXIT_FAILURE : EXIT_SUCCESS;
+}